@@ -0,0 +1,118 @@
+#ifndef ACCESS_LOG_H
+#define ACCESS_LOG_H
+
+#include <bvar/bvar.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// 鉴权请求的结构化访问日志，替代热路径上逐请求的 LOG(INFO)
+// 请求线程只做抽样判断和一次定长记录的拷贝：写入本线程独占的环形缓冲区（单生产者单消费者，无锁），
+// 后台线程按 flush_interval_ms 批量取出、格式化并写文件。缓冲区满时丢弃并计入 access_log_dropped。
+// bRPC 的 bthread 可能在不同 pthread 间迁移，但 Append 中不会让出，按 pthread 划分缓冲区仍然成立。
+class AccessLog {
+public:
+    enum Method : uint8_t {
+        kCheck = 1,
+        kBatchCheck = 2,
+    };
+
+    // 定长记录；binary 格式按此布局原样写出（本机字节序），文件头为 8 字节 "SQACLOG1" 后接 uint32 记录长度
+    // 字符串字段以 '\0' 结尾，超长截断
+    struct Record {
+        int64_t time_us;     // 请求结束时间 (gettimeofday)
+        int64_t latency_us;
+        uint8_t method;
+        uint8_t allowed;     // BatchCheck: 全部允许时为 1
+        uint8_t cache_hit;
+        uint8_t reserved;
+        int32_t items;       // BatchCheck 条目数，Check 为 1
+        int32_t denied;      // BatchCheck 被拒绝的条目数
+        char app_code[32];
+        char user_id[64];
+        char perm_key[64];
+        char reason[20];     // 拒绝原因（与 auth_check_deny 的 reason 标签一致）
+    };
+
+    struct Options {
+        std::string path;                 // 为空时不记录
+        std::string format = "ndjson";    // ndjson / binary
+        double allow_sample_rate = 0.01;  // 允许的请求按比例抽样
+        double deny_sample_rate = 1.0;    // 拒绝的请求（BatchCheck 含任一拒绝）
+        size_t buffer_records = 1024;     // 每个线程的缓冲区容量，向上取整为 2 的幂
+        int flush_interval_ms = 100;
+    };
+
+    explicit AccessLog(const Options& options);
+    ~AccessLog();
+
+    AccessLog(const AccessLog&) = delete;
+    AccessLog& operator=(const AccessLog&) = delete;
+
+    // 配置了路径且文件打开成功
+    bool enabled() const { return enabled_; }
+
+    // 按抽样率决定是否记录；为 false 时调用方不必准备记录内容
+    bool Sampled(bool allowed) const;
+
+    // 在本线程缓冲区中追加一条记录，time_us 由这里填写；reason 可为空
+    void Append(Method method, const std::string& app_code, const std::string& user_id,
+                const std::string& perm_key, bool allowed, bool cache_hit, const char* reason,
+                int32_t items, int32_t denied, int64_t latency_us);
+
+private:
+    struct ThreadBuffer {
+        explicit ThreadBuffer(size_t capacity)
+            : records(new Record[capacity]), mask(capacity - 1) {}
+        std::unique_ptr<Record[]> records;
+        const size_t mask;
+        std::atomic<uint64_t> head{0};  // 下一个写入位置，只由所属线程修改
+        std::atomic<uint64_t> tail{0};  // 下一个读取位置，只由后台线程修改
+    };
+
+    ThreadBuffer* LocalBuffer();
+    void FlushLoop();
+    // 取出所有缓冲区中的记录并写文件，返回写出的条数
+    size_t Drain();
+    void FormatJson(const Record& rec, std::string& out);
+    void OpenFile();
+    // 文件被外部轮转（改名或删除）后重新打开
+    void ReopenIfRotated();
+
+    const uint64_t id_;  // 区分实例，线程局部缓存据此判断是否属于本实例
+    Options options_;
+    bool binary_;
+    uint64_t allow_threshold_;  // 抽样阈值：fast_rand_less_than(kSampleScale) < threshold 时记录
+    uint64_t deny_threshold_;
+    size_t capacity_;
+    bool enabled_ = false;  // 构造完成后不再改变，请求线程据此判断是否记录
+
+    std::mutex buffers_mutex_;
+    std::unordered_map<std::thread::id, std::unique_ptr<ThreadBuffer>> buffers_;
+    std::vector<ThreadBuffer*> buffer_list_;  // 受 buffers_mutex_ 保护，后台线程拷贝后遍历
+
+    FILE* file_ = nullptr;  // 只由后台线程（以及构造/析构）访问
+    uint64_t file_inode_ = 0;
+    std::string write_buf_;
+    int64_t formatted_second_ = -1;  // second_buf_ 对应的秒数
+    char second_buf_[24] = {};
+
+    std::mutex flush_mutex_;
+    std::condition_variable flush_cond_;
+    bool stopping_ = false;
+    std::atomic<bool> flush_requested_{false};  // 有缓冲区过半，需要提前刷盘
+    std::thread flusher_;
+
+    bvar::Adder<int64_t> written_;
+    bvar::Adder<int64_t> dropped_;
+    bvar::Adder<int64_t> write_errors_;
+};
+
+#endif // ACCESS_LOG_H
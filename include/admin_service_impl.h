@@ -3,25 +3,59 @@
 
 #include "permission_dao.h"
 #include "auth.pb.h"
-#include "local_cache.h"
+#include "perm_cache.h"
+#include "audit_writer.h"
+#include "audit_archive.h"
+#include "session_token.h"
+#include "cache_invalidator.h"
+#include "db_executor.h"
+#include "rate_limiter.h"
 #include <brpc/server.h>
 #include <butil/logging.h>
 #include <unordered_set>
 
+// 登录的密码校验（crypt）是刻意设计得很慢的 CPU 密集操作，放在独立的有界线程池中执行，
+// 并按用户名、来源 IP 限流，避免撞库或登录风暴占满 bRPC worker 拖慢鉴权请求。
+struct AdminLoginOptions {
+    size_t threads = 4;         // 密码校验线程数，0 表示在 bRPC worker 中同步执行
+    size_t queue_size = 64;     // 等待队列上限，满了直接拒绝（503）；至少为 1，0 按 1 处理
+    int user_per_min = 10;      // 每个用户名每分钟最多尝试次数，<= 0 不限
+    int ip_per_min = 60;        // 每个来源 IP 每分钟最多尝试次数，<= 0 不限
+};
+
 class AdminServiceImpl : public siqi::auth::AdminService {
 private:
-    PermissionDAO dao_;
-    std::shared_ptr<LocalCache<std::unordered_set<std::string>>> cache_;
+    // 权限数据存储：默认为 MySQL (PermissionDAO)，基准测试可换成 MemoryPermissionStore
+    std::shared_ptr<PermissionStore> dao_;
+    std::shared_ptr<PermCache> cache_;
     int session_ttl_;
+    // 权限缓存失效（本地 + 推送给其他副本）；未传入时只失效本地
+    std::shared_ptr<CacheInvalidator> invalidator_;
     
 public:
-    AdminServiceImpl(std::shared_ptr<LocalCache<std::unordered_set<std::string>>> cache,
+    AdminServiceImpl(std::shared_ptr<PermCache> cache,
                      const std::string& host,
                      int port,
                      const std::string& user,
                      const std::string& password,
                      const std::string& database,
-                     int session_ttl);
+                     int session_ttl,
+                     std::shared_ptr<AppCatalog> app_catalog = nullptr,
+                     const AuditWriter::Options& audit_options = AuditWriter::Options(),
+                     const AuditArchive::Options& archive_options = AuditArchive::Options(),
+                     const std::string& token_key = "",
+                     const AdminLoginOptions& login_options = AdminLoginOptions(),
+                     std::shared_ptr<CacheInvalidator> invalidator = nullptr);
+
+    // 使用外部提供的存储（例如进程内的 MemoryPermissionStore）
+    AdminServiceImpl(std::shared_ptr<PermCache> cache,
+                     std::shared_ptr<PermissionStore> store,
+                     int session_ttl,
+                     const AuditWriter::Options& audit_options = AuditWriter::Options(),
+                     const AuditArchive::Options& archive_options = AuditArchive::Options(),
+                     const std::string& token_key = "",
+                     const AdminLoginOptions& login_options = AdminLoginOptions(),
+                     std::shared_ptr<CacheInvalidator> invalidator = nullptr);
                      
     // ------------------------- 应用管理 -------------------------
     void CreateApp(google::protobuf::RpcController* cntl,
@@ -60,6 +94,16 @@ public:
                             siqi::auth::AdminResponse* response,
                             google::protobuf::Closure* done) override;
                             
+    void BatchGrantRoles(google::protobuf::RpcController* cntl,
+                         const siqi::auth::BatchGrantRolesRequest* request,
+                         siqi::auth::AdminResponse* response,
+                         google::protobuf::Closure* done) override;
+
+    void BatchRevokeRoles(google::protobuf::RpcController* cntl,
+                          const siqi::auth::BatchRevokeRolesRequest* request,
+                          siqi::auth::AdminResponse* response,
+                          google::protobuf::Closure* done) override;
+
     void GetRoleUsers(google::protobuf::RpcController* cntl,
                       const siqi::auth::GetRoleUsersRequest* request,
                       siqi::auth::GetRoleUsersResponse* response,
@@ -148,8 +192,32 @@ public:
 private:
    // Validate token and return session info. Returns false if invalid.
    bool ValidateToken(brpc::Controller* cntl, SessionInfo& session);
+
+   // BatchGrantRoles / BatchRevokeRoles 的公共流程：单事务写库 + 批量审计 + 一次性失效缓存
+   void DoBatchRoles(const SessionInfo& session,
+                     const std::string& app_code,
+                     const google::protobuf::RepeatedPtrField<std::string>& user_ids,
+                     const google::protobuf::RepeatedPtrField<std::string>& role_keys,
+                     bool grant,
+                     siqi::auth::AdminResponse* response);
+
+   // Login 的主体：查用户、校验密码、签发 Token，可能运行在 login_executor_ 中
+   void DoLogin(const siqi::auth::LoginRequest* request, siqi::auth::LoginResponse* response);
    
    LocalCache<SessionInfo> session_cache_;
+   // 配置了密钥时签发无状态的签名 Token，不再使用 session_cache_
+   std::unique_ptr<SessionTokenSigner> token_signer_;
+
+   // 审计日志异步写入（依赖 dao_，需声明在其后以保证先于 dao_ 析构并写完队列）
+   std::unique_ptr<AuditWriter> audit_writer_;
+
+   // 审计日志分区维护与冷数据归档（同样依赖 dao_）
+   std::unique_ptr<AuditArchive> audit_archive_;
+
+   // 登录限流与密码校验线程池；执行器声明在最后，析构时最先停止并跑完已入队的登录
+   RateLimiter login_user_limiter_;
+   RateLimiter login_ip_limiter_;
+   std::unique_ptr<DBExecutor> login_executor_;
 };
 
 #endif // ADMIN_SERVICE_IMPL_H
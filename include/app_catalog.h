@@ -0,0 +1,78 @@
+#ifndef APP_CATALOG_H
+#define APP_CATALOG_H
+
+#include <unordered_map>
+#include <mutex>
+#include <chrono>
+#include <string>
+#include <cstdint>
+
+// 进程内的应用目录：app_code -> (app_id, status, app_secret)
+// sys_apps 数据量小且很少变化，几乎每个 DAO 方法都要先把 app_code 解析成 app_id，
+// 缓存在内存中可以省掉一次数据库往返，并让热点查询直接按 app_id 过滤而不必 JOIN sys_apps。
+// 由 PermissionDAO 负责加载与刷新（启动全量加载、应用增删改时更新、后台定时全量刷新）。
+class AppCatalog {
+public:
+    struct Entry {
+        int64_t id = -1;
+        int32_t status = 0;
+        std::string app_secret;
+    };
+
+    // 查询应用
+    bool Get(const std::string& app_code, Entry& entry) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = apps_.find(app_code);
+        if (it == apps_.end()) {
+            return false;
+        }
+        entry = it->second;
+        return true;
+    }
+
+    // 是否为已知应用，不拷贝条目
+    bool Contains(const std::string& app_code) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return apps_.count(app_code) > 0;
+    }
+
+    // 新增或更新单个应用
+    void Put(const std::string& app_code, const Entry& entry) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        apps_[app_code] = entry;
+    }
+
+    // 移除单个应用
+    void Erase(const std::string& app_code) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        apps_.erase(app_code);
+    }
+
+    // 用全量加载的结果整体替换
+    void Reset(std::unordered_map<std::string, Entry> apps) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        apps_.swap(apps);
+        loaded_at_ = std::chrono::steady_clock::now();
+        loaded_ = true;
+    }
+
+    // 距上次全量加载是否已超过 max_age（从未加载过也视为过期）
+    // 多个 DAO 共享同一个目录时，据此避免重复刷新
+    bool IsStale(std::chrono::milliseconds max_age) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return !loaded_ || std::chrono::steady_clock::now() - loaded_at_ > max_age;
+    }
+
+    size_t Size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return apps_.size();
+    }
+
+private:
+    std::unordered_map<std::string, Entry> apps_;
+    std::chrono::steady_clock::time_point loaded_at_;
+    bool loaded_ = false;
+    mutable std::mutex mutex_;
+};
+
+#endif // APP_CATALOG_H
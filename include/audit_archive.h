@@ -0,0 +1,102 @@
+#ifndef AUDIT_ARCHIVE_H
+#define AUDIT_ARCHIVE_H
+
+#include "permission_store.h"
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// 审计日志分区维护与冷数据归档
+// sys_audit_logs 按月 RANGE 分区，后台线程定期：
+//  - 从 pmax 中提前拆出后续 future_months 个月的分区
+//  - 把早于热数据窗口 (hot_months) 的分区按 (created_at, id) 倒序导出为 gzip 压缩的 NDJSON 文件
+//    (dir/audit_<上界YYYYMMDD>_n<行数>.ndjson.gz)，校验行数后 DROP 该分区
+// 归档文件不可变，ListAuditLogs 在热表取不满一页时通过 Scan 继续顺序扫描归档文件，
+// 热表因此只保留最近几个月的数据，写入与查询代价不随历史增长。
+// 分区维护与归档只在 Options::leader 的实例上执行，避免多个副本同时改分区、重复导出。
+class AuditArchive {
+public:
+    struct Options {
+        std::string dir;            // 归档目录，为空则只维护分区、不归档
+        int hot_months = 3;         // 热表保留的月数（含当月）
+        int future_months = 2;      // 提前创建的分区月数
+        int check_interval_s = 3600;
+        // 只能有一个实例负责分区维护与归档；其他副本只定期重新加载 dir 中的归档文件用于查询
+        // （多副本时 dir 应为共享存储）
+        bool leader = false;
+    };
+
+    // 归档文件的筛选条件，字段为空表示不过滤；时间为 "YYYY-MM-DD HH:MM:SS"（本地时间）
+    struct Filter {
+        std::string app_code;
+        std::string action;
+        std::string operator_id;
+        std::string target_id;
+        std::string start_time;
+        std::string end_time;
+    };
+
+    AuditArchive(PermissionStore* dao, const Options& options);
+    ~AuditArchive();
+
+    AuditArchive(const AuditArchive&) = delete;
+    AuditArchive& operator=(const AuditArchive&) = delete;
+
+    void Stop();
+
+    // 补齐后续分区并归档过期分区，返回 false 表示本轮有操作失败；非 leader 时只重新加载归档文件
+    bool RunOnce();
+
+    // 已归档数据的上界：归档文件中的记录都早于该时间，热表只需查询此后的数据；没有归档时为空
+    std::string HotLowerBound() const;
+
+    // 按 (created_at, id) 倒序流式扫描归档文件：跳过不早于 after 的记录，再跳过 skip 条匹配记录，
+    // 最多追加 limit 条到 out。只解压读到的部分，取满即停
+    bool Scan(const Filter& filter,
+              const PermissionStore::PageCursor* after,
+              int64_t skip,
+              size_t limit,
+              std::vector<PermissionStore::AuditLogInfo>& out) const;
+
+    // 归档中的记录数。无筛选条件或非精确模式时直接取文件名中的行数（带筛选时为上界估算）；
+    // 精确模式扫描计数，每个文件的结果按筛选条件缓存，同一查询翻页时不再重复解压
+    int64_t Count(const Filter& filter, bool exact) const;
+
+    // unix 时间戳转为本地时间字符串，与 MySQL FROM_UNIXTIME 一致
+    static std::string FormatTime(int64_t ts);
+    // 本地时间字符串转为 unix 时间戳，格式错误时返回 -1
+    static int64_t ParseTime(const std::string& time);
+
+private:
+    struct ArchiveFile {
+        std::string path;
+        std::string until;  // 上界（不含），"YYYY-MM-DD HH:MM:SS"
+        int64_t rows = 0;
+    };
+
+    void Loop();
+    bool EnsurePartitions(const std::vector<PermissionStore::AuditPartition>& parts);
+    bool ArchivePartition(const PermissionStore::AuditPartition& part);
+    // 重新扫描归档目录，按上界倒序
+    void LoadFiles();
+    std::vector<ArchiveFile> Files() const;
+
+    PermissionStore* dao_;
+    Options options_;
+
+    mutable std::mutex mutex_;
+    std::vector<ArchiveFile> files_;    // 按上界倒序（最新的在前）
+    enum { kMaxCachedCounts = 4096 };
+    mutable std::unordered_map<std::string, int64_t> count_cache_;  // 文件+筛选条件 -> 匹配行数
+
+    std::mutex loop_mutex_;
+    std::condition_variable loop_cond_;
+    bool stopped_ = false;
+    bool warned_unpartitioned_ = false;
+    std::thread worker_;
+};
+
+#endif // AUDIT_ARCHIVE_H
@@ -0,0 +1,80 @@
+#ifndef AUDIT_WRITER_H
+#define AUDIT_WRITER_H
+
+#include "permission_store.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 异步审计日志写入器
+// 管理操作只把审计记录放入内存队列即返回，由后台线程攒批后用多行 INSERT 一次提交（group commit），
+// 审计表变慢时不再拖慢管理 RPC。
+//  - 队列有界：写满时调用方最多阻塞 enqueue_timeout_ms（背压），仍无空位则写入落盘文件或丢弃
+//  - 数据库写入失败的批次追加到本地落盘文件 (spill_path)，数据库恢复后自动回放；
+//    回放每提交一批就把进度写入 <spill_path>.replay.offset，崩溃或写库失败后从断点继续，已记录进度的批次不会重复写入
+//  - Stop()/析构时会把队列中的记录全部写完
+class AuditWriter {
+public:
+    struct Options {
+        bool async = true;               // false 时退化为同步写库（原有行为）
+        size_t queue_capacity = 10000;   // 队列上限
+        size_t max_batch = 500;          // 单次提交的最大行数
+        int flush_interval_ms = 200;     // 攒批等待时间
+        int enqueue_timeout_ms = 100;    // 队列满时调用方最长等待时间
+        std::string spill_path;          // 落盘文件路径，为空则不落盘
+    };
+
+    AuditWriter(PermissionStore* dao, const Options& options);
+    ~AuditWriter();
+
+    AuditWriter(const AuditWriter&) = delete;
+    AuditWriter& operator=(const AuditWriter&) = delete;
+
+    // 记录一条审计日志，参数与 PermissionStore::createAuditLog 一致
+    bool Log(int64_t operator_id,
+             const std::string& operator_name,
+             const std::string& app_code,
+             const std::string& action,
+             const std::string& target_type,
+             const std::string& target_id,
+             const std::string& target_name = "",
+             const std::string& object_type = "",
+             const std::string& object_id = "",
+             const std::string& object_name = "");
+
+    // 批量记录（例如批量授权），返回 false 表示有记录未能入队也未能落盘
+    bool Append(std::vector<PermissionStore::AuditLogInfo> logs);
+
+    // 停止后台线程，队列中剩余记录写完后返回
+    void Stop();
+
+    size_t QueueSize() const;
+
+private:
+    void WriterLoop();
+    // 写库，失败时落盘
+    void Flush(const std::vector<PermissionStore::AuditLogInfo>& batch);
+    bool Spill(const std::vector<PermissionStore::AuditLogInfo>& logs);
+    // 回放落盘文件（从上次中断的偏移继续），全部写入成功返回 true；失败时保留 .replay 与偏移等待下次回放
+    bool ReplaySpill();
+
+    static std::string Now();
+
+    PermissionStore* dao_;
+    Options options_;
+
+    std::deque<PermissionStore::AuditLogInfo> queue_;
+    mutable std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    bool stopped_ = false;
+    std::thread writer_;
+
+    std::mutex spill_mutex_;
+    bool has_spill_ = false;  // 落盘文件中可能有待回放的记录，仅后台线程与 Spill 访问（受 spill_mutex_ 保护）
+};
+
+#endif // AUDIT_WRITER_H
@@ -1,19617 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// NO CHECKED-IN PROTOBUF GENCODE
-// source: auth.proto
-// Protobuf C++ Version: 5.29.3
-
-#ifndef auth_2eproto_2epb_2eh
-#define auth_2eproto_2epb_2eh
-
-#include <limits>
-#include <string>
-#include <type_traits>
-#include <utility>
-
-#include "google/protobuf/runtime_version.h"
-#if PROTOBUF_VERSION != 5029003
-#error "Protobuf C++ gencode is built with an incompatible version of"
-#error "Protobuf C++ headers/runtime. See"
-#error "https://protobuf.dev/support/cross-version-runtime-guarantee/#cpp"
-#endif
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/arena.h"
-#include "google/protobuf/arenastring.h"
-#include "google/protobuf/generated_message_tctable_decl.h"
-#include "google/protobuf/generated_message_util.h"
-#include "google/protobuf/metadata_lite.h"
-#include "google/protobuf/generated_message_reflection.h"
-#include "google/protobuf/message.h"
-#include "google/protobuf/message_lite.h"
-#include "google/protobuf/repeated_field.h"  // IWYU pragma: export
-#include "google/protobuf/extension_set.h"  // IWYU pragma: export
-#include "google/protobuf/service.h"
-#include "google/protobuf/unknown_field_set.h"
-// @@protoc_insertion_point(includes)
-
-// Must be included last.
-#include "google/protobuf/port_def.inc"
-
-#define PROTOBUF_INTERNAL_EXPORT_auth_2eproto
-
-namespace google {
-namespace protobuf {
-namespace internal {
-template <typename T>
-::absl::string_view GetAnyMessageName();
-}  // namespace internal
-}  // namespace protobuf
-}  // namespace google
-
-// Internal implementation detail -- do not use these members.
-struct TableStruct_auth_2eproto {
-  static const ::uint32_t offsets[];
-};
-extern const ::google::protobuf::internal::DescriptorTable
-    descriptor_table_auth_2eproto;
-namespace siqi {
-namespace auth {
-class AddPermissionToRoleRequest;
-struct AddPermissionToRoleRequestDefaultTypeInternal;
-extern AddPermissionToRoleRequestDefaultTypeInternal _AddPermissionToRoleRequest_default_instance_;
-class AdminResponse;
-struct AdminResponseDefaultTypeInternal;
-extern AdminResponseDefaultTypeInternal _AdminResponse_default_instance_;
-class BatchCheckRequest;
-struct BatchCheckRequestDefaultTypeInternal;
-extern BatchCheckRequestDefaultTypeInternal _BatchCheckRequest_default_instance_;
-class BatchCheckRequest_CheckItem;
-struct BatchCheckRequest_CheckItemDefaultTypeInternal;
-extern BatchCheckRequest_CheckItemDefaultTypeInternal _BatchCheckRequest_CheckItem_default_instance_;
-class BatchCheckResponse;
-struct BatchCheckResponseDefaultTypeInternal;
-extern BatchCheckResponseDefaultTypeInternal _BatchCheckResponse_default_instance_;
-class BatchCheckResponse_ResultItem;
-struct BatchCheckResponse_ResultItemDefaultTypeInternal;
-extern BatchCheckResponse_ResultItemDefaultTypeInternal _BatchCheckResponse_ResultItem_default_instance_;
-class CheckRequest;
-struct CheckRequestDefaultTypeInternal;
-extern CheckRequestDefaultTypeInternal _CheckRequest_default_instance_;
-class CheckResponse;
-struct CheckResponseDefaultTypeInternal;
-extern CheckResponseDefaultTypeInternal _CheckResponse_default_instance_;
-class CreateAppRequest;
-struct CreateAppRequestDefaultTypeInternal;
-extern CreateAppRequestDefaultTypeInternal _CreateAppRequest_default_instance_;
-class CreatePermissionRequest;
-struct CreatePermissionRequestDefaultTypeInternal;
-extern CreatePermissionRequestDefaultTypeInternal _CreatePermissionRequest_default_instance_;
-class CreateRoleRequest;
-struct CreateRoleRequestDefaultTypeInternal;
-extern CreateRoleRequestDefaultTypeInternal _CreateRoleRequest_default_instance_;
-class DeleteAppRequest;
-struct DeleteAppRequestDefaultTypeInternal;
-extern DeleteAppRequestDefaultTypeInternal _DeleteAppRequest_default_instance_;
-class DeletePermissionRequest;
-struct DeletePermissionRequestDefaultTypeInternal;
-extern DeletePermissionRequestDefaultTypeInternal _DeletePermissionRequest_default_instance_;
-class DeleteRoleRequest;
-struct DeleteRoleRequestDefaultTypeInternal;
-extern DeleteRoleRequestDefaultTypeInternal _DeleteRoleRequest_default_instance_;
-class GetAppRequest;
-struct GetAppRequestDefaultTypeInternal;
-extern GetAppRequestDefaultTypeInternal _GetAppRequest_default_instance_;
-class GetAppResponse;
-struct GetAppResponseDefaultTypeInternal;
-extern GetAppResponseDefaultTypeInternal _GetAppResponse_default_instance_;
-class GetRolePermissionsRequest;
-struct GetRolePermissionsRequestDefaultTypeInternal;
-extern GetRolePermissionsRequestDefaultTypeInternal _GetRolePermissionsRequest_default_instance_;
-class GetRolePermissionsResponse;
-struct GetRolePermissionsResponseDefaultTypeInternal;
-extern GetRolePermissionsResponseDefaultTypeInternal _GetRolePermissionsResponse_default_instance_;
-class GetRoleUsersRequest;
-struct GetRoleUsersRequestDefaultTypeInternal;
-extern GetRoleUsersRequestDefaultTypeInternal _GetRoleUsersRequest_default_instance_;
-class GetRoleUsersResponse;
-struct GetRoleUsersResponseDefaultTypeInternal;
-extern GetRoleUsersResponseDefaultTypeInternal _GetRoleUsersResponse_default_instance_;
-class GetRoleUsersResponse_User;
-struct GetRoleUsersResponse_UserDefaultTypeInternal;
-extern GetRoleUsersResponse_UserDefaultTypeInternal _GetRoleUsersResponse_User_default_instance_;
-class GetUserPermissionsRequest;
-struct GetUserPermissionsRequestDefaultTypeInternal;
-extern GetUserPermissionsRequestDefaultTypeInternal _GetUserPermissionsRequest_default_instance_;
-class GetUserPermissionsResponse;
-struct GetUserPermissionsResponseDefaultTypeInternal;
-extern GetUserPermissionsResponseDefaultTypeInternal _GetUserPermissionsResponse_default_instance_;
-class GetUserRolesRequest;
-struct GetUserRolesRequestDefaultTypeInternal;
-extern GetUserRolesRequestDefaultTypeInternal _GetUserRolesRequest_default_instance_;
-class GetUserRolesResponse;
-struct GetUserRolesResponseDefaultTypeInternal;
-extern GetUserRolesResponseDefaultTypeInternal _GetUserRolesResponse_default_instance_;
-class GrantRoleToUserRequest;
-struct GrantRoleToUserRequestDefaultTypeInternal;
-extern GrantRoleToUserRequestDefaultTypeInternal _GrantRoleToUserRequest_default_instance_;
-class ListAppsRequest;
-struct ListAppsRequestDefaultTypeInternal;
-extern ListAppsRequestDefaultTypeInternal _ListAppsRequest_default_instance_;
-class ListAppsResponse;
-struct ListAppsResponseDefaultTypeInternal;
-extern ListAppsResponseDefaultTypeInternal _ListAppsResponse_default_instance_;
-class ListAuditLogsRequest;
-struct ListAuditLogsRequestDefaultTypeInternal;
-extern ListAuditLogsRequestDefaultTypeInternal _ListAuditLogsRequest_default_instance_;
-class ListAuditLogsResponse;
-struct ListAuditLogsResponseDefaultTypeInternal;
-extern ListAuditLogsResponseDefaultTypeInternal _ListAuditLogsResponse_default_instance_;
-class ListAuditLogsResponse_AuditLog;
-struct ListAuditLogsResponse_AuditLogDefaultTypeInternal;
-extern ListAuditLogsResponse_AuditLogDefaultTypeInternal _ListAuditLogsResponse_AuditLog_default_instance_;
-class ListPermissionsRequest;
-struct ListPermissionsRequestDefaultTypeInternal;
-extern ListPermissionsRequestDefaultTypeInternal _ListPermissionsRequest_default_instance_;
-class ListPermissionsResponse;
-struct ListPermissionsResponseDefaultTypeInternal;
-extern ListPermissionsResponseDefaultTypeInternal _ListPermissionsResponse_default_instance_;
-class ListPermissionsResponse_Permission;
-struct ListPermissionsResponse_PermissionDefaultTypeInternal;
-extern ListPermissionsResponse_PermissionDefaultTypeInternal _ListPermissionsResponse_Permission_default_instance_;
-class ListRolesRequest;
-struct ListRolesRequestDefaultTypeInternal;
-extern ListRolesRequestDefaultTypeInternal _ListRolesRequest_default_instance_;
-class ListRolesResponse;
-struct ListRolesResponseDefaultTypeInternal;
-extern ListRolesResponseDefaultTypeInternal _ListRolesResponse_default_instance_;
-class ListRolesResponse_Role;
-struct ListRolesResponse_RoleDefaultTypeInternal;
-extern ListRolesResponse_RoleDefaultTypeInternal _ListRolesResponse_Role_default_instance_;
-class ListUserRolesRequest;
-struct ListUserRolesRequestDefaultTypeInternal;
-extern ListUserRolesRequestDefaultTypeInternal _ListUserRolesRequest_default_instance_;
-class ListUserRolesResponse;
-struct ListUserRolesResponseDefaultTypeInternal;
-extern ListUserRolesResponseDefaultTypeInternal _ListUserRolesResponse_default_instance_;
-class ListUserRolesResponse_UserRoleInfo;
-struct ListUserRolesResponse_UserRoleInfoDefaultTypeInternal;
-extern ListUserRolesResponse_UserRoleInfoDefaultTypeInternal _ListUserRolesResponse_UserRoleInfo_default_instance_;
-class LoginRequest;
-struct LoginRequestDefaultTypeInternal;
-extern LoginRequestDefaultTypeInternal _LoginRequest_default_instance_;
-class LoginResponse;
-struct LoginResponseDefaultTypeInternal;
-extern LoginResponseDefaultTypeInternal _LoginResponse_default_instance_;
-class RemovePermissionFromRoleRequest;
-struct RemovePermissionFromRoleRequestDefaultTypeInternal;
-extern RemovePermissionFromRoleRequestDefaultTypeInternal _RemovePermissionFromRoleRequest_default_instance_;
-class RevokeRoleFromUserRequest;
-struct RevokeRoleFromUserRequestDefaultTypeInternal;
-extern RevokeRoleFromUserRequestDefaultTypeInternal _RevokeRoleFromUserRequest_default_instance_;
-class UpdateAppRequest;
-struct UpdateAppRequestDefaultTypeInternal;
-extern UpdateAppRequestDefaultTypeInternal _UpdateAppRequest_default_instance_;
-class UpdatePermissionRequest;
-struct UpdatePermissionRequestDefaultTypeInternal;
-extern UpdatePermissionRequestDefaultTypeInternal _UpdatePermissionRequest_default_instance_;
-class UpdateRoleRequest;
-struct UpdateRoleRequestDefaultTypeInternal;
-extern UpdateRoleRequestDefaultTypeInternal _UpdateRoleRequest_default_instance_;
-}  // namespace auth
-}  // namespace siqi
-namespace google {
-namespace protobuf {
-}  // namespace protobuf
-}  // namespace google
-
-namespace siqi {
-namespace auth {
-
-// ===================================================================
-
-
-// -------------------------------------------------------------------
-
-class UpdateRoleRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.UpdateRoleRequest) */ {
- public:
-  inline UpdateRoleRequest() : UpdateRoleRequest(nullptr) {}
-  ~UpdateRoleRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(UpdateRoleRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(UpdateRoleRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR UpdateRoleRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline UpdateRoleRequest(const UpdateRoleRequest& from) : UpdateRoleRequest(nullptr, from) {}
-  inline UpdateRoleRequest(UpdateRoleRequest&& from) noexcept
-      : UpdateRoleRequest(nullptr, std::move(from)) {}
-  inline UpdateRoleRequest& operator=(const UpdateRoleRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline UpdateRoleRequest& operator=(UpdateRoleRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const UpdateRoleRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const UpdateRoleRequest* internal_default_instance() {
-    return reinterpret_cast<const UpdateRoleRequest*>(
-        &_UpdateRoleRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 24;
-  friend void swap(UpdateRoleRequest& a, UpdateRoleRequest& b) { a.Swap(&b); }
-  inline void Swap(UpdateRoleRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(UpdateRoleRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  UpdateRoleRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<UpdateRoleRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const UpdateRoleRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const UpdateRoleRequest& from) { UpdateRoleRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(UpdateRoleRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.UpdateRoleRequest"; }
-
- protected:
-  explicit UpdateRoleRequest(::google::protobuf::Arena* arena);
-  UpdateRoleRequest(::google::protobuf::Arena* arena, const UpdateRoleRequest& from);
-  UpdateRoleRequest(::google::protobuf::Arena* arena, UpdateRoleRequest&& from) noexcept
-      : UpdateRoleRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppCodeFieldNumber = 2,
-    kRoleKeyFieldNumber = 3,
-    kRoleNameFieldNumber = 4,
-    kDescriptionFieldNumber = 5,
-    kIsDefaultFieldNumber = 6,
-  };
-  // string app_code = 2;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // string role_key = 3;
-  void clear_role_key() ;
-  const std::string& role_key() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_role_key(Arg_&& arg, Args_... args);
-  std::string* mutable_role_key();
-  PROTOBUF_NODISCARD std::string* release_role_key();
-  void set_allocated_role_key(std::string* value);
-
-  private:
-  const std::string& _internal_role_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_role_key(
-      const std::string& value);
-  std::string* _internal_mutable_role_key();
-
-  public:
-  // optional string role_name = 4;
-  bool has_role_name() const;
-  void clear_role_name() ;
-  const std::string& role_name() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_role_name(Arg_&& arg, Args_... args);
-  std::string* mutable_role_name();
-  PROTOBUF_NODISCARD std::string* release_role_name();
-  void set_allocated_role_name(std::string* value);
-
-  private:
-  const std::string& _internal_role_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_role_name(
-      const std::string& value);
-  std::string* _internal_mutable_role_name();
-
-  public:
-  // optional string description = 5;
-  bool has_description() const;
-  void clear_description() ;
-  const std::string& description() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_description(Arg_&& arg, Args_... args);
-  std::string* mutable_description();
-  PROTOBUF_NODISCARD std::string* release_description();
-  void set_allocated_description(std::string* value);
-
-  private:
-  const std::string& _internal_description() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_description(
-      const std::string& value);
-  std::string* _internal_mutable_description();
-
-  public:
-  // optional bool is_default = 6;
-  bool has_is_default() const;
-  void clear_is_default() ;
-  bool is_default() const;
-  void set_is_default(bool value);
-
-  private:
-  bool _internal_is_default() const;
-  void _internal_set_is_default(bool value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.UpdateRoleRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      3, 5, 0,
-      72, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const UpdateRoleRequest& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::ArenaStringPtr role_key_;
-    ::google::protobuf::internal::ArenaStringPtr role_name_;
-    ::google::protobuf::internal::ArenaStringPtr description_;
-    bool is_default_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class UpdatePermissionRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.UpdatePermissionRequest) */ {
- public:
-  inline UpdatePermissionRequest() : UpdatePermissionRequest(nullptr) {}
-  ~UpdatePermissionRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(UpdatePermissionRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(UpdatePermissionRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR UpdatePermissionRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline UpdatePermissionRequest(const UpdatePermissionRequest& from) : UpdatePermissionRequest(nullptr, from) {}
-  inline UpdatePermissionRequest(UpdatePermissionRequest&& from) noexcept
-      : UpdatePermissionRequest(nullptr, std::move(from)) {}
-  inline UpdatePermissionRequest& operator=(const UpdatePermissionRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline UpdatePermissionRequest& operator=(UpdatePermissionRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const UpdatePermissionRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const UpdatePermissionRequest* internal_default_instance() {
-    return reinterpret_cast<const UpdatePermissionRequest*>(
-        &_UpdatePermissionRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 18;
-  friend void swap(UpdatePermissionRequest& a, UpdatePermissionRequest& b) { a.Swap(&b); }
-  inline void Swap(UpdatePermissionRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(UpdatePermissionRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  UpdatePermissionRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<UpdatePermissionRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const UpdatePermissionRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const UpdatePermissionRequest& from) { UpdatePermissionRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(UpdatePermissionRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.UpdatePermissionRequest"; }
-
- protected:
-  explicit UpdatePermissionRequest(::google::protobuf::Arena* arena);
-  UpdatePermissionRequest(::google::protobuf::Arena* arena, const UpdatePermissionRequest& from);
-  UpdatePermissionRequest(::google::protobuf::Arena* arena, UpdatePermissionRequest&& from) noexcept
-      : UpdatePermissionRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppCodeFieldNumber = 2,
-    kPermKeyFieldNumber = 3,
-    kPermNameFieldNumber = 4,
-    kDescriptionFieldNumber = 5,
-  };
-  // string app_code = 2;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // string perm_key = 3;
-  void clear_perm_key() ;
-  const std::string& perm_key() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_perm_key(Arg_&& arg, Args_... args);
-  std::string* mutable_perm_key();
-  PROTOBUF_NODISCARD std::string* release_perm_key();
-  void set_allocated_perm_key(std::string* value);
-
-  private:
-  const std::string& _internal_perm_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_perm_key(
-      const std::string& value);
-  std::string* _internal_mutable_perm_key();
-
-  public:
-  // optional string perm_name = 4;
-  bool has_perm_name() const;
-  void clear_perm_name() ;
-  const std::string& perm_name() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_perm_name(Arg_&& arg, Args_... args);
-  std::string* mutable_perm_name();
-  PROTOBUF_NODISCARD std::string* release_perm_name();
-  void set_allocated_perm_name(std::string* value);
-
-  private:
-  const std::string& _internal_perm_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_perm_name(
-      const std::string& value);
-  std::string* _internal_mutable_perm_name();
-
-  public:
-  // optional string description = 5;
-  bool has_description() const;
-  void clear_description() ;
-  const std::string& description() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_description(Arg_&& arg, Args_... args);
-  std::string* mutable_description();
-  PROTOBUF_NODISCARD std::string* release_description();
-  void set_allocated_description(std::string* value);
-
-  private:
-  const std::string& _internal_description() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_description(
-      const std::string& value);
-  std::string* _internal_mutable_description();
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.UpdatePermissionRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 4, 0,
-      78, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const UpdatePermissionRequest& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::ArenaStringPtr perm_key_;
-    ::google::protobuf::internal::ArenaStringPtr perm_name_;
-    ::google::protobuf::internal::ArenaStringPtr description_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class UpdateAppRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.UpdateAppRequest) */ {
- public:
-  inline UpdateAppRequest() : UpdateAppRequest(nullptr) {}
-  ~UpdateAppRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(UpdateAppRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(UpdateAppRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR UpdateAppRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline UpdateAppRequest(const UpdateAppRequest& from) : UpdateAppRequest(nullptr, from) {}
-  inline UpdateAppRequest(UpdateAppRequest&& from) noexcept
-      : UpdateAppRequest(nullptr, std::move(from)) {}
-  inline UpdateAppRequest& operator=(const UpdateAppRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline UpdateAppRequest& operator=(UpdateAppRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const UpdateAppRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const UpdateAppRequest* internal_default_instance() {
-    return reinterpret_cast<const UpdateAppRequest*>(
-        &_UpdateAppRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 11;
-  friend void swap(UpdateAppRequest& a, UpdateAppRequest& b) { a.Swap(&b); }
-  inline void Swap(UpdateAppRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(UpdateAppRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  UpdateAppRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<UpdateAppRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const UpdateAppRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const UpdateAppRequest& from) { UpdateAppRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(UpdateAppRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.UpdateAppRequest"; }
-
- protected:
-  explicit UpdateAppRequest(::google::protobuf::Arena* arena);
-  UpdateAppRequest(::google::protobuf::Arena* arena, const UpdateAppRequest& from);
-  UpdateAppRequest(::google::protobuf::Arena* arena, UpdateAppRequest&& from) noexcept
-      : UpdateAppRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppCodeFieldNumber = 2,
-    kAppNameFieldNumber = 3,
-    kDescriptionFieldNumber = 4,
-    kStatusFieldNumber = 5,
-  };
-  // string app_code = 2;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // optional string app_name = 3;
-  bool has_app_name() const;
-  void clear_app_name() ;
-  const std::string& app_name() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_name(Arg_&& arg, Args_... args);
-  std::string* mutable_app_name();
-  PROTOBUF_NODISCARD std::string* release_app_name();
-  void set_allocated_app_name(std::string* value);
-
-  private:
-  const std::string& _internal_app_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_name(
-      const std::string& value);
-  std::string* _internal_mutable_app_name();
-
-  public:
-  // optional string description = 4;
-  bool has_description() const;
-  void clear_description() ;
-  const std::string& description() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_description(Arg_&& arg, Args_... args);
-  std::string* mutable_description();
-  PROTOBUF_NODISCARD std::string* release_description();
-  void set_allocated_description(std::string* value);
-
-  private:
-  const std::string& _internal_description() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_description(
-      const std::string& value);
-  std::string* _internal_mutable_description();
-
-  public:
-  // optional int32 status = 5;
-  bool has_status() const;
-  void clear_status() ;
-  ::int32_t status() const;
-  void set_status(::int32_t value);
-
-  private:
-  ::int32_t _internal_status() const;
-  void _internal_set_status(::int32_t value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.UpdateAppRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 4, 0,
-      62, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const UpdateAppRequest& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::ArenaStringPtr app_name_;
-    ::google::protobuf::internal::ArenaStringPtr description_;
-    ::int32_t status_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class RevokeRoleFromUserRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.RevokeRoleFromUserRequest) */ {
- public:
-  inline RevokeRoleFromUserRequest() : RevokeRoleFromUserRequest(nullptr) {}
-  ~RevokeRoleFromUserRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(RevokeRoleFromUserRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(RevokeRoleFromUserRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR RevokeRoleFromUserRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline RevokeRoleFromUserRequest(const RevokeRoleFromUserRequest& from) : RevokeRoleFromUserRequest(nullptr, from) {}
-  inline RevokeRoleFromUserRequest(RevokeRoleFromUserRequest&& from) noexcept
-      : RevokeRoleFromUserRequest(nullptr, std::move(from)) {}
-  inline RevokeRoleFromUserRequest& operator=(const RevokeRoleFromUserRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline RevokeRoleFromUserRequest& operator=(RevokeRoleFromUserRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const RevokeRoleFromUserRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const RevokeRoleFromUserRequest* internal_default_instance() {
-    return reinterpret_cast<const RevokeRoleFromUserRequest*>(
-        &_RevokeRoleFromUserRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 34;
-  friend void swap(RevokeRoleFromUserRequest& a, RevokeRoleFromUserRequest& b) { a.Swap(&b); }
-  inline void Swap(RevokeRoleFromUserRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(RevokeRoleFromUserRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  RevokeRoleFromUserRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<RevokeRoleFromUserRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const RevokeRoleFromUserRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const RevokeRoleFromUserRequest& from) { RevokeRoleFromUserRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(RevokeRoleFromUserRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.RevokeRoleFromUserRequest"; }
-
- protected:
-  explicit RevokeRoleFromUserRequest(::google::protobuf::Arena* arena);
-  RevokeRoleFromUserRequest(::google::protobuf::Arena* arena, const RevokeRoleFromUserRequest& from);
-  RevokeRoleFromUserRequest(::google::protobuf::Arena* arena, RevokeRoleFromUserRequest&& from) noexcept
-      : RevokeRoleFromUserRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppCodeFieldNumber = 2,
-    kUserIdFieldNumber = 3,
-    kRoleKeyFieldNumber = 4,
-  };
-  // string app_code = 2;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // string user_id = 3;
-  void clear_user_id() ;
-  const std::string& user_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_user_id(Arg_&& arg, Args_... args);
-  std::string* mutable_user_id();
-  PROTOBUF_NODISCARD std::string* release_user_id();
-  void set_allocated_user_id(std::string* value);
-
-  private:
-  const std::string& _internal_user_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_id(
-      const std::string& value);
-  std::string* _internal_mutable_user_id();
-
-  public:
-  // string role_key = 4;
-  void clear_role_key() ;
-  const std::string& role_key() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_role_key(Arg_&& arg, Args_... args);
-  std::string* mutable_role_key();
-  PROTOBUF_NODISCARD std::string* release_role_key();
-  void set_allocated_role_key(std::string* value);
-
-  private:
-  const std::string& _internal_role_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_role_key(
-      const std::string& value);
-  std::string* _internal_mutable_role_key();
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.RevokeRoleFromUserRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 3, 0,
-      67, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const RevokeRoleFromUserRequest& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::ArenaStringPtr user_id_;
-    ::google::protobuf::internal::ArenaStringPtr role_key_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class RemovePermissionFromRoleRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.RemovePermissionFromRoleRequest) */ {
- public:
-  inline RemovePermissionFromRoleRequest() : RemovePermissionFromRoleRequest(nullptr) {}
-  ~RemovePermissionFromRoleRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(RemovePermissionFromRoleRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(RemovePermissionFromRoleRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR RemovePermissionFromRoleRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline RemovePermissionFromRoleRequest(const RemovePermissionFromRoleRequest& from) : RemovePermissionFromRoleRequest(nullptr, from) {}
-  inline RemovePermissionFromRoleRequest(RemovePermissionFromRoleRequest&& from) noexcept
-      : RemovePermissionFromRoleRequest(nullptr, std::move(from)) {}
-  inline RemovePermissionFromRoleRequest& operator=(const RemovePermissionFromRoleRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline RemovePermissionFromRoleRequest& operator=(RemovePermissionFromRoleRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const RemovePermissionFromRoleRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const RemovePermissionFromRoleRequest* internal_default_instance() {
-    return reinterpret_cast<const RemovePermissionFromRoleRequest*>(
-        &_RemovePermissionFromRoleRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 30;
-  friend void swap(RemovePermissionFromRoleRequest& a, RemovePermissionFromRoleRequest& b) { a.Swap(&b); }
-  inline void Swap(RemovePermissionFromRoleRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(RemovePermissionFromRoleRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  RemovePermissionFromRoleRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<RemovePermissionFromRoleRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const RemovePermissionFromRoleRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const RemovePermissionFromRoleRequest& from) { RemovePermissionFromRoleRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(RemovePermissionFromRoleRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.RemovePermissionFromRoleRequest"; }
-
- protected:
-  explicit RemovePermissionFromRoleRequest(::google::protobuf::Arena* arena);
-  RemovePermissionFromRoleRequest(::google::protobuf::Arena* arena, const RemovePermissionFromRoleRequest& from);
-  RemovePermissionFromRoleRequest(::google::protobuf::Arena* arena, RemovePermissionFromRoleRequest&& from) noexcept
-      : RemovePermissionFromRoleRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppCodeFieldNumber = 2,
-    kRoleKeyFieldNumber = 3,
-    kPermKeyFieldNumber = 4,
-  };
-  // string app_code = 2;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // string role_key = 3;
-  void clear_role_key() ;
-  const std::string& role_key() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_role_key(Arg_&& arg, Args_... args);
-  std::string* mutable_role_key();
-  PROTOBUF_NODISCARD std::string* release_role_key();
-  void set_allocated_role_key(std::string* value);
-
-  private:
-  const std::string& _internal_role_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_role_key(
-      const std::string& value);
-  std::string* _internal_mutable_role_key();
-
-  public:
-  // string perm_key = 4;
-  void clear_perm_key() ;
-  const std::string& perm_key() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_perm_key(Arg_&& arg, Args_... args);
-  std::string* mutable_perm_key();
-  PROTOBUF_NODISCARD std::string* release_perm_key();
-  void set_allocated_perm_key(std::string* value);
-
-  private:
-  const std::string& _internal_perm_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_perm_key(
-      const std::string& value);
-  std::string* _internal_mutable_perm_key();
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.RemovePermissionFromRoleRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 3, 0,
-      74, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const RemovePermissionFromRoleRequest& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::ArenaStringPtr role_key_;
-    ::google::protobuf::internal::ArenaStringPtr perm_key_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class LoginResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.LoginResponse) */ {
- public:
-  inline LoginResponse() : LoginResponse(nullptr) {}
-  ~LoginResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(LoginResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(LoginResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR LoginResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline LoginResponse(const LoginResponse& from) : LoginResponse(nullptr, from) {}
-  inline LoginResponse(LoginResponse&& from) noexcept
-      : LoginResponse(nullptr, std::move(from)) {}
-  inline LoginResponse& operator=(const LoginResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline LoginResponse& operator=(LoginResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const LoginResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const LoginResponse* internal_default_instance() {
-    return reinterpret_cast<const LoginResponse*>(
-        &_LoginResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 43;
-  friend void swap(LoginResponse& a, LoginResponse& b) { a.Swap(&b); }
-  inline void Swap(LoginResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(LoginResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  LoginResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<LoginResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const LoginResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const LoginResponse& from) { LoginResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(LoginResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.LoginResponse"; }
-
- protected:
-  explicit LoginResponse(::google::protobuf::Arena* arena);
-  LoginResponse(::google::protobuf::Arena* arena, const LoginResponse& from);
-  LoginResponse(::google::protobuf::Arena* arena, LoginResponse&& from) noexcept
-      : LoginResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kMessageFieldNumber = 2,
-    kTokenFieldNumber = 3,
-    kSuccessFieldNumber = 1,
-  };
-  // string message = 2;
-  void clear_message() ;
-  const std::string& message() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_message(Arg_&& arg, Args_... args);
-  std::string* mutable_message();
-  PROTOBUF_NODISCARD std::string* release_message();
-  void set_allocated_message(std::string* value);
-
-  private:
-  const std::string& _internal_message() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(
-      const std::string& value);
-  std::string* _internal_mutable_message();
-
-  public:
-  // string token = 3;
-  void clear_token() ;
-  const std::string& token() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_token(Arg_&& arg, Args_... args);
-  std::string* mutable_token();
-  PROTOBUF_NODISCARD std::string* release_token();
-  void set_allocated_token(std::string* value);
-
-  private:
-  const std::string& _internal_token() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_token(
-      const std::string& value);
-  std::string* _internal_mutable_token();
-
-  public:
-  // bool success = 1;
-  void clear_success() ;
-  bool success() const;
-  void set_success(bool value);
-
-  private:
-  bool _internal_success() const;
-  void _internal_set_success(bool value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.LoginResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 3, 0,
-      44, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const LoginResponse& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr message_;
-    ::google::protobuf::internal::ArenaStringPtr token_;
-    bool success_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class LoginRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.LoginRequest) */ {
- public:
-  inline LoginRequest() : LoginRequest(nullptr) {}
-  ~LoginRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(LoginRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(LoginRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR LoginRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline LoginRequest(const LoginRequest& from) : LoginRequest(nullptr, from) {}
-  inline LoginRequest(LoginRequest&& from) noexcept
-      : LoginRequest(nullptr, std::move(from)) {}
-  inline LoginRequest& operator=(const LoginRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline LoginRequest& operator=(LoginRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const LoginRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const LoginRequest* internal_default_instance() {
-    return reinterpret_cast<const LoginRequest*>(
-        &_LoginRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 42;
-  friend void swap(LoginRequest& a, LoginRequest& b) { a.Swap(&b); }
-  inline void Swap(LoginRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(LoginRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  LoginRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<LoginRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const LoginRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const LoginRequest& from) { LoginRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(LoginRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.LoginRequest"; }
-
- protected:
-  explicit LoginRequest(::google::protobuf::Arena* arena);
-  LoginRequest(::google::protobuf::Arena* arena, const LoginRequest& from);
-  LoginRequest(::google::protobuf::Arena* arena, LoginRequest&& from) noexcept
-      : LoginRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kUsernameFieldNumber = 1,
-    kPasswordFieldNumber = 2,
-  };
-  // string username = 1;
-  void clear_username() ;
-  const std::string& username() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_username(Arg_&& arg, Args_... args);
-  std::string* mutable_username();
-  PROTOBUF_NODISCARD std::string* release_username();
-  void set_allocated_username(std::string* value);
-
-  private:
-  const std::string& _internal_username() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(
-      const std::string& value);
-  std::string* _internal_mutable_username();
-
-  public:
-  // string password = 2;
-  void clear_password() ;
-  const std::string& password() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_password(Arg_&& arg, Args_... args);
-  std::string* mutable_password();
-  PROTOBUF_NODISCARD std::string* release_password();
-  void set_allocated_password(std::string* value);
-
-  private:
-  const std::string& _internal_password() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_password(
-      const std::string& value);
-  std::string* _internal_mutable_password();
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.LoginRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 0,
-      47, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const LoginRequest& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr username_;
-    ::google::protobuf::internal::ArenaStringPtr password_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ListUserRolesResponse_UserRoleInfo final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.ListUserRolesResponse.UserRoleInfo) */ {
- public:
-  inline ListUserRolesResponse_UserRoleInfo() : ListUserRolesResponse_UserRoleInfo(nullptr) {}
-  ~ListUserRolesResponse_UserRoleInfo() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ListUserRolesResponse_UserRoleInfo* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ListUserRolesResponse_UserRoleInfo));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ListUserRolesResponse_UserRoleInfo(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline ListUserRolesResponse_UserRoleInfo(const ListUserRolesResponse_UserRoleInfo& from) : ListUserRolesResponse_UserRoleInfo(nullptr, from) {}
-  inline ListUserRolesResponse_UserRoleInfo(ListUserRolesResponse_UserRoleInfo&& from) noexcept
-      : ListUserRolesResponse_UserRoleInfo(nullptr, std::move(from)) {}
-  inline ListUserRolesResponse_UserRoleInfo& operator=(const ListUserRolesResponse_UserRoleInfo& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ListUserRolesResponse_UserRoleInfo& operator=(ListUserRolesResponse_UserRoleInfo&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const ListUserRolesResponse_UserRoleInfo& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const ListUserRolesResponse_UserRoleInfo* internal_default_instance() {
-    return reinterpret_cast<const ListUserRolesResponse_UserRoleInfo*>(
-        &_ListUserRolesResponse_UserRoleInfo_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 45;
-  friend void swap(ListUserRolesResponse_UserRoleInfo& a, ListUserRolesResponse_UserRoleInfo& b) { a.Swap(&b); }
-  inline void Swap(ListUserRolesResponse_UserRoleInfo* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(ListUserRolesResponse_UserRoleInfo* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  ListUserRolesResponse_UserRoleInfo* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ListUserRolesResponse_UserRoleInfo>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ListUserRolesResponse_UserRoleInfo& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ListUserRolesResponse_UserRoleInfo& from) { ListUserRolesResponse_UserRoleInfo::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(ListUserRolesResponse_UserRoleInfo* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.ListUserRolesResponse.UserRoleInfo"; }
-
- protected:
-  explicit ListUserRolesResponse_UserRoleInfo(::google::protobuf::Arena* arena);
-  ListUserRolesResponse_UserRoleInfo(::google::protobuf::Arena* arena, const ListUserRolesResponse_UserRoleInfo& from);
-  ListUserRolesResponse_UserRoleInfo(::google::protobuf::Arena* arena, ListUserRolesResponse_UserRoleInfo&& from) noexcept
-      : ListUserRolesResponse_UserRoleInfo(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kRoleKeysFieldNumber = 2,
-    kPermKeysFieldNumber = 4,
-    kUserIdFieldNumber = 1,
-    kCreatedAtFieldNumber = 3,
-  };
-  // repeated string role_keys = 2;
-  int role_keys_size() const;
-  private:
-  int _internal_role_keys_size() const;
-
-  public:
-  void clear_role_keys() ;
-  const std::string& role_keys(int index) const;
-  std::string* mutable_role_keys(int index);
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_role_keys(int index, Arg_&& value, Args_... args);
-  std::string* add_role_keys();
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void add_role_keys(Arg_&& value, Args_... args);
-  const ::google::protobuf::RepeatedPtrField<std::string>& role_keys() const;
-  ::google::protobuf::RepeatedPtrField<std::string>* mutable_role_keys();
-
-  private:
-  const ::google::protobuf::RepeatedPtrField<std::string>& _internal_role_keys() const;
-  ::google::protobuf::RepeatedPtrField<std::string>* _internal_mutable_role_keys();
-
-  public:
-  // repeated string perm_keys = 4;
-  int perm_keys_size() const;
-  private:
-  int _internal_perm_keys_size() const;
-
-  public:
-  void clear_perm_keys() ;
-  const std::string& perm_keys(int index) const;
-  std::string* mutable_perm_keys(int index);
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_perm_keys(int index, Arg_&& value, Args_... args);
-  std::string* add_perm_keys();
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void add_perm_keys(Arg_&& value, Args_... args);
-  const ::google::protobuf::RepeatedPtrField<std::string>& perm_keys() const;
-  ::google::protobuf::RepeatedPtrField<std::string>* mutable_perm_keys();
-
-  private:
-  const ::google::protobuf::RepeatedPtrField<std::string>& _internal_perm_keys() const;
-  ::google::protobuf::RepeatedPtrField<std::string>* _internal_mutable_perm_keys();
-
-  public:
-  // string user_id = 1;
-  void clear_user_id() ;
-  const std::string& user_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_user_id(Arg_&& arg, Args_... args);
-  std::string* mutable_user_id();
-  PROTOBUF_NODISCARD std::string* release_user_id();
-  void set_allocated_user_id(std::string* value);
-
-  private:
-  const std::string& _internal_user_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_id(
-      const std::string& value);
-  std::string* _internal_mutable_user_id();
-
-  public:
-  // string created_at = 3;
-  void clear_created_at() ;
-  const std::string& created_at() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_created_at(Arg_&& arg, Args_... args);
-  std::string* mutable_created_at();
-  PROTOBUF_NODISCARD std::string* release_created_at();
-  void set_allocated_created_at(std::string* value);
-
-  private:
-  const std::string& _internal_created_at() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_created_at(
-      const std::string& value);
-  std::string* _internal_mutable_created_at();
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.ListUserRolesResponse.UserRoleInfo)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 4, 0,
-      88, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const ListUserRolesResponse_UserRoleInfo& from_msg);
-    ::google::protobuf::RepeatedPtrField<std::string> role_keys_;
-    ::google::protobuf::RepeatedPtrField<std::string> perm_keys_;
-    ::google::protobuf::internal::ArenaStringPtr user_id_;
-    ::google::protobuf::internal::ArenaStringPtr created_at_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ListUserRolesRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.ListUserRolesRequest) */ {
- public:
-  inline ListUserRolesRequest() : ListUserRolesRequest(nullptr) {}
-  ~ListUserRolesRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ListUserRolesRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ListUserRolesRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ListUserRolesRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline ListUserRolesRequest(const ListUserRolesRequest& from) : ListUserRolesRequest(nullptr, from) {}
-  inline ListUserRolesRequest(ListUserRolesRequest&& from) noexcept
-      : ListUserRolesRequest(nullptr, std::move(from)) {}
-  inline ListUserRolesRequest& operator=(const ListUserRolesRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ListUserRolesRequest& operator=(ListUserRolesRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const ListUserRolesRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const ListUserRolesRequest* internal_default_instance() {
-    return reinterpret_cast<const ListUserRolesRequest*>(
-        &_ListUserRolesRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 44;
-  friend void swap(ListUserRolesRequest& a, ListUserRolesRequest& b) { a.Swap(&b); }
-  inline void Swap(ListUserRolesRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(ListUserRolesRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  ListUserRolesRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ListUserRolesRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ListUserRolesRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ListUserRolesRequest& from) { ListUserRolesRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(ListUserRolesRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.ListUserRolesRequest"; }
-
- protected:
-  explicit ListUserRolesRequest(::google::protobuf::Arena* arena);
-  ListUserRolesRequest(::google::protobuf::Arena* arena, const ListUserRolesRequest& from);
-  ListUserRolesRequest(::google::protobuf::Arena* arena, ListUserRolesRequest&& from) noexcept
-      : ListUserRolesRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppCodeFieldNumber = 1,
-    kUserIdFieldNumber = 4,
-    kPageFieldNumber = 2,
-    kPageSizeFieldNumber = 3,
-  };
-  // string app_code = 1;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // optional string user_id = 4;
-  bool has_user_id() const;
-  void clear_user_id() ;
-  const std::string& user_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_user_id(Arg_&& arg, Args_... args);
-  std::string* mutable_user_id();
-  PROTOBUF_NODISCARD std::string* release_user_id();
-  void set_allocated_user_id(std::string* value);
-
-  private:
-  const std::string& _internal_user_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_id(
-      const std::string& value);
-  std::string* _internal_mutable_user_id();
-
-  public:
-  // int32 page = 2;
-  void clear_page() ;
-  ::int32_t page() const;
-  void set_page(::int32_t value);
-
-  private:
-  ::int32_t _internal_page() const;
-  void _internal_set_page(::int32_t value);
-
-  public:
-  // int32 page_size = 3;
-  void clear_page_size() ;
-  ::int32_t page_size() const;
-  void set_page_size(::int32_t value);
-
-  private:
-  ::int32_t _internal_page_size() const;
-  void _internal_set_page_size(::int32_t value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.ListUserRolesRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 4, 0,
-      54, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const ListUserRolesRequest& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::ArenaStringPtr user_id_;
-    ::int32_t page_;
-    ::int32_t page_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ListRolesResponse_Role final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.ListRolesResponse.Role) */ {
- public:
-  inline ListRolesResponse_Role() : ListRolesResponse_Role(nullptr) {}
-  ~ListRolesResponse_Role() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ListRolesResponse_Role* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ListRolesResponse_Role));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ListRolesResponse_Role(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline ListRolesResponse_Role(const ListRolesResponse_Role& from) : ListRolesResponse_Role(nullptr, from) {}
-  inline ListRolesResponse_Role(ListRolesResponse_Role&& from) noexcept
-      : ListRolesResponse_Role(nullptr, std::move(from)) {}
-  inline ListRolesResponse_Role& operator=(const ListRolesResponse_Role& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ListRolesResponse_Role& operator=(ListRolesResponse_Role&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const ListRolesResponse_Role& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const ListRolesResponse_Role* internal_default_instance() {
-    return reinterpret_cast<const ListRolesResponse_Role*>(
-        &_ListRolesResponse_Role_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 27;
-  friend void swap(ListRolesResponse_Role& a, ListRolesResponse_Role& b) { a.Swap(&b); }
-  inline void Swap(ListRolesResponse_Role* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(ListRolesResponse_Role* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  ListRolesResponse_Role* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ListRolesResponse_Role>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ListRolesResponse_Role& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ListRolesResponse_Role& from) { ListRolesResponse_Role::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(ListRolesResponse_Role* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.ListRolesResponse.Role"; }
-
- protected:
-  explicit ListRolesResponse_Role(::google::protobuf::Arena* arena);
-  ListRolesResponse_Role(::google::protobuf::Arena* arena, const ListRolesResponse_Role& from);
-  ListRolesResponse_Role(::google::protobuf::Arena* arena, ListRolesResponse_Role&& from) noexcept
-      : ListRolesResponse_Role(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kPermKeysFieldNumber = 8,
-    kRoleNameFieldNumber = 2,
-    kRoleKeyFieldNumber = 3,
-    kDescriptionFieldNumber = 4,
-    kCreatedAtFieldNumber = 6,
-    kUpdatedAtFieldNumber = 7,
-    kIdFieldNumber = 1,
-    kIsDefaultFieldNumber = 5,
-  };
-  // repeated string perm_keys = 8;
-  int perm_keys_size() const;
-  private:
-  int _internal_perm_keys_size() const;
-
-  public:
-  void clear_perm_keys() ;
-  const std::string& perm_keys(int index) const;
-  std::string* mutable_perm_keys(int index);
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_perm_keys(int index, Arg_&& value, Args_... args);
-  std::string* add_perm_keys();
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void add_perm_keys(Arg_&& value, Args_... args);
-  const ::google::protobuf::RepeatedPtrField<std::string>& perm_keys() const;
-  ::google::protobuf::RepeatedPtrField<std::string>* mutable_perm_keys();
-
-  private:
-  const ::google::protobuf::RepeatedPtrField<std::string>& _internal_perm_keys() const;
-  ::google::protobuf::RepeatedPtrField<std::string>* _internal_mutable_perm_keys();
-
-  public:
-  // string role_name = 2;
-  void clear_role_name() ;
-  const std::string& role_name() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_role_name(Arg_&& arg, Args_... args);
-  std::string* mutable_role_name();
-  PROTOBUF_NODISCARD std::string* release_role_name();
-  void set_allocated_role_name(std::string* value);
-
-  private:
-  const std::string& _internal_role_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_role_name(
-      const std::string& value);
-  std::string* _internal_mutable_role_name();
-
-  public:
-  // string role_key = 3;
-  void clear_role_key() ;
-  const std::string& role_key() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_role_key(Arg_&& arg, Args_... args);
-  std::string* mutable_role_key();
-  PROTOBUF_NODISCARD std::string* release_role_key();
-  void set_allocated_role_key(std::string* value);
-
-  private:
-  const std::string& _internal_role_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_role_key(
-      const std::string& value);
-  std::string* _internal_mutable_role_key();
-
-  public:
-  // string description = 4;
-  void clear_description() ;
-  const std::string& description() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_description(Arg_&& arg, Args_... args);
-  std::string* mutable_description();
-  PROTOBUF_NODISCARD std::string* release_description();
-  void set_allocated_description(std::string* value);
-
-  private:
-  const std::string& _internal_description() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_description(
-      const std::string& value);
-  std::string* _internal_mutable_description();
-
-  public:
-  // string created_at = 6;
-  void clear_created_at() ;
-  const std::string& created_at() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_created_at(Arg_&& arg, Args_... args);
-  std::string* mutable_created_at();
-  PROTOBUF_NODISCARD std::string* release_created_at();
-  void set_allocated_created_at(std::string* value);
-
-  private:
-  const std::string& _internal_created_at() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_created_at(
-      const std::string& value);
-  std::string* _internal_mutable_created_at();
-
-  public:
-  // string updated_at = 7;
-  void clear_updated_at() ;
-  const std::string& updated_at() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_updated_at(Arg_&& arg, Args_... args);
-  std::string* mutable_updated_at();
-  PROTOBUF_NODISCARD std::string* release_updated_at();
-  void set_allocated_updated_at(std::string* value);
-
-  private:
-  const std::string& _internal_updated_at() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_updated_at(
-      const std::string& value);
-  std::string* _internal_mutable_updated_at();
-
-  public:
-  // int64 id = 1;
-  void clear_id() ;
-  ::int64_t id() const;
-  void set_id(::int64_t value);
-
-  private:
-  ::int64_t _internal_id() const;
-  void _internal_set_id(::int64_t value);
-
-  public:
-  // bool is_default = 5;
-  void clear_is_default() ;
-  bool is_default() const;
-  void set_is_default(bool value);
-
-  private:
-  bool _internal_is_default() const;
-  void _internal_set_is_default(bool value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.ListRolesResponse.Role)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      3, 8, 0,
-      106, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const ListRolesResponse_Role& from_msg);
-    ::google::protobuf::RepeatedPtrField<std::string> perm_keys_;
-    ::google::protobuf::internal::ArenaStringPtr role_name_;
-    ::google::protobuf::internal::ArenaStringPtr role_key_;
-    ::google::protobuf::internal::ArenaStringPtr description_;
-    ::google::protobuf::internal::ArenaStringPtr created_at_;
-    ::google::protobuf::internal::ArenaStringPtr updated_at_;
-    ::int64_t id_;
-    bool is_default_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ListRolesRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.ListRolesRequest) */ {
- public:
-  inline ListRolesRequest() : ListRolesRequest(nullptr) {}
-  ~ListRolesRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ListRolesRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ListRolesRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ListRolesRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline ListRolesRequest(const ListRolesRequest& from) : ListRolesRequest(nullptr, from) {}
-  inline ListRolesRequest(ListRolesRequest&& from) noexcept
-      : ListRolesRequest(nullptr, std::move(from)) {}
-  inline ListRolesRequest& operator=(const ListRolesRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ListRolesRequest& operator=(ListRolesRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const ListRolesRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const ListRolesRequest* internal_default_instance() {
-    return reinterpret_cast<const ListRolesRequest*>(
-        &_ListRolesRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 26;
-  friend void swap(ListRolesRequest& a, ListRolesRequest& b) { a.Swap(&b); }
-  inline void Swap(ListRolesRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(ListRolesRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  ListRolesRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ListRolesRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ListRolesRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ListRolesRequest& from) { ListRolesRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(ListRolesRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.ListRolesRequest"; }
-
- protected:
-  explicit ListRolesRequest(::google::protobuf::Arena* arena);
-  ListRolesRequest(::google::protobuf::Arena* arena, const ListRolesRequest& from);
-  ListRolesRequest(::google::protobuf::Arena* arena, ListRolesRequest&& from) noexcept
-      : ListRolesRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppCodeFieldNumber = 1,
-    kRoleNameFieldNumber = 4,
-    kRoleKeyFieldNumber = 5,
-    kPageFieldNumber = 2,
-    kPageSizeFieldNumber = 3,
-    kIsDefaultFieldNumber = 6,
-  };
-  // string app_code = 1;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // optional string role_name = 4;
-  bool has_role_name() const;
-  void clear_role_name() ;
-  const std::string& role_name() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_role_name(Arg_&& arg, Args_... args);
-  std::string* mutable_role_name();
-  PROTOBUF_NODISCARD std::string* release_role_name();
-  void set_allocated_role_name(std::string* value);
-
-  private:
-  const std::string& _internal_role_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_role_name(
-      const std::string& value);
-  std::string* _internal_mutable_role_name();
-
-  public:
-  // optional string role_key = 5;
-  bool has_role_key() const;
-  void clear_role_key() ;
-  const std::string& role_key() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_role_key(Arg_&& arg, Args_... args);
-  std::string* mutable_role_key();
-  PROTOBUF_NODISCARD std::string* release_role_key();
-  void set_allocated_role_key(std::string* value);
-
-  private:
-  const std::string& _internal_role_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_role_key(
-      const std::string& value);
-  std::string* _internal_mutable_role_key();
-
-  public:
-  // int32 page = 2;
-  void clear_page() ;
-  ::int32_t page() const;
-  void set_page(::int32_t value);
-
-  private:
-  ::int32_t _internal_page() const;
-  void _internal_set_page(::int32_t value);
-
-  public:
-  // int32 page_size = 3;
-  void clear_page_size() ;
-  ::int32_t page_size() const;
-  void set_page_size(::int32_t value);
-
-  private:
-  ::int32_t _internal_page_size() const;
-  void _internal_set_page_size(::int32_t value);
-
-  public:
-  // optional bool is_default = 6;
-  bool has_is_default() const;
-  void clear_is_default() ;
-  bool is_default() const;
-  void set_is_default(bool value);
-
-  private:
-  bool _internal_is_default() const;
-  void _internal_set_is_default(bool value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.ListRolesRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      3, 6, 0,
-      60, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const ListRolesRequest& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::ArenaStringPtr role_name_;
-    ::google::protobuf::internal::ArenaStringPtr role_key_;
-    ::int32_t page_;
-    ::int32_t page_size_;
-    bool is_default_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ListPermissionsResponse_Permission final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.ListPermissionsResponse.Permission) */ {
- public:
-  inline ListPermissionsResponse_Permission() : ListPermissionsResponse_Permission(nullptr) {}
-  ~ListPermissionsResponse_Permission() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ListPermissionsResponse_Permission* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ListPermissionsResponse_Permission));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ListPermissionsResponse_Permission(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline ListPermissionsResponse_Permission(const ListPermissionsResponse_Permission& from) : ListPermissionsResponse_Permission(nullptr, from) {}
-  inline ListPermissionsResponse_Permission(ListPermissionsResponse_Permission&& from) noexcept
-      : ListPermissionsResponse_Permission(nullptr, std::move(from)) {}
-  inline ListPermissionsResponse_Permission& operator=(const ListPermissionsResponse_Permission& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ListPermissionsResponse_Permission& operator=(ListPermissionsResponse_Permission&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const ListPermissionsResponse_Permission& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const ListPermissionsResponse_Permission* internal_default_instance() {
-    return reinterpret_cast<const ListPermissionsResponse_Permission*>(
-        &_ListPermissionsResponse_Permission_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 21;
-  friend void swap(ListPermissionsResponse_Permission& a, ListPermissionsResponse_Permission& b) { a.Swap(&b); }
-  inline void Swap(ListPermissionsResponse_Permission* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(ListPermissionsResponse_Permission* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  ListPermissionsResponse_Permission* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ListPermissionsResponse_Permission>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ListPermissionsResponse_Permission& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ListPermissionsResponse_Permission& from) { ListPermissionsResponse_Permission::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(ListPermissionsResponse_Permission* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.ListPermissionsResponse.Permission"; }
-
- protected:
-  explicit ListPermissionsResponse_Permission(::google::protobuf::Arena* arena);
-  ListPermissionsResponse_Permission(::google::protobuf::Arena* arena, const ListPermissionsResponse_Permission& from);
-  ListPermissionsResponse_Permission(::google::protobuf::Arena* arena, ListPermissionsResponse_Permission&& from) noexcept
-      : ListPermissionsResponse_Permission(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kPermNameFieldNumber = 2,
-    kPermKeyFieldNumber = 3,
-    kDescriptionFieldNumber = 4,
-    kCreatedAtFieldNumber = 5,
-    kUpdatedAtFieldNumber = 6,
-    kIdFieldNumber = 1,
-  };
-  // string perm_name = 2;
-  void clear_perm_name() ;
-  const std::string& perm_name() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_perm_name(Arg_&& arg, Args_... args);
-  std::string* mutable_perm_name();
-  PROTOBUF_NODISCARD std::string* release_perm_name();
-  void set_allocated_perm_name(std::string* value);
-
-  private:
-  const std::string& _internal_perm_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_perm_name(
-      const std::string& value);
-  std::string* _internal_mutable_perm_name();
-
-  public:
-  // string perm_key = 3;
-  void clear_perm_key() ;
-  const std::string& perm_key() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_perm_key(Arg_&& arg, Args_... args);
-  std::string* mutable_perm_key();
-  PROTOBUF_NODISCARD std::string* release_perm_key();
-  void set_allocated_perm_key(std::string* value);
-
-  private:
-  const std::string& _internal_perm_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_perm_key(
-      const std::string& value);
-  std::string* _internal_mutable_perm_key();
-
-  public:
-  // string description = 4;
-  void clear_description() ;
-  const std::string& description() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_description(Arg_&& arg, Args_... args);
-  std::string* mutable_description();
-  PROTOBUF_NODISCARD std::string* release_description();
-  void set_allocated_description(std::string* value);
-
-  private:
-  const std::string& _internal_description() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_description(
-      const std::string& value);
-  std::string* _internal_mutable_description();
-
-  public:
-  // string created_at = 5;
-  void clear_created_at() ;
-  const std::string& created_at() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_created_at(Arg_&& arg, Args_... args);
-  std::string* mutable_created_at();
-  PROTOBUF_NODISCARD std::string* release_created_at();
-  void set_allocated_created_at(std::string* value);
-
-  private:
-  const std::string& _internal_created_at() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_created_at(
-      const std::string& value);
-  std::string* _internal_mutable_created_at();
-
-  public:
-  // string updated_at = 6;
-  void clear_updated_at() ;
-  const std::string& updated_at() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_updated_at(Arg_&& arg, Args_... args);
-  std::string* mutable_updated_at();
-  PROTOBUF_NODISCARD std::string* release_updated_at();
-  void set_allocated_updated_at(std::string* value);
-
-  private:
-  const std::string& _internal_updated_at() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_updated_at(
-      const std::string& value);
-  std::string* _internal_mutable_updated_at();
-
-  public:
-  // int64 id = 1;
-  void clear_id() ;
-  ::int64_t id() const;
-  void set_id(::int64_t value);
-
-  private:
-  ::int64_t _internal_id() const;
-  void _internal_set_id(::int64_t value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.ListPermissionsResponse.Permission)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      3, 6, 0,
-      101, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const ListPermissionsResponse_Permission& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr perm_name_;
-    ::google::protobuf::internal::ArenaStringPtr perm_key_;
-    ::google::protobuf::internal::ArenaStringPtr description_;
-    ::google::protobuf::internal::ArenaStringPtr created_at_;
-    ::google::protobuf::internal::ArenaStringPtr updated_at_;
-    ::int64_t id_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ListPermissionsRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.ListPermissionsRequest) */ {
- public:
-  inline ListPermissionsRequest() : ListPermissionsRequest(nullptr) {}
-  ~ListPermissionsRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ListPermissionsRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ListPermissionsRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ListPermissionsRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline ListPermissionsRequest(const ListPermissionsRequest& from) : ListPermissionsRequest(nullptr, from) {}
-  inline ListPermissionsRequest(ListPermissionsRequest&& from) noexcept
-      : ListPermissionsRequest(nullptr, std::move(from)) {}
-  inline ListPermissionsRequest& operator=(const ListPermissionsRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ListPermissionsRequest& operator=(ListPermissionsRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const ListPermissionsRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const ListPermissionsRequest* internal_default_instance() {
-    return reinterpret_cast<const ListPermissionsRequest*>(
-        &_ListPermissionsRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 20;
-  friend void swap(ListPermissionsRequest& a, ListPermissionsRequest& b) { a.Swap(&b); }
-  inline void Swap(ListPermissionsRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(ListPermissionsRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  ListPermissionsRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ListPermissionsRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ListPermissionsRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ListPermissionsRequest& from) { ListPermissionsRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(ListPermissionsRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.ListPermissionsRequest"; }
-
- protected:
-  explicit ListPermissionsRequest(::google::protobuf::Arena* arena);
-  ListPermissionsRequest(::google::protobuf::Arena* arena, const ListPermissionsRequest& from);
-  ListPermissionsRequest(::google::protobuf::Arena* arena, ListPermissionsRequest&& from) noexcept
-      : ListPermissionsRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppCodeFieldNumber = 1,
-    kPermNameFieldNumber = 4,
-    kPermKeyFieldNumber = 5,
-    kPageFieldNumber = 2,
-    kPageSizeFieldNumber = 3,
-  };
-  // string app_code = 1;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // optional string perm_name = 4;
-  bool has_perm_name() const;
-  void clear_perm_name() ;
-  const std::string& perm_name() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_perm_name(Arg_&& arg, Args_... args);
-  std::string* mutable_perm_name();
-  PROTOBUF_NODISCARD std::string* release_perm_name();
-  void set_allocated_perm_name(std::string* value);
-
-  private:
-  const std::string& _internal_perm_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_perm_name(
-      const std::string& value);
-  std::string* _internal_mutable_perm_name();
-
-  public:
-  // optional string perm_key = 5;
-  bool has_perm_key() const;
-  void clear_perm_key() ;
-  const std::string& perm_key() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_perm_key(Arg_&& arg, Args_... args);
-  std::string* mutable_perm_key();
-  PROTOBUF_NODISCARD std::string* release_perm_key();
-  void set_allocated_perm_key(std::string* value);
-
-  private:
-  const std::string& _internal_perm_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_perm_key(
-      const std::string& value);
-  std::string* _internal_mutable_perm_key();
-
-  public:
-  // int32 page = 2;
-  void clear_page() ;
-  ::int32_t page() const;
-  void set_page(::int32_t value);
-
-  private:
-  ::int32_t _internal_page() const;
-  void _internal_set_page(::int32_t value);
-
-  public:
-  // int32 page_size = 3;
-  void clear_page_size() ;
-  ::int32_t page_size() const;
-  void set_page_size(::int32_t value);
-
-  private:
-  ::int32_t _internal_page_size() const;
-  void _internal_set_page_size(::int32_t value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.ListPermissionsRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      3, 5, 0,
-      66, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const ListPermissionsRequest& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::ArenaStringPtr perm_name_;
-    ::google::protobuf::internal::ArenaStringPtr perm_key_;
-    ::int32_t page_;
-    ::int32_t page_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ListAuditLogsResponse_AuditLog final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.ListAuditLogsResponse.AuditLog) */ {
- public:
-  inline ListAuditLogsResponse_AuditLog() : ListAuditLogsResponse_AuditLog(nullptr) {}
-  ~ListAuditLogsResponse_AuditLog() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ListAuditLogsResponse_AuditLog* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ListAuditLogsResponse_AuditLog));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ListAuditLogsResponse_AuditLog(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline ListAuditLogsResponse_AuditLog(const ListAuditLogsResponse_AuditLog& from) : ListAuditLogsResponse_AuditLog(nullptr, from) {}
-  inline ListAuditLogsResponse_AuditLog(ListAuditLogsResponse_AuditLog&& from) noexcept
-      : ListAuditLogsResponse_AuditLog(nullptr, std::move(from)) {}
-  inline ListAuditLogsResponse_AuditLog& operator=(const ListAuditLogsResponse_AuditLog& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ListAuditLogsResponse_AuditLog& operator=(ListAuditLogsResponse_AuditLog&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const ListAuditLogsResponse_AuditLog& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const ListAuditLogsResponse_AuditLog* internal_default_instance() {
-    return reinterpret_cast<const ListAuditLogsResponse_AuditLog*>(
-        &_ListAuditLogsResponse_AuditLog_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 39;
-  friend void swap(ListAuditLogsResponse_AuditLog& a, ListAuditLogsResponse_AuditLog& b) { a.Swap(&b); }
-  inline void Swap(ListAuditLogsResponse_AuditLog* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(ListAuditLogsResponse_AuditLog* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  ListAuditLogsResponse_AuditLog* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ListAuditLogsResponse_AuditLog>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ListAuditLogsResponse_AuditLog& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ListAuditLogsResponse_AuditLog& from) { ListAuditLogsResponse_AuditLog::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(ListAuditLogsResponse_AuditLog* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.ListAuditLogsResponse.AuditLog"; }
-
- protected:
-  explicit ListAuditLogsResponse_AuditLog(::google::protobuf::Arena* arena);
-  ListAuditLogsResponse_AuditLog(::google::protobuf::Arena* arena, const ListAuditLogsResponse_AuditLog& from);
-  ListAuditLogsResponse_AuditLog(::google::protobuf::Arena* arena, ListAuditLogsResponse_AuditLog&& from) noexcept
-      : ListAuditLogsResponse_AuditLog(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kOperatorNameFieldNumber = 3,
-    kAppCodeFieldNumber = 4,
-    kActionFieldNumber = 5,
-    kTargetTypeFieldNumber = 6,
-    kTargetIdFieldNumber = 7,
-    kTargetNameFieldNumber = 8,
-    kObjectTypeFieldNumber = 9,
-    kObjectIdFieldNumber = 10,
-    kObjectNameFieldNumber = 11,
-    kCreatedAtFieldNumber = 12,
-    kIdFieldNumber = 1,
-    kOperatorIdFieldNumber = 2,
-  };
-  // string operator_name = 3;
-  void clear_operator_name() ;
-  const std::string& operator_name() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_operator_name(Arg_&& arg, Args_... args);
-  std::string* mutable_operator_name();
-  PROTOBUF_NODISCARD std::string* release_operator_name();
-  void set_allocated_operator_name(std::string* value);
-
-  private:
-  const std::string& _internal_operator_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_operator_name(
-      const std::string& value);
-  std::string* _internal_mutable_operator_name();
-
-  public:
-  // string app_code = 4;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // string action = 5;
-  void clear_action() ;
-  const std::string& action() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_action(Arg_&& arg, Args_... args);
-  std::string* mutable_action();
-  PROTOBUF_NODISCARD std::string* release_action();
-  void set_allocated_action(std::string* value);
-
-  private:
-  const std::string& _internal_action() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_action(
-      const std::string& value);
-  std::string* _internal_mutable_action();
-
-  public:
-  // string target_type = 6;
-  void clear_target_type() ;
-  const std::string& target_type() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_target_type(Arg_&& arg, Args_... args);
-  std::string* mutable_target_type();
-  PROTOBUF_NODISCARD std::string* release_target_type();
-  void set_allocated_target_type(std::string* value);
-
-  private:
-  const std::string& _internal_target_type() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_target_type(
-      const std::string& value);
-  std::string* _internal_mutable_target_type();
-
-  public:
-  // string target_id = 7;
-  void clear_target_id() ;
-  const std::string& target_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_target_id(Arg_&& arg, Args_... args);
-  std::string* mutable_target_id();
-  PROTOBUF_NODISCARD std::string* release_target_id();
-  void set_allocated_target_id(std::string* value);
-
-  private:
-  const std::string& _internal_target_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_target_id(
-      const std::string& value);
-  std::string* _internal_mutable_target_id();
-
-  public:
-  // string target_name = 8;
-  void clear_target_name() ;
-  const std::string& target_name() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_target_name(Arg_&& arg, Args_... args);
-  std::string* mutable_target_name();
-  PROTOBUF_NODISCARD std::string* release_target_name();
-  void set_allocated_target_name(std::string* value);
-
-  private:
-  const std::string& _internal_target_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_target_name(
-      const std::string& value);
-  std::string* _internal_mutable_target_name();
-
-  public:
-  // string object_type = 9;
-  void clear_object_type() ;
-  const std::string& object_type() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_object_type(Arg_&& arg, Args_... args);
-  std::string* mutable_object_type();
-  PROTOBUF_NODISCARD std::string* release_object_type();
-  void set_allocated_object_type(std::string* value);
-
-  private:
-  const std::string& _internal_object_type() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_object_type(
-      const std::string& value);
-  std::string* _internal_mutable_object_type();
-
-  public:
-  // string object_id = 10;
-  void clear_object_id() ;
-  const std::string& object_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_object_id(Arg_&& arg, Args_... args);
-  std::string* mutable_object_id();
-  PROTOBUF_NODISCARD std::string* release_object_id();
-  void set_allocated_object_id(std::string* value);
-
-  private:
-  const std::string& _internal_object_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_object_id(
-      const std::string& value);
-  std::string* _internal_mutable_object_id();
-
-  public:
-  // string object_name = 11;
-  void clear_object_name() ;
-  const std::string& object_name() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_object_name(Arg_&& arg, Args_... args);
-  std::string* mutable_object_name();
-  PROTOBUF_NODISCARD std::string* release_object_name();
-  void set_allocated_object_name(std::string* value);
-
-  private:
-  const std::string& _internal_object_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_object_name(
-      const std::string& value);
-  std::string* _internal_mutable_object_name();
-
-  public:
-  // string created_at = 12;
-  void clear_created_at() ;
-  const std::string& created_at() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_created_at(Arg_&& arg, Args_... args);
-  std::string* mutable_created_at();
-  PROTOBUF_NODISCARD std::string* release_created_at();
-  void set_allocated_created_at(std::string* value);
-
-  private:
-  const std::string& _internal_created_at() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_created_at(
-      const std::string& value);
-  std::string* _internal_mutable_created_at();
-
-  public:
-  // int64 id = 1;
-  void clear_id() ;
-  ::int64_t id() const;
-  void set_id(::int64_t value);
-
-  private:
-  ::int64_t _internal_id() const;
-  void _internal_set_id(::int64_t value);
-
-  public:
-  // int64 operator_id = 2;
-  void clear_operator_id() ;
-  ::int64_t operator_id() const;
-  void set_operator_id(::int64_t value);
-
-  private:
-  ::int64_t _internal_operator_id() const;
-  void _internal_set_operator_id(::int64_t value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.ListAuditLogsResponse.AuditLog)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      4, 12, 0,
-      156, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const ListAuditLogsResponse_AuditLog& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr operator_name_;
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::ArenaStringPtr action_;
-    ::google::protobuf::internal::ArenaStringPtr target_type_;
-    ::google::protobuf::internal::ArenaStringPtr target_id_;
-    ::google::protobuf::internal::ArenaStringPtr target_name_;
-    ::google::protobuf::internal::ArenaStringPtr object_type_;
-    ::google::protobuf::internal::ArenaStringPtr object_id_;
-    ::google::protobuf::internal::ArenaStringPtr object_name_;
-    ::google::protobuf::internal::ArenaStringPtr created_at_;
-    ::int64_t id_;
-    ::int64_t operator_id_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ListAuditLogsRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.ListAuditLogsRequest) */ {
- public:
-  inline ListAuditLogsRequest() : ListAuditLogsRequest(nullptr) {}
-  ~ListAuditLogsRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ListAuditLogsRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ListAuditLogsRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ListAuditLogsRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline ListAuditLogsRequest(const ListAuditLogsRequest& from) : ListAuditLogsRequest(nullptr, from) {}
-  inline ListAuditLogsRequest(ListAuditLogsRequest&& from) noexcept
-      : ListAuditLogsRequest(nullptr, std::move(from)) {}
-  inline ListAuditLogsRequest& operator=(const ListAuditLogsRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ListAuditLogsRequest& operator=(ListAuditLogsRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const ListAuditLogsRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const ListAuditLogsRequest* internal_default_instance() {
-    return reinterpret_cast<const ListAuditLogsRequest*>(
-        &_ListAuditLogsRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 38;
-  friend void swap(ListAuditLogsRequest& a, ListAuditLogsRequest& b) { a.Swap(&b); }
-  inline void Swap(ListAuditLogsRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(ListAuditLogsRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  ListAuditLogsRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ListAuditLogsRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ListAuditLogsRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ListAuditLogsRequest& from) { ListAuditLogsRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(ListAuditLogsRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.ListAuditLogsRequest"; }
-
- protected:
-  explicit ListAuditLogsRequest(::google::protobuf::Arena* arena);
-  ListAuditLogsRequest(::google::protobuf::Arena* arena, const ListAuditLogsRequest& from);
-  ListAuditLogsRequest(::google::protobuf::Arena* arena, ListAuditLogsRequest&& from) noexcept
-      : ListAuditLogsRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kOperatorIdFieldNumber = 3,
-    kAppCodeFieldNumber = 4,
-    kActionFieldNumber = 5,
-    kTargetIdFieldNumber = 6,
-    kPageFieldNumber = 1,
-    kPageSizeFieldNumber = 2,
-    kStartTimeFieldNumber = 7,
-    kEndTimeFieldNumber = 8,
-  };
-  // optional string operator_id = 3;
-  bool has_operator_id() const;
-  void clear_operator_id() ;
-  const std::string& operator_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_operator_id(Arg_&& arg, Args_... args);
-  std::string* mutable_operator_id();
-  PROTOBUF_NODISCARD std::string* release_operator_id();
-  void set_allocated_operator_id(std::string* value);
-
-  private:
-  const std::string& _internal_operator_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_operator_id(
-      const std::string& value);
-  std::string* _internal_mutable_operator_id();
-
-  public:
-  // optional string app_code = 4;
-  bool has_app_code() const;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // optional string action = 5;
-  bool has_action() const;
-  void clear_action() ;
-  const std::string& action() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_action(Arg_&& arg, Args_... args);
-  std::string* mutable_action();
-  PROTOBUF_NODISCARD std::string* release_action();
-  void set_allocated_action(std::string* value);
-
-  private:
-  const std::string& _internal_action() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_action(
-      const std::string& value);
-  std::string* _internal_mutable_action();
-
-  public:
-  // optional string target_id = 6;
-  bool has_target_id() const;
-  void clear_target_id() ;
-  const std::string& target_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_target_id(Arg_&& arg, Args_... args);
-  std::string* mutable_target_id();
-  PROTOBUF_NODISCARD std::string* release_target_id();
-  void set_allocated_target_id(std::string* value);
-
-  private:
-  const std::string& _internal_target_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_target_id(
-      const std::string& value);
-  std::string* _internal_mutable_target_id();
-
-  public:
-  // int32 page = 1;
-  void clear_page() ;
-  ::int32_t page() const;
-  void set_page(::int32_t value);
-
-  private:
-  ::int32_t _internal_page() const;
-  void _internal_set_page(::int32_t value);
-
-  public:
-  // int32 page_size = 2;
-  void clear_page_size() ;
-  ::int32_t page_size() const;
-  void set_page_size(::int32_t value);
-
-  private:
-  ::int32_t _internal_page_size() const;
-  void _internal_set_page_size(::int32_t value);
-
-  public:
-  // optional int64 start_time = 7;
-  bool has_start_time() const;
-  void clear_start_time() ;
-  ::int64_t start_time() const;
-  void set_start_time(::int64_t value);
-
-  private:
-  ::int64_t _internal_start_time() const;
-  void _internal_set_start_time(::int64_t value);
-
-  public:
-  // optional int64 end_time = 8;
-  bool has_end_time() const;
-  void clear_end_time() ;
-  ::int64_t end_time() const;
-  void set_end_time(::int64_t value);
-
-  private:
-  ::int64_t _internal_end_time() const;
-  void _internal_set_end_time(::int64_t value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.ListAuditLogsRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      3, 8, 0,
-      81, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const ListAuditLogsRequest& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr operator_id_;
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::ArenaStringPtr action_;
-    ::google::protobuf::internal::ArenaStringPtr target_id_;
-    ::int32_t page_;
-    ::int32_t page_size_;
-    ::int64_t start_time_;
-    ::int64_t end_time_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ListAppsRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.ListAppsRequest) */ {
- public:
-  inline ListAppsRequest() : ListAppsRequest(nullptr) {}
-  ~ListAppsRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ListAppsRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ListAppsRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ListAppsRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline ListAppsRequest(const ListAppsRequest& from) : ListAppsRequest(nullptr, from) {}
-  inline ListAppsRequest(ListAppsRequest&& from) noexcept
-      : ListAppsRequest(nullptr, std::move(from)) {}
-  inline ListAppsRequest& operator=(const ListAppsRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ListAppsRequest& operator=(ListAppsRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const ListAppsRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const ListAppsRequest* internal_default_instance() {
-    return reinterpret_cast<const ListAppsRequest*>(
-        &_ListAppsRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 15;
-  friend void swap(ListAppsRequest& a, ListAppsRequest& b) { a.Swap(&b); }
-  inline void Swap(ListAppsRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(ListAppsRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  ListAppsRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ListAppsRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ListAppsRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ListAppsRequest& from) { ListAppsRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(ListAppsRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.ListAppsRequest"; }
-
- protected:
-  explicit ListAppsRequest(::google::protobuf::Arena* arena);
-  ListAppsRequest(::google::protobuf::Arena* arena, const ListAppsRequest& from);
-  ListAppsRequest(::google::protobuf::Arena* arena, ListAppsRequest&& from) noexcept
-      : ListAppsRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppNameFieldNumber = 3,
-    kPageFieldNumber = 1,
-    kPageSizeFieldNumber = 2,
-    kStatusFieldNumber = 4,
-  };
-  // optional string app_name = 3;
-  bool has_app_name() const;
-  void clear_app_name() ;
-  const std::string& app_name() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_name(Arg_&& arg, Args_... args);
-  std::string* mutable_app_name();
-  PROTOBUF_NODISCARD std::string* release_app_name();
-  void set_allocated_app_name(std::string* value);
-
-  private:
-  const std::string& _internal_app_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_name(
-      const std::string& value);
-  std::string* _internal_mutable_app_name();
-
-  public:
-  // int32 page = 1;
-  void clear_page() ;
-  ::int32_t page() const;
-  void set_page(::int32_t value);
-
-  private:
-  ::int32_t _internal_page() const;
-  void _internal_set_page(::int32_t value);
-
-  public:
-  // int32 page_size = 2;
-  void clear_page_size() ;
-  ::int32_t page_size() const;
-  void set_page_size(::int32_t value);
-
-  private:
-  ::int32_t _internal_page_size() const;
-  void _internal_set_page_size(::int32_t value);
-
-  public:
-  // optional int32 status = 4;
-  bool has_status() const;
-  void clear_status() ;
-  ::int32_t status() const;
-  void set_status(::int32_t value);
-
-  private:
-  ::int32_t _internal_status() const;
-  void _internal_set_status(::int32_t value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.ListAppsRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 4, 0,
-      42, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const ListAppsRequest& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr app_name_;
-    ::int32_t page_;
-    ::int32_t page_size_;
-    ::int32_t status_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class GrantRoleToUserRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.GrantRoleToUserRequest) */ {
- public:
-  inline GrantRoleToUserRequest() : GrantRoleToUserRequest(nullptr) {}
-  ~GrantRoleToUserRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(GrantRoleToUserRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(GrantRoleToUserRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR GrantRoleToUserRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline GrantRoleToUserRequest(const GrantRoleToUserRequest& from) : GrantRoleToUserRequest(nullptr, from) {}
-  inline GrantRoleToUserRequest(GrantRoleToUserRequest&& from) noexcept
-      : GrantRoleToUserRequest(nullptr, std::move(from)) {}
-  inline GrantRoleToUserRequest& operator=(const GrantRoleToUserRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline GrantRoleToUserRequest& operator=(GrantRoleToUserRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const GrantRoleToUserRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const GrantRoleToUserRequest* internal_default_instance() {
-    return reinterpret_cast<const GrantRoleToUserRequest*>(
-        &_GrantRoleToUserRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 33;
-  friend void swap(GrantRoleToUserRequest& a, GrantRoleToUserRequest& b) { a.Swap(&b); }
-  inline void Swap(GrantRoleToUserRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(GrantRoleToUserRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  GrantRoleToUserRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<GrantRoleToUserRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const GrantRoleToUserRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const GrantRoleToUserRequest& from) { GrantRoleToUserRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(GrantRoleToUserRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.GrantRoleToUserRequest"; }
-
- protected:
-  explicit GrantRoleToUserRequest(::google::protobuf::Arena* arena);
-  GrantRoleToUserRequest(::google::protobuf::Arena* arena, const GrantRoleToUserRequest& from);
-  GrantRoleToUserRequest(::google::protobuf::Arena* arena, GrantRoleToUserRequest&& from) noexcept
-      : GrantRoleToUserRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppCodeFieldNumber = 2,
-    kUserIdFieldNumber = 3,
-    kRoleKeyFieldNumber = 4,
-  };
-  // string app_code = 2;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // string user_id = 3;
-  void clear_user_id() ;
-  const std::string& user_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_user_id(Arg_&& arg, Args_... args);
-  std::string* mutable_user_id();
-  PROTOBUF_NODISCARD std::string* release_user_id();
-  void set_allocated_user_id(std::string* value);
-
-  private:
-  const std::string& _internal_user_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_id(
-      const std::string& value);
-  std::string* _internal_mutable_user_id();
-
-  public:
-  // string role_key = 4;
-  void clear_role_key() ;
-  const std::string& role_key() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_role_key(Arg_&& arg, Args_... args);
-  std::string* mutable_role_key();
-  PROTOBUF_NODISCARD std::string* release_role_key();
-  void set_allocated_role_key(std::string* value);
-
-  private:
-  const std::string& _internal_role_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_role_key(
-      const std::string& value);
-  std::string* _internal_mutable_role_key();
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.GrantRoleToUserRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 3, 0,
-      64, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const GrantRoleToUserRequest& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::ArenaStringPtr user_id_;
-    ::google::protobuf::internal::ArenaStringPtr role_key_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class GetUserRolesResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.GetUserRolesResponse) */ {
- public:
-  inline GetUserRolesResponse() : GetUserRolesResponse(nullptr) {}
-  ~GetUserRolesResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(GetUserRolesResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(GetUserRolesResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR GetUserRolesResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline GetUserRolesResponse(const GetUserRolesResponse& from) : GetUserRolesResponse(nullptr, from) {}
-  inline GetUserRolesResponse(GetUserRolesResponse&& from) noexcept
-      : GetUserRolesResponse(nullptr, std::move(from)) {}
-  inline GetUserRolesResponse& operator=(const GetUserRolesResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline GetUserRolesResponse& operator=(GetUserRolesResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const GetUserRolesResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const GetUserRolesResponse* internal_default_instance() {
-    return reinterpret_cast<const GetUserRolesResponse*>(
-        &_GetUserRolesResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 9;
-  friend void swap(GetUserRolesResponse& a, GetUserRolesResponse& b) { a.Swap(&b); }
-  inline void Swap(GetUserRolesResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(GetUserRolesResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  GetUserRolesResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<GetUserRolesResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const GetUserRolesResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const GetUserRolesResponse& from) { GetUserRolesResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(GetUserRolesResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.GetUserRolesResponse"; }
-
- protected:
-  explicit GetUserRolesResponse(::google::protobuf::Arena* arena);
-  GetUserRolesResponse(::google::protobuf::Arena* arena, const GetUserRolesResponse& from);
-  GetUserRolesResponse(::google::protobuf::Arena* arena, GetUserRolesResponse&& from) noexcept
-      : GetUserRolesResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kRoleKeysFieldNumber = 1,
-  };
-  // repeated string role_keys = 1;
-  int role_keys_size() const;
-  private:
-  int _internal_role_keys_size() const;
-
-  public:
-  void clear_role_keys() ;
-  const std::string& role_keys(int index) const;
-  std::string* mutable_role_keys(int index);
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_role_keys(int index, Arg_&& value, Args_... args);
-  std::string* add_role_keys();
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void add_role_keys(Arg_&& value, Args_... args);
-  const ::google::protobuf::RepeatedPtrField<std::string>& role_keys() const;
-  ::google::protobuf::RepeatedPtrField<std::string>* mutable_role_keys();
-
-  private:
-  const ::google::protobuf::RepeatedPtrField<std::string>& _internal_role_keys() const;
-  ::google::protobuf::RepeatedPtrField<std::string>* _internal_mutable_role_keys();
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.GetUserRolesResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      0, 1, 0,
-      48, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const GetUserRolesResponse& from_msg);
-    ::google::protobuf::RepeatedPtrField<std::string> role_keys_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class GetUserRolesRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.GetUserRolesRequest) */ {
- public:
-  inline GetUserRolesRequest() : GetUserRolesRequest(nullptr) {}
-  ~GetUserRolesRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(GetUserRolesRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(GetUserRolesRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR GetUserRolesRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline GetUserRolesRequest(const GetUserRolesRequest& from) : GetUserRolesRequest(nullptr, from) {}
-  inline GetUserRolesRequest(GetUserRolesRequest&& from) noexcept
-      : GetUserRolesRequest(nullptr, std::move(from)) {}
-  inline GetUserRolesRequest& operator=(const GetUserRolesRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline GetUserRolesRequest& operator=(GetUserRolesRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const GetUserRolesRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const GetUserRolesRequest* internal_default_instance() {
-    return reinterpret_cast<const GetUserRolesRequest*>(
-        &_GetUserRolesRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 8;
-  friend void swap(GetUserRolesRequest& a, GetUserRolesRequest& b) { a.Swap(&b); }
-  inline void Swap(GetUserRolesRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(GetUserRolesRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  GetUserRolesRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<GetUserRolesRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const GetUserRolesRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const GetUserRolesRequest& from) { GetUserRolesRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(GetUserRolesRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.GetUserRolesRequest"; }
-
- protected:
-  explicit GetUserRolesRequest(::google::protobuf::Arena* arena);
-  GetUserRolesRequest(::google::protobuf::Arena* arena, const GetUserRolesRequest& from);
-  GetUserRolesRequest(::google::protobuf::Arena* arena, GetUserRolesRequest&& from) noexcept
-      : GetUserRolesRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppCodeFieldNumber = 1,
-    kUserIdFieldNumber = 2,
-  };
-  // string app_code = 1;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // string user_id = 2;
-  void clear_user_id() ;
-  const std::string& user_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_user_id(Arg_&& arg, Args_... args);
-  std::string* mutable_user_id();
-  PROTOBUF_NODISCARD std::string* release_user_id();
-  void set_allocated_user_id(std::string* value);
-
-  private:
-  const std::string& _internal_user_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_id(
-      const std::string& value);
-  std::string* _internal_mutable_user_id();
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.GetUserRolesRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 0,
-      53, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const GetUserRolesRequest& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::ArenaStringPtr user_id_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class GetUserPermissionsResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.GetUserPermissionsResponse) */ {
- public:
-  inline GetUserPermissionsResponse() : GetUserPermissionsResponse(nullptr) {}
-  ~GetUserPermissionsResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(GetUserPermissionsResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(GetUserPermissionsResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR GetUserPermissionsResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline GetUserPermissionsResponse(const GetUserPermissionsResponse& from) : GetUserPermissionsResponse(nullptr, from) {}
-  inline GetUserPermissionsResponse(GetUserPermissionsResponse&& from) noexcept
-      : GetUserPermissionsResponse(nullptr, std::move(from)) {}
-  inline GetUserPermissionsResponse& operator=(const GetUserPermissionsResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline GetUserPermissionsResponse& operator=(GetUserPermissionsResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const GetUserPermissionsResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const GetUserPermissionsResponse* internal_default_instance() {
-    return reinterpret_cast<const GetUserPermissionsResponse*>(
-        &_GetUserPermissionsResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 7;
-  friend void swap(GetUserPermissionsResponse& a, GetUserPermissionsResponse& b) { a.Swap(&b); }
-  inline void Swap(GetUserPermissionsResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(GetUserPermissionsResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  GetUserPermissionsResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<GetUserPermissionsResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const GetUserPermissionsResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const GetUserPermissionsResponse& from) { GetUserPermissionsResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(GetUserPermissionsResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.GetUserPermissionsResponse"; }
-
- protected:
-  explicit GetUserPermissionsResponse(::google::protobuf::Arena* arena);
-  GetUserPermissionsResponse(::google::protobuf::Arena* arena, const GetUserPermissionsResponse& from);
-  GetUserPermissionsResponse(::google::protobuf::Arena* arena, GetUserPermissionsResponse&& from) noexcept
-      : GetUserPermissionsResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kPermKeysFieldNumber = 1,
-  };
-  // repeated string perm_keys = 1;
-  int perm_keys_size() const;
-  private:
-  int _internal_perm_keys_size() const;
-
-  public:
-  void clear_perm_keys() ;
-  const std::string& perm_keys(int index) const;
-  std::string* mutable_perm_keys(int index);
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_perm_keys(int index, Arg_&& value, Args_... args);
-  std::string* add_perm_keys();
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void add_perm_keys(Arg_&& value, Args_... args);
-  const ::google::protobuf::RepeatedPtrField<std::string>& perm_keys() const;
-  ::google::protobuf::RepeatedPtrField<std::string>* mutable_perm_keys();
-
-  private:
-  const ::google::protobuf::RepeatedPtrField<std::string>& _internal_perm_keys() const;
-  ::google::protobuf::RepeatedPtrField<std::string>* _internal_mutable_perm_keys();
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.GetUserPermissionsResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      0, 1, 0,
-      54, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const GetUserPermissionsResponse& from_msg);
-    ::google::protobuf::RepeatedPtrField<std::string> perm_keys_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class GetUserPermissionsRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.GetUserPermissionsRequest) */ {
- public:
-  inline GetUserPermissionsRequest() : GetUserPermissionsRequest(nullptr) {}
-  ~GetUserPermissionsRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(GetUserPermissionsRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(GetUserPermissionsRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR GetUserPermissionsRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline GetUserPermissionsRequest(const GetUserPermissionsRequest& from) : GetUserPermissionsRequest(nullptr, from) {}
-  inline GetUserPermissionsRequest(GetUserPermissionsRequest&& from) noexcept
-      : GetUserPermissionsRequest(nullptr, std::move(from)) {}
-  inline GetUserPermissionsRequest& operator=(const GetUserPermissionsRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline GetUserPermissionsRequest& operator=(GetUserPermissionsRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const GetUserPermissionsRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const GetUserPermissionsRequest* internal_default_instance() {
-    return reinterpret_cast<const GetUserPermissionsRequest*>(
-        &_GetUserPermissionsRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 6;
-  friend void swap(GetUserPermissionsRequest& a, GetUserPermissionsRequest& b) { a.Swap(&b); }
-  inline void Swap(GetUserPermissionsRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(GetUserPermissionsRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  GetUserPermissionsRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<GetUserPermissionsRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const GetUserPermissionsRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const GetUserPermissionsRequest& from) { GetUserPermissionsRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(GetUserPermissionsRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.GetUserPermissionsRequest"; }
-
- protected:
-  explicit GetUserPermissionsRequest(::google::protobuf::Arena* arena);
-  GetUserPermissionsRequest(::google::protobuf::Arena* arena, const GetUserPermissionsRequest& from);
-  GetUserPermissionsRequest(::google::protobuf::Arena* arena, GetUserPermissionsRequest&& from) noexcept
-      : GetUserPermissionsRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppCodeFieldNumber = 1,
-    kUserIdFieldNumber = 2,
-  };
-  // string app_code = 1;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // string user_id = 2;
-  void clear_user_id() ;
-  const std::string& user_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_user_id(Arg_&& arg, Args_... args);
-  std::string* mutable_user_id();
-  PROTOBUF_NODISCARD std::string* release_user_id();
-  void set_allocated_user_id(std::string* value);
-
-  private:
-  const std::string& _internal_user_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_id(
-      const std::string& value);
-  std::string* _internal_mutable_user_id();
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.GetUserPermissionsRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 0,
-      59, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const GetUserPermissionsRequest& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::ArenaStringPtr user_id_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class GetRoleUsersResponse_User final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.GetRoleUsersResponse.User) */ {
- public:
-  inline GetRoleUsersResponse_User() : GetRoleUsersResponse_User(nullptr) {}
-  ~GetRoleUsersResponse_User() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(GetRoleUsersResponse_User* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(GetRoleUsersResponse_User));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR GetRoleUsersResponse_User(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline GetRoleUsersResponse_User(const GetRoleUsersResponse_User& from) : GetRoleUsersResponse_User(nullptr, from) {}
-  inline GetRoleUsersResponse_User(GetRoleUsersResponse_User&& from) noexcept
-      : GetRoleUsersResponse_User(nullptr, std::move(from)) {}
-  inline GetRoleUsersResponse_User& operator=(const GetRoleUsersResponse_User& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline GetRoleUsersResponse_User& operator=(GetRoleUsersResponse_User&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const GetRoleUsersResponse_User& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const GetRoleUsersResponse_User* internal_default_instance() {
-    return reinterpret_cast<const GetRoleUsersResponse_User*>(
-        &_GetRoleUsersResponse_User_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 36;
-  friend void swap(GetRoleUsersResponse_User& a, GetRoleUsersResponse_User& b) { a.Swap(&b); }
-  inline void Swap(GetRoleUsersResponse_User* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(GetRoleUsersResponse_User* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  GetRoleUsersResponse_User* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<GetRoleUsersResponse_User>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const GetRoleUsersResponse_User& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const GetRoleUsersResponse_User& from) { GetRoleUsersResponse_User::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(GetRoleUsersResponse_User* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.GetRoleUsersResponse.User"; }
-
- protected:
-  explicit GetRoleUsersResponse_User(::google::protobuf::Arena* arena);
-  GetRoleUsersResponse_User(::google::protobuf::Arena* arena, const GetRoleUsersResponse_User& from);
-  GetRoleUsersResponse_User(::google::protobuf::Arena* arena, GetRoleUsersResponse_User&& from) noexcept
-      : GetRoleUsersResponse_User(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kUserIdFieldNumber = 1,
-    kCreatedAtFieldNumber = 2,
-  };
-  // string user_id = 1;
-  void clear_user_id() ;
-  const std::string& user_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_user_id(Arg_&& arg, Args_... args);
-  std::string* mutable_user_id();
-  PROTOBUF_NODISCARD std::string* release_user_id();
-  void set_allocated_user_id(std::string* value);
-
-  private:
-  const std::string& _internal_user_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_id(
-      const std::string& value);
-  std::string* _internal_mutable_user_id();
-
-  public:
-  // string created_at = 2;
-  void clear_created_at() ;
-  const std::string& created_at() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_created_at(Arg_&& arg, Args_... args);
-  std::string* mutable_created_at();
-  PROTOBUF_NODISCARD std::string* release_created_at();
-  void set_allocated_created_at(std::string* value);
-
-  private:
-  const std::string& _internal_created_at() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_created_at(
-      const std::string& value);
-  std::string* _internal_mutable_created_at();
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.GetRoleUsersResponse.User)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 0,
-      61, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const GetRoleUsersResponse_User& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr user_id_;
-    ::google::protobuf::internal::ArenaStringPtr created_at_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class GetRoleUsersRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.GetRoleUsersRequest) */ {
- public:
-  inline GetRoleUsersRequest() : GetRoleUsersRequest(nullptr) {}
-  ~GetRoleUsersRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(GetRoleUsersRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(GetRoleUsersRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR GetRoleUsersRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline GetRoleUsersRequest(const GetRoleUsersRequest& from) : GetRoleUsersRequest(nullptr, from) {}
-  inline GetRoleUsersRequest(GetRoleUsersRequest&& from) noexcept
-      : GetRoleUsersRequest(nullptr, std::move(from)) {}
-  inline GetRoleUsersRequest& operator=(const GetRoleUsersRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline GetRoleUsersRequest& operator=(GetRoleUsersRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const GetRoleUsersRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const GetRoleUsersRequest* internal_default_instance() {
-    return reinterpret_cast<const GetRoleUsersRequest*>(
-        &_GetRoleUsersRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 35;
-  friend void swap(GetRoleUsersRequest& a, GetRoleUsersRequest& b) { a.Swap(&b); }
-  inline void Swap(GetRoleUsersRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(GetRoleUsersRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  GetRoleUsersRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<GetRoleUsersRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const GetRoleUsersRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const GetRoleUsersRequest& from) { GetRoleUsersRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(GetRoleUsersRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.GetRoleUsersRequest"; }
-
- protected:
-  explicit GetRoleUsersRequest(::google::protobuf::Arena* arena);
-  GetRoleUsersRequest(::google::protobuf::Arena* arena, const GetRoleUsersRequest& from);
-  GetRoleUsersRequest(::google::protobuf::Arena* arena, GetRoleUsersRequest&& from) noexcept
-      : GetRoleUsersRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppCodeFieldNumber = 1,
-    kRoleKeyFieldNumber = 2,
-    kPageFieldNumber = 3,
-    kPageSizeFieldNumber = 4,
-  };
-  // string app_code = 1;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // string role_key = 2;
-  void clear_role_key() ;
-  const std::string& role_key() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_role_key(Arg_&& arg, Args_... args);
-  std::string* mutable_role_key();
-  PROTOBUF_NODISCARD std::string* release_role_key();
-  void set_allocated_role_key(std::string* value);
-
-  private:
-  const std::string& _internal_role_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_role_key(
-      const std::string& value);
-  std::string* _internal_mutable_role_key();
-
-  public:
-  // int32 page = 3;
-  void clear_page() ;
-  ::int32_t page() const;
-  void set_page(::int32_t value);
-
-  private:
-  ::int32_t _internal_page() const;
-  void _internal_set_page(::int32_t value);
-
-  public:
-  // int32 page_size = 4;
-  void clear_page_size() ;
-  ::int32_t page_size() const;
-  void set_page_size(::int32_t value);
-
-  private:
-  ::int32_t _internal_page_size() const;
-  void _internal_set_page_size(::int32_t value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.GetRoleUsersRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 4, 0,
-      54, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const GetRoleUsersRequest& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::ArenaStringPtr role_key_;
-    ::int32_t page_;
-    ::int32_t page_size_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class GetRolePermissionsResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.GetRolePermissionsResponse) */ {
- public:
-  inline GetRolePermissionsResponse() : GetRolePermissionsResponse(nullptr) {}
-  ~GetRolePermissionsResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(GetRolePermissionsResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(GetRolePermissionsResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR GetRolePermissionsResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline GetRolePermissionsResponse(const GetRolePermissionsResponse& from) : GetRolePermissionsResponse(nullptr, from) {}
-  inline GetRolePermissionsResponse(GetRolePermissionsResponse&& from) noexcept
-      : GetRolePermissionsResponse(nullptr, std::move(from)) {}
-  inline GetRolePermissionsResponse& operator=(const GetRolePermissionsResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline GetRolePermissionsResponse& operator=(GetRolePermissionsResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const GetRolePermissionsResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const GetRolePermissionsResponse* internal_default_instance() {
-    return reinterpret_cast<const GetRolePermissionsResponse*>(
-        &_GetRolePermissionsResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 32;
-  friend void swap(GetRolePermissionsResponse& a, GetRolePermissionsResponse& b) { a.Swap(&b); }
-  inline void Swap(GetRolePermissionsResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(GetRolePermissionsResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  GetRolePermissionsResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<GetRolePermissionsResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const GetRolePermissionsResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const GetRolePermissionsResponse& from) { GetRolePermissionsResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(GetRolePermissionsResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.GetRolePermissionsResponse"; }
-
- protected:
-  explicit GetRolePermissionsResponse(::google::protobuf::Arena* arena);
-  GetRolePermissionsResponse(::google::protobuf::Arena* arena, const GetRolePermissionsResponse& from);
-  GetRolePermissionsResponse(::google::protobuf::Arena* arena, GetRolePermissionsResponse&& from) noexcept
-      : GetRolePermissionsResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kPermKeysFieldNumber = 1,
-  };
-  // repeated string perm_keys = 1;
-  int perm_keys_size() const;
-  private:
-  int _internal_perm_keys_size() const;
-
-  public:
-  void clear_perm_keys() ;
-  const std::string& perm_keys(int index) const;
-  std::string* mutable_perm_keys(int index);
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_perm_keys(int index, Arg_&& value, Args_... args);
-  std::string* add_perm_keys();
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void add_perm_keys(Arg_&& value, Args_... args);
-  const ::google::protobuf::RepeatedPtrField<std::string>& perm_keys() const;
-  ::google::protobuf::RepeatedPtrField<std::string>* mutable_perm_keys();
-
-  private:
-  const ::google::protobuf::RepeatedPtrField<std::string>& _internal_perm_keys() const;
-  ::google::protobuf::RepeatedPtrField<std::string>* _internal_mutable_perm_keys();
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.GetRolePermissionsResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      0, 1, 0,
-      54, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const GetRolePermissionsResponse& from_msg);
-    ::google::protobuf::RepeatedPtrField<std::string> perm_keys_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class GetRolePermissionsRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.GetRolePermissionsRequest) */ {
- public:
-  inline GetRolePermissionsRequest() : GetRolePermissionsRequest(nullptr) {}
-  ~GetRolePermissionsRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(GetRolePermissionsRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(GetRolePermissionsRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR GetRolePermissionsRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline GetRolePermissionsRequest(const GetRolePermissionsRequest& from) : GetRolePermissionsRequest(nullptr, from) {}
-  inline GetRolePermissionsRequest(GetRolePermissionsRequest&& from) noexcept
-      : GetRolePermissionsRequest(nullptr, std::move(from)) {}
-  inline GetRolePermissionsRequest& operator=(const GetRolePermissionsRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline GetRolePermissionsRequest& operator=(GetRolePermissionsRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const GetRolePermissionsRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const GetRolePermissionsRequest* internal_default_instance() {
-    return reinterpret_cast<const GetRolePermissionsRequest*>(
-        &_GetRolePermissionsRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 31;
-  friend void swap(GetRolePermissionsRequest& a, GetRolePermissionsRequest& b) { a.Swap(&b); }
-  inline void Swap(GetRolePermissionsRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(GetRolePermissionsRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  GetRolePermissionsRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<GetRolePermissionsRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const GetRolePermissionsRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const GetRolePermissionsRequest& from) { GetRolePermissionsRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(GetRolePermissionsRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.GetRolePermissionsRequest"; }
-
- protected:
-  explicit GetRolePermissionsRequest(::google::protobuf::Arena* arena);
-  GetRolePermissionsRequest(::google::protobuf::Arena* arena, const GetRolePermissionsRequest& from);
-  GetRolePermissionsRequest(::google::protobuf::Arena* arena, GetRolePermissionsRequest&& from) noexcept
-      : GetRolePermissionsRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppCodeFieldNumber = 1,
-    kRoleKeyFieldNumber = 2,
-  };
-  // string app_code = 1;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // string role_key = 2;
-  void clear_role_key() ;
-  const std::string& role_key() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_role_key(Arg_&& arg, Args_... args);
-  std::string* mutable_role_key();
-  PROTOBUF_NODISCARD std::string* release_role_key();
-  void set_allocated_role_key(std::string* value);
-
-  private:
-  const std::string& _internal_role_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_role_key(
-      const std::string& value);
-  std::string* _internal_mutable_role_key();
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.GetRolePermissionsRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 0,
-      60, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const GetRolePermissionsRequest& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::ArenaStringPtr role_key_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class GetAppResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.GetAppResponse) */ {
- public:
-  inline GetAppResponse() : GetAppResponse(nullptr) {}
-  ~GetAppResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(GetAppResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(GetAppResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR GetAppResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline GetAppResponse(const GetAppResponse& from) : GetAppResponse(nullptr, from) {}
-  inline GetAppResponse(GetAppResponse&& from) noexcept
-      : GetAppResponse(nullptr, std::move(from)) {}
-  inline GetAppResponse& operator=(const GetAppResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline GetAppResponse& operator=(GetAppResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const GetAppResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const GetAppResponse* internal_default_instance() {
-    return reinterpret_cast<const GetAppResponse*>(
-        &_GetAppResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 14;
-  friend void swap(GetAppResponse& a, GetAppResponse& b) { a.Swap(&b); }
-  inline void Swap(GetAppResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(GetAppResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  GetAppResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<GetAppResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const GetAppResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const GetAppResponse& from) { GetAppResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(GetAppResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.GetAppResponse"; }
-
- protected:
-  explicit GetAppResponse(::google::protobuf::Arena* arena);
-  GetAppResponse(::google::protobuf::Arena* arena, const GetAppResponse& from);
-  GetAppResponse(::google::protobuf::Arena* arena, GetAppResponse&& from) noexcept
-      : GetAppResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppNameFieldNumber = 2,
-    kAppCodeFieldNumber = 3,
-    kAppSecretFieldNumber = 4,
-    kDescriptionFieldNumber = 5,
-    kCreatedAtFieldNumber = 7,
-    kUpdatedAtFieldNumber = 8,
-    kIdFieldNumber = 1,
-    kStatusFieldNumber = 6,
-  };
-  // string app_name = 2;
-  void clear_app_name() ;
-  const std::string& app_name() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_name(Arg_&& arg, Args_... args);
-  std::string* mutable_app_name();
-  PROTOBUF_NODISCARD std::string* release_app_name();
-  void set_allocated_app_name(std::string* value);
-
-  private:
-  const std::string& _internal_app_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_name(
-      const std::string& value);
-  std::string* _internal_mutable_app_name();
-
-  public:
-  // string app_code = 3;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // string app_secret = 4;
-  void clear_app_secret() ;
-  const std::string& app_secret() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_secret(Arg_&& arg, Args_... args);
-  std::string* mutable_app_secret();
-  PROTOBUF_NODISCARD std::string* release_app_secret();
-  void set_allocated_app_secret(std::string* value);
-
-  private:
-  const std::string& _internal_app_secret() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_secret(
-      const std::string& value);
-  std::string* _internal_mutable_app_secret();
-
-  public:
-  // string description = 5;
-  void clear_description() ;
-  const std::string& description() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_description(Arg_&& arg, Args_... args);
-  std::string* mutable_description();
-  PROTOBUF_NODISCARD std::string* release_description();
-  void set_allocated_description(std::string* value);
-
-  private:
-  const std::string& _internal_description() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_description(
-      const std::string& value);
-  std::string* _internal_mutable_description();
-
-  public:
-  // string created_at = 7;
-  void clear_created_at() ;
-  const std::string& created_at() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_created_at(Arg_&& arg, Args_... args);
-  std::string* mutable_created_at();
-  PROTOBUF_NODISCARD std::string* release_created_at();
-  void set_allocated_created_at(std::string* value);
-
-  private:
-  const std::string& _internal_created_at() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_created_at(
-      const std::string& value);
-  std::string* _internal_mutable_created_at();
-
-  public:
-  // string updated_at = 8;
-  void clear_updated_at() ;
-  const std::string& updated_at() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_updated_at(Arg_&& arg, Args_... args);
-  std::string* mutable_updated_at();
-  PROTOBUF_NODISCARD std::string* release_updated_at();
-  void set_allocated_updated_at(std::string* value);
-
-  private:
-  const std::string& _internal_updated_at() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_updated_at(
-      const std::string& value);
-  std::string* _internal_mutable_updated_at();
-
-  public:
-  // int64 id = 1;
-  void clear_id() ;
-  ::int64_t id() const;
-  void set_id(::int64_t value);
-
-  private:
-  ::int64_t _internal_id() const;
-  void _internal_set_id(::int64_t value);
-
-  public:
-  // int32 status = 6;
-  void clear_status() ;
-  ::int32_t status() const;
-  void set_status(::int32_t value);
-
-  private:
-  ::int32_t _internal_status() const;
-  void _internal_set_status(::int32_t value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.GetAppResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      3, 8, 0,
-      98, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const GetAppResponse& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr app_name_;
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::ArenaStringPtr app_secret_;
-    ::google::protobuf::internal::ArenaStringPtr description_;
-    ::google::protobuf::internal::ArenaStringPtr created_at_;
-    ::google::protobuf::internal::ArenaStringPtr updated_at_;
-    ::int64_t id_;
-    ::int32_t status_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class GetAppRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.GetAppRequest) */ {
- public:
-  inline GetAppRequest() : GetAppRequest(nullptr) {}
-  ~GetAppRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(GetAppRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(GetAppRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR GetAppRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline GetAppRequest(const GetAppRequest& from) : GetAppRequest(nullptr, from) {}
-  inline GetAppRequest(GetAppRequest&& from) noexcept
-      : GetAppRequest(nullptr, std::move(from)) {}
-  inline GetAppRequest& operator=(const GetAppRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline GetAppRequest& operator=(GetAppRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const GetAppRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const GetAppRequest* internal_default_instance() {
-    return reinterpret_cast<const GetAppRequest*>(
-        &_GetAppRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 13;
-  friend void swap(GetAppRequest& a, GetAppRequest& b) { a.Swap(&b); }
-  inline void Swap(GetAppRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(GetAppRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  GetAppRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<GetAppRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const GetAppRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const GetAppRequest& from) { GetAppRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(GetAppRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.GetAppRequest"; }
-
- protected:
-  explicit GetAppRequest(::google::protobuf::Arena* arena);
-  GetAppRequest(::google::protobuf::Arena* arena, const GetAppRequest& from);
-  GetAppRequest(::google::protobuf::Arena* arena, GetAppRequest&& from) noexcept
-      : GetAppRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppCodeFieldNumber = 1,
-  };
-  // string app_code = 1;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.GetAppRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      0, 1, 0,
-      40, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const GetAppRequest& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class DeleteRoleRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.DeleteRoleRequest) */ {
- public:
-  inline DeleteRoleRequest() : DeleteRoleRequest(nullptr) {}
-  ~DeleteRoleRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(DeleteRoleRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(DeleteRoleRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR DeleteRoleRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline DeleteRoleRequest(const DeleteRoleRequest& from) : DeleteRoleRequest(nullptr, from) {}
-  inline DeleteRoleRequest(DeleteRoleRequest&& from) noexcept
-      : DeleteRoleRequest(nullptr, std::move(from)) {}
-  inline DeleteRoleRequest& operator=(const DeleteRoleRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline DeleteRoleRequest& operator=(DeleteRoleRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const DeleteRoleRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const DeleteRoleRequest* internal_default_instance() {
-    return reinterpret_cast<const DeleteRoleRequest*>(
-        &_DeleteRoleRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 25;
-  friend void swap(DeleteRoleRequest& a, DeleteRoleRequest& b) { a.Swap(&b); }
-  inline void Swap(DeleteRoleRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(DeleteRoleRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  DeleteRoleRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<DeleteRoleRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const DeleteRoleRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const DeleteRoleRequest& from) { DeleteRoleRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(DeleteRoleRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.DeleteRoleRequest"; }
-
- protected:
-  explicit DeleteRoleRequest(::google::protobuf::Arena* arena);
-  DeleteRoleRequest(::google::protobuf::Arena* arena, const DeleteRoleRequest& from);
-  DeleteRoleRequest(::google::protobuf::Arena* arena, DeleteRoleRequest&& from) noexcept
-      : DeleteRoleRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppCodeFieldNumber = 2,
-    kRoleKeyFieldNumber = 3,
-  };
-  // string app_code = 2;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // string role_key = 3;
-  void clear_role_key() ;
-  const std::string& role_key() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_role_key(Arg_&& arg, Args_... args);
-  std::string* mutable_role_key();
-  PROTOBUF_NODISCARD std::string* release_role_key();
-  void set_allocated_role_key(std::string* value);
-
-  private:
-  const std::string& _internal_role_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_role_key(
-      const std::string& value);
-  std::string* _internal_mutable_role_key();
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.DeleteRoleRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 0,
-      52, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const DeleteRoleRequest& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::ArenaStringPtr role_key_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class DeletePermissionRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.DeletePermissionRequest) */ {
- public:
-  inline DeletePermissionRequest() : DeletePermissionRequest(nullptr) {}
-  ~DeletePermissionRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(DeletePermissionRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(DeletePermissionRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR DeletePermissionRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline DeletePermissionRequest(const DeletePermissionRequest& from) : DeletePermissionRequest(nullptr, from) {}
-  inline DeletePermissionRequest(DeletePermissionRequest&& from) noexcept
-      : DeletePermissionRequest(nullptr, std::move(from)) {}
-  inline DeletePermissionRequest& operator=(const DeletePermissionRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline DeletePermissionRequest& operator=(DeletePermissionRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const DeletePermissionRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const DeletePermissionRequest* internal_default_instance() {
-    return reinterpret_cast<const DeletePermissionRequest*>(
-        &_DeletePermissionRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 19;
-  friend void swap(DeletePermissionRequest& a, DeletePermissionRequest& b) { a.Swap(&b); }
-  inline void Swap(DeletePermissionRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(DeletePermissionRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  DeletePermissionRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<DeletePermissionRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const DeletePermissionRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const DeletePermissionRequest& from) { DeletePermissionRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(DeletePermissionRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.DeletePermissionRequest"; }
-
- protected:
-  explicit DeletePermissionRequest(::google::protobuf::Arena* arena);
-  DeletePermissionRequest(::google::protobuf::Arena* arena, const DeletePermissionRequest& from);
-  DeletePermissionRequest(::google::protobuf::Arena* arena, DeletePermissionRequest&& from) noexcept
-      : DeletePermissionRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppCodeFieldNumber = 2,
-    kPermKeyFieldNumber = 3,
-  };
-  // string app_code = 2;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // string perm_key = 3;
-  void clear_perm_key() ;
-  const std::string& perm_key() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_perm_key(Arg_&& arg, Args_... args);
-  std::string* mutable_perm_key();
-  PROTOBUF_NODISCARD std::string* release_perm_key();
-  void set_allocated_perm_key(std::string* value);
-
-  private:
-  const std::string& _internal_perm_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_perm_key(
-      const std::string& value);
-  std::string* _internal_mutable_perm_key();
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.DeletePermissionRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 0,
-      58, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const DeletePermissionRequest& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::ArenaStringPtr perm_key_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class DeleteAppRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.DeleteAppRequest) */ {
- public:
-  inline DeleteAppRequest() : DeleteAppRequest(nullptr) {}
-  ~DeleteAppRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(DeleteAppRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(DeleteAppRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR DeleteAppRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline DeleteAppRequest(const DeleteAppRequest& from) : DeleteAppRequest(nullptr, from) {}
-  inline DeleteAppRequest(DeleteAppRequest&& from) noexcept
-      : DeleteAppRequest(nullptr, std::move(from)) {}
-  inline DeleteAppRequest& operator=(const DeleteAppRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline DeleteAppRequest& operator=(DeleteAppRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const DeleteAppRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const DeleteAppRequest* internal_default_instance() {
-    return reinterpret_cast<const DeleteAppRequest*>(
-        &_DeleteAppRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 12;
-  friend void swap(DeleteAppRequest& a, DeleteAppRequest& b) { a.Swap(&b); }
-  inline void Swap(DeleteAppRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(DeleteAppRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  DeleteAppRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<DeleteAppRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const DeleteAppRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const DeleteAppRequest& from) { DeleteAppRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(DeleteAppRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.DeleteAppRequest"; }
-
- protected:
-  explicit DeleteAppRequest(::google::protobuf::Arena* arena);
-  DeleteAppRequest(::google::protobuf::Arena* arena, const DeleteAppRequest& from);
-  DeleteAppRequest(::google::protobuf::Arena* arena, DeleteAppRequest&& from) noexcept
-      : DeleteAppRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppCodeFieldNumber = 2,
-  };
-  // string app_code = 2;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.DeleteAppRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      0, 1, 0,
-      43, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const DeleteAppRequest& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class CreateRoleRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.CreateRoleRequest) */ {
- public:
-  inline CreateRoleRequest() : CreateRoleRequest(nullptr) {}
-  ~CreateRoleRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(CreateRoleRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(CreateRoleRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR CreateRoleRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline CreateRoleRequest(const CreateRoleRequest& from) : CreateRoleRequest(nullptr, from) {}
-  inline CreateRoleRequest(CreateRoleRequest&& from) noexcept
-      : CreateRoleRequest(nullptr, std::move(from)) {}
-  inline CreateRoleRequest& operator=(const CreateRoleRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline CreateRoleRequest& operator=(CreateRoleRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const CreateRoleRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const CreateRoleRequest* internal_default_instance() {
-    return reinterpret_cast<const CreateRoleRequest*>(
-        &_CreateRoleRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 23;
-  friend void swap(CreateRoleRequest& a, CreateRoleRequest& b) { a.Swap(&b); }
-  inline void Swap(CreateRoleRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(CreateRoleRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  CreateRoleRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<CreateRoleRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const CreateRoleRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const CreateRoleRequest& from) { CreateRoleRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(CreateRoleRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.CreateRoleRequest"; }
-
- protected:
-  explicit CreateRoleRequest(::google::protobuf::Arena* arena);
-  CreateRoleRequest(::google::protobuf::Arena* arena, const CreateRoleRequest& from);
-  CreateRoleRequest(::google::protobuf::Arena* arena, CreateRoleRequest&& from) noexcept
-      : CreateRoleRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppCodeFieldNumber = 2,
-    kRoleNameFieldNumber = 3,
-    kRoleKeyFieldNumber = 4,
-    kDescriptionFieldNumber = 5,
-    kIsDefaultFieldNumber = 6,
-  };
-  // string app_code = 2;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // string role_name = 3;
-  void clear_role_name() ;
-  const std::string& role_name() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_role_name(Arg_&& arg, Args_... args);
-  std::string* mutable_role_name();
-  PROTOBUF_NODISCARD std::string* release_role_name();
-  void set_allocated_role_name(std::string* value);
-
-  private:
-  const std::string& _internal_role_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_role_name(
-      const std::string& value);
-  std::string* _internal_mutable_role_name();
-
-  public:
-  // string role_key = 4;
-  void clear_role_key() ;
-  const std::string& role_key() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_role_key(Arg_&& arg, Args_... args);
-  std::string* mutable_role_key();
-  PROTOBUF_NODISCARD std::string* release_role_key();
-  void set_allocated_role_key(std::string* value);
-
-  private:
-  const std::string& _internal_role_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_role_key(
-      const std::string& value);
-  std::string* _internal_mutable_role_key();
-
-  public:
-  // string description = 5;
-  void clear_description() ;
-  const std::string& description() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_description(Arg_&& arg, Args_... args);
-  std::string* mutable_description();
-  PROTOBUF_NODISCARD std::string* release_description();
-  void set_allocated_description(std::string* value);
-
-  private:
-  const std::string& _internal_description() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_description(
-      const std::string& value);
-  std::string* _internal_mutable_description();
-
-  public:
-  // bool is_default = 6;
-  void clear_is_default() ;
-  bool is_default() const;
-  void set_is_default(bool value);
-
-  private:
-  bool _internal_is_default() const;
-  void _internal_set_is_default(bool value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.CreateRoleRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      3, 5, 0,
-      72, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const CreateRoleRequest& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::ArenaStringPtr role_name_;
-    ::google::protobuf::internal::ArenaStringPtr role_key_;
-    ::google::protobuf::internal::ArenaStringPtr description_;
-    bool is_default_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class CreatePermissionRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.CreatePermissionRequest) */ {
- public:
-  inline CreatePermissionRequest() : CreatePermissionRequest(nullptr) {}
-  ~CreatePermissionRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(CreatePermissionRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(CreatePermissionRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR CreatePermissionRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline CreatePermissionRequest(const CreatePermissionRequest& from) : CreatePermissionRequest(nullptr, from) {}
-  inline CreatePermissionRequest(CreatePermissionRequest&& from) noexcept
-      : CreatePermissionRequest(nullptr, std::move(from)) {}
-  inline CreatePermissionRequest& operator=(const CreatePermissionRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline CreatePermissionRequest& operator=(CreatePermissionRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const CreatePermissionRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const CreatePermissionRequest* internal_default_instance() {
-    return reinterpret_cast<const CreatePermissionRequest*>(
-        &_CreatePermissionRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 17;
-  friend void swap(CreatePermissionRequest& a, CreatePermissionRequest& b) { a.Swap(&b); }
-  inline void Swap(CreatePermissionRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(CreatePermissionRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  CreatePermissionRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<CreatePermissionRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const CreatePermissionRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const CreatePermissionRequest& from) { CreatePermissionRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(CreatePermissionRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.CreatePermissionRequest"; }
-
- protected:
-  explicit CreatePermissionRequest(::google::protobuf::Arena* arena);
-  CreatePermissionRequest(::google::protobuf::Arena* arena, const CreatePermissionRequest& from);
-  CreatePermissionRequest(::google::protobuf::Arena* arena, CreatePermissionRequest&& from) noexcept
-      : CreatePermissionRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppCodeFieldNumber = 2,
-    kPermNameFieldNumber = 3,
-    kPermKeyFieldNumber = 4,
-    kDescriptionFieldNumber = 5,
-  };
-  // string app_code = 2;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // string perm_name = 3;
-  void clear_perm_name() ;
-  const std::string& perm_name() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_perm_name(Arg_&& arg, Args_... args);
-  std::string* mutable_perm_name();
-  PROTOBUF_NODISCARD std::string* release_perm_name();
-  void set_allocated_perm_name(std::string* value);
-
-  private:
-  const std::string& _internal_perm_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_perm_name(
-      const std::string& value);
-  std::string* _internal_mutable_perm_name();
-
-  public:
-  // string perm_key = 4;
-  void clear_perm_key() ;
-  const std::string& perm_key() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_perm_key(Arg_&& arg, Args_... args);
-  std::string* mutable_perm_key();
-  PROTOBUF_NODISCARD std::string* release_perm_key();
-  void set_allocated_perm_key(std::string* value);
-
-  private:
-  const std::string& _internal_perm_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_perm_key(
-      const std::string& value);
-  std::string* _internal_mutable_perm_key();
-
-  public:
-  // string description = 5;
-  void clear_description() ;
-  const std::string& description() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_description(Arg_&& arg, Args_... args);
-  std::string* mutable_description();
-  PROTOBUF_NODISCARD std::string* release_description();
-  void set_allocated_description(std::string* value);
-
-  private:
-  const std::string& _internal_description() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_description(
-      const std::string& value);
-  std::string* _internal_mutable_description();
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.CreatePermissionRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 4, 0,
-      78, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const CreatePermissionRequest& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::ArenaStringPtr perm_name_;
-    ::google::protobuf::internal::ArenaStringPtr perm_key_;
-    ::google::protobuf::internal::ArenaStringPtr description_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class CreateAppRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.CreateAppRequest) */ {
- public:
-  inline CreateAppRequest() : CreateAppRequest(nullptr) {}
-  ~CreateAppRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(CreateAppRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(CreateAppRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR CreateAppRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline CreateAppRequest(const CreateAppRequest& from) : CreateAppRequest(nullptr, from) {}
-  inline CreateAppRequest(CreateAppRequest&& from) noexcept
-      : CreateAppRequest(nullptr, std::move(from)) {}
-  inline CreateAppRequest& operator=(const CreateAppRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline CreateAppRequest& operator=(CreateAppRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const CreateAppRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const CreateAppRequest* internal_default_instance() {
-    return reinterpret_cast<const CreateAppRequest*>(
-        &_CreateAppRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 10;
-  friend void swap(CreateAppRequest& a, CreateAppRequest& b) { a.Swap(&b); }
-  inline void Swap(CreateAppRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(CreateAppRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  CreateAppRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<CreateAppRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const CreateAppRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const CreateAppRequest& from) { CreateAppRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(CreateAppRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.CreateAppRequest"; }
-
- protected:
-  explicit CreateAppRequest(::google::protobuf::Arena* arena);
-  CreateAppRequest(::google::protobuf::Arena* arena, const CreateAppRequest& from);
-  CreateAppRequest(::google::protobuf::Arena* arena, CreateAppRequest&& from) noexcept
-      : CreateAppRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppNameFieldNumber = 2,
-    kAppCodeFieldNumber = 3,
-    kDescriptionFieldNumber = 4,
-  };
-  // string app_name = 2;
-  void clear_app_name() ;
-  const std::string& app_name() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_name(Arg_&& arg, Args_... args);
-  std::string* mutable_app_name();
-  PROTOBUF_NODISCARD std::string* release_app_name();
-  void set_allocated_app_name(std::string* value);
-
-  private:
-  const std::string& _internal_app_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_name(
-      const std::string& value);
-  std::string* _internal_mutable_app_name();
-
-  public:
-  // string app_code = 3;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // string description = 4;
-  void clear_description() ;
-  const std::string& description() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_description(Arg_&& arg, Args_... args);
-  std::string* mutable_description();
-  PROTOBUF_NODISCARD std::string* release_description();
-  void set_allocated_description(std::string* value);
-
-  private:
-  const std::string& _internal_description() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_description(
-      const std::string& value);
-  std::string* _internal_mutable_description();
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.CreateAppRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 3, 0,
-      62, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const CreateAppRequest& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr app_name_;
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::ArenaStringPtr description_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class CheckResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.CheckResponse) */ {
- public:
-  inline CheckResponse() : CheckResponse(nullptr) {}
-  ~CheckResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(CheckResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(CheckResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR CheckResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline CheckResponse(const CheckResponse& from) : CheckResponse(nullptr, from) {}
-  inline CheckResponse(CheckResponse&& from) noexcept
-      : CheckResponse(nullptr, std::move(from)) {}
-  inline CheckResponse& operator=(const CheckResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline CheckResponse& operator=(CheckResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const CheckResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const CheckResponse* internal_default_instance() {
-    return reinterpret_cast<const CheckResponse*>(
-        &_CheckResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 1;
-  friend void swap(CheckResponse& a, CheckResponse& b) { a.Swap(&b); }
-  inline void Swap(CheckResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(CheckResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  CheckResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<CheckResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const CheckResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const CheckResponse& from) { CheckResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(CheckResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.CheckResponse"; }
-
- protected:
-  explicit CheckResponse(::google::protobuf::Arena* arena);
-  CheckResponse(::google::protobuf::Arena* arena, const CheckResponse& from);
-  CheckResponse(::google::protobuf::Arena* arena, CheckResponse&& from) noexcept
-      : CheckResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kReasonFieldNumber = 2,
-    kCurrentRolesFieldNumber = 3,
-    kSuggestRolesFieldNumber = 4,
-    kAllowedFieldNumber = 1,
-  };
-  // string reason = 2;
-  void clear_reason() ;
-  const std::string& reason() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_reason(Arg_&& arg, Args_... args);
-  std::string* mutable_reason();
-  PROTOBUF_NODISCARD std::string* release_reason();
-  void set_allocated_reason(std::string* value);
-
-  private:
-  const std::string& _internal_reason() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reason(
-      const std::string& value);
-  std::string* _internal_mutable_reason();
-
-  public:
-  // string current_roles = 3;
-  void clear_current_roles() ;
-  const std::string& current_roles() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_current_roles(Arg_&& arg, Args_... args);
-  std::string* mutable_current_roles();
-  PROTOBUF_NODISCARD std::string* release_current_roles();
-  void set_allocated_current_roles(std::string* value);
-
-  private:
-  const std::string& _internal_current_roles() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_current_roles(
-      const std::string& value);
-  std::string* _internal_mutable_current_roles();
-
-  public:
-  // string suggest_roles = 4;
-  void clear_suggest_roles() ;
-  const std::string& suggest_roles() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_suggest_roles(Arg_&& arg, Args_... args);
-  std::string* mutable_suggest_roles();
-  PROTOBUF_NODISCARD std::string* release_suggest_roles();
-  void set_allocated_suggest_roles(std::string* value);
-
-  private:
-  const std::string& _internal_suggest_roles() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_suggest_roles(
-      const std::string& value);
-  std::string* _internal_mutable_suggest_roles();
-
-  public:
-  // optional bool allowed = 1;
-  bool has_allowed() const;
-  void clear_allowed() ;
-  bool allowed() const;
-  void set_allowed(bool value);
-
-  private:
-  bool _internal_allowed() const;
-  void _internal_set_allowed(bool value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.CheckResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 4, 0,
-      64, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const CheckResponse& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr reason_;
-    ::google::protobuf::internal::ArenaStringPtr current_roles_;
-    ::google::protobuf::internal::ArenaStringPtr suggest_roles_;
-    bool allowed_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class CheckRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.CheckRequest) */ {
- public:
-  inline CheckRequest() : CheckRequest(nullptr) {}
-  ~CheckRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(CheckRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(CheckRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR CheckRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline CheckRequest(const CheckRequest& from) : CheckRequest(nullptr, from) {}
-  inline CheckRequest(CheckRequest&& from) noexcept
-      : CheckRequest(nullptr, std::move(from)) {}
-  inline CheckRequest& operator=(const CheckRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline CheckRequest& operator=(CheckRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const CheckRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const CheckRequest* internal_default_instance() {
-    return reinterpret_cast<const CheckRequest*>(
-        &_CheckRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 0;
-  friend void swap(CheckRequest& a, CheckRequest& b) { a.Swap(&b); }
-  inline void Swap(CheckRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(CheckRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  CheckRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<CheckRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const CheckRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const CheckRequest& from) { CheckRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(CheckRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.CheckRequest"; }
-
- protected:
-  explicit CheckRequest(::google::protobuf::Arena* arena);
-  CheckRequest(::google::protobuf::Arena* arena, const CheckRequest& from);
-  CheckRequest(::google::protobuf::Arena* arena, CheckRequest&& from) noexcept
-      : CheckRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppCodeFieldNumber = 1,
-    kUserIdFieldNumber = 2,
-    kPermKeyFieldNumber = 3,
-    kResourceIdFieldNumber = 4,
-  };
-  // string app_code = 1;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // string user_id = 2;
-  void clear_user_id() ;
-  const std::string& user_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_user_id(Arg_&& arg, Args_... args);
-  std::string* mutable_user_id();
-  PROTOBUF_NODISCARD std::string* release_user_id();
-  void set_allocated_user_id(std::string* value);
-
-  private:
-  const std::string& _internal_user_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_id(
-      const std::string& value);
-  std::string* _internal_mutable_user_id();
-
-  public:
-  // string perm_key = 3;
-  void clear_perm_key() ;
-  const std::string& perm_key() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_perm_key(Arg_&& arg, Args_... args);
-  std::string* mutable_perm_key();
-  PROTOBUF_NODISCARD std::string* release_perm_key();
-  void set_allocated_perm_key(std::string* value);
-
-  private:
-  const std::string& _internal_perm_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_perm_key(
-      const std::string& value);
-  std::string* _internal_mutable_perm_key();
-
-  public:
-  // string resource_id = 4;
-  void clear_resource_id() ;
-  const std::string& resource_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_resource_id(Arg_&& arg, Args_... args);
-  std::string* mutable_resource_id();
-  PROTOBUF_NODISCARD std::string* release_resource_id();
-  void set_allocated_resource_id(std::string* value);
-
-  private:
-  const std::string& _internal_resource_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_resource_id(
-      const std::string& value);
-  std::string* _internal_mutable_resource_id();
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.CheckRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 4, 0,
-      65, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const CheckRequest& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::ArenaStringPtr user_id_;
-    ::google::protobuf::internal::ArenaStringPtr perm_key_;
-    ::google::protobuf::internal::ArenaStringPtr resource_id_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class BatchCheckResponse_ResultItem final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.BatchCheckResponse.ResultItem) */ {
- public:
-  inline BatchCheckResponse_ResultItem() : BatchCheckResponse_ResultItem(nullptr) {}
-  ~BatchCheckResponse_ResultItem() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(BatchCheckResponse_ResultItem* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(BatchCheckResponse_ResultItem));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR BatchCheckResponse_ResultItem(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline BatchCheckResponse_ResultItem(const BatchCheckResponse_ResultItem& from) : BatchCheckResponse_ResultItem(nullptr, from) {}
-  inline BatchCheckResponse_ResultItem(BatchCheckResponse_ResultItem&& from) noexcept
-      : BatchCheckResponse_ResultItem(nullptr, std::move(from)) {}
-  inline BatchCheckResponse_ResultItem& operator=(const BatchCheckResponse_ResultItem& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline BatchCheckResponse_ResultItem& operator=(BatchCheckResponse_ResultItem&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const BatchCheckResponse_ResultItem& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const BatchCheckResponse_ResultItem* internal_default_instance() {
-    return reinterpret_cast<const BatchCheckResponse_ResultItem*>(
-        &_BatchCheckResponse_ResultItem_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 4;
-  friend void swap(BatchCheckResponse_ResultItem& a, BatchCheckResponse_ResultItem& b) { a.Swap(&b); }
-  inline void Swap(BatchCheckResponse_ResultItem* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(BatchCheckResponse_ResultItem* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  BatchCheckResponse_ResultItem* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<BatchCheckResponse_ResultItem>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const BatchCheckResponse_ResultItem& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const BatchCheckResponse_ResultItem& from) { BatchCheckResponse_ResultItem::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(BatchCheckResponse_ResultItem* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.BatchCheckResponse.ResultItem"; }
-
- protected:
-  explicit BatchCheckResponse_ResultItem(::google::protobuf::Arena* arena);
-  BatchCheckResponse_ResultItem(::google::protobuf::Arena* arena, const BatchCheckResponse_ResultItem& from);
-  BatchCheckResponse_ResultItem(::google::protobuf::Arena* arena, BatchCheckResponse_ResultItem&& from) noexcept
-      : BatchCheckResponse_ResultItem(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kUserIdFieldNumber = 1,
-    kPermKeyFieldNumber = 2,
-    kReasonFieldNumber = 4,
-    kAllowedFieldNumber = 3,
-  };
-  // string user_id = 1;
-  void clear_user_id() ;
-  const std::string& user_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_user_id(Arg_&& arg, Args_... args);
-  std::string* mutable_user_id();
-  PROTOBUF_NODISCARD std::string* release_user_id();
-  void set_allocated_user_id(std::string* value);
-
-  private:
-  const std::string& _internal_user_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_id(
-      const std::string& value);
-  std::string* _internal_mutable_user_id();
-
-  public:
-  // string perm_key = 2;
-  void clear_perm_key() ;
-  const std::string& perm_key() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_perm_key(Arg_&& arg, Args_... args);
-  std::string* mutable_perm_key();
-  PROTOBUF_NODISCARD std::string* release_perm_key();
-  void set_allocated_perm_key(std::string* value);
-
-  private:
-  const std::string& _internal_perm_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_perm_key(
-      const std::string& value);
-  std::string* _internal_mutable_perm_key();
-
-  public:
-  // string reason = 4;
-  void clear_reason() ;
-  const std::string& reason() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_reason(Arg_&& arg, Args_... args);
-  std::string* mutable_reason();
-  PROTOBUF_NODISCARD std::string* release_reason();
-  void set_allocated_reason(std::string* value);
-
-  private:
-  const std::string& _internal_reason() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reason(
-      const std::string& value);
-  std::string* _internal_mutable_reason();
-
-  public:
-  // optional bool allowed = 3;
-  bool has_allowed() const;
-  void clear_allowed() ;
-  bool allowed() const;
-  void set_allowed(bool value);
-
-  private:
-  bool _internal_allowed() const;
-  void _internal_set_allowed(bool value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.BatchCheckResponse.ResultItem)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 4, 0,
-      69, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const BatchCheckResponse_ResultItem& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr user_id_;
-    ::google::protobuf::internal::ArenaStringPtr perm_key_;
-    ::google::protobuf::internal::ArenaStringPtr reason_;
-    bool allowed_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class BatchCheckRequest_CheckItem final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.BatchCheckRequest.CheckItem) */ {
- public:
-  inline BatchCheckRequest_CheckItem() : BatchCheckRequest_CheckItem(nullptr) {}
-  ~BatchCheckRequest_CheckItem() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(BatchCheckRequest_CheckItem* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(BatchCheckRequest_CheckItem));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR BatchCheckRequest_CheckItem(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline BatchCheckRequest_CheckItem(const BatchCheckRequest_CheckItem& from) : BatchCheckRequest_CheckItem(nullptr, from) {}
-  inline BatchCheckRequest_CheckItem(BatchCheckRequest_CheckItem&& from) noexcept
-      : BatchCheckRequest_CheckItem(nullptr, std::move(from)) {}
-  inline BatchCheckRequest_CheckItem& operator=(const BatchCheckRequest_CheckItem& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline BatchCheckRequest_CheckItem& operator=(BatchCheckRequest_CheckItem&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const BatchCheckRequest_CheckItem& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const BatchCheckRequest_CheckItem* internal_default_instance() {
-    return reinterpret_cast<const BatchCheckRequest_CheckItem*>(
-        &_BatchCheckRequest_CheckItem_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 2;
-  friend void swap(BatchCheckRequest_CheckItem& a, BatchCheckRequest_CheckItem& b) { a.Swap(&b); }
-  inline void Swap(BatchCheckRequest_CheckItem* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(BatchCheckRequest_CheckItem* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  BatchCheckRequest_CheckItem* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<BatchCheckRequest_CheckItem>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const BatchCheckRequest_CheckItem& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const BatchCheckRequest_CheckItem& from) { BatchCheckRequest_CheckItem::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(BatchCheckRequest_CheckItem* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.BatchCheckRequest.CheckItem"; }
-
- protected:
-  explicit BatchCheckRequest_CheckItem(::google::protobuf::Arena* arena);
-  BatchCheckRequest_CheckItem(::google::protobuf::Arena* arena, const BatchCheckRequest_CheckItem& from);
-  BatchCheckRequest_CheckItem(::google::protobuf::Arena* arena, BatchCheckRequest_CheckItem&& from) noexcept
-      : BatchCheckRequest_CheckItem(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kUserIdFieldNumber = 1,
-    kPermKeyFieldNumber = 2,
-    kResourceIdFieldNumber = 3,
-  };
-  // string user_id = 1;
-  void clear_user_id() ;
-  const std::string& user_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_user_id(Arg_&& arg, Args_... args);
-  std::string* mutable_user_id();
-  PROTOBUF_NODISCARD std::string* release_user_id();
-  void set_allocated_user_id(std::string* value);
-
-  private:
-  const std::string& _internal_user_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_id(
-      const std::string& value);
-  std::string* _internal_mutable_user_id();
-
-  public:
-  // string perm_key = 2;
-  void clear_perm_key() ;
-  const std::string& perm_key() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_perm_key(Arg_&& arg, Args_... args);
-  std::string* mutable_perm_key();
-  PROTOBUF_NODISCARD std::string* release_perm_key();
-  void set_allocated_perm_key(std::string* value);
-
-  private:
-  const std::string& _internal_perm_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_perm_key(
-      const std::string& value);
-  std::string* _internal_mutable_perm_key();
-
-  public:
-  // string resource_id = 3;
-  void clear_resource_id() ;
-  const std::string& resource_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_resource_id(Arg_&& arg, Args_... args);
-  std::string* mutable_resource_id();
-  PROTOBUF_NODISCARD std::string* release_resource_id();
-  void set_allocated_resource_id(std::string* value);
-
-  private:
-  const std::string& _internal_resource_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_resource_id(
-      const std::string& value);
-  std::string* _internal_mutable_resource_id();
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.BatchCheckRequest.CheckItem)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 3, 0,
-      72, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const BatchCheckRequest_CheckItem& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr user_id_;
-    ::google::protobuf::internal::ArenaStringPtr perm_key_;
-    ::google::protobuf::internal::ArenaStringPtr resource_id_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class AdminResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.AdminResponse) */ {
- public:
-  inline AdminResponse() : AdminResponse(nullptr) {}
-  ~AdminResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(AdminResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(AdminResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR AdminResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline AdminResponse(const AdminResponse& from) : AdminResponse(nullptr, from) {}
-  inline AdminResponse(AdminResponse&& from) noexcept
-      : AdminResponse(nullptr, std::move(from)) {}
-  inline AdminResponse& operator=(const AdminResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline AdminResponse& operator=(AdminResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const AdminResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const AdminResponse* internal_default_instance() {
-    return reinterpret_cast<const AdminResponse*>(
-        &_AdminResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 41;
-  friend void swap(AdminResponse& a, AdminResponse& b) { a.Swap(&b); }
-  inline void Swap(AdminResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(AdminResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  AdminResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<AdminResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const AdminResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const AdminResponse& from) { AdminResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(AdminResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.AdminResponse"; }
-
- protected:
-  explicit AdminResponse(::google::protobuf::Arena* arena);
-  AdminResponse(::google::protobuf::Arena* arena, const AdminResponse& from);
-  AdminResponse(::google::protobuf::Arena* arena, AdminResponse&& from) noexcept
-      : AdminResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kMessageFieldNumber = 3,
-    kAppSecretFieldNumber = 4,
-    kSuccessFieldNumber = 1,
-    kCodeFieldNumber = 2,
-  };
-  // string message = 3;
-  void clear_message() ;
-  const std::string& message() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_message(Arg_&& arg, Args_... args);
-  std::string* mutable_message();
-  PROTOBUF_NODISCARD std::string* release_message();
-  void set_allocated_message(std::string* value);
-
-  private:
-  const std::string& _internal_message() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(
-      const std::string& value);
-  std::string* _internal_mutable_message();
-
-  public:
-  // optional string app_secret = 4;
-  bool has_app_secret() const;
-  void clear_app_secret() ;
-  const std::string& app_secret() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_secret(Arg_&& arg, Args_... args);
-  std::string* mutable_app_secret();
-  PROTOBUF_NODISCARD std::string* release_app_secret();
-  void set_allocated_app_secret(std::string* value);
-
-  private:
-  const std::string& _internal_app_secret() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_secret(
-      const std::string& value);
-  std::string* _internal_mutable_app_secret();
-
-  public:
-  // bool success = 1;
-  void clear_success() ;
-  bool success() const;
-  void set_success(bool value);
-
-  private:
-  bool _internal_success() const;
-  void _internal_set_success(bool value);
-
-  public:
-  // int32 code = 2;
-  void clear_code() ;
-  ::int32_t code() const;
-  void set_code(::int32_t value);
-
-  private:
-  ::int32_t _internal_code() const;
-  void _internal_set_code(::int32_t value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.AdminResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 4, 0,
-      49, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const AdminResponse& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr message_;
-    ::google::protobuf::internal::ArenaStringPtr app_secret_;
-    bool success_;
-    ::int32_t code_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class AddPermissionToRoleRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.AddPermissionToRoleRequest) */ {
- public:
-  inline AddPermissionToRoleRequest() : AddPermissionToRoleRequest(nullptr) {}
-  ~AddPermissionToRoleRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(AddPermissionToRoleRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(AddPermissionToRoleRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR AddPermissionToRoleRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline AddPermissionToRoleRequest(const AddPermissionToRoleRequest& from) : AddPermissionToRoleRequest(nullptr, from) {}
-  inline AddPermissionToRoleRequest(AddPermissionToRoleRequest&& from) noexcept
-      : AddPermissionToRoleRequest(nullptr, std::move(from)) {}
-  inline AddPermissionToRoleRequest& operator=(const AddPermissionToRoleRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline AddPermissionToRoleRequest& operator=(AddPermissionToRoleRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const AddPermissionToRoleRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const AddPermissionToRoleRequest* internal_default_instance() {
-    return reinterpret_cast<const AddPermissionToRoleRequest*>(
-        &_AddPermissionToRoleRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 29;
-  friend void swap(AddPermissionToRoleRequest& a, AddPermissionToRoleRequest& b) { a.Swap(&b); }
-  inline void Swap(AddPermissionToRoleRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(AddPermissionToRoleRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  AddPermissionToRoleRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<AddPermissionToRoleRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const AddPermissionToRoleRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const AddPermissionToRoleRequest& from) { AddPermissionToRoleRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(AddPermissionToRoleRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.AddPermissionToRoleRequest"; }
-
- protected:
-  explicit AddPermissionToRoleRequest(::google::protobuf::Arena* arena);
-  AddPermissionToRoleRequest(::google::protobuf::Arena* arena, const AddPermissionToRoleRequest& from);
-  AddPermissionToRoleRequest(::google::protobuf::Arena* arena, AddPermissionToRoleRequest&& from) noexcept
-      : AddPermissionToRoleRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppCodeFieldNumber = 2,
-    kRoleKeyFieldNumber = 3,
-    kPermKeyFieldNumber = 4,
-  };
-  // string app_code = 2;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // string role_key = 3;
-  void clear_role_key() ;
-  const std::string& role_key() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_role_key(Arg_&& arg, Args_... args);
-  std::string* mutable_role_key();
-  PROTOBUF_NODISCARD std::string* release_role_key();
-  void set_allocated_role_key(std::string* value);
-
-  private:
-  const std::string& _internal_role_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_role_key(
-      const std::string& value);
-  std::string* _internal_mutable_role_key();
-
-  public:
-  // string perm_key = 4;
-  void clear_perm_key() ;
-  const std::string& perm_key() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_perm_key(Arg_&& arg, Args_... args);
-  std::string* mutable_perm_key();
-  PROTOBUF_NODISCARD std::string* release_perm_key();
-  void set_allocated_perm_key(std::string* value);
-
-  private:
-  const std::string& _internal_perm_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_perm_key(
-      const std::string& value);
-  std::string* _internal_mutable_perm_key();
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.AddPermissionToRoleRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 3, 0,
-      69, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const AddPermissionToRoleRequest& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::ArenaStringPtr role_key_;
-    ::google::protobuf::internal::ArenaStringPtr perm_key_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ListUserRolesResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.ListUserRolesResponse) */ {
- public:
-  inline ListUserRolesResponse() : ListUserRolesResponse(nullptr) {}
-  ~ListUserRolesResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ListUserRolesResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ListUserRolesResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ListUserRolesResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline ListUserRolesResponse(const ListUserRolesResponse& from) : ListUserRolesResponse(nullptr, from) {}
-  inline ListUserRolesResponse(ListUserRolesResponse&& from) noexcept
-      : ListUserRolesResponse(nullptr, std::move(from)) {}
-  inline ListUserRolesResponse& operator=(const ListUserRolesResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ListUserRolesResponse& operator=(ListUserRolesResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const ListUserRolesResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const ListUserRolesResponse* internal_default_instance() {
-    return reinterpret_cast<const ListUserRolesResponse*>(
-        &_ListUserRolesResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 46;
-  friend void swap(ListUserRolesResponse& a, ListUserRolesResponse& b) { a.Swap(&b); }
-  inline void Swap(ListUserRolesResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(ListUserRolesResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  ListUserRolesResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ListUserRolesResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ListUserRolesResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ListUserRolesResponse& from) { ListUserRolesResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(ListUserRolesResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.ListUserRolesResponse"; }
-
- protected:
-  explicit ListUserRolesResponse(::google::protobuf::Arena* arena);
-  ListUserRolesResponse(::google::protobuf::Arena* arena, const ListUserRolesResponse& from);
-  ListUserRolesResponse(::google::protobuf::Arena* arena, ListUserRolesResponse&& from) noexcept
-      : ListUserRolesResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-  using UserRoleInfo = ListUserRolesResponse_UserRoleInfo;
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kUsersFieldNumber = 1,
-    kTotalFieldNumber = 2,
-    kPageFieldNumber = 3,
-    kPageSizeFieldNumber = 4,
-  };
-  // repeated .siqi.auth.ListUserRolesResponse.UserRoleInfo users = 1;
-  int users_size() const;
-  private:
-  int _internal_users_size() const;
-
-  public:
-  void clear_users() ;
-  ::siqi::auth::ListUserRolesResponse_UserRoleInfo* mutable_users(int index);
-  ::google::protobuf::RepeatedPtrField<::siqi::auth::ListUserRolesResponse_UserRoleInfo>* mutable_users();
-
-  private:
-  const ::google::protobuf::RepeatedPtrField<::siqi::auth::ListUserRolesResponse_UserRoleInfo>& _internal_users() const;
-  ::google::protobuf::RepeatedPtrField<::siqi::auth::ListUserRolesResponse_UserRoleInfo>* _internal_mutable_users();
-  public:
-  const ::siqi::auth::ListUserRolesResponse_UserRoleInfo& users(int index) const;
-  ::siqi::auth::ListUserRolesResponse_UserRoleInfo* add_users();
-  const ::google::protobuf::RepeatedPtrField<::siqi::auth::ListUserRolesResponse_UserRoleInfo>& users() const;
-  // int64 total = 2;
-  void clear_total() ;
-  ::int64_t total() const;
-  void set_total(::int64_t value);
-
-  private:
-  ::int64_t _internal_total() const;
-  void _internal_set_total(::int64_t value);
-
-  public:
-  // int32 page = 3;
-  void clear_page() ;
-  ::int32_t page() const;
-  void set_page(::int32_t value);
-
-  private:
-  ::int32_t _internal_page() const;
-  void _internal_set_page(::int32_t value);
-
-  public:
-  // int32 page_size = 4;
-  void clear_page_size() ;
-  ::int32_t page_size() const;
-  void set_page_size(::int32_t value);
-
-  private:
-  ::int32_t _internal_page_size() const;
-  void _internal_set_page_size(::int32_t value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.ListUserRolesResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 4, 1,
-      0, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const ListUserRolesResponse& from_msg);
-    ::google::protobuf::RepeatedPtrField< ::siqi::auth::ListUserRolesResponse_UserRoleInfo > users_;
-    ::int64_t total_;
-    ::int32_t page_;
-    ::int32_t page_size_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ListRolesResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.ListRolesResponse) */ {
- public:
-  inline ListRolesResponse() : ListRolesResponse(nullptr) {}
-  ~ListRolesResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ListRolesResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ListRolesResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ListRolesResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline ListRolesResponse(const ListRolesResponse& from) : ListRolesResponse(nullptr, from) {}
-  inline ListRolesResponse(ListRolesResponse&& from) noexcept
-      : ListRolesResponse(nullptr, std::move(from)) {}
-  inline ListRolesResponse& operator=(const ListRolesResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ListRolesResponse& operator=(ListRolesResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const ListRolesResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const ListRolesResponse* internal_default_instance() {
-    return reinterpret_cast<const ListRolesResponse*>(
-        &_ListRolesResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 28;
-  friend void swap(ListRolesResponse& a, ListRolesResponse& b) { a.Swap(&b); }
-  inline void Swap(ListRolesResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(ListRolesResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  ListRolesResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ListRolesResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ListRolesResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ListRolesResponse& from) { ListRolesResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(ListRolesResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.ListRolesResponse"; }
-
- protected:
-  explicit ListRolesResponse(::google::protobuf::Arena* arena);
-  ListRolesResponse(::google::protobuf::Arena* arena, const ListRolesResponse& from);
-  ListRolesResponse(::google::protobuf::Arena* arena, ListRolesResponse&& from) noexcept
-      : ListRolesResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-  using Role = ListRolesResponse_Role;
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kRolesFieldNumber = 1,
-    kTotalFieldNumber = 2,
-    kPageFieldNumber = 3,
-    kPageSizeFieldNumber = 4,
-  };
-  // repeated .siqi.auth.ListRolesResponse.Role roles = 1;
-  int roles_size() const;
-  private:
-  int _internal_roles_size() const;
-
-  public:
-  void clear_roles() ;
-  ::siqi::auth::ListRolesResponse_Role* mutable_roles(int index);
-  ::google::protobuf::RepeatedPtrField<::siqi::auth::ListRolesResponse_Role>* mutable_roles();
-
-  private:
-  const ::google::protobuf::RepeatedPtrField<::siqi::auth::ListRolesResponse_Role>& _internal_roles() const;
-  ::google::protobuf::RepeatedPtrField<::siqi::auth::ListRolesResponse_Role>* _internal_mutable_roles();
-  public:
-  const ::siqi::auth::ListRolesResponse_Role& roles(int index) const;
-  ::siqi::auth::ListRolesResponse_Role* add_roles();
-  const ::google::protobuf::RepeatedPtrField<::siqi::auth::ListRolesResponse_Role>& roles() const;
-  // int64 total = 2;
-  void clear_total() ;
-  ::int64_t total() const;
-  void set_total(::int64_t value);
-
-  private:
-  ::int64_t _internal_total() const;
-  void _internal_set_total(::int64_t value);
-
-  public:
-  // int32 page = 3;
-  void clear_page() ;
-  ::int32_t page() const;
-  void set_page(::int32_t value);
-
-  private:
-  ::int32_t _internal_page() const;
-  void _internal_set_page(::int32_t value);
-
-  public:
-  // int32 page_size = 4;
-  void clear_page_size() ;
-  ::int32_t page_size() const;
-  void set_page_size(::int32_t value);
-
-  private:
-  ::int32_t _internal_page_size() const;
-  void _internal_set_page_size(::int32_t value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.ListRolesResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 4, 1,
-      0, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const ListRolesResponse& from_msg);
-    ::google::protobuf::RepeatedPtrField< ::siqi::auth::ListRolesResponse_Role > roles_;
-    ::int64_t total_;
-    ::int32_t page_;
-    ::int32_t page_size_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ListPermissionsResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.ListPermissionsResponse) */ {
- public:
-  inline ListPermissionsResponse() : ListPermissionsResponse(nullptr) {}
-  ~ListPermissionsResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ListPermissionsResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ListPermissionsResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ListPermissionsResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline ListPermissionsResponse(const ListPermissionsResponse& from) : ListPermissionsResponse(nullptr, from) {}
-  inline ListPermissionsResponse(ListPermissionsResponse&& from) noexcept
-      : ListPermissionsResponse(nullptr, std::move(from)) {}
-  inline ListPermissionsResponse& operator=(const ListPermissionsResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ListPermissionsResponse& operator=(ListPermissionsResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const ListPermissionsResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const ListPermissionsResponse* internal_default_instance() {
-    return reinterpret_cast<const ListPermissionsResponse*>(
-        &_ListPermissionsResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 22;
-  friend void swap(ListPermissionsResponse& a, ListPermissionsResponse& b) { a.Swap(&b); }
-  inline void Swap(ListPermissionsResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(ListPermissionsResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  ListPermissionsResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ListPermissionsResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ListPermissionsResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ListPermissionsResponse& from) { ListPermissionsResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(ListPermissionsResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.ListPermissionsResponse"; }
-
- protected:
-  explicit ListPermissionsResponse(::google::protobuf::Arena* arena);
-  ListPermissionsResponse(::google::protobuf::Arena* arena, const ListPermissionsResponse& from);
-  ListPermissionsResponse(::google::protobuf::Arena* arena, ListPermissionsResponse&& from) noexcept
-      : ListPermissionsResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-  using Permission = ListPermissionsResponse_Permission;
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kPermissionsFieldNumber = 1,
-    kTotalFieldNumber = 2,
-    kPageFieldNumber = 3,
-    kPageSizeFieldNumber = 4,
-  };
-  // repeated .siqi.auth.ListPermissionsResponse.Permission permissions = 1;
-  int permissions_size() const;
-  private:
-  int _internal_permissions_size() const;
-
-  public:
-  void clear_permissions() ;
-  ::siqi::auth::ListPermissionsResponse_Permission* mutable_permissions(int index);
-  ::google::protobuf::RepeatedPtrField<::siqi::auth::ListPermissionsResponse_Permission>* mutable_permissions();
-
-  private:
-  const ::google::protobuf::RepeatedPtrField<::siqi::auth::ListPermissionsResponse_Permission>& _internal_permissions() const;
-  ::google::protobuf::RepeatedPtrField<::siqi::auth::ListPermissionsResponse_Permission>* _internal_mutable_permissions();
-  public:
-  const ::siqi::auth::ListPermissionsResponse_Permission& permissions(int index) const;
-  ::siqi::auth::ListPermissionsResponse_Permission* add_permissions();
-  const ::google::protobuf::RepeatedPtrField<::siqi::auth::ListPermissionsResponse_Permission>& permissions() const;
-  // int64 total = 2;
-  void clear_total() ;
-  ::int64_t total() const;
-  void set_total(::int64_t value);
-
-  private:
-  ::int64_t _internal_total() const;
-  void _internal_set_total(::int64_t value);
-
-  public:
-  // int32 page = 3;
-  void clear_page() ;
-  ::int32_t page() const;
-  void set_page(::int32_t value);
-
-  private:
-  ::int32_t _internal_page() const;
-  void _internal_set_page(::int32_t value);
-
-  public:
-  // int32 page_size = 4;
-  void clear_page_size() ;
-  ::int32_t page_size() const;
-  void set_page_size(::int32_t value);
-
-  private:
-  ::int32_t _internal_page_size() const;
-  void _internal_set_page_size(::int32_t value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.ListPermissionsResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 4, 1,
-      0, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const ListPermissionsResponse& from_msg);
-    ::google::protobuf::RepeatedPtrField< ::siqi::auth::ListPermissionsResponse_Permission > permissions_;
-    ::int64_t total_;
-    ::int32_t page_;
-    ::int32_t page_size_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ListAuditLogsResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.ListAuditLogsResponse) */ {
- public:
-  inline ListAuditLogsResponse() : ListAuditLogsResponse(nullptr) {}
-  ~ListAuditLogsResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ListAuditLogsResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ListAuditLogsResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ListAuditLogsResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline ListAuditLogsResponse(const ListAuditLogsResponse& from) : ListAuditLogsResponse(nullptr, from) {}
-  inline ListAuditLogsResponse(ListAuditLogsResponse&& from) noexcept
-      : ListAuditLogsResponse(nullptr, std::move(from)) {}
-  inline ListAuditLogsResponse& operator=(const ListAuditLogsResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ListAuditLogsResponse& operator=(ListAuditLogsResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const ListAuditLogsResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const ListAuditLogsResponse* internal_default_instance() {
-    return reinterpret_cast<const ListAuditLogsResponse*>(
-        &_ListAuditLogsResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 40;
-  friend void swap(ListAuditLogsResponse& a, ListAuditLogsResponse& b) { a.Swap(&b); }
-  inline void Swap(ListAuditLogsResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(ListAuditLogsResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  ListAuditLogsResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ListAuditLogsResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ListAuditLogsResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ListAuditLogsResponse& from) { ListAuditLogsResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(ListAuditLogsResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.ListAuditLogsResponse"; }
-
- protected:
-  explicit ListAuditLogsResponse(::google::protobuf::Arena* arena);
-  ListAuditLogsResponse(::google::protobuf::Arena* arena, const ListAuditLogsResponse& from);
-  ListAuditLogsResponse(::google::protobuf::Arena* arena, ListAuditLogsResponse&& from) noexcept
-      : ListAuditLogsResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-  using AuditLog = ListAuditLogsResponse_AuditLog;
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kLogsFieldNumber = 1,
-    kTotalFieldNumber = 2,
-    kPageFieldNumber = 3,
-    kPageSizeFieldNumber = 4,
-  };
-  // repeated .siqi.auth.ListAuditLogsResponse.AuditLog logs = 1;
-  int logs_size() const;
-  private:
-  int _internal_logs_size() const;
-
-  public:
-  void clear_logs() ;
-  ::siqi::auth::ListAuditLogsResponse_AuditLog* mutable_logs(int index);
-  ::google::protobuf::RepeatedPtrField<::siqi::auth::ListAuditLogsResponse_AuditLog>* mutable_logs();
-
-  private:
-  const ::google::protobuf::RepeatedPtrField<::siqi::auth::ListAuditLogsResponse_AuditLog>& _internal_logs() const;
-  ::google::protobuf::RepeatedPtrField<::siqi::auth::ListAuditLogsResponse_AuditLog>* _internal_mutable_logs();
-  public:
-  const ::siqi::auth::ListAuditLogsResponse_AuditLog& logs(int index) const;
-  ::siqi::auth::ListAuditLogsResponse_AuditLog* add_logs();
-  const ::google::protobuf::RepeatedPtrField<::siqi::auth::ListAuditLogsResponse_AuditLog>& logs() const;
-  // int64 total = 2;
-  void clear_total() ;
-  ::int64_t total() const;
-  void set_total(::int64_t value);
-
-  private:
-  ::int64_t _internal_total() const;
-  void _internal_set_total(::int64_t value);
-
-  public:
-  // int32 page = 3;
-  void clear_page() ;
-  ::int32_t page() const;
-  void set_page(::int32_t value);
-
-  private:
-  ::int32_t _internal_page() const;
-  void _internal_set_page(::int32_t value);
-
-  public:
-  // int32 page_size = 4;
-  void clear_page_size() ;
-  ::int32_t page_size() const;
-  void set_page_size(::int32_t value);
-
-  private:
-  ::int32_t _internal_page_size() const;
-  void _internal_set_page_size(::int32_t value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.ListAuditLogsResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 4, 1,
-      0, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const ListAuditLogsResponse& from_msg);
-    ::google::protobuf::RepeatedPtrField< ::siqi::auth::ListAuditLogsResponse_AuditLog > logs_;
-    ::int64_t total_;
-    ::int32_t page_;
-    ::int32_t page_size_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ListAppsResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.ListAppsResponse) */ {
- public:
-  inline ListAppsResponse() : ListAppsResponse(nullptr) {}
-  ~ListAppsResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ListAppsResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ListAppsResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ListAppsResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline ListAppsResponse(const ListAppsResponse& from) : ListAppsResponse(nullptr, from) {}
-  inline ListAppsResponse(ListAppsResponse&& from) noexcept
-      : ListAppsResponse(nullptr, std::move(from)) {}
-  inline ListAppsResponse& operator=(const ListAppsResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ListAppsResponse& operator=(ListAppsResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const ListAppsResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const ListAppsResponse* internal_default_instance() {
-    return reinterpret_cast<const ListAppsResponse*>(
-        &_ListAppsResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 16;
-  friend void swap(ListAppsResponse& a, ListAppsResponse& b) { a.Swap(&b); }
-  inline void Swap(ListAppsResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(ListAppsResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  ListAppsResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ListAppsResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ListAppsResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ListAppsResponse& from) { ListAppsResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(ListAppsResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.ListAppsResponse"; }
-
- protected:
-  explicit ListAppsResponse(::google::protobuf::Arena* arena);
-  ListAppsResponse(::google::protobuf::Arena* arena, const ListAppsResponse& from);
-  ListAppsResponse(::google::protobuf::Arena* arena, ListAppsResponse&& from) noexcept
-      : ListAppsResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAppsFieldNumber = 1,
-    kTotalFieldNumber = 2,
-    kPageFieldNumber = 3,
-    kPageSizeFieldNumber = 4,
-  };
-  // repeated .siqi.auth.GetAppResponse apps = 1;
-  int apps_size() const;
-  private:
-  int _internal_apps_size() const;
-
-  public:
-  void clear_apps() ;
-  ::siqi::auth::GetAppResponse* mutable_apps(int index);
-  ::google::protobuf::RepeatedPtrField<::siqi::auth::GetAppResponse>* mutable_apps();
-
-  private:
-  const ::google::protobuf::RepeatedPtrField<::siqi::auth::GetAppResponse>& _internal_apps() const;
-  ::google::protobuf::RepeatedPtrField<::siqi::auth::GetAppResponse>* _internal_mutable_apps();
-  public:
-  const ::siqi::auth::GetAppResponse& apps(int index) const;
-  ::siqi::auth::GetAppResponse* add_apps();
-  const ::google::protobuf::RepeatedPtrField<::siqi::auth::GetAppResponse>& apps() const;
-  // int64 total = 2;
-  void clear_total() ;
-  ::int64_t total() const;
-  void set_total(::int64_t value);
-
-  private:
-  ::int64_t _internal_total() const;
-  void _internal_set_total(::int64_t value);
-
-  public:
-  // int32 page = 3;
-  void clear_page() ;
-  ::int32_t page() const;
-  void set_page(::int32_t value);
-
-  private:
-  ::int32_t _internal_page() const;
-  void _internal_set_page(::int32_t value);
-
-  public:
-  // int32 page_size = 4;
-  void clear_page_size() ;
-  ::int32_t page_size() const;
-  void set_page_size(::int32_t value);
-
-  private:
-  ::int32_t _internal_page_size() const;
-  void _internal_set_page_size(::int32_t value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.ListAppsResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 4, 1,
-      0, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const ListAppsResponse& from_msg);
-    ::google::protobuf::RepeatedPtrField< ::siqi::auth::GetAppResponse > apps_;
-    ::int64_t total_;
-    ::int32_t page_;
-    ::int32_t page_size_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class GetRoleUsersResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.GetRoleUsersResponse) */ {
- public:
-  inline GetRoleUsersResponse() : GetRoleUsersResponse(nullptr) {}
-  ~GetRoleUsersResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(GetRoleUsersResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(GetRoleUsersResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR GetRoleUsersResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline GetRoleUsersResponse(const GetRoleUsersResponse& from) : GetRoleUsersResponse(nullptr, from) {}
-  inline GetRoleUsersResponse(GetRoleUsersResponse&& from) noexcept
-      : GetRoleUsersResponse(nullptr, std::move(from)) {}
-  inline GetRoleUsersResponse& operator=(const GetRoleUsersResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline GetRoleUsersResponse& operator=(GetRoleUsersResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const GetRoleUsersResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const GetRoleUsersResponse* internal_default_instance() {
-    return reinterpret_cast<const GetRoleUsersResponse*>(
-        &_GetRoleUsersResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 37;
-  friend void swap(GetRoleUsersResponse& a, GetRoleUsersResponse& b) { a.Swap(&b); }
-  inline void Swap(GetRoleUsersResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(GetRoleUsersResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  GetRoleUsersResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<GetRoleUsersResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const GetRoleUsersResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const GetRoleUsersResponse& from) { GetRoleUsersResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(GetRoleUsersResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.GetRoleUsersResponse"; }
-
- protected:
-  explicit GetRoleUsersResponse(::google::protobuf::Arena* arena);
-  GetRoleUsersResponse(::google::protobuf::Arena* arena, const GetRoleUsersResponse& from);
-  GetRoleUsersResponse(::google::protobuf::Arena* arena, GetRoleUsersResponse&& from) noexcept
-      : GetRoleUsersResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-  using User = GetRoleUsersResponse_User;
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kUsersFieldNumber = 1,
-    kTotalFieldNumber = 2,
-    kPageFieldNumber = 3,
-    kPageSizeFieldNumber = 4,
-  };
-  // repeated .siqi.auth.GetRoleUsersResponse.User users = 1;
-  int users_size() const;
-  private:
-  int _internal_users_size() const;
-
-  public:
-  void clear_users() ;
-  ::siqi::auth::GetRoleUsersResponse_User* mutable_users(int index);
-  ::google::protobuf::RepeatedPtrField<::siqi::auth::GetRoleUsersResponse_User>* mutable_users();
-
-  private:
-  const ::google::protobuf::RepeatedPtrField<::siqi::auth::GetRoleUsersResponse_User>& _internal_users() const;
-  ::google::protobuf::RepeatedPtrField<::siqi::auth::GetRoleUsersResponse_User>* _internal_mutable_users();
-  public:
-  const ::siqi::auth::GetRoleUsersResponse_User& users(int index) const;
-  ::siqi::auth::GetRoleUsersResponse_User* add_users();
-  const ::google::protobuf::RepeatedPtrField<::siqi::auth::GetRoleUsersResponse_User>& users() const;
-  // int64 total = 2;
-  void clear_total() ;
-  ::int64_t total() const;
-  void set_total(::int64_t value);
-
-  private:
-  ::int64_t _internal_total() const;
-  void _internal_set_total(::int64_t value);
-
-  public:
-  // int32 page = 3;
-  void clear_page() ;
-  ::int32_t page() const;
-  void set_page(::int32_t value);
-
-  private:
-  ::int32_t _internal_page() const;
-  void _internal_set_page(::int32_t value);
-
-  public:
-  // int32 page_size = 4;
-  void clear_page_size() ;
-  ::int32_t page_size() const;
-  void set_page_size(::int32_t value);
-
-  private:
-  ::int32_t _internal_page_size() const;
-  void _internal_set_page_size(::int32_t value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.GetRoleUsersResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 4, 1,
-      0, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const GetRoleUsersResponse& from_msg);
-    ::google::protobuf::RepeatedPtrField< ::siqi::auth::GetRoleUsersResponse_User > users_;
-    ::int64_t total_;
-    ::int32_t page_;
-    ::int32_t page_size_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class BatchCheckResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.BatchCheckResponse) */ {
- public:
-  inline BatchCheckResponse() : BatchCheckResponse(nullptr) {}
-  ~BatchCheckResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(BatchCheckResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(BatchCheckResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR BatchCheckResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline BatchCheckResponse(const BatchCheckResponse& from) : BatchCheckResponse(nullptr, from) {}
-  inline BatchCheckResponse(BatchCheckResponse&& from) noexcept
-      : BatchCheckResponse(nullptr, std::move(from)) {}
-  inline BatchCheckResponse& operator=(const BatchCheckResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline BatchCheckResponse& operator=(BatchCheckResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const BatchCheckResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const BatchCheckResponse* internal_default_instance() {
-    return reinterpret_cast<const BatchCheckResponse*>(
-        &_BatchCheckResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 5;
-  friend void swap(BatchCheckResponse& a, BatchCheckResponse& b) { a.Swap(&b); }
-  inline void Swap(BatchCheckResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(BatchCheckResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  BatchCheckResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<BatchCheckResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const BatchCheckResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const BatchCheckResponse& from) { BatchCheckResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(BatchCheckResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.BatchCheckResponse"; }
-
- protected:
-  explicit BatchCheckResponse(::google::protobuf::Arena* arena);
-  BatchCheckResponse(::google::protobuf::Arena* arena, const BatchCheckResponse& from);
-  BatchCheckResponse(::google::protobuf::Arena* arena, BatchCheckResponse&& from) noexcept
-      : BatchCheckResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-  using ResultItem = BatchCheckResponse_ResultItem;
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kResultsFieldNumber = 1,
-  };
-  // repeated .siqi.auth.BatchCheckResponse.ResultItem results = 1;
-  int results_size() const;
-  private:
-  int _internal_results_size() const;
-
-  public:
-  void clear_results() ;
-  ::siqi::auth::BatchCheckResponse_ResultItem* mutable_results(int index);
-  ::google::protobuf::RepeatedPtrField<::siqi::auth::BatchCheckResponse_ResultItem>* mutable_results();
-
-  private:
-  const ::google::protobuf::RepeatedPtrField<::siqi::auth::BatchCheckResponse_ResultItem>& _internal_results() const;
-  ::google::protobuf::RepeatedPtrField<::siqi::auth::BatchCheckResponse_ResultItem>* _internal_mutable_results();
-  public:
-  const ::siqi::auth::BatchCheckResponse_ResultItem& results(int index) const;
-  ::siqi::auth::BatchCheckResponse_ResultItem* add_results();
-  const ::google::protobuf::RepeatedPtrField<::siqi::auth::BatchCheckResponse_ResultItem>& results() const;
-  // @@protoc_insertion_point(class_scope:siqi.auth.BatchCheckResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      0, 1, 1,
-      0, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const BatchCheckResponse& from_msg);
-    ::google::protobuf::RepeatedPtrField< ::siqi::auth::BatchCheckResponse_ResultItem > results_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-// -------------------------------------------------------------------
-
-class BatchCheckRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:siqi.auth.BatchCheckRequest) */ {
- public:
-  inline BatchCheckRequest() : BatchCheckRequest(nullptr) {}
-  ~BatchCheckRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(BatchCheckRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(BatchCheckRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR BatchCheckRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline BatchCheckRequest(const BatchCheckRequest& from) : BatchCheckRequest(nullptr, from) {}
-  inline BatchCheckRequest(BatchCheckRequest&& from) noexcept
-      : BatchCheckRequest(nullptr, std::move(from)) {}
-  inline BatchCheckRequest& operator=(const BatchCheckRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline BatchCheckRequest& operator=(BatchCheckRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const BatchCheckRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const BatchCheckRequest* internal_default_instance() {
-    return reinterpret_cast<const BatchCheckRequest*>(
-        &_BatchCheckRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 3;
-  friend void swap(BatchCheckRequest& a, BatchCheckRequest& b) { a.Swap(&b); }
-  inline void Swap(BatchCheckRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(BatchCheckRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  BatchCheckRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<BatchCheckRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const BatchCheckRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const BatchCheckRequest& from) { BatchCheckRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(BatchCheckRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "siqi.auth.BatchCheckRequest"; }
-
- protected:
-  explicit BatchCheckRequest(::google::protobuf::Arena* arena);
-  BatchCheckRequest(::google::protobuf::Arena* arena, const BatchCheckRequest& from);
-  BatchCheckRequest(::google::protobuf::Arena* arena, BatchCheckRequest&& from) noexcept
-      : BatchCheckRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-  using CheckItem = BatchCheckRequest_CheckItem;
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kItemsFieldNumber = 2,
-    kAppCodeFieldNumber = 1,
-  };
-  // repeated .siqi.auth.BatchCheckRequest.CheckItem items = 2;
-  int items_size() const;
-  private:
-  int _internal_items_size() const;
-
-  public:
-  void clear_items() ;
-  ::siqi::auth::BatchCheckRequest_CheckItem* mutable_items(int index);
-  ::google::protobuf::RepeatedPtrField<::siqi::auth::BatchCheckRequest_CheckItem>* mutable_items();
-
-  private:
-  const ::google::protobuf::RepeatedPtrField<::siqi::auth::BatchCheckRequest_CheckItem>& _internal_items() const;
-  ::google::protobuf::RepeatedPtrField<::siqi::auth::BatchCheckRequest_CheckItem>* _internal_mutable_items();
-  public:
-  const ::siqi::auth::BatchCheckRequest_CheckItem& items(int index) const;
-  ::siqi::auth::BatchCheckRequest_CheckItem* add_items();
-  const ::google::protobuf::RepeatedPtrField<::siqi::auth::BatchCheckRequest_CheckItem>& items() const;
-  // string app_code = 1;
-  void clear_app_code() ;
-  const std::string& app_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_app_code(Arg_&& arg, Args_... args);
-  std::string* mutable_app_code();
-  PROTOBUF_NODISCARD std::string* release_app_code();
-  void set_allocated_app_code(std::string* value);
-
-  private:
-  const std::string& _internal_app_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_code(
-      const std::string& value);
-  std::string* _internal_mutable_app_code();
-
-  public:
-  // @@protoc_insertion_point(class_scope:siqi.auth.BatchCheckRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 1,
-      44, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const BatchCheckRequest& from_msg);
-    ::google::protobuf::RepeatedPtrField< ::siqi::auth::BatchCheckRequest_CheckItem > items_;
-    ::google::protobuf::internal::ArenaStringPtr app_code_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_auth_2eproto;
-};
-
-// ===================================================================
-
-
-// -------------------------------------------------------------------
-
-class AuthService_Stub;
-class AuthService : public ::google::protobuf::Service {
- protected:
-  AuthService() = default;
-
- public:
-  using Stub = AuthService_Stub;
-
-  AuthService(const AuthService&) = delete;
-  AuthService& operator=(const AuthService&) = delete;
-  virtual ~AuthService() = default;
-
-  static const ::google::protobuf::ServiceDescriptor* descriptor();
-
-  virtual void Check(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::CheckRequest* request,
-                        ::siqi::auth::CheckResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void BatchCheck(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::BatchCheckRequest* request,
-                        ::siqi::auth::BatchCheckResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void GetUserPermissions(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::GetUserPermissionsRequest* request,
-                        ::siqi::auth::GetUserPermissionsResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void GetUserRoles(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::GetUserRolesRequest* request,
-                        ::siqi::auth::GetUserRolesResponse* response,
-                        ::google::protobuf::Closure* done);
-
-  // implements Service ----------------------------------------------
-  const ::google::protobuf::ServiceDescriptor* GetDescriptor() override;
-
-  void CallMethod(const ::google::protobuf::MethodDescriptor* method,
-                  ::google::protobuf::RpcController* controller,
-                  const ::google::protobuf::Message* request,
-                  ::google::protobuf::Message* response,
-                  ::google::protobuf::Closure* done) override;
-
-  const ::google::protobuf::Message& GetRequestPrototype(
-      const ::google::protobuf::MethodDescriptor* method) const override;
-
-  const ::google::protobuf::Message& GetResponsePrototype(
-      const ::google::protobuf::MethodDescriptor* method) const override;
-};
-
-class AuthService_Stub final : public AuthService {
- public:
-  AuthService_Stub(::google::protobuf::RpcChannel* channel);
-  AuthService_Stub(::google::protobuf::RpcChannel* channel,
-                   ::google::protobuf::Service::ChannelOwnership ownership);
-
-  AuthService_Stub(const AuthService_Stub&) = delete;
-  AuthService_Stub& operator=(const AuthService_Stub&) = delete;
-
-  ~AuthService_Stub() override;
-
-  inline ::google::protobuf::RpcChannel* channel() { return channel_; }
-
-  // implements AuthService ------------------------------------------
-  void Check(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::CheckRequest* request,
-                        ::siqi::auth::CheckResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void BatchCheck(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::BatchCheckRequest* request,
-                        ::siqi::auth::BatchCheckResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void GetUserPermissions(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::GetUserPermissionsRequest* request,
-                        ::siqi::auth::GetUserPermissionsResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void GetUserRoles(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::GetUserRolesRequest* request,
-                        ::siqi::auth::GetUserRolesResponse* response,
-                        ::google::protobuf::Closure* done) override;
-
- private:
-  ::google::protobuf::RpcChannel* channel_;
-  bool owns_channel_;
-};
-// -------------------------------------------------------------------
-
-class AdminService_Stub;
-class AdminService : public ::google::protobuf::Service {
- protected:
-  AdminService() = default;
-
- public:
-  using Stub = AdminService_Stub;
-
-  AdminService(const AdminService&) = delete;
-  AdminService& operator=(const AdminService&) = delete;
-  virtual ~AdminService() = default;
-
-  static const ::google::protobuf::ServiceDescriptor* descriptor();
-
-  virtual void CreateApp(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::CreateAppRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void UpdateApp(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::UpdateAppRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void DeleteApp(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::DeleteAppRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void GetApp(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::GetAppRequest* request,
-                        ::siqi::auth::GetAppResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void ListApps(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::ListAppsRequest* request,
-                        ::siqi::auth::ListAppsResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void Login(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::LoginRequest* request,
-                        ::siqi::auth::LoginResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void CreatePermission(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::CreatePermissionRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void UpdatePermission(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::UpdatePermissionRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void DeletePermission(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::DeletePermissionRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void ListPermissions(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::ListPermissionsRequest* request,
-                        ::siqi::auth::ListPermissionsResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void CreateRole(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::CreateRoleRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void UpdateRole(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::UpdateRoleRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void DeleteRole(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::DeleteRoleRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void ListRoles(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::ListRolesRequest* request,
-                        ::siqi::auth::ListRolesResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void AddPermissionToRole(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::AddPermissionToRoleRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void RemovePermissionFromRole(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::RemovePermissionFromRoleRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void GetRolePermissions(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::GetRolePermissionsRequest* request,
-                        ::siqi::auth::GetRolePermissionsResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void GrantRoleToUser(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::GrantRoleToUserRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void RevokeRoleFromUser(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::RevokeRoleFromUserRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void GetRoleUsers(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::GetRoleUsersRequest* request,
-                        ::siqi::auth::GetRoleUsersResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void ListUserRoles(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::ListUserRolesRequest* request,
-                        ::siqi::auth::ListUserRolesResponse* response,
-                        ::google::protobuf::Closure* done);
-  virtual void ListAuditLogs(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::ListAuditLogsRequest* request,
-                        ::siqi::auth::ListAuditLogsResponse* response,
-                        ::google::protobuf::Closure* done);
-
-  // implements Service ----------------------------------------------
-  const ::google::protobuf::ServiceDescriptor* GetDescriptor() override;
-
-  void CallMethod(const ::google::protobuf::MethodDescriptor* method,
-                  ::google::protobuf::RpcController* controller,
-                  const ::google::protobuf::Message* request,
-                  ::google::protobuf::Message* response,
-                  ::google::protobuf::Closure* done) override;
-
-  const ::google::protobuf::Message& GetRequestPrototype(
-      const ::google::protobuf::MethodDescriptor* method) const override;
-
-  const ::google::protobuf::Message& GetResponsePrototype(
-      const ::google::protobuf::MethodDescriptor* method) const override;
-};
-
-class AdminService_Stub final : public AdminService {
- public:
-  AdminService_Stub(::google::protobuf::RpcChannel* channel);
-  AdminService_Stub(::google::protobuf::RpcChannel* channel,
-                   ::google::protobuf::Service::ChannelOwnership ownership);
-
-  AdminService_Stub(const AdminService_Stub&) = delete;
-  AdminService_Stub& operator=(const AdminService_Stub&) = delete;
-
-  ~AdminService_Stub() override;
-
-  inline ::google::protobuf::RpcChannel* channel() { return channel_; }
-
-  // implements AdminService ------------------------------------------
-  void CreateApp(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::CreateAppRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void UpdateApp(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::UpdateAppRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void DeleteApp(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::DeleteAppRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void GetApp(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::GetAppRequest* request,
-                        ::siqi::auth::GetAppResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void ListApps(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::ListAppsRequest* request,
-                        ::siqi::auth::ListAppsResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void Login(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::LoginRequest* request,
-                        ::siqi::auth::LoginResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void CreatePermission(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::CreatePermissionRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void UpdatePermission(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::UpdatePermissionRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void DeletePermission(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::DeletePermissionRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void ListPermissions(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::ListPermissionsRequest* request,
-                        ::siqi::auth::ListPermissionsResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void CreateRole(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::CreateRoleRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void UpdateRole(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::UpdateRoleRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void DeleteRole(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::DeleteRoleRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void ListRoles(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::ListRolesRequest* request,
-                        ::siqi::auth::ListRolesResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void AddPermissionToRole(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::AddPermissionToRoleRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void RemovePermissionFromRole(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::RemovePermissionFromRoleRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void GetRolePermissions(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::GetRolePermissionsRequest* request,
-                        ::siqi::auth::GetRolePermissionsResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void GrantRoleToUser(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::GrantRoleToUserRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void RevokeRoleFromUser(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::RevokeRoleFromUserRequest* request,
-                        ::siqi::auth::AdminResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void GetRoleUsers(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::GetRoleUsersRequest* request,
-                        ::siqi::auth::GetRoleUsersResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void ListUserRoles(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::ListUserRolesRequest* request,
-                        ::siqi::auth::ListUserRolesResponse* response,
-                        ::google::protobuf::Closure* done) override;
-  void ListAuditLogs(::google::protobuf::RpcController* controller,
-                        const ::siqi::auth::ListAuditLogsRequest* request,
-                        ::siqi::auth::ListAuditLogsResponse* response,
-                        ::google::protobuf::Closure* done) override;
-
- private:
-  ::google::protobuf::RpcChannel* channel_;
-  bool owns_channel_;
-};
-// ===================================================================
-
-
-
-// ===================================================================
-
-
-#ifdef __GNUC__
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// -------------------------------------------------------------------
-
-// CheckRequest
-
-// string app_code = 1;
-inline void CheckRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& CheckRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.CheckRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CheckRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.CheckRequest.app_code)
-}
-inline std::string* CheckRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.CheckRequest.app_code)
-  return _s;
-}
-inline const std::string& CheckRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void CheckRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* CheckRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* CheckRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.CheckRequest.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void CheckRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.CheckRequest.app_code)
-}
-
-// string user_id = 2;
-inline void CheckRequest::clear_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.ClearToEmpty();
-}
-inline const std::string& CheckRequest::user_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.CheckRequest.user_id)
-  return _internal_user_id();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CheckRequest::set_user_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.CheckRequest.user_id)
-}
-inline std::string* CheckRequest::mutable_user_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_user_id();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.CheckRequest.user_id)
-  return _s;
-}
-inline const std::string& CheckRequest::_internal_user_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.user_id_.Get();
-}
-inline void CheckRequest::_internal_set_user_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.Set(value, GetArena());
-}
-inline std::string* CheckRequest::_internal_mutable_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.user_id_.Mutable( GetArena());
-}
-inline std::string* CheckRequest::release_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.CheckRequest.user_id)
-  return _impl_.user_id_.Release();
-}
-inline void CheckRequest::set_allocated_user_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.user_id_.IsDefault()) {
-    _impl_.user_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.CheckRequest.user_id)
-}
-
-// string perm_key = 3;
-inline void CheckRequest::clear_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.ClearToEmpty();
-}
-inline const std::string& CheckRequest::perm_key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.CheckRequest.perm_key)
-  return _internal_perm_key();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CheckRequest::set_perm_key(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.CheckRequest.perm_key)
-}
-inline std::string* CheckRequest::mutable_perm_key() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_perm_key();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.CheckRequest.perm_key)
-  return _s;
-}
-inline const std::string& CheckRequest::_internal_perm_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.perm_key_.Get();
-}
-inline void CheckRequest::_internal_set_perm_key(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.Set(value, GetArena());
-}
-inline std::string* CheckRequest::_internal_mutable_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.perm_key_.Mutable( GetArena());
-}
-inline std::string* CheckRequest::release_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.CheckRequest.perm_key)
-  return _impl_.perm_key_.Release();
-}
-inline void CheckRequest::set_allocated_perm_key(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.perm_key_.IsDefault()) {
-    _impl_.perm_key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.CheckRequest.perm_key)
-}
-
-// string resource_id = 4;
-inline void CheckRequest::clear_resource_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.resource_id_.ClearToEmpty();
-}
-inline const std::string& CheckRequest::resource_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.CheckRequest.resource_id)
-  return _internal_resource_id();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CheckRequest::set_resource_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.resource_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.CheckRequest.resource_id)
-}
-inline std::string* CheckRequest::mutable_resource_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_resource_id();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.CheckRequest.resource_id)
-  return _s;
-}
-inline const std::string& CheckRequest::_internal_resource_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.resource_id_.Get();
-}
-inline void CheckRequest::_internal_set_resource_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.resource_id_.Set(value, GetArena());
-}
-inline std::string* CheckRequest::_internal_mutable_resource_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.resource_id_.Mutable( GetArena());
-}
-inline std::string* CheckRequest::release_resource_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.CheckRequest.resource_id)
-  return _impl_.resource_id_.Release();
-}
-inline void CheckRequest::set_allocated_resource_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.resource_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.resource_id_.IsDefault()) {
-    _impl_.resource_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.CheckRequest.resource_id)
-}
-
-// -------------------------------------------------------------------
-
-// CheckResponse
-
-// optional bool allowed = 1;
-inline bool CheckResponse::has_allowed() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
-}
-inline void CheckResponse::clear_allowed() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.allowed_ = false;
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline bool CheckResponse::allowed() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.CheckResponse.allowed)
-  return _internal_allowed();
-}
-inline void CheckResponse::set_allowed(bool value) {
-  _internal_set_allowed(value);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_set:siqi.auth.CheckResponse.allowed)
-}
-inline bool CheckResponse::_internal_allowed() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.allowed_;
-}
-inline void CheckResponse::_internal_set_allowed(bool value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.allowed_ = value;
-}
-
-// string reason = 2;
-inline void CheckResponse::clear_reason() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.reason_.ClearToEmpty();
-}
-inline const std::string& CheckResponse::reason() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.CheckResponse.reason)
-  return _internal_reason();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CheckResponse::set_reason(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.reason_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.CheckResponse.reason)
-}
-inline std::string* CheckResponse::mutable_reason() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_reason();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.CheckResponse.reason)
-  return _s;
-}
-inline const std::string& CheckResponse::_internal_reason() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.reason_.Get();
-}
-inline void CheckResponse::_internal_set_reason(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.reason_.Set(value, GetArena());
-}
-inline std::string* CheckResponse::_internal_mutable_reason() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.reason_.Mutable( GetArena());
-}
-inline std::string* CheckResponse::release_reason() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.CheckResponse.reason)
-  return _impl_.reason_.Release();
-}
-inline void CheckResponse::set_allocated_reason(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.reason_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.reason_.IsDefault()) {
-    _impl_.reason_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.CheckResponse.reason)
-}
-
-// string current_roles = 3;
-inline void CheckResponse::clear_current_roles() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.current_roles_.ClearToEmpty();
-}
-inline const std::string& CheckResponse::current_roles() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.CheckResponse.current_roles)
-  return _internal_current_roles();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CheckResponse::set_current_roles(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.current_roles_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.CheckResponse.current_roles)
-}
-inline std::string* CheckResponse::mutable_current_roles() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_current_roles();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.CheckResponse.current_roles)
-  return _s;
-}
-inline const std::string& CheckResponse::_internal_current_roles() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.current_roles_.Get();
-}
-inline void CheckResponse::_internal_set_current_roles(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.current_roles_.Set(value, GetArena());
-}
-inline std::string* CheckResponse::_internal_mutable_current_roles() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.current_roles_.Mutable( GetArena());
-}
-inline std::string* CheckResponse::release_current_roles() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.CheckResponse.current_roles)
-  return _impl_.current_roles_.Release();
-}
-inline void CheckResponse::set_allocated_current_roles(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.current_roles_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.current_roles_.IsDefault()) {
-    _impl_.current_roles_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.CheckResponse.current_roles)
-}
-
-// string suggest_roles = 4;
-inline void CheckResponse::clear_suggest_roles() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.suggest_roles_.ClearToEmpty();
-}
-inline const std::string& CheckResponse::suggest_roles() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.CheckResponse.suggest_roles)
-  return _internal_suggest_roles();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CheckResponse::set_suggest_roles(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.suggest_roles_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.CheckResponse.suggest_roles)
-}
-inline std::string* CheckResponse::mutable_suggest_roles() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_suggest_roles();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.CheckResponse.suggest_roles)
-  return _s;
-}
-inline const std::string& CheckResponse::_internal_suggest_roles() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.suggest_roles_.Get();
-}
-inline void CheckResponse::_internal_set_suggest_roles(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.suggest_roles_.Set(value, GetArena());
-}
-inline std::string* CheckResponse::_internal_mutable_suggest_roles() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.suggest_roles_.Mutable( GetArena());
-}
-inline std::string* CheckResponse::release_suggest_roles() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.CheckResponse.suggest_roles)
-  return _impl_.suggest_roles_.Release();
-}
-inline void CheckResponse::set_allocated_suggest_roles(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.suggest_roles_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.suggest_roles_.IsDefault()) {
-    _impl_.suggest_roles_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.CheckResponse.suggest_roles)
-}
-
-// -------------------------------------------------------------------
-
-// BatchCheckRequest_CheckItem
-
-// string user_id = 1;
-inline void BatchCheckRequest_CheckItem::clear_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.ClearToEmpty();
-}
-inline const std::string& BatchCheckRequest_CheckItem::user_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.BatchCheckRequest.CheckItem.user_id)
-  return _internal_user_id();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void BatchCheckRequest_CheckItem::set_user_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.BatchCheckRequest.CheckItem.user_id)
-}
-inline std::string* BatchCheckRequest_CheckItem::mutable_user_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_user_id();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.BatchCheckRequest.CheckItem.user_id)
-  return _s;
-}
-inline const std::string& BatchCheckRequest_CheckItem::_internal_user_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.user_id_.Get();
-}
-inline void BatchCheckRequest_CheckItem::_internal_set_user_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.Set(value, GetArena());
-}
-inline std::string* BatchCheckRequest_CheckItem::_internal_mutable_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.user_id_.Mutable( GetArena());
-}
-inline std::string* BatchCheckRequest_CheckItem::release_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.BatchCheckRequest.CheckItem.user_id)
-  return _impl_.user_id_.Release();
-}
-inline void BatchCheckRequest_CheckItem::set_allocated_user_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.user_id_.IsDefault()) {
-    _impl_.user_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.BatchCheckRequest.CheckItem.user_id)
-}
-
-// string perm_key = 2;
-inline void BatchCheckRequest_CheckItem::clear_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.ClearToEmpty();
-}
-inline const std::string& BatchCheckRequest_CheckItem::perm_key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.BatchCheckRequest.CheckItem.perm_key)
-  return _internal_perm_key();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void BatchCheckRequest_CheckItem::set_perm_key(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.BatchCheckRequest.CheckItem.perm_key)
-}
-inline std::string* BatchCheckRequest_CheckItem::mutable_perm_key() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_perm_key();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.BatchCheckRequest.CheckItem.perm_key)
-  return _s;
-}
-inline const std::string& BatchCheckRequest_CheckItem::_internal_perm_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.perm_key_.Get();
-}
-inline void BatchCheckRequest_CheckItem::_internal_set_perm_key(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.Set(value, GetArena());
-}
-inline std::string* BatchCheckRequest_CheckItem::_internal_mutable_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.perm_key_.Mutable( GetArena());
-}
-inline std::string* BatchCheckRequest_CheckItem::release_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.BatchCheckRequest.CheckItem.perm_key)
-  return _impl_.perm_key_.Release();
-}
-inline void BatchCheckRequest_CheckItem::set_allocated_perm_key(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.perm_key_.IsDefault()) {
-    _impl_.perm_key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.BatchCheckRequest.CheckItem.perm_key)
-}
-
-// string resource_id = 3;
-inline void BatchCheckRequest_CheckItem::clear_resource_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.resource_id_.ClearToEmpty();
-}
-inline const std::string& BatchCheckRequest_CheckItem::resource_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.BatchCheckRequest.CheckItem.resource_id)
-  return _internal_resource_id();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void BatchCheckRequest_CheckItem::set_resource_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.resource_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.BatchCheckRequest.CheckItem.resource_id)
-}
-inline std::string* BatchCheckRequest_CheckItem::mutable_resource_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_resource_id();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.BatchCheckRequest.CheckItem.resource_id)
-  return _s;
-}
-inline const std::string& BatchCheckRequest_CheckItem::_internal_resource_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.resource_id_.Get();
-}
-inline void BatchCheckRequest_CheckItem::_internal_set_resource_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.resource_id_.Set(value, GetArena());
-}
-inline std::string* BatchCheckRequest_CheckItem::_internal_mutable_resource_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.resource_id_.Mutable( GetArena());
-}
-inline std::string* BatchCheckRequest_CheckItem::release_resource_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.BatchCheckRequest.CheckItem.resource_id)
-  return _impl_.resource_id_.Release();
-}
-inline void BatchCheckRequest_CheckItem::set_allocated_resource_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.resource_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.resource_id_.IsDefault()) {
-    _impl_.resource_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.BatchCheckRequest.CheckItem.resource_id)
-}
-
-// -------------------------------------------------------------------
-
-// BatchCheckRequest
-
-// string app_code = 1;
-inline void BatchCheckRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& BatchCheckRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.BatchCheckRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void BatchCheckRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.BatchCheckRequest.app_code)
-}
-inline std::string* BatchCheckRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.BatchCheckRequest.app_code)
-  return _s;
-}
-inline const std::string& BatchCheckRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void BatchCheckRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* BatchCheckRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* BatchCheckRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.BatchCheckRequest.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void BatchCheckRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.BatchCheckRequest.app_code)
-}
-
-// repeated .siqi.auth.BatchCheckRequest.CheckItem items = 2;
-inline int BatchCheckRequest::_internal_items_size() const {
-  return _internal_items().size();
-}
-inline int BatchCheckRequest::items_size() const {
-  return _internal_items_size();
-}
-inline void BatchCheckRequest::clear_items() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.items_.Clear();
-}
-inline ::siqi::auth::BatchCheckRequest_CheckItem* BatchCheckRequest::mutable_items(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:siqi.auth.BatchCheckRequest.items)
-  return _internal_mutable_items()->Mutable(index);
-}
-inline ::google::protobuf::RepeatedPtrField<::siqi::auth::BatchCheckRequest_CheckItem>* BatchCheckRequest::mutable_items()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:siqi.auth.BatchCheckRequest.items)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_items();
-}
-inline const ::siqi::auth::BatchCheckRequest_CheckItem& BatchCheckRequest::items(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.BatchCheckRequest.items)
-  return _internal_items().Get(index);
-}
-inline ::siqi::auth::BatchCheckRequest_CheckItem* BatchCheckRequest::add_items() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::siqi::auth::BatchCheckRequest_CheckItem* _add = _internal_mutable_items()->Add();
-  // @@protoc_insertion_point(field_add:siqi.auth.BatchCheckRequest.items)
-  return _add;
-}
-inline const ::google::protobuf::RepeatedPtrField<::siqi::auth::BatchCheckRequest_CheckItem>& BatchCheckRequest::items() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:siqi.auth.BatchCheckRequest.items)
-  return _internal_items();
-}
-inline const ::google::protobuf::RepeatedPtrField<::siqi::auth::BatchCheckRequest_CheckItem>&
-BatchCheckRequest::_internal_items() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.items_;
-}
-inline ::google::protobuf::RepeatedPtrField<::siqi::auth::BatchCheckRequest_CheckItem>*
-BatchCheckRequest::_internal_mutable_items() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.items_;
-}
-
-// -------------------------------------------------------------------
-
-// BatchCheckResponse_ResultItem
-
-// string user_id = 1;
-inline void BatchCheckResponse_ResultItem::clear_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.ClearToEmpty();
-}
-inline const std::string& BatchCheckResponse_ResultItem::user_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.BatchCheckResponse.ResultItem.user_id)
-  return _internal_user_id();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void BatchCheckResponse_ResultItem::set_user_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.BatchCheckResponse.ResultItem.user_id)
-}
-inline std::string* BatchCheckResponse_ResultItem::mutable_user_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_user_id();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.BatchCheckResponse.ResultItem.user_id)
-  return _s;
-}
-inline const std::string& BatchCheckResponse_ResultItem::_internal_user_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.user_id_.Get();
-}
-inline void BatchCheckResponse_ResultItem::_internal_set_user_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.Set(value, GetArena());
-}
-inline std::string* BatchCheckResponse_ResultItem::_internal_mutable_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.user_id_.Mutable( GetArena());
-}
-inline std::string* BatchCheckResponse_ResultItem::release_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.BatchCheckResponse.ResultItem.user_id)
-  return _impl_.user_id_.Release();
-}
-inline void BatchCheckResponse_ResultItem::set_allocated_user_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.user_id_.IsDefault()) {
-    _impl_.user_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.BatchCheckResponse.ResultItem.user_id)
-}
-
-// string perm_key = 2;
-inline void BatchCheckResponse_ResultItem::clear_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.ClearToEmpty();
-}
-inline const std::string& BatchCheckResponse_ResultItem::perm_key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.BatchCheckResponse.ResultItem.perm_key)
-  return _internal_perm_key();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void BatchCheckResponse_ResultItem::set_perm_key(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.BatchCheckResponse.ResultItem.perm_key)
-}
-inline std::string* BatchCheckResponse_ResultItem::mutable_perm_key() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_perm_key();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.BatchCheckResponse.ResultItem.perm_key)
-  return _s;
-}
-inline const std::string& BatchCheckResponse_ResultItem::_internal_perm_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.perm_key_.Get();
-}
-inline void BatchCheckResponse_ResultItem::_internal_set_perm_key(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.Set(value, GetArena());
-}
-inline std::string* BatchCheckResponse_ResultItem::_internal_mutable_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.perm_key_.Mutable( GetArena());
-}
-inline std::string* BatchCheckResponse_ResultItem::release_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.BatchCheckResponse.ResultItem.perm_key)
-  return _impl_.perm_key_.Release();
-}
-inline void BatchCheckResponse_ResultItem::set_allocated_perm_key(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.perm_key_.IsDefault()) {
-    _impl_.perm_key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.BatchCheckResponse.ResultItem.perm_key)
-}
-
-// optional bool allowed = 3;
-inline bool BatchCheckResponse_ResultItem::has_allowed() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
-}
-inline void BatchCheckResponse_ResultItem::clear_allowed() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.allowed_ = false;
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline bool BatchCheckResponse_ResultItem::allowed() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.BatchCheckResponse.ResultItem.allowed)
-  return _internal_allowed();
-}
-inline void BatchCheckResponse_ResultItem::set_allowed(bool value) {
-  _internal_set_allowed(value);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_set:siqi.auth.BatchCheckResponse.ResultItem.allowed)
-}
-inline bool BatchCheckResponse_ResultItem::_internal_allowed() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.allowed_;
-}
-inline void BatchCheckResponse_ResultItem::_internal_set_allowed(bool value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.allowed_ = value;
-}
-
-// string reason = 4;
-inline void BatchCheckResponse_ResultItem::clear_reason() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.reason_.ClearToEmpty();
-}
-inline const std::string& BatchCheckResponse_ResultItem::reason() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.BatchCheckResponse.ResultItem.reason)
-  return _internal_reason();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void BatchCheckResponse_ResultItem::set_reason(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.reason_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.BatchCheckResponse.ResultItem.reason)
-}
-inline std::string* BatchCheckResponse_ResultItem::mutable_reason() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_reason();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.BatchCheckResponse.ResultItem.reason)
-  return _s;
-}
-inline const std::string& BatchCheckResponse_ResultItem::_internal_reason() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.reason_.Get();
-}
-inline void BatchCheckResponse_ResultItem::_internal_set_reason(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.reason_.Set(value, GetArena());
-}
-inline std::string* BatchCheckResponse_ResultItem::_internal_mutable_reason() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.reason_.Mutable( GetArena());
-}
-inline std::string* BatchCheckResponse_ResultItem::release_reason() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.BatchCheckResponse.ResultItem.reason)
-  return _impl_.reason_.Release();
-}
-inline void BatchCheckResponse_ResultItem::set_allocated_reason(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.reason_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.reason_.IsDefault()) {
-    _impl_.reason_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.BatchCheckResponse.ResultItem.reason)
-}
-
-// -------------------------------------------------------------------
-
-// BatchCheckResponse
-
-// repeated .siqi.auth.BatchCheckResponse.ResultItem results = 1;
-inline int BatchCheckResponse::_internal_results_size() const {
-  return _internal_results().size();
-}
-inline int BatchCheckResponse::results_size() const {
-  return _internal_results_size();
-}
-inline void BatchCheckResponse::clear_results() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.results_.Clear();
-}
-inline ::siqi::auth::BatchCheckResponse_ResultItem* BatchCheckResponse::mutable_results(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:siqi.auth.BatchCheckResponse.results)
-  return _internal_mutable_results()->Mutable(index);
-}
-inline ::google::protobuf::RepeatedPtrField<::siqi::auth::BatchCheckResponse_ResultItem>* BatchCheckResponse::mutable_results()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:siqi.auth.BatchCheckResponse.results)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_results();
-}
-inline const ::siqi::auth::BatchCheckResponse_ResultItem& BatchCheckResponse::results(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.BatchCheckResponse.results)
-  return _internal_results().Get(index);
-}
-inline ::siqi::auth::BatchCheckResponse_ResultItem* BatchCheckResponse::add_results() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::siqi::auth::BatchCheckResponse_ResultItem* _add = _internal_mutable_results()->Add();
-  // @@protoc_insertion_point(field_add:siqi.auth.BatchCheckResponse.results)
-  return _add;
-}
-inline const ::google::protobuf::RepeatedPtrField<::siqi::auth::BatchCheckResponse_ResultItem>& BatchCheckResponse::results() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:siqi.auth.BatchCheckResponse.results)
-  return _internal_results();
-}
-inline const ::google::protobuf::RepeatedPtrField<::siqi::auth::BatchCheckResponse_ResultItem>&
-BatchCheckResponse::_internal_results() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.results_;
-}
-inline ::google::protobuf::RepeatedPtrField<::siqi::auth::BatchCheckResponse_ResultItem>*
-BatchCheckResponse::_internal_mutable_results() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.results_;
-}
-
-// -------------------------------------------------------------------
-
-// GetUserPermissionsRequest
-
-// string app_code = 1;
-inline void GetUserPermissionsRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& GetUserPermissionsRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetUserPermissionsRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GetUserPermissionsRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.GetUserPermissionsRequest.app_code)
-}
-inline std::string* GetUserPermissionsRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GetUserPermissionsRequest.app_code)
-  return _s;
-}
-inline const std::string& GetUserPermissionsRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void GetUserPermissionsRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* GetUserPermissionsRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* GetUserPermissionsRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.GetUserPermissionsRequest.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void GetUserPermissionsRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.GetUserPermissionsRequest.app_code)
-}
-
-// string user_id = 2;
-inline void GetUserPermissionsRequest::clear_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.ClearToEmpty();
-}
-inline const std::string& GetUserPermissionsRequest::user_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetUserPermissionsRequest.user_id)
-  return _internal_user_id();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GetUserPermissionsRequest::set_user_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.GetUserPermissionsRequest.user_id)
-}
-inline std::string* GetUserPermissionsRequest::mutable_user_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_user_id();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GetUserPermissionsRequest.user_id)
-  return _s;
-}
-inline const std::string& GetUserPermissionsRequest::_internal_user_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.user_id_.Get();
-}
-inline void GetUserPermissionsRequest::_internal_set_user_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.Set(value, GetArena());
-}
-inline std::string* GetUserPermissionsRequest::_internal_mutable_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.user_id_.Mutable( GetArena());
-}
-inline std::string* GetUserPermissionsRequest::release_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.GetUserPermissionsRequest.user_id)
-  return _impl_.user_id_.Release();
-}
-inline void GetUserPermissionsRequest::set_allocated_user_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.user_id_.IsDefault()) {
-    _impl_.user_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.GetUserPermissionsRequest.user_id)
-}
-
-// -------------------------------------------------------------------
-
-// GetUserPermissionsResponse
-
-// repeated string perm_keys = 1;
-inline int GetUserPermissionsResponse::_internal_perm_keys_size() const {
-  return _internal_perm_keys().size();
-}
-inline int GetUserPermissionsResponse::perm_keys_size() const {
-  return _internal_perm_keys_size();
-}
-inline void GetUserPermissionsResponse::clear_perm_keys() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_keys_.Clear();
-}
-inline std::string* GetUserPermissionsResponse::add_perm_keys() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  std::string* _s = _internal_mutable_perm_keys()->Add();
-  // @@protoc_insertion_point(field_add_mutable:siqi.auth.GetUserPermissionsResponse.perm_keys)
-  return _s;
-}
-inline const std::string& GetUserPermissionsResponse::perm_keys(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetUserPermissionsResponse.perm_keys)
-  return _internal_perm_keys().Get(index);
-}
-inline std::string* GetUserPermissionsResponse::mutable_perm_keys(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GetUserPermissionsResponse.perm_keys)
-  return _internal_mutable_perm_keys()->Mutable(index);
-}
-template <typename Arg_, typename... Args_>
-inline void GetUserPermissionsResponse::set_perm_keys(int index, Arg_&& value, Args_... args) {
-  ::google::protobuf::internal::AssignToString(
-      *_internal_mutable_perm_keys()->Mutable(index),
-      std::forward<Arg_>(value), args... );
-  // @@protoc_insertion_point(field_set:siqi.auth.GetUserPermissionsResponse.perm_keys)
-}
-template <typename Arg_, typename... Args_>
-inline void GetUserPermissionsResponse::add_perm_keys(Arg_&& value, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::google::protobuf::internal::AddToRepeatedPtrField(*_internal_mutable_perm_keys(),
-                               std::forward<Arg_>(value),
-                               args... );
-  // @@protoc_insertion_point(field_add:siqi.auth.GetUserPermissionsResponse.perm_keys)
-}
-inline const ::google::protobuf::RepeatedPtrField<std::string>&
-GetUserPermissionsResponse::perm_keys() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:siqi.auth.GetUserPermissionsResponse.perm_keys)
-  return _internal_perm_keys();
-}
-inline ::google::protobuf::RepeatedPtrField<std::string>*
-GetUserPermissionsResponse::mutable_perm_keys() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:siqi.auth.GetUserPermissionsResponse.perm_keys)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_perm_keys();
-}
-inline const ::google::protobuf::RepeatedPtrField<std::string>&
-GetUserPermissionsResponse::_internal_perm_keys() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.perm_keys_;
-}
-inline ::google::protobuf::RepeatedPtrField<std::string>*
-GetUserPermissionsResponse::_internal_mutable_perm_keys() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.perm_keys_;
-}
-
-// -------------------------------------------------------------------
-
-// GetUserRolesRequest
-
-// string app_code = 1;
-inline void GetUserRolesRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& GetUserRolesRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetUserRolesRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GetUserRolesRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.GetUserRolesRequest.app_code)
-}
-inline std::string* GetUserRolesRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GetUserRolesRequest.app_code)
-  return _s;
-}
-inline const std::string& GetUserRolesRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void GetUserRolesRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* GetUserRolesRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* GetUserRolesRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.GetUserRolesRequest.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void GetUserRolesRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.GetUserRolesRequest.app_code)
-}
-
-// string user_id = 2;
-inline void GetUserRolesRequest::clear_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.ClearToEmpty();
-}
-inline const std::string& GetUserRolesRequest::user_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetUserRolesRequest.user_id)
-  return _internal_user_id();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GetUserRolesRequest::set_user_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.GetUserRolesRequest.user_id)
-}
-inline std::string* GetUserRolesRequest::mutable_user_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_user_id();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GetUserRolesRequest.user_id)
-  return _s;
-}
-inline const std::string& GetUserRolesRequest::_internal_user_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.user_id_.Get();
-}
-inline void GetUserRolesRequest::_internal_set_user_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.Set(value, GetArena());
-}
-inline std::string* GetUserRolesRequest::_internal_mutable_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.user_id_.Mutable( GetArena());
-}
-inline std::string* GetUserRolesRequest::release_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.GetUserRolesRequest.user_id)
-  return _impl_.user_id_.Release();
-}
-inline void GetUserRolesRequest::set_allocated_user_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.user_id_.IsDefault()) {
-    _impl_.user_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.GetUserRolesRequest.user_id)
-}
-
-// -------------------------------------------------------------------
-
-// GetUserRolesResponse
-
-// repeated string role_keys = 1;
-inline int GetUserRolesResponse::_internal_role_keys_size() const {
-  return _internal_role_keys().size();
-}
-inline int GetUserRolesResponse::role_keys_size() const {
-  return _internal_role_keys_size();
-}
-inline void GetUserRolesResponse::clear_role_keys() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_keys_.Clear();
-}
-inline std::string* GetUserRolesResponse::add_role_keys() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  std::string* _s = _internal_mutable_role_keys()->Add();
-  // @@protoc_insertion_point(field_add_mutable:siqi.auth.GetUserRolesResponse.role_keys)
-  return _s;
-}
-inline const std::string& GetUserRolesResponse::role_keys(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetUserRolesResponse.role_keys)
-  return _internal_role_keys().Get(index);
-}
-inline std::string* GetUserRolesResponse::mutable_role_keys(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GetUserRolesResponse.role_keys)
-  return _internal_mutable_role_keys()->Mutable(index);
-}
-template <typename Arg_, typename... Args_>
-inline void GetUserRolesResponse::set_role_keys(int index, Arg_&& value, Args_... args) {
-  ::google::protobuf::internal::AssignToString(
-      *_internal_mutable_role_keys()->Mutable(index),
-      std::forward<Arg_>(value), args... );
-  // @@protoc_insertion_point(field_set:siqi.auth.GetUserRolesResponse.role_keys)
-}
-template <typename Arg_, typename... Args_>
-inline void GetUserRolesResponse::add_role_keys(Arg_&& value, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::google::protobuf::internal::AddToRepeatedPtrField(*_internal_mutable_role_keys(),
-                               std::forward<Arg_>(value),
-                               args... );
-  // @@protoc_insertion_point(field_add:siqi.auth.GetUserRolesResponse.role_keys)
-}
-inline const ::google::protobuf::RepeatedPtrField<std::string>&
-GetUserRolesResponse::role_keys() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:siqi.auth.GetUserRolesResponse.role_keys)
-  return _internal_role_keys();
-}
-inline ::google::protobuf::RepeatedPtrField<std::string>*
-GetUserRolesResponse::mutable_role_keys() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:siqi.auth.GetUserRolesResponse.role_keys)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_role_keys();
-}
-inline const ::google::protobuf::RepeatedPtrField<std::string>&
-GetUserRolesResponse::_internal_role_keys() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.role_keys_;
-}
-inline ::google::protobuf::RepeatedPtrField<std::string>*
-GetUserRolesResponse::_internal_mutable_role_keys() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.role_keys_;
-}
-
-// -------------------------------------------------------------------
-
-// CreateAppRequest
-
-// string app_name = 2;
-inline void CreateAppRequest::clear_app_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_name_.ClearToEmpty();
-}
-inline const std::string& CreateAppRequest::app_name() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.CreateAppRequest.app_name)
-  return _internal_app_name();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CreateAppRequest::set_app_name(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_name_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.CreateAppRequest.app_name)
-}
-inline std::string* CreateAppRequest::mutable_app_name() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_name();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.CreateAppRequest.app_name)
-  return _s;
-}
-inline const std::string& CreateAppRequest::_internal_app_name() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_name_.Get();
-}
-inline void CreateAppRequest::_internal_set_app_name(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_name_.Set(value, GetArena());
-}
-inline std::string* CreateAppRequest::_internal_mutable_app_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_name_.Mutable( GetArena());
-}
-inline std::string* CreateAppRequest::release_app_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.CreateAppRequest.app_name)
-  return _impl_.app_name_.Release();
-}
-inline void CreateAppRequest::set_allocated_app_name(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_name_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_name_.IsDefault()) {
-    _impl_.app_name_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.CreateAppRequest.app_name)
-}
-
-// string app_code = 3;
-inline void CreateAppRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& CreateAppRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.CreateAppRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CreateAppRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.CreateAppRequest.app_code)
-}
-inline std::string* CreateAppRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.CreateAppRequest.app_code)
-  return _s;
-}
-inline const std::string& CreateAppRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void CreateAppRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* CreateAppRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* CreateAppRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.CreateAppRequest.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void CreateAppRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.CreateAppRequest.app_code)
-}
-
-// string description = 4;
-inline void CreateAppRequest::clear_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.ClearToEmpty();
-}
-inline const std::string& CreateAppRequest::description() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.CreateAppRequest.description)
-  return _internal_description();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CreateAppRequest::set_description(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.CreateAppRequest.description)
-}
-inline std::string* CreateAppRequest::mutable_description() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_description();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.CreateAppRequest.description)
-  return _s;
-}
-inline const std::string& CreateAppRequest::_internal_description() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.description_.Get();
-}
-inline void CreateAppRequest::_internal_set_description(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.Set(value, GetArena());
-}
-inline std::string* CreateAppRequest::_internal_mutable_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.description_.Mutable( GetArena());
-}
-inline std::string* CreateAppRequest::release_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.CreateAppRequest.description)
-  return _impl_.description_.Release();
-}
-inline void CreateAppRequest::set_allocated_description(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.description_.IsDefault()) {
-    _impl_.description_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.CreateAppRequest.description)
-}
-
-// -------------------------------------------------------------------
-
-// UpdateAppRequest
-
-// string app_code = 2;
-inline void UpdateAppRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& UpdateAppRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.UpdateAppRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void UpdateAppRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.UpdateAppRequest.app_code)
-}
-inline std::string* UpdateAppRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.UpdateAppRequest.app_code)
-  return _s;
-}
-inline const std::string& UpdateAppRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void UpdateAppRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* UpdateAppRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* UpdateAppRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.UpdateAppRequest.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void UpdateAppRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.UpdateAppRequest.app_code)
-}
-
-// optional string app_name = 3;
-inline bool UpdateAppRequest::has_app_name() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
-}
-inline void UpdateAppRequest::clear_app_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_name_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const std::string& UpdateAppRequest::app_name() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.UpdateAppRequest.app_name)
-  return _internal_app_name();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void UpdateAppRequest::set_app_name(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.app_name_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.UpdateAppRequest.app_name)
-}
-inline std::string* UpdateAppRequest::mutable_app_name() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_name();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.UpdateAppRequest.app_name)
-  return _s;
-}
-inline const std::string& UpdateAppRequest::_internal_app_name() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_name_.Get();
-}
-inline void UpdateAppRequest::_internal_set_app_name(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.app_name_.Set(value, GetArena());
-}
-inline std::string* UpdateAppRequest::_internal_mutable_app_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.app_name_.Mutable( GetArena());
-}
-inline std::string* UpdateAppRequest::release_app_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.UpdateAppRequest.app_name)
-  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* released = _impl_.app_name_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.app_name_.Set("", GetArena());
-  }
-  return released;
-}
-inline void UpdateAppRequest::set_allocated_app_name(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  _impl_.app_name_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_name_.IsDefault()) {
-    _impl_.app_name_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.UpdateAppRequest.app_name)
-}
-
-// optional string description = 4;
-inline bool UpdateAppRequest::has_description() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  return value;
-}
-inline void UpdateAppRequest::clear_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000002u;
-}
-inline const std::string& UpdateAppRequest::description() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.UpdateAppRequest.description)
-  return _internal_description();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void UpdateAppRequest::set_description(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.description_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.UpdateAppRequest.description)
-}
-inline std::string* UpdateAppRequest::mutable_description() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_description();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.UpdateAppRequest.description)
-  return _s;
-}
-inline const std::string& UpdateAppRequest::_internal_description() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.description_.Get();
-}
-inline void UpdateAppRequest::_internal_set_description(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.description_.Set(value, GetArena());
-}
-inline std::string* UpdateAppRequest::_internal_mutable_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  return _impl_.description_.Mutable( GetArena());
-}
-inline std::string* UpdateAppRequest::release_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.UpdateAppRequest.description)
-  if ((_impl_._has_bits_[0] & 0x00000002u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  auto* released = _impl_.description_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.description_.Set("", GetArena());
-  }
-  return released;
-}
-inline void UpdateAppRequest::set_allocated_description(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  _impl_.description_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.description_.IsDefault()) {
-    _impl_.description_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.UpdateAppRequest.description)
-}
-
-// optional int32 status = 5;
-inline bool UpdateAppRequest::has_status() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
-  return value;
-}
-inline void UpdateAppRequest::clear_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_ = 0;
-  _impl_._has_bits_[0] &= ~0x00000004u;
-}
-inline ::int32_t UpdateAppRequest::status() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.UpdateAppRequest.status)
-  return _internal_status();
-}
-inline void UpdateAppRequest::set_status(::int32_t value) {
-  _internal_set_status(value);
-  _impl_._has_bits_[0] |= 0x00000004u;
-  // @@protoc_insertion_point(field_set:siqi.auth.UpdateAppRequest.status)
-}
-inline ::int32_t UpdateAppRequest::_internal_status() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.status_;
-}
-inline void UpdateAppRequest::_internal_set_status(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_ = value;
-}
-
-// -------------------------------------------------------------------
-
-// DeleteAppRequest
-
-// string app_code = 2;
-inline void DeleteAppRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& DeleteAppRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.DeleteAppRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void DeleteAppRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.DeleteAppRequest.app_code)
-}
-inline std::string* DeleteAppRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.DeleteAppRequest.app_code)
-  return _s;
-}
-inline const std::string& DeleteAppRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void DeleteAppRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* DeleteAppRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* DeleteAppRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.DeleteAppRequest.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void DeleteAppRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.DeleteAppRequest.app_code)
-}
-
-// -------------------------------------------------------------------
-
-// GetAppRequest
-
-// string app_code = 1;
-inline void GetAppRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& GetAppRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetAppRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GetAppRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.GetAppRequest.app_code)
-}
-inline std::string* GetAppRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GetAppRequest.app_code)
-  return _s;
-}
-inline const std::string& GetAppRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void GetAppRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* GetAppRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* GetAppRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.GetAppRequest.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void GetAppRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.GetAppRequest.app_code)
-}
-
-// -------------------------------------------------------------------
-
-// GetAppResponse
-
-// int64 id = 1;
-inline void GetAppResponse::clear_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.id_ = ::int64_t{0};
-}
-inline ::int64_t GetAppResponse::id() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetAppResponse.id)
-  return _internal_id();
-}
-inline void GetAppResponse::set_id(::int64_t value) {
-  _internal_set_id(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.GetAppResponse.id)
-}
-inline ::int64_t GetAppResponse::_internal_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.id_;
-}
-inline void GetAppResponse::_internal_set_id(::int64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.id_ = value;
-}
-
-// string app_name = 2;
-inline void GetAppResponse::clear_app_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_name_.ClearToEmpty();
-}
-inline const std::string& GetAppResponse::app_name() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetAppResponse.app_name)
-  return _internal_app_name();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GetAppResponse::set_app_name(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_name_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.GetAppResponse.app_name)
-}
-inline std::string* GetAppResponse::mutable_app_name() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_name();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GetAppResponse.app_name)
-  return _s;
-}
-inline const std::string& GetAppResponse::_internal_app_name() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_name_.Get();
-}
-inline void GetAppResponse::_internal_set_app_name(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_name_.Set(value, GetArena());
-}
-inline std::string* GetAppResponse::_internal_mutable_app_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_name_.Mutable( GetArena());
-}
-inline std::string* GetAppResponse::release_app_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.GetAppResponse.app_name)
-  return _impl_.app_name_.Release();
-}
-inline void GetAppResponse::set_allocated_app_name(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_name_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_name_.IsDefault()) {
-    _impl_.app_name_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.GetAppResponse.app_name)
-}
-
-// string app_code = 3;
-inline void GetAppResponse::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& GetAppResponse::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetAppResponse.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GetAppResponse::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.GetAppResponse.app_code)
-}
-inline std::string* GetAppResponse::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GetAppResponse.app_code)
-  return _s;
-}
-inline const std::string& GetAppResponse::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void GetAppResponse::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* GetAppResponse::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* GetAppResponse::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.GetAppResponse.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void GetAppResponse::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.GetAppResponse.app_code)
-}
-
-// string app_secret = 4;
-inline void GetAppResponse::clear_app_secret() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_secret_.ClearToEmpty();
-}
-inline const std::string& GetAppResponse::app_secret() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetAppResponse.app_secret)
-  return _internal_app_secret();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GetAppResponse::set_app_secret(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_secret_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.GetAppResponse.app_secret)
-}
-inline std::string* GetAppResponse::mutable_app_secret() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_secret();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GetAppResponse.app_secret)
-  return _s;
-}
-inline const std::string& GetAppResponse::_internal_app_secret() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_secret_.Get();
-}
-inline void GetAppResponse::_internal_set_app_secret(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_secret_.Set(value, GetArena());
-}
-inline std::string* GetAppResponse::_internal_mutable_app_secret() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_secret_.Mutable( GetArena());
-}
-inline std::string* GetAppResponse::release_app_secret() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.GetAppResponse.app_secret)
-  return _impl_.app_secret_.Release();
-}
-inline void GetAppResponse::set_allocated_app_secret(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_secret_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_secret_.IsDefault()) {
-    _impl_.app_secret_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.GetAppResponse.app_secret)
-}
-
-// string description = 5;
-inline void GetAppResponse::clear_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.ClearToEmpty();
-}
-inline const std::string& GetAppResponse::description() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetAppResponse.description)
-  return _internal_description();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GetAppResponse::set_description(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.GetAppResponse.description)
-}
-inline std::string* GetAppResponse::mutable_description() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_description();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GetAppResponse.description)
-  return _s;
-}
-inline const std::string& GetAppResponse::_internal_description() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.description_.Get();
-}
-inline void GetAppResponse::_internal_set_description(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.Set(value, GetArena());
-}
-inline std::string* GetAppResponse::_internal_mutable_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.description_.Mutable( GetArena());
-}
-inline std::string* GetAppResponse::release_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.GetAppResponse.description)
-  return _impl_.description_.Release();
-}
-inline void GetAppResponse::set_allocated_description(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.description_.IsDefault()) {
-    _impl_.description_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.GetAppResponse.description)
-}
-
-// int32 status = 6;
-inline void GetAppResponse::clear_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_ = 0;
-}
-inline ::int32_t GetAppResponse::status() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetAppResponse.status)
-  return _internal_status();
-}
-inline void GetAppResponse::set_status(::int32_t value) {
-  _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.GetAppResponse.status)
-}
-inline ::int32_t GetAppResponse::_internal_status() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.status_;
-}
-inline void GetAppResponse::_internal_set_status(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_ = value;
-}
-
-// string created_at = 7;
-inline void GetAppResponse::clear_created_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.ClearToEmpty();
-}
-inline const std::string& GetAppResponse::created_at() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetAppResponse.created_at)
-  return _internal_created_at();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GetAppResponse::set_created_at(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.GetAppResponse.created_at)
-}
-inline std::string* GetAppResponse::mutable_created_at() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_created_at();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GetAppResponse.created_at)
-  return _s;
-}
-inline const std::string& GetAppResponse::_internal_created_at() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.created_at_.Get();
-}
-inline void GetAppResponse::_internal_set_created_at(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.Set(value, GetArena());
-}
-inline std::string* GetAppResponse::_internal_mutable_created_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.created_at_.Mutable( GetArena());
-}
-inline std::string* GetAppResponse::release_created_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.GetAppResponse.created_at)
-  return _impl_.created_at_.Release();
-}
-inline void GetAppResponse::set_allocated_created_at(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.created_at_.IsDefault()) {
-    _impl_.created_at_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.GetAppResponse.created_at)
-}
-
-// string updated_at = 8;
-inline void GetAppResponse::clear_updated_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.updated_at_.ClearToEmpty();
-}
-inline const std::string& GetAppResponse::updated_at() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetAppResponse.updated_at)
-  return _internal_updated_at();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GetAppResponse::set_updated_at(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.updated_at_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.GetAppResponse.updated_at)
-}
-inline std::string* GetAppResponse::mutable_updated_at() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_updated_at();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GetAppResponse.updated_at)
-  return _s;
-}
-inline const std::string& GetAppResponse::_internal_updated_at() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.updated_at_.Get();
-}
-inline void GetAppResponse::_internal_set_updated_at(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.updated_at_.Set(value, GetArena());
-}
-inline std::string* GetAppResponse::_internal_mutable_updated_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.updated_at_.Mutable( GetArena());
-}
-inline std::string* GetAppResponse::release_updated_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.GetAppResponse.updated_at)
-  return _impl_.updated_at_.Release();
-}
-inline void GetAppResponse::set_allocated_updated_at(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.updated_at_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.updated_at_.IsDefault()) {
-    _impl_.updated_at_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.GetAppResponse.updated_at)
-}
-
-// -------------------------------------------------------------------
-
-// ListAppsRequest
-
-// int32 page = 1;
-inline void ListAppsRequest::clear_page() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = 0;
-}
-inline ::int32_t ListAppsRequest::page() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAppsRequest.page)
-  return _internal_page();
-}
-inline void ListAppsRequest::set_page(::int32_t value) {
-  _internal_set_page(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAppsRequest.page)
-}
-inline ::int32_t ListAppsRequest::_internal_page() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_;
-}
-inline void ListAppsRequest::_internal_set_page(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = value;
-}
-
-// int32 page_size = 2;
-inline void ListAppsRequest::clear_page_size() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = 0;
-}
-inline ::int32_t ListAppsRequest::page_size() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAppsRequest.page_size)
-  return _internal_page_size();
-}
-inline void ListAppsRequest::set_page_size(::int32_t value) {
-  _internal_set_page_size(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAppsRequest.page_size)
-}
-inline ::int32_t ListAppsRequest::_internal_page_size() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_size_;
-}
-inline void ListAppsRequest::_internal_set_page_size(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = value;
-}
-
-// optional string app_name = 3;
-inline bool ListAppsRequest::has_app_name() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
-}
-inline void ListAppsRequest::clear_app_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_name_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const std::string& ListAppsRequest::app_name() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAppsRequest.app_name)
-  return _internal_app_name();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListAppsRequest::set_app_name(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.app_name_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAppsRequest.app_name)
-}
-inline std::string* ListAppsRequest::mutable_app_name() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_name();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListAppsRequest.app_name)
-  return _s;
-}
-inline const std::string& ListAppsRequest::_internal_app_name() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_name_.Get();
-}
-inline void ListAppsRequest::_internal_set_app_name(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.app_name_.Set(value, GetArena());
-}
-inline std::string* ListAppsRequest::_internal_mutable_app_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.app_name_.Mutable( GetArena());
-}
-inline std::string* ListAppsRequest::release_app_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListAppsRequest.app_name)
-  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* released = _impl_.app_name_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.app_name_.Set("", GetArena());
-  }
-  return released;
-}
-inline void ListAppsRequest::set_allocated_app_name(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  _impl_.app_name_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_name_.IsDefault()) {
-    _impl_.app_name_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListAppsRequest.app_name)
-}
-
-// optional int32 status = 4;
-inline bool ListAppsRequest::has_status() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  return value;
-}
-inline void ListAppsRequest::clear_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_ = 0;
-  _impl_._has_bits_[0] &= ~0x00000002u;
-}
-inline ::int32_t ListAppsRequest::status() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAppsRequest.status)
-  return _internal_status();
-}
-inline void ListAppsRequest::set_status(::int32_t value) {
-  _internal_set_status(value);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAppsRequest.status)
-}
-inline ::int32_t ListAppsRequest::_internal_status() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.status_;
-}
-inline void ListAppsRequest::_internal_set_status(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_ = value;
-}
-
-// -------------------------------------------------------------------
-
-// ListAppsResponse
-
-// repeated .siqi.auth.GetAppResponse apps = 1;
-inline int ListAppsResponse::_internal_apps_size() const {
-  return _internal_apps().size();
-}
-inline int ListAppsResponse::apps_size() const {
-  return _internal_apps_size();
-}
-inline void ListAppsResponse::clear_apps() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.apps_.Clear();
-}
-inline ::siqi::auth::GetAppResponse* ListAppsResponse::mutable_apps(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListAppsResponse.apps)
-  return _internal_mutable_apps()->Mutable(index);
-}
-inline ::google::protobuf::RepeatedPtrField<::siqi::auth::GetAppResponse>* ListAppsResponse::mutable_apps()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:siqi.auth.ListAppsResponse.apps)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_apps();
-}
-inline const ::siqi::auth::GetAppResponse& ListAppsResponse::apps(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAppsResponse.apps)
-  return _internal_apps().Get(index);
-}
-inline ::siqi::auth::GetAppResponse* ListAppsResponse::add_apps() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::siqi::auth::GetAppResponse* _add = _internal_mutable_apps()->Add();
-  // @@protoc_insertion_point(field_add:siqi.auth.ListAppsResponse.apps)
-  return _add;
-}
-inline const ::google::protobuf::RepeatedPtrField<::siqi::auth::GetAppResponse>& ListAppsResponse::apps() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:siqi.auth.ListAppsResponse.apps)
-  return _internal_apps();
-}
-inline const ::google::protobuf::RepeatedPtrField<::siqi::auth::GetAppResponse>&
-ListAppsResponse::_internal_apps() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.apps_;
-}
-inline ::google::protobuf::RepeatedPtrField<::siqi::auth::GetAppResponse>*
-ListAppsResponse::_internal_mutable_apps() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.apps_;
-}
-
-// int64 total = 2;
-inline void ListAppsResponse::clear_total() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.total_ = ::int64_t{0};
-}
-inline ::int64_t ListAppsResponse::total() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAppsResponse.total)
-  return _internal_total();
-}
-inline void ListAppsResponse::set_total(::int64_t value) {
-  _internal_set_total(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAppsResponse.total)
-}
-inline ::int64_t ListAppsResponse::_internal_total() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.total_;
-}
-inline void ListAppsResponse::_internal_set_total(::int64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.total_ = value;
-}
-
-// int32 page = 3;
-inline void ListAppsResponse::clear_page() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = 0;
-}
-inline ::int32_t ListAppsResponse::page() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAppsResponse.page)
-  return _internal_page();
-}
-inline void ListAppsResponse::set_page(::int32_t value) {
-  _internal_set_page(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAppsResponse.page)
-}
-inline ::int32_t ListAppsResponse::_internal_page() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_;
-}
-inline void ListAppsResponse::_internal_set_page(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = value;
-}
-
-// int32 page_size = 4;
-inline void ListAppsResponse::clear_page_size() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = 0;
-}
-inline ::int32_t ListAppsResponse::page_size() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAppsResponse.page_size)
-  return _internal_page_size();
-}
-inline void ListAppsResponse::set_page_size(::int32_t value) {
-  _internal_set_page_size(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAppsResponse.page_size)
-}
-inline ::int32_t ListAppsResponse::_internal_page_size() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_size_;
-}
-inline void ListAppsResponse::_internal_set_page_size(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = value;
-}
-
-// -------------------------------------------------------------------
-
-// CreatePermissionRequest
-
-// string app_code = 2;
-inline void CreatePermissionRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& CreatePermissionRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.CreatePermissionRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CreatePermissionRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.CreatePermissionRequest.app_code)
-}
-inline std::string* CreatePermissionRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.CreatePermissionRequest.app_code)
-  return _s;
-}
-inline const std::string& CreatePermissionRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void CreatePermissionRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* CreatePermissionRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* CreatePermissionRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.CreatePermissionRequest.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void CreatePermissionRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.CreatePermissionRequest.app_code)
-}
-
-// string perm_name = 3;
-inline void CreatePermissionRequest::clear_perm_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_name_.ClearToEmpty();
-}
-inline const std::string& CreatePermissionRequest::perm_name() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.CreatePermissionRequest.perm_name)
-  return _internal_perm_name();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CreatePermissionRequest::set_perm_name(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_name_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.CreatePermissionRequest.perm_name)
-}
-inline std::string* CreatePermissionRequest::mutable_perm_name() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_perm_name();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.CreatePermissionRequest.perm_name)
-  return _s;
-}
-inline const std::string& CreatePermissionRequest::_internal_perm_name() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.perm_name_.Get();
-}
-inline void CreatePermissionRequest::_internal_set_perm_name(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_name_.Set(value, GetArena());
-}
-inline std::string* CreatePermissionRequest::_internal_mutable_perm_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.perm_name_.Mutable( GetArena());
-}
-inline std::string* CreatePermissionRequest::release_perm_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.CreatePermissionRequest.perm_name)
-  return _impl_.perm_name_.Release();
-}
-inline void CreatePermissionRequest::set_allocated_perm_name(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_name_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.perm_name_.IsDefault()) {
-    _impl_.perm_name_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.CreatePermissionRequest.perm_name)
-}
-
-// string perm_key = 4;
-inline void CreatePermissionRequest::clear_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.ClearToEmpty();
-}
-inline const std::string& CreatePermissionRequest::perm_key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.CreatePermissionRequest.perm_key)
-  return _internal_perm_key();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CreatePermissionRequest::set_perm_key(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.CreatePermissionRequest.perm_key)
-}
-inline std::string* CreatePermissionRequest::mutable_perm_key() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_perm_key();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.CreatePermissionRequest.perm_key)
-  return _s;
-}
-inline const std::string& CreatePermissionRequest::_internal_perm_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.perm_key_.Get();
-}
-inline void CreatePermissionRequest::_internal_set_perm_key(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.Set(value, GetArena());
-}
-inline std::string* CreatePermissionRequest::_internal_mutable_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.perm_key_.Mutable( GetArena());
-}
-inline std::string* CreatePermissionRequest::release_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.CreatePermissionRequest.perm_key)
-  return _impl_.perm_key_.Release();
-}
-inline void CreatePermissionRequest::set_allocated_perm_key(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.perm_key_.IsDefault()) {
-    _impl_.perm_key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.CreatePermissionRequest.perm_key)
-}
-
-// string description = 5;
-inline void CreatePermissionRequest::clear_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.ClearToEmpty();
-}
-inline const std::string& CreatePermissionRequest::description() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.CreatePermissionRequest.description)
-  return _internal_description();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CreatePermissionRequest::set_description(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.CreatePermissionRequest.description)
-}
-inline std::string* CreatePermissionRequest::mutable_description() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_description();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.CreatePermissionRequest.description)
-  return _s;
-}
-inline const std::string& CreatePermissionRequest::_internal_description() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.description_.Get();
-}
-inline void CreatePermissionRequest::_internal_set_description(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.Set(value, GetArena());
-}
-inline std::string* CreatePermissionRequest::_internal_mutable_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.description_.Mutable( GetArena());
-}
-inline std::string* CreatePermissionRequest::release_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.CreatePermissionRequest.description)
-  return _impl_.description_.Release();
-}
-inline void CreatePermissionRequest::set_allocated_description(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.description_.IsDefault()) {
-    _impl_.description_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.CreatePermissionRequest.description)
-}
-
-// -------------------------------------------------------------------
-
-// UpdatePermissionRequest
-
-// string app_code = 2;
-inline void UpdatePermissionRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& UpdatePermissionRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.UpdatePermissionRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void UpdatePermissionRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.UpdatePermissionRequest.app_code)
-}
-inline std::string* UpdatePermissionRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.UpdatePermissionRequest.app_code)
-  return _s;
-}
-inline const std::string& UpdatePermissionRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void UpdatePermissionRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* UpdatePermissionRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* UpdatePermissionRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.UpdatePermissionRequest.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void UpdatePermissionRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.UpdatePermissionRequest.app_code)
-}
-
-// string perm_key = 3;
-inline void UpdatePermissionRequest::clear_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.ClearToEmpty();
-}
-inline const std::string& UpdatePermissionRequest::perm_key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.UpdatePermissionRequest.perm_key)
-  return _internal_perm_key();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void UpdatePermissionRequest::set_perm_key(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.UpdatePermissionRequest.perm_key)
-}
-inline std::string* UpdatePermissionRequest::mutable_perm_key() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_perm_key();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.UpdatePermissionRequest.perm_key)
-  return _s;
-}
-inline const std::string& UpdatePermissionRequest::_internal_perm_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.perm_key_.Get();
-}
-inline void UpdatePermissionRequest::_internal_set_perm_key(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.Set(value, GetArena());
-}
-inline std::string* UpdatePermissionRequest::_internal_mutable_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.perm_key_.Mutable( GetArena());
-}
-inline std::string* UpdatePermissionRequest::release_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.UpdatePermissionRequest.perm_key)
-  return _impl_.perm_key_.Release();
-}
-inline void UpdatePermissionRequest::set_allocated_perm_key(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.perm_key_.IsDefault()) {
-    _impl_.perm_key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.UpdatePermissionRequest.perm_key)
-}
-
-// optional string perm_name = 4;
-inline bool UpdatePermissionRequest::has_perm_name() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
-}
-inline void UpdatePermissionRequest::clear_perm_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_name_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const std::string& UpdatePermissionRequest::perm_name() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.UpdatePermissionRequest.perm_name)
-  return _internal_perm_name();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void UpdatePermissionRequest::set_perm_name(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.perm_name_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.UpdatePermissionRequest.perm_name)
-}
-inline std::string* UpdatePermissionRequest::mutable_perm_name() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_perm_name();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.UpdatePermissionRequest.perm_name)
-  return _s;
-}
-inline const std::string& UpdatePermissionRequest::_internal_perm_name() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.perm_name_.Get();
-}
-inline void UpdatePermissionRequest::_internal_set_perm_name(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.perm_name_.Set(value, GetArena());
-}
-inline std::string* UpdatePermissionRequest::_internal_mutable_perm_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.perm_name_.Mutable( GetArena());
-}
-inline std::string* UpdatePermissionRequest::release_perm_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.UpdatePermissionRequest.perm_name)
-  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* released = _impl_.perm_name_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.perm_name_.Set("", GetArena());
-  }
-  return released;
-}
-inline void UpdatePermissionRequest::set_allocated_perm_name(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  _impl_.perm_name_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.perm_name_.IsDefault()) {
-    _impl_.perm_name_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.UpdatePermissionRequest.perm_name)
-}
-
-// optional string description = 5;
-inline bool UpdatePermissionRequest::has_description() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  return value;
-}
-inline void UpdatePermissionRequest::clear_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000002u;
-}
-inline const std::string& UpdatePermissionRequest::description() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.UpdatePermissionRequest.description)
-  return _internal_description();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void UpdatePermissionRequest::set_description(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.description_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.UpdatePermissionRequest.description)
-}
-inline std::string* UpdatePermissionRequest::mutable_description() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_description();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.UpdatePermissionRequest.description)
-  return _s;
-}
-inline const std::string& UpdatePermissionRequest::_internal_description() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.description_.Get();
-}
-inline void UpdatePermissionRequest::_internal_set_description(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.description_.Set(value, GetArena());
-}
-inline std::string* UpdatePermissionRequest::_internal_mutable_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  return _impl_.description_.Mutable( GetArena());
-}
-inline std::string* UpdatePermissionRequest::release_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.UpdatePermissionRequest.description)
-  if ((_impl_._has_bits_[0] & 0x00000002u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  auto* released = _impl_.description_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.description_.Set("", GetArena());
-  }
-  return released;
-}
-inline void UpdatePermissionRequest::set_allocated_description(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  _impl_.description_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.description_.IsDefault()) {
-    _impl_.description_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.UpdatePermissionRequest.description)
-}
-
-// -------------------------------------------------------------------
-
-// DeletePermissionRequest
-
-// string app_code = 2;
-inline void DeletePermissionRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& DeletePermissionRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.DeletePermissionRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void DeletePermissionRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.DeletePermissionRequest.app_code)
-}
-inline std::string* DeletePermissionRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.DeletePermissionRequest.app_code)
-  return _s;
-}
-inline const std::string& DeletePermissionRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void DeletePermissionRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* DeletePermissionRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* DeletePermissionRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.DeletePermissionRequest.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void DeletePermissionRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.DeletePermissionRequest.app_code)
-}
-
-// string perm_key = 3;
-inline void DeletePermissionRequest::clear_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.ClearToEmpty();
-}
-inline const std::string& DeletePermissionRequest::perm_key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.DeletePermissionRequest.perm_key)
-  return _internal_perm_key();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void DeletePermissionRequest::set_perm_key(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.DeletePermissionRequest.perm_key)
-}
-inline std::string* DeletePermissionRequest::mutable_perm_key() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_perm_key();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.DeletePermissionRequest.perm_key)
-  return _s;
-}
-inline const std::string& DeletePermissionRequest::_internal_perm_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.perm_key_.Get();
-}
-inline void DeletePermissionRequest::_internal_set_perm_key(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.Set(value, GetArena());
-}
-inline std::string* DeletePermissionRequest::_internal_mutable_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.perm_key_.Mutable( GetArena());
-}
-inline std::string* DeletePermissionRequest::release_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.DeletePermissionRequest.perm_key)
-  return _impl_.perm_key_.Release();
-}
-inline void DeletePermissionRequest::set_allocated_perm_key(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.perm_key_.IsDefault()) {
-    _impl_.perm_key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.DeletePermissionRequest.perm_key)
-}
-
-// -------------------------------------------------------------------
-
-// ListPermissionsRequest
-
-// string app_code = 1;
-inline void ListPermissionsRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& ListPermissionsRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListPermissionsRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListPermissionsRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListPermissionsRequest.app_code)
-}
-inline std::string* ListPermissionsRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListPermissionsRequest.app_code)
-  return _s;
-}
-inline const std::string& ListPermissionsRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void ListPermissionsRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* ListPermissionsRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* ListPermissionsRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListPermissionsRequest.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void ListPermissionsRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListPermissionsRequest.app_code)
-}
-
-// int32 page = 2;
-inline void ListPermissionsRequest::clear_page() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = 0;
-}
-inline ::int32_t ListPermissionsRequest::page() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListPermissionsRequest.page)
-  return _internal_page();
-}
-inline void ListPermissionsRequest::set_page(::int32_t value) {
-  _internal_set_page(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListPermissionsRequest.page)
-}
-inline ::int32_t ListPermissionsRequest::_internal_page() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_;
-}
-inline void ListPermissionsRequest::_internal_set_page(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = value;
-}
-
-// int32 page_size = 3;
-inline void ListPermissionsRequest::clear_page_size() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = 0;
-}
-inline ::int32_t ListPermissionsRequest::page_size() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListPermissionsRequest.page_size)
-  return _internal_page_size();
-}
-inline void ListPermissionsRequest::set_page_size(::int32_t value) {
-  _internal_set_page_size(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListPermissionsRequest.page_size)
-}
-inline ::int32_t ListPermissionsRequest::_internal_page_size() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_size_;
-}
-inline void ListPermissionsRequest::_internal_set_page_size(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = value;
-}
-
-// optional string perm_name = 4;
-inline bool ListPermissionsRequest::has_perm_name() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
-}
-inline void ListPermissionsRequest::clear_perm_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_name_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const std::string& ListPermissionsRequest::perm_name() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListPermissionsRequest.perm_name)
-  return _internal_perm_name();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListPermissionsRequest::set_perm_name(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.perm_name_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListPermissionsRequest.perm_name)
-}
-inline std::string* ListPermissionsRequest::mutable_perm_name() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_perm_name();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListPermissionsRequest.perm_name)
-  return _s;
-}
-inline const std::string& ListPermissionsRequest::_internal_perm_name() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.perm_name_.Get();
-}
-inline void ListPermissionsRequest::_internal_set_perm_name(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.perm_name_.Set(value, GetArena());
-}
-inline std::string* ListPermissionsRequest::_internal_mutable_perm_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.perm_name_.Mutable( GetArena());
-}
-inline std::string* ListPermissionsRequest::release_perm_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListPermissionsRequest.perm_name)
-  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* released = _impl_.perm_name_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.perm_name_.Set("", GetArena());
-  }
-  return released;
-}
-inline void ListPermissionsRequest::set_allocated_perm_name(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  _impl_.perm_name_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.perm_name_.IsDefault()) {
-    _impl_.perm_name_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListPermissionsRequest.perm_name)
-}
-
-// optional string perm_key = 5;
-inline bool ListPermissionsRequest::has_perm_key() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  return value;
-}
-inline void ListPermissionsRequest::clear_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000002u;
-}
-inline const std::string& ListPermissionsRequest::perm_key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListPermissionsRequest.perm_key)
-  return _internal_perm_key();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListPermissionsRequest::set_perm_key(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.perm_key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListPermissionsRequest.perm_key)
-}
-inline std::string* ListPermissionsRequest::mutable_perm_key() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_perm_key();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListPermissionsRequest.perm_key)
-  return _s;
-}
-inline const std::string& ListPermissionsRequest::_internal_perm_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.perm_key_.Get();
-}
-inline void ListPermissionsRequest::_internal_set_perm_key(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.perm_key_.Set(value, GetArena());
-}
-inline std::string* ListPermissionsRequest::_internal_mutable_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  return _impl_.perm_key_.Mutable( GetArena());
-}
-inline std::string* ListPermissionsRequest::release_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListPermissionsRequest.perm_key)
-  if ((_impl_._has_bits_[0] & 0x00000002u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  auto* released = _impl_.perm_key_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.perm_key_.Set("", GetArena());
-  }
-  return released;
-}
-inline void ListPermissionsRequest::set_allocated_perm_key(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  _impl_.perm_key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.perm_key_.IsDefault()) {
-    _impl_.perm_key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListPermissionsRequest.perm_key)
-}
-
-// -------------------------------------------------------------------
-
-// ListPermissionsResponse_Permission
-
-// int64 id = 1;
-inline void ListPermissionsResponse_Permission::clear_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.id_ = ::int64_t{0};
-}
-inline ::int64_t ListPermissionsResponse_Permission::id() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListPermissionsResponse.Permission.id)
-  return _internal_id();
-}
-inline void ListPermissionsResponse_Permission::set_id(::int64_t value) {
-  _internal_set_id(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListPermissionsResponse.Permission.id)
-}
-inline ::int64_t ListPermissionsResponse_Permission::_internal_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.id_;
-}
-inline void ListPermissionsResponse_Permission::_internal_set_id(::int64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.id_ = value;
-}
-
-// string perm_name = 2;
-inline void ListPermissionsResponse_Permission::clear_perm_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_name_.ClearToEmpty();
-}
-inline const std::string& ListPermissionsResponse_Permission::perm_name() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListPermissionsResponse.Permission.perm_name)
-  return _internal_perm_name();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListPermissionsResponse_Permission::set_perm_name(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_name_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListPermissionsResponse.Permission.perm_name)
-}
-inline std::string* ListPermissionsResponse_Permission::mutable_perm_name() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_perm_name();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListPermissionsResponse.Permission.perm_name)
-  return _s;
-}
-inline const std::string& ListPermissionsResponse_Permission::_internal_perm_name() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.perm_name_.Get();
-}
-inline void ListPermissionsResponse_Permission::_internal_set_perm_name(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_name_.Set(value, GetArena());
-}
-inline std::string* ListPermissionsResponse_Permission::_internal_mutable_perm_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.perm_name_.Mutable( GetArena());
-}
-inline std::string* ListPermissionsResponse_Permission::release_perm_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListPermissionsResponse.Permission.perm_name)
-  return _impl_.perm_name_.Release();
-}
-inline void ListPermissionsResponse_Permission::set_allocated_perm_name(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_name_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.perm_name_.IsDefault()) {
-    _impl_.perm_name_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListPermissionsResponse.Permission.perm_name)
-}
-
-// string perm_key = 3;
-inline void ListPermissionsResponse_Permission::clear_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.ClearToEmpty();
-}
-inline const std::string& ListPermissionsResponse_Permission::perm_key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListPermissionsResponse.Permission.perm_key)
-  return _internal_perm_key();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListPermissionsResponse_Permission::set_perm_key(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListPermissionsResponse.Permission.perm_key)
-}
-inline std::string* ListPermissionsResponse_Permission::mutable_perm_key() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_perm_key();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListPermissionsResponse.Permission.perm_key)
-  return _s;
-}
-inline const std::string& ListPermissionsResponse_Permission::_internal_perm_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.perm_key_.Get();
-}
-inline void ListPermissionsResponse_Permission::_internal_set_perm_key(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.Set(value, GetArena());
-}
-inline std::string* ListPermissionsResponse_Permission::_internal_mutable_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.perm_key_.Mutable( GetArena());
-}
-inline std::string* ListPermissionsResponse_Permission::release_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListPermissionsResponse.Permission.perm_key)
-  return _impl_.perm_key_.Release();
-}
-inline void ListPermissionsResponse_Permission::set_allocated_perm_key(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.perm_key_.IsDefault()) {
-    _impl_.perm_key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListPermissionsResponse.Permission.perm_key)
-}
-
-// string description = 4;
-inline void ListPermissionsResponse_Permission::clear_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.ClearToEmpty();
-}
-inline const std::string& ListPermissionsResponse_Permission::description() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListPermissionsResponse.Permission.description)
-  return _internal_description();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListPermissionsResponse_Permission::set_description(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListPermissionsResponse.Permission.description)
-}
-inline std::string* ListPermissionsResponse_Permission::mutable_description() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_description();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListPermissionsResponse.Permission.description)
-  return _s;
-}
-inline const std::string& ListPermissionsResponse_Permission::_internal_description() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.description_.Get();
-}
-inline void ListPermissionsResponse_Permission::_internal_set_description(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.Set(value, GetArena());
-}
-inline std::string* ListPermissionsResponse_Permission::_internal_mutable_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.description_.Mutable( GetArena());
-}
-inline std::string* ListPermissionsResponse_Permission::release_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListPermissionsResponse.Permission.description)
-  return _impl_.description_.Release();
-}
-inline void ListPermissionsResponse_Permission::set_allocated_description(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.description_.IsDefault()) {
-    _impl_.description_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListPermissionsResponse.Permission.description)
-}
-
-// string created_at = 5;
-inline void ListPermissionsResponse_Permission::clear_created_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.ClearToEmpty();
-}
-inline const std::string& ListPermissionsResponse_Permission::created_at() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListPermissionsResponse.Permission.created_at)
-  return _internal_created_at();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListPermissionsResponse_Permission::set_created_at(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListPermissionsResponse.Permission.created_at)
-}
-inline std::string* ListPermissionsResponse_Permission::mutable_created_at() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_created_at();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListPermissionsResponse.Permission.created_at)
-  return _s;
-}
-inline const std::string& ListPermissionsResponse_Permission::_internal_created_at() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.created_at_.Get();
-}
-inline void ListPermissionsResponse_Permission::_internal_set_created_at(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.Set(value, GetArena());
-}
-inline std::string* ListPermissionsResponse_Permission::_internal_mutable_created_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.created_at_.Mutable( GetArena());
-}
-inline std::string* ListPermissionsResponse_Permission::release_created_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListPermissionsResponse.Permission.created_at)
-  return _impl_.created_at_.Release();
-}
-inline void ListPermissionsResponse_Permission::set_allocated_created_at(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.created_at_.IsDefault()) {
-    _impl_.created_at_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListPermissionsResponse.Permission.created_at)
-}
-
-// string updated_at = 6;
-inline void ListPermissionsResponse_Permission::clear_updated_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.updated_at_.ClearToEmpty();
-}
-inline const std::string& ListPermissionsResponse_Permission::updated_at() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListPermissionsResponse.Permission.updated_at)
-  return _internal_updated_at();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListPermissionsResponse_Permission::set_updated_at(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.updated_at_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListPermissionsResponse.Permission.updated_at)
-}
-inline std::string* ListPermissionsResponse_Permission::mutable_updated_at() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_updated_at();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListPermissionsResponse.Permission.updated_at)
-  return _s;
-}
-inline const std::string& ListPermissionsResponse_Permission::_internal_updated_at() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.updated_at_.Get();
-}
-inline void ListPermissionsResponse_Permission::_internal_set_updated_at(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.updated_at_.Set(value, GetArena());
-}
-inline std::string* ListPermissionsResponse_Permission::_internal_mutable_updated_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.updated_at_.Mutable( GetArena());
-}
-inline std::string* ListPermissionsResponse_Permission::release_updated_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListPermissionsResponse.Permission.updated_at)
-  return _impl_.updated_at_.Release();
-}
-inline void ListPermissionsResponse_Permission::set_allocated_updated_at(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.updated_at_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.updated_at_.IsDefault()) {
-    _impl_.updated_at_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListPermissionsResponse.Permission.updated_at)
-}
-
-// -------------------------------------------------------------------
-
-// ListPermissionsResponse
-
-// repeated .siqi.auth.ListPermissionsResponse.Permission permissions = 1;
-inline int ListPermissionsResponse::_internal_permissions_size() const {
-  return _internal_permissions().size();
-}
-inline int ListPermissionsResponse::permissions_size() const {
-  return _internal_permissions_size();
-}
-inline void ListPermissionsResponse::clear_permissions() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.permissions_.Clear();
-}
-inline ::siqi::auth::ListPermissionsResponse_Permission* ListPermissionsResponse::mutable_permissions(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListPermissionsResponse.permissions)
-  return _internal_mutable_permissions()->Mutable(index);
-}
-inline ::google::protobuf::RepeatedPtrField<::siqi::auth::ListPermissionsResponse_Permission>* ListPermissionsResponse::mutable_permissions()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:siqi.auth.ListPermissionsResponse.permissions)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_permissions();
-}
-inline const ::siqi::auth::ListPermissionsResponse_Permission& ListPermissionsResponse::permissions(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListPermissionsResponse.permissions)
-  return _internal_permissions().Get(index);
-}
-inline ::siqi::auth::ListPermissionsResponse_Permission* ListPermissionsResponse::add_permissions() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::siqi::auth::ListPermissionsResponse_Permission* _add = _internal_mutable_permissions()->Add();
-  // @@protoc_insertion_point(field_add:siqi.auth.ListPermissionsResponse.permissions)
-  return _add;
-}
-inline const ::google::protobuf::RepeatedPtrField<::siqi::auth::ListPermissionsResponse_Permission>& ListPermissionsResponse::permissions() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:siqi.auth.ListPermissionsResponse.permissions)
-  return _internal_permissions();
-}
-inline const ::google::protobuf::RepeatedPtrField<::siqi::auth::ListPermissionsResponse_Permission>&
-ListPermissionsResponse::_internal_permissions() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.permissions_;
-}
-inline ::google::protobuf::RepeatedPtrField<::siqi::auth::ListPermissionsResponse_Permission>*
-ListPermissionsResponse::_internal_mutable_permissions() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.permissions_;
-}
-
-// int64 total = 2;
-inline void ListPermissionsResponse::clear_total() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.total_ = ::int64_t{0};
-}
-inline ::int64_t ListPermissionsResponse::total() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListPermissionsResponse.total)
-  return _internal_total();
-}
-inline void ListPermissionsResponse::set_total(::int64_t value) {
-  _internal_set_total(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListPermissionsResponse.total)
-}
-inline ::int64_t ListPermissionsResponse::_internal_total() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.total_;
-}
-inline void ListPermissionsResponse::_internal_set_total(::int64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.total_ = value;
-}
-
-// int32 page = 3;
-inline void ListPermissionsResponse::clear_page() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = 0;
-}
-inline ::int32_t ListPermissionsResponse::page() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListPermissionsResponse.page)
-  return _internal_page();
-}
-inline void ListPermissionsResponse::set_page(::int32_t value) {
-  _internal_set_page(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListPermissionsResponse.page)
-}
-inline ::int32_t ListPermissionsResponse::_internal_page() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_;
-}
-inline void ListPermissionsResponse::_internal_set_page(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = value;
-}
-
-// int32 page_size = 4;
-inline void ListPermissionsResponse::clear_page_size() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = 0;
-}
-inline ::int32_t ListPermissionsResponse::page_size() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListPermissionsResponse.page_size)
-  return _internal_page_size();
-}
-inline void ListPermissionsResponse::set_page_size(::int32_t value) {
-  _internal_set_page_size(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListPermissionsResponse.page_size)
-}
-inline ::int32_t ListPermissionsResponse::_internal_page_size() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_size_;
-}
-inline void ListPermissionsResponse::_internal_set_page_size(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = value;
-}
-
-// -------------------------------------------------------------------
-
-// CreateRoleRequest
-
-// string app_code = 2;
-inline void CreateRoleRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& CreateRoleRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.CreateRoleRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CreateRoleRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.CreateRoleRequest.app_code)
-}
-inline std::string* CreateRoleRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.CreateRoleRequest.app_code)
-  return _s;
-}
-inline const std::string& CreateRoleRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void CreateRoleRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* CreateRoleRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* CreateRoleRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.CreateRoleRequest.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void CreateRoleRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.CreateRoleRequest.app_code)
-}
-
-// string role_name = 3;
-inline void CreateRoleRequest::clear_role_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_name_.ClearToEmpty();
-}
-inline const std::string& CreateRoleRequest::role_name() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.CreateRoleRequest.role_name)
-  return _internal_role_name();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CreateRoleRequest::set_role_name(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_name_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.CreateRoleRequest.role_name)
-}
-inline std::string* CreateRoleRequest::mutable_role_name() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_role_name();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.CreateRoleRequest.role_name)
-  return _s;
-}
-inline const std::string& CreateRoleRequest::_internal_role_name() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.role_name_.Get();
-}
-inline void CreateRoleRequest::_internal_set_role_name(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_name_.Set(value, GetArena());
-}
-inline std::string* CreateRoleRequest::_internal_mutable_role_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.role_name_.Mutable( GetArena());
-}
-inline std::string* CreateRoleRequest::release_role_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.CreateRoleRequest.role_name)
-  return _impl_.role_name_.Release();
-}
-inline void CreateRoleRequest::set_allocated_role_name(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_name_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.role_name_.IsDefault()) {
-    _impl_.role_name_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.CreateRoleRequest.role_name)
-}
-
-// string role_key = 4;
-inline void CreateRoleRequest::clear_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.ClearToEmpty();
-}
-inline const std::string& CreateRoleRequest::role_key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.CreateRoleRequest.role_key)
-  return _internal_role_key();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CreateRoleRequest::set_role_key(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.CreateRoleRequest.role_key)
-}
-inline std::string* CreateRoleRequest::mutable_role_key() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_role_key();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.CreateRoleRequest.role_key)
-  return _s;
-}
-inline const std::string& CreateRoleRequest::_internal_role_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.role_key_.Get();
-}
-inline void CreateRoleRequest::_internal_set_role_key(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.Set(value, GetArena());
-}
-inline std::string* CreateRoleRequest::_internal_mutable_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.role_key_.Mutable( GetArena());
-}
-inline std::string* CreateRoleRequest::release_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.CreateRoleRequest.role_key)
-  return _impl_.role_key_.Release();
-}
-inline void CreateRoleRequest::set_allocated_role_key(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.role_key_.IsDefault()) {
-    _impl_.role_key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.CreateRoleRequest.role_key)
-}
-
-// string description = 5;
-inline void CreateRoleRequest::clear_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.ClearToEmpty();
-}
-inline const std::string& CreateRoleRequest::description() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.CreateRoleRequest.description)
-  return _internal_description();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CreateRoleRequest::set_description(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.CreateRoleRequest.description)
-}
-inline std::string* CreateRoleRequest::mutable_description() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_description();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.CreateRoleRequest.description)
-  return _s;
-}
-inline const std::string& CreateRoleRequest::_internal_description() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.description_.Get();
-}
-inline void CreateRoleRequest::_internal_set_description(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.Set(value, GetArena());
-}
-inline std::string* CreateRoleRequest::_internal_mutable_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.description_.Mutable( GetArena());
-}
-inline std::string* CreateRoleRequest::release_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.CreateRoleRequest.description)
-  return _impl_.description_.Release();
-}
-inline void CreateRoleRequest::set_allocated_description(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.description_.IsDefault()) {
-    _impl_.description_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.CreateRoleRequest.description)
-}
-
-// bool is_default = 6;
-inline void CreateRoleRequest::clear_is_default() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.is_default_ = false;
-}
-inline bool CreateRoleRequest::is_default() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.CreateRoleRequest.is_default)
-  return _internal_is_default();
-}
-inline void CreateRoleRequest::set_is_default(bool value) {
-  _internal_set_is_default(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.CreateRoleRequest.is_default)
-}
-inline bool CreateRoleRequest::_internal_is_default() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.is_default_;
-}
-inline void CreateRoleRequest::_internal_set_is_default(bool value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.is_default_ = value;
-}
-
-// -------------------------------------------------------------------
-
-// UpdateRoleRequest
-
-// string app_code = 2;
-inline void UpdateRoleRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& UpdateRoleRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.UpdateRoleRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void UpdateRoleRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.UpdateRoleRequest.app_code)
-}
-inline std::string* UpdateRoleRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.UpdateRoleRequest.app_code)
-  return _s;
-}
-inline const std::string& UpdateRoleRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void UpdateRoleRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* UpdateRoleRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* UpdateRoleRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.UpdateRoleRequest.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void UpdateRoleRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.UpdateRoleRequest.app_code)
-}
-
-// string role_key = 3;
-inline void UpdateRoleRequest::clear_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.ClearToEmpty();
-}
-inline const std::string& UpdateRoleRequest::role_key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.UpdateRoleRequest.role_key)
-  return _internal_role_key();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void UpdateRoleRequest::set_role_key(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.UpdateRoleRequest.role_key)
-}
-inline std::string* UpdateRoleRequest::mutable_role_key() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_role_key();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.UpdateRoleRequest.role_key)
-  return _s;
-}
-inline const std::string& UpdateRoleRequest::_internal_role_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.role_key_.Get();
-}
-inline void UpdateRoleRequest::_internal_set_role_key(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.Set(value, GetArena());
-}
-inline std::string* UpdateRoleRequest::_internal_mutable_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.role_key_.Mutable( GetArena());
-}
-inline std::string* UpdateRoleRequest::release_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.UpdateRoleRequest.role_key)
-  return _impl_.role_key_.Release();
-}
-inline void UpdateRoleRequest::set_allocated_role_key(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.role_key_.IsDefault()) {
-    _impl_.role_key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.UpdateRoleRequest.role_key)
-}
-
-// optional string role_name = 4;
-inline bool UpdateRoleRequest::has_role_name() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
-}
-inline void UpdateRoleRequest::clear_role_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_name_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const std::string& UpdateRoleRequest::role_name() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.UpdateRoleRequest.role_name)
-  return _internal_role_name();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void UpdateRoleRequest::set_role_name(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.role_name_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.UpdateRoleRequest.role_name)
-}
-inline std::string* UpdateRoleRequest::mutable_role_name() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_role_name();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.UpdateRoleRequest.role_name)
-  return _s;
-}
-inline const std::string& UpdateRoleRequest::_internal_role_name() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.role_name_.Get();
-}
-inline void UpdateRoleRequest::_internal_set_role_name(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.role_name_.Set(value, GetArena());
-}
-inline std::string* UpdateRoleRequest::_internal_mutable_role_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.role_name_.Mutable( GetArena());
-}
-inline std::string* UpdateRoleRequest::release_role_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.UpdateRoleRequest.role_name)
-  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* released = _impl_.role_name_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.role_name_.Set("", GetArena());
-  }
-  return released;
-}
-inline void UpdateRoleRequest::set_allocated_role_name(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  _impl_.role_name_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.role_name_.IsDefault()) {
-    _impl_.role_name_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.UpdateRoleRequest.role_name)
-}
-
-// optional string description = 5;
-inline bool UpdateRoleRequest::has_description() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  return value;
-}
-inline void UpdateRoleRequest::clear_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000002u;
-}
-inline const std::string& UpdateRoleRequest::description() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.UpdateRoleRequest.description)
-  return _internal_description();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void UpdateRoleRequest::set_description(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.description_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.UpdateRoleRequest.description)
-}
-inline std::string* UpdateRoleRequest::mutable_description() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_description();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.UpdateRoleRequest.description)
-  return _s;
-}
-inline const std::string& UpdateRoleRequest::_internal_description() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.description_.Get();
-}
-inline void UpdateRoleRequest::_internal_set_description(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.description_.Set(value, GetArena());
-}
-inline std::string* UpdateRoleRequest::_internal_mutable_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  return _impl_.description_.Mutable( GetArena());
-}
-inline std::string* UpdateRoleRequest::release_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.UpdateRoleRequest.description)
-  if ((_impl_._has_bits_[0] & 0x00000002u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  auto* released = _impl_.description_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.description_.Set("", GetArena());
-  }
-  return released;
-}
-inline void UpdateRoleRequest::set_allocated_description(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  _impl_.description_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.description_.IsDefault()) {
-    _impl_.description_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.UpdateRoleRequest.description)
-}
-
-// optional bool is_default = 6;
-inline bool UpdateRoleRequest::has_is_default() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
-  return value;
-}
-inline void UpdateRoleRequest::clear_is_default() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.is_default_ = false;
-  _impl_._has_bits_[0] &= ~0x00000004u;
-}
-inline bool UpdateRoleRequest::is_default() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.UpdateRoleRequest.is_default)
-  return _internal_is_default();
-}
-inline void UpdateRoleRequest::set_is_default(bool value) {
-  _internal_set_is_default(value);
-  _impl_._has_bits_[0] |= 0x00000004u;
-  // @@protoc_insertion_point(field_set:siqi.auth.UpdateRoleRequest.is_default)
-}
-inline bool UpdateRoleRequest::_internal_is_default() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.is_default_;
-}
-inline void UpdateRoleRequest::_internal_set_is_default(bool value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.is_default_ = value;
-}
-
-// -------------------------------------------------------------------
-
-// DeleteRoleRequest
-
-// string app_code = 2;
-inline void DeleteRoleRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& DeleteRoleRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.DeleteRoleRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void DeleteRoleRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.DeleteRoleRequest.app_code)
-}
-inline std::string* DeleteRoleRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.DeleteRoleRequest.app_code)
-  return _s;
-}
-inline const std::string& DeleteRoleRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void DeleteRoleRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* DeleteRoleRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* DeleteRoleRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.DeleteRoleRequest.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void DeleteRoleRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.DeleteRoleRequest.app_code)
-}
-
-// string role_key = 3;
-inline void DeleteRoleRequest::clear_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.ClearToEmpty();
-}
-inline const std::string& DeleteRoleRequest::role_key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.DeleteRoleRequest.role_key)
-  return _internal_role_key();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void DeleteRoleRequest::set_role_key(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.DeleteRoleRequest.role_key)
-}
-inline std::string* DeleteRoleRequest::mutable_role_key() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_role_key();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.DeleteRoleRequest.role_key)
-  return _s;
-}
-inline const std::string& DeleteRoleRequest::_internal_role_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.role_key_.Get();
-}
-inline void DeleteRoleRequest::_internal_set_role_key(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.Set(value, GetArena());
-}
-inline std::string* DeleteRoleRequest::_internal_mutable_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.role_key_.Mutable( GetArena());
-}
-inline std::string* DeleteRoleRequest::release_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.DeleteRoleRequest.role_key)
-  return _impl_.role_key_.Release();
-}
-inline void DeleteRoleRequest::set_allocated_role_key(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.role_key_.IsDefault()) {
-    _impl_.role_key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.DeleteRoleRequest.role_key)
-}
-
-// -------------------------------------------------------------------
-
-// ListRolesRequest
-
-// string app_code = 1;
-inline void ListRolesRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& ListRolesRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListRolesRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListRolesRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListRolesRequest.app_code)
-}
-inline std::string* ListRolesRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListRolesRequest.app_code)
-  return _s;
-}
-inline const std::string& ListRolesRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void ListRolesRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* ListRolesRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* ListRolesRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListRolesRequest.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void ListRolesRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListRolesRequest.app_code)
-}
-
-// int32 page = 2;
-inline void ListRolesRequest::clear_page() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = 0;
-}
-inline ::int32_t ListRolesRequest::page() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListRolesRequest.page)
-  return _internal_page();
-}
-inline void ListRolesRequest::set_page(::int32_t value) {
-  _internal_set_page(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListRolesRequest.page)
-}
-inline ::int32_t ListRolesRequest::_internal_page() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_;
-}
-inline void ListRolesRequest::_internal_set_page(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = value;
-}
-
-// int32 page_size = 3;
-inline void ListRolesRequest::clear_page_size() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = 0;
-}
-inline ::int32_t ListRolesRequest::page_size() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListRolesRequest.page_size)
-  return _internal_page_size();
-}
-inline void ListRolesRequest::set_page_size(::int32_t value) {
-  _internal_set_page_size(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListRolesRequest.page_size)
-}
-inline ::int32_t ListRolesRequest::_internal_page_size() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_size_;
-}
-inline void ListRolesRequest::_internal_set_page_size(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = value;
-}
-
-// optional string role_name = 4;
-inline bool ListRolesRequest::has_role_name() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
-}
-inline void ListRolesRequest::clear_role_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_name_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const std::string& ListRolesRequest::role_name() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListRolesRequest.role_name)
-  return _internal_role_name();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListRolesRequest::set_role_name(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.role_name_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListRolesRequest.role_name)
-}
-inline std::string* ListRolesRequest::mutable_role_name() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_role_name();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListRolesRequest.role_name)
-  return _s;
-}
-inline const std::string& ListRolesRequest::_internal_role_name() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.role_name_.Get();
-}
-inline void ListRolesRequest::_internal_set_role_name(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.role_name_.Set(value, GetArena());
-}
-inline std::string* ListRolesRequest::_internal_mutable_role_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.role_name_.Mutable( GetArena());
-}
-inline std::string* ListRolesRequest::release_role_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListRolesRequest.role_name)
-  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* released = _impl_.role_name_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.role_name_.Set("", GetArena());
-  }
-  return released;
-}
-inline void ListRolesRequest::set_allocated_role_name(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  _impl_.role_name_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.role_name_.IsDefault()) {
-    _impl_.role_name_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListRolesRequest.role_name)
-}
-
-// optional string role_key = 5;
-inline bool ListRolesRequest::has_role_key() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  return value;
-}
-inline void ListRolesRequest::clear_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000002u;
-}
-inline const std::string& ListRolesRequest::role_key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListRolesRequest.role_key)
-  return _internal_role_key();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListRolesRequest::set_role_key(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.role_key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListRolesRequest.role_key)
-}
-inline std::string* ListRolesRequest::mutable_role_key() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_role_key();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListRolesRequest.role_key)
-  return _s;
-}
-inline const std::string& ListRolesRequest::_internal_role_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.role_key_.Get();
-}
-inline void ListRolesRequest::_internal_set_role_key(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.role_key_.Set(value, GetArena());
-}
-inline std::string* ListRolesRequest::_internal_mutable_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  return _impl_.role_key_.Mutable( GetArena());
-}
-inline std::string* ListRolesRequest::release_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListRolesRequest.role_key)
-  if ((_impl_._has_bits_[0] & 0x00000002u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  auto* released = _impl_.role_key_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.role_key_.Set("", GetArena());
-  }
-  return released;
-}
-inline void ListRolesRequest::set_allocated_role_key(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  _impl_.role_key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.role_key_.IsDefault()) {
-    _impl_.role_key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListRolesRequest.role_key)
-}
-
-// optional bool is_default = 6;
-inline bool ListRolesRequest::has_is_default() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
-  return value;
-}
-inline void ListRolesRequest::clear_is_default() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.is_default_ = false;
-  _impl_._has_bits_[0] &= ~0x00000004u;
-}
-inline bool ListRolesRequest::is_default() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListRolesRequest.is_default)
-  return _internal_is_default();
-}
-inline void ListRolesRequest::set_is_default(bool value) {
-  _internal_set_is_default(value);
-  _impl_._has_bits_[0] |= 0x00000004u;
-  // @@protoc_insertion_point(field_set:siqi.auth.ListRolesRequest.is_default)
-}
-inline bool ListRolesRequest::_internal_is_default() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.is_default_;
-}
-inline void ListRolesRequest::_internal_set_is_default(bool value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.is_default_ = value;
-}
-
-// -------------------------------------------------------------------
-
-// ListRolesResponse_Role
-
-// int64 id = 1;
-inline void ListRolesResponse_Role::clear_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.id_ = ::int64_t{0};
-}
-inline ::int64_t ListRolesResponse_Role::id() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListRolesResponse.Role.id)
-  return _internal_id();
-}
-inline void ListRolesResponse_Role::set_id(::int64_t value) {
-  _internal_set_id(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListRolesResponse.Role.id)
-}
-inline ::int64_t ListRolesResponse_Role::_internal_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.id_;
-}
-inline void ListRolesResponse_Role::_internal_set_id(::int64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.id_ = value;
-}
-
-// string role_name = 2;
-inline void ListRolesResponse_Role::clear_role_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_name_.ClearToEmpty();
-}
-inline const std::string& ListRolesResponse_Role::role_name() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListRolesResponse.Role.role_name)
-  return _internal_role_name();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListRolesResponse_Role::set_role_name(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_name_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListRolesResponse.Role.role_name)
-}
-inline std::string* ListRolesResponse_Role::mutable_role_name() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_role_name();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListRolesResponse.Role.role_name)
-  return _s;
-}
-inline const std::string& ListRolesResponse_Role::_internal_role_name() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.role_name_.Get();
-}
-inline void ListRolesResponse_Role::_internal_set_role_name(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_name_.Set(value, GetArena());
-}
-inline std::string* ListRolesResponse_Role::_internal_mutable_role_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.role_name_.Mutable( GetArena());
-}
-inline std::string* ListRolesResponse_Role::release_role_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListRolesResponse.Role.role_name)
-  return _impl_.role_name_.Release();
-}
-inline void ListRolesResponse_Role::set_allocated_role_name(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_name_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.role_name_.IsDefault()) {
-    _impl_.role_name_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListRolesResponse.Role.role_name)
-}
-
-// string role_key = 3;
-inline void ListRolesResponse_Role::clear_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.ClearToEmpty();
-}
-inline const std::string& ListRolesResponse_Role::role_key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListRolesResponse.Role.role_key)
-  return _internal_role_key();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListRolesResponse_Role::set_role_key(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListRolesResponse.Role.role_key)
-}
-inline std::string* ListRolesResponse_Role::mutable_role_key() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_role_key();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListRolesResponse.Role.role_key)
-  return _s;
-}
-inline const std::string& ListRolesResponse_Role::_internal_role_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.role_key_.Get();
-}
-inline void ListRolesResponse_Role::_internal_set_role_key(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.Set(value, GetArena());
-}
-inline std::string* ListRolesResponse_Role::_internal_mutable_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.role_key_.Mutable( GetArena());
-}
-inline std::string* ListRolesResponse_Role::release_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListRolesResponse.Role.role_key)
-  return _impl_.role_key_.Release();
-}
-inline void ListRolesResponse_Role::set_allocated_role_key(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.role_key_.IsDefault()) {
-    _impl_.role_key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListRolesResponse.Role.role_key)
-}
-
-// string description = 4;
-inline void ListRolesResponse_Role::clear_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.ClearToEmpty();
-}
-inline const std::string& ListRolesResponse_Role::description() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListRolesResponse.Role.description)
-  return _internal_description();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListRolesResponse_Role::set_description(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListRolesResponse.Role.description)
-}
-inline std::string* ListRolesResponse_Role::mutable_description() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_description();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListRolesResponse.Role.description)
-  return _s;
-}
-inline const std::string& ListRolesResponse_Role::_internal_description() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.description_.Get();
-}
-inline void ListRolesResponse_Role::_internal_set_description(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.Set(value, GetArena());
-}
-inline std::string* ListRolesResponse_Role::_internal_mutable_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.description_.Mutable( GetArena());
-}
-inline std::string* ListRolesResponse_Role::release_description() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListRolesResponse.Role.description)
-  return _impl_.description_.Release();
-}
-inline void ListRolesResponse_Role::set_allocated_description(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.description_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.description_.IsDefault()) {
-    _impl_.description_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListRolesResponse.Role.description)
-}
-
-// bool is_default = 5;
-inline void ListRolesResponse_Role::clear_is_default() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.is_default_ = false;
-}
-inline bool ListRolesResponse_Role::is_default() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListRolesResponse.Role.is_default)
-  return _internal_is_default();
-}
-inline void ListRolesResponse_Role::set_is_default(bool value) {
-  _internal_set_is_default(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListRolesResponse.Role.is_default)
-}
-inline bool ListRolesResponse_Role::_internal_is_default() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.is_default_;
-}
-inline void ListRolesResponse_Role::_internal_set_is_default(bool value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.is_default_ = value;
-}
-
-// string created_at = 6;
-inline void ListRolesResponse_Role::clear_created_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.ClearToEmpty();
-}
-inline const std::string& ListRolesResponse_Role::created_at() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListRolesResponse.Role.created_at)
-  return _internal_created_at();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListRolesResponse_Role::set_created_at(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListRolesResponse.Role.created_at)
-}
-inline std::string* ListRolesResponse_Role::mutable_created_at() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_created_at();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListRolesResponse.Role.created_at)
-  return _s;
-}
-inline const std::string& ListRolesResponse_Role::_internal_created_at() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.created_at_.Get();
-}
-inline void ListRolesResponse_Role::_internal_set_created_at(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.Set(value, GetArena());
-}
-inline std::string* ListRolesResponse_Role::_internal_mutable_created_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.created_at_.Mutable( GetArena());
-}
-inline std::string* ListRolesResponse_Role::release_created_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListRolesResponse.Role.created_at)
-  return _impl_.created_at_.Release();
-}
-inline void ListRolesResponse_Role::set_allocated_created_at(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.created_at_.IsDefault()) {
-    _impl_.created_at_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListRolesResponse.Role.created_at)
-}
-
-// string updated_at = 7;
-inline void ListRolesResponse_Role::clear_updated_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.updated_at_.ClearToEmpty();
-}
-inline const std::string& ListRolesResponse_Role::updated_at() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListRolesResponse.Role.updated_at)
-  return _internal_updated_at();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListRolesResponse_Role::set_updated_at(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.updated_at_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListRolesResponse.Role.updated_at)
-}
-inline std::string* ListRolesResponse_Role::mutable_updated_at() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_updated_at();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListRolesResponse.Role.updated_at)
-  return _s;
-}
-inline const std::string& ListRolesResponse_Role::_internal_updated_at() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.updated_at_.Get();
-}
-inline void ListRolesResponse_Role::_internal_set_updated_at(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.updated_at_.Set(value, GetArena());
-}
-inline std::string* ListRolesResponse_Role::_internal_mutable_updated_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.updated_at_.Mutable( GetArena());
-}
-inline std::string* ListRolesResponse_Role::release_updated_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListRolesResponse.Role.updated_at)
-  return _impl_.updated_at_.Release();
-}
-inline void ListRolesResponse_Role::set_allocated_updated_at(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.updated_at_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.updated_at_.IsDefault()) {
-    _impl_.updated_at_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListRolesResponse.Role.updated_at)
-}
-
-// repeated string perm_keys = 8;
-inline int ListRolesResponse_Role::_internal_perm_keys_size() const {
-  return _internal_perm_keys().size();
-}
-inline int ListRolesResponse_Role::perm_keys_size() const {
-  return _internal_perm_keys_size();
-}
-inline void ListRolesResponse_Role::clear_perm_keys() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_keys_.Clear();
-}
-inline std::string* ListRolesResponse_Role::add_perm_keys() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  std::string* _s = _internal_mutable_perm_keys()->Add();
-  // @@protoc_insertion_point(field_add_mutable:siqi.auth.ListRolesResponse.Role.perm_keys)
-  return _s;
-}
-inline const std::string& ListRolesResponse_Role::perm_keys(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListRolesResponse.Role.perm_keys)
-  return _internal_perm_keys().Get(index);
-}
-inline std::string* ListRolesResponse_Role::mutable_perm_keys(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListRolesResponse.Role.perm_keys)
-  return _internal_mutable_perm_keys()->Mutable(index);
-}
-template <typename Arg_, typename... Args_>
-inline void ListRolesResponse_Role::set_perm_keys(int index, Arg_&& value, Args_... args) {
-  ::google::protobuf::internal::AssignToString(
-      *_internal_mutable_perm_keys()->Mutable(index),
-      std::forward<Arg_>(value), args... );
-  // @@protoc_insertion_point(field_set:siqi.auth.ListRolesResponse.Role.perm_keys)
-}
-template <typename Arg_, typename... Args_>
-inline void ListRolesResponse_Role::add_perm_keys(Arg_&& value, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::google::protobuf::internal::AddToRepeatedPtrField(*_internal_mutable_perm_keys(),
-                               std::forward<Arg_>(value),
-                               args... );
-  // @@protoc_insertion_point(field_add:siqi.auth.ListRolesResponse.Role.perm_keys)
-}
-inline const ::google::protobuf::RepeatedPtrField<std::string>&
-ListRolesResponse_Role::perm_keys() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:siqi.auth.ListRolesResponse.Role.perm_keys)
-  return _internal_perm_keys();
-}
-inline ::google::protobuf::RepeatedPtrField<std::string>*
-ListRolesResponse_Role::mutable_perm_keys() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:siqi.auth.ListRolesResponse.Role.perm_keys)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_perm_keys();
-}
-inline const ::google::protobuf::RepeatedPtrField<std::string>&
-ListRolesResponse_Role::_internal_perm_keys() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.perm_keys_;
-}
-inline ::google::protobuf::RepeatedPtrField<std::string>*
-ListRolesResponse_Role::_internal_mutable_perm_keys() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.perm_keys_;
-}
-
-// -------------------------------------------------------------------
-
-// ListRolesResponse
-
-// repeated .siqi.auth.ListRolesResponse.Role roles = 1;
-inline int ListRolesResponse::_internal_roles_size() const {
-  return _internal_roles().size();
-}
-inline int ListRolesResponse::roles_size() const {
-  return _internal_roles_size();
-}
-inline void ListRolesResponse::clear_roles() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.roles_.Clear();
-}
-inline ::siqi::auth::ListRolesResponse_Role* ListRolesResponse::mutable_roles(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListRolesResponse.roles)
-  return _internal_mutable_roles()->Mutable(index);
-}
-inline ::google::protobuf::RepeatedPtrField<::siqi::auth::ListRolesResponse_Role>* ListRolesResponse::mutable_roles()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:siqi.auth.ListRolesResponse.roles)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_roles();
-}
-inline const ::siqi::auth::ListRolesResponse_Role& ListRolesResponse::roles(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListRolesResponse.roles)
-  return _internal_roles().Get(index);
-}
-inline ::siqi::auth::ListRolesResponse_Role* ListRolesResponse::add_roles() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::siqi::auth::ListRolesResponse_Role* _add = _internal_mutable_roles()->Add();
-  // @@protoc_insertion_point(field_add:siqi.auth.ListRolesResponse.roles)
-  return _add;
-}
-inline const ::google::protobuf::RepeatedPtrField<::siqi::auth::ListRolesResponse_Role>& ListRolesResponse::roles() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:siqi.auth.ListRolesResponse.roles)
-  return _internal_roles();
-}
-inline const ::google::protobuf::RepeatedPtrField<::siqi::auth::ListRolesResponse_Role>&
-ListRolesResponse::_internal_roles() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.roles_;
-}
-inline ::google::protobuf::RepeatedPtrField<::siqi::auth::ListRolesResponse_Role>*
-ListRolesResponse::_internal_mutable_roles() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.roles_;
-}
-
-// int64 total = 2;
-inline void ListRolesResponse::clear_total() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.total_ = ::int64_t{0};
-}
-inline ::int64_t ListRolesResponse::total() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListRolesResponse.total)
-  return _internal_total();
-}
-inline void ListRolesResponse::set_total(::int64_t value) {
-  _internal_set_total(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListRolesResponse.total)
-}
-inline ::int64_t ListRolesResponse::_internal_total() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.total_;
-}
-inline void ListRolesResponse::_internal_set_total(::int64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.total_ = value;
-}
-
-// int32 page = 3;
-inline void ListRolesResponse::clear_page() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = 0;
-}
-inline ::int32_t ListRolesResponse::page() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListRolesResponse.page)
-  return _internal_page();
-}
-inline void ListRolesResponse::set_page(::int32_t value) {
-  _internal_set_page(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListRolesResponse.page)
-}
-inline ::int32_t ListRolesResponse::_internal_page() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_;
-}
-inline void ListRolesResponse::_internal_set_page(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = value;
-}
-
-// int32 page_size = 4;
-inline void ListRolesResponse::clear_page_size() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = 0;
-}
-inline ::int32_t ListRolesResponse::page_size() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListRolesResponse.page_size)
-  return _internal_page_size();
-}
-inline void ListRolesResponse::set_page_size(::int32_t value) {
-  _internal_set_page_size(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListRolesResponse.page_size)
-}
-inline ::int32_t ListRolesResponse::_internal_page_size() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_size_;
-}
-inline void ListRolesResponse::_internal_set_page_size(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = value;
-}
-
-// -------------------------------------------------------------------
-
-// AddPermissionToRoleRequest
-
-// string app_code = 2;
-inline void AddPermissionToRoleRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& AddPermissionToRoleRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.AddPermissionToRoleRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void AddPermissionToRoleRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.AddPermissionToRoleRequest.app_code)
-}
-inline std::string* AddPermissionToRoleRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.AddPermissionToRoleRequest.app_code)
-  return _s;
-}
-inline const std::string& AddPermissionToRoleRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void AddPermissionToRoleRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* AddPermissionToRoleRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* AddPermissionToRoleRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.AddPermissionToRoleRequest.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void AddPermissionToRoleRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.AddPermissionToRoleRequest.app_code)
-}
-
-// string role_key = 3;
-inline void AddPermissionToRoleRequest::clear_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.ClearToEmpty();
-}
-inline const std::string& AddPermissionToRoleRequest::role_key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.AddPermissionToRoleRequest.role_key)
-  return _internal_role_key();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void AddPermissionToRoleRequest::set_role_key(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.AddPermissionToRoleRequest.role_key)
-}
-inline std::string* AddPermissionToRoleRequest::mutable_role_key() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_role_key();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.AddPermissionToRoleRequest.role_key)
-  return _s;
-}
-inline const std::string& AddPermissionToRoleRequest::_internal_role_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.role_key_.Get();
-}
-inline void AddPermissionToRoleRequest::_internal_set_role_key(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.Set(value, GetArena());
-}
-inline std::string* AddPermissionToRoleRequest::_internal_mutable_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.role_key_.Mutable( GetArena());
-}
-inline std::string* AddPermissionToRoleRequest::release_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.AddPermissionToRoleRequest.role_key)
-  return _impl_.role_key_.Release();
-}
-inline void AddPermissionToRoleRequest::set_allocated_role_key(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.role_key_.IsDefault()) {
-    _impl_.role_key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.AddPermissionToRoleRequest.role_key)
-}
-
-// string perm_key = 4;
-inline void AddPermissionToRoleRequest::clear_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.ClearToEmpty();
-}
-inline const std::string& AddPermissionToRoleRequest::perm_key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.AddPermissionToRoleRequest.perm_key)
-  return _internal_perm_key();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void AddPermissionToRoleRequest::set_perm_key(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.AddPermissionToRoleRequest.perm_key)
-}
-inline std::string* AddPermissionToRoleRequest::mutable_perm_key() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_perm_key();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.AddPermissionToRoleRequest.perm_key)
-  return _s;
-}
-inline const std::string& AddPermissionToRoleRequest::_internal_perm_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.perm_key_.Get();
-}
-inline void AddPermissionToRoleRequest::_internal_set_perm_key(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.Set(value, GetArena());
-}
-inline std::string* AddPermissionToRoleRequest::_internal_mutable_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.perm_key_.Mutable( GetArena());
-}
-inline std::string* AddPermissionToRoleRequest::release_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.AddPermissionToRoleRequest.perm_key)
-  return _impl_.perm_key_.Release();
-}
-inline void AddPermissionToRoleRequest::set_allocated_perm_key(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.perm_key_.IsDefault()) {
-    _impl_.perm_key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.AddPermissionToRoleRequest.perm_key)
-}
-
-// -------------------------------------------------------------------
-
-// RemovePermissionFromRoleRequest
-
-// string app_code = 2;
-inline void RemovePermissionFromRoleRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& RemovePermissionFromRoleRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.RemovePermissionFromRoleRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void RemovePermissionFromRoleRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.RemovePermissionFromRoleRequest.app_code)
-}
-inline std::string* RemovePermissionFromRoleRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.RemovePermissionFromRoleRequest.app_code)
-  return _s;
-}
-inline const std::string& RemovePermissionFromRoleRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void RemovePermissionFromRoleRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* RemovePermissionFromRoleRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* RemovePermissionFromRoleRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.RemovePermissionFromRoleRequest.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void RemovePermissionFromRoleRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.RemovePermissionFromRoleRequest.app_code)
-}
-
-// string role_key = 3;
-inline void RemovePermissionFromRoleRequest::clear_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.ClearToEmpty();
-}
-inline const std::string& RemovePermissionFromRoleRequest::role_key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.RemovePermissionFromRoleRequest.role_key)
-  return _internal_role_key();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void RemovePermissionFromRoleRequest::set_role_key(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.RemovePermissionFromRoleRequest.role_key)
-}
-inline std::string* RemovePermissionFromRoleRequest::mutable_role_key() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_role_key();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.RemovePermissionFromRoleRequest.role_key)
-  return _s;
-}
-inline const std::string& RemovePermissionFromRoleRequest::_internal_role_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.role_key_.Get();
-}
-inline void RemovePermissionFromRoleRequest::_internal_set_role_key(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.Set(value, GetArena());
-}
-inline std::string* RemovePermissionFromRoleRequest::_internal_mutable_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.role_key_.Mutable( GetArena());
-}
-inline std::string* RemovePermissionFromRoleRequest::release_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.RemovePermissionFromRoleRequest.role_key)
-  return _impl_.role_key_.Release();
-}
-inline void RemovePermissionFromRoleRequest::set_allocated_role_key(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.role_key_.IsDefault()) {
-    _impl_.role_key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.RemovePermissionFromRoleRequest.role_key)
-}
-
-// string perm_key = 4;
-inline void RemovePermissionFromRoleRequest::clear_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.ClearToEmpty();
-}
-inline const std::string& RemovePermissionFromRoleRequest::perm_key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.RemovePermissionFromRoleRequest.perm_key)
-  return _internal_perm_key();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void RemovePermissionFromRoleRequest::set_perm_key(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.RemovePermissionFromRoleRequest.perm_key)
-}
-inline std::string* RemovePermissionFromRoleRequest::mutable_perm_key() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_perm_key();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.RemovePermissionFromRoleRequest.perm_key)
-  return _s;
-}
-inline const std::string& RemovePermissionFromRoleRequest::_internal_perm_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.perm_key_.Get();
-}
-inline void RemovePermissionFromRoleRequest::_internal_set_perm_key(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.Set(value, GetArena());
-}
-inline std::string* RemovePermissionFromRoleRequest::_internal_mutable_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.perm_key_.Mutable( GetArena());
-}
-inline std::string* RemovePermissionFromRoleRequest::release_perm_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.RemovePermissionFromRoleRequest.perm_key)
-  return _impl_.perm_key_.Release();
-}
-inline void RemovePermissionFromRoleRequest::set_allocated_perm_key(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.perm_key_.IsDefault()) {
-    _impl_.perm_key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.RemovePermissionFromRoleRequest.perm_key)
-}
-
-// -------------------------------------------------------------------
-
-// GetRolePermissionsRequest
-
-// string app_code = 1;
-inline void GetRolePermissionsRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& GetRolePermissionsRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetRolePermissionsRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GetRolePermissionsRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.GetRolePermissionsRequest.app_code)
-}
-inline std::string* GetRolePermissionsRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GetRolePermissionsRequest.app_code)
-  return _s;
-}
-inline const std::string& GetRolePermissionsRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void GetRolePermissionsRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* GetRolePermissionsRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* GetRolePermissionsRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.GetRolePermissionsRequest.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void GetRolePermissionsRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.GetRolePermissionsRequest.app_code)
-}
-
-// string role_key = 2;
-inline void GetRolePermissionsRequest::clear_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.ClearToEmpty();
-}
-inline const std::string& GetRolePermissionsRequest::role_key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetRolePermissionsRequest.role_key)
-  return _internal_role_key();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GetRolePermissionsRequest::set_role_key(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.GetRolePermissionsRequest.role_key)
-}
-inline std::string* GetRolePermissionsRequest::mutable_role_key() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_role_key();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GetRolePermissionsRequest.role_key)
-  return _s;
-}
-inline const std::string& GetRolePermissionsRequest::_internal_role_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.role_key_.Get();
-}
-inline void GetRolePermissionsRequest::_internal_set_role_key(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.Set(value, GetArena());
-}
-inline std::string* GetRolePermissionsRequest::_internal_mutable_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.role_key_.Mutable( GetArena());
-}
-inline std::string* GetRolePermissionsRequest::release_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.GetRolePermissionsRequest.role_key)
-  return _impl_.role_key_.Release();
-}
-inline void GetRolePermissionsRequest::set_allocated_role_key(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.role_key_.IsDefault()) {
-    _impl_.role_key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.GetRolePermissionsRequest.role_key)
-}
-
-// -------------------------------------------------------------------
-
-// GetRolePermissionsResponse
-
-// repeated string perm_keys = 1;
-inline int GetRolePermissionsResponse::_internal_perm_keys_size() const {
-  return _internal_perm_keys().size();
-}
-inline int GetRolePermissionsResponse::perm_keys_size() const {
-  return _internal_perm_keys_size();
-}
-inline void GetRolePermissionsResponse::clear_perm_keys() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_keys_.Clear();
-}
-inline std::string* GetRolePermissionsResponse::add_perm_keys() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  std::string* _s = _internal_mutable_perm_keys()->Add();
-  // @@protoc_insertion_point(field_add_mutable:siqi.auth.GetRolePermissionsResponse.perm_keys)
-  return _s;
-}
-inline const std::string& GetRolePermissionsResponse::perm_keys(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetRolePermissionsResponse.perm_keys)
-  return _internal_perm_keys().Get(index);
-}
-inline std::string* GetRolePermissionsResponse::mutable_perm_keys(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GetRolePermissionsResponse.perm_keys)
-  return _internal_mutable_perm_keys()->Mutable(index);
-}
-template <typename Arg_, typename... Args_>
-inline void GetRolePermissionsResponse::set_perm_keys(int index, Arg_&& value, Args_... args) {
-  ::google::protobuf::internal::AssignToString(
-      *_internal_mutable_perm_keys()->Mutable(index),
-      std::forward<Arg_>(value), args... );
-  // @@protoc_insertion_point(field_set:siqi.auth.GetRolePermissionsResponse.perm_keys)
-}
-template <typename Arg_, typename... Args_>
-inline void GetRolePermissionsResponse::add_perm_keys(Arg_&& value, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::google::protobuf::internal::AddToRepeatedPtrField(*_internal_mutable_perm_keys(),
-                               std::forward<Arg_>(value),
-                               args... );
-  // @@protoc_insertion_point(field_add:siqi.auth.GetRolePermissionsResponse.perm_keys)
-}
-inline const ::google::protobuf::RepeatedPtrField<std::string>&
-GetRolePermissionsResponse::perm_keys() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:siqi.auth.GetRolePermissionsResponse.perm_keys)
-  return _internal_perm_keys();
-}
-inline ::google::protobuf::RepeatedPtrField<std::string>*
-GetRolePermissionsResponse::mutable_perm_keys() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:siqi.auth.GetRolePermissionsResponse.perm_keys)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_perm_keys();
-}
-inline const ::google::protobuf::RepeatedPtrField<std::string>&
-GetRolePermissionsResponse::_internal_perm_keys() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.perm_keys_;
-}
-inline ::google::protobuf::RepeatedPtrField<std::string>*
-GetRolePermissionsResponse::_internal_mutable_perm_keys() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.perm_keys_;
-}
-
-// -------------------------------------------------------------------
-
-// GrantRoleToUserRequest
-
-// string app_code = 2;
-inline void GrantRoleToUserRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& GrantRoleToUserRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GrantRoleToUserRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GrantRoleToUserRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.GrantRoleToUserRequest.app_code)
-}
-inline std::string* GrantRoleToUserRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GrantRoleToUserRequest.app_code)
-  return _s;
-}
-inline const std::string& GrantRoleToUserRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void GrantRoleToUserRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* GrantRoleToUserRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* GrantRoleToUserRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.GrantRoleToUserRequest.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void GrantRoleToUserRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.GrantRoleToUserRequest.app_code)
-}
-
-// string user_id = 3;
-inline void GrantRoleToUserRequest::clear_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.ClearToEmpty();
-}
-inline const std::string& GrantRoleToUserRequest::user_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GrantRoleToUserRequest.user_id)
-  return _internal_user_id();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GrantRoleToUserRequest::set_user_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.GrantRoleToUserRequest.user_id)
-}
-inline std::string* GrantRoleToUserRequest::mutable_user_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_user_id();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GrantRoleToUserRequest.user_id)
-  return _s;
-}
-inline const std::string& GrantRoleToUserRequest::_internal_user_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.user_id_.Get();
-}
-inline void GrantRoleToUserRequest::_internal_set_user_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.Set(value, GetArena());
-}
-inline std::string* GrantRoleToUserRequest::_internal_mutable_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.user_id_.Mutable( GetArena());
-}
-inline std::string* GrantRoleToUserRequest::release_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.GrantRoleToUserRequest.user_id)
-  return _impl_.user_id_.Release();
-}
-inline void GrantRoleToUserRequest::set_allocated_user_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.user_id_.IsDefault()) {
-    _impl_.user_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.GrantRoleToUserRequest.user_id)
-}
-
-// string role_key = 4;
-inline void GrantRoleToUserRequest::clear_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.ClearToEmpty();
-}
-inline const std::string& GrantRoleToUserRequest::role_key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GrantRoleToUserRequest.role_key)
-  return _internal_role_key();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GrantRoleToUserRequest::set_role_key(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.GrantRoleToUserRequest.role_key)
-}
-inline std::string* GrantRoleToUserRequest::mutable_role_key() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_role_key();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GrantRoleToUserRequest.role_key)
-  return _s;
-}
-inline const std::string& GrantRoleToUserRequest::_internal_role_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.role_key_.Get();
-}
-inline void GrantRoleToUserRequest::_internal_set_role_key(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.Set(value, GetArena());
-}
-inline std::string* GrantRoleToUserRequest::_internal_mutable_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.role_key_.Mutable( GetArena());
-}
-inline std::string* GrantRoleToUserRequest::release_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.GrantRoleToUserRequest.role_key)
-  return _impl_.role_key_.Release();
-}
-inline void GrantRoleToUserRequest::set_allocated_role_key(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.role_key_.IsDefault()) {
-    _impl_.role_key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.GrantRoleToUserRequest.role_key)
-}
-
-// -------------------------------------------------------------------
-
-// RevokeRoleFromUserRequest
-
-// string app_code = 2;
-inline void RevokeRoleFromUserRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& RevokeRoleFromUserRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.RevokeRoleFromUserRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void RevokeRoleFromUserRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.RevokeRoleFromUserRequest.app_code)
-}
-inline std::string* RevokeRoleFromUserRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.RevokeRoleFromUserRequest.app_code)
-  return _s;
-}
-inline const std::string& RevokeRoleFromUserRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void RevokeRoleFromUserRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* RevokeRoleFromUserRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* RevokeRoleFromUserRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.RevokeRoleFromUserRequest.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void RevokeRoleFromUserRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.RevokeRoleFromUserRequest.app_code)
-}
-
-// string user_id = 3;
-inline void RevokeRoleFromUserRequest::clear_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.ClearToEmpty();
-}
-inline const std::string& RevokeRoleFromUserRequest::user_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.RevokeRoleFromUserRequest.user_id)
-  return _internal_user_id();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void RevokeRoleFromUserRequest::set_user_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.RevokeRoleFromUserRequest.user_id)
-}
-inline std::string* RevokeRoleFromUserRequest::mutable_user_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_user_id();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.RevokeRoleFromUserRequest.user_id)
-  return _s;
-}
-inline const std::string& RevokeRoleFromUserRequest::_internal_user_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.user_id_.Get();
-}
-inline void RevokeRoleFromUserRequest::_internal_set_user_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.Set(value, GetArena());
-}
-inline std::string* RevokeRoleFromUserRequest::_internal_mutable_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.user_id_.Mutable( GetArena());
-}
-inline std::string* RevokeRoleFromUserRequest::release_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.RevokeRoleFromUserRequest.user_id)
-  return _impl_.user_id_.Release();
-}
-inline void RevokeRoleFromUserRequest::set_allocated_user_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.user_id_.IsDefault()) {
-    _impl_.user_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.RevokeRoleFromUserRequest.user_id)
-}
-
-// string role_key = 4;
-inline void RevokeRoleFromUserRequest::clear_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.ClearToEmpty();
-}
-inline const std::string& RevokeRoleFromUserRequest::role_key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.RevokeRoleFromUserRequest.role_key)
-  return _internal_role_key();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void RevokeRoleFromUserRequest::set_role_key(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.RevokeRoleFromUserRequest.role_key)
-}
-inline std::string* RevokeRoleFromUserRequest::mutable_role_key() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_role_key();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.RevokeRoleFromUserRequest.role_key)
-  return _s;
-}
-inline const std::string& RevokeRoleFromUserRequest::_internal_role_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.role_key_.Get();
-}
-inline void RevokeRoleFromUserRequest::_internal_set_role_key(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.Set(value, GetArena());
-}
-inline std::string* RevokeRoleFromUserRequest::_internal_mutable_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.role_key_.Mutable( GetArena());
-}
-inline std::string* RevokeRoleFromUserRequest::release_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.RevokeRoleFromUserRequest.role_key)
-  return _impl_.role_key_.Release();
-}
-inline void RevokeRoleFromUserRequest::set_allocated_role_key(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.role_key_.IsDefault()) {
-    _impl_.role_key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.RevokeRoleFromUserRequest.role_key)
-}
-
-// -------------------------------------------------------------------
-
-// GetRoleUsersRequest
-
-// string app_code = 1;
-inline void GetRoleUsersRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& GetRoleUsersRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetRoleUsersRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GetRoleUsersRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.GetRoleUsersRequest.app_code)
-}
-inline std::string* GetRoleUsersRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GetRoleUsersRequest.app_code)
-  return _s;
-}
-inline const std::string& GetRoleUsersRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void GetRoleUsersRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* GetRoleUsersRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* GetRoleUsersRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.GetRoleUsersRequest.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void GetRoleUsersRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.GetRoleUsersRequest.app_code)
-}
-
-// string role_key = 2;
-inline void GetRoleUsersRequest::clear_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.ClearToEmpty();
-}
-inline const std::string& GetRoleUsersRequest::role_key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetRoleUsersRequest.role_key)
-  return _internal_role_key();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GetRoleUsersRequest::set_role_key(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.GetRoleUsersRequest.role_key)
-}
-inline std::string* GetRoleUsersRequest::mutable_role_key() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_role_key();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GetRoleUsersRequest.role_key)
-  return _s;
-}
-inline const std::string& GetRoleUsersRequest::_internal_role_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.role_key_.Get();
-}
-inline void GetRoleUsersRequest::_internal_set_role_key(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.Set(value, GetArena());
-}
-inline std::string* GetRoleUsersRequest::_internal_mutable_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.role_key_.Mutable( GetArena());
-}
-inline std::string* GetRoleUsersRequest::release_role_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.GetRoleUsersRequest.role_key)
-  return _impl_.role_key_.Release();
-}
-inline void GetRoleUsersRequest::set_allocated_role_key(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.role_key_.IsDefault()) {
-    _impl_.role_key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.GetRoleUsersRequest.role_key)
-}
-
-// int32 page = 3;
-inline void GetRoleUsersRequest::clear_page() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = 0;
-}
-inline ::int32_t GetRoleUsersRequest::page() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetRoleUsersRequest.page)
-  return _internal_page();
-}
-inline void GetRoleUsersRequest::set_page(::int32_t value) {
-  _internal_set_page(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.GetRoleUsersRequest.page)
-}
-inline ::int32_t GetRoleUsersRequest::_internal_page() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_;
-}
-inline void GetRoleUsersRequest::_internal_set_page(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = value;
-}
-
-// int32 page_size = 4;
-inline void GetRoleUsersRequest::clear_page_size() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = 0;
-}
-inline ::int32_t GetRoleUsersRequest::page_size() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetRoleUsersRequest.page_size)
-  return _internal_page_size();
-}
-inline void GetRoleUsersRequest::set_page_size(::int32_t value) {
-  _internal_set_page_size(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.GetRoleUsersRequest.page_size)
-}
-inline ::int32_t GetRoleUsersRequest::_internal_page_size() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_size_;
-}
-inline void GetRoleUsersRequest::_internal_set_page_size(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = value;
-}
-
-// -------------------------------------------------------------------
-
-// GetRoleUsersResponse_User
-
-// string user_id = 1;
-inline void GetRoleUsersResponse_User::clear_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.ClearToEmpty();
-}
-inline const std::string& GetRoleUsersResponse_User::user_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetRoleUsersResponse.User.user_id)
-  return _internal_user_id();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GetRoleUsersResponse_User::set_user_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.GetRoleUsersResponse.User.user_id)
-}
-inline std::string* GetRoleUsersResponse_User::mutable_user_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_user_id();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GetRoleUsersResponse.User.user_id)
-  return _s;
-}
-inline const std::string& GetRoleUsersResponse_User::_internal_user_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.user_id_.Get();
-}
-inline void GetRoleUsersResponse_User::_internal_set_user_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.Set(value, GetArena());
-}
-inline std::string* GetRoleUsersResponse_User::_internal_mutable_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.user_id_.Mutable( GetArena());
-}
-inline std::string* GetRoleUsersResponse_User::release_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.GetRoleUsersResponse.User.user_id)
-  return _impl_.user_id_.Release();
-}
-inline void GetRoleUsersResponse_User::set_allocated_user_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.user_id_.IsDefault()) {
-    _impl_.user_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.GetRoleUsersResponse.User.user_id)
-}
-
-// string created_at = 2;
-inline void GetRoleUsersResponse_User::clear_created_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.ClearToEmpty();
-}
-inline const std::string& GetRoleUsersResponse_User::created_at() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetRoleUsersResponse.User.created_at)
-  return _internal_created_at();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GetRoleUsersResponse_User::set_created_at(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.GetRoleUsersResponse.User.created_at)
-}
-inline std::string* GetRoleUsersResponse_User::mutable_created_at() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_created_at();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GetRoleUsersResponse.User.created_at)
-  return _s;
-}
-inline const std::string& GetRoleUsersResponse_User::_internal_created_at() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.created_at_.Get();
-}
-inline void GetRoleUsersResponse_User::_internal_set_created_at(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.Set(value, GetArena());
-}
-inline std::string* GetRoleUsersResponse_User::_internal_mutable_created_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.created_at_.Mutable( GetArena());
-}
-inline std::string* GetRoleUsersResponse_User::release_created_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.GetRoleUsersResponse.User.created_at)
-  return _impl_.created_at_.Release();
-}
-inline void GetRoleUsersResponse_User::set_allocated_created_at(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.created_at_.IsDefault()) {
-    _impl_.created_at_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.GetRoleUsersResponse.User.created_at)
-}
-
-// -------------------------------------------------------------------
-
-// GetRoleUsersResponse
-
-// repeated .siqi.auth.GetRoleUsersResponse.User users = 1;
-inline int GetRoleUsersResponse::_internal_users_size() const {
-  return _internal_users().size();
-}
-inline int GetRoleUsersResponse::users_size() const {
-  return _internal_users_size();
-}
-inline void GetRoleUsersResponse::clear_users() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.users_.Clear();
-}
-inline ::siqi::auth::GetRoleUsersResponse_User* GetRoleUsersResponse::mutable_users(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:siqi.auth.GetRoleUsersResponse.users)
-  return _internal_mutable_users()->Mutable(index);
-}
-inline ::google::protobuf::RepeatedPtrField<::siqi::auth::GetRoleUsersResponse_User>* GetRoleUsersResponse::mutable_users()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:siqi.auth.GetRoleUsersResponse.users)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_users();
-}
-inline const ::siqi::auth::GetRoleUsersResponse_User& GetRoleUsersResponse::users(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetRoleUsersResponse.users)
-  return _internal_users().Get(index);
-}
-inline ::siqi::auth::GetRoleUsersResponse_User* GetRoleUsersResponse::add_users() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::siqi::auth::GetRoleUsersResponse_User* _add = _internal_mutable_users()->Add();
-  // @@protoc_insertion_point(field_add:siqi.auth.GetRoleUsersResponse.users)
-  return _add;
-}
-inline const ::google::protobuf::RepeatedPtrField<::siqi::auth::GetRoleUsersResponse_User>& GetRoleUsersResponse::users() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:siqi.auth.GetRoleUsersResponse.users)
-  return _internal_users();
-}
-inline const ::google::protobuf::RepeatedPtrField<::siqi::auth::GetRoleUsersResponse_User>&
-GetRoleUsersResponse::_internal_users() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.users_;
-}
-inline ::google::protobuf::RepeatedPtrField<::siqi::auth::GetRoleUsersResponse_User>*
-GetRoleUsersResponse::_internal_mutable_users() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.users_;
-}
-
-// int64 total = 2;
-inline void GetRoleUsersResponse::clear_total() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.total_ = ::int64_t{0};
-}
-inline ::int64_t GetRoleUsersResponse::total() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetRoleUsersResponse.total)
-  return _internal_total();
-}
-inline void GetRoleUsersResponse::set_total(::int64_t value) {
-  _internal_set_total(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.GetRoleUsersResponse.total)
-}
-inline ::int64_t GetRoleUsersResponse::_internal_total() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.total_;
-}
-inline void GetRoleUsersResponse::_internal_set_total(::int64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.total_ = value;
-}
-
-// int32 page = 3;
-inline void GetRoleUsersResponse::clear_page() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = 0;
-}
-inline ::int32_t GetRoleUsersResponse::page() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetRoleUsersResponse.page)
-  return _internal_page();
-}
-inline void GetRoleUsersResponse::set_page(::int32_t value) {
-  _internal_set_page(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.GetRoleUsersResponse.page)
-}
-inline ::int32_t GetRoleUsersResponse::_internal_page() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_;
-}
-inline void GetRoleUsersResponse::_internal_set_page(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = value;
-}
-
-// int32 page_size = 4;
-inline void GetRoleUsersResponse::clear_page_size() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = 0;
-}
-inline ::int32_t GetRoleUsersResponse::page_size() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.GetRoleUsersResponse.page_size)
-  return _internal_page_size();
-}
-inline void GetRoleUsersResponse::set_page_size(::int32_t value) {
-  _internal_set_page_size(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.GetRoleUsersResponse.page_size)
-}
-inline ::int32_t GetRoleUsersResponse::_internal_page_size() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_size_;
-}
-inline void GetRoleUsersResponse::_internal_set_page_size(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = value;
-}
-
-// -------------------------------------------------------------------
-
-// ListAuditLogsRequest
-
-// int32 page = 1;
-inline void ListAuditLogsRequest::clear_page() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = 0;
-}
-inline ::int32_t ListAuditLogsRequest::page() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsRequest.page)
-  return _internal_page();
-}
-inline void ListAuditLogsRequest::set_page(::int32_t value) {
-  _internal_set_page(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAuditLogsRequest.page)
-}
-inline ::int32_t ListAuditLogsRequest::_internal_page() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_;
-}
-inline void ListAuditLogsRequest::_internal_set_page(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = value;
-}
-
-// int32 page_size = 2;
-inline void ListAuditLogsRequest::clear_page_size() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = 0;
-}
-inline ::int32_t ListAuditLogsRequest::page_size() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsRequest.page_size)
-  return _internal_page_size();
-}
-inline void ListAuditLogsRequest::set_page_size(::int32_t value) {
-  _internal_set_page_size(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAuditLogsRequest.page_size)
-}
-inline ::int32_t ListAuditLogsRequest::_internal_page_size() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_size_;
-}
-inline void ListAuditLogsRequest::_internal_set_page_size(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = value;
-}
-
-// optional string operator_id = 3;
-inline bool ListAuditLogsRequest::has_operator_id() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
-}
-inline void ListAuditLogsRequest::clear_operator_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.operator_id_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const std::string& ListAuditLogsRequest::operator_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsRequest.operator_id)
-  return _internal_operator_id();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListAuditLogsRequest::set_operator_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.operator_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAuditLogsRequest.operator_id)
-}
-inline std::string* ListAuditLogsRequest::mutable_operator_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_operator_id();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListAuditLogsRequest.operator_id)
-  return _s;
-}
-inline const std::string& ListAuditLogsRequest::_internal_operator_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.operator_id_.Get();
-}
-inline void ListAuditLogsRequest::_internal_set_operator_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.operator_id_.Set(value, GetArena());
-}
-inline std::string* ListAuditLogsRequest::_internal_mutable_operator_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.operator_id_.Mutable( GetArena());
-}
-inline std::string* ListAuditLogsRequest::release_operator_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListAuditLogsRequest.operator_id)
-  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* released = _impl_.operator_id_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.operator_id_.Set("", GetArena());
-  }
-  return released;
-}
-inline void ListAuditLogsRequest::set_allocated_operator_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  _impl_.operator_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.operator_id_.IsDefault()) {
-    _impl_.operator_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListAuditLogsRequest.operator_id)
-}
-
-// optional string app_code = 4;
-inline bool ListAuditLogsRequest::has_app_code() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  return value;
-}
-inline void ListAuditLogsRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000002u;
-}
-inline const std::string& ListAuditLogsRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListAuditLogsRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAuditLogsRequest.app_code)
-}
-inline std::string* ListAuditLogsRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListAuditLogsRequest.app_code)
-  return _s;
-}
-inline const std::string& ListAuditLogsRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void ListAuditLogsRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* ListAuditLogsRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* ListAuditLogsRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListAuditLogsRequest.app_code)
-  if ((_impl_._has_bits_[0] & 0x00000002u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  auto* released = _impl_.app_code_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  return released;
-}
-inline void ListAuditLogsRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListAuditLogsRequest.app_code)
-}
-
-// optional string action = 5;
-inline bool ListAuditLogsRequest::has_action() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
-  return value;
-}
-inline void ListAuditLogsRequest::clear_action() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.action_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000004u;
-}
-inline const std::string& ListAuditLogsRequest::action() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsRequest.action)
-  return _internal_action();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListAuditLogsRequest::set_action(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000004u;
-  _impl_.action_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAuditLogsRequest.action)
-}
-inline std::string* ListAuditLogsRequest::mutable_action() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_action();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListAuditLogsRequest.action)
-  return _s;
-}
-inline const std::string& ListAuditLogsRequest::_internal_action() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.action_.Get();
-}
-inline void ListAuditLogsRequest::_internal_set_action(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000004u;
-  _impl_.action_.Set(value, GetArena());
-}
-inline std::string* ListAuditLogsRequest::_internal_mutable_action() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000004u;
-  return _impl_.action_.Mutable( GetArena());
-}
-inline std::string* ListAuditLogsRequest::release_action() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListAuditLogsRequest.action)
-  if ((_impl_._has_bits_[0] & 0x00000004u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000004u;
-  auto* released = _impl_.action_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.action_.Set("", GetArena());
-  }
-  return released;
-}
-inline void ListAuditLogsRequest::set_allocated_action(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000004u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000004u;
-  }
-  _impl_.action_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.action_.IsDefault()) {
-    _impl_.action_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListAuditLogsRequest.action)
-}
-
-// optional string target_id = 6;
-inline bool ListAuditLogsRequest::has_target_id() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
-  return value;
-}
-inline void ListAuditLogsRequest::clear_target_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.target_id_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000008u;
-}
-inline const std::string& ListAuditLogsRequest::target_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsRequest.target_id)
-  return _internal_target_id();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListAuditLogsRequest::set_target_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000008u;
-  _impl_.target_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAuditLogsRequest.target_id)
-}
-inline std::string* ListAuditLogsRequest::mutable_target_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_target_id();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListAuditLogsRequest.target_id)
-  return _s;
-}
-inline const std::string& ListAuditLogsRequest::_internal_target_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.target_id_.Get();
-}
-inline void ListAuditLogsRequest::_internal_set_target_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000008u;
-  _impl_.target_id_.Set(value, GetArena());
-}
-inline std::string* ListAuditLogsRequest::_internal_mutable_target_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000008u;
-  return _impl_.target_id_.Mutable( GetArena());
-}
-inline std::string* ListAuditLogsRequest::release_target_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListAuditLogsRequest.target_id)
-  if ((_impl_._has_bits_[0] & 0x00000008u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000008u;
-  auto* released = _impl_.target_id_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.target_id_.Set("", GetArena());
-  }
-  return released;
-}
-inline void ListAuditLogsRequest::set_allocated_target_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000008u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000008u;
-  }
-  _impl_.target_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.target_id_.IsDefault()) {
-    _impl_.target_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListAuditLogsRequest.target_id)
-}
-
-// optional int64 start_time = 7;
-inline bool ListAuditLogsRequest::has_start_time() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
-  return value;
-}
-inline void ListAuditLogsRequest::clear_start_time() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.start_time_ = ::int64_t{0};
-  _impl_._has_bits_[0] &= ~0x00000010u;
-}
-inline ::int64_t ListAuditLogsRequest::start_time() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsRequest.start_time)
-  return _internal_start_time();
-}
-inline void ListAuditLogsRequest::set_start_time(::int64_t value) {
-  _internal_set_start_time(value);
-  _impl_._has_bits_[0] |= 0x00000010u;
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAuditLogsRequest.start_time)
-}
-inline ::int64_t ListAuditLogsRequest::_internal_start_time() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.start_time_;
-}
-inline void ListAuditLogsRequest::_internal_set_start_time(::int64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.start_time_ = value;
-}
-
-// optional int64 end_time = 8;
-inline bool ListAuditLogsRequest::has_end_time() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
-  return value;
-}
-inline void ListAuditLogsRequest::clear_end_time() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.end_time_ = ::int64_t{0};
-  _impl_._has_bits_[0] &= ~0x00000020u;
-}
-inline ::int64_t ListAuditLogsRequest::end_time() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsRequest.end_time)
-  return _internal_end_time();
-}
-inline void ListAuditLogsRequest::set_end_time(::int64_t value) {
-  _internal_set_end_time(value);
-  _impl_._has_bits_[0] |= 0x00000020u;
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAuditLogsRequest.end_time)
-}
-inline ::int64_t ListAuditLogsRequest::_internal_end_time() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.end_time_;
-}
-inline void ListAuditLogsRequest::_internal_set_end_time(::int64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.end_time_ = value;
-}
-
-// -------------------------------------------------------------------
-
-// ListAuditLogsResponse_AuditLog
-
-// int64 id = 1;
-inline void ListAuditLogsResponse_AuditLog::clear_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.id_ = ::int64_t{0};
-}
-inline ::int64_t ListAuditLogsResponse_AuditLog::id() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsResponse.AuditLog.id)
-  return _internal_id();
-}
-inline void ListAuditLogsResponse_AuditLog::set_id(::int64_t value) {
-  _internal_set_id(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAuditLogsResponse.AuditLog.id)
-}
-inline ::int64_t ListAuditLogsResponse_AuditLog::_internal_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.id_;
-}
-inline void ListAuditLogsResponse_AuditLog::_internal_set_id(::int64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.id_ = value;
-}
-
-// int64 operator_id = 2;
-inline void ListAuditLogsResponse_AuditLog::clear_operator_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.operator_id_ = ::int64_t{0};
-}
-inline ::int64_t ListAuditLogsResponse_AuditLog::operator_id() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsResponse.AuditLog.operator_id)
-  return _internal_operator_id();
-}
-inline void ListAuditLogsResponse_AuditLog::set_operator_id(::int64_t value) {
-  _internal_set_operator_id(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAuditLogsResponse.AuditLog.operator_id)
-}
-inline ::int64_t ListAuditLogsResponse_AuditLog::_internal_operator_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.operator_id_;
-}
-inline void ListAuditLogsResponse_AuditLog::_internal_set_operator_id(::int64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.operator_id_ = value;
-}
-
-// string operator_name = 3;
-inline void ListAuditLogsResponse_AuditLog::clear_operator_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.operator_name_.ClearToEmpty();
-}
-inline const std::string& ListAuditLogsResponse_AuditLog::operator_name() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsResponse.AuditLog.operator_name)
-  return _internal_operator_name();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListAuditLogsResponse_AuditLog::set_operator_name(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.operator_name_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAuditLogsResponse.AuditLog.operator_name)
-}
-inline std::string* ListAuditLogsResponse_AuditLog::mutable_operator_name() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_operator_name();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListAuditLogsResponse.AuditLog.operator_name)
-  return _s;
-}
-inline const std::string& ListAuditLogsResponse_AuditLog::_internal_operator_name() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.operator_name_.Get();
-}
-inline void ListAuditLogsResponse_AuditLog::_internal_set_operator_name(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.operator_name_.Set(value, GetArena());
-}
-inline std::string* ListAuditLogsResponse_AuditLog::_internal_mutable_operator_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.operator_name_.Mutable( GetArena());
-}
-inline std::string* ListAuditLogsResponse_AuditLog::release_operator_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListAuditLogsResponse.AuditLog.operator_name)
-  return _impl_.operator_name_.Release();
-}
-inline void ListAuditLogsResponse_AuditLog::set_allocated_operator_name(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.operator_name_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.operator_name_.IsDefault()) {
-    _impl_.operator_name_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListAuditLogsResponse.AuditLog.operator_name)
-}
-
-// string app_code = 4;
-inline void ListAuditLogsResponse_AuditLog::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& ListAuditLogsResponse_AuditLog::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsResponse.AuditLog.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListAuditLogsResponse_AuditLog::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAuditLogsResponse.AuditLog.app_code)
-}
-inline std::string* ListAuditLogsResponse_AuditLog::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListAuditLogsResponse.AuditLog.app_code)
-  return _s;
-}
-inline const std::string& ListAuditLogsResponse_AuditLog::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void ListAuditLogsResponse_AuditLog::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* ListAuditLogsResponse_AuditLog::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* ListAuditLogsResponse_AuditLog::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListAuditLogsResponse.AuditLog.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void ListAuditLogsResponse_AuditLog::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListAuditLogsResponse.AuditLog.app_code)
-}
-
-// string action = 5;
-inline void ListAuditLogsResponse_AuditLog::clear_action() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.action_.ClearToEmpty();
-}
-inline const std::string& ListAuditLogsResponse_AuditLog::action() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsResponse.AuditLog.action)
-  return _internal_action();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListAuditLogsResponse_AuditLog::set_action(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.action_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAuditLogsResponse.AuditLog.action)
-}
-inline std::string* ListAuditLogsResponse_AuditLog::mutable_action() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_action();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListAuditLogsResponse.AuditLog.action)
-  return _s;
-}
-inline const std::string& ListAuditLogsResponse_AuditLog::_internal_action() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.action_.Get();
-}
-inline void ListAuditLogsResponse_AuditLog::_internal_set_action(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.action_.Set(value, GetArena());
-}
-inline std::string* ListAuditLogsResponse_AuditLog::_internal_mutable_action() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.action_.Mutable( GetArena());
-}
-inline std::string* ListAuditLogsResponse_AuditLog::release_action() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListAuditLogsResponse.AuditLog.action)
-  return _impl_.action_.Release();
-}
-inline void ListAuditLogsResponse_AuditLog::set_allocated_action(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.action_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.action_.IsDefault()) {
-    _impl_.action_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListAuditLogsResponse.AuditLog.action)
-}
-
-// string target_type = 6;
-inline void ListAuditLogsResponse_AuditLog::clear_target_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.target_type_.ClearToEmpty();
-}
-inline const std::string& ListAuditLogsResponse_AuditLog::target_type() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsResponse.AuditLog.target_type)
-  return _internal_target_type();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListAuditLogsResponse_AuditLog::set_target_type(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.target_type_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAuditLogsResponse.AuditLog.target_type)
-}
-inline std::string* ListAuditLogsResponse_AuditLog::mutable_target_type() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_target_type();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListAuditLogsResponse.AuditLog.target_type)
-  return _s;
-}
-inline const std::string& ListAuditLogsResponse_AuditLog::_internal_target_type() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.target_type_.Get();
-}
-inline void ListAuditLogsResponse_AuditLog::_internal_set_target_type(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.target_type_.Set(value, GetArena());
-}
-inline std::string* ListAuditLogsResponse_AuditLog::_internal_mutable_target_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.target_type_.Mutable( GetArena());
-}
-inline std::string* ListAuditLogsResponse_AuditLog::release_target_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListAuditLogsResponse.AuditLog.target_type)
-  return _impl_.target_type_.Release();
-}
-inline void ListAuditLogsResponse_AuditLog::set_allocated_target_type(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.target_type_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.target_type_.IsDefault()) {
-    _impl_.target_type_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListAuditLogsResponse.AuditLog.target_type)
-}
-
-// string target_id = 7;
-inline void ListAuditLogsResponse_AuditLog::clear_target_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.target_id_.ClearToEmpty();
-}
-inline const std::string& ListAuditLogsResponse_AuditLog::target_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsResponse.AuditLog.target_id)
-  return _internal_target_id();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListAuditLogsResponse_AuditLog::set_target_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.target_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAuditLogsResponse.AuditLog.target_id)
-}
-inline std::string* ListAuditLogsResponse_AuditLog::mutable_target_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_target_id();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListAuditLogsResponse.AuditLog.target_id)
-  return _s;
-}
-inline const std::string& ListAuditLogsResponse_AuditLog::_internal_target_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.target_id_.Get();
-}
-inline void ListAuditLogsResponse_AuditLog::_internal_set_target_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.target_id_.Set(value, GetArena());
-}
-inline std::string* ListAuditLogsResponse_AuditLog::_internal_mutable_target_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.target_id_.Mutable( GetArena());
-}
-inline std::string* ListAuditLogsResponse_AuditLog::release_target_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListAuditLogsResponse.AuditLog.target_id)
-  return _impl_.target_id_.Release();
-}
-inline void ListAuditLogsResponse_AuditLog::set_allocated_target_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.target_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.target_id_.IsDefault()) {
-    _impl_.target_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListAuditLogsResponse.AuditLog.target_id)
-}
-
-// string target_name = 8;
-inline void ListAuditLogsResponse_AuditLog::clear_target_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.target_name_.ClearToEmpty();
-}
-inline const std::string& ListAuditLogsResponse_AuditLog::target_name() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsResponse.AuditLog.target_name)
-  return _internal_target_name();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListAuditLogsResponse_AuditLog::set_target_name(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.target_name_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAuditLogsResponse.AuditLog.target_name)
-}
-inline std::string* ListAuditLogsResponse_AuditLog::mutable_target_name() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_target_name();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListAuditLogsResponse.AuditLog.target_name)
-  return _s;
-}
-inline const std::string& ListAuditLogsResponse_AuditLog::_internal_target_name() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.target_name_.Get();
-}
-inline void ListAuditLogsResponse_AuditLog::_internal_set_target_name(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.target_name_.Set(value, GetArena());
-}
-inline std::string* ListAuditLogsResponse_AuditLog::_internal_mutable_target_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.target_name_.Mutable( GetArena());
-}
-inline std::string* ListAuditLogsResponse_AuditLog::release_target_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListAuditLogsResponse.AuditLog.target_name)
-  return _impl_.target_name_.Release();
-}
-inline void ListAuditLogsResponse_AuditLog::set_allocated_target_name(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.target_name_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.target_name_.IsDefault()) {
-    _impl_.target_name_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListAuditLogsResponse.AuditLog.target_name)
-}
-
-// string object_type = 9;
-inline void ListAuditLogsResponse_AuditLog::clear_object_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.object_type_.ClearToEmpty();
-}
-inline const std::string& ListAuditLogsResponse_AuditLog::object_type() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsResponse.AuditLog.object_type)
-  return _internal_object_type();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListAuditLogsResponse_AuditLog::set_object_type(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.object_type_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAuditLogsResponse.AuditLog.object_type)
-}
-inline std::string* ListAuditLogsResponse_AuditLog::mutable_object_type() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_object_type();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListAuditLogsResponse.AuditLog.object_type)
-  return _s;
-}
-inline const std::string& ListAuditLogsResponse_AuditLog::_internal_object_type() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.object_type_.Get();
-}
-inline void ListAuditLogsResponse_AuditLog::_internal_set_object_type(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.object_type_.Set(value, GetArena());
-}
-inline std::string* ListAuditLogsResponse_AuditLog::_internal_mutable_object_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.object_type_.Mutable( GetArena());
-}
-inline std::string* ListAuditLogsResponse_AuditLog::release_object_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListAuditLogsResponse.AuditLog.object_type)
-  return _impl_.object_type_.Release();
-}
-inline void ListAuditLogsResponse_AuditLog::set_allocated_object_type(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.object_type_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.object_type_.IsDefault()) {
-    _impl_.object_type_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListAuditLogsResponse.AuditLog.object_type)
-}
-
-// string object_id = 10;
-inline void ListAuditLogsResponse_AuditLog::clear_object_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.object_id_.ClearToEmpty();
-}
-inline const std::string& ListAuditLogsResponse_AuditLog::object_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsResponse.AuditLog.object_id)
-  return _internal_object_id();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListAuditLogsResponse_AuditLog::set_object_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.object_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAuditLogsResponse.AuditLog.object_id)
-}
-inline std::string* ListAuditLogsResponse_AuditLog::mutable_object_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_object_id();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListAuditLogsResponse.AuditLog.object_id)
-  return _s;
-}
-inline const std::string& ListAuditLogsResponse_AuditLog::_internal_object_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.object_id_.Get();
-}
-inline void ListAuditLogsResponse_AuditLog::_internal_set_object_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.object_id_.Set(value, GetArena());
-}
-inline std::string* ListAuditLogsResponse_AuditLog::_internal_mutable_object_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.object_id_.Mutable( GetArena());
-}
-inline std::string* ListAuditLogsResponse_AuditLog::release_object_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListAuditLogsResponse.AuditLog.object_id)
-  return _impl_.object_id_.Release();
-}
-inline void ListAuditLogsResponse_AuditLog::set_allocated_object_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.object_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.object_id_.IsDefault()) {
-    _impl_.object_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListAuditLogsResponse.AuditLog.object_id)
-}
-
-// string object_name = 11;
-inline void ListAuditLogsResponse_AuditLog::clear_object_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.object_name_.ClearToEmpty();
-}
-inline const std::string& ListAuditLogsResponse_AuditLog::object_name() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsResponse.AuditLog.object_name)
-  return _internal_object_name();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListAuditLogsResponse_AuditLog::set_object_name(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.object_name_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAuditLogsResponse.AuditLog.object_name)
-}
-inline std::string* ListAuditLogsResponse_AuditLog::mutable_object_name() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_object_name();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListAuditLogsResponse.AuditLog.object_name)
-  return _s;
-}
-inline const std::string& ListAuditLogsResponse_AuditLog::_internal_object_name() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.object_name_.Get();
-}
-inline void ListAuditLogsResponse_AuditLog::_internal_set_object_name(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.object_name_.Set(value, GetArena());
-}
-inline std::string* ListAuditLogsResponse_AuditLog::_internal_mutable_object_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.object_name_.Mutable( GetArena());
-}
-inline std::string* ListAuditLogsResponse_AuditLog::release_object_name() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListAuditLogsResponse.AuditLog.object_name)
-  return _impl_.object_name_.Release();
-}
-inline void ListAuditLogsResponse_AuditLog::set_allocated_object_name(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.object_name_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.object_name_.IsDefault()) {
-    _impl_.object_name_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListAuditLogsResponse.AuditLog.object_name)
-}
-
-// string created_at = 12;
-inline void ListAuditLogsResponse_AuditLog::clear_created_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.ClearToEmpty();
-}
-inline const std::string& ListAuditLogsResponse_AuditLog::created_at() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsResponse.AuditLog.created_at)
-  return _internal_created_at();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListAuditLogsResponse_AuditLog::set_created_at(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAuditLogsResponse.AuditLog.created_at)
-}
-inline std::string* ListAuditLogsResponse_AuditLog::mutable_created_at() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_created_at();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListAuditLogsResponse.AuditLog.created_at)
-  return _s;
-}
-inline const std::string& ListAuditLogsResponse_AuditLog::_internal_created_at() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.created_at_.Get();
-}
-inline void ListAuditLogsResponse_AuditLog::_internal_set_created_at(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.Set(value, GetArena());
-}
-inline std::string* ListAuditLogsResponse_AuditLog::_internal_mutable_created_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.created_at_.Mutable( GetArena());
-}
-inline std::string* ListAuditLogsResponse_AuditLog::release_created_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListAuditLogsResponse.AuditLog.created_at)
-  return _impl_.created_at_.Release();
-}
-inline void ListAuditLogsResponse_AuditLog::set_allocated_created_at(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.created_at_.IsDefault()) {
-    _impl_.created_at_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListAuditLogsResponse.AuditLog.created_at)
-}
-
-// -------------------------------------------------------------------
-
-// ListAuditLogsResponse
-
-// repeated .siqi.auth.ListAuditLogsResponse.AuditLog logs = 1;
-inline int ListAuditLogsResponse::_internal_logs_size() const {
-  return _internal_logs().size();
-}
-inline int ListAuditLogsResponse::logs_size() const {
-  return _internal_logs_size();
-}
-inline void ListAuditLogsResponse::clear_logs() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.logs_.Clear();
-}
-inline ::siqi::auth::ListAuditLogsResponse_AuditLog* ListAuditLogsResponse::mutable_logs(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListAuditLogsResponse.logs)
-  return _internal_mutable_logs()->Mutable(index);
-}
-inline ::google::protobuf::RepeatedPtrField<::siqi::auth::ListAuditLogsResponse_AuditLog>* ListAuditLogsResponse::mutable_logs()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:siqi.auth.ListAuditLogsResponse.logs)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_logs();
-}
-inline const ::siqi::auth::ListAuditLogsResponse_AuditLog& ListAuditLogsResponse::logs(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsResponse.logs)
-  return _internal_logs().Get(index);
-}
-inline ::siqi::auth::ListAuditLogsResponse_AuditLog* ListAuditLogsResponse::add_logs() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::siqi::auth::ListAuditLogsResponse_AuditLog* _add = _internal_mutable_logs()->Add();
-  // @@protoc_insertion_point(field_add:siqi.auth.ListAuditLogsResponse.logs)
-  return _add;
-}
-inline const ::google::protobuf::RepeatedPtrField<::siqi::auth::ListAuditLogsResponse_AuditLog>& ListAuditLogsResponse::logs() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:siqi.auth.ListAuditLogsResponse.logs)
-  return _internal_logs();
-}
-inline const ::google::protobuf::RepeatedPtrField<::siqi::auth::ListAuditLogsResponse_AuditLog>&
-ListAuditLogsResponse::_internal_logs() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.logs_;
-}
-inline ::google::protobuf::RepeatedPtrField<::siqi::auth::ListAuditLogsResponse_AuditLog>*
-ListAuditLogsResponse::_internal_mutable_logs() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.logs_;
-}
-
-// int64 total = 2;
-inline void ListAuditLogsResponse::clear_total() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.total_ = ::int64_t{0};
-}
-inline ::int64_t ListAuditLogsResponse::total() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsResponse.total)
-  return _internal_total();
-}
-inline void ListAuditLogsResponse::set_total(::int64_t value) {
-  _internal_set_total(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAuditLogsResponse.total)
-}
-inline ::int64_t ListAuditLogsResponse::_internal_total() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.total_;
-}
-inline void ListAuditLogsResponse::_internal_set_total(::int64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.total_ = value;
-}
-
-// int32 page = 3;
-inline void ListAuditLogsResponse::clear_page() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = 0;
-}
-inline ::int32_t ListAuditLogsResponse::page() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsResponse.page)
-  return _internal_page();
-}
-inline void ListAuditLogsResponse::set_page(::int32_t value) {
-  _internal_set_page(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAuditLogsResponse.page)
-}
-inline ::int32_t ListAuditLogsResponse::_internal_page() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_;
-}
-inline void ListAuditLogsResponse::_internal_set_page(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = value;
-}
-
-// int32 page_size = 4;
-inline void ListAuditLogsResponse::clear_page_size() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = 0;
-}
-inline ::int32_t ListAuditLogsResponse::page_size() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListAuditLogsResponse.page_size)
-  return _internal_page_size();
-}
-inline void ListAuditLogsResponse::set_page_size(::int32_t value) {
-  _internal_set_page_size(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListAuditLogsResponse.page_size)
-}
-inline ::int32_t ListAuditLogsResponse::_internal_page_size() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_size_;
-}
-inline void ListAuditLogsResponse::_internal_set_page_size(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = value;
-}
-
-// -------------------------------------------------------------------
-
-// AdminResponse
-
-// bool success = 1;
-inline void AdminResponse::clear_success() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.success_ = false;
-}
-inline bool AdminResponse::success() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.AdminResponse.success)
-  return _internal_success();
-}
-inline void AdminResponse::set_success(bool value) {
-  _internal_set_success(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.AdminResponse.success)
-}
-inline bool AdminResponse::_internal_success() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.success_;
-}
-inline void AdminResponse::_internal_set_success(bool value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.success_ = value;
-}
-
-// int32 code = 2;
-inline void AdminResponse::clear_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.code_ = 0;
-}
-inline ::int32_t AdminResponse::code() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.AdminResponse.code)
-  return _internal_code();
-}
-inline void AdminResponse::set_code(::int32_t value) {
-  _internal_set_code(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.AdminResponse.code)
-}
-inline ::int32_t AdminResponse::_internal_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.code_;
-}
-inline void AdminResponse::_internal_set_code(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.code_ = value;
-}
-
-// string message = 3;
-inline void AdminResponse::clear_message() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.message_.ClearToEmpty();
-}
-inline const std::string& AdminResponse::message() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.AdminResponse.message)
-  return _internal_message();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void AdminResponse::set_message(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.message_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.AdminResponse.message)
-}
-inline std::string* AdminResponse::mutable_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_message();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.AdminResponse.message)
-  return _s;
-}
-inline const std::string& AdminResponse::_internal_message() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.message_.Get();
-}
-inline void AdminResponse::_internal_set_message(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.message_.Set(value, GetArena());
-}
-inline std::string* AdminResponse::_internal_mutable_message() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.message_.Mutable( GetArena());
-}
-inline std::string* AdminResponse::release_message() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.AdminResponse.message)
-  return _impl_.message_.Release();
-}
-inline void AdminResponse::set_allocated_message(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.message_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.message_.IsDefault()) {
-    _impl_.message_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.AdminResponse.message)
-}
-
-// optional string app_secret = 4;
-inline bool AdminResponse::has_app_secret() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
-}
-inline void AdminResponse::clear_app_secret() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_secret_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const std::string& AdminResponse::app_secret() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.AdminResponse.app_secret)
-  return _internal_app_secret();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void AdminResponse::set_app_secret(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.app_secret_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.AdminResponse.app_secret)
-}
-inline std::string* AdminResponse::mutable_app_secret() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_secret();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.AdminResponse.app_secret)
-  return _s;
-}
-inline const std::string& AdminResponse::_internal_app_secret() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_secret_.Get();
-}
-inline void AdminResponse::_internal_set_app_secret(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.app_secret_.Set(value, GetArena());
-}
-inline std::string* AdminResponse::_internal_mutable_app_secret() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.app_secret_.Mutable( GetArena());
-}
-inline std::string* AdminResponse::release_app_secret() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.AdminResponse.app_secret)
-  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* released = _impl_.app_secret_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.app_secret_.Set("", GetArena());
-  }
-  return released;
-}
-inline void AdminResponse::set_allocated_app_secret(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  _impl_.app_secret_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_secret_.IsDefault()) {
-    _impl_.app_secret_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.AdminResponse.app_secret)
-}
-
-// -------------------------------------------------------------------
-
-// LoginRequest
-
-// string username = 1;
-inline void LoginRequest::clear_username() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.username_.ClearToEmpty();
-}
-inline const std::string& LoginRequest::username() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.LoginRequest.username)
-  return _internal_username();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void LoginRequest::set_username(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.username_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.LoginRequest.username)
-}
-inline std::string* LoginRequest::mutable_username() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_username();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.LoginRequest.username)
-  return _s;
-}
-inline const std::string& LoginRequest::_internal_username() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.username_.Get();
-}
-inline void LoginRequest::_internal_set_username(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.username_.Set(value, GetArena());
-}
-inline std::string* LoginRequest::_internal_mutable_username() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.username_.Mutable( GetArena());
-}
-inline std::string* LoginRequest::release_username() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.LoginRequest.username)
-  return _impl_.username_.Release();
-}
-inline void LoginRequest::set_allocated_username(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.username_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.username_.IsDefault()) {
-    _impl_.username_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.LoginRequest.username)
-}
-
-// string password = 2;
-inline void LoginRequest::clear_password() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.password_.ClearToEmpty();
-}
-inline const std::string& LoginRequest::password() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.LoginRequest.password)
-  return _internal_password();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void LoginRequest::set_password(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.password_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.LoginRequest.password)
-}
-inline std::string* LoginRequest::mutable_password() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_password();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.LoginRequest.password)
-  return _s;
-}
-inline const std::string& LoginRequest::_internal_password() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.password_.Get();
-}
-inline void LoginRequest::_internal_set_password(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.password_.Set(value, GetArena());
-}
-inline std::string* LoginRequest::_internal_mutable_password() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.password_.Mutable( GetArena());
-}
-inline std::string* LoginRequest::release_password() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.LoginRequest.password)
-  return _impl_.password_.Release();
-}
-inline void LoginRequest::set_allocated_password(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.password_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.password_.IsDefault()) {
-    _impl_.password_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.LoginRequest.password)
-}
-
-// -------------------------------------------------------------------
-
-// LoginResponse
-
-// bool success = 1;
-inline void LoginResponse::clear_success() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.success_ = false;
-}
-inline bool LoginResponse::success() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.LoginResponse.success)
-  return _internal_success();
-}
-inline void LoginResponse::set_success(bool value) {
-  _internal_set_success(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.LoginResponse.success)
-}
-inline bool LoginResponse::_internal_success() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.success_;
-}
-inline void LoginResponse::_internal_set_success(bool value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.success_ = value;
-}
-
-// string message = 2;
-inline void LoginResponse::clear_message() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.message_.ClearToEmpty();
-}
-inline const std::string& LoginResponse::message() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.LoginResponse.message)
-  return _internal_message();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void LoginResponse::set_message(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.message_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.LoginResponse.message)
-}
-inline std::string* LoginResponse::mutable_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_message();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.LoginResponse.message)
-  return _s;
-}
-inline const std::string& LoginResponse::_internal_message() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.message_.Get();
-}
-inline void LoginResponse::_internal_set_message(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.message_.Set(value, GetArena());
-}
-inline std::string* LoginResponse::_internal_mutable_message() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.message_.Mutable( GetArena());
-}
-inline std::string* LoginResponse::release_message() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.LoginResponse.message)
-  return _impl_.message_.Release();
-}
-inline void LoginResponse::set_allocated_message(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.message_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.message_.IsDefault()) {
-    _impl_.message_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.LoginResponse.message)
-}
-
-// string token = 3;
-inline void LoginResponse::clear_token() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.token_.ClearToEmpty();
-}
-inline const std::string& LoginResponse::token() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.LoginResponse.token)
-  return _internal_token();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void LoginResponse::set_token(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.token_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.LoginResponse.token)
-}
-inline std::string* LoginResponse::mutable_token() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_token();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.LoginResponse.token)
-  return _s;
-}
-inline const std::string& LoginResponse::_internal_token() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.token_.Get();
-}
-inline void LoginResponse::_internal_set_token(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.token_.Set(value, GetArena());
-}
-inline std::string* LoginResponse::_internal_mutable_token() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.token_.Mutable( GetArena());
-}
-inline std::string* LoginResponse::release_token() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.LoginResponse.token)
-  return _impl_.token_.Release();
-}
-inline void LoginResponse::set_allocated_token(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.token_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.token_.IsDefault()) {
-    _impl_.token_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.LoginResponse.token)
-}
-
-// -------------------------------------------------------------------
-
-// ListUserRolesRequest
-
-// string app_code = 1;
-inline void ListUserRolesRequest::clear_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.ClearToEmpty();
-}
-inline const std::string& ListUserRolesRequest::app_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListUserRolesRequest.app_code)
-  return _internal_app_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListUserRolesRequest::set_app_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListUserRolesRequest.app_code)
-}
-inline std::string* ListUserRolesRequest::mutable_app_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_app_code();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListUserRolesRequest.app_code)
-  return _s;
-}
-inline const std::string& ListUserRolesRequest::_internal_app_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.app_code_.Get();
-}
-inline void ListUserRolesRequest::_internal_set_app_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.Set(value, GetArena());
-}
-inline std::string* ListUserRolesRequest::_internal_mutable_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.app_code_.Mutable( GetArena());
-}
-inline std::string* ListUserRolesRequest::release_app_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListUserRolesRequest.app_code)
-  return _impl_.app_code_.Release();
-}
-inline void ListUserRolesRequest::set_allocated_app_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.app_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.app_code_.IsDefault()) {
-    _impl_.app_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListUserRolesRequest.app_code)
-}
-
-// int32 page = 2;
-inline void ListUserRolesRequest::clear_page() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = 0;
-}
-inline ::int32_t ListUserRolesRequest::page() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListUserRolesRequest.page)
-  return _internal_page();
-}
-inline void ListUserRolesRequest::set_page(::int32_t value) {
-  _internal_set_page(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListUserRolesRequest.page)
-}
-inline ::int32_t ListUserRolesRequest::_internal_page() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_;
-}
-inline void ListUserRolesRequest::_internal_set_page(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = value;
-}
-
-// int32 page_size = 3;
-inline void ListUserRolesRequest::clear_page_size() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = 0;
-}
-inline ::int32_t ListUserRolesRequest::page_size() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListUserRolesRequest.page_size)
-  return _internal_page_size();
-}
-inline void ListUserRolesRequest::set_page_size(::int32_t value) {
-  _internal_set_page_size(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListUserRolesRequest.page_size)
-}
-inline ::int32_t ListUserRolesRequest::_internal_page_size() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_size_;
-}
-inline void ListUserRolesRequest::_internal_set_page_size(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = value;
-}
-
-// optional string user_id = 4;
-inline bool ListUserRolesRequest::has_user_id() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
-}
-inline void ListUserRolesRequest::clear_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const std::string& ListUserRolesRequest::user_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListUserRolesRequest.user_id)
-  return _internal_user_id();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListUserRolesRequest::set_user_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.user_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListUserRolesRequest.user_id)
-}
-inline std::string* ListUserRolesRequest::mutable_user_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_user_id();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListUserRolesRequest.user_id)
-  return _s;
-}
-inline const std::string& ListUserRolesRequest::_internal_user_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.user_id_.Get();
-}
-inline void ListUserRolesRequest::_internal_set_user_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.user_id_.Set(value, GetArena());
-}
-inline std::string* ListUserRolesRequest::_internal_mutable_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.user_id_.Mutable( GetArena());
-}
-inline std::string* ListUserRolesRequest::release_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListUserRolesRequest.user_id)
-  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* released = _impl_.user_id_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.user_id_.Set("", GetArena());
-  }
-  return released;
-}
-inline void ListUserRolesRequest::set_allocated_user_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  _impl_.user_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.user_id_.IsDefault()) {
-    _impl_.user_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListUserRolesRequest.user_id)
-}
-
-// -------------------------------------------------------------------
-
-// ListUserRolesResponse_UserRoleInfo
-
-// string user_id = 1;
-inline void ListUserRolesResponse_UserRoleInfo::clear_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.ClearToEmpty();
-}
-inline const std::string& ListUserRolesResponse_UserRoleInfo::user_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListUserRolesResponse.UserRoleInfo.user_id)
-  return _internal_user_id();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListUserRolesResponse_UserRoleInfo::set_user_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListUserRolesResponse.UserRoleInfo.user_id)
-}
-inline std::string* ListUserRolesResponse_UserRoleInfo::mutable_user_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_user_id();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListUserRolesResponse.UserRoleInfo.user_id)
-  return _s;
-}
-inline const std::string& ListUserRolesResponse_UserRoleInfo::_internal_user_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.user_id_.Get();
-}
-inline void ListUserRolesResponse_UserRoleInfo::_internal_set_user_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.Set(value, GetArena());
-}
-inline std::string* ListUserRolesResponse_UserRoleInfo::_internal_mutable_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.user_id_.Mutable( GetArena());
-}
-inline std::string* ListUserRolesResponse_UserRoleInfo::release_user_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListUserRolesResponse.UserRoleInfo.user_id)
-  return _impl_.user_id_.Release();
-}
-inline void ListUserRolesResponse_UserRoleInfo::set_allocated_user_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.user_id_.IsDefault()) {
-    _impl_.user_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListUserRolesResponse.UserRoleInfo.user_id)
-}
-
-// repeated string role_keys = 2;
-inline int ListUserRolesResponse_UserRoleInfo::_internal_role_keys_size() const {
-  return _internal_role_keys().size();
-}
-inline int ListUserRolesResponse_UserRoleInfo::role_keys_size() const {
-  return _internal_role_keys_size();
-}
-inline void ListUserRolesResponse_UserRoleInfo::clear_role_keys() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.role_keys_.Clear();
-}
-inline std::string* ListUserRolesResponse_UserRoleInfo::add_role_keys() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  std::string* _s = _internal_mutable_role_keys()->Add();
-  // @@protoc_insertion_point(field_add_mutable:siqi.auth.ListUserRolesResponse.UserRoleInfo.role_keys)
-  return _s;
-}
-inline const std::string& ListUserRolesResponse_UserRoleInfo::role_keys(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListUserRolesResponse.UserRoleInfo.role_keys)
-  return _internal_role_keys().Get(index);
-}
-inline std::string* ListUserRolesResponse_UserRoleInfo::mutable_role_keys(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListUserRolesResponse.UserRoleInfo.role_keys)
-  return _internal_mutable_role_keys()->Mutable(index);
-}
-template <typename Arg_, typename... Args_>
-inline void ListUserRolesResponse_UserRoleInfo::set_role_keys(int index, Arg_&& value, Args_... args) {
-  ::google::protobuf::internal::AssignToString(
-      *_internal_mutable_role_keys()->Mutable(index),
-      std::forward<Arg_>(value), args... );
-  // @@protoc_insertion_point(field_set:siqi.auth.ListUserRolesResponse.UserRoleInfo.role_keys)
-}
-template <typename Arg_, typename... Args_>
-inline void ListUserRolesResponse_UserRoleInfo::add_role_keys(Arg_&& value, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::google::protobuf::internal::AddToRepeatedPtrField(*_internal_mutable_role_keys(),
-                               std::forward<Arg_>(value),
-                               args... );
-  // @@protoc_insertion_point(field_add:siqi.auth.ListUserRolesResponse.UserRoleInfo.role_keys)
-}
-inline const ::google::protobuf::RepeatedPtrField<std::string>&
-ListUserRolesResponse_UserRoleInfo::role_keys() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:siqi.auth.ListUserRolesResponse.UserRoleInfo.role_keys)
-  return _internal_role_keys();
-}
-inline ::google::protobuf::RepeatedPtrField<std::string>*
-ListUserRolesResponse_UserRoleInfo::mutable_role_keys() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:siqi.auth.ListUserRolesResponse.UserRoleInfo.role_keys)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_role_keys();
-}
-inline const ::google::protobuf::RepeatedPtrField<std::string>&
-ListUserRolesResponse_UserRoleInfo::_internal_role_keys() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.role_keys_;
-}
-inline ::google::protobuf::RepeatedPtrField<std::string>*
-ListUserRolesResponse_UserRoleInfo::_internal_mutable_role_keys() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.role_keys_;
-}
-
-// string created_at = 3;
-inline void ListUserRolesResponse_UserRoleInfo::clear_created_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.ClearToEmpty();
-}
-inline const std::string& ListUserRolesResponse_UserRoleInfo::created_at() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListUserRolesResponse.UserRoleInfo.created_at)
-  return _internal_created_at();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ListUserRolesResponse_UserRoleInfo::set_created_at(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:siqi.auth.ListUserRolesResponse.UserRoleInfo.created_at)
-}
-inline std::string* ListUserRolesResponse_UserRoleInfo::mutable_created_at() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_created_at();
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListUserRolesResponse.UserRoleInfo.created_at)
-  return _s;
-}
-inline const std::string& ListUserRolesResponse_UserRoleInfo::_internal_created_at() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.created_at_.Get();
-}
-inline void ListUserRolesResponse_UserRoleInfo::_internal_set_created_at(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.Set(value, GetArena());
-}
-inline std::string* ListUserRolesResponse_UserRoleInfo::_internal_mutable_created_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.created_at_.Mutable( GetArena());
-}
-inline std::string* ListUserRolesResponse_UserRoleInfo::release_created_at() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:siqi.auth.ListUserRolesResponse.UserRoleInfo.created_at)
-  return _impl_.created_at_.Release();
-}
-inline void ListUserRolesResponse_UserRoleInfo::set_allocated_created_at(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.created_at_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.created_at_.IsDefault()) {
-    _impl_.created_at_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:siqi.auth.ListUserRolesResponse.UserRoleInfo.created_at)
-}
-
-// repeated string perm_keys = 4;
-inline int ListUserRolesResponse_UserRoleInfo::_internal_perm_keys_size() const {
-  return _internal_perm_keys().size();
-}
-inline int ListUserRolesResponse_UserRoleInfo::perm_keys_size() const {
-  return _internal_perm_keys_size();
-}
-inline void ListUserRolesResponse_UserRoleInfo::clear_perm_keys() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.perm_keys_.Clear();
-}
-inline std::string* ListUserRolesResponse_UserRoleInfo::add_perm_keys() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  std::string* _s = _internal_mutable_perm_keys()->Add();
-  // @@protoc_insertion_point(field_add_mutable:siqi.auth.ListUserRolesResponse.UserRoleInfo.perm_keys)
-  return _s;
-}
-inline const std::string& ListUserRolesResponse_UserRoleInfo::perm_keys(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListUserRolesResponse.UserRoleInfo.perm_keys)
-  return _internal_perm_keys().Get(index);
-}
-inline std::string* ListUserRolesResponse_UserRoleInfo::mutable_perm_keys(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListUserRolesResponse.UserRoleInfo.perm_keys)
-  return _internal_mutable_perm_keys()->Mutable(index);
-}
-template <typename Arg_, typename... Args_>
-inline void ListUserRolesResponse_UserRoleInfo::set_perm_keys(int index, Arg_&& value, Args_... args) {
-  ::google::protobuf::internal::AssignToString(
-      *_internal_mutable_perm_keys()->Mutable(index),
-      std::forward<Arg_>(value), args... );
-  // @@protoc_insertion_point(field_set:siqi.auth.ListUserRolesResponse.UserRoleInfo.perm_keys)
-}
-template <typename Arg_, typename... Args_>
-inline void ListUserRolesResponse_UserRoleInfo::add_perm_keys(Arg_&& value, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::google::protobuf::internal::AddToRepeatedPtrField(*_internal_mutable_perm_keys(),
-                               std::forward<Arg_>(value),
-                               args... );
-  // @@protoc_insertion_point(field_add:siqi.auth.ListUserRolesResponse.UserRoleInfo.perm_keys)
-}
-inline const ::google::protobuf::RepeatedPtrField<std::string>&
-ListUserRolesResponse_UserRoleInfo::perm_keys() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:siqi.auth.ListUserRolesResponse.UserRoleInfo.perm_keys)
-  return _internal_perm_keys();
-}
-inline ::google::protobuf::RepeatedPtrField<std::string>*
-ListUserRolesResponse_UserRoleInfo::mutable_perm_keys() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:siqi.auth.ListUserRolesResponse.UserRoleInfo.perm_keys)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_perm_keys();
-}
-inline const ::google::protobuf::RepeatedPtrField<std::string>&
-ListUserRolesResponse_UserRoleInfo::_internal_perm_keys() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.perm_keys_;
-}
-inline ::google::protobuf::RepeatedPtrField<std::string>*
-ListUserRolesResponse_UserRoleInfo::_internal_mutable_perm_keys() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.perm_keys_;
-}
-
-// -------------------------------------------------------------------
-
-// ListUserRolesResponse
-
-// repeated .siqi.auth.ListUserRolesResponse.UserRoleInfo users = 1;
-inline int ListUserRolesResponse::_internal_users_size() const {
-  return _internal_users().size();
-}
-inline int ListUserRolesResponse::users_size() const {
-  return _internal_users_size();
-}
-inline void ListUserRolesResponse::clear_users() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.users_.Clear();
-}
-inline ::siqi::auth::ListUserRolesResponse_UserRoleInfo* ListUserRolesResponse::mutable_users(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:siqi.auth.ListUserRolesResponse.users)
-  return _internal_mutable_users()->Mutable(index);
-}
-inline ::google::protobuf::RepeatedPtrField<::siqi::auth::ListUserRolesResponse_UserRoleInfo>* ListUserRolesResponse::mutable_users()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:siqi.auth.ListUserRolesResponse.users)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_users();
-}
-inline const ::siqi::auth::ListUserRolesResponse_UserRoleInfo& ListUserRolesResponse::users(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListUserRolesResponse.users)
-  return _internal_users().Get(index);
-}
-inline ::siqi::auth::ListUserRolesResponse_UserRoleInfo* ListUserRolesResponse::add_users() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::siqi::auth::ListUserRolesResponse_UserRoleInfo* _add = _internal_mutable_users()->Add();
-  // @@protoc_insertion_point(field_add:siqi.auth.ListUserRolesResponse.users)
-  return _add;
-}
-inline const ::google::protobuf::RepeatedPtrField<::siqi::auth::ListUserRolesResponse_UserRoleInfo>& ListUserRolesResponse::users() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:siqi.auth.ListUserRolesResponse.users)
-  return _internal_users();
-}
-inline const ::google::protobuf::RepeatedPtrField<::siqi::auth::ListUserRolesResponse_UserRoleInfo>&
-ListUserRolesResponse::_internal_users() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.users_;
-}
-inline ::google::protobuf::RepeatedPtrField<::siqi::auth::ListUserRolesResponse_UserRoleInfo>*
-ListUserRolesResponse::_internal_mutable_users() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.users_;
-}
-
-// int64 total = 2;
-inline void ListUserRolesResponse::clear_total() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.total_ = ::int64_t{0};
-}
-inline ::int64_t ListUserRolesResponse::total() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListUserRolesResponse.total)
-  return _internal_total();
-}
-inline void ListUserRolesResponse::set_total(::int64_t value) {
-  _internal_set_total(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListUserRolesResponse.total)
-}
-inline ::int64_t ListUserRolesResponse::_internal_total() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.total_;
-}
-inline void ListUserRolesResponse::_internal_set_total(::int64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.total_ = value;
-}
-
-// int32 page = 3;
-inline void ListUserRolesResponse::clear_page() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = 0;
-}
-inline ::int32_t ListUserRolesResponse::page() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListUserRolesResponse.page)
-  return _internal_page();
-}
-inline void ListUserRolesResponse::set_page(::int32_t value) {
-  _internal_set_page(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListUserRolesResponse.page)
-}
-inline ::int32_t ListUserRolesResponse::_internal_page() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_;
-}
-inline void ListUserRolesResponse::_internal_set_page(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_ = value;
-}
-
-// int32 page_size = 4;
-inline void ListUserRolesResponse::clear_page_size() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = 0;
-}
-inline ::int32_t ListUserRolesResponse::page_size() const {
-  // @@protoc_insertion_point(field_get:siqi.auth.ListUserRolesResponse.page_size)
-  return _internal_page_size();
-}
-inline void ListUserRolesResponse::set_page_size(::int32_t value) {
-  _internal_set_page_size(value);
-  // @@protoc_insertion_point(field_set:siqi.auth.ListUserRolesResponse.page_size)
-}
-inline ::int32_t ListUserRolesResponse::_internal_page_size() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.page_size_;
-}
-inline void ListUserRolesResponse::_internal_set_page_size(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.page_size_ = value;
-}
-
-#ifdef __GNUC__
-#pragma GCC diagnostic pop
-#endif  // __GNUC__
-
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace auth
-}  // namespace siqi
-
-
-// @@protoc_insertion_point(global_scope)
-
-#include "google/protobuf/port_undef.inc"
-
-#endif  // auth_2eproto_2epb_2eh
@@ -2,7 +2,7 @@
 #define AUTH_AGENT_H
 
 #include "auth.pb.h"
-#include "permission_dao.h" 
+#include "permission_store.h" 
 #include <brpc/server.h>
 #include <memory>
 
@@ -10,18 +10,24 @@
 class AuthAgentImpl : public siqi::auth::AuthService {
 private:
     // 不再持有 Channel，而是持有 DAO 指针
-    PermissionDAO* dao_;
+    PermissionStore* dao_;
 
 public:
     // 构造函数
     // dao: 已初始化的数据库访问对象
-    AuthAgentImpl(PermissionDAO* dao);
+    AuthAgentImpl(PermissionStore* dao);
     
     // 实现 AuthService 的 Check 接口
     void Check(google::protobuf::RpcController* cntl_base,
                const siqi::auth::CheckRequest* request,
                siqi::auth::CheckResponse* response,
                google::protobuf::Closure* done) override;
+
+    // 批量检查：客户端 SDK 会把短时间内的多个 Check 合并成一次 BatchCheck
+    void BatchCheck(google::protobuf::RpcController* cntl_base,
+                    const siqi::auth::BatchCheckRequest* request,
+                    siqi::auth::BatchCheckResponse* response,
+                    google::protobuf::Closure* done) override;
 };
 
 #endif // AUTH_AGENT_H
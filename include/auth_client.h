@@ -0,0 +1,151 @@
+#ifndef AUTH_CLIENT_H
+#define AUTH_CLIENT_H
+
+#include "auth.pb.h"
+#include "local_cache.h"
+#include <brpc/channel.h>
+#include <brpc/stream.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// 鉴权客户端 SDK
+// 业务进程（机器人、Web 后端）中的每次鉴权原本都是一次同步 RPC，AuthClient 在进程内逐层削减请求量：
+//  - 本地缓存：(app, user, perm) 的结论缓存 cache_ttl_s 秒；开启 watch 后订阅 AuthService.Watch，
+//    收到权限变更立即失效相关用户 / 应用，TTL 可以调大
+//  - 请求合并：同一 (app, user, perm) 已在查询中时，后来的调用只挂上回调，不再发 RPC
+//  - 自动攒批：batch_window_us 内发起的检查按应用合并为一次 BatchCheck（每批至多 max_batch 项）
+// 提供同步 Check、返回 std::future 的 CheckAsync 与回调形式的 CheckAsync。
+// 回调在 bRPC 的回调线程中执行，不要在其中做阻塞操作。
+class AuthClient : public brpc::StreamInputHandler {
+public:
+    struct Options {
+        // auth_server 或 auth_agent 地址，也可以写 "unix:/path/to.sock"；
+        // 留空或指向本机 auth_agent 的 TCP 端口时，若 agent_socket 存在且可信（所在目录其他用户不可写、
+        // 属主为 root / 当前用户 / 目录属主）则改走 Unix Domain Socket
+        std::string server;
+        std::string agent_socket = "/run/siqi_auth/agent.sock";  // 本机 auth_agent 的 --uds_path，空表示只用 TCP
+        int timeout_ms = 1000;
+        int connect_timeout_ms = 3000;
+        int max_retry = 1;
+        int cache_ttl_s = 30;               // 结论缓存时间，<= 0 关闭缓存
+        size_t cache_max_entries = 100000;  // 超过后整体清空一次
+        int batch_window_us = 1000;         // 攒批等待时间，<= 0 表示每次检查立即单独调用 Check
+        size_t max_batch = 200;             // 单次 BatchCheck 最多携带的检查数
+        bool watch = false;                 // 订阅权限变更推送（仅 auth_server 支持，auth_agent 不支持）
+        std::string watch_app_code;         // 只订阅某个应用的变更，空表示全部
+        int watch_retry_ms = 1000;          // 订阅失败或断开后的重连间隔
+    };
+
+    struct Result {
+        bool ok = false;       // 是否拿到了服务端的结论；RPC 失败或服务端出错时为 false（不写入缓存），allowed 按拒绝处理
+        bool allowed = false;
+        std::string error;     // ok 为 false 时的错误信息
+    };
+    using Callback = std::function<void(const Result&)>;
+
+    struct Stats {
+        uint64_t checks = 0;        // 调用方发起的检查次数
+        uint64_t cache_hits = 0;
+        uint64_t coalesced = 0;     // 合并到进行中请求上的次数
+        uint64_t rpcs = 0;          // 实际发出的 Check / BatchCheck 次数
+        uint64_t watch_events = 0;  // 收到的权限变更事件数
+        uint64_t head_seq = 0;      // 已处理到的变更序号
+        bool watching = false;
+    };
+
+    // 连接地址无效时抛出 std::runtime_error
+    explicit AuthClient(const Options& options);
+    ~AuthClient();
+
+    AuthClient(const AuthClient&) = delete;
+    AuthClient& operator=(const AuthClient&) = delete;
+
+    // 同步检查，阻塞当前线程直到拿到结论
+    Result Check(const std::string& app_code, const std::string& user_id, const std::string& perm_key);
+    std::future<Result> CheckAsync(const std::string& app_code, const std::string& user_id, const std::string& perm_key);
+    void CheckAsync(const std::string& app_code, const std::string& user_id, const std::string& perm_key,
+                    Callback done);
+
+    // 手动失效（例如业务方刚通过管理接口修改了权限，不想等推送或 TTL）
+    void InvalidateUser(const std::string& app_code, const std::string& user_id);
+    void InvalidateApp(const std::string& app_code);
+    void ClearCache();
+
+    Stats GetStats() const;
+
+    // brpc::StreamInputHandler：处理 Watch 推送
+    int on_received_messages(brpc::StreamId id, butil::IOBuf* const messages[], size_t size) override;
+    void on_idle_timeout(brpc::StreamId id) override;
+    void on_closed(brpc::StreamId id) override;
+
+private:
+    struct Item {
+        std::string key;
+        std::string app_code;
+        std::string user_id;
+        std::string perm_key;
+    };
+    struct CheckCall;
+    struct BatchCall;
+
+    static std::string Key(const std::string& app_code, const std::string& user_id, const std::string& perm_key) {
+        return app_code + ":" + user_id + ":" + perm_key;
+    }
+
+    void FlushLoop();
+    void SendCheck(const Item& item, uint64_t epoch);
+    void SendBatch(std::vector<Item> items, uint64_t epoch);
+    void OnCheckDone(CheckCall* call);
+    void OnBatchDone(BatchCall* call);
+    // 写入缓存（期间没有发生失效时）并唤醒该 key 上等待的全部调用方
+    void Complete(const std::string& key, const Result& result, uint64_t epoch);
+    void FinishRpc();
+    // 按前缀失效；prefixes 为空表示整体清空
+    void Invalidate(const std::vector<std::string>& prefixes);
+
+    void WatchLoop();
+    bool Subscribe();
+
+    Options options_;
+    brpc::Channel channel_;
+    std::unique_ptr<siqi::auth::AuthService_Stub> stub_;
+    LocalCache<bool> cache_;
+
+    std::mutex mutex_;
+    // 每次失效递增；发出请求时记下的值与返回时不一致，说明结论可能已过期，只返回不缓存
+    uint64_t epoch_ = 0;
+    std::unordered_map<std::string, std::vector<Callback>> inflight_;  // 查询中的 key -> 等待的调用方
+    std::vector<Item> queue_;                                          // 等待攒批发送
+    std::chrono::steady_clock::time_point queue_since_;
+    std::condition_variable cond_;
+    size_t outstanding_ = 0;  // 已发出尚未返回的 RPC
+    std::condition_variable idle_cond_;
+    bool stopped_ = false;
+    std::thread flusher_;
+
+    mutable std::mutex watch_mutex_;
+    std::condition_variable watch_cond_;
+    brpc::StreamId stream_ = brpc::INVALID_STREAM_ID;
+    bool watching_ = false;
+    size_t open_streams_ = 0;  // 尚未收到 on_closed 的流，析构前需要等它们关闭
+    uint64_t head_seq_ = 0;
+    bool watch_stopped_ = false;
+    std::thread watcher_;
+
+    std::atomic<uint64_t> checks_{0};
+    std::atomic<uint64_t> cache_hits_{0};
+    std::atomic<uint64_t> coalesced_{0};
+    std::atomic<uint64_t> rpcs_{0};
+    std::atomic<uint64_t> watch_events_{0};
+};
+
+#endif // AUTH_CLIENT_H
@@ -0,0 +1,101 @@
+#ifndef AUTH_METRICS_H
+#define AUTH_METRICS_H
+
+#include "app_catalog.h"
+#include "perm_cache.h"
+#include <butil/containers/doubly_buffered_data.h>
+#include <bvar/bvar.h>
+#include <bvar/multi_dimension.h>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// AuthService 鉴权路径的 bvar 指标，可在 /vars 查看，/brpc_metrics 以 Prometheus 格式导出
+//   auth_check_{hit,miss}_{allow,deny}   Check 延迟（从进入 Check 到写完响应，含 DB 执行器排队）
+//   auth_batch_check_{allow,deny}        BatchCheck 延迟（任一条目被拒绝记为 deny）
+//   auth_check_miss_load                 缓存未命中时查库加载用户权限的耗时
+//   auth_cache_{hit,miss}/_hit_ratio     缓存查询次数与最近 10 秒的命中率
+//   auth_cache_{entries,bytes}           缓存条目数与（按样本估算的）内存占用
+//   auth_app_requests{app,method}        按应用与接口划分的延迟与 QPS；只有应用目录中的应用有独立标签，其余记为 "_unknown"
+//   auth_check_deny{reason}              Check 按拒绝原因计数
+class AuthMetrics {
+public:
+    enum DenyReason {
+        kInvalidParams = 0,
+        kError,           // 查库异常
+        kAppNotFound,
+        kPermNotFound,
+        kNoRole,          // 用户不存在或未分配任何角色
+        kNoPermission,
+        kDenyReasonCount
+    };
+
+    // catalog 用于判断 app_code 是否为已注册的应用，为空时（例如 MemoryPermissionStore）所有应用都记为 "_unknown"
+    AuthMetrics(std::shared_ptr<PermCache> cache, std::shared_ptr<const AppCatalog> catalog);
+
+    AuthMetrics(const AuthMetrics&) = delete;
+    AuthMetrics& operator=(const AuthMetrics&) = delete;
+
+    // start_us 为请求进入时的 butil::cpuwide_time_us()
+    void RecordCheck(const std::string& app_code, bool cache_hit, bool allowed, int64_t start_us);
+    // BatchCheck 直接查库，不经过缓存，因此没有命中/未命中之分
+    void RecordBatchCheck(const std::string& app_code, int items, int denied, int64_t start_us);
+    void RecordCacheLookup(bool hit) {
+        if (hit) {
+            cache_hit_ << 1;
+        } else {
+            cache_miss_ << 1;
+        }
+    }
+    void RecordMissLoad(int64_t latency_us) { miss_load_ << latency_us; }
+    void RecordDeny(DenyReason reason) { *deny_[reason] << 1; }
+
+    // auth_check_deny 的 reason 标签，reason 越界时返回 nullptr
+    static const char* DenyReasonName(DenyReason reason);
+
+private:
+    enum Method { kCheck = 0, kBatchCheck, kMethodCount };
+
+    struct AppRecorders {
+        bvar::LatencyRecorder* by_method[kMethodCount];
+    };
+    using AppRecorderMap = std::unordered_map<std::string, AppRecorders>;
+
+    // 先查无锁的 app_code -> 记录器表；未命中时才查应用目录，已注册的应用建标签并加入表中，
+    // 其余（未注册的 app_code）统一记到 "_unknown"，不会因客户端传入任意字符串而新增时序
+    bvar::LatencyRecorder* AppRecorder(const std::string& app_code, Method method);
+
+    static double GetHitRatio(void* arg);
+    static int64_t GetCacheEntries(void* arg);
+    static int64_t GetCacheBytes(void* arg);
+
+    std::shared_ptr<PermCache> cache_;
+    std::shared_ptr<const AppCatalog> catalog_;
+
+    bvar::LatencyRecorder check_latency_[2][2];  // [cache_hit][allowed]
+    bvar::LatencyRecorder batch_latency_[2];     // [all_allowed]
+    bvar::LatencyRecorder miss_load_;
+    bvar::Adder<int64_t> batch_items_;
+    bvar::Adder<int64_t> batch_denied_;
+
+    bvar::Adder<int64_t> cache_hit_;
+    bvar::Adder<int64_t> cache_miss_;
+    bvar::Window<bvar::Adder<int64_t>> cache_hit_window_;
+    bvar::Window<bvar::Adder<int64_t>> cache_miss_window_;
+
+    bvar::MultiDimension<bvar::LatencyRecorder> app_requests_;
+    AppRecorders unknown_app_;
+    butil::DoublyBufferedData<AppRecorderMap> app_recorders_;
+    std::mutex app_recorders_mutex_;  // 串行化 app_recorders_ 的插入
+    bvar::MultiDimension<bvar::Adder<int64_t>> deny_counts_;
+    bvar::Adder<int64_t>* deny_[kDenyReasonCount];
+
+    // PassiveStatus 读取以上成员，放在最后构造、最先析构
+    bvar::PassiveStatus<double> cache_hit_ratio_;
+    bvar::PassiveStatus<int64_t> cache_entries_;
+    bvar::PassiveStatus<int64_t> cache_bytes_;
+};
+
+#endif // AUTH_METRICS_H
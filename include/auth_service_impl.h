@@ -3,29 +3,99 @@
 
 #include "permission_dao.h"
 #include "auth.pb.h"
-#include "local_cache.h"
+#include "auth_metrics.h"
+#include "access_log.h"
+#include "perm_cache.h"
+#include "db_executor.h"
+#include "change_feed.h"
+#include "handle_catalog.h"
 #include <brpc/server.h>
 #include <butil/logging.h>
+#include <mutex>
 #include <unordered_set>
 
 class AuthServiceImpl : public siqi::auth::AuthService {
 private:
-    PermissionDAO dao_;
+    // 权限数据存储：默认为 MySQL (PermissionDAO)，基准测试可换成 MemoryPermissionStore
+    std::shared_ptr<PermissionStore> dao_;
     // 缓存用户的所有权限Key (Set 用于快速查找)
     // Key: "app_code:user_id"
-    // Value: Set of permission keys
-    std::shared_ptr<LocalCache<std::unordered_set<std::string>>> cache_;
+    // Value: 权限 key 集合，以及 CheckById 按需生成的位图 (CachedPerms)
+    std::shared_ptr<PermCache> cache_;
     int cache_ttl_;
+    // 数据库执行器，为空时所有请求在 bRPC worker 中同步完成
+    std::shared_ptr<DBExecutor> db_executor_;
+    // 权限变更推送（依赖 dao_，声明在其后以保证先于 dao_ 析构）
+    std::unique_ptr<ChangeFeed> change_feed_;
+    // 整数句柄目录 (ResolveHandles / CheckById)，由后台线程定期刷新（依赖 dao_，声明在其后）
+    HandleCatalog handles_;
+    std::once_flag handles_started_;
+    // bvar 指标（/vars、/brpc_metrics）
+    AuthMetrics metrics_;
+    // Check / BatchCheck 的抽样访问日志，为空时不记录
+    std::shared_ptr<AccessLog> access_log_;
+
+    // 缓存查询之后的处理：未命中时查库并回填缓存，拒绝时生成诊断信息
+    // start_us 为进入 Check 的时间，用于记录包含排队在内的完整延迟
+    void ProcessCheck(const siqi::auth::CheckRequest* request,
+                      siqi::auth::CheckResponse* response,
+                      bool cache_hit,
+                      std::unordered_set<std::string>& user_perms,
+                      int64_t start_us);
+
+    void ProcessBatchCheck(brpc::Controller* cntl,
+                           const siqi::auth::BatchCheckRequest* request,
+                           siqi::auth::BatchCheckResponse* response,
+                           int64_t start_us);
+
+    // 按抽样率写一条 Check 访问日志；reason 为 kDenyReasonCount 表示没有拒绝原因
+    void LogCheck(const siqi::auth::CheckRequest* request, bool cache_hit, bool allowed,
+                  AuthMetrics::DenyReason reason, int64_t start_us);
+
+    // 取当前句柄目录（首次调用时启动后台刷新线程）
+    std::shared_ptr<const HandleCatalog::Snapshot> Handles();
+    // 按应用句柄取应用，并要求客户端持有的版本与该应用当前版本一致；
+    // 不一致或尚未加载时通知后台线程重新加载并返回 nullptr（调用方回答 ESTALE），不在当前线程查库
+    const HandleCatalog::App* FindCurrentApp(const HandleCatalog::Snapshot& snapshot,
+                                             uint64_t app_handle,
+                                             uint64_t client_version);
+    // 只查缓存：返回 1 允许、0 拒绝、-1 未命中（位图按需由缓存中的权限 key 生成）
+    int TestCachedBit(const HandleCatalog::App& app,
+                      const std::string& user_id,
+                      uint32_t bit);
+    // 查库加载用户权限（key 与位图）并回填缓存
+    CachedPerms LoadUserPerms(const HandleCatalog::App& app,
+                              const std::string& user_id);
+    void ProcessBatchCheckById(std::shared_ptr<const HandleCatalog::Snapshot> snapshot,
+                               const HandleCatalog::App* app,
+                               const siqi::auth::BatchCheckByIdRequest* request,
+                               siqi::auth::BatchCheckByIdResponse* response,
+                               const std::vector<int>& missing);
     
 public:
     // 构造函数
-    AuthServiceImpl(std::shared_ptr<LocalCache<std::unordered_set<std::string>>> cache,
+    AuthServiceImpl(std::shared_ptr<PermCache> cache,
                     const std::string& host,
                     int port,
                     const std::string& user,
                     const std::string& password,
                     const std::string& database,
-                    int cache_ttl);
+                    int cache_ttl,
+                    std::shared_ptr<DBExecutor> db_executor = nullptr,
+                    const std::vector<PermissionDAO::Endpoint>& db_replicas = {},
+                    int max_replica_lag_s = 5,
+                    std::shared_ptr<AppCatalog> app_catalog = nullptr,
+                    std::shared_ptr<ReadFence> read_fence = nullptr,
+                    const ChangeFeed::Options& watch_options = ChangeFeed::Options(),
+                    std::shared_ptr<AccessLog> access_log = nullptr);
+
+    // 使用外部提供的存储（例如进程内的 MemoryPermissionStore）
+    AuthServiceImpl(std::shared_ptr<PermCache> cache,
+                    std::shared_ptr<PermissionStore> store,
+                    int cache_ttl,
+                    std::shared_ptr<DBExecutor> db_executor = nullptr,
+                    const ChangeFeed::Options& watch_options = ChangeFeed::Options(),
+                    std::shared_ptr<AccessLog> access_log = nullptr);
     
     // 权限检查接口
     void Check(google::protobuf::RpcController* cntl,
@@ -38,6 +108,28 @@ public:
                     const siqi::auth::BatchCheckRequest* request,
                     siqi::auth::BatchCheckResponse* response,
                     google::protobuf::Closure* done) override;
+
+    // 订阅权限变更（bRPC Streaming）
+    void Watch(google::protobuf::RpcController* cntl,
+               const siqi::auth::WatchRequest* request,
+               siqi::auth::WatchResponse* response,
+               google::protobuf::Closure* done) override;
+    
+    // 整数句柄快速路径：解析 app_code / perm_key 为数字 ID，之后按 ID 检查
+    void ResolveHandles(google::protobuf::RpcController* cntl,
+                        const siqi::auth::ResolveHandlesRequest* request,
+                        siqi::auth::ResolveHandlesResponse* response,
+                        google::protobuf::Closure* done) override;
+
+    void CheckById(google::protobuf::RpcController* cntl,
+                   const siqi::auth::CheckByIdRequest* request,
+                   siqi::auth::CheckByIdResponse* response,
+                   google::protobuf::Closure* done) override;
+
+    void BatchCheckById(google::protobuf::RpcController* cntl,
+                        const siqi::auth::BatchCheckByIdRequest* request,
+                        siqi::auth::BatchCheckByIdResponse* response,
+                        google::protobuf::Closure* done) override;
     
     // 获取服务状态（可选）
     bool isReady() const;
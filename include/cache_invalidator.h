@@ -0,0 +1,114 @@
+#ifndef CACHE_INVALIDATOR_H
+#define CACHE_INVALIDATOR_H
+
+#include "auth.pb.h"
+#include "perm_cache.h"
+#include "app_catalog.h"
+#include "read_fence.h"
+#include "session_token.h"
+#include <brpc/channel.h>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+// 集群缓存失效
+// 管理操作只能直接清掉本进程的 LocalCache，多个 auth_server 副本部署时其他副本会在 cache_ttl 内返回旧权限。
+// CacheInvalidator 先同步失效本地缓存，再由后台线程把失效项攒批，通过 ClusterService.Invalidate 推送给每个对端：
+//  - 每个对端独立维护待发送集合（key/前缀/应用去重合并），一个对端故障不影响其他对端
+//  - 推送失败的批次并回待发送集合，按指数退避重试，直到成功
+//  - 积压超过 max_pending 时合并为一次 clear_all，内存有界且不会漏掉失效
+// 同时实现 ClusterService，接收其他副本推送的失效并只作用于本地（不再转发）。
+// 推送请求用集群共享密钥做 HMAC 签名并携带发送时间，接收方拒绝未签名、签名错误或过期的请求，
+// 因此 ClusterService 与 AuthService 同端口开放时外部也无法伪造失效来冲刷缓存。
+class CacheInvalidator : public siqi::auth::ClusterService {
+public:
+    struct Options {
+        std::vector<std::string> peers;   // 其他副本地址 host:port，为空时只失效本地
+        std::string self;                 // 本实例地址，写入 origin；peers 中与之相同的项会被跳过
+        size_t max_batch = 1000;          // 单次推送最多携带的失效项数
+        int flush_interval_ms = 20;       // 攒批等待时间
+        int rpc_timeout_ms = 500;
+        int retry_backoff_ms = 200;       // 首次重试间隔，连续失败时翻倍，最长 10 秒
+        size_t max_pending = 100000;      // 单个对端积压上限，超过后改为 clear_all
+        std::string key;                  // 集群共享的 HMAC 密钥：推送时签名，接收时校验；为空时拒绝所有推送
+        int max_clock_skew_ms = 60000;    // 接收时允许的发送时间偏差
+    };
+
+    // catalog 为空时不处理应用目录；read_fence 非空时每次失效同时登记到栅栏，
+    // 之后一段时间内这些用户的缓存回填改读主库（读己之写）
+    CacheInvalidator(std::shared_ptr<PermCache> cache,
+                     std::shared_ptr<AppCatalog> catalog,
+                     const Options& options,
+                     std::shared_ptr<ReadFence> read_fence = nullptr);
+    ~CacheInvalidator();
+
+    CacheInvalidator(const CacheInvalidator&) = delete;
+    CacheInvalidator& operator=(const CacheInvalidator&) = delete;
+
+    // 停止后台线程，退出前尽力把积压的失效推送一次
+    void Stop();
+
+    // 失效本地缓存并广播给其他副本
+    void InvalidateKey(const std::string& key);
+    void InvalidateKeys(const std::vector<std::string>& keys);
+    void InvalidatePrefix(const std::string& prefix);
+    // 应用被修改或删除：移除应用目录条目并失效该应用下的全部权限缓存
+    void InvalidateApp(const std::string& app_code);
+
+    // 所有对端积压的失效项总数
+    size_t PendingSize() const;
+
+    // ClusterService：应用其他副本推送的失效
+    void Invalidate(google::protobuf::RpcController* cntl,
+                    const siqi::auth::InvalidateRequest* request,
+                    siqi::auth::InvalidateResponse* response,
+                    google::protobuf::Closure* done) override;
+
+private:
+    struct Pending {
+        std::unordered_set<std::string> keys;
+        std::unordered_set<std::string> prefixes;
+        std::unordered_set<std::string> apps;
+        bool clear_all = false;
+
+        size_t Size() const { return keys.size() + prefixes.size() + apps.size(); }
+        bool Empty() const { return !clear_all && Size() == 0; }
+    };
+
+    struct Peer {
+        std::string addr;
+        std::unique_ptr<brpc::Channel> channel;
+        Pending pending;
+        int failures = 0;
+        std::chrono::steady_clock::time_point next_attempt;
+    };
+
+    void Apply(const Pending& batch);
+    void Broadcast(const Pending& batch);
+    void Merge(Pending& into, const Pending& from) const;
+    // 从对端待发送集合中取出至多 max_batch 项，填入 request
+    void Take(Pending& pending, siqi::auth::InvalidateRequest& request, Pending& taken) const;
+    // 推送一轮，force 为 true 时忽略退避时间
+    void SendRound(bool force);
+    void Loop();
+
+    std::shared_ptr<PermCache> cache_;
+    std::shared_ptr<AppCatalog> catalog_;
+    std::shared_ptr<ReadFence> read_fence_;
+    Options options_;
+    std::unique_ptr<SessionTokenSigner> signer_;
+
+    std::vector<Peer> peers_;
+    uint64_t seq_ = 0;
+    mutable std::mutex mutex_;
+    std::condition_variable cond_;
+    bool stopped_ = false;
+    std::thread worker_;
+};
+
+#endif // CACHE_INVALIDATOR_H
@@ -0,0 +1,126 @@
+#ifndef CHANGE_FEED_H
+#define CHANGE_FEED_H
+
+#include "permission_store.h"
+#include "auth.pb.h"
+#include <brpc/controller.h>
+#include <brpc/stream.h>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 权限变更推送 (AuthService.Watch)
+// 存储层的写接口在数据修改的同一事务内把变更事件追加到 sys_change_log，seq 由数据库自增分配，所有副本共享同一序列。
+// 每个 auth_server 的后台线程按 poll_interval_ms 从主库增量拉取，放入内存环 (ring_capacity)，
+// 再通过 bRPC Stream 推送给订阅者：
+//  - 订阅者带上次收到的 head_seq 重连即可续传：断点仍在内存环中直接回放，更早的从变更日志回放
+//  - 断点早于已清理的日志或落后超过 max_replay 条时，推送一条 SNAPSHOT，订阅方丢弃本地状态重新开始
+//  - 流写满（订阅者消费太慢）时不在内存中为其堆积，下一轮再从环/日志按断点补发
+//  - seq 出现空洞（并发事务尚未提交）时最多等待 gap_timeout_ms，保证按 seq 顺序推送且不漏事件
+class ChangeFeed : public brpc::StreamInputHandler {
+public:
+    struct Options {
+        bool enabled = true;
+        size_t ring_capacity = 100000;     // 内存中保留的最近事件数
+        int poll_interval_ms = 100;        // 拉取变更日志的间隔
+        size_t fetch_batch = 1000;         // 单次拉取的最大行数
+        int gap_timeout_ms = 2000;         // seq 空洞的最长等待时间（回滚的事务会留下永久空洞）
+        size_t max_replay = 100000;        // 内存环之外最多从变更日志回放的事件数，超过则发送 SNAPSHOT
+        size_t max_events_per_write = 500; // 单条流消息携带的最大事件数
+        size_t stream_buf_size = 2 * 1024 * 1024;
+        int heartbeat_interval_ms = 5000;  // 无事件时的心跳间隔
+        size_t max_watchers = 10000;
+        int retention_hours = 72;          // 变更日志保留时长，<= 0 表示不清理
+    };
+
+    ChangeFeed(PermissionStore* dao, const Options& options);
+    ~ChangeFeed();
+
+    ChangeFeed(const ChangeFeed&) = delete;
+    ChangeFeed& operator=(const ChangeFeed&) = delete;
+
+    // 关闭所有订阅流并停止后台线程
+    void Stop();
+
+    // 在 Watch RPC 中调用：接受客户端创建的流并登记订阅
+    // 失败时返回 false 并填充 error；成功时 head_seq 为当前最新序号
+    bool Subscribe(brpc::Controller* cntl,
+                   const std::string& app_code,
+                   uint64_t from_seq,
+                   uint64_t* head_seq,
+                   std::string* error);
+
+    uint64_t HeadSeq() const;
+    size_t WatcherCount() const;
+
+    // brpc::StreamInputHandler：订阅方不会发送消息，只关心流关闭
+    int on_received_messages(brpc::StreamId id, butil::IOBuf* const messages[], size_t size) override;
+    void on_idle_timeout(brpc::StreamId id) override;
+    void on_closed(brpc::StreamId id) override;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Watcher {
+        std::string app_code;
+        uint64_t sent_seq = 0;        // 已推送（或确认无需推送）到的位置
+        bool need_snapshot = false;
+        Clock::time_point last_write;
+    };
+
+    // 落后于内存环、需要从变更日志回放的订阅者
+    struct ReplayTask {
+        brpc::StreamId stream;
+        std::string app_code;
+        uint64_t sent_seq;
+    };
+
+    void Loop();
+    bool Init();
+    // 增量拉取新事件放入内存环
+    void Poll();
+    // 向各订阅者推送
+    void Dispatch();
+    void Replay(const std::vector<ReplayTask>& tasks);
+    void Purge();
+
+    static bool Matches(const std::string& app_code, const PermissionStore::ChangeEvent& ev) {
+        return app_code.empty() || app_code == ev.app_code;
+    }
+    static void ToProto(const PermissionStore::ChangeEvent& ev, siqi::auth::ChangeEvent* out);
+    static siqi::auth::WatchEvents SnapshotMessage(const std::string& app_code, uint64_t seq);
+    // 返回 0 成功，EAGAIN 表示流缓冲已满，其他值表示流已不可用
+    static int Write(brpc::StreamId stream, const siqi::auth::WatchEvents& msg);
+
+    PermissionStore* dao_;
+    Options options_;
+
+    mutable std::mutex mutex_;
+    bool initialized_ = false;
+    std::deque<PermissionStore::ChangeEvent> ring_;  // seq 升序
+    uint64_t floor_ = 0;  // seq > floor_ 的已接收事件都在 ring_ 中
+    uint64_t head_ = 0;   // 已接收的最新序号
+    std::map<brpc::StreamId, Watcher> watchers_;
+
+    // on_closed 在 bRPC 线程中回调，只记录下来由后台线程统一移除，避免与推送互相等待
+    std::mutex closed_mutex_;
+    std::vector<brpc::StreamId> closed_;
+
+    // seq 空洞：在 gap_head_ 之后出现空洞的起始时间（仅后台线程访问）
+    uint64_t gap_head_ = 0;
+    Clock::time_point gap_since_;
+    bool fetch_failed_ = false;
+    Clock::time_point last_purge_;
+
+    std::mutex loop_mutex_;
+    std::condition_variable loop_cond_;
+    bool stopped_ = false;
+    std::thread worker_;
+};
+
+#endif // CHANGE_FEED_H
@@ -0,0 +1,100 @@
+#ifndef DAO_STATS_H
+#define DAO_STATS_H
+
+#include <bvar/bvar.h>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+// 数据访问层按语句名统计的执行指标，进程内所有 PermissionDAO 实例共用一份
+// 每条语句导出以下 bvar（<name> 为稳定的语句名，例如 get_user_permissions）：
+//   dao_<name>_latency / _latency_99 / _max_latency / _qps / _count   执行延迟（含 prepare）
+//   dao_<name>_acquire_latency ...     执行前等待连接池的耗时（只记在取得连接后的第一条语句上）
+//   dao_<name>_rows                    返回或影响的总行数
+//   dao_<name>_errors                  执行失败次数
+// 超过慢查询阈值的语句连同绑定参数写入日志，最近若干条与汇总表一起在 /dao_stats 页面展示 (DaoStatsServiceImpl)
+class DaoStats {
+public:
+    struct Statement {
+        explicit Statement(const std::string& name);
+
+        const std::string name;
+        bvar::LatencyRecorder latency;
+        bvar::LatencyRecorder acquire;
+        bvar::Adder<int64_t> rows;
+        bvar::Adder<int64_t> errors;
+    };
+
+    struct SlowQuery {
+        int64_t time_us = 0;     // 结束时间 (gettimeofday)
+        std::string name;
+        int64_t latency_us = 0;
+        int64_t rows = 0;        // -1 表示执行失败
+        std::string sql;
+        std::string params;
+    };
+
+    static DaoStats& Global();
+
+    DaoStats(const DaoStats&) = delete;
+    DaoStats& operator=(const DaoStats&) = delete;
+
+    // 取语句的统计项，首次使用时创建并导出；返回的指针在进程内一直有效
+    // 需要加锁查表，执行路径上用 DAO_STATEMENT 按调用点缓存
+    Statement* Get(const std::string& name);
+
+    // 慢查询阈值，<= 0 关闭慢查询日志
+    void SetSlowQueryThresholdUs(int64_t threshold_us) { slow_threshold_us_ = threshold_us; }
+    int64_t slow_query_threshold_us() const { return slow_threshold_us_; }
+
+    // 一次执行结束：rows < 0 表示失败。只更新 bvar，不加锁
+    void Record(Statement* stmt, int64_t latency_us, int64_t rows) {
+        stmt->latency << latency_us;
+        if (rows < 0) {
+            stmt->errors << 1;
+        } else {
+            stmt->rows << rows;
+        }
+    }
+    // 是否达到慢查询阈值；调用方只在返回 true 时才格式化参数并调用 RecordSlow
+    bool IsSlow(int64_t latency_us) const {
+        int64_t threshold_us = slow_threshold_us_.load(std::memory_order_relaxed);
+        return threshold_us > 0 && latency_us >= threshold_us;
+    }
+    // 记录一条慢查询：写日志并保留在最近慢查询列表中
+    void RecordSlow(Statement* stmt, int64_t latency_us, int64_t rows,
+                    const std::string& sql, const std::string& params);
+    // 从连接池取连接的等待时间；stmt 为空时只计入全局的 dao_pool_acquire
+    void RecordAcquire(Statement* stmt, int64_t wait_us);
+    void RecordAcquireFailure() { acquire_failures_ << 1; }
+
+    // 汇总表（按最近占用数据库时间倒序）与最近的慢查询，纯文本
+    void Describe(std::ostream& os);
+
+private:
+    DaoStats();
+
+    std::mutex mutex_;
+    std::unordered_map<std::string, std::unique_ptr<Statement>> statements_;
+    std::deque<SlowQuery> slow_queries_;  // 最近的慢查询，受 mutex_ 保护
+
+    std::atomic<int64_t> slow_threshold_us_{0};
+    bvar::LatencyRecorder pool_acquire_;
+    bvar::Adder<int64_t> acquire_failures_;
+    bvar::Adder<int64_t> slow_count_;
+};
+
+// 按调用点缓存语句的统计项：每处展开都是一个独立的 lambda，其函数内静态变量只在首次执行时查表，
+// 之后的执行不再加锁、也不构造语句名字符串。name 必须是字符串字面量
+#define DAO_STATEMENT(name) \
+    ([]() -> DaoStats::Statement* { \
+        static DaoStats::Statement* const dao_statement = DaoStats::Global().Get(name); \
+        return dao_statement; \
+    }())
+
+#endif // DAO_STATS_H
@@ -0,0 +1,16 @@
+#ifndef DAO_STATS_SERVICE_H
+#define DAO_STATS_SERVICE_H
+
+#include "auth.pb.h"
+
+// /dao_stats 页面：以纯文本输出 DaoStats::Describe（按最近占用数据库时间排序的语句汇总 + 最近的慢查询）
+// 注册时需要映射 URL，例如 server.AddService(&svc, brpc::SERVER_DOESNT_OWN_SERVICE, "/dao_stats => default_method")
+class DaoStatsServiceImpl : public siqi::auth::DaoStatsService {
+public:
+    void default_method(google::protobuf::RpcController* cntl,
+                        const siqi::auth::DaoStatsRequest* request,
+                        siqi::auth::DaoStatsResponse* response,
+                        google::protobuf::Closure* done) override;
+};
+
+#endif // DAO_STATS_SERVICE_H
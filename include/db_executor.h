@@ -0,0 +1,90 @@
+#ifndef DB_EXECUTOR_H
+#define DB_EXECUTOR_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// 专门执行阻塞型数据库操作的固定大小线程池
+// MySQL Connector 是同步阻塞的，若直接在 bRPC worker 中查库，worker 会被数据库延迟占住。
+// 把缓存未命中等需要访问数据库的请求投递到这里，worker 可以立即返回去处理其他请求，
+// 由线程池在查询结束后调用 done->Run() 完成 RPC。
+class DBExecutor {
+public:
+    // num_threads: 工作线程数，一般与 DAO 连接池上限相当即可
+    // max_queue_size: 等待队列上限，超过后 Submit 返回 false（背压）
+    DBExecutor(size_t num_threads, size_t max_queue_size)
+        : max_queue_size_(max_queue_size) {
+        for (size_t i = 0; i < num_threads; ++i) {
+            workers_.emplace_back(&DBExecutor::WorkerLoop, this);
+        }
+    }
+
+    ~DBExecutor() {
+        Stop();
+    }
+
+    DBExecutor(const DBExecutor&) = delete;
+    DBExecutor& operator=(const DBExecutor&) = delete;
+
+    // 投递任务。队列已满或执行器已停止时返回 false，由调用方决定如何降级
+    bool Submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (stopped_ || tasks_.size() >= max_queue_size_) {
+                return false;
+            }
+            tasks_.push_back(std::move(task));
+        }
+        cond_.notify_one();
+        return true;
+    }
+
+    // 停止接收新任务，已入队的任务会全部执行完后线程才退出
+    void Stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (stopped_) return;
+            stopped_ = true;
+        }
+        cond_.notify_all();
+        for (auto& t : workers_) {
+            if (t.joinable()) t.join();
+        }
+    }
+
+    // 当前排队中的任务数
+    size_t QueueSize() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return tasks_.size();
+    }
+
+private:
+    void WorkerLoop() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cond_.wait(lock, [this] { return stopped_ || !tasks_.empty(); });
+                if (tasks_.empty()) {
+                    return; // stopped_ 且队列已清空
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> tasks_;
+    mutable std::mutex mutex_;
+    std::condition_variable cond_;
+    size_t max_queue_size_;
+    bool stopped_ = false;
+};
+
+#endif // DB_EXECUTOR_H
@@ -0,0 +1,215 @@
+#ifndef HANDLE_CATALOG_H
+#define HANDLE_CATALOG_H
+
+#include "permission_store.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// 整数句柄目录 (ResolveHandles / CheckById / BatchCheckById)
+// 每次加载按 (app_id, perm_id) 升序给应用与权限分配从 1 开始的稠密句柄：应用句柄是应用在全部应用中的序号，
+// 权限句柄是权限在所属应用内的序号，同时就是用户权限位图中的位（句柄 - 1），CheckById 命中缓存时只做数组下标与位运算，
+// 内存只与应用 / 权限的数量有关，与主键取值无关。
+// 每个应用有独立的 version（该应用全部 (app_id, app_code, perm_id, perm_key) 的 64 位 FNV-1a 摘要）：
+// 各副本从同一主库加载得到相同的句柄与版本，客户端可以在副本之间切换；应用的权限增删或句柄变化只改变该应用的版本，
+// 持有旧句柄的请求被拒绝 (ESTALE) 而不是误判，其他应用的客户端不受影响。
+class HandleCatalog {
+public:
+    struct App {
+        int64_t id = 0;                                         // sys_apps.id
+        std::string app_code;
+        std::unordered_map<std::string, uint32_t> perm_handles; // perm_key -> 权限句柄 (1..perm_count)
+        size_t perm_count = 0;                                  // 位图长度（位）
+        uint64_t version = 0;                                   // 非 0
+    };
+
+    // 加载后不再修改，读者持有 shared_ptr 即可无锁访问
+    struct Snapshot {
+        bool loaded = false;
+        std::unordered_map<std::string, uint32_t> app_handles;  // app_code -> 应用句柄 (1..apps.size())
+        std::vector<App> apps;                                  // 下标为应用句柄 - 1
+
+        const App* FindApp(uint64_t handle) const {
+            if (handle == 0 || handle > apps.size()) {
+                return nullptr;
+            }
+            return &apps[handle - 1];
+        }
+
+        const App* FindApp(const std::string& app_code) const {
+            auto it = app_handles.find(app_code);
+            return it == app_handles.end() ? nullptr : &apps[it->second - 1];
+        }
+    };
+
+    // 权限句柄转为位图中的位，不属于该应用时返回 false
+    static bool PermBit(const App& app, uint64_t perm_handle, uint32_t& bit) {
+        if (perm_handle == 0 || perm_handle > app.perm_count) {
+            return false;
+        }
+        bit = static_cast<uint32_t>(perm_handle - 1);
+        return true;
+    }
+
+    HandleCatalog() : snapshot_(std::make_shared<Snapshot>()) {}
+    ~HandleCatalog() { StopRefresh(); }
+
+    HandleCatalog(const HandleCatalog&) = delete;
+    HandleCatalog& operator=(const HandleCatalog&) = delete;
+
+    // 启动后台刷新线程（重复调用无效）：每隔 interval 重新加载，RequestReload 可提前唤醒，
+    // 两次加载之间至少间隔 min_gap。查库只发生在该线程里，不占用 bRPC worker。store 必须比本对象活得久
+    void StartRefresh(PermissionStore* store, std::chrono::milliseconds interval, std::chrono::milliseconds min_gap) {
+        std::lock_guard<std::mutex> lock(refresh_mutex_);
+        if (refresher_.joinable() || refresh_stopped_) {
+            return;
+        }
+        refresher_ = std::thread(&HandleCatalog::RefreshLoop, this, store, interval, min_gap);
+    }
+
+    // 请求后台线程尽快重新加载（客户端版本不一致、目录尚未加载等），不等待结果
+    void RequestReload() {
+        {
+            std::lock_guard<std::mutex> lock(refresh_mutex_);
+            reload_requested_ = true;
+        }
+        refresh_cond_.notify_one();
+    }
+
+    void StopRefresh() {
+        {
+            std::lock_guard<std::mutex> lock(refresh_mutex_);
+            refresh_stopped_ = true;
+        }
+        refresh_cond_.notify_one();
+        if (refresher_.joinable()) {
+            refresher_.join();
+        }
+    }
+
+    std::shared_ptr<const Snapshot> Get() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return snapshot_;
+    }
+
+    // 距上次加载超过 min_interval 时从数据库重新加载；并发调用时只有一个线程查库，
+    // 其余直接返回，wait 为 true 时则等正在进行的加载结束（之后通常已在 min_interval 内，不再重复查库）
+    // 返回是否执行了加载且成功
+    bool MaybeReload(PermissionStore& dao, std::chrono::milliseconds min_interval, bool wait = false) {
+        std::unique_lock<std::mutex> reload_lock(reload_mutex_, std::defer_lock);
+        if (wait) {
+            reload_lock.lock();
+        } else if (!reload_lock.try_lock()) {
+            return false;
+        }
+        auto now = std::chrono::steady_clock::now();
+        if (loaded_ && now - loaded_at_ < min_interval) {
+            return false;
+        }
+        loaded_at_ = now;
+        loaded_ = true;
+
+        std::vector<PermissionStore::PermHandle> rows;
+        if (!dao.loadPermissionHandles(rows)) {
+            return false;
+        }
+        std::shared_ptr<Snapshot> snapshot = Build(rows);
+        if (!snapshot) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        snapshot_ = snapshot;
+        return true;
+    }
+
+    // 位图辅助
+    static bool TestBit(const std::vector<uint64_t>& bits, uint32_t bit) {
+        size_t word = bit / 64;
+        return word < bits.size() && (bits[word] >> (bit % 64)) & 1;
+    }
+
+    static void SetBit(std::vector<uint64_t>& bits, uint32_t bit) {
+        bits[bit / 64] |= uint64_t(1) << (bit % 64);
+    }
+
+private:
+    void RefreshLoop(PermissionStore* store, std::chrono::milliseconds interval, std::chrono::milliseconds min_gap) {
+        std::unique_lock<std::mutex> lock(refresh_mutex_);
+        while (!refresh_stopped_) {
+            reload_requested_ = false;
+            lock.unlock();
+            MaybeReload(*store, min_gap);
+            lock.lock();
+            // 先无条件等满 min_gap，期间的重新加载请求合并到下一次
+            refresh_cond_.wait_for(lock, min_gap, [this] { return refresh_stopped_; });
+            refresh_cond_.wait_for(lock, std::max(interval - min_gap, std::chrono::milliseconds(0)),
+                                   [this] { return refresh_stopped_ || reload_requested_; });
+        }
+    }
+
+    static void Mix(uint64_t& h, const void* data, size_t len) {
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < len; ++i) {
+            h ^= p[i];
+            h *= 1099511628211ULL;
+        }
+    }
+
+    // rows 需按 (app_id, perm_id) 升序，句柄与摘要才与加载顺序无关
+    static std::shared_ptr<Snapshot> Build(const std::vector<PermissionStore::PermHandle>& rows) {
+        std::shared_ptr<Snapshot> snapshot = std::make_shared<Snapshot>();
+        snapshot->loaded = true;
+        uint64_t h = 0;
+        for (const auto& row : rows) {
+            if (snapshot->apps.empty() || snapshot->apps.back().id != row.app_id) {
+                if (!snapshot->apps.empty()) {
+                    snapshot->apps.back().version = h == 0 ? 1 : h;
+                }
+                snapshot->apps.emplace_back();
+                App& app = snapshot->apps.back();
+                app.id = row.app_id;
+                app.app_code = row.app_code;
+                snapshot->app_handles[row.app_code] = static_cast<uint32_t>(snapshot->apps.size());
+                h = 14695981039346656037ULL;
+                // 句柄随应用序号变化：序号也计入摘要，前面的应用被删除后旧句柄一定失效
+                const uint64_t handle = snapshot->apps.size();
+                Mix(h, &handle, sizeof(handle));
+                Mix(h, &row.app_id, sizeof(row.app_id));
+                Mix(h, row.app_code.data(), row.app_code.size() + 1);
+            }
+            if (row.perm_id <= 0) {
+                continue;
+            }
+            App& app = snapshot->apps.back();
+            Mix(h, &row.perm_id, sizeof(row.perm_id));
+            Mix(h, row.perm_key.data(), row.perm_key.size() + 1);
+            app.perm_handles[row.perm_key] = static_cast<uint32_t>(++app.perm_count);
+        }
+        if (!snapshot->apps.empty()) {
+            snapshot->apps.back().version = h == 0 ? 1 : h;
+        }
+        return snapshot;
+    }
+
+    mutable std::mutex mutex_;
+    std::shared_ptr<const Snapshot> snapshot_;
+
+    std::mutex reload_mutex_;
+    std::chrono::steady_clock::time_point loaded_at_;
+    bool loaded_ = false;
+
+    std::mutex refresh_mutex_;
+    std::condition_variable refresh_cond_;
+    bool refresh_stopped_ = false;
+    bool reload_requested_ = false;
+    std::thread refresher_;
+};
+
+#endif // HANDLE_CATALOG_H
@@ -5,6 +5,7 @@
 #include <mutex>
 #include <chrono>
 #include <string>
+#include <vector>
 
 // 一个简单的线程安全 TTL 缓存
 // T 是存储的值类型
@@ -38,12 +39,38 @@ public:
         return true;
     }
 
+    // 在锁内访问缓存值而不拷贝，适合值较大、只需读取其中一部分的场景
+    // fn 接收 T&，可以原地补充派生数据；fn 中不要再访问本缓存，也不要保留引用
+    template <typename Fn>
+    bool Visit(const std::string& key, Fn&& fn) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = cache_.find(key);
+        if (it == cache_.end()) {
+            return false;
+        }
+        if (std::chrono::steady_clock::now() > it->second.expire_at) {
+            cache_.erase(it);
+            return false;
+        }
+        fn(it->second.value);
+        return true;
+    }
+
     // 移除单个 Key
     void Invalidate(const std::string& key) {
         std::lock_guard<std::mutex> lock(mutex_);
         cache_.erase(key);
     }
 
+    // 批量移除多个 Key，只加一次锁
+    // 适用于批量授权等一次性影响大量用户的管理操作
+    void InvalidateKeys(const std::vector<std::string>& keys) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& key : keys) {
+            cache_.erase(key);
+        }
+    }
+
     // 移除匹配前缀的 Key (需要遍历，O(N)复杂度)
     // 适用于管理操作，例如：清除某个 App 下的所有用户缓存
     void InvalidatePrefix(const std::string& prefix) {
@@ -57,6 +84,24 @@ public:
         }
     }
     
+    // 当前条目数（含尚未被访问清理的过期条目）
+    size_t Size() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return cache_.size();
+    }
+
+    // 在锁内访问至多 max_entries 个条目（顺序不定，含过期条目），返回条目总数
+    // 用于按样本估算内存占用等监控统计，样本越大持锁越久
+    template <typename Fn>
+    size_t Sample(size_t max_entries, Fn&& fn) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t visited = 0;
+        for (auto it = cache_.begin(); it != cache_.end() && visited < max_entries; ++it, ++visited) {
+            fn(it->first, it->second.value);
+        }
+        return cache_.size();
+    }
+
     // 移除所有 Key (清空)
     void Clear() {
          std::lock_guard<std::mutex> lock(mutex_);
@@ -0,0 +1,312 @@
+#ifndef MEMORY_PERMISSION_STORE_H
+#define MEMORY_PERMISSION_STORE_H
+
+#include "permission_store.h"
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+// 进程内的 PermissionStore 实现，不依赖 MySQL。
+// 数据从 scripts/init.sql 形式的脚本加载（只执行其中的 INSERT 与 SET @var，建表等语句忽略），
+// 语义与 PermissionDAO 保持一致（包括不做级联删除），用于：
+//  - 不依赖数据库地基准测试 AuthServiceImpl / AdminServiceImpl，只看服务自身的 CPU 开销；
+//  - 通过注入延迟与限制"连接数"，稳定复现慢库、连接池耗尽等场景。
+class MemoryPermissionStore : public PermissionStore {
+public:
+    struct Options {
+        int read_latency_us = 0;        // 每次读操作注入的延迟（模拟网络往返 + 查询耗时）
+        int write_latency_us = 0;       // 每次写操作注入的延迟
+        int latency_jitter_us = 0;      // 在基础延迟上叠加 [0, jitter) 的均匀随机延迟
+        int max_connections = 0;        // 模拟连接池上限（注入的延迟期间占用一个连接），<= 0 不限
+        int connection_wait_ms = 1000;  // 连接耗尽时的等待时间，超时后操作失败（与 PermissionDAO 一致）
+    };
+
+    explicit MemoryPermissionStore(const Options& options);
+
+    // 执行 SQL 脚本中的 INSERT [IGNORE] INTO ... VALUES 与 SET @var = (SELECT id ...)，可多次调用追加数据
+    // 失败时返回 false，错误信息见 getLastError()，已执行的语句不回滚
+    bool LoadSqlFile(const std::string& path);
+    bool LoadSql(const std::string& sql);
+
+    bool checkPermission(const std::string& app_code,
+                         const std::string& user_id,
+                         const std::string& perm_key,
+                         const std::string& resource_id = "") override;
+
+    std::vector<bool> batchCheckPermissions(
+        const std::string& app_code,
+        const std::vector<std::tuple<std::string, std::string>>& requests) override;
+
+    std::vector<std::pair<std::string, std::string>>
+    getUserPermissions(const std::string& app_code,
+                       const std::string& user_id) override;
+
+    std::vector<std::string> getUserRoles(const std::string& app_code,
+                                          const std::string& user_id) override;
+
+    bool createApp(const std::string& app_name,
+                   const std::string& app_code,
+                   const std::string& description,
+                   std::string& out_app_secret) override;
+
+    bool updateApp(const std::string& app_code,
+                   const std::string* app_name,
+                   const std::string* description,
+                   const int32_t* status) override;
+
+    bool deleteApp(const std::string& app_code) override;
+
+    bool getApp(const std::string& app_code, AppInfo& out_app) override;
+
+    std::vector<AppInfo> listApps(int32_t page, int32_t page_size,
+                                  const std::string* app_name,
+                                  const int32_t* status,
+                                  int64_t& out_total) override;
+
+    bool createRole(const std::string& app_code,
+                    const std::string& role_name,
+                    const std::string& role_key,
+                    const std::string& description,
+                    bool is_default = false) override;
+
+    bool createPermission(const std::string& app_code,
+                          const std::string& perm_name,
+                          const std::string& perm_key,
+                          const std::string& description) override;
+
+    bool updateRole(const std::string& app_code,
+                    const std::string& role_key,
+                    const std::string* role_name,
+                    const std::string* description,
+                    const bool* is_default) override;
+
+    bool updatePermission(const std::string& app_code,
+                          const std::string& perm_key,
+                          const std::string* perm_name,
+                          const std::string* description) override;
+
+    bool deleteRole(const std::string& app_code, const std::string& role_key) override;
+    bool deletePermission(const std::string& app_code, const std::string& perm_key) override;
+
+    std::vector<RoleInfo> listRoles(const std::string& app_code) override;
+    std::vector<PermInfo> listPermissions(const std::string& app_code) override;
+
+    bool assignRoleToUser(const std::string& app_code,
+                          const std::string& user_id,
+                          const std::string& role_key) override;
+
+    bool removeRoleFromUser(const std::string& app_code,
+                            const std::string& user_id,
+                            const std::string& role_key) override;
+
+    int64_t batchAssignRoles(const std::string& app_code,
+                             const std::vector<std::string>& user_ids,
+                             const std::vector<std::string>& role_keys) override;
+
+    int64_t batchRemoveRoles(const std::string& app_code,
+                             const std::vector<std::string>& user_ids,
+                             const std::vector<std::string>& role_keys) override;
+
+    bool addPermissionToRole(const std::string& app_code,
+                             const std::string& role_key,
+                             const std::string& perm_key) override;
+
+    bool removePermissionFromRole(const std::string& app_code,
+                                  const std::string& role_key,
+                                  const std::string& perm_key) override;
+
+    std::vector<std::string> getRolePermissions(const std::string& app_code,
+                                                const std::string& role_key) override;
+
+    std::vector<std::string> getRolesWithPermission(const std::string& app_code,
+                                                    const std::string& perm_key) override;
+
+    bool appExists(const std::string& app_code) override;
+    bool permissionExists(const std::string& app_code, const std::string& perm_key) override;
+
+    // kEstimate 与 kExact 相同，都返回精确值
+    std::vector<UserInfo> getRoleUsers(const std::string& app_code,
+                                       const std::string& role_key,
+                                       int32_t page, int32_t page_size,
+                                       int64_t& out_total,
+                                       const PageCursor* after = nullptr,
+                                       TotalMode total_mode = TotalMode::kExact,
+                                       PageCursor* out_next = nullptr) override;
+
+    std::vector<UserRoleData> listUserRoles(const std::string& app_code,
+                                            int32_t page, int32_t page_size,
+                                            const std::string* user_id,
+                                            int64_t& out_total,
+                                            const PageCursor* after = nullptr,
+                                            TotalMode total_mode = TotalMode::kExact,
+                                            PageCursor* out_next = nullptr) override;
+
+    bool createAuditLog(int64_t operator_id,
+                        const std::string& operator_name,
+                        const std::string& app_code,
+                        const std::string& action,
+                        const std::string& target_type,
+                        const std::string& target_id,
+                        const std::string& target_name = "",
+                        const std::string& object_type = "",
+                        const std::string& object_id = "",
+                        const std::string& object_name = "") override;
+
+    bool createAuditLogs(const std::vector<AuditLogInfo>& logs) override;
+
+    std::vector<AuditLogInfo> listAuditLogs(int32_t page, int32_t page_size,
+                                            const std::string* app_code,
+                                            const std::string* action,
+                                            const std::string* operator_id,
+                                            const std::string* target_id,
+                                            const int64_t* start_time,
+                                            const int64_t* end_time,
+                                            int64_t& out_total,
+                                            const PageCursor* after = nullptr,
+                                            TotalMode total_mode = TotalMode::kExact,
+                                            PageCursor* out_next = nullptr) override;
+
+    // 审计日志不分区：listAuditPartitions 返回空，AuditArchive 会跳过分区维护；其余分区操作返回失败
+    std::vector<AuditPartition> listAuditPartitions() override;
+    bool addAuditPartitions(const std::vector<AuditPartition>& parts) override;
+    bool exportAuditPartition(const std::string& partition,
+                              const std::function<bool(const AuditLogInfo&)>& fn,
+                              int64_t& out_rows) override;
+    bool dropAuditPartition(const std::string& partition) override;
+
+    bool fetchChangeEvents(int64_t after_seq, size_t limit, std::vector<ChangeEvent>& out) override;
+    bool getChangeSeqRange(int64_t& min_seq, int64_t& max_seq) override;
+    int64_t purgeChangeEvents(int retention_hours, size_t limit) override;
+
+    bool loadPermissionHandles(std::vector<PermHandle>& out) override;
+
+    ConsoleUser getConsoleUser(const std::string& username) override;
+
+    bool isConnected() const override;
+    std::string getLastError() const override;
+
+private:
+    // 与 init.sql 中的表一一对应
+    struct AppRow {
+        int64_t id = 0;
+        std::string app_name;
+        std::string app_code;
+        std::string app_secret;
+        std::string description;
+        int32_t status = 1;
+        std::string created_at;
+        std::string updated_at;
+    };
+    struct RoleRow {
+        int64_t id = 0;
+        int64_t app_id = 0;
+        std::string role_name;
+        std::string role_key;
+        std::string description;
+        bool is_default = false;
+    };
+    struct PermRow {
+        int64_t id = 0;
+        int64_t app_id = 0;
+        std::string perm_name;
+        std::string perm_key;
+        std::string description;
+    };
+    struct UserRoleRow {
+        int64_t id = 0;
+        int64_t app_id = 0;
+        std::string user_id;
+        int64_t role_id = 0;
+        std::string created_at;
+    };
+
+    // 读写路由与 PermissionDAO 相同的含义，这里只决定注入哪种延迟
+    enum class Access { kWrite, kRead };
+
+    // 模拟一次连接借用：按 max_connections 限流并注入延迟，作用域结束归还
+    class ConnectionGuard {
+    public:
+        ConnectionGuard(MemoryPermissionStore* store, Access access = Access::kWrite);
+        ~ConnectionGuard();
+        bool isValid() const { return acquired_; }
+    private:
+        MemoryPermissionStore* store_;
+        bool acquired_;
+    };
+
+    bool acquireConnection();
+    void releaseConnection();
+    void injectLatency(Access access);
+    void setError(const std::string& error);
+
+    // 以下 *Locked 函数要求调用方已持有 mutex_（查询可为共享锁，写入需独占锁）
+    int64_t appIdLocked(const std::string& app_code, bool active_only) const;
+    const RoleRow* roleLocked(int64_t app_id, const std::string& role_key) const;
+    const PermRow* permLocked(int64_t app_id, const std::string& perm_key) const;
+    // 用户在应用下的授权，按 role_id 升序
+    std::vector<const UserRoleRow*> userRolesLocked(int64_t app_id, const std::string& user_id) const;
+    std::vector<const PermRow*> rolePermsLocked(int64_t role_id) const;
+
+    bool insertAppLocked(AppRow row, bool ignore_duplicate, std::string& error);
+    bool insertRoleLocked(RoleRow row, bool ignore_duplicate, std::string& error);
+    bool insertPermLocked(PermRow row, bool ignore_duplicate, std::string& error);
+    bool insertRolePermLocked(int64_t role_id, int64_t perm_id, bool ignore_duplicate, std::string& error);
+    // 返回是否插入了新行；已存在时 ignore_duplicate 为 false 则报错
+    bool insertUserRoleLocked(int64_t app_id, const std::string& user_id, int64_t role_id,
+                              const std::string& created_at, bool ignore_duplicate, bool& inserted,
+                              std::string& error);
+    void appendAuditLogLocked(AuditLogInfo log);
+    // 与数据修改在同一把独占锁内追加变更事件，等价于 MySQL 实现的同一事务
+    void appendChangeLocked(ChangeEvent ev);
+
+    // SQL 脚本的单条语句
+    bool executeStatementLocked(const std::string& stmt, std::map<std::string, std::string>& vars,
+                                std::string& error);
+    bool insertSeedRowLocked(const std::string& table, const std::map<std::string, std::string>& row,
+                             const std::set<std::string>& nulls, bool ignore_duplicate, std::string& error);
+    bool lookupIdLocked(const std::string& table, const std::map<std::string, std::string>& where,
+                        int64_t& out_id) const;
+
+    Options options_;
+
+    // 模拟连接池
+    std::mutex pool_mutex_;
+    std::condition_variable pool_cond_;
+    int connections_in_use_ = 0;
+
+    // 数据，读操作共享锁、写操作独占锁
+    mutable std::shared_timed_mutex mutex_;
+    std::map<int64_t, AppRow> apps_;                                  // 按 id 有序
+    std::unordered_map<std::string, int64_t> app_ids_;               // app_code -> id
+    std::map<int64_t, RoleRow> roles_;
+    std::map<std::pair<int64_t, std::string>, int64_t> role_ids_;    // (app_id, role_key) -> id
+    std::map<int64_t, PermRow> perms_;
+    std::map<std::pair<int64_t, std::string>, int64_t> perm_ids_;    // (app_id, perm_key) -> id
+    std::set<std::pair<int64_t, int64_t>> role_perms_;               // (role_id, perm_id)
+    std::set<std::pair<int64_t, int64_t>> perm_roles_;               // (perm_id, role_id)
+    std::map<int64_t, UserRoleRow> user_roles_;                       // 按 id 有序
+    // (app_id, user_id, role_id) -> id，兼作唯一键与按用户查询的索引 (idx_user_query)
+    std::map<std::tuple<int64_t, std::string, int64_t>, int64_t> user_role_index_;
+    std::map<int64_t, AuditLogInfo> audit_logs_;
+    std::deque<ChangeEvent> change_log_;                              // seq 升序
+    std::unordered_map<std::string, ConsoleUser> console_users_;
+
+    int64_t next_app_id_ = 1;
+    int64_t next_role_id_ = 1;
+    int64_t next_perm_id_ = 1;
+    int64_t next_user_role_id_ = 1;
+    int64_t next_audit_id_ = 1;
+    int64_t next_change_seq_ = 1;
+
+    std::string last_error_;
+    mutable std::mutex error_mutex_;
+};
+
+#endif // MEMORY_PERMISSION_STORE_H
@@ -0,0 +1,34 @@
+#ifndef PERM_CACHE_H
+#define PERM_CACHE_H
+
+#include "local_cache.h"
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// auth_server 按 "app_code:user_id" 缓存的用户权限
+// AdminServiceImpl / CacheInvalidator 对它做失效，两条鉴权路径共用同一份条目，失效一次即可同时生效
+struct CachedPerms {
+    std::unordered_set<std::string> keys;  // 权限 key，Check 使用
+    std::vector<uint64_t> bits;            // 按 HandleCatalog 稠密下标的位图，CheckById 使用（按需生成）
+    uint64_t bits_version = 0;             // 生成 bits 时该应用的目录版本，0 表示尚未生成
+};
+
+using PermCache = LocalCache<CachedPerms>;
+
+// 估算一个缓存条目占用的内存：键、值以及哈希表节点与桶的开销（按 libstdc++ 的布局近似），用于监控
+inline size_t ApproxEntryBytes(const std::string& key, const CachedPerms& perms) {
+    // 超过 SSO 容量 (15) 的字符串另有一块堆内存
+    auto heap = [](const std::string& s) { return s.capacity() > 15 ? s.capacity() + 1 : 0; };
+    size_t bytes = sizeof(void*) * 2 + sizeof(std::string) + heap(key) +
+                   sizeof(PermCache::Entry);                        // 缓存表节点 (next + hash) 与桶
+    bytes += perms.keys.bucket_count() * sizeof(void*);
+    for (const auto& k : perms.keys) {
+        bytes += sizeof(void*) * 2 + sizeof(std::string) + heap(k);  // 集合节点
+    }
+    bytes += perms.bits.capacity() * sizeof(uint64_t);
+    return bytes;
+}
+
+#endif // PERM_CACHE_H
@@ -6,10 +6,27 @@
 #include <mutex> //引入互斥锁，用于线程安全操作数据库连接池
 #include <queue>//引入队列，用于存储数据库连接
 #include <condition_variable>//引入条件变量，用于线程同步
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <functional>
 #include <mysql_driver.h>//引入MySQL驱动程序
 #include <mysql_connection.h>//引入MySQL连接库
+#include "app_catalog.h"
+#include "read_fence.h"
+#include "dao_stats.h"
+#include "permission_store.h"
+#include <butil/time.h>
+
+// PermissionStore 的 MySQL 实现
+class PermissionDAO : public PermissionStore {
+public:
+    // 数据库节点地址（用于配置只读从库）
+    struct Endpoint {
+        std::string host;
+        int port;
+    };
 
-class PermissionDAO {
 private:
     struct DBConfig {
         std::string host;
@@ -19,170 +36,221 @@ private:
         std::string database;
     } config_;
 
-    std::queue<sql::Connection*> connection_pool_;//连接池队列，用于存储可用的数据库连接
-    std::mutex pool_mutex_;//保护连接池的互斥锁，防止多个线程同时操作连接池
-    std::condition_variable pool_cond_;//条件变量，用于线程同步，当连接池为空时，阻塞线程等待连接可用
+    // 单个数据库节点的连接池；主库一个，每个从库各一个
+    struct ConnectionPool {
+        std::string host;
+        int port = 0;
+        std::queue<sql::Connection*> connections;//连接池队列，用于存储可用的数据库连接
+        std::mutex mutex;//保护连接池的互斥锁，防止多个线程同时操作连接池
+        std::condition_variable cond;//条件变量，用于线程同步，当连接池为空时，阻塞线程等待连接可用
+        size_t current_size = 0;
+        std::atomic<bool> healthy{true};      // 健康检查结果，仅对从库有意义
+        std::atomic<int64_t> lag_seconds{0};  // 最近一次检测到的复制延迟
+    };
+
+    ConnectionPool primary_pool_;                              // 主库：所有写操作
+    std::vector<std::unique_ptr<ConnectionPool>> replica_pools_; // 从库：读操作负载均衡
+    std::atomic<size_t> replica_cursor_{0};
     size_t initial_pool_size_ = 5;
     size_t max_pool_size_ = 50;
-    size_t current_pool_size_ = 0;
+
+    // 从库健康检查
+    int max_replica_lag_s_;
+    int health_check_interval_ms_;
+    std::thread maintenance_thread_;
+    std::mutex maintenance_mutex_;
+    std::condition_variable maintenance_cond_;
+    bool stopping_ = false;
+
+    // 应用目录（可由多个 DAO 共享），后台线程按 app_catalog_refresh_ms_ 全量刷新
+    std::shared_ptr<AppCatalog> app_catalog_;
+    int app_catalog_refresh_ms_ = 30000;
+
+    // 读己之写栅栏（可为空）：刚失效过的用户改读主库，见 userReadAccess
+    std::shared_ptr<ReadFence> read_fence_;
 
     std::string last_error_;//最后一次操作的错误信息
     mutable std::mutex error_mutex_; // 保护 last_error_ 成员变量的互斥锁，防止多个线程同时操作 last_error_
 
-    sql::Connection* getConnection();
-    void releaseConnection(sql::Connection* conn);
-    sql::Connection* createConnection();
+    // 读写路由：写操作（以及需要读己之写的场景）走主库，读操作优先走健康的从库
+    enum class Access { kWrite, kRead };
+
+    // 取连接失败的原因：等待超时只说明连接池用满，节点本身可能完全正常
+    enum class AcquireError { kNone, kTimeout, kConnectFailed };
+
+    void initPool(ConnectionPool& pool, const std::string& host, int port);
+    // 连接池空且已达上限时最多等待 wait；error 非空时写入失败原因
+    sql::Connection* getConnection(ConnectionPool& pool,
+                                   std::chrono::milliseconds wait = std::chrono::milliseconds(1000),
+                                   AcquireError* error = nullptr);
+    void releaseConnection(ConnectionPool& pool, sql::Connection* conn);
+    sql::Connection* createConnection(const ConnectionPool& pool);
+
+    // 轮询选取一个健康的从库，没有可用从库时返回 nullptr（回落主库）
+    ConnectionPool* pickReadPool();
+    // 用户级读操作（会被回填进缓存的那些）的路由：命中读己之写栅栏时走主库
+    Access userReadAccess(const std::string& app_code, const std::string& user_id) const;
+    void maintenanceLoop();
+    void checkReplicaHealth(ConnectionPool& pool);
+
+    // batchAssignRoles / batchRemoveRoles 的公共实现
+    int64_t batchUpdateUserRoles(const std::string& app_code,
+                                 const std::vector<std::string>& user_ids,
+                                 const std::vector<std::string>& role_keys,
+                                 bool grant);
+
+    // 在 conn 当前事务内追加变更事件，随数据修改一起提交；失败时抛出 sql::SQLException
+    void insertChangeEvents(sql::Connection* conn, const std::vector<ChangeEvent>& events);
+
+    // 从数据库加载单个应用写入目录，应用不存在时从目录移除
+    bool loadAppEntry(sql::Connection* conn, const std::string& app_code, AppCatalog::Entry& out);
 
 public:
     // 构造函数
+    // host/port 为主库；replicas 非空时读操作会分摊到从库，
+    // 复制延迟超过 max_replica_lag_s 或连接失败的从库会被摘除，全部不可用时回落主库
+    // app_catalog 为空时 DAO 自建一个私有的应用目录
+    // read_fence 为同一进程内 CacheInvalidator 使用的栅栏，用于缓存失效后的读己之写
     PermissionDAO(const std::string& host,
                   int port,
                   const std::string& user,
                   const std::string& password,
-                  const std::string& database);
+                  const std::string& database,
+                  std::shared_ptr<AppCatalog> app_catalog = nullptr,
+                  const std::vector<Endpoint>& replicas = {},
+                  int max_replica_lag_s = 5,
+                  int health_check_interval_ms = 1000,
+                  std::shared_ptr<ReadFence> read_fence = nullptr);
     
     // 析构函数
-    ~PermissionDAO();
+    ~PermissionDAO() override;
+
+    // 本 DAO 使用的应用目录（构造时传入的或自建的）
+    std::shared_ptr<const AppCatalog> appCatalog() const { return app_catalog_; }
     
     // 检查单个权限
     bool checkPermission(const std::string& app_code,
                          const std::string& user_id,
                          const std::string& perm_key,
-                         const std::string& resource_id = "");
+                         const std::string& resource_id = "") override;
     
     // 批量检查权限
     std::vector<bool> batchCheckPermissions(
         const std::string& app_code,
-        const std::vector<std::tuple<std::string, std::string>>& requests);  // (user_id, perm_key)
+        const std::vector<std::tuple<std::string, std::string>>& requests) override;  // (user_id, perm_key)
     
     // 获取用户所有权限
     std::vector<std::pair<std::string, std::string>> 
     getUserPermissions(const std::string& app_code,
-                       const std::string& user_id);
+                       const std::string& user_id) override;
     
     // 获取用户角色
     std::vector<std::string> getUserRoles(const std::string& app_code,
-                                          const std::string& user_id);
+                                          const std::string& user_id) override;
     
-    // 管理接口（根据需要添加）
-    struct AppInfo {
-        int64_t id;
-        std::string app_name;
-        std::string app_code;
-        std::string app_secret;
-        std::string description;
-        int32_t status;
-        std::string created_at;
-        std::string updated_at;
-    };
-
+    // 管理接口
     bool createApp(const std::string& app_name,
                    const std::string& app_code,
                    const std::string& description,
-                   std::string& out_app_secret);
+                   std::string& out_app_secret) override;
 
     bool updateApp(const std::string& app_code,
                    const std::string* app_name,
                    const std::string* description,
-                   const int32_t* status);
+                   const int32_t* status) override;
 
-    bool deleteApp(const std::string& app_code);
+    bool deleteApp(const std::string& app_code) override;
 
-    bool getApp(const std::string& app_code, AppInfo& out_app);
+    bool getApp(const std::string& app_code, AppInfo& out_app) override;
 
     std::vector<AppInfo> listApps(int32_t page, int32_t page_size,
                                   const std::string* app_name,
                                   const int32_t* status,
-                                  int64_t& out_total);
+                                  int64_t& out_total) override;
 
     bool createRole(const std::string& app_code,
                     const std::string& role_name,
                     const std::string& role_key,
                     const std::string& description,
-                    bool is_default = false);
+                    bool is_default = false) override;
 
     bool createPermission(const std::string& app_code,
                           const std::string& perm_name,
                           const std::string& perm_key,
-                          const std::string& description);
+                          const std::string& description) override;
 
     bool updateRole(const std::string& app_code,
                     const std::string& role_key,
                     const std::string* role_name,
                     const std::string* description,
-                    const bool* is_default);
+                    const bool* is_default) override;
 
     bool updatePermission(const std::string& app_code,
                           const std::string& perm_key,
                           const std::string* perm_name,
-                          const std::string* description);
-
-    bool deleteRole(const std::string& app_code, const std::string& role_key);
-    bool deletePermission(const std::string& app_code, const std::string& perm_key);
-
-    struct RoleInfo {
-        int64_t id;
-        std::string role_name;
-        std::string role_key;
-        std::string description;
-        bool is_default;
-        std::vector<std::string> perm_keys; // 新增这一行
-    };
-    std::vector<RoleInfo> listRoles(const std::string& app_code);
+                          const std::string* description) override;
 
-    struct PermInfo {
-        int64_t id;
-        std::string perm_name;
-        std::string perm_key;
-        std::string description;
-    };
-    std::vector<PermInfo> listPermissions(const std::string& app_code);
+    bool deleteRole(const std::string& app_code, const std::string& role_key) override;
+    bool deletePermission(const std::string& app_code, const std::string& perm_key) override;
+
+    std::vector<RoleInfo> listRoles(const std::string& app_code) override;
+
+    std::vector<PermInfo> listPermissions(const std::string& app_code) override;
 
     bool assignRoleToUser(const std::string& app_code,
                           const std::string& user_id,
-                          const std::string& role_key);
+                          const std::string& role_key) override;
     
     bool removeRoleFromUser(const std::string& app_code,
                             const std::string& user_id,
-                            const std::string& role_key);
+                            const std::string& role_key) override;
+
+    // 批量授权/撤销：角色 ID 只解析一次，在同一事务内分块执行多行 INSERT / DELETE ... IN
+    // 成功返回实际影响的行数（已存在的授权不计入），失败返回 -1 且事务整体回滚
+    int64_t batchAssignRoles(const std::string& app_code,
+                             const std::vector<std::string>& user_ids,
+                             const std::vector<std::string>& role_keys) override;
+
+    int64_t batchRemoveRoles(const std::string& app_code,
+                             const std::vector<std::string>& user_ids,
+                             const std::vector<std::string>& role_keys) override;
 
     // 角色-权限管理
     bool addPermissionToRole(const std::string& app_code,
                              const std::string& role_key,
-                             const std::string& perm_key);
+                             const std::string& perm_key) override;
                              
     bool removePermissionFromRole(const std::string& app_code,
                                   const std::string& role_key,
-                                  const std::string& perm_key);
+                                  const std::string& perm_key) override;
 
     std::vector<std::string> getRolePermissions(const std::string& app_code,
-                                                const std::string& role_key);
+                                                const std::string& role_key) override;
 
     std::vector<std::string> getRolesWithPermission(const std::string& app_code,
-                                                    const std::string& perm_key);
+                                                    const std::string& perm_key) override;
 
-    bool appExists(const std::string& app_code);
-    bool permissionExists(const std::string& app_code, const std::string& perm_key);
+    bool appExists(const std::string& app_code) override;
+    bool permissionExists(const std::string& app_code, const std::string& perm_key) override;
 
-    struct UserInfo {
-        std::string user_id;
-        std::string created_at;
-    };
+    // 按 (created_at, id) 倒序
     std::vector<UserInfo> getRoleUsers(const std::string& app_code,
                                        const std::string& role_key,
                                        int32_t page, int32_t page_size,
-                                       int64_t& out_total);
+                                       int64_t& out_total,
+                                       const PageCursor* after = nullptr,
+                                       TotalMode total_mode = TotalMode::kExact,
+                                       PageCursor* out_next = nullptr) override;
 
-    struct UserRoleData {
-        std::string user_id;
-        std::vector<std::string> role_keys;
-        std::vector<std::string> perm_keys;
-        std::string created_at;
-    };
+    // 偏移分页按首次授权时间倒序；游标分页 (after 非空) 按 app_user_id 升序，
+    // 因为分组后的 MIN(created_at) 无法走索引 seek
     std::vector<UserRoleData> listUserRoles(const std::string& app_code,
                                             int32_t page, int32_t page_size,
                                             const std::string* user_id,
-                                            int64_t& out_total);
+                                            int64_t& out_total,
+                                            const PageCursor* after = nullptr,
+                                            TotalMode total_mode = TotalMode::kExact,
+                                            PageCursor* out_next = nullptr) override;
 
     // 审计日志
     bool createAuditLog(int64_t operator_id, 
@@ -194,23 +262,12 @@ public:
                         const std::string& target_name = "",
                         const std::string& object_type = "",
                         const std::string& object_id = "",
-                        const std::string& object_name = "");
-                        
-    struct AuditLogInfo {
-        int64_t id;
-        int64_t operator_id;
-        std::string operator_name;
-        std::string app_code;
-        std::string action;
-        std::string target_type;
-        std::string target_id;
-        std::string target_name;
-        std::string object_type;
-        std::string object_id;
-        std::string object_name;
-        std::string created_at;
-    };
+                        const std::string& object_name = "") override;
+
+    // 批量写入审计日志（多行 INSERT，同一事务内分块执行），忽略 id 字段；created_at 为空时取数据库当前时间
+    bool createAuditLogs(const std::vector<AuditLogInfo>& logs) override;
     
+    // 按 (created_at, id) 倒序
     std::vector<AuditLogInfo> listAuditLogs(int32_t page, int32_t page_size,
                                             const std::string* app_code,
                                             const std::string* action,
@@ -218,44 +275,100 @@ public:
                                             const std::string* target_id,
                                             const int64_t* start_time,
                                             const int64_t* end_time,
-                                            int64_t& out_total);
-    
-    struct ConsoleUser {
-        int64_t id = -1;
-        std::string username;
-        std::string password_hash;
-        std::string real_name;
-    };
+                                            int64_t& out_total,
+                                            const PageCursor* after = nullptr,
+                                            TotalMode total_mode = TotalMode::kExact,
+                                            PageCursor* out_next = nullptr) override;
+
+    // 审计日志表按月 RANGE 分区 (created_at)，分区信息来自 information_schema
+    std::vector<AuditPartition> listAuditPartitions() override;
+
+    bool addAuditPartitions(const std::vector<AuditPartition>& parts) override;
+
+    bool exportAuditPartition(const std::string& partition,
+                              const std::function<bool(const AuditLogInfo&)>& fn,
+                              int64_t& out_rows) override;
+
+    bool dropAuditPartition(const std::string& partition) override;
+
+    // 权限变更日志 (sys_change_log)
+    // seq 由数据库自增分配（写接口在各自事务内写入），多个 auth_server 副本写入同一张表，序号全局一致，订阅方可以在任意副本上断点续传
+    // 固定读主库：从库之间进度不同，轮询读取可能跳过尚未复制到的序号
+    bool fetchChangeEvents(int64_t after_seq, size_t limit, std::vector<ChangeEvent>& out) override;
+
+    bool getChangeSeqRange(int64_t& min_seq, int64_t& max_seq) override;
+
+    int64_t purgeChangeEvents(int retention_hours, size_t limit) override;
+
+    // 固定读主库，保证各副本算出的目录版本一致
+    bool loadPermissionHandles(std::vector<PermHandle>& out) override;
 
     // 获取控制台用户详情
-    ConsoleUser getConsoleUser(const std::string& username);
+    ConsoleUser getConsoleUser(const std::string& username) override;
     
     // Legacy support (to be removed) - now calls getConsoleUser
     std::string getConsoleUserHash(const std::string& username);
 
+    // 从 sys_apps 全量重新加载应用目录
+    bool refreshAppCatalog();
+
     // 状态检查
-    bool isConnected() const;
-    std::string getLastError() const;
+    bool isConnected() const override;
+    std::string getLastError() const override;
     
 private:
-    // 内部辅助方法
+    // 内部辅助方法：通过应用目录解析 app_code，目录未命中时回源查库
     int64_t getAppId(const std::string& app_code);
+    // 同 getAppId，但应用被禁用 (status != 1) 时也返回 -1，用于鉴权路径
+    int64_t getActiveAppId(const std::string& app_code);
     
     // RAII 风格的连接守卫，作用域结束自动归还连接
+    // 取连接的等待时间计入 dao_pool_acquire，并由之后的第一条语句计入该语句的统计 (DaoStats)
     class ConnectionGuard {
     public:
-        ConnectionGuard(PermissionDAO* dao) : dao_(dao) {
-            conn_ = dao_->getConnection();
+        ConnectionGuard(PermissionDAO* dao, Access access = Access::kWrite)
+            : dao_(dao), pool_(nullptr), conn_(nullptr) {
+            const int64_t start_us = butil::cpuwide_time_us();
+            if (access == Access::kRead) {
+                pool_ = dao_->pickReadPool();
+                if (pool_) {
+                    // 从库只短暂等待，池子用满时本次请求直接改走主库
+                    AcquireError error = AcquireError::kNone;
+                    conn_ = dao_->getConnection(*pool_, std::chrono::milliseconds(kReplicaAcquireWaitMs), &error);
+                    // 只有连不上才摘除，等待健康检查恢复；超时不代表节点故障
+                    if (error == AcquireError::kConnectFailed) pool_->healthy = false;
+                }
+            }
+            if (!conn_) {
+                pool_ = &dao_->primary_pool_;
+                conn_ = dao_->getConnection(*pool_);
+            }
+            acquire_wait_us_ = butil::cpuwide_time_us() - start_us;
+            if (conn_) {
+                DaoStats::Global().RecordAcquire(nullptr, acquire_wait_us_);
+            } else {
+                DaoStats::Global().RecordAcquireFailure();
+            }
         }
         ~ConnectionGuard() {
-            if (conn_) dao_->releaseConnection(conn_);
+            if (conn_) dao_->releaseConnection(*pool_, conn_);
+        }
+        // 取连接的等待时间，只返回一次，之后返回 -1
+        int64_t takeAcquireWaitUs() {
+            int64_t wait_us = acquire_wait_us_;
+            acquire_wait_us_ = -1;
+            return wait_us;
         }
         sql::Connection* operator->() { return conn_; }
         sql::Connection* get() { return conn_; }
         bool isValid() { return conn_ != nullptr; }
     private:
         PermissionDAO* dao_;
+        ConnectionPool* pool_;
         sql::Connection* conn_;
+        int64_t acquire_wait_us_ = -1;
+
+        enum { kReplicaAcquireWaitMs = 100 };
     };
 };
 
@@ -0,0 +1,336 @@
+#ifndef PERMISSION_STORE_H
+#define PERMISSION_STORE_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// 权限数据存储接口。
+// PermissionDAO 为 MySQL 实现（连接池、主从路由）；MemoryPermissionStore 为进程内实现，
+// 从 scripts/init.sql 的种子数据加载并可注入延迟，用于不依赖 MySQL 的基准与故障复现。
+// 语义以 MySQL 实现为准：返回 bool 的接口失败时通过 getLastError() 取原因，
+// 查询类接口失败时返回空结果。所有实现都必须是线程安全的。
+// 会改变鉴权结果的写接口（应用修改/删除、授权/撤销、角色增删权限、删除角色/权限）成功时，
+// 在同一事务内追加对应的变更事件，数据修改与变更日志要么都提交、要么都不生效。
+class PermissionStore {
+public:
+    virtual ~PermissionStore() = default;
+
+    // ------------------------- 鉴权 -------------------------
+    // 检查单个权限
+    virtual bool checkPermission(const std::string& app_code,
+                                 const std::string& user_id,
+                                 const std::string& perm_key,
+                                 const std::string& resource_id = "") = 0;
+
+    // 批量检查权限
+    virtual std::vector<bool> batchCheckPermissions(
+        const std::string& app_code,
+        const std::vector<std::tuple<std::string, std::string>>& requests) = 0;  // (user_id, perm_key)
+
+    // 获取用户所有权限 (perm_key, perm_name)
+    virtual std::vector<std::pair<std::string, std::string>>
+    getUserPermissions(const std::string& app_code,
+                       const std::string& user_id) = 0;
+
+    // 获取用户角色
+    virtual std::vector<std::string> getUserRoles(const std::string& app_code,
+                                                  const std::string& user_id) = 0;
+
+    // ------------------------- 应用管理 -------------------------
+    struct AppInfo {
+        int64_t id;
+        std::string app_name;
+        std::string app_code;
+        std::string app_secret;
+        std::string description;
+        int32_t status;
+        std::string created_at;
+        std::string updated_at;
+    };
+
+    virtual bool createApp(const std::string& app_name,
+                           const std::string& app_code,
+                           const std::string& description,
+                           std::string& out_app_secret) = 0;
+
+    virtual bool updateApp(const std::string& app_code,
+                           const std::string* app_name,
+                           const std::string* description,
+                           const int32_t* status) = 0;
+
+    virtual bool deleteApp(const std::string& app_code) = 0;
+
+    virtual bool getApp(const std::string& app_code, AppInfo& out_app) = 0;
+
+    virtual std::vector<AppInfo> listApps(int32_t page, int32_t page_size,
+                                          const std::string* app_name,
+                                          const int32_t* status,
+                                          int64_t& out_total) = 0;
+
+    // ------------------------- 角色 / 权限定义 -------------------------
+    virtual bool createRole(const std::string& app_code,
+                            const std::string& role_name,
+                            const std::string& role_key,
+                            const std::string& description,
+                            bool is_default = false) = 0;
+
+    virtual bool createPermission(const std::string& app_code,
+                                  const std::string& perm_name,
+                                  const std::string& perm_key,
+                                  const std::string& description) = 0;
+
+    virtual bool updateRole(const std::string& app_code,
+                            const std::string& role_key,
+                            const std::string* role_name,
+                            const std::string* description,
+                            const bool* is_default) = 0;
+
+    virtual bool updatePermission(const std::string& app_code,
+                                  const std::string& perm_key,
+                                  const std::string* perm_name,
+                                  const std::string* description) = 0;
+
+    virtual bool deleteRole(const std::string& app_code, const std::string& role_key) = 0;
+    virtual bool deletePermission(const std::string& app_code, const std::string& perm_key) = 0;
+
+    struct RoleInfo {
+        int64_t id;
+        std::string role_name;
+        std::string role_key;
+        std::string description;
+        bool is_default;
+        std::vector<std::string> perm_keys;
+    };
+    virtual std::vector<RoleInfo> listRoles(const std::string& app_code) = 0;
+
+    struct PermInfo {
+        int64_t id;
+        std::string perm_name;
+        std::string perm_key;
+        std::string description;
+    };
+    virtual std::vector<PermInfo> listPermissions(const std::string& app_code) = 0;
+
+    // ------------------------- 用户-角色授权 -------------------------
+    virtual bool assignRoleToUser(const std::string& app_code,
+                                  const std::string& user_id,
+                                  const std::string& role_key) = 0;
+
+    virtual bool removeRoleFromUser(const std::string& app_code,
+                                    const std::string& user_id,
+                                    const std::string& role_key) = 0;
+
+    // 批量授权/撤销：全部成功或全部不生效
+    // 成功返回实际影响的行数（已存在的授权不计入），失败返回 -1
+    virtual int64_t batchAssignRoles(const std::string& app_code,
+                                     const std::vector<std::string>& user_ids,
+                                     const std::vector<std::string>& role_keys) = 0;
+
+    virtual int64_t batchRemoveRoles(const std::string& app_code,
+                                     const std::vector<std::string>& user_ids,
+                                     const std::vector<std::string>& role_keys) = 0;
+
+    // ------------------------- 角色-权限绑定 -------------------------
+    virtual bool addPermissionToRole(const std::string& app_code,
+                                     const std::string& role_key,
+                                     const std::string& perm_key) = 0;
+
+    virtual bool removePermissionFromRole(const std::string& app_code,
+                                          const std::string& role_key,
+                                          const std::string& perm_key) = 0;
+
+    virtual std::vector<std::string> getRolePermissions(const std::string& app_code,
+                                                        const std::string& role_key) = 0;
+
+    virtual std::vector<std::string> getRolesWithPermission(const std::string& app_code,
+                                                            const std::string& perm_key) = 0;
+
+    virtual bool appExists(const std::string& app_code) = 0;
+    virtual bool permissionExists(const std::string& app_code, const std::string& perm_key) = 0;
+
+    // ------------------------- 分页查询 -------------------------
+    // 分页总数的计算方式：精确 COUNT 在深度翻页/大表上代价很高，可改为估算或不计算
+    enum class TotalMode {
+        kExact,     // COUNT(*)
+        kEstimate,  // 取 EXPLAIN 的估算行数，代价与数据量无关
+        kNone,      // 不计算，out_total 返回 -1
+    };
+
+    // 游标分页 (keyset/seek) 的位置，即上一页最后一行的排序键。
+    // after 非空时忽略 page，直接从该位置之后取 page_size 行，代价与翻到第几页无关；
+    // 返回满页时 out_next 填入本页最后一行，作为下一页的 after
+    struct PageCursor {
+        std::string created_at;
+        int64_t id = 0;
+        std::string key;    // listUserRoles 按 app_user_id 翻页时使用
+    };
+
+    struct UserInfo {
+        std::string user_id;
+        std::string created_at;
+    };
+    // 按 (created_at, id) 倒序
+    virtual std::vector<UserInfo> getRoleUsers(const std::string& app_code,
+                                               const std::string& role_key,
+                                               int32_t page, int32_t page_size,
+                                               int64_t& out_total,
+                                               const PageCursor* after = nullptr,
+                                               TotalMode total_mode = TotalMode::kExact,
+                                               PageCursor* out_next = nullptr) = 0;
+
+    struct UserRoleData {
+        std::string user_id;
+        std::vector<std::string> role_keys;
+        std::vector<std::string> perm_keys;
+        std::string created_at;
+    };
+    // 偏移分页按首次授权时间倒序；游标分页 (after 非空) 按 app_user_id 升序
+    virtual std::vector<UserRoleData> listUserRoles(const std::string& app_code,
+                                                    int32_t page, int32_t page_size,
+                                                    const std::string* user_id,
+                                                    int64_t& out_total,
+                                                    const PageCursor* after = nullptr,
+                                                    TotalMode total_mode = TotalMode::kExact,
+                                                    PageCursor* out_next = nullptr) = 0;
+
+    // ------------------------- 审计日志 -------------------------
+    virtual bool createAuditLog(int64_t operator_id,
+                                const std::string& operator_name,
+                                const std::string& app_code,
+                                const std::string& action,
+                                const std::string& target_type,
+                                const std::string& target_id,
+                                const std::string& target_name = "",
+                                const std::string& object_type = "",
+                                const std::string& object_id = "",
+                                const std::string& object_name = "") = 0;
+
+    struct AuditLogInfo {
+        int64_t id;
+        int64_t operator_id;
+        std::string operator_name;
+        std::string app_code;
+        std::string action;
+        std::string target_type;
+        std::string target_id;
+        std::string target_name;
+        std::string object_type;
+        std::string object_id;
+        std::string object_name;
+        std::string created_at;
+    };
+
+    // 批量写入审计日志，忽略 id 字段；created_at 为空时取当前时间
+    // 必须整批成功或整批失败：AuditWriter 在失败时会把整批落盘并在之后重放
+    virtual bool createAuditLogs(const std::vector<AuditLogInfo>& logs) = 0;
+
+    // 按 (created_at, id) 倒序
+    virtual std::vector<AuditLogInfo> listAuditLogs(int32_t page, int32_t page_size,
+                                                    const std::string* app_code,
+                                                    const std::string* action,
+                                                    const std::string* operator_id,
+                                                    const std::string* target_id,
+                                                    const int64_t* start_time,
+                                                    const int64_t* end_time,
+                                                    int64_t& out_total,
+                                                    const PageCursor* after = nullptr,
+                                                    TotalMode total_mode = TotalMode::kExact,
+                                                    PageCursor* out_next = nullptr) = 0;
+
+    // 审计日志按月分区，以下接口供归档任务维护分区
+    struct AuditPartition {
+        std::string name;       // 例: p202610
+        std::string less_than;  // 上界（不含），例: "2026-11-01 00:00:00"；MAXVALUE 分区为空
+        int64_t rows = 0;       // 估算行数
+    };
+
+    // 按顺序列出分区，不支持分区时返回空
+    virtual std::vector<AuditPartition> listAuditPartitions() = 0;
+
+    // 从 MAXVALUE 分区中拆出新分区，parts 需按上界升序且都大于现有分区的上界
+    virtual bool addAuditPartitions(const std::vector<AuditPartition>& parts) = 0;
+
+    // 按 (created_at, id) 倒序读取单个分区，fn 返回 false 时中止；out_rows 为已读取的行数
+    virtual bool exportAuditPartition(const std::string& partition,
+                                      const std::function<bool(const AuditLogInfo&)>& fn,
+                                      int64_t& out_rows) = 0;
+
+    virtual bool dropAuditPartition(const std::string& partition) = 0;
+
+    // ------------------------- 权限变更日志 -------------------------
+    // AuthService.Watch 的推送源；seq 由存储分配，全局递增
+    struct ChangeEvent {
+        // 取值与 siqi::auth::ChangeEvent::Type 一致，存储层不依赖 proto
+        enum Type {
+            kUserGrantRole = 1,
+            kUserRevokeRole = 2,
+            kRoleAddPerm = 3,
+            kRoleRemovePerm = 4,
+            kRoleDelete = 5,
+            kPermDelete = 6,
+            kAppUpdate = 7,
+        };
+
+        int64_t seq = 0;
+        std::string app_code;
+        int32_t type = 0;        // siqi::auth::ChangeEvent::Type
+        std::string user_id;
+        std::string role_key;
+        std::string perm_key;
+        int64_t timestamp = 0;   // unix 时间戳（秒）
+
+        static ChangeEvent Make(Type type, const std::string& app_code,
+                                const std::string& user_id = std::string(),
+                                const std::string& role_key = std::string(),
+                                const std::string& perm_key = std::string()) {
+            ChangeEvent ev;
+            ev.app_code = app_code;
+            ev.type = type;
+            ev.user_id = user_id;
+            ev.role_key = role_key;
+            ev.perm_key = perm_key;
+            return ev;
+        }
+    };
+
+    // 读取 seq > after_seq 的事件，按 seq 升序最多 limit 条
+    virtual bool fetchChangeEvents(int64_t after_seq, size_t limit, std::vector<ChangeEvent>& out) = 0;
+
+    // 变更日志中现存的最小、最大 seq，为空时均为 0
+    virtual bool getChangeSeqRange(int64_t& min_seq, int64_t& max_seq) = 0;
+
+    // 删除早于 retention_hours 小时的事件（每次最多 limit 行），返回删除行数，失败返回 -1
+    virtual int64_t purgeChangeEvents(int retention_hours, size_t limit) = 0;
+
+    // ------------------------- 整数句柄目录 -------------------------
+    // HandleCatalog 的数据源：全部应用及其权限，按 (app_id, perm_id) 升序
+    // 没有任何权限的应用也返回一行，perm_id 为 0
+    struct PermHandle {
+        int64_t app_id = 0;
+        std::string app_code;
+        int64_t perm_id = 0;
+        std::string perm_key;
+    };
+    virtual bool loadPermissionHandles(std::vector<PermHandle>& out) = 0;
+
+    // ------------------------- 控制台用户 -------------------------
+    struct ConsoleUser {
+        int64_t id = -1;
+        std::string username;
+        std::string password_hash;
+        std::string real_name;
+    };
+
+    // 获取控制台用户详情，不存在时 id 为 -1
+    virtual ConsoleUser getConsoleUser(const std::string& username) = 0;
+
+    // 状态检查
+    virtual bool isConnected() const = 0;
+    virtual std::string getLastError() const = 0;
+};
+
+#endif // PERMISSION_STORE_H
@@ -0,0 +1,87 @@
+#ifndef RATE_LIMITER_H
+#define RATE_LIMITER_H
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// 按 key 独立计数的令牌桶限流器（例如登录按用户名、按来源 IP 分别限流）
+// 每个 key 的桶容量为 burst，每分钟补充 per_minute 个令牌；per_minute <= 0 表示不限流。
+// key 数量达到 max_keys 时先清理已回满的桶（与从未访问等价），防止伪造大量 key 撑爆内存。
+class RateLimiter {
+public:
+    RateLimiter(int per_minute, int burst, size_t max_keys = 100000)
+        : rate_per_s_(per_minute / 60.0),
+          burst_(std::max(burst, 1)),
+          max_keys_(max_keys),
+          enabled_(per_minute > 0) {}
+
+    RateLimiter(const RateLimiter&) = delete;
+    RateLimiter& operator=(const RateLimiter&) = delete;
+
+    // 取一个令牌，桶已空时返回 false
+    bool Allow(const std::string& key) {
+        if (!enabled_) {
+            return true;
+        }
+        auto now = std::chrono::steady_clock::now();
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = buckets_.find(key);
+        if (it == buckets_.end()) {
+            if (buckets_.size() >= max_keys_) {
+                Evict(now);
+            }
+            it = buckets_.emplace(key, Bucket{static_cast<double>(burst_), now}).first;
+        }
+        Bucket& bucket = it->second;
+        Refill(bucket, now);
+        if (bucket.tokens < 1.0) {
+            return false;
+        }
+        bucket.tokens -= 1.0;
+        return true;
+    }
+
+    size_t Size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return buckets_.size();
+    }
+
+private:
+    struct Bucket {
+        double tokens;
+        std::chrono::steady_clock::time_point last;
+    };
+
+    void Refill(Bucket& bucket, std::chrono::steady_clock::time_point now) {
+        double elapsed = std::chrono::duration<double>(now - bucket.last).count();
+        bucket.tokens = std::min(static_cast<double>(burst_), bucket.tokens + elapsed * rate_per_s_);
+        bucket.last = now;
+    }
+
+    void Evict(std::chrono::steady_clock::time_point now) {
+        for (auto it = buckets_.begin(); it != buckets_.end();) {
+            Refill(it->second, now);
+            if (it->second.tokens >= burst_) {
+                it = buckets_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        // 全部都在限流中：放弃历史状态，优先保证内存有界
+        if (buckets_.size() >= max_keys_) {
+            buckets_.clear();
+        }
+    }
+
+    const double rate_per_s_;
+    const int burst_;
+    const size_t max_keys_;
+    const bool enabled_;
+    std::unordered_map<std::string, Bucket> buckets_;
+    mutable std::mutex mutex_;
+};
+
+#endif // RATE_LIMITER_H
@@ -0,0 +1,84 @@
+#ifndef READ_FENCE_H
+#define READ_FENCE_H
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// 读己之写栅栏：记录最近被失效（即刚被写过）的缓存 key / 前缀
+// 缓存失效之后的第一次未命中如果读到复制延迟中的从库，旧权限会被重新放回缓存并保留整个 cache_ttl。
+// CacheInvalidator 在失效本地缓存时（包括其他副本推送过来的失效）同时在这里登记，
+// PermissionDAO 的用户级读操作命中栅栏时改读主库；登记在 window（不小于从库允许的最大复制延迟）后过期。
+// key 与 LocalCache 一致，为 "app_code:user_id"；前缀为 "app_code:"。
+class ReadFence {
+public:
+    explicit ReadFence(std::chrono::milliseconds window) : window_(window) {}
+
+    ReadFence(const ReadFence&) = delete;
+    ReadFence& operator=(const ReadFence&) = delete;
+
+    void MarkKey(const std::string& key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        keys_[key] = Clock::now() + window_;
+    }
+
+    void MarkPrefix(const std::string& prefix) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        prefixes_[prefix] = Clock::now() + window_;
+    }
+
+    // clear_all：窗口内所有用户级读取都走主库
+    void MarkAll() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        all_until_ = Clock::now() + window_;
+    }
+
+    // key 是否仍在栅栏窗口内，是则应读主库
+    bool Pinned(const std::string& key) const {
+        const Clock::time_point now = Clock::now();
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (now < all_until_) {
+            return true;
+        }
+        auto it = keys_.find(key);
+        if (it != keys_.end() && now < it->second) {
+            return true;
+        }
+        // 前缀只来自应用级失效，数量很少
+        for (const auto& kv : prefixes_) {
+            if (now < kv.second && key.compare(0, kv.first.size(), kv.first) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // 清理已过期的登记，由后台线程定期调用
+    void Purge() {
+        const Clock::time_point now = Clock::now();
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto it = keys_.begin(); it != keys_.end();) {
+            it = now < it->second ? std::next(it) : keys_.erase(it);
+        }
+        for (auto it = prefixes_.begin(); it != prefixes_.end();) {
+            it = now < it->second ? std::next(it) : prefixes_.erase(it);
+        }
+    }
+
+    size_t Size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return keys_.size() + prefixes_.size();
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    const std::chrono::milliseconds window_;
+    std::unordered_map<std::string, Clock::time_point> keys_;
+    std::unordered_map<std::string, Clock::time_point> prefixes_;
+    Clock::time_point all_until_;
+    mutable std::mutex mutex_;
+};
+
+#endif // READ_FENCE_H
@@ -0,0 +1,180 @@
+#ifndef SESSION_TOKEN_H
+#define SESSION_TOKEN_H
+
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+// 无状态的管理后台 Token：HMAC-SHA256 签名，载荷中携带用户信息与过期时间
+// 格式: "v1." + base64url(user_id \n expires_at \n username \n real_name) + "." + base64url(HMAC(前两段))
+// 校验只需本地计算一次 HMAC 并做常数时间比较，不查会话表、不加锁，
+// 服务重启后 Token 依然有效，多个 auth_server 实例只要配置相同的密钥即可互认。
+// 注意：Token 在过期前无法单独吊销，需要时可通过更换密钥使全部 Token 失效。
+class SessionTokenSigner {
+public:
+    struct Claims {
+        int64_t user_id = 0;
+        int64_t expires_at = 0;  // unix 时间戳（秒）
+        std::string username;
+        std::string real_name;
+    };
+
+    explicit SessionTokenSigner(const std::string& key) : key_(key) {}
+
+    // 签发 Token
+    std::string Issue(const Claims& claims) const {
+        std::string payload = std::to_string(claims.user_id) + "\n" + std::to_string(claims.expires_at) + "\n" +
+                              claims.username + "\n" + claims.real_name;
+        std::string token = kPrefix();
+        Base64UrlEncode(reinterpret_cast<const unsigned char*>(payload.data()), payload.size(), token);
+
+        unsigned char mac[kMacSize];
+        Sign(token.data(), token.size(), mac);
+        token += '.';
+        Base64UrlEncode(mac, kMacSize, token);
+        return token;
+    }
+
+    // 校验签名与有效期，成功时填充 claims
+    // 签名校验在栈上完成，不分配内存；签名通过后才解析载荷
+    bool Verify(const char* token, size_t len, int64_t now, Claims& claims) const {
+        const size_t prefix_len = kPrefixSize;
+        if (len <= prefix_len + 1 + kEncodedMacSize ||
+            std::string::traits_type::compare(token, kPrefix(), prefix_len) != 0) {
+            return false;
+        }
+        size_t dot = len - kEncodedMacSize - 1;
+        if (token[dot] != '.') {
+            return false;
+        }
+
+        unsigned char expected[kMacSize];
+        unsigned char actual[kMacSize];
+        if (Base64UrlDecode(token + dot + 1, kEncodedMacSize, actual, kMacSize) != kMacSize) {
+            return false;
+        }
+        if (!Sign(token, dot, expected) || CRYPTO_memcmp(expected, actual, kMacSize) != 0) {
+            return false;
+        }
+
+        // 载荷
+        const char* body = token + prefix_len;
+        size_t body_len = dot - prefix_len;
+        std::string payload(body_len, '\0');
+        size_t n = Base64UrlDecode(body, body_len, reinterpret_cast<unsigned char*>(&payload[0]), payload.size());
+        if (n == kInvalid) {
+            return false;
+        }
+        payload.resize(n);
+
+        size_t p1 = payload.find('\n');
+        size_t p2 = p1 == std::string::npos ? p1 : payload.find('\n', p1 + 1);
+        size_t p3 = p2 == std::string::npos ? p2 : payload.find('\n', p2 + 1);
+        if (p3 == std::string::npos) {
+            return false;
+        }
+        claims.user_id = std::strtoll(payload.c_str(), nullptr, 10);
+        claims.expires_at = std::strtoll(payload.c_str() + p1 + 1, nullptr, 10);
+        claims.username = payload.substr(p2 + 1, p3 - p2 - 1);
+        claims.real_name = payload.substr(p3 + 1);
+        return claims.expires_at > now && !claims.username.empty();
+    }
+
+    // 对任意数据计算 HMAC-SHA256（32 字节原始值），集群内部 RPC 复用同一套签名
+    std::string Mac(const std::string& data) const {
+        unsigned char mac[kMacSize];
+        if (!Sign(data.data(), data.size(), mac)) {
+            return std::string();
+        }
+        return std::string(reinterpret_cast<const char*>(mac), kMacSize);
+    }
+
+    // 常数时间比较 data 的 HMAC 与 mac
+    bool VerifyMac(const std::string& data, const std::string& mac) const {
+        unsigned char expected[kMacSize];
+        return mac.size() == kMacSize && Sign(data.data(), data.size(), expected) &&
+               CRYPTO_memcmp(expected, mac.data(), kMacSize) == 0;
+    }
+
+private:
+    static const char* kPrefix() { return "v1."; }
+    static constexpr size_t kPrefixSize = 3;
+    static constexpr size_t kMacSize = 32;           // SHA-256
+    static constexpr size_t kEncodedMacSize = 43;    // base64url(32 字节)，无填充
+    static constexpr size_t kInvalid = static_cast<size_t>(-1);
+
+    bool Sign(const char* data, size_t len, unsigned char out[kMacSize]) const {
+        unsigned int out_len = 0;
+        return HMAC(EVP_sha256(), key_.data(), static_cast<int>(key_.size()),
+                    reinterpret_cast<const unsigned char*>(data), len, out, &out_len) != nullptr &&
+               out_len == kMacSize;
+    }
+
+    static void Base64UrlEncode(const unsigned char* in, size_t len, std::string& out) {
+        static const char kTable[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+        size_t i = 0;
+        for (; i + 2 < len; i += 3) {
+            uint32_t v = (in[i] << 16) | (in[i + 1] << 8) | in[i + 2];
+            out += kTable[(v >> 18) & 63];
+            out += kTable[(v >> 12) & 63];
+            out += kTable[(v >> 6) & 63];
+            out += kTable[v & 63];
+        }
+        if (i + 1 == len) {
+            uint32_t v = in[i] << 16;
+            out += kTable[(v >> 18) & 63];
+            out += kTable[(v >> 12) & 63];
+        } else if (i + 2 == len) {
+            uint32_t v = (in[i] << 16) | (in[i + 1] << 8);
+            out += kTable[(v >> 18) & 63];
+            out += kTable[(v >> 12) & 63];
+            out += kTable[(v >> 6) & 63];
+        }
+    }
+
+    // 解码到 out（容量 cap），返回字节数；非法输入或容量不足返回 kInvalid
+    static size_t Base64UrlDecode(const char* in, size_t len, unsigned char* out, size_t cap) {
+        if (len % 4 == 1) {
+            return kInvalid;
+        }
+        size_t n = 0;
+        uint32_t acc = 0;
+        int bits = 0;
+        for (size_t i = 0; i < len; ++i) {
+            int v = DecodeChar(in[i]);
+            if (v < 0) {
+                return kInvalid;
+            }
+            acc = (acc << 6) | static_cast<uint32_t>(v);
+            bits += 6;
+            if (bits >= 8) {
+                bits -= 8;
+                if (n >= cap) {
+                    return kInvalid;
+                }
+                out[n++] = static_cast<unsigned char>((acc >> bits) & 0xFF);
+            }
+        }
+        // 末尾多余的比特必须为 0，保证编码唯一（否则同一签名有多种写法）
+        if ((acc & ((1u << bits) - 1)) != 0) {
+            return kInvalid;
+        }
+        return n;
+    }
+
+    static int DecodeChar(char c) {
+        if (c >= 'A' && c <= 'Z') return c - 'A';
+        if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+        if (c >= '0' && c <= '9') return c - '0' + 52;
+        if (c == '-') return 62;
+        if (c == '_') return 63;
+        return -1;
+    }
+
+    std::string key_;
+};
+
+#endif // SESSION_TOKEN_H
@@ -106,7 +106,7 @@ CREATE TABLE `sys_user_roles` (
     `updated_at` DATETIME DEFAULT CURRENT_TIMESTAMP ON UPDATE CURRENT_TIMESTAMP COMMENT '更新时间戳',
     UNIQUE KEY `uk_app_user_role` (`app_id`, `app_user_id`, `role_id`),
     KEY `idx_user_query` (`app_id`, `app_user_id`),
-    KEY `idx_role_query` (`role_id`)
+    KEY `idx_role_query` (`role_id`, `created_at`)  -- GetRoleUsers 按 (created_at, id) 游标分页
 ) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COMMENT='用户角色授权表';
 
 -- ----------------------------
@@ -114,7 +114,7 @@ CREATE TABLE `sys_user_roles` (
 -- ----------------------------
 DROP TABLE IF EXISTS `sys_audit_logs`;
 CREATE TABLE `sys_audit_logs` (
-    `id` BIGINT PRIMARY KEY AUTO_INCREMENT COMMENT '日志ID',
+    `id` BIGINT NOT NULL AUTO_INCREMENT COMMENT '日志ID',
     
     -- 操作者 (who)
     `operator_id` BIGINT NOT NULL COMMENT '管理员ID 关联sys_console_users.id',
@@ -136,14 +136,40 @@ CREATE TABLE `sys_audit_logs` (
     `object_id` VARCHAR(128) COMMENT '关联对象ID 角色ID/权限ID',
     `object_name` VARCHAR(64) COMMENT '关联对象名称（冗余）',
     
-    `created_at` DATETIME DEFAULT CURRENT_TIMESTAMP COMMENT '创建时间戳',
+    `created_at` DATETIME NOT NULL DEFAULT CURRENT_TIMESTAMP COMMENT '创建时间戳',
     
-    KEY `idx_operator` (`operator_id`),
-    KEY `idx_target` (`target_id`),
-    KEY `idx_app_code` (`app_code`),
-    KEY `idx_action` (`action`),
+    -- 分区表的主键必须包含分区键
+    PRIMARY KEY (`id`, `created_at`),
+    -- 各筛选条件的索引都带上 created_at（InnoDB 二级索引隐含主键 id），
+    -- ListAuditLogs 按 (created_at, id) 游标分页时可以直接沿索引 seek
+    KEY `idx_operator` (`operator_id`, `created_at`),
+    KEY `idx_target` (`target_id`, `created_at`),
+    KEY `idx_app_code` (`app_code`, `created_at`),
+    KEY `idx_action` (`action`, `created_at`),
     KEY `idx_created_at` (`created_at`)
-) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COMMENT='操作审计日志表';
+) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COMMENT='操作审计日志表'
+-- 按月分区：每个分区只维护自己的索引，写入代价不随历史数据增长；
+-- 服务端后台任务会提前从 pmax 拆出后续月份的分区 (pYYYYMM)，并把过期分区归档到本地文件后 DROP
+PARTITION BY RANGE COLUMNS(`created_at`) (
+    PARTITION `p_history` VALUES LESS THAN ('2026-01-01 00:00:00'),
+    PARTITION `pmax` VALUES LESS THAN (MAXVALUE)
+);
+
+-- ----------------------------
+-- 8. 权限变更日志（AuthService.Watch 的推送源）
+-- ----------------------------
+DROP TABLE IF EXISTS `sys_change_log`;
+CREATE TABLE `sys_change_log` (
+    `seq` BIGINT NOT NULL AUTO_INCREMENT COMMENT '全局递增序号，订阅方据此断点续传',
+    `app_code` VARCHAR(32) NOT NULL COMMENT '系统代号',
+    `event_type` TINYINT NOT NULL COMMENT '变更类型 见 auth.proto ChangeEvent.Type',
+    `user_id` VARCHAR(128) NOT NULL DEFAULT '' COMMENT '业务系统用户ID（授权/撤销）',
+    `role_key` VARCHAR(32) NOT NULL DEFAULT '' COMMENT '角色标识',
+    `perm_key` VARCHAR(64) NOT NULL DEFAULT '' COMMENT '权限标识',
+    `created_at` DATETIME NOT NULL DEFAULT CURRENT_TIMESTAMP COMMENT '创建时间戳',
+    PRIMARY KEY (`seq`),
+    KEY `idx_created_at` (`created_at`)  -- 按保留时长清理
+) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COMMENT='权限变更日志';
 
 -- ----------------------------
 -- 初始化数据：内置超级管理员（密码需后续修改）
@@ -156,6 +182,7 @@ VALUES (1, 'admin', '$6$saltsalt$R/al3WpzpwnOAjyk4icGxW6fCRaUtE6kNJnAakHs220z43Y
 -- 清空并重置测试数据
 -- ----------------------------
 TRUNCATE TABLE `sys_audit_logs`;
+TRUNCATE TABLE `sys_change_log`;
 TRUNCATE TABLE `sys_user_roles`;
 TRUNCATE TABLE `sys_role_permissions`;
 TRUNCATE TABLE `sys_roles`;
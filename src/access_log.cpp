@@ -0,0 +1,290 @@
+#include "access_log.h"
+#include <butil/fast_rand.h>
+#include <butil/logging.h>
+#include <butil/time.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+
+namespace {
+
+const uint64_t kSampleScale = 1000000;
+const char kBinaryMagic[8] = {'S', 'Q', 'A', 'C', 'L', 'O', 'G', '1'};
+// 后台线程检查文件是否被轮转的间隔
+const int64_t kRotateCheckIntervalUs = 1000000;
+
+std::atomic<uint64_t> g_next_log_id{1};
+
+// 本线程最近使用的缓冲区；log_id 不匹配时（另一个实例或实例已重建）回到慢路径查找
+struct LocalSlot {
+    uint64_t log_id = 0;
+    void* buffer = nullptr;
+};
+thread_local LocalSlot t_slot;
+
+uint64_t SampleThreshold(double rate) {
+    if (rate <= 0) return 0;
+    if (rate >= 1) return kSampleScale;
+    return static_cast<uint64_t>(rate * kSampleScale);
+}
+
+void CopyField(char* dst, size_t size, const std::string& src) {
+    size_t n = std::min(src.size(), size - 1);
+    memcpy(dst, src.data(), n);
+    dst[n] = '\0';
+}
+
+void AppendJsonString(std::string& out, const char* s) {
+    out += '"';
+    for (; *s; ++s) {
+        unsigned char c = static_cast<unsigned char>(*s);
+        switch (c) {
+        case '"': out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n"; break;
+        case '\r': out += "\\r"; break;
+        case '\t': out += "\\t"; break;
+        default:
+            if (c < 0x20) {
+                char buf[8];
+                snprintf(buf, sizeof(buf), "\\u%04x", c);
+                out += buf;
+            } else {
+                out += static_cast<char>(c);
+            }
+        }
+    }
+    out += '"';
+}
+
+} // namespace
+
+AccessLog::AccessLog(const Options& options)
+    : id_(g_next_log_id.fetch_add(1)),
+      options_(options),
+      binary_(options.format == "binary"),
+      allow_threshold_(SampleThreshold(options.allow_sample_rate)),
+      deny_threshold_(SampleThreshold(options.deny_sample_rate)),
+      capacity_(1),
+      written_("access_log_written"),
+      dropped_("access_log_dropped"),
+      write_errors_("access_log_write_errors") {
+    while (capacity_ < std::max<size_t>(options_.buffer_records, 2)) {
+        capacity_ <<= 1;
+    }
+    if (options_.path.empty()) {
+        return;
+    }
+    OpenFile();
+    if (!file_) {
+        return;
+    }
+    enabled_ = true;
+    flusher_ = std::thread(&AccessLog::FlushLoop, this);
+}
+
+AccessLog::~AccessLog() {
+    {
+        std::lock_guard<std::mutex> lock(flush_mutex_);
+        stopping_ = true;
+    }
+    flush_cond_.notify_all();
+    if (flusher_.joinable()) {
+        flusher_.join();
+    }
+    if (file_) {
+        Drain();
+        fclose(file_);
+    }
+}
+
+bool AccessLog::Sampled(bool allowed) const {
+    if (!enabled_) {
+        return false;
+    }
+    uint64_t threshold = allowed ? allow_threshold_ : deny_threshold_;
+    if (threshold >= kSampleScale) return true;
+    if (threshold == 0) return false;
+    return butil::fast_rand_less_than(kSampleScale) < threshold;
+}
+
+AccessLog::ThreadBuffer* AccessLog::LocalBuffer() {
+    if (t_slot.log_id == id_) {
+        return static_cast<ThreadBuffer*>(t_slot.buffer);
+    }
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    std::unique_ptr<ThreadBuffer>& buffer = buffers_[std::this_thread::get_id()];
+    if (!buffer) {
+        buffer.reset(new ThreadBuffer(capacity_));
+        buffer_list_.push_back(buffer.get());
+    }
+    t_slot.log_id = id_;
+    t_slot.buffer = buffer.get();
+    return buffer.get();
+}
+
+void AccessLog::Append(Method method, const std::string& app_code, const std::string& user_id,
+                       const std::string& perm_key, bool allowed, bool cache_hit, const char* reason,
+                       int32_t items, int32_t denied, int64_t latency_us) {
+    if (!enabled_) {
+        return;
+    }
+    ThreadBuffer* buffer = LocalBuffer();
+    uint64_t head = buffer->head.load(std::memory_order_relaxed);
+    uint64_t used = head - buffer->tail.load(std::memory_order_acquire);
+    if (used > buffer->mask) {
+        dropped_ << 1;
+        return;
+    }
+    Record& rec = buffer->records[head & buffer->mask];
+    rec.time_us = butil::gettimeofday_us();
+    rec.latency_us = latency_us;
+    rec.method = method;
+    rec.allowed = allowed ? 1 : 0;
+    rec.cache_hit = cache_hit ? 1 : 0;
+    rec.reserved = 0;
+    rec.items = items;
+    rec.denied = denied;
+    CopyField(rec.app_code, sizeof(rec.app_code), app_code);
+    CopyField(rec.user_id, sizeof(rec.user_id), user_id);
+    CopyField(rec.perm_key, sizeof(rec.perm_key), perm_key);
+    CopyField(rec.reason, sizeof(rec.reason), reason ? reason : "");
+    buffer->head.store(head + 1, std::memory_order_release);
+    // 突发流量下不必等满一个刷盘周期：缓冲区过半时提前唤醒后台线程
+    // 不持锁通知，偶尔错过的唤醒由定时刷盘兜底
+    if (used == (buffer->mask + 1) / 2) {
+        flush_requested_.store(true, std::memory_order_relaxed);
+        flush_cond_.notify_one();
+    }
+}
+
+void AccessLog::FlushLoop() {
+    int64_t last_rotate_check_us = butil::monotonic_time_us();
+    std::unique_lock<std::mutex> lock(flush_mutex_);
+    while (!stopping_) {
+        flush_cond_.wait_for(lock, std::chrono::milliseconds(options_.flush_interval_ms), [this] {
+            return stopping_ || flush_requested_.load(std::memory_order_relaxed);
+        });
+        if (stopping_) break;
+        flush_requested_.store(false, std::memory_order_relaxed);
+        lock.unlock();
+        int64_t now_us = butil::monotonic_time_us();
+        if (now_us - last_rotate_check_us >= kRotateCheckIntervalUs) {
+            ReopenIfRotated();
+            last_rotate_check_us = now_us;
+        }
+        Drain();
+        lock.lock();
+    }
+}
+
+size_t AccessLog::Drain() {
+    std::vector<ThreadBuffer*> buffers;
+    {
+        std::lock_guard<std::mutex> lock(buffers_mutex_);
+        buffers = buffer_list_;
+    }
+    size_t count = 0;
+    write_buf_.clear();
+    for (ThreadBuffer* buffer : buffers) {
+        uint64_t tail = buffer->tail.load(std::memory_order_relaxed);
+        uint64_t head = buffer->head.load(std::memory_order_acquire);
+        for (; tail != head; ++tail) {
+            const Record& rec = buffer->records[tail & buffer->mask];
+            if (binary_) {
+                write_buf_.append(reinterpret_cast<const char*>(&rec), sizeof(rec));
+            } else {
+                FormatJson(rec, write_buf_);
+            }
+            ++count;
+        }
+        buffer->tail.store(head, std::memory_order_release);
+    }
+    if (count == 0 || !file_) {
+        return count;
+    }
+    if (fwrite(write_buf_.data(), 1, write_buf_.size(), file_) != write_buf_.size() || fflush(file_) != 0) {
+        write_errors_ << 1;
+    } else {
+        written_ << static_cast<int64_t>(count);
+    }
+    return count;
+}
+
+void AccessLog::FormatJson(const Record& rec, std::string& out) {
+    // 同一秒内的记录复用已格式化的日期部分，localtime_r 每秒只调用一次
+    int64_t seconds = rec.time_us / 1000000;
+    if (seconds != formatted_second_) {
+        time_t t = static_cast<time_t>(seconds);
+        struct tm tm_buf;
+        localtime_r(&t, &tm_buf);
+        strftime(second_buf_, sizeof(second_buf_), "%Y-%m-%d %H:%M:%S", &tm_buf);
+        formatted_second_ = seconds;
+    }
+    char usec_buf[8];
+    snprintf(usec_buf, sizeof(usec_buf), ".%06d", static_cast<int>(rec.time_us % 1000000));
+
+    out += "{\"time\":\"";
+    out += second_buf_;
+    out += usec_buf;
+    out += "\",\"method\":\"";
+    out += rec.method == kBatchCheck ? "BatchCheck" : "Check";
+    out += "\",\"app\":";
+    AppendJsonString(out, rec.app_code);
+    if (rec.method == kCheck) {
+        out += ",\"user\":";
+        AppendJsonString(out, rec.user_id);
+        out += ",\"perm\":";
+        AppendJsonString(out, rec.perm_key);
+        out += rec.cache_hit ? ",\"cache_hit\":true" : ",\"cache_hit\":false";
+    } else {
+        out += ",\"items\":" + std::to_string(rec.items);
+        out += ",\"denied\":" + std::to_string(rec.denied);
+    }
+    out += rec.allowed ? ",\"allowed\":true" : ",\"allowed\":false";
+    if (rec.reason[0]) {
+        out += ",\"reason\":";
+        AppendJsonString(out, rec.reason);
+    }
+    out += ",\"latency_us\":" + std::to_string(rec.latency_us);
+    out += "}\n";
+}
+
+void AccessLog::OpenFile() {
+    file_ = fopen(options_.path.c_str(), "a");
+    if (!file_) {
+        LOG(ERROR) << "无法打开访问日志 " << options_.path << ": " << strerror(errno);
+        return;
+    }
+    struct stat st;
+    bool empty = true;
+    if (fstat(fileno(file_), &st) == 0) {
+        file_inode_ = st.st_ino;
+        empty = st.st_size == 0;
+    }
+    if (binary_ && empty) {
+        uint32_t record_size = sizeof(Record);
+        fwrite(kBinaryMagic, 1, sizeof(kBinaryMagic), file_);
+        fwrite(&record_size, 1, sizeof(record_size), file_);
+        fflush(file_);
+    }
+}
+
+void AccessLog::ReopenIfRotated() {
+    struct stat st;
+    if (stat(options_.path.c_str(), &st) == 0 && st.st_ino == file_inode_) {
+        return;
+    }
+    // 先写完旧文件中的记录，再切换到新文件
+    Drain();
+    FILE* old = file_;
+    OpenFile();
+    if (!file_) {
+        // 新文件打不开时继续写旧文件，下次检查再重试
+        file_ = old;
+        return;
+    }
+    fclose(old);
+}
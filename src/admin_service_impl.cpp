@@ -1,19 +1,102 @@
 #include "admin_service_impl.h"
 #include <brpc/controller.h>
+#include <butil/base64.h>
+#include <butil/endpoint.h>
 #include <gflags/gflags.h>
 #include <unistd.h>
 #include <crypt.h>
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
 #include <random>
 #include <sstream>
 
-AdminServiceImpl::AdminServiceImpl(std::shared_ptr<LocalCache<std::unordered_set<std::string>>> cache,
+namespace {
+
+// 游标分页的 page_token：对客户端不透明，内容为 "created_at\nid\nkey" 的 base64
+std::string EncodePageToken(const PermissionStore::PageCursor& cursor) {
+    std::string token;
+    butil::Base64Encode(cursor.created_at + "\n" + std::to_string(cursor.id) + "\n" + cursor.key, &token);
+    return token;
+}
+
+// 空串表示游标分页的首页
+bool DecodePageToken(const std::string& token, PermissionStore::PageCursor& cursor, bool& first_page) {
+    first_page = token.empty();
+    if (first_page) {
+        return true;
+    }
+    std::string raw;
+    if (!butil::Base64Decode(token, &raw)) {
+        return false;
+    }
+    size_t p1 = raw.find('\n');
+    size_t p2 = p1 == std::string::npos ? std::string::npos : raw.find('\n', p1 + 1);
+    if (p2 == std::string::npos) {
+        return false;
+    }
+    cursor.created_at = raw.substr(0, p1);
+    cursor.key = raw.substr(p2 + 1);
+    char* end = nullptr;
+    std::string id_str = raw.substr(p1 + 1, p2 - p1 - 1);
+    cursor.id = std::strtoll(id_str.c_str(), &end, 10);
+    return !id_str.empty() && *end == '\0';
+}
+
+// TOTAL_DEFAULT：偏移分页保持原来的精确计数，游标分页默认不计数
+PermissionStore::TotalMode ToTotalMode(siqi::auth::TotalMode mode, bool cursor) {
+    switch (mode) {
+        case siqi::auth::TOTAL_EXACT: return PermissionStore::TotalMode::kExact;
+        case siqi::auth::TOTAL_ESTIMATE: return PermissionStore::TotalMode::kEstimate;
+        case siqi::auth::TOTAL_NONE: return PermissionStore::TotalMode::kNone;
+        default: return cursor ? PermissionStore::TotalMode::kNone : PermissionStore::TotalMode::kExact;
+    }
+}
+
+} // namespace
+
+AdminServiceImpl::AdminServiceImpl(std::shared_ptr<PermCache> cache,
                                    const std::string& host,
                                    int port,
                                    const std::string& user,
                                    const std::string& password,
                                    const std::string& database,
-                                   int session_ttl)
-    : dao_(host, port, user, password, database), cache_(cache), session_ttl_(session_ttl) {
+                                   int session_ttl,
+                                   std::shared_ptr<AppCatalog> app_catalog,
+                                   const AuditWriter::Options& audit_options,
+                                   const AuditArchive::Options& archive_options,
+                                   const std::string& token_key,
+                                   const AdminLoginOptions& login_options,
+                                   std::shared_ptr<CacheInvalidator> invalidator)
+    : AdminServiceImpl(cache,
+                       std::make_shared<PermissionDAO>(host, port, user, password, database, app_catalog),
+                       session_ttl, audit_options, archive_options, token_key, login_options,
+                       invalidator ? invalidator
+                                   : std::make_shared<CacheInvalidator>(cache, app_catalog, CacheInvalidator::Options())) {
+}
+
+AdminServiceImpl::AdminServiceImpl(std::shared_ptr<PermCache> cache,
+                                   std::shared_ptr<PermissionStore> store,
+                                   int session_ttl,
+                                   const AuditWriter::Options& audit_options,
+                                   const AuditArchive::Options& archive_options,
+                                   const std::string& token_key,
+                                   const AdminLoginOptions& login_options,
+                                   std::shared_ptr<CacheInvalidator> invalidator)
+    : dao_(store), cache_(cache), session_ttl_(session_ttl),
+      invalidator_(invalidator ? invalidator
+                               : std::make_shared<CacheInvalidator>(cache, nullptr, CacheInvalidator::Options())),
+      audit_writer_(new AuditWriter(dao_.get(), audit_options)),
+      audit_archive_(new AuditArchive(dao_.get(), archive_options)),
+      login_user_limiter_(login_options.user_per_min, login_options.user_per_min),
+      login_ip_limiter_(login_options.ip_per_min, login_options.ip_per_min) {
+    if (!token_key.empty()) {
+        token_signer_.reset(new SessionTokenSigner(token_key));
+    }
+    if (login_options.threads > 0) {
+        // 队列为 0 时 Submit 永远失败，所有登录都会 503
+        login_executor_.reset(new DBExecutor(login_options.threads, std::max<size_t>(login_options.queue_size, 1)));
+    }
 }
 
 bool AdminServiceImpl::ValidateToken(brpc::Controller* cntl, SessionInfo& session) {
@@ -24,12 +107,23 @@ bool AdminServiceImpl::ValidateToken(brpc::Controller* cntl, SessionInfo& sessio
         return false;
     }
     
-    std::string header_val = *auth_header;
-    if (header_val.find("Bearer ") != 0) {
+    if (auth_header->compare(0, 7, "Bearer ") != 0) {
         return false;
     }
+
+    if (token_signer_) {
+        // 签名 Token：本地验签即可，不查会话表，任意实例签发的 Token 都能通过
+        SessionTokenSigner::Claims claims;
+        if (!token_signer_->Verify(auth_header->data() + 7, auth_header->size() - 7, time(nullptr), claims)) {
+            return false;
+        }
+        session.user_id = claims.user_id;
+        session.username = std::move(claims.username);
+        session.real_name = std::move(claims.real_name);
+        return true;
+    }
     
-    std::string token = header_val.substr(7);
+    std::string token = auth_header->substr(7);
     bool found = session_cache_.Get(token, session);
     
     if (!found || session.username.empty()) {
@@ -60,18 +154,18 @@ void AdminServiceImpl::CreateApp(google::protobuf::RpcController* cntl_base,
     }
     
     std::string app_secret;
-    if (dao_.createApp(request->app_name(), request->app_code(), request->description(), app_secret)) {
+    if (dao_->createApp(request->app_name(), request->app_code(), request->description(), app_secret)) {
         response->set_success(true);
         response->set_code(0);
         response->set_message("创建应用成功");
         response->set_app_secret(app_secret);
         
-        dao_.createAuditLog(session.user_id, session.real_name, request->app_code(), 
-                            "CREATE_APP", "APP", request->app_code(), request->app_name());
+        audit_writer_->Log(session.user_id, session.real_name, request->app_code(), 
+                           "CREATE_APP", "APP", request->app_code(), request->app_name());
     } else {
         response->set_success(false);
         response->set_code(1001);
-        response->set_message("创建应用失败: " + dao_.getLastError());
+        response->set_message("创建应用失败: " + dao_->getLastError());
     }
 }
 
@@ -106,17 +200,20 @@ void AdminServiceImpl::UpdateApp(google::protobuf::RpcController* cntl_base,
         status = &status_val;
     }
     
-    if (dao_.updateApp(request->app_code(), app_name, description, status)) {
+    if (dao_->updateApp(request->app_code(), app_name, description, status)) {
         response->set_success(true);
         response->set_code(0);
         response->set_message("更新应用成功");
+
+        // 状态变化影响所有副本的应用目录与权限缓存
+        invalidator_->InvalidateApp(request->app_code());
         
-        dao_.createAuditLog(session.user_id, session.real_name, request->app_code(), 
-                            "UPDATE_APP", "APP", request->app_code());
+        audit_writer_->Log(session.user_id, session.real_name, request->app_code(), 
+                           "UPDATE_APP", "APP", request->app_code());
     } else {
         response->set_success(false);
         response->set_code(1001);
-        response->set_message("更新应用失败: " + dao_.getLastError());
+        response->set_message("更新应用失败: " + dao_->getLastError());
     }
 }
 
@@ -141,17 +238,19 @@ void AdminServiceImpl::DeleteApp(google::protobuf::RpcController* cntl_base,
         return;
     }
     
-    if (dao_.deleteApp(request->app_code())) {
+    if (dao_->deleteApp(request->app_code())) {
         response->set_success(true);
         response->set_code(0);
         response->set_message("删除应用成功");
+
+        invalidator_->InvalidateApp(request->app_code());
         
-        dao_.createAuditLog(session.user_id, session.real_name, request->app_code(), 
-                            "DELETE_APP", "APP", request->app_code());
+        audit_writer_->Log(session.user_id, session.real_name, request->app_code(), 
+                           "DELETE_APP", "APP", request->app_code());
     } else {
         response->set_success(false);
         response->set_code(1001);
-        response->set_message("删除应用失败: " + dao_.getLastError());
+        response->set_message("删除应用失败: " + dao_->getLastError());
     }
 }
 
@@ -173,8 +272,8 @@ void AdminServiceImpl::GetApp(google::protobuf::RpcController* cntl_base,
         return;
     }
     
-    PermissionDAO::AppInfo app;
-    if (dao_.getApp(request->app_code(), app)) {
+    PermissionStore::AppInfo app;
+    if (dao_->getApp(request->app_code(), app)) {
         response->set_id(app.id);
         response->set_app_name(app.app_name);
         response->set_app_code(app.app_code);
@@ -214,7 +313,7 @@ void AdminServiceImpl::ListApps(google::protobuf::RpcController* cntl_base,
     }
     
     int64_t total = 0;
-    auto apps = dao_.listApps(page, page_size, app_name, status, total);
+    auto apps = dao_->listApps(page, page_size, app_name, status, total);
     
     for (const auto& app : apps) {
         auto* app_resp = response->add_apps();
@@ -247,9 +346,6 @@ void AdminServiceImpl::GrantRoleToUser(google::protobuf::RpcController* cntl_bas
         return;
     }
     
-    // 缓存失效处理
-    if (cache_) cache_->Invalidate(request->app_code() + ":" + request->user_id());
-
     // 参数校验
     if (request->app_code().empty() || 
         request->user_id().empty() || request->role_key().empty()) {
@@ -260,22 +356,25 @@ void AdminServiceImpl::GrantRoleToUser(google::protobuf::RpcController* cntl_bas
     }
     
     // 执行操作
-    if (dao_.assignRoleToUser(request->app_code(), request->user_id(), request->role_key())) {
+    if (dao_->assignRoleToUser(request->app_code(), request->user_id(), request->role_key())) {
         response->set_success(true);
         response->set_code(0);
         response->set_message("授权成功");
+
+        // 写库成功后再失效缓存（含其他副本），避免失效早于提交时被并发的 Check 回填旧数据
+        invalidator_->InvalidateKey(request->app_code() + ":" + request->user_id());
         
         // 审计日志
-        dao_.createAuditLog(session.user_id, 
-                            session.real_name,
-                            request->app_code(), 
-                            "USER_GRANT_ROLE", 
-                            "USER", request->user_id(), "", 
-                            "ROLE", request->role_key(), "");
+        audit_writer_->Log(session.user_id, 
+                           session.real_name,
+                           request->app_code(), 
+                           "USER_GRANT_ROLE", 
+                           "USER", request->user_id(), "", 
+                           "ROLE", request->role_key(), "");
     } else {
         response->set_success(false);
         response->set_code(1001); // 业务错误码
-        response->set_message("授权失败: " + dao_.getLastError());
+        response->set_message("授权失败: " + dao_->getLastError());
     }
 }
 
@@ -293,9 +392,6 @@ void AdminServiceImpl::RevokeRoleFromUser(google::protobuf::RpcController* cntl_
         return;
     }
     
-    // 缓存失效处理
-    if (cache_) cache_->Invalidate(request->app_code() + ":" + request->user_id());
-
     if (request->app_code().empty() || 
         request->user_id().empty() || request->role_key().empty()) {
         response->set_success(false);
@@ -303,20 +399,125 @@ void AdminServiceImpl::RevokeRoleFromUser(google::protobuf::RpcController* cntl_
         return;
     }
     
-    if (dao_.removeRoleFromUser(request->app_code(), request->user_id(), request->role_key())) {
+    if (dao_->removeRoleFromUser(request->app_code(), request->user_id(), request->role_key())) {
         response->set_success(true);
         response->set_message("撤销成功");
+
+        invalidator_->InvalidateKey(request->app_code() + ":" + request->user_id());
         
-        dao_.createAuditLog(session.user_id, session.real_name, request->app_code(), 
-                            "USER_REVOKE_ROLE", 
-                            "USER", request->user_id(), "", 
-                            "ROLE", request->role_key(), "");
+        audit_writer_->Log(session.user_id, session.real_name, request->app_code(), 
+                           "USER_REVOKE_ROLE", 
+                           "USER", request->user_id(), "", 
+                           "ROLE", request->role_key(), "");
     } else {
         response->set_success(false);
-        response->set_message("撤销失败: " + dao_.getLastError());
+        response->set_message("撤销失败: " + dao_->getLastError());
     }
 }
 
+void AdminServiceImpl::BatchGrantRoles(google::protobuf::RpcController* cntl_base,
+                                       const siqi::auth::BatchGrantRolesRequest* request,
+                                       siqi::auth::AdminResponse* response,
+                                       google::protobuf::Closure* done) {
+    brpc::ClosureGuard done_guard(done);
+    brpc::Controller* cntl = static_cast<brpc::Controller*>(cntl_base);
+
+    SessionInfo session;
+    if (!ValidateToken(cntl, session)) {
+        response->set_success(false);
+        response->set_message("Unauthorized: Login required");
+        return;
+    }
+
+    DoBatchRoles(session, request->app_code(), request->user_ids(), request->role_keys(), true, response);
+}
+
+void AdminServiceImpl::BatchRevokeRoles(google::protobuf::RpcController* cntl_base,
+                                        const siqi::auth::BatchRevokeRolesRequest* request,
+                                        siqi::auth::AdminResponse* response,
+                                        google::protobuf::Closure* done) {
+    brpc::ClosureGuard done_guard(done);
+    brpc::Controller* cntl = static_cast<brpc::Controller*>(cntl_base);
+
+    SessionInfo session;
+    if (!ValidateToken(cntl, session)) {
+        response->set_success(false);
+        response->set_message("Unauthorized: Login required");
+        return;
+    }
+
+    DoBatchRoles(session, request->app_code(), request->user_ids(), request->role_keys(), false, response);
+}
+
+void AdminServiceImpl::DoBatchRoles(const SessionInfo& session,
+                                    const std::string& app_code,
+                                    const google::protobuf::RepeatedPtrField<std::string>& user_ids,
+                                    const google::protobuf::RepeatedPtrField<std::string>& role_keys,
+                                    bool grant,
+                                    siqi::auth::AdminResponse* response) {
+    // 参数校验
+    if (app_code.empty() || user_ids.empty() || role_keys.empty()) {
+        response->set_success(false);
+        response->set_code(EINVAL);
+        response->set_message("缺少必要参数");
+        return;
+    }
+    for (const auto& uid : user_ids) {
+        if (uid.empty()) {
+            response->set_success(false);
+            response->set_code(EINVAL);
+            response->set_message("用户ID不能为空");
+            return;
+        }
+    }
+
+    std::vector<std::string> users(user_ids.begin(), user_ids.end());
+    std::vector<std::string> roles(role_keys.begin(), role_keys.end());
+
+    int64_t affected = grant ? dao_->batchAssignRoles(app_code, users, roles)
+                             : dao_->batchRemoveRoles(app_code, users, roles);
+    if (affected < 0) {
+        response->set_success(false);
+        response->set_code(1001); // 业务错误码
+        response->set_message(std::string(grant ? "批量授权失败: " : "批量撤销失败: ") + dao_->getLastError());
+        return;
+    }
+
+    // 缓存失效：事务提交后一次性移除所有受影响用户（同时推送给其他副本）
+    std::vector<std::string> keys;
+    keys.reserve(users.size());
+    for (const auto& uid : users) {
+        keys.push_back(app_code + ":" + uid);
+    }
+    invalidator_->InvalidateKeys(keys);
+
+    // 审计日志：每个 (用户, 角色) 一条，与单条授权的记录格式保持一致，批量写入
+    std::vector<PermissionStore::AuditLogInfo> logs;
+    logs.reserve(users.size() * roles.size());
+    for (const auto& uid : users) {
+        for (const auto& role_key : roles) {
+            PermissionStore::AuditLogInfo log;
+            log.operator_id = session.user_id;
+            log.operator_name = session.real_name;
+            log.app_code = app_code;
+            log.action = grant ? "USER_GRANT_ROLE" : "USER_REVOKE_ROLE";
+            log.target_type = "USER";
+            log.target_id = uid;
+            log.object_type = "ROLE";
+            log.object_id = role_key;
+            logs.push_back(log);
+        }
+    }
+    audit_writer_->Append(std::move(logs));
+
+    response->set_success(true);
+    response->set_code(0);
+    response->set_affected(affected);
+    response->set_message(std::string(grant ? "批量授权成功" : "批量撤销成功") +
+                          ", 用户数: " + std::to_string(users.size()) +
+                          ", 影响行数: " + std::to_string(affected));
+}
+
 void AdminServiceImpl::AddPermissionToRole(google::protobuf::RpcController* cntl_base,
                                            const siqi::auth::AddPermissionToRoleRequest* request,
                                            siqi::auth::AdminResponse* response,
@@ -331,29 +532,29 @@ void AdminServiceImpl::AddPermissionToRole(google::protobuf::RpcController* cntl
         return;
     }
     
-    // 缓存失效处理:
-    // 角色权限变更会影响所有拥有该角色的用户。
-    // 由于我们无法反向查找哪些用户拥有此角色，因此失效该 App 下的所有用户缓存。
-    // 这种操作频率较低（仅在管理员配置时），因此 O(N) 的遍历清理是可以接受的。
-    if (cache_) cache_->InvalidatePrefix(request->app_code() + ":");
-
     if (request->app_code().empty() || request->role_key().empty() || request->perm_key().empty()) {
         response->set_success(false);
         response->set_message("缺少必要参数");
         return;
     }
     
-    if (dao_.addPermissionToRole(request->app_code(), request->role_key(), request->perm_key())) {
+    if (dao_->addPermissionToRole(request->app_code(), request->role_key(), request->perm_key())) {
         response->set_success(true);
         response->set_message("绑定成功");
+
+        // 缓存失效处理:
+        // 角色权限变更会影响所有拥有该角色的用户。
+        // 由于我们无法反向查找哪些用户拥有此角色，因此失效该 App 下的所有用户缓存。
+        // 这种操作频率较低（仅在管理员配置时），因此 O(N) 的遍历清理是可以接受的。
+        invalidator_->InvalidatePrefix(request->app_code() + ":");
         
-        dao_.createAuditLog(session.user_id, session.real_name, request->app_code(), 
-                            "ROLE_ADD_PERM", 
-                            "ROLE", request->role_key(), "", 
-                            "PERM", request->perm_key(), "");
+        audit_writer_->Log(session.user_id, session.real_name, request->app_code(), 
+                           "ROLE_ADD_PERM", 
+                           "ROLE", request->role_key(), "", 
+                           "PERM", request->perm_key(), "");
     } else {
         response->set_success(false);
-        response->set_message("绑定失败: " + dao_.getLastError());
+        response->set_message("绑定失败: " + dao_->getLastError());
     }
 }
 
@@ -371,26 +572,26 @@ void AdminServiceImpl::RemovePermissionFromRole(google::protobuf::RpcController*
         return;
     }
     
-    // 缓存失效处理（同上）：清理该应用下的所有缓存
-    if (cache_) cache_->InvalidatePrefix(request->app_code() + ":");
-
     if (request->app_code().empty() || request->role_key().empty() || request->perm_key().empty()) {
         response->set_success(false);
         response->set_message("缺少必要参数");
         return;
     }
     
-    if (dao_.removePermissionFromRole(request->app_code(), request->role_key(), request->perm_key())) {
+    if (dao_->removePermissionFromRole(request->app_code(), request->role_key(), request->perm_key())) {
         response->set_success(true);
         response->set_message("解绑成功");
+
+        // 缓存失效处理（同上）：清理该应用下的所有缓存
+        invalidator_->InvalidatePrefix(request->app_code() + ":");
         
-        dao_.createAuditLog(session.user_id, session.real_name, request->app_code(), 
-                            "ROLE_REMOVE_PERM", 
-                            "ROLE", request->role_key(), "", 
-                            "PERM", request->perm_key(), "");
+        audit_writer_->Log(session.user_id, session.real_name, request->app_code(), 
+                           "ROLE_REMOVE_PERM", 
+                           "ROLE", request->role_key(), "", 
+                           "PERM", request->perm_key(), "");
     } else {
         response->set_success(false);
-        response->set_message("解绑失败: " + dao_.getLastError());
+        response->set_message("解绑失败: " + dao_->getLastError());
     }
 }
 
@@ -417,16 +618,16 @@ void AdminServiceImpl::CreateRole(google::protobuf::RpcController* cntl_base,
     // 默认值处理
     bool is_default = request->is_default();
     
-    if (dao_.createRole(request->app_code(), request->role_name(), request->role_key(), request->description(), is_default)) {
+    if (dao_->createRole(request->app_code(), request->role_name(), request->role_key(), request->description(), is_default)) {
         response->set_success(true);
         response->set_message("创建角色成功");
         
-        dao_.createAuditLog(session.user_id, session.real_name, request->app_code(), 
-                            "CREATE_ROLE", 
-                            "ROLE", request->role_key(), request->role_name());
+        audit_writer_->Log(session.user_id, session.real_name, request->app_code(), 
+                           "CREATE_ROLE", 
+                           "ROLE", request->role_key(), request->role_name());
     } else {
         response->set_success(false);
-        response->set_message("创建角色失败: " + dao_.getLastError());
+        response->set_message("创建角色失败: " + dao_->getLastError());
     }
 }
 
@@ -450,16 +651,16 @@ void AdminServiceImpl::CreatePermission(google::protobuf::RpcController* cntl_ba
         return;
     }
     
-    if (dao_.createPermission(request->app_code(), request->perm_name(), request->perm_key(), request->description())) {
+    if (dao_->createPermission(request->app_code(), request->perm_name(), request->perm_key(), request->description())) {
         response->set_success(true);
         response->set_message("创建权限成功");
         
-        dao_.createAuditLog(session.user_id, session.real_name, request->app_code(), 
-                            "CREATE_PERM", 
-                            "PERM", request->perm_key(), request->perm_name());
+        audit_writer_->Log(session.user_id, session.real_name, request->app_code(), 
+                           "CREATE_PERM", 
+                           "PERM", request->perm_key(), request->perm_name());
     } else {
         response->set_success(false);
-        response->set_message("创建权限失败: " + dao_.getLastError());
+        response->set_message("创建权限失败: " + dao_->getLastError());
     }
 }
 
@@ -483,16 +684,19 @@ void AdminServiceImpl::DeleteRole(google::protobuf::RpcController* cntl_base,
         return;
     }
     
-    if (dao_.deleteRole(request->app_code(), request->role_key())) {
+    if (dao_->deleteRole(request->app_code(), request->role_key())) {
         response->set_success(true);
         response->set_message("删除角色成功");
+
+        // 拥有该角色的用户权限随之变化，同样清理该应用下的所有缓存
+        invalidator_->InvalidatePrefix(request->app_code() + ":");
         
-        dao_.createAuditLog(session.user_id, session.real_name, request->app_code(), 
-                            "DELETE_ROLE", 
-                            "ROLE", request->role_key());
+        audit_writer_->Log(session.user_id, session.real_name, request->app_code(), 
+                           "DELETE_ROLE", 
+                           "ROLE", request->role_key());
     } else {
         response->set_success(false);
-        response->set_message(dao_.getLastError());
+        response->set_message(dao_->getLastError());
     }
 }
 
@@ -516,16 +720,18 @@ void AdminServiceImpl::DeletePermission(google::protobuf::RpcController* cntl_ba
         return;
     }
     
-    if (dao_.deletePermission(request->app_code(), request->perm_key())) {
+    if (dao_->deletePermission(request->app_code(), request->perm_key())) {
         response->set_success(true);
         response->set_message("删除权限成功");
+
+        invalidator_->InvalidatePrefix(request->app_code() + ":");
         
-        dao_.createAuditLog(session.user_id, session.real_name, request->app_code(), 
-                            "DELETE_PERM", 
-                            "PERM", request->perm_key());
+        audit_writer_->Log(session.user_id, session.real_name, request->app_code(), 
+                           "DELETE_PERM", 
+                           "PERM", request->perm_key());
     } else {
         response->set_success(false);
-        response->set_message(dao_.getLastError());
+        response->set_message(dao_->getLastError());
     }
 }
 
@@ -542,7 +748,7 @@ void AdminServiceImpl::ListRoles(google::protobuf::RpcController* cntl_base,
         return;
     }
     
-    auto roles = dao_.listRoles(request->app_code());
+    auto roles = dao_->listRoles(request->app_code());
     for (const auto& r : roles) {
         auto* role_pb = response->add_roles();
         role_pb->set_id(r.id);
@@ -572,7 +778,7 @@ void AdminServiceImpl::ListPermissions(google::protobuf::RpcController* cntl_bas
         return;
     }
     
-    auto perms = dao_.listPermissions(request->app_code());
+    auto perms = dao_->listPermissions(request->app_code());
     for (const auto& p : perms) {
         auto* perm_pb = response->add_permissions();
         perm_pb->set_id(p.id);
@@ -613,16 +819,16 @@ void AdminServiceImpl::UpdateRole(google::protobuf::RpcController* cntl_base,
         is_default = &is_default_val;
     }
     
-    if (dao_.updateRole(request->app_code(), request->role_key(), role_name, description, is_default)) {
+    if (dao_->updateRole(request->app_code(), request->role_key(), role_name, description, is_default)) {
         response->set_success(true);
         response->set_message("更新角色成功");
         
-        dao_.createAuditLog(session.user_id, session.real_name, request->app_code(), 
-                            "UPDATE_ROLE", 
-                            "ROLE", request->role_key());
+        audit_writer_->Log(session.user_id, session.real_name, request->app_code(), 
+                           "UPDATE_ROLE", 
+                           "ROLE", request->role_key());
     } else {
         response->set_success(false);
-        response->set_message(dao_.getLastError());
+        response->set_message(dao_->getLastError());
     }
 }
 
@@ -649,16 +855,16 @@ void AdminServiceImpl::UpdatePermission(google::protobuf::RpcController* cntl_ba
     const std::string* perm_name = request->has_perm_name() ? &request->perm_name() : nullptr;
     const std::string* description = request->has_description() ? &request->description() : nullptr;
     
-    if (dao_.updatePermission(request->app_code(), request->perm_key(), perm_name, description)) {
+    if (dao_->updatePermission(request->app_code(), request->perm_key(), perm_name, description)) {
         response->set_success(true);
         response->set_message("更新权限成功");
         
-        dao_.createAuditLog(session.user_id, session.real_name, request->app_code(), 
-                            "UPDATE_PERM", 
-                            "PERM", request->perm_key());
+        audit_writer_->Log(session.user_id, session.real_name, request->app_code(), 
+                           "UPDATE_PERM", 
+                           "PERM", request->perm_key());
     } else {
         response->set_success(false);
-        response->set_message(dao_.getLastError());
+        response->set_message(dao_->getLastError());
     }
 }
 
@@ -682,7 +888,7 @@ void AdminServiceImpl::GetRolePermissions(google::protobuf::RpcController* cntl_
         return;
     }
     
-    auto perms = dao_.getRolePermissions(request->app_code(), request->role_key());
+    auto perms = dao_->getRolePermissions(request->app_code(), request->role_key());
     for (const auto& perm : perms) {
         response->add_perm_keys(perm);
     }
@@ -708,9 +914,21 @@ void AdminServiceImpl::GetRoleUsers(google::protobuf::RpcController* cntl_base,
     
     int32_t page = request->page() > 0 ? request->page() : 1;
     int32_t page_size = request->page_size() > 0 ? request->page_size() : 10;
+
+    // 带 page_token 即为游标分页
+    bool cursor_mode = request->has_page_token();
+    PermissionStore::PageCursor after, next;
+    bool first_page = true;
+    if (cursor_mode && !DecodePageToken(request->page_token(), after, first_page)) {
+        cntl->http_response().set_status_code(brpc::HTTP_STATUS_BAD_REQUEST);
+        return;
+    }
     
     int64_t total = 0;
-    auto users = dao_.getRoleUsers(request->app_code(), request->role_key(), page, page_size, total);
+    auto users = dao_->getRoleUsers(request->app_code(), request->role_key(), page, page_size, total,
+                                   cursor_mode && !first_page ? &after : nullptr,
+                                   ToTotalMode(request->total_mode(), cursor_mode),
+                                   cursor_mode ? &next : nullptr);
     
     for (const auto& u : users) {
         auto* user = response->add_users();
@@ -721,6 +939,9 @@ void AdminServiceImpl::GetRoleUsers(google::protobuf::RpcController* cntl_base,
     response->set_total(total);
     response->set_page(page);
     response->set_page_size(page_size);
+    if (!next.created_at.empty()) {
+        response->set_next_page_token(EncodePageToken(next));
+    }
 }
 
 void AdminServiceImpl::ListUserRoles(google::protobuf::RpcController* cntl_base,
@@ -744,9 +965,22 @@ void AdminServiceImpl::ListUserRoles(google::protobuf::RpcController* cntl_base,
     int32_t page = request->page() > 0 ? request->page() : 1;
     int32_t page_size = request->page_size() > 0 ? request->page_size() : 20;
     const std::string* user_id = request->has_user_id() ? &request->user_id() : nullptr;
+
+    // 带 page_token 即为游标分页（按 user_id 升序）
+    bool cursor_mode = request->has_page_token();
+    PermissionStore::PageCursor after, next;
+    bool first_page = true;
+    if (cursor_mode && !DecodePageToken(request->page_token(), after, first_page)) {
+        cntl->http_response().set_status_code(brpc::HTTP_STATUS_BAD_REQUEST);
+        return;
+    }
     
     int64_t total = 0;
-    auto users = dao_.listUserRoles(request->app_code(), page, page_size, user_id, total);
+    // 游标分页的排序与偏移分页不同，首页也要走游标查询（空 key 即从头开始）
+    auto users = dao_->listUserRoles(request->app_code(), page, page_size, user_id, total,
+                                    cursor_mode ? &after : nullptr,
+                                    ToTotalMode(request->total_mode(), cursor_mode),
+                                    cursor_mode ? &next : nullptr);
     
     for (const auto& u : users) {
         auto* user_pb = response->add_users();
@@ -763,6 +997,9 @@ void AdminServiceImpl::ListUserRoles(google::protobuf::RpcController* cntl_base,
     response->set_total(total);
     response->set_page(page);
     response->set_page_size(page_size);
+    if (!next.key.empty()) {
+        response->set_next_page_token(EncodePageToken(next));
+    }
 }
 
 void AdminServiceImpl::Login(google::protobuf::RpcController* cntl_base,
@@ -770,18 +1007,50 @@ void AdminServiceImpl::Login(google::protobuf::RpcController* cntl_base,
                              siqi::auth::LoginResponse* response,
                              google::protobuf::Closure* done) {
     brpc::ClosureGuard done_guard(done);
+    brpc::Controller* cntl = static_cast<brpc::Controller*>(cntl_base);
     
-    std::string username = request->username();
-    std::string password = request->password();
-    
-    if (username.empty() || password.empty()) {
+    if (request->username().empty() || request->password().empty()) {
         response->set_success(false);
         response->set_message("用户名或密码为空");
         return;
     }
+
+    // 限流在 worker 中完成，被拒绝的请求不会进入密码校验
+    std::string client_ip = butil::ip2str(cntl->remote_side().ip).c_str();
+    if (!login_ip_limiter_.Allow(client_ip) || !login_user_limiter_.Allow(request->username())) {
+        cntl->http_response().set_status_code(429);  // Too Many Requests
+        response->set_success(false);
+        response->set_message("登录尝试过于频繁，请稍后再试");
+        LOG(WARNING) << "Login rate limited: " << request->username() << " from " << client_ip;
+        return;
+    }
+
+    if (login_executor_) {
+        google::protobuf::Closure* async_done = done_guard.release();
+        bool submitted = login_executor_->Submit([this, request, response, async_done]() {
+            brpc::ClosureGuard async_guard(async_done);
+            DoLogin(request, response);
+        });
+        if (submitted) {
+            return;
+        }
+        // 队列已满：直接拒绝，不退回同步执行，否则 crypt 仍会占满 worker
+        done_guard.reset(async_done);
+        cntl->http_response().set_status_code(brpc::HTTP_STATUS_SERVICE_UNAVAILABLE);
+        response->set_success(false);
+        response->set_message("登录请求过多，请稍后重试");
+        return;
+    }
+
+    DoLogin(request, response);
+}
+
+void AdminServiceImpl::DoLogin(const siqi::auth::LoginRequest* request, siqi::auth::LoginResponse* response) {
+    const std::string& username = request->username();
+    const std::string& password = request->password();
     
     // 1. Get User from DB
-    auto user_info = dao_.getConsoleUser(username);
+    auto user_info = dao_->getConsoleUser(username);
     if (user_info.id == -1) {
         response->set_success(false);
         response->set_message("用户不存在或密码错误");
@@ -793,18 +1062,39 @@ void AdminServiceImpl::Login(google::protobuf::RpcController* cntl_base,
     // 2. Verify Password using crypt
     // crypt(key, salt) -> hash
     // The salt is embedded in the hash itself (a$...)
-    char* calc_hash = crypt(password.c_str(), db_hash.c_str());
+    // crypt() 使用静态缓冲区，多个线程同时登录时结果会互相覆盖，这里用可重入的 crypt_r
+    static thread_local struct crypt_data crypt_buf;
+    crypt_buf.initialized = 0;
+    char* calc_hash = crypt_r(password.c_str(), db_hash.c_str(), &crypt_buf);
     if (calc_hash == NULL || db_hash != calc_hash) {
         response->set_success(false);
         response->set_message("用户不存在或密码错误");
         return;
     }
     
+    if (token_signer_) {
+        // 3'. 签发无状态签名 Token
+        SessionTokenSigner::Claims claims;
+        claims.user_id = user_info.id;
+        claims.username = user_info.username;
+        claims.real_name = user_info.real_name;
+        claims.expires_at = time(nullptr) + session_ttl_;
+
+        response->set_success(true);
+        response->set_message("登录成功");
+        response->set_token(token_signer_->Issue(claims));
+
+        LOG(INFO) << "User Logged In: " << username << " (ID: " << user_info.id << ") Signed token, expires in "
+                  << session_ttl_ << "s";
+        return;
+    }
+
     // 3. Generate Simple Token (UUID-like)
     // In production use proper session management / JWT
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    static std::uniform_int_distribution<> dis(0, 15);
+    // 登录可能在多个执行器线程中并发，随机数引擎按线程独立
+    static thread_local std::random_device rd;
+    static thread_local std::mt19937 gen(rd());
+    std::uniform_int_distribution<> dis(0, 15);
     std::stringstream ss;
     for (int i = 0; i < 32; i++) {
         const char* hex = "0123456789abcdef";
@@ -860,8 +1150,78 @@ void AdminServiceImpl::ListAuditLogs(google::protobuf::RpcController* cntl_base,
         end_time = &end_time_value;
     }
     
-    int64_t total = 0;
-    auto logs = dao_.listAuditLogs(page, page_size, app_code, action, operator_id, target_id, start_time, end_time, total);
+    // 带 page_token 即为游标分页
+    bool cursor_mode = request->has_page_token();
+    PermissionStore::PageCursor after, next;
+    bool first_page = true;
+    if (cursor_mode && !DecodePageToken(request->page_token(), after, first_page)) {
+        cntl->http_response().set_status_code(brpc::HTTP_STATUS_BAD_REQUEST);
+        return;
+    }
+    const PermissionStore::PageCursor* after_ptr = cursor_mode && !first_page ? &after : nullptr;
+    PermissionStore::TotalMode total_mode = ToTotalMode(request->total_mode(), cursor_mode);
+
+    // 早于 archived_before 的数据已归档到本地文件，热表只查此后的数据（MySQL 也只需扫描热分区）
+    const std::string archived_before = audit_archive_->HotLowerBound();
+    int64_t hot_start_value = 0;
+    const int64_t* hot_start = start_time;
+    bool skip_hot = false;
+    if (!archived_before.empty()) {
+        hot_start_value = AuditArchive::ParseTime(archived_before);
+        if (start_time) hot_start_value = std::max(hot_start_value, *start_time);
+        hot_start = &hot_start_value;
+        // 查询范围或游标已经完全落在归档中
+        skip_hot = (end_time && *end_time < hot_start_value) ||
+                   (after_ptr && after_ptr->created_at < archived_before);
+    }
+    auto query_hot = [&](int32_t p, int32_t ps, const PermissionStore::PageCursor* a,
+                         PermissionStore::TotalMode mode, int64_t& out_total) {
+        return dao_->listAuditLogs(p, ps, app_code, action, operator_id, target_id, hot_start, end_time,
+                                  out_total, a, mode);
+    };
+    
+    int64_t total = total_mode == PermissionStore::TotalMode::kNone ? -1 : 0;
+    std::vector<PermissionStore::AuditLogInfo> logs;
+    if (!skip_hot) {
+        logs = query_hot(page, page_size, after_ptr, total_mode, total);
+    } else if (after_ptr && total_mode != PermissionStore::TotalMode::kNone) {
+        query_hot(1, 1, nullptr, total_mode, total);
+    }
+
+    if (!archived_before.empty()) {
+        AuditArchive::Filter filter;
+        if (app_code) filter.app_code = *app_code;
+        if (action) filter.action = *action;
+        if (operator_id) filter.operator_id = *operator_id;
+        if (target_id) filter.target_id = *target_id;
+        if (start_time) filter.start_time = AuditArchive::FormatTime(*start_time);
+        if (end_time) filter.end_time = AuditArchive::FormatTime(*end_time);
+
+        // 热表取不满一页时继续流式扫描归档文件
+        if (logs.size() < static_cast<size_t>(page_size)) {
+            int64_t skip = 0;
+            if (!cursor_mode && logs.empty() && page > 1) {
+                // 偏移分页整页都落在归档中，需要热表的精确行数来换算归档内的偏移
+                int64_t hot_total = total;
+                if (skip_hot) {
+                    hot_total = 0;
+                } else if (total_mode != PermissionStore::TotalMode::kExact) {
+                    query_hot(1, 1, nullptr, PermissionStore::TotalMode::kExact, hot_total);
+                }
+                skip = std::max<int64_t>(0, static_cast<int64_t>(page - 1) * page_size - hot_total);
+            }
+            audit_archive_->Scan(filter, skip_hot ? after_ptr : nullptr, skip,
+                                 page_size - logs.size(), logs);
+        }
+        // 归档部分只有显式要求 TOTAL_EXACT 时才扫描计数，TOTAL_DEFAULT 取文件行数估算，避免每次翻页都解压全部归档
+        if (total_mode != PermissionStore::TotalMode::kNone) {
+            total += audit_archive_->Count(filter, request->total_mode() == siqi::auth::TOTAL_EXACT);
+        }
+    }
+    if (cursor_mode && logs.size() == static_cast<size_t>(page_size)) {
+        next.created_at = logs.back().created_at;
+        next.id = logs.back().id;
+    }
     
     for (const auto& l : logs) {
         auto* log = response->add_logs();
@@ -882,4 +1242,7 @@ void AdminServiceImpl::ListAuditLogs(google::protobuf::RpcController* cntl_base,
     response->set_total(total);
     response->set_page(page);
     response->set_page_size(page_size);
+    if (!next.created_at.empty()) {
+        response->set_next_page_token(EncodePageToken(next));
+    }
 }
@@ -1,14 +1,25 @@
 #include <brpc/channel.h>
+#include <brpc/callback.h>
 #include <gflags/gflags.h>
+#include <json2pb/json_to_pb.h>
+#include <json2pb/pb_to_json.h>
 #include <iostream>
 #include <fstream>
+#include <sstream>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
 #include "auth.pb.h"
 
 DEFINE_string(server, "127.0.0.1:8888", "服务器地址 (默认 127.0.0.1:8888)");
 DEFINE_string(op, "", "操作指令: \n"
                       "    [角色管理] create_role, update_role, delete_role, list_roles\n"
                       "    [权限管理] create_perm, update_perm, delete_perm, list_perms\n"
-                      "    [授权管理] grant_role, revoke_role, add_perm, remove_perm");
+                      "    [授权管理] grant_role, revoke_role, add_perm, remove_perm\n"
+                      "    [批量授权] batch_grant, batch_revoke\n"
+                      "    [导入导出] import, export");
 DEFINE_string(app, "qq_bot", "应用代号 (App Code)");
 DEFINE_string(user, "", "用户 ID (User ID)");
 DEFINE_string(role, "", "角色标识 Key (Role Key)");
@@ -17,9 +28,18 @@ DEFINE_string(name, "", "名称 (角色名或权限名)");
 DEFINE_string(desc, "", "描述信息");
 DEFINE_string(password, "", "登录密码");
 DEFINE_bool(is_default, false, "是否为默认角色");
+DEFINE_string(users_file, "", "批量操作的用户 ID 文件，每行一个 (batch_grant/batch_revoke)");
+DEFINE_int32(batch_timeout_ms, 60000, "批量操作的 RPC 超时时间 (毫秒)");
+DEFINE_string(file, "", "导入/导出文件路径 (import/export)，export 未指定时输出到标准输出");
+DEFINE_string(format, "", "导入/导出文件格式: ndjson 或 csv，留空则按文件扩展名判断 (.csv 为 csv，其余为 ndjson)");
+DEFINE_int32(batch_size, 1000, "import 时每个 BatchGrantRoles 请求携带的用户数；export 时的分页大小");
+DEFINE_int32(max_inflight, 8, "import 时同时在途的 RPC 数上限");
 
 const char* TOKEN_FILE = ".auth_token";
 
+// 登录 Token 只在进程启动时读取一次，所有请求共用
+std::string g_token;
+
 std::string LoadToken() {
     std::ifstream ifs(TOKEN_FILE);
     if (!ifs.is_open()) return "";
@@ -35,6 +55,455 @@ void SaveToken(const std::string& token) {
     }
 }
 
+void SetAuthHeader(brpc::Controller* cntl) {
+    if (!g_token.empty()) {
+        cntl->http_request().SetHeader("Authorization", "Bearer " + g_token);
+    }
+}
+
+// 拆分逗号分隔的列表，忽略空项
+std::vector<std::string> SplitList(const std::string& s) {
+    std::vector<std::string> items;
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) items.push_back(item);
+    }
+    return items;
+}
+
+// 批量操作的用户列表：优先读取 --users_file（每行一个），否则使用逗号分隔的 --user
+std::vector<std::string> LoadBatchUsers() {
+    if (FLAGS_users_file.empty()) {
+        return SplitList(FLAGS_user);
+    }
+    std::vector<std::string> users;
+    std::ifstream ifs(FLAGS_users_file);
+    std::string line;
+    while (std::getline(ifs, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (!line.empty()) users.push_back(line);
+    }
+    return users;
+}
+
+// ------------------------- 导入 / 导出 -------------------------
+// 文件格式：每行一条 RbacRecord，NDJSON 为 JSON 对象，CSV 为固定列（首行表头）
+// 导出顺序为 perm -> role -> role_perm -> grant，导入时依赖关系按此顺序满足
+
+const char* kCsvColumns = "type,user_id,role_key,role_name,perm_key,perm_name,description,is_default";
+
+bool UseCsv() {
+    if (!FLAGS_format.empty()) {
+        return FLAGS_format == "csv";
+    }
+    const std::string ext = ".csv";
+    return FLAGS_file.size() >= ext.size() &&
+           FLAGS_file.compare(FLAGS_file.size() - ext.size(), ext.size(), ext) == 0;
+}
+
+// CSV 字段转义：含逗号或引号时加引号；按行读取，不支持字段内换行，换行替换为空格
+std::string CsvEscape(const std::string& s) {
+    if (s.find_first_of(",\"\n\r") == std::string::npos) return s;
+    std::string out = "\"";
+    for (char c : s) {
+        if (c == '"') out += "\"\"";
+        else if (c == '\n' || c == '\r') out += ' ';
+        else out += c;
+    }
+    out += "\"";
+    return out;
+}
+
+std::vector<std::string> CsvSplit(const std::string& line) {
+    std::vector<std::string> fields;
+    std::string cur;
+    bool quoted = false;
+    for (size_t i = 0; i < line.size(); ++i) {
+        char c = line[i];
+        if (quoted) {
+            if (c == '"') {
+                if (i + 1 < line.size() && line[i + 1] == '"') {
+                    cur += '"';
+                    ++i;
+                } else {
+                    quoted = false;
+                }
+            } else {
+                cur += c;
+            }
+        } else if (c == '"') {
+            quoted = true;
+        } else if (c == ',') {
+            fields.push_back(cur);
+            cur.clear();
+        } else {
+            cur += c;
+        }
+    }
+    fields.push_back(cur);
+    return fields;
+}
+
+bool ParseRecord(const std::string& line, bool csv, siqi::auth::RbacRecord* rec, std::string* err) {
+    if (!csv) {
+        return json2pb::JsonToProtoMessage(line, rec, err);
+    }
+    std::vector<std::string> f = CsvSplit(line);
+    if (f.size() != 8) {
+        *err = "CSV 列数应为 8，实际为 " + std::to_string(f.size());
+        return false;
+    }
+    rec->set_type(f[0]);
+    rec->set_user_id(f[1]);
+    rec->set_role_key(f[2]);
+    rec->set_role_name(f[3]);
+    rec->set_perm_key(f[4]);
+    rec->set_perm_name(f[5]);
+    rec->set_description(f[6]);
+    rec->set_is_default(f[7] == "1" || f[7] == "true");
+    return true;
+}
+
+std::string FormatRecord(const siqi::auth::RbacRecord& rec, bool csv) {
+    if (!csv) {
+        std::string json;
+        json2pb::ProtoMessageToJson(rec, &json);
+        return json;
+    }
+    return CsvEscape(rec.type()) + "," + CsvEscape(rec.user_id()) + "," +
+           CsvEscape(rec.role_key()) + "," + CsvEscape(rec.role_name()) + "," +
+           CsvEscape(rec.perm_key()) + "," + CsvEscape(rec.perm_name()) + "," +
+           CsvEscape(rec.description()) + "," + (rec.is_default() ? "1" : "0");
+}
+
+// 有界的异步 RPC 窗口：在途请求达到上限时阻塞发送方，同时汇总结果
+class RpcWindow {
+public:
+    explicit RpcWindow(int max_inflight) : max_inflight_(max_inflight > 0 ? max_inflight : 1) {}
+
+    void Acquire() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cond_.wait(lock, [this] { return inflight_ < max_inflight_; });
+        ++inflight_;
+    }
+
+    void Release(bool ok, int64_t rows, const std::string& error) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        --inflight_;
+        if (ok) {
+            ok_rows_ += rows;
+        } else {
+            failed_rows_ += rows;
+            if (errors_.size() < 10) errors_.push_back(error);
+        }
+        cond_.notify_all();
+    }
+
+    // 等待所有在途请求完成
+    void WaitAll() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cond_.wait(lock, [this] { return inflight_ == 0; });
+    }
+
+    int64_t ok_rows() const { std::lock_guard<std::mutex> lock(mutex_); return ok_rows_; }
+    int64_t failed_rows() const { std::lock_guard<std::mutex> lock(mutex_); return failed_rows_; }
+    std::vector<std::string> errors() const { std::lock_guard<std::mutex> lock(mutex_); return errors_; }
+
+private:
+    const int max_inflight_;
+    int inflight_ = 0;
+    int64_t ok_rows_ = 0;
+    int64_t failed_rows_ = 0;
+    std::vector<std::string> errors_;
+    mutable std::mutex mutex_;
+    std::condition_variable cond_;
+};
+
+// 一次异步调用的上下文，在回调中释放
+struct AsyncCall {
+    brpc::Controller cntl;
+    std::unique_ptr<google::protobuf::Message> request;
+    siqi::auth::AdminResponse response;
+    std::string desc;
+    int64_t rows = 1;
+};
+
+void OnAsyncCallDone(AsyncCall* call, RpcWindow* window) {
+    std::unique_ptr<AsyncCall> guard(call);
+    if (call->cntl.Failed()) {
+        window->Release(false, call->rows, call->desc + ": " + call->cntl.ErrorText());
+    } else if (!call->response.success()) {
+        window->Release(false, call->rows, call->desc + ": " + call->response.message());
+    } else {
+        window->Release(true, call->rows, "");
+    }
+}
+
+// 流式导入：逐行读取记录，grant 按角色聚合成 BatchGrantRoles，其余记录逐条异步发送
+// 记录类型切换（定义 -> 角色权限绑定 -> 用户授权）时等待在途请求完成，保证依赖已落库
+class Importer {
+public:
+    explicit Importer(siqi::auth::AdminService_Stub* stub)
+        : stub_(stub), window_(FLAGS_max_inflight) {}
+
+    bool Feed(const siqi::auth::RbacRecord& rec, std::string* err) {
+        int phase = PhaseOf(rec.type());
+        if (phase < 0) {
+            *err = "未知的记录类型: " + rec.type();
+            return false;
+        }
+        if (phase != phase_) {
+            FlushGrants();
+            window_.WaitAll();
+            phase_ = phase;
+        }
+
+        if (rec.type() == "role") {
+            auto* req = new siqi::auth::CreateRoleRequest;
+            req->set_app_code(FLAGS_app);
+            req->set_role_key(rec.role_key());
+            req->set_role_name(rec.role_name());
+            req->set_description(rec.description());
+            req->set_is_default(rec.is_default());
+            AsyncCall* call = NewCall(req, "role " + rec.role_key(), 1);
+            stub_->CreateRole(&call->cntl, req, &call->response,
+                              brpc::NewCallback(&OnAsyncCallDone, call, &window_));
+        } else if (rec.type() == "perm") {
+            auto* req = new siqi::auth::CreatePermissionRequest;
+            req->set_app_code(FLAGS_app);
+            req->set_perm_key(rec.perm_key());
+            req->set_perm_name(rec.perm_name());
+            req->set_description(rec.description());
+            AsyncCall* call = NewCall(req, "perm " + rec.perm_key(), 1);
+            stub_->CreatePermission(&call->cntl, req, &call->response,
+                                    brpc::NewCallback(&OnAsyncCallDone, call, &window_));
+        } else if (rec.type() == "role_perm") {
+            auto* req = new siqi::auth::AddPermissionToRoleRequest;
+            req->set_app_code(FLAGS_app);
+            req->set_role_key(rec.role_key());
+            req->set_perm_key(rec.perm_key());
+            AsyncCall* call = NewCall(req, "role_perm " + rec.role_key() + "/" + rec.perm_key(), 1);
+            stub_->AddPermissionToRole(&call->cntl, req, &call->response,
+                                       brpc::NewCallback(&OnAsyncCallDone, call, &window_));
+        } else {
+            if (rec.role_key() != pending_role_ ||
+                pending_users_.size() >= static_cast<size_t>(FLAGS_batch_size)) {
+                FlushGrants();
+            }
+            pending_role_ = rec.role_key();
+            pending_users_.push_back(rec.user_id());
+        }
+        return true;
+    }
+
+    void Finish() {
+        FlushGrants();
+        window_.WaitAll();
+    }
+
+    const RpcWindow& window() const { return window_; }
+
+private:
+    static int PhaseOf(const std::string& type) {
+        if (type == "role" || type == "perm") return 0;
+        if (type == "role_perm") return 1;
+        if (type == "grant") return 2;
+        return -1;
+    }
+
+    // 申请窗口配额并创建调用上下文，request 的所有权交给 AsyncCall
+    AsyncCall* NewCall(google::protobuf::Message* request, const std::string& desc, int64_t rows) {
+        window_.Acquire();
+        AsyncCall* call = new AsyncCall;
+        call->request.reset(request);
+        call->desc = desc;
+        call->rows = rows;
+        call->cntl.set_timeout_ms(FLAGS_batch_timeout_ms);
+        SetAuthHeader(&call->cntl);
+        return call;
+    }
+
+    void FlushGrants() {
+        if (pending_users_.empty()) return;
+        auto* req = new siqi::auth::BatchGrantRolesRequest;
+        req->set_app_code(FLAGS_app);
+        req->add_role_keys(pending_role_);
+        for (auto& uid : pending_users_) req->add_user_ids(std::move(uid));
+        AsyncCall* call = NewCall(req, "grant " + pending_role_, pending_users_.size());
+        stub_->BatchGrantRoles(&call->cntl, req, &call->response,
+                               brpc::NewCallback(&OnAsyncCallDone, call, &window_));
+        pending_users_.clear();
+    }
+
+    siqi::auth::AdminService_Stub* stub_;
+    RpcWindow window_;
+    int phase_ = 0;
+    std::string pending_role_;
+    std::vector<std::string> pending_users_;
+};
+
+int RunImport(siqi::auth::AdminService_Stub* stub) {
+    if (FLAGS_file.empty()) {
+        std::cerr << "Missing --file" << std::endl;
+        return -1;
+    }
+    std::ifstream ifs(FLAGS_file);
+    if (!ifs.is_open()) {
+        std::cerr << "无法打开文件: " << FLAGS_file << std::endl;
+        return -1;
+    }
+
+    bool csv = UseCsv();
+    Importer importer(stub);
+    auto start = std::chrono::steady_clock::now();
+
+    std::string line;
+    int64_t line_no = 0;
+    int64_t bad_lines = 0;
+    while (std::getline(ifs, line)) {
+        ++line_no;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty()) continue;
+        if (csv && line_no == 1 && line.compare(0, 5, "type,") == 0) continue; // 表头
+
+        siqi::auth::RbacRecord rec;
+        std::string err;
+        if (!ParseRecord(line, csv, &rec, &err) || !importer.Feed(rec, &err)) {
+            if (++bad_lines <= 10) {
+                std::cerr << "第 " << line_no << " 行无效: " << err << std::endl;
+            }
+        }
+    }
+    importer.Finish();
+
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const RpcWindow& window = importer.window();
+    int64_t total = window.ok_rows() + window.failed_rows();
+    std::cout << "导入完成: 成功 " << window.ok_rows() << " 条, 失败 " << window.failed_rows()
+              << " 条, 无效行 " << bad_lines << ", 耗时 " << secs << "s";
+    if (secs > 0) std::cout << ", " << static_cast<int64_t>(total / secs) << " 条/秒";
+    std::cout << std::endl;
+    for (const auto& e : window.errors()) {
+        std::cout << "  ❌ " << e << std::endl;
+    }
+    return (window.failed_rows() > 0 || bad_lines > 0) ? 1 : 0;
+}
+
+// 流式导出：角色与权限定义数量有限，一次取回；用户授权按角色分页拉取并边拉边写
+int RunExport(siqi::auth::AdminService_Stub* stub) {
+    std::ofstream ofs;
+    std::ostream* out = &std::cout;
+    if (!FLAGS_file.empty()) {
+        ofs.open(FLAGS_file);
+        if (!ofs.is_open()) {
+            std::cerr << "无法写入文件: " << FLAGS_file << std::endl;
+            return -1;
+        }
+        out = &ofs;
+    }
+    bool csv = UseCsv();
+    if (csv) *out << kCsvColumns << "\n";
+
+    auto start = std::chrono::steady_clock::now();
+    int64_t count = 0;
+    auto emit = [&](const siqi::auth::RbacRecord& rec) {
+        *out << FormatRecord(rec, csv) << "\n";
+        ++count;
+    };
+
+    // 1. 权限定义
+    {
+        brpc::Controller cntl;
+        SetAuthHeader(&cntl);
+        siqi::auth::ListPermissionsRequest request;
+        request.set_app_code(FLAGS_app);
+        siqi::auth::ListPermissionsResponse response;
+        stub->ListPermissions(&cntl, &request, &response, NULL);
+        if (cntl.Failed()) {
+            LOG(ERROR) << "ListPermissions 失败: " << cntl.ErrorText();
+            return -1;
+        }
+        for (const auto& perm : response.permissions()) {
+            siqi::auth::RbacRecord rec;
+            rec.set_type("perm");
+            rec.set_perm_key(perm.perm_key());
+            rec.set_perm_name(perm.perm_name());
+            rec.set_description(perm.description());
+            emit(rec);
+        }
+    }
+
+    // 2. 角色定义及角色-权限绑定
+    siqi::auth::ListRolesResponse roles;
+    {
+        brpc::Controller cntl;
+        SetAuthHeader(&cntl);
+        siqi::auth::ListRolesRequest request;
+        request.set_app_code(FLAGS_app);
+        stub->ListRoles(&cntl, &request, &roles, NULL);
+        if (cntl.Failed()) {
+            LOG(ERROR) << "ListRoles 失败: " << cntl.ErrorText();
+            return -1;
+        }
+    }
+    for (const auto& role : roles.roles()) {
+        siqi::auth::RbacRecord rec;
+        rec.set_type("role");
+        rec.set_role_key(role.role_key());
+        rec.set_role_name(role.role_name());
+        rec.set_description(role.description());
+        rec.set_is_default(role.is_default());
+        emit(rec);
+    }
+    for (const auto& role : roles.roles()) {
+        for (const auto& perm_key : role.perm_keys()) {
+            siqi::auth::RbacRecord rec;
+            rec.set_type("role_perm");
+            rec.set_role_key(role.role_key());
+            rec.set_perm_key(perm_key);
+            emit(rec);
+        }
+    }
+
+    // 3. 用户授权：按角色游标分页，不计总数，深度翻页的代价与首页相同
+    for (const auto& role : roles.roles()) {
+        std::string page_token;
+        while (true) {
+            brpc::Controller cntl;
+            SetAuthHeader(&cntl);
+            cntl.set_timeout_ms(FLAGS_batch_timeout_ms);
+            siqi::auth::GetRoleUsersRequest request;
+            request.set_app_code(FLAGS_app);
+            request.set_role_key(role.role_key());
+            request.set_page_size(FLAGS_batch_size);
+            request.set_page_token(page_token);
+            request.set_total_mode(siqi::auth::TOTAL_NONE);
+            siqi::auth::GetRoleUsersResponse response;
+            stub->GetRoleUsers(&cntl, &request, &response, NULL);
+            if (cntl.Failed()) {
+                LOG(ERROR) << "GetRoleUsers 失败 (" << role.role_key() << "): " << cntl.ErrorText();
+                return -1;
+            }
+            for (const auto& user : response.users()) {
+                siqi::auth::RbacRecord rec;
+                rec.set_type("grant");
+                rec.set_user_id(user.user_id());
+                rec.set_role_key(role.role_key());
+                emit(rec);
+            }
+            if (response.next_page_token().empty()) break;
+            page_token = response.next_page_token();
+        }
+    }
+    out->flush();
+
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    // 数据可能写到标准输出，统计信息走标准错误
+    std::cerr << "导出完成: " << count << " 条记录, 耗时 " << secs << "s" << std::endl;
+    return 0;
+}
+
 int main(int argc, char* argv[]) {
     std::string usage_msg = 
         "\nSiqi Auth 管理工具 (Admin Tool)\n"
@@ -45,7 +514,10 @@ int main(int argc, char* argv[]) {
         "  3. 创建权限: ./admin_tool --op=create_perm --perm=user:del --name=删用户\n"
         "  4. 角色绑定: ./admin_tool --op=add_perm --role=admin --perm=user:del\n"
         "  5. 用户授权: ./admin_tool --op=grant_role --user=10086 --role=admin\n"
-        "  6. 查看列表: ./admin_tool --op=list_roles\n\n"
+        "     批量授权: ./admin_tool --op=batch_grant --users_file=members.txt --role=member,viewer\n"
+        "  6. 查看列表: ./admin_tool --op=list_roles\n"
+        "  7. 导出应用: ./admin_tool --op=export --app=qq_bot --file=qq_bot.ndjson\n"
+        "  8. 导入应用: ./admin_tool --op=import --app=qq_bot_new --file=qq_bot.ndjson --max_inflight=16\n\n"
         "提示: 若只想查看本工具的参数说明，请使用: ./admin_tool --helpon=admin_tool";
     
     gflags::SetUsageMessage(usage_msg);
@@ -67,11 +539,9 @@ int main(int argc, char* argv[]) {
     
     // Load Token and set header for all requests except login
     if (FLAGS_op != "login") {
-        std::string token = LoadToken();
-        if (!token.empty()) {
-             // Bearer Token standard
-            cntl.http_request().SetHeader("Authorization", "Bearer " + token);
-        }
+        g_token = LoadToken();
+        // Bearer Token standard
+        SetAuthHeader(&cntl);
     }
 
     if (FLAGS_op == "login") {
@@ -96,6 +566,10 @@ int main(int argc, char* argv[]) {
             }
             return 0;
         }
+    } else if (FLAGS_op == "import") {
+        return RunImport(&stub);
+    } else if (FLAGS_op == "export") {
+        return RunExport(&stub);
     } else if (FLAGS_op == "grant_role") {
         if (FLAGS_user.empty() || FLAGS_role.empty()) {
             std::cerr << "Missing --user or --role" << std::endl;
@@ -118,6 +592,28 @@ int main(int argc, char* argv[]) {
         request.set_role_key(FLAGS_role);
         
         stub.RevokeRoleFromUser(&cntl, &request, &response, NULL);
+    } else if (FLAGS_op == "batch_grant" || FLAGS_op == "batch_revoke") {
+        std::vector<std::string> users = LoadBatchUsers();
+        std::vector<std::string> roles = SplitList(FLAGS_role);
+        if (users.empty() || roles.empty()) {
+            std::cerr << "Missing --user/--users_file or --role" << std::endl;
+            return -1;
+        }
+        cntl.set_timeout_ms(FLAGS_batch_timeout_ms);
+
+        if (FLAGS_op == "batch_grant") {
+            siqi::auth::BatchGrantRolesRequest request;
+            request.set_app_code(FLAGS_app);
+            for (const auto& u : users) request.add_user_ids(u);
+            for (const auto& r : roles) request.add_role_keys(r);
+            stub.BatchGrantRoles(&cntl, &request, &response, NULL);
+        } else {
+            siqi::auth::BatchRevokeRolesRequest request;
+            request.set_app_code(FLAGS_app);
+            for (const auto& u : users) request.add_user_ids(u);
+            for (const auto& r : roles) request.add_role_keys(r);
+            stub.BatchRevokeRoles(&cntl, &request, &response, NULL);
+        }
     } else if (FLAGS_op == "add_perm") {
         if (FLAGS_role.empty() || FLAGS_perm.empty()) {
             std::cerr << "Missing --role or --perm" << std::endl;
@@ -0,0 +1,477 @@
+#include "audit_archive.h"
+#include "auth.pb.h"
+#include <json2pb/json_to_pb.h>
+#include <json2pb/pb_to_json.h>
+#include <zlib.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cerrno>
+#include <cctype>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <iostream>
+
+namespace {
+
+const char* kFilePrefix = "audit_";
+const char* kFileSuffix = ".ndjson.gz";
+
+// 本地时间 year 年 month 月 1 日零点，month 超出 1-12 时自动进位/借位
+std::string MonthStart(int year, int month) {
+    int index = year * 12 + (month - 1);
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%04d-%02d-01 00:00:00", index / 12, index % 12 + 1);
+    return buf;
+}
+
+void CurrentMonth(int& year, int& month) {
+    std::time_t t = std::time(nullptr);
+    std::tm tm_buf;
+    localtime_r(&t, &tm_buf);
+    year = tm_buf.tm_year + 1900;
+    month = tm_buf.tm_mon + 1;
+}
+
+bool ParseYearMonth(const std::string& time, int& year, int& month) {
+    return std::sscanf(time.c_str(), "%d-%d", &year, &month) == 2;
+}
+
+// "2026-11-01 00:00:00" -> "20261101"
+std::string CompactDate(const std::string& time) {
+    std::string out;
+    for (size_t i = 0; i < time.size() && i < 10; ++i) {
+        if (time[i] != '-') out += time[i];
+    }
+    return out;
+}
+
+void ToProto(const PermissionStore::AuditLogInfo& log, siqi::auth::ListAuditLogsResponse::AuditLog* pb) {
+    pb->set_id(log.id);
+    pb->set_operator_id(log.operator_id);
+    pb->set_operator_name(log.operator_name);
+    pb->set_app_code(log.app_code);
+    pb->set_action(log.action);
+    pb->set_target_type(log.target_type);
+    pb->set_target_id(log.target_id);
+    pb->set_target_name(log.target_name);
+    pb->set_object_type(log.object_type);
+    pb->set_object_id(log.object_id);
+    pb->set_object_name(log.object_name);
+    pb->set_created_at(log.created_at);
+}
+
+void FromProto(const siqi::auth::ListAuditLogsResponse::AuditLog& pb, PermissionStore::AuditLogInfo& log) {
+    log.id = pb.id();
+    log.operator_id = pb.operator_id();
+    log.operator_name = pb.operator_name();
+    log.app_code = pb.app_code();
+    log.action = pb.action();
+    log.target_type = pb.target_type();
+    log.target_id = pb.target_id();
+    log.target_name = pb.target_name();
+    log.object_type = pb.object_type();
+    log.object_id = pb.object_id();
+    log.object_name = pb.object_name();
+    log.created_at = pb.created_at();
+}
+
+// 逐行解压读取归档文件，fn 返回 false 时停止；文件无法打开返回 false
+bool ReadArchive(const std::string& path,
+                 const std::function<bool(const PermissionStore::AuditLogInfo&)>& fn) {
+    gzFile gz = gzopen(path.c_str(), "rb");
+    if (!gz) {
+        std::cerr << "打开审计归档失败: " << path << std::endl;
+        return false;
+    }
+    gzbuffer(gz, 128 * 1024);
+
+    char buf[16 * 1024];
+    std::string line;
+    while (gzgets(gz, buf, sizeof(buf)) != NULL) {
+        line += buf;
+        if (line.empty() || line.back() != '\n') {
+            continue; // 行比缓冲区长，继续读
+        }
+        line.pop_back();
+        siqi::auth::ListAuditLogsResponse::AuditLog pb;
+        std::string err;
+        if (!line.empty()) {
+            if (!json2pb::JsonToProtoMessage(line, &pb, &err)) {
+                std::cerr << "跳过无法解析的审计归档记录 (" << path << "): " << err << std::endl;
+            } else {
+                PermissionStore::AuditLogInfo log;
+                FromProto(pb, log);
+                if (!fn(log)) break;
+            }
+        }
+        line.clear();
+    }
+    gzclose(gz);
+    return true;
+}
+
+bool Matches(const AuditArchive::Filter& f, const PermissionStore::AuditLogInfo& log) {
+    if (!f.app_code.empty() && log.app_code != f.app_code) return false;
+    if (!f.action.empty() && log.action != f.action) return false;
+    if (!f.operator_id.empty() && std::to_string(log.operator_id) != f.operator_id) return false;
+    if (!f.target_id.empty() && log.target_id != f.target_id) return false;
+    if (!f.start_time.empty() && log.created_at < f.start_time) return false;
+    if (!f.end_time.empty() && log.created_at > f.end_time) return false;
+    return true;
+}
+
+bool HasFieldFilter(const AuditArchive::Filter& f) {
+    return !f.app_code.empty() || !f.action.empty() || !f.operator_id.empty() ||
+           !f.target_id.empty() || !f.start_time.empty() || !f.end_time.empty();
+}
+
+} // namespace
+
+AuditArchive::AuditArchive(PermissionStore* dao, const Options& options)
+    : dao_(dao), options_(options) {
+    // 至少保留上个月：落盘回放等迟到的记录仍可能写入刚过去的月份
+    if (options_.hot_months < 2) options_.hot_months = 2;
+    if (options_.future_months < 1) options_.future_months = 1;
+    if (options_.check_interval_s < 1) options_.check_interval_s = 1;
+
+    if (!options_.dir.empty() && options_.leader) {
+        if (::mkdir(options_.dir.c_str(), 0755) != 0 && errno != EEXIST) {
+            std::cerr << "创建审计归档目录失败: " << options_.dir << " (" << std::strerror(errno) << ")" << std::endl;
+        }
+    }
+    if (!options_.dir.empty()) {
+        LoadFiles();
+    }
+    worker_ = std::thread(&AuditArchive::Loop, this);
+}
+
+AuditArchive::~AuditArchive() {
+    Stop();
+}
+
+void AuditArchive::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(loop_mutex_);
+        if (stopped_) return;
+        stopped_ = true;
+    }
+    loop_cond_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+void AuditArchive::Loop() {
+    while (true) {
+        RunOnce();
+        std::unique_lock<std::mutex> lock(loop_mutex_);
+        if (loop_cond_.wait_for(lock, std::chrono::seconds(options_.check_interval_s),
+                                [this] { return stopped_; })) {
+            break;
+        }
+    }
+}
+
+bool AuditArchive::RunOnce() {
+    if (!options_.leader) {
+        if (!options_.dir.empty()) LoadFiles();
+        return true;
+    }
+    std::vector<PermissionStore::AuditPartition> parts = dao_->listAuditPartitions();
+    if (parts.empty()) {
+        if (!warned_unpartitioned_) {
+            std::cerr << "sys_audit_logs 未分区，跳过分区维护与归档 (参见 scripts/init.sql)" << std::endl;
+            warned_unpartitioned_ = true;
+        }
+        return false;
+    }
+
+    bool ok = EnsurePartitions(parts);
+    if (options_.dir.empty()) {
+        return ok;
+    }
+
+    // 上界不晚于热数据窗口起点的分区整体过期
+    int year, month;
+    CurrentMonth(year, month);
+    const std::string cutoff = MonthStart(year, month - (options_.hot_months - 1));
+    for (const auto& part : parts) {
+        if (!part.less_than.empty() && part.less_than <= cutoff) {
+            ok = ArchivePartition(part) && ok;
+        }
+    }
+    return ok;
+}
+
+bool AuditArchive::EnsurePartitions(const std::vector<PermissionStore::AuditPartition>& parts) {
+    std::string last_bound;
+    bool has_max = false;
+    for (const auto& part : parts) {
+        if (part.less_than.empty()) {
+            has_max = (part.name == "pmax");
+        } else {
+            last_bound = part.less_than;
+        }
+    }
+    if (!has_max) {
+        std::cerr << "sys_audit_logs 缺少 pmax 分区，无法自动创建新分区" << std::endl;
+        return false;
+    }
+
+    int year, month;
+    CurrentMonth(year, month);
+    const std::string target = MonthStart(year, month + options_.future_months + 1);
+
+    // 从现有最大上界的下一个月开始补齐（表中只有 pmax 时从当月开始）
+    int next_year = year, next_month = month + 1;
+    if (!last_bound.empty() && ParseYearMonth(last_bound, next_year, next_month)) {
+        next_month += 1;
+    }
+
+    std::vector<PermissionStore::AuditPartition> to_add;
+    for (std::string bound = MonthStart(next_year, next_month); bound <= target;
+         bound = MonthStart(next_year, ++next_month)) {
+        // 分区名取其包含的月份，即上界的前一个月
+        char name[16];
+        int index = next_year * 12 + (next_month - 2);
+        std::snprintf(name, sizeof(name), "p%04d%02d", index / 12, index % 12 + 1);
+        PermissionStore::AuditPartition part;
+        part.name = name;
+        part.less_than = bound;
+        to_add.push_back(part);
+    }
+    if (to_add.empty()) {
+        return true;
+    }
+    if (!dao_->addAuditPartitions(to_add)) {
+        std::cerr << "创建审计日志分区失败: " << dao_->getLastError() << std::endl;
+        return false;
+    }
+    std::cerr << "已创建审计日志分区 " << to_add.front().name << " ~ " << to_add.back().name << std::endl;
+    return true;
+}
+
+bool AuditArchive::ArchivePartition(const PermissionStore::AuditPartition& part) {
+    const std::string until = CompactDate(part.less_than);
+    const std::string prefix = options_.dir + "/" + kFilePrefix + until + "_n";
+
+    // 上次归档已写完文件但未来得及 DROP，直接删除分区
+    bool archived = false;
+    for (const auto& f : Files()) {
+        if (f.path.compare(0, prefix.size(), prefix) == 0) archived = true;
+    }
+
+    if (!archived) {
+        const std::string tmp_path = options_.dir + "/" + kFilePrefix + until + kFileSuffix + ".tmp";
+        gzFile gz = gzopen(tmp_path.c_str(), "wb6");
+        if (!gz) {
+            std::cerr << "创建审计归档文件失败: " << tmp_path << std::endl;
+            return false;
+        }
+
+        int64_t rows = 0;
+        bool write_ok = true;
+        bool export_ok = dao_->exportAuditPartition(part.name, [&](const PermissionStore::AuditLogInfo& log) {
+            siqi::auth::ListAuditLogsResponse::AuditLog pb;
+            ToProto(log, &pb);
+            std::string json;
+            json2pb::ProtoMessageToJson(pb, &json);
+            json += '\n';
+            write_ok = gzwrite(gz, json.data(), static_cast<unsigned>(json.size())) == static_cast<int>(json.size());
+            return write_ok;
+        }, rows);
+        write_ok = (gzclose(gz) == Z_OK) && write_ok;
+
+        if (!export_ok || !write_ok) {
+            std::cerr << "归档审计日志分区 " << part.name << " 失败: "
+                      << (export_ok ? "写入归档文件出错" : dao_->getLastError()) << std::endl;
+            std::remove(tmp_path.c_str());
+            return false;
+        }
+
+        // 回读校验，确认文件完整后才删除分区
+        int64_t verified = 0;
+        ReadArchive(tmp_path, [&](const PermissionStore::AuditLogInfo&) { ++verified; return true; });
+        if (verified != rows) {
+            std::cerr << "审计归档校验失败 (" << part.name << "): 导出 " << rows << " 行, 文件中 " << verified << " 行" << std::endl;
+            std::remove(tmp_path.c_str());
+            return false;
+        }
+
+        if (rows == 0) {
+            std::remove(tmp_path.c_str());
+        } else if (std::rename(tmp_path.c_str(), (prefix + std::to_string(rows) + kFileSuffix).c_str()) != 0) {
+            std::cerr << "重命名审计归档文件失败: " << tmp_path << std::endl;
+            std::remove(tmp_path.c_str());
+            return false;
+        }
+        LoadFiles();
+        std::cerr << "已归档审计日志分区 " << part.name << ": " << rows << " 行" << std::endl;
+    }
+
+    if (!dao_->dropAuditPartition(part.name)) {
+        std::cerr << "删除审计日志分区 " << part.name << " 失败: " << dao_->getLastError() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void AuditArchive::LoadFiles() {
+    std::vector<ArchiveFile> files;
+    DIR* dir = ::opendir(options_.dir.c_str());
+    if (dir) {
+        const size_t prefix_len = std::strlen(kFilePrefix);
+        const size_t suffix_len = std::strlen(kFileSuffix);
+        while (struct dirent* entry = ::readdir(dir)) {
+            // audit_<YYYYMMDD>_n<rows>.ndjson.gz
+            std::string name = entry->d_name;
+            if (name.size() < prefix_len + 8 + 2 + suffix_len ||
+                name.compare(0, prefix_len, kFilePrefix) != 0 ||
+                name.compare(name.size() - suffix_len, suffix_len, kFileSuffix) != 0 ||
+                name.compare(prefix_len + 8, 2, "_n") != 0) {
+                continue;
+            }
+            std::string date = name.substr(prefix_len, 8);
+            if (!std::all_of(date.begin(), date.end(), ::isdigit)) continue;
+
+            ArchiveFile f;
+            f.path = options_.dir + "/" + name;
+            f.until = date.substr(0, 4) + "-" + date.substr(4, 2) + "-" + date.substr(6, 2) + " 00:00:00";
+            f.rows = std::atoll(name.substr(prefix_len + 10).c_str());
+            files.push_back(f);
+        }
+        ::closedir(dir);
+    }
+    std::sort(files.begin(), files.end(),
+              [](const ArchiveFile& a, const ArchiveFile& b) { return a.until > b.until; });
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    files_.swap(files);
+    count_cache_.clear();
+}
+
+std::vector<AuditArchive::ArchiveFile> AuditArchive::Files() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return files_;
+}
+
+std::string AuditArchive::HotLowerBound() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return files_.empty() ? std::string() : files_.front().until;
+}
+
+bool AuditArchive::Scan(const Filter& filter,
+                        const PermissionStore::PageCursor* after,
+                        int64_t skip,
+                        size_t limit,
+                        std::vector<PermissionStore::AuditLogInfo>& out) const {
+    if (limit == 0) return true;
+    const size_t target = out.size() + limit;
+    std::vector<ArchiveFile> files = Files();
+
+    bool ok = true;
+    bool done = false;
+    for (size_t i = 0; i < files.size() && !done; ++i) {
+        const ArchiveFile& f = files[i];
+        // 文件覆盖 [下一个文件的上界, f.until)，按时间范围跳过整个文件
+        const std::string lower = i + 1 < files.size() ? files[i + 1].until : std::string();
+        if (!filter.start_time.empty() && f.until <= filter.start_time) break;
+        if (!filter.end_time.empty() && !lower.empty() && lower > filter.end_time) continue;
+        if (after && !lower.empty() && lower > after->created_at) continue;
+
+        ok = ReadArchive(f.path, [&](const PermissionStore::AuditLogInfo& log) {
+            if (!filter.start_time.empty() && log.created_at < filter.start_time) {
+                done = true; // 文件内同样按时间倒序，之后不会再有匹配
+                return false;
+            }
+            if (after && !(log.created_at < after->created_at ||
+                           (log.created_at == after->created_at && log.id < after->id))) {
+                return true;
+            }
+            if (!Matches(filter, log)) return true;
+            if (skip > 0) {
+                --skip;
+                return true;
+            }
+            out.push_back(log);
+            done = out.size() >= target;
+            return !done;
+        }) && ok;
+    }
+    return ok;
+}
+
+int64_t AuditArchive::Count(const Filter& filter, bool exact) const {
+    std::vector<ArchiveFile> files = Files();
+    int64_t total = 0;
+    if (!exact || !HasFieldFilter(filter)) {
+        for (const auto& f : files) total += f.rows;
+        return total;
+    }
+    for (size_t i = 0; i < files.size(); ++i) {
+        const ArchiveFile& f = files[i];
+        const std::string lower = i + 1 < files.size() ? files[i + 1].until : std::string();
+        if (!filter.start_time.empty() && f.until <= filter.start_time) break;
+        if (!filter.end_time.empty() && !lower.empty() && lower > filter.end_time) continue;
+
+        // 归档文件不可变，按 (文件, 筛选条件) 缓存计数；时间条件完整覆盖该文件时不计入 key
+        std::string key = f.path;
+        key.append(1, '\n').append(filter.app_code).append(1, '\n').append(filter.action)
+           .append(1, '\n').append(filter.operator_id).append(1, '\n').append(filter.target_id);
+        if (!filter.start_time.empty() && (lower.empty() || filter.start_time > lower)) {
+            key.append(1, '\n').append(filter.start_time);
+        }
+        key.append(1, '\n');
+        if (!filter.end_time.empty() && filter.end_time < f.until) {
+            key.append(filter.end_time);
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = count_cache_.find(key);
+            if (it != count_cache_.end()) {
+                total += it->second;
+                continue;
+            }
+        }
+
+        int64_t matched = 0;
+        bool ok = ReadArchive(f.path, [&](const PermissionStore::AuditLogInfo& log) {
+            if (Matches(filter, log)) ++matched;
+            return true;
+        });
+        total += matched;
+        if (ok) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (count_cache_.size() >= kMaxCachedCounts) count_cache_.clear();
+            count_cache_.emplace(key, matched);
+        }
+    }
+    return total;
+}
+
+std::string AuditArchive::FormatTime(int64_t ts) {
+    std::time_t t = static_cast<std::time_t>(ts);
+    std::tm tm_buf;
+    localtime_r(&t, &tm_buf);
+    char buf[32];
+    std::strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &tm_buf);
+    return buf;
+}
+
+int64_t AuditArchive::ParseTime(const std::string& time) {
+    std::tm tm_buf;
+    std::memset(&tm_buf, 0, sizeof(tm_buf));
+    if (std::sscanf(time.c_str(), "%d-%d-%d %d:%d:%d", &tm_buf.tm_year, &tm_buf.tm_mon, &tm_buf.tm_mday,
+                    &tm_buf.tm_hour, &tm_buf.tm_min, &tm_buf.tm_sec) != 6) {
+        return -1;
+    }
+    tm_buf.tm_year -= 1900;
+    tm_buf.tm_mon -= 1;
+    tm_buf.tm_isdst = -1;
+    return static_cast<int64_t>(std::mktime(&tm_buf));
+}
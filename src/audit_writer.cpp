@@ -0,0 +1,356 @@
+#include "audit_writer.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+namespace {
+
+// 落盘文件格式：每行一条记录，字段以 \t 分隔，字段内的 \ \t \n \r 转义
+const size_t kSpillFields = 11;
+
+std::string Escape(const std::string& s) {
+    std::string out;
+    out.reserve(s.size());
+    for (char c : s) {
+        switch (c) {
+            case '\\': out += "\\\\"; break;
+            case '\t': out += "\\t"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            default: out += c;
+        }
+    }
+    return out;
+}
+
+std::vector<std::string> SplitEscaped(const std::string& line) {
+    std::vector<std::string> fields(1);
+    for (size_t i = 0; i < line.size(); ++i) {
+        char c = line[i];
+        if (c == '\t') {
+            fields.emplace_back();
+        } else if (c == '\\' && i + 1 < line.size()) {
+            char n = line[++i];
+            fields.back() += (n == 't' ? '\t' : n == 'n' ? '\n' : n == 'r' ? '\r' : n);
+        } else {
+            fields.back() += c;
+        }
+    }
+    return fields;
+}
+
+std::string FormatSpillLine(const PermissionStore::AuditLogInfo& log) {
+    return std::to_string(log.operator_id) + "\t" + Escape(log.operator_name) + "\t" +
+           Escape(log.app_code) + "\t" + Escape(log.action) + "\t" +
+           Escape(log.target_type) + "\t" + Escape(log.target_id) + "\t" +
+           Escape(log.target_name) + "\t" + Escape(log.object_type) + "\t" +
+           Escape(log.object_id) + "\t" + Escape(log.object_name) + "\t" +
+           Escape(log.created_at);
+}
+
+bool ParseSpillLine(const std::string& line, PermissionStore::AuditLogInfo& log) {
+    std::vector<std::string> f = SplitEscaped(line);
+    if (f.size() != kSpillFields) return false;
+    log.id = 0;
+    log.operator_id = std::atoll(f[0].c_str());
+    log.operator_name = f[1];
+    log.app_code = f[2];
+    log.action = f[3];
+    log.target_type = f[4];
+    log.target_id = f[5];
+    log.target_name = f[6];
+    log.object_type = f[7];
+    log.object_id = f[8];
+    log.object_name = f[9];
+    log.created_at = f[10];
+    return true;
+}
+
+bool FileExists(const std::string& path) {
+    std::ifstream ifs(path);
+    return ifs.good();
+}
+
+// 回放进度文件：一个十进制字节偏移，不存在或无法解析时从头开始
+int64_t ReadReplayOffset(const std::string& path) {
+    std::ifstream ifs(path);
+    int64_t offset = 0;
+    if (!(ifs >> offset) || offset < 0) return 0;
+    return offset;
+}
+
+// 先写临时文件再改名，崩溃时不会留下半截的偏移
+bool WriteReplayOffset(const std::string& path, int64_t offset) {
+    const std::string tmp_path = path + ".tmp";
+    {
+        std::ofstream ofs(tmp_path, std::ios::trunc);
+        ofs << offset << '\n';
+        ofs.flush();
+        if (!ofs.good()) return false;
+    }
+    return std::rename(tmp_path.c_str(), path.c_str()) == 0;
+}
+
+} // namespace
+
+AuditWriter::AuditWriter(PermissionStore* dao, const Options& options)
+    : dao_(dao), options_(options) {
+    if (options_.max_batch == 0) options_.max_batch = 1;
+    if (options_.queue_capacity == 0) options_.queue_capacity = 1;
+
+    // 上次运行遗留的落盘记录，由后台线程启动后回放
+    if (!options_.spill_path.empty()) {
+        has_spill_ = FileExists(options_.spill_path) || FileExists(options_.spill_path + ".replay");
+    }
+
+    if (options_.async) {
+        writer_ = std::thread(&AuditWriter::WriterLoop, this);
+    } else if (has_spill_) {
+        ReplaySpill();
+    }
+}
+
+AuditWriter::~AuditWriter() {
+    Stop();
+}
+
+void AuditWriter::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopped_) return;
+        stopped_ = true;
+    }
+    not_empty_.notify_all();
+    not_full_.notify_all();
+    if (writer_.joinable()) {
+        writer_.join();
+    }
+}
+
+size_t AuditWriter::QueueSize() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.size();
+}
+
+bool AuditWriter::Log(int64_t operator_id,
+                      const std::string& operator_name,
+                      const std::string& app_code,
+                      const std::string& action,
+                      const std::string& target_type,
+                      const std::string& target_id,
+                      const std::string& target_name,
+                      const std::string& object_type,
+                      const std::string& object_id,
+                      const std::string& object_name) {
+    PermissionStore::AuditLogInfo log;
+    log.id = 0;
+    log.operator_id = operator_id;
+    log.operator_name = operator_name;
+    log.app_code = app_code;
+    log.action = action;
+    log.target_type = target_type;
+    log.target_id = target_id;
+    log.target_name = target_name;
+    log.object_type = object_type;
+    log.object_id = object_id;
+    log.object_name = object_name;
+
+    std::vector<PermissionStore::AuditLogInfo> logs;
+    logs.push_back(std::move(log));
+    return Append(std::move(logs));
+}
+
+bool AuditWriter::Append(std::vector<PermissionStore::AuditLogInfo> logs) {
+    if (logs.empty()) return true;
+
+    // 入队时记下操作时间，延迟写库或落盘回放后时间依然准确
+    std::string now = Now();
+    for (auto& log : logs) {
+        if (log.created_at.empty()) log.created_at = now;
+    }
+
+    if (!options_.async) {
+        if (dao_->createAuditLogs(logs)) return true;
+        return Spill(logs);
+    }
+
+    size_t pushed = 0;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (pushed < logs.size() && !stopped_) {
+            if (queue_.size() >= options_.queue_capacity) {
+                // 背压：等待后台线程腾出空位
+                bool has_room = not_full_.wait_for(
+                    lock, std::chrono::milliseconds(options_.enqueue_timeout_ms),
+                    [this] { return stopped_ || queue_.size() < options_.queue_capacity; });
+                if (!has_room) break;
+                continue;
+            }
+            queue_.push_back(std::move(logs[pushed++]));
+        }
+    }
+    not_empty_.notify_one();
+
+    if (pushed == logs.size()) return true;
+
+    // 队列持续写满（或写入器已停止），剩余记录直接落盘
+    std::vector<PermissionStore::AuditLogInfo> rest(std::make_move_iterator(logs.begin() + pushed),
+                                                  std::make_move_iterator(logs.end()));
+    return Spill(rest);
+}
+
+void AuditWriter::WriterLoop() {
+    ReplaySpill();
+
+    while (true) {
+        std::vector<PermissionStore::AuditLogInfo> batch;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            not_empty_.wait(lock, [this] { return stopped_ || !queue_.empty(); });
+            if (queue_.empty()) break; // 已停止且队列已清空
+
+            // group commit：不足一批时再等一会儿，把这段时间内的记录合并成一条多行 INSERT
+            if (!stopped_ && queue_.size() < options_.max_batch) {
+                not_empty_.wait_for(lock, std::chrono::milliseconds(options_.flush_interval_ms),
+                                    [this] { return stopped_ || queue_.size() >= options_.max_batch; });
+            }
+
+            size_t n = std::min(options_.max_batch, queue_.size());
+            batch.assign(std::make_move_iterator(queue_.begin()),
+                         std::make_move_iterator(queue_.begin() + n));
+            queue_.erase(queue_.begin(), queue_.begin() + n);
+        }
+        not_full_.notify_all();
+        Flush(batch);
+    }
+}
+
+void AuditWriter::Flush(const std::vector<PermissionStore::AuditLogInfo>& batch) {
+    if (dao_->createAuditLogs(batch)) {
+        // 数据库可用，顺便回放之前落盘的记录
+        bool pending;
+        {
+            std::lock_guard<std::mutex> lock(spill_mutex_);
+            pending = has_spill_;
+        }
+        if (pending) ReplaySpill();
+        return;
+    }
+    Spill(batch);
+}
+
+bool AuditWriter::Spill(const std::vector<PermissionStore::AuditLogInfo>& logs) {
+    if (logs.empty()) return true;
+    if (options_.spill_path.empty()) {
+        std::cerr << "审计日志写入失败且未配置落盘文件，丢弃 " << logs.size() << " 条" << std::endl;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(spill_mutex_);
+    std::ofstream ofs(options_.spill_path, std::ios::app);
+    for (const auto& log : logs) {
+        ofs << FormatSpillLine(log) << '\n';
+    }
+    ofs.flush();
+    if (!ofs.good()) {
+        std::cerr << "审计日志落盘失败 (" << options_.spill_path << ")，丢弃 " << logs.size() << " 条" << std::endl;
+        return false;
+    }
+    has_spill_ = true;
+    return true;
+}
+
+bool AuditWriter::ReplaySpill() {
+    if (options_.spill_path.empty()) return true;
+    const std::string replay_path = options_.spill_path + ".replay";
+    // .replay 中已提交到数据库的字节数，每提交一批更新一次；中断（崩溃或写库失败）后从这里继续，不重复写入
+    const std::string offset_path = replay_path + ".offset";
+
+    {
+        std::lock_guard<std::mutex> lock(spill_mutex_);
+        if (!has_spill_) return true;
+        // 上次回放中断遗留的 .replay 优先处理；否则把当前落盘文件整体改名后回放，新的落盘继续写原文件
+        if (!FileExists(replay_path)) {
+            if (std::rename(options_.spill_path.c_str(), replay_path.c_str()) != 0) {
+                has_spill_ = false;
+                return true;
+            }
+            std::remove(offset_path.c_str());
+        }
+        has_spill_ = false;
+    }
+
+    const int64_t start_offset = ReadReplayOffset(offset_path);
+    std::ifstream ifs(replay_path);
+    if (start_offset > 0) {
+        ifs.seekg(start_offset);
+    }
+    std::vector<PermissionStore::AuditLogInfo> batch;
+    std::string line;
+    int64_t offset = start_offset;  // 已读到的位置（落盘记录都以 \n 结尾）
+    int64_t replayed = 0;
+    bool ok = true;
+
+    // 提交成功后立即记下偏移；只有崩溃恰好发生在提交与记录偏移之间时，这一批会在下次重复写入
+    auto flush_batch = [&]() {
+        if (!dao_->createAuditLogs(batch)) {
+            ok = false;
+            return;
+        }
+        replayed += batch.size();
+        batch.clear();
+        if (!WriteReplayOffset(offset_path, offset)) {
+            std::cerr << "无法记录审计回放进度 (" << offset_path << ")" << std::endl;
+        }
+    };
+
+    while (ok && std::getline(ifs, line)) {
+        offset += static_cast<int64_t>(line.size()) + 1;
+        if (line.empty()) continue;
+        PermissionStore::AuditLogInfo log;
+        if (!ParseSpillLine(line, log)) {
+            std::cerr << "跳过无法解析的审计落盘记录: " << line << std::endl;
+            continue;
+        }
+        batch.push_back(std::move(log));
+        if (batch.size() >= options_.max_batch) {
+            flush_batch();
+        }
+    }
+    if (ok && !batch.empty()) {
+        flush_batch();
+    }
+    ifs.close();
+
+    {
+        std::lock_guard<std::mutex> lock(spill_mutex_);
+        if (ok) {
+            std::remove(replay_path.c_str());
+            std::remove(offset_path.c_str());
+        } else {
+            // 写库失败：保留 .replay 与偏移，数据库恢复后从断点继续
+            has_spill_ = true;
+        }
+        // 回放期间新落盘的记录留待下次回放
+        if (FileExists(options_.spill_path)) has_spill_ = true;
+    }
+
+    if (replayed > 0) {
+        std::cerr << "已回放落盘审计日志 " << replayed << " 条" << std::endl;
+    }
+    return ok;
+}
+
+std::string AuditWriter::Now() {
+    std::time_t t = std::time(nullptr);
+    std::tm tm_buf;
+    localtime_r(&t, &tm_buf);
+    char buf[32];
+    std::strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &tm_buf);
+    return buf;
+}
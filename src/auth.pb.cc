@@ -1,18059 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// NO CHECKED-IN PROTOBUF GENCODE
-// source: auth.proto
-// Protobuf C++ Version: 5.29.3
-
-#include "auth.pb.h"
-
-#include <algorithm>
-#include <type_traits>
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/generated_message_tctable_impl.h"
-#include "google/protobuf/extension_set.h"
-#include "google/protobuf/generated_message_util.h"
-#include "google/protobuf/wire_format_lite.h"
-#include "google/protobuf/descriptor.h"
-#include "google/protobuf/generated_message_reflection.h"
-#include "google/protobuf/reflection_ops.h"
-#include "google/protobuf/wire_format.h"
-// @@protoc_insertion_point(includes)
-
-// Must be included last.
-#include "google/protobuf/port_def.inc"
-PROTOBUF_PRAGMA_INIT_SEG
-namespace _pb = ::google::protobuf;
-namespace _pbi = ::google::protobuf::internal;
-namespace _fl = ::google::protobuf::internal::field_layout;
-namespace siqi {
-namespace auth {
-
-inline constexpr UpdateRoleRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        role_key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        role_name_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        description_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        is_default_{false} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR UpdateRoleRequest::UpdateRoleRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct UpdateRoleRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR UpdateRoleRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~UpdateRoleRequestDefaultTypeInternal() {}
-  union {
-    UpdateRoleRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UpdateRoleRequestDefaultTypeInternal _UpdateRoleRequest_default_instance_;
-
-inline constexpr UpdatePermissionRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        perm_key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        perm_name_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        description_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()) {}
-
-template <typename>
-PROTOBUF_CONSTEXPR UpdatePermissionRequest::UpdatePermissionRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct UpdatePermissionRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR UpdatePermissionRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~UpdatePermissionRequestDefaultTypeInternal() {}
-  union {
-    UpdatePermissionRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UpdatePermissionRequestDefaultTypeInternal _UpdatePermissionRequest_default_instance_;
-
-inline constexpr UpdateAppRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        app_name_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        description_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        status_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR UpdateAppRequest::UpdateAppRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct UpdateAppRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR UpdateAppRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~UpdateAppRequestDefaultTypeInternal() {}
-  union {
-    UpdateAppRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UpdateAppRequestDefaultTypeInternal _UpdateAppRequest_default_instance_;
-
-inline constexpr RevokeRoleFromUserRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        user_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        role_key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR RevokeRoleFromUserRequest::RevokeRoleFromUserRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct RevokeRoleFromUserRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR RevokeRoleFromUserRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~RevokeRoleFromUserRequestDefaultTypeInternal() {}
-  union {
-    RevokeRoleFromUserRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RevokeRoleFromUserRequestDefaultTypeInternal _RevokeRoleFromUserRequest_default_instance_;
-
-inline constexpr RemovePermissionFromRoleRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        role_key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        perm_key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR RemovePermissionFromRoleRequest::RemovePermissionFromRoleRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct RemovePermissionFromRoleRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR RemovePermissionFromRoleRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~RemovePermissionFromRoleRequestDefaultTypeInternal() {}
-  union {
-    RemovePermissionFromRoleRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RemovePermissionFromRoleRequestDefaultTypeInternal _RemovePermissionFromRoleRequest_default_instance_;
-
-inline constexpr LoginResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : message_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        token_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        success_{false},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR LoginResponse::LoginResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct LoginResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR LoginResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~LoginResponseDefaultTypeInternal() {}
-  union {
-    LoginResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LoginResponseDefaultTypeInternal _LoginResponse_default_instance_;
-
-inline constexpr LoginRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : username_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        password_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR LoginRequest::LoginRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct LoginRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR LoginRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~LoginRequestDefaultTypeInternal() {}
-  union {
-    LoginRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LoginRequestDefaultTypeInternal _LoginRequest_default_instance_;
-
-inline constexpr ListUserRolesResponse_UserRoleInfo::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : role_keys_{},
-        perm_keys_{},
-        user_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        created_at_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR ListUserRolesResponse_UserRoleInfo::ListUserRolesResponse_UserRoleInfo(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct ListUserRolesResponse_UserRoleInfoDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR ListUserRolesResponse_UserRoleInfoDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~ListUserRolesResponse_UserRoleInfoDefaultTypeInternal() {}
-  union {
-    ListUserRolesResponse_UserRoleInfo _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListUserRolesResponse_UserRoleInfoDefaultTypeInternal _ListUserRolesResponse_UserRoleInfo_default_instance_;
-
-inline constexpr ListUserRolesRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        user_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        page_{0},
-        page_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR ListUserRolesRequest::ListUserRolesRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct ListUserRolesRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR ListUserRolesRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~ListUserRolesRequestDefaultTypeInternal() {}
-  union {
-    ListUserRolesRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListUserRolesRequestDefaultTypeInternal _ListUserRolesRequest_default_instance_;
-
-inline constexpr ListRolesResponse_Role::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : perm_keys_{},
-        role_name_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        role_key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        description_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        created_at_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        updated_at_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        id_{::int64_t{0}},
-        is_default_{false},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR ListRolesResponse_Role::ListRolesResponse_Role(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct ListRolesResponse_RoleDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR ListRolesResponse_RoleDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~ListRolesResponse_RoleDefaultTypeInternal() {}
-  union {
-    ListRolesResponse_Role _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListRolesResponse_RoleDefaultTypeInternal _ListRolesResponse_Role_default_instance_;
-
-inline constexpr ListRolesRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        role_name_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        role_key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        page_{0},
-        page_size_{0},
-        is_default_{false} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR ListRolesRequest::ListRolesRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct ListRolesRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR ListRolesRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~ListRolesRequestDefaultTypeInternal() {}
-  union {
-    ListRolesRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListRolesRequestDefaultTypeInternal _ListRolesRequest_default_instance_;
-
-inline constexpr ListPermissionsResponse_Permission::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : perm_name_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        perm_key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        description_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        created_at_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        updated_at_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        id_{::int64_t{0}},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR ListPermissionsResponse_Permission::ListPermissionsResponse_Permission(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct ListPermissionsResponse_PermissionDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR ListPermissionsResponse_PermissionDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~ListPermissionsResponse_PermissionDefaultTypeInternal() {}
-  union {
-    ListPermissionsResponse_Permission _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListPermissionsResponse_PermissionDefaultTypeInternal _ListPermissionsResponse_Permission_default_instance_;
-
-inline constexpr ListPermissionsRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        perm_name_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        perm_key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        page_{0},
-        page_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR ListPermissionsRequest::ListPermissionsRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct ListPermissionsRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR ListPermissionsRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~ListPermissionsRequestDefaultTypeInternal() {}
-  union {
-    ListPermissionsRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListPermissionsRequestDefaultTypeInternal _ListPermissionsRequest_default_instance_;
-
-inline constexpr ListAuditLogsResponse_AuditLog::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : operator_name_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        action_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        target_type_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        target_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        target_name_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        object_type_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        object_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        object_name_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        created_at_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        id_{::int64_t{0}},
-        operator_id_{::int64_t{0}},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR ListAuditLogsResponse_AuditLog::ListAuditLogsResponse_AuditLog(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct ListAuditLogsResponse_AuditLogDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR ListAuditLogsResponse_AuditLogDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~ListAuditLogsResponse_AuditLogDefaultTypeInternal() {}
-  union {
-    ListAuditLogsResponse_AuditLog _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListAuditLogsResponse_AuditLogDefaultTypeInternal _ListAuditLogsResponse_AuditLog_default_instance_;
-
-inline constexpr ListAuditLogsRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        operator_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        action_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        target_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        page_{0},
-        page_size_{0},
-        start_time_{::int64_t{0}},
-        end_time_{::int64_t{0}} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR ListAuditLogsRequest::ListAuditLogsRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct ListAuditLogsRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR ListAuditLogsRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~ListAuditLogsRequestDefaultTypeInternal() {}
-  union {
-    ListAuditLogsRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListAuditLogsRequestDefaultTypeInternal _ListAuditLogsRequest_default_instance_;
-
-inline constexpr ListAppsRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        app_name_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        page_{0},
-        page_size_{0},
-        status_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR ListAppsRequest::ListAppsRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct ListAppsRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR ListAppsRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~ListAppsRequestDefaultTypeInternal() {}
-  union {
-    ListAppsRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListAppsRequestDefaultTypeInternal _ListAppsRequest_default_instance_;
-
-inline constexpr GrantRoleToUserRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        user_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        role_key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GrantRoleToUserRequest::GrantRoleToUserRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GrantRoleToUserRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GrantRoleToUserRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GrantRoleToUserRequestDefaultTypeInternal() {}
-  union {
-    GrantRoleToUserRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GrantRoleToUserRequestDefaultTypeInternal _GrantRoleToUserRequest_default_instance_;
-
-inline constexpr GetUserRolesResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : role_keys_{},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetUserRolesResponse::GetUserRolesResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetUserRolesResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetUserRolesResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetUserRolesResponseDefaultTypeInternal() {}
-  union {
-    GetUserRolesResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetUserRolesResponseDefaultTypeInternal _GetUserRolesResponse_default_instance_;
-
-inline constexpr GetUserRolesRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        user_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetUserRolesRequest::GetUserRolesRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetUserRolesRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetUserRolesRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetUserRolesRequestDefaultTypeInternal() {}
-  union {
-    GetUserRolesRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetUserRolesRequestDefaultTypeInternal _GetUserRolesRequest_default_instance_;
-
-inline constexpr GetUserPermissionsResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : perm_keys_{},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetUserPermissionsResponse::GetUserPermissionsResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetUserPermissionsResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetUserPermissionsResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetUserPermissionsResponseDefaultTypeInternal() {}
-  union {
-    GetUserPermissionsResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetUserPermissionsResponseDefaultTypeInternal _GetUserPermissionsResponse_default_instance_;
-
-inline constexpr GetUserPermissionsRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        user_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetUserPermissionsRequest::GetUserPermissionsRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetUserPermissionsRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetUserPermissionsRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetUserPermissionsRequestDefaultTypeInternal() {}
-  union {
-    GetUserPermissionsRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetUserPermissionsRequestDefaultTypeInternal _GetUserPermissionsRequest_default_instance_;
-
-inline constexpr GetRoleUsersResponse_User::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : user_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        created_at_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetRoleUsersResponse_User::GetRoleUsersResponse_User(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetRoleUsersResponse_UserDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetRoleUsersResponse_UserDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetRoleUsersResponse_UserDefaultTypeInternal() {}
-  union {
-    GetRoleUsersResponse_User _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetRoleUsersResponse_UserDefaultTypeInternal _GetRoleUsersResponse_User_default_instance_;
-
-inline constexpr GetRoleUsersRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        role_key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        page_{0},
-        page_size_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetRoleUsersRequest::GetRoleUsersRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetRoleUsersRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetRoleUsersRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetRoleUsersRequestDefaultTypeInternal() {}
-  union {
-    GetRoleUsersRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetRoleUsersRequestDefaultTypeInternal _GetRoleUsersRequest_default_instance_;
-
-inline constexpr GetRolePermissionsResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : perm_keys_{},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetRolePermissionsResponse::GetRolePermissionsResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetRolePermissionsResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetRolePermissionsResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetRolePermissionsResponseDefaultTypeInternal() {}
-  union {
-    GetRolePermissionsResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetRolePermissionsResponseDefaultTypeInternal _GetRolePermissionsResponse_default_instance_;
-
-inline constexpr GetRolePermissionsRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        role_key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetRolePermissionsRequest::GetRolePermissionsRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetRolePermissionsRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetRolePermissionsRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetRolePermissionsRequestDefaultTypeInternal() {}
-  union {
-    GetRolePermissionsRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetRolePermissionsRequestDefaultTypeInternal _GetRolePermissionsRequest_default_instance_;
-
-inline constexpr GetAppResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : app_name_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        app_secret_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        description_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        created_at_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        updated_at_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        id_{::int64_t{0}},
-        status_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetAppResponse::GetAppResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetAppResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetAppResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetAppResponseDefaultTypeInternal() {}
-  union {
-    GetAppResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetAppResponseDefaultTypeInternal _GetAppResponse_default_instance_;
-
-inline constexpr GetAppRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetAppRequest::GetAppRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetAppRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetAppRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetAppRequestDefaultTypeInternal() {}
-  union {
-    GetAppRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetAppRequestDefaultTypeInternal _GetAppRequest_default_instance_;
-
-inline constexpr DeleteRoleRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        role_key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR DeleteRoleRequest::DeleteRoleRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct DeleteRoleRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR DeleteRoleRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~DeleteRoleRequestDefaultTypeInternal() {}
-  union {
-    DeleteRoleRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DeleteRoleRequestDefaultTypeInternal _DeleteRoleRequest_default_instance_;
-
-inline constexpr DeletePermissionRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        perm_key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR DeletePermissionRequest::DeletePermissionRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct DeletePermissionRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR DeletePermissionRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~DeletePermissionRequestDefaultTypeInternal() {}
-  union {
-    DeletePermissionRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DeletePermissionRequestDefaultTypeInternal _DeletePermissionRequest_default_instance_;
-
-inline constexpr DeleteAppRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR DeleteAppRequest::DeleteAppRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct DeleteAppRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR DeleteAppRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~DeleteAppRequestDefaultTypeInternal() {}
-  union {
-    DeleteAppRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DeleteAppRequestDefaultTypeInternal _DeleteAppRequest_default_instance_;
-
-inline constexpr CreateRoleRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        role_name_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        role_key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        description_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        is_default_{false},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR CreateRoleRequest::CreateRoleRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct CreateRoleRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR CreateRoleRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~CreateRoleRequestDefaultTypeInternal() {}
-  union {
-    CreateRoleRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CreateRoleRequestDefaultTypeInternal _CreateRoleRequest_default_instance_;
-
-inline constexpr CreatePermissionRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        perm_name_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        perm_key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        description_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR CreatePermissionRequest::CreatePermissionRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct CreatePermissionRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR CreatePermissionRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~CreatePermissionRequestDefaultTypeInternal() {}
-  union {
-    CreatePermissionRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CreatePermissionRequestDefaultTypeInternal _CreatePermissionRequest_default_instance_;
-
-inline constexpr CreateAppRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : app_name_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        description_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR CreateAppRequest::CreateAppRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct CreateAppRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR CreateAppRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~CreateAppRequestDefaultTypeInternal() {}
-  union {
-    CreateAppRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CreateAppRequestDefaultTypeInternal _CreateAppRequest_default_instance_;
-
-inline constexpr CheckResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        reason_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        current_roles_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        suggest_roles_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        allowed_{false} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR CheckResponse::CheckResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct CheckResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR CheckResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~CheckResponseDefaultTypeInternal() {}
-  union {
-    CheckResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CheckResponseDefaultTypeInternal _CheckResponse_default_instance_;
-
-inline constexpr CheckRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        user_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        perm_key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        resource_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR CheckRequest::CheckRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct CheckRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR CheckRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~CheckRequestDefaultTypeInternal() {}
-  union {
-    CheckRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CheckRequestDefaultTypeInternal _CheckRequest_default_instance_;
-
-inline constexpr BatchCheckResponse_ResultItem::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        user_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        perm_key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        reason_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        allowed_{false} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR BatchCheckResponse_ResultItem::BatchCheckResponse_ResultItem(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct BatchCheckResponse_ResultItemDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR BatchCheckResponse_ResultItemDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~BatchCheckResponse_ResultItemDefaultTypeInternal() {}
-  union {
-    BatchCheckResponse_ResultItem _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchCheckResponse_ResultItemDefaultTypeInternal _BatchCheckResponse_ResultItem_default_instance_;
-
-inline constexpr BatchCheckRequest_CheckItem::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : user_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        perm_key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        resource_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR BatchCheckRequest_CheckItem::BatchCheckRequest_CheckItem(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct BatchCheckRequest_CheckItemDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR BatchCheckRequest_CheckItemDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~BatchCheckRequest_CheckItemDefaultTypeInternal() {}
-  union {
-    BatchCheckRequest_CheckItem _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchCheckRequest_CheckItemDefaultTypeInternal _BatchCheckRequest_CheckItem_default_instance_;
-
-inline constexpr AdminResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        message_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        app_secret_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        success_{false},
-        code_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR AdminResponse::AdminResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct AdminResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR AdminResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~AdminResponseDefaultTypeInternal() {}
-  union {
-    AdminResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AdminResponseDefaultTypeInternal _AdminResponse_default_instance_;
-
-inline constexpr AddPermissionToRoleRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        role_key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        perm_key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR AddPermissionToRoleRequest::AddPermissionToRoleRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct AddPermissionToRoleRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR AddPermissionToRoleRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~AddPermissionToRoleRequestDefaultTypeInternal() {}
-  union {
-    AddPermissionToRoleRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AddPermissionToRoleRequestDefaultTypeInternal _AddPermissionToRoleRequest_default_instance_;
-
-inline constexpr ListUserRolesResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : users_{},
-        total_{::int64_t{0}},
-        page_{0},
-        page_size_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR ListUserRolesResponse::ListUserRolesResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct ListUserRolesResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR ListUserRolesResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~ListUserRolesResponseDefaultTypeInternal() {}
-  union {
-    ListUserRolesResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListUserRolesResponseDefaultTypeInternal _ListUserRolesResponse_default_instance_;
-
-inline constexpr ListRolesResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : roles_{},
-        total_{::int64_t{0}},
-        page_{0},
-        page_size_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR ListRolesResponse::ListRolesResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct ListRolesResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR ListRolesResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~ListRolesResponseDefaultTypeInternal() {}
-  union {
-    ListRolesResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListRolesResponseDefaultTypeInternal _ListRolesResponse_default_instance_;
-
-inline constexpr ListPermissionsResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : permissions_{},
-        total_{::int64_t{0}},
-        page_{0},
-        page_size_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR ListPermissionsResponse::ListPermissionsResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct ListPermissionsResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR ListPermissionsResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~ListPermissionsResponseDefaultTypeInternal() {}
-  union {
-    ListPermissionsResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListPermissionsResponseDefaultTypeInternal _ListPermissionsResponse_default_instance_;
-
-inline constexpr ListAuditLogsResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : logs_{},
-        total_{::int64_t{0}},
-        page_{0},
-        page_size_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR ListAuditLogsResponse::ListAuditLogsResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct ListAuditLogsResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR ListAuditLogsResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~ListAuditLogsResponseDefaultTypeInternal() {}
-  union {
-    ListAuditLogsResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListAuditLogsResponseDefaultTypeInternal _ListAuditLogsResponse_default_instance_;
-
-inline constexpr ListAppsResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : apps_{},
-        total_{::int64_t{0}},
-        page_{0},
-        page_size_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR ListAppsResponse::ListAppsResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct ListAppsResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR ListAppsResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~ListAppsResponseDefaultTypeInternal() {}
-  union {
-    ListAppsResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListAppsResponseDefaultTypeInternal _ListAppsResponse_default_instance_;
-
-inline constexpr GetRoleUsersResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : users_{},
-        total_{::int64_t{0}},
-        page_{0},
-        page_size_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetRoleUsersResponse::GetRoleUsersResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetRoleUsersResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetRoleUsersResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetRoleUsersResponseDefaultTypeInternal() {}
-  union {
-    GetRoleUsersResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetRoleUsersResponseDefaultTypeInternal _GetRoleUsersResponse_default_instance_;
-
-inline constexpr BatchCheckResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : results_{},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR BatchCheckResponse::BatchCheckResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct BatchCheckResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR BatchCheckResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~BatchCheckResponseDefaultTypeInternal() {}
-  union {
-    BatchCheckResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchCheckResponseDefaultTypeInternal _BatchCheckResponse_default_instance_;
-
-inline constexpr BatchCheckRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : items_{},
-        app_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR BatchCheckRequest::BatchCheckRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct BatchCheckRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR BatchCheckRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~BatchCheckRequestDefaultTypeInternal() {}
-  union {
-    BatchCheckRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchCheckRequestDefaultTypeInternal _BatchCheckRequest_default_instance_;
-}  // namespace auth
-}  // namespace siqi
-static constexpr const ::_pb::EnumDescriptor**
-    file_level_enum_descriptors_auth_2eproto = nullptr;
-static const ::_pb::ServiceDescriptor*
-    file_level_service_descriptors_auth_2eproto[2];
-const ::uint32_t
-    TableStruct_auth_2eproto::offsets[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-        protodesc_cold) = {
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CheckRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CheckRequest, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CheckRequest, _impl_.user_id_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CheckRequest, _impl_.perm_key_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CheckRequest, _impl_.resource_id_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CheckResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CheckResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CheckResponse, _impl_.allowed_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CheckResponse, _impl_.reason_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CheckResponse, _impl_.current_roles_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CheckResponse, _impl_.suggest_roles_),
-        0,
-        ~0u,
-        ~0u,
-        ~0u,
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::BatchCheckRequest_CheckItem, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::BatchCheckRequest_CheckItem, _impl_.user_id_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::BatchCheckRequest_CheckItem, _impl_.perm_key_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::BatchCheckRequest_CheckItem, _impl_.resource_id_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::BatchCheckRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::BatchCheckRequest, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::BatchCheckRequest, _impl_.items_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::BatchCheckResponse_ResultItem, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::BatchCheckResponse_ResultItem, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::BatchCheckResponse_ResultItem, _impl_.user_id_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::BatchCheckResponse_ResultItem, _impl_.perm_key_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::BatchCheckResponse_ResultItem, _impl_.allowed_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::BatchCheckResponse_ResultItem, _impl_.reason_),
-        ~0u,
-        ~0u,
-        0,
-        ~0u,
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::BatchCheckResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::BatchCheckResponse, _impl_.results_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetUserPermissionsRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetUserPermissionsRequest, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetUserPermissionsRequest, _impl_.user_id_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetUserPermissionsResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetUserPermissionsResponse, _impl_.perm_keys_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetUserRolesRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetUserRolesRequest, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetUserRolesRequest, _impl_.user_id_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetUserRolesResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetUserRolesResponse, _impl_.role_keys_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CreateAppRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CreateAppRequest, _impl_.app_name_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CreateAppRequest, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CreateAppRequest, _impl_.description_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::UpdateAppRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::UpdateAppRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::UpdateAppRequest, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::UpdateAppRequest, _impl_.app_name_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::UpdateAppRequest, _impl_.description_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::UpdateAppRequest, _impl_.status_),
-        ~0u,
-        0,
-        1,
-        2,
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::DeleteAppRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::DeleteAppRequest, _impl_.app_code_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetAppRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetAppRequest, _impl_.app_code_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetAppResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetAppResponse, _impl_.id_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetAppResponse, _impl_.app_name_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetAppResponse, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetAppResponse, _impl_.app_secret_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetAppResponse, _impl_.description_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetAppResponse, _impl_.status_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetAppResponse, _impl_.created_at_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetAppResponse, _impl_.updated_at_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAppsRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAppsRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAppsRequest, _impl_.page_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAppsRequest, _impl_.page_size_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAppsRequest, _impl_.app_name_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAppsRequest, _impl_.status_),
-        ~0u,
-        ~0u,
-        0,
-        1,
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAppsResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAppsResponse, _impl_.apps_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAppsResponse, _impl_.total_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAppsResponse, _impl_.page_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAppsResponse, _impl_.page_size_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CreatePermissionRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CreatePermissionRequest, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CreatePermissionRequest, _impl_.perm_name_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CreatePermissionRequest, _impl_.perm_key_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CreatePermissionRequest, _impl_.description_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::UpdatePermissionRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::UpdatePermissionRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::UpdatePermissionRequest, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::UpdatePermissionRequest, _impl_.perm_key_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::UpdatePermissionRequest, _impl_.perm_name_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::UpdatePermissionRequest, _impl_.description_),
-        ~0u,
-        ~0u,
-        0,
-        1,
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::DeletePermissionRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::DeletePermissionRequest, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::DeletePermissionRequest, _impl_.perm_key_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListPermissionsRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListPermissionsRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListPermissionsRequest, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListPermissionsRequest, _impl_.page_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListPermissionsRequest, _impl_.page_size_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListPermissionsRequest, _impl_.perm_name_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListPermissionsRequest, _impl_.perm_key_),
-        ~0u,
-        ~0u,
-        ~0u,
-        0,
-        1,
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListPermissionsResponse_Permission, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListPermissionsResponse_Permission, _impl_.id_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListPermissionsResponse_Permission, _impl_.perm_name_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListPermissionsResponse_Permission, _impl_.perm_key_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListPermissionsResponse_Permission, _impl_.description_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListPermissionsResponse_Permission, _impl_.created_at_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListPermissionsResponse_Permission, _impl_.updated_at_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListPermissionsResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListPermissionsResponse, _impl_.permissions_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListPermissionsResponse, _impl_.total_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListPermissionsResponse, _impl_.page_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListPermissionsResponse, _impl_.page_size_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CreateRoleRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CreateRoleRequest, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CreateRoleRequest, _impl_.role_name_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CreateRoleRequest, _impl_.role_key_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CreateRoleRequest, _impl_.description_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::CreateRoleRequest, _impl_.is_default_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::UpdateRoleRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::UpdateRoleRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::UpdateRoleRequest, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::UpdateRoleRequest, _impl_.role_key_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::UpdateRoleRequest, _impl_.role_name_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::UpdateRoleRequest, _impl_.description_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::UpdateRoleRequest, _impl_.is_default_),
-        ~0u,
-        ~0u,
-        0,
-        1,
-        2,
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::DeleteRoleRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::DeleteRoleRequest, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::DeleteRoleRequest, _impl_.role_key_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListRolesRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListRolesRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListRolesRequest, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListRolesRequest, _impl_.page_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListRolesRequest, _impl_.page_size_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListRolesRequest, _impl_.role_name_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListRolesRequest, _impl_.role_key_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListRolesRequest, _impl_.is_default_),
-        ~0u,
-        ~0u,
-        ~0u,
-        0,
-        1,
-        2,
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListRolesResponse_Role, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListRolesResponse_Role, _impl_.id_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListRolesResponse_Role, _impl_.role_name_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListRolesResponse_Role, _impl_.role_key_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListRolesResponse_Role, _impl_.description_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListRolesResponse_Role, _impl_.is_default_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListRolesResponse_Role, _impl_.created_at_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListRolesResponse_Role, _impl_.updated_at_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListRolesResponse_Role, _impl_.perm_keys_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListRolesResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListRolesResponse, _impl_.roles_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListRolesResponse, _impl_.total_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListRolesResponse, _impl_.page_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListRolesResponse, _impl_.page_size_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::AddPermissionToRoleRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::AddPermissionToRoleRequest, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::AddPermissionToRoleRequest, _impl_.role_key_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::AddPermissionToRoleRequest, _impl_.perm_key_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::RemovePermissionFromRoleRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::RemovePermissionFromRoleRequest, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::RemovePermissionFromRoleRequest, _impl_.role_key_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::RemovePermissionFromRoleRequest, _impl_.perm_key_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetRolePermissionsRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetRolePermissionsRequest, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetRolePermissionsRequest, _impl_.role_key_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetRolePermissionsResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetRolePermissionsResponse, _impl_.perm_keys_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GrantRoleToUserRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GrantRoleToUserRequest, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GrantRoleToUserRequest, _impl_.user_id_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GrantRoleToUserRequest, _impl_.role_key_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::RevokeRoleFromUserRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::RevokeRoleFromUserRequest, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::RevokeRoleFromUserRequest, _impl_.user_id_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::RevokeRoleFromUserRequest, _impl_.role_key_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetRoleUsersRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetRoleUsersRequest, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetRoleUsersRequest, _impl_.role_key_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetRoleUsersRequest, _impl_.page_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetRoleUsersRequest, _impl_.page_size_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetRoleUsersResponse_User, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetRoleUsersResponse_User, _impl_.user_id_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetRoleUsersResponse_User, _impl_.created_at_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetRoleUsersResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetRoleUsersResponse, _impl_.users_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetRoleUsersResponse, _impl_.total_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetRoleUsersResponse, _impl_.page_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::GetRoleUsersResponse, _impl_.page_size_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsRequest, _impl_.page_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsRequest, _impl_.page_size_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsRequest, _impl_.operator_id_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsRequest, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsRequest, _impl_.action_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsRequest, _impl_.target_id_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsRequest, _impl_.start_time_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsRequest, _impl_.end_time_),
-        ~0u,
-        ~0u,
-        0,
-        1,
-        2,
-        3,
-        4,
-        5,
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsResponse_AuditLog, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsResponse_AuditLog, _impl_.id_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsResponse_AuditLog, _impl_.operator_id_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsResponse_AuditLog, _impl_.operator_name_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsResponse_AuditLog, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsResponse_AuditLog, _impl_.action_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsResponse_AuditLog, _impl_.target_type_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsResponse_AuditLog, _impl_.target_id_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsResponse_AuditLog, _impl_.target_name_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsResponse_AuditLog, _impl_.object_type_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsResponse_AuditLog, _impl_.object_id_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsResponse_AuditLog, _impl_.object_name_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsResponse_AuditLog, _impl_.created_at_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsResponse, _impl_.logs_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsResponse, _impl_.total_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsResponse, _impl_.page_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListAuditLogsResponse, _impl_.page_size_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::AdminResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::AdminResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::AdminResponse, _impl_.success_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::AdminResponse, _impl_.code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::AdminResponse, _impl_.message_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::AdminResponse, _impl_.app_secret_),
-        ~0u,
-        ~0u,
-        ~0u,
-        0,
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::LoginRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::LoginRequest, _impl_.username_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::LoginRequest, _impl_.password_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::LoginResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::LoginResponse, _impl_.success_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::LoginResponse, _impl_.message_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::LoginResponse, _impl_.token_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListUserRolesRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListUserRolesRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListUserRolesRequest, _impl_.app_code_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListUserRolesRequest, _impl_.page_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListUserRolesRequest, _impl_.page_size_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListUserRolesRequest, _impl_.user_id_),
-        ~0u,
-        ~0u,
-        ~0u,
-        0,
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListUserRolesResponse_UserRoleInfo, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListUserRolesResponse_UserRoleInfo, _impl_.user_id_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListUserRolesResponse_UserRoleInfo, _impl_.role_keys_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListUserRolesResponse_UserRoleInfo, _impl_.created_at_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListUserRolesResponse_UserRoleInfo, _impl_.perm_keys_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListUserRolesResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListUserRolesResponse, _impl_.users_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListUserRolesResponse, _impl_.total_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListUserRolesResponse, _impl_.page_),
-        PROTOBUF_FIELD_OFFSET(::siqi::auth::ListUserRolesResponse, _impl_.page_size_),
-};
-
-static const ::_pbi::MigrationSchema
-    schemas[] ABSL_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-        {0, -1, -1, sizeof(::siqi::auth::CheckRequest)},
-        {12, 24, -1, sizeof(::siqi::auth::CheckResponse)},
-        {28, -1, -1, sizeof(::siqi::auth::BatchCheckRequest_CheckItem)},
-        {39, -1, -1, sizeof(::siqi::auth::BatchCheckRequest)},
-        {49, 61, -1, sizeof(::siqi::auth::BatchCheckResponse_ResultItem)},
-        {65, -1, -1, sizeof(::siqi::auth::BatchCheckResponse)},
-        {74, -1, -1, sizeof(::siqi::auth::GetUserPermissionsRequest)},
-        {84, -1, -1, sizeof(::siqi::auth::GetUserPermissionsResponse)},
-        {93, -1, -1, sizeof(::siqi::auth::GetUserRolesRequest)},
-        {103, -1, -1, sizeof(::siqi::auth::GetUserRolesResponse)},
-        {112, -1, -1, sizeof(::siqi::auth::CreateAppRequest)},
-        {123, 135, -1, sizeof(::siqi::auth::UpdateAppRequest)},
-        {139, -1, -1, sizeof(::siqi::auth::DeleteAppRequest)},
-        {148, -1, -1, sizeof(::siqi::auth::GetAppRequest)},
-        {157, -1, -1, sizeof(::siqi::auth::GetAppResponse)},
-        {173, 185, -1, sizeof(::siqi::auth::ListAppsRequest)},
-        {189, -1, -1, sizeof(::siqi::auth::ListAppsResponse)},
-        {201, -1, -1, sizeof(::siqi::auth::CreatePermissionRequest)},
-        {213, 225, -1, sizeof(::siqi::auth::UpdatePermissionRequest)},
-        {229, -1, -1, sizeof(::siqi::auth::DeletePermissionRequest)},
-        {239, 252, -1, sizeof(::siqi::auth::ListPermissionsRequest)},
-        {257, -1, -1, sizeof(::siqi::auth::ListPermissionsResponse_Permission)},
-        {271, -1, -1, sizeof(::siqi::auth::ListPermissionsResponse)},
-        {283, -1, -1, sizeof(::siqi::auth::CreateRoleRequest)},
-        {296, 309, -1, sizeof(::siqi::auth::UpdateRoleRequest)},
-        {314, -1, -1, sizeof(::siqi::auth::DeleteRoleRequest)},
-        {324, 338, -1, sizeof(::siqi::auth::ListRolesRequest)},
-        {344, -1, -1, sizeof(::siqi::auth::ListRolesResponse_Role)},
-        {360, -1, -1, sizeof(::siqi::auth::ListRolesResponse)},
-        {372, -1, -1, sizeof(::siqi::auth::AddPermissionToRoleRequest)},
-        {383, -1, -1, sizeof(::siqi::auth::RemovePermissionFromRoleRequest)},
-        {394, -1, -1, sizeof(::siqi::auth::GetRolePermissionsRequest)},
-        {404, -1, -1, sizeof(::siqi::auth::GetRolePermissionsResponse)},
-        {413, -1, -1, sizeof(::siqi::auth::GrantRoleToUserRequest)},
-        {424, -1, -1, sizeof(::siqi::auth::RevokeRoleFromUserRequest)},
-        {435, -1, -1, sizeof(::siqi::auth::GetRoleUsersRequest)},
-        {447, -1, -1, sizeof(::siqi::auth::GetRoleUsersResponse_User)},
-        {457, -1, -1, sizeof(::siqi::auth::GetRoleUsersResponse)},
-        {469, 485, -1, sizeof(::siqi::auth::ListAuditLogsRequest)},
-        {493, -1, -1, sizeof(::siqi::auth::ListAuditLogsResponse_AuditLog)},
-        {513, -1, -1, sizeof(::siqi::auth::ListAuditLogsResponse)},
-        {525, 537, -1, sizeof(::siqi::auth::AdminResponse)},
-        {541, -1, -1, sizeof(::siqi::auth::LoginRequest)},
-        {551, -1, -1, sizeof(::siqi::auth::LoginResponse)},
-        {562, 574, -1, sizeof(::siqi::auth::ListUserRolesRequest)},
-        {578, -1, -1, sizeof(::siqi::auth::ListUserRolesResponse_UserRoleInfo)},
-        {590, -1, -1, sizeof(::siqi::auth::ListUserRolesResponse)},
-};
-static const ::_pb::Message* const file_default_instances[] = {
-    &::siqi::auth::_CheckRequest_default_instance_._instance,
-    &::siqi::auth::_CheckResponse_default_instance_._instance,
-    &::siqi::auth::_BatchCheckRequest_CheckItem_default_instance_._instance,
-    &::siqi::auth::_BatchCheckRequest_default_instance_._instance,
-    &::siqi::auth::_BatchCheckResponse_ResultItem_default_instance_._instance,
-    &::siqi::auth::_BatchCheckResponse_default_instance_._instance,
-    &::siqi::auth::_GetUserPermissionsRequest_default_instance_._instance,
-    &::siqi::auth::_GetUserPermissionsResponse_default_instance_._instance,
-    &::siqi::auth::_GetUserRolesRequest_default_instance_._instance,
-    &::siqi::auth::_GetUserRolesResponse_default_instance_._instance,
-    &::siqi::auth::_CreateAppRequest_default_instance_._instance,
-    &::siqi::auth::_UpdateAppRequest_default_instance_._instance,
-    &::siqi::auth::_DeleteAppRequest_default_instance_._instance,
-    &::siqi::auth::_GetAppRequest_default_instance_._instance,
-    &::siqi::auth::_GetAppResponse_default_instance_._instance,
-    &::siqi::auth::_ListAppsRequest_default_instance_._instance,
-    &::siqi::auth::_ListAppsResponse_default_instance_._instance,
-    &::siqi::auth::_CreatePermissionRequest_default_instance_._instance,
-    &::siqi::auth::_UpdatePermissionRequest_default_instance_._instance,
-    &::siqi::auth::_DeletePermissionRequest_default_instance_._instance,
-    &::siqi::auth::_ListPermissionsRequest_default_instance_._instance,
-    &::siqi::auth::_ListPermissionsResponse_Permission_default_instance_._instance,
-    &::siqi::auth::_ListPermissionsResponse_default_instance_._instance,
-    &::siqi::auth::_CreateRoleRequest_default_instance_._instance,
-    &::siqi::auth::_UpdateRoleRequest_default_instance_._instance,
-    &::siqi::auth::_DeleteRoleRequest_default_instance_._instance,
-    &::siqi::auth::_ListRolesRequest_default_instance_._instance,
-    &::siqi::auth::_ListRolesResponse_Role_default_instance_._instance,
-    &::siqi::auth::_ListRolesResponse_default_instance_._instance,
-    &::siqi::auth::_AddPermissionToRoleRequest_default_instance_._instance,
-    &::siqi::auth::_RemovePermissionFromRoleRequest_default_instance_._instance,
-    &::siqi::auth::_GetRolePermissionsRequest_default_instance_._instance,
-    &::siqi::auth::_GetRolePermissionsResponse_default_instance_._instance,
-    &::siqi::auth::_GrantRoleToUserRequest_default_instance_._instance,
-    &::siqi::auth::_RevokeRoleFromUserRequest_default_instance_._instance,
-    &::siqi::auth::_GetRoleUsersRequest_default_instance_._instance,
-    &::siqi::auth::_GetRoleUsersResponse_User_default_instance_._instance,
-    &::siqi::auth::_GetRoleUsersResponse_default_instance_._instance,
-    &::siqi::auth::_ListAuditLogsRequest_default_instance_._instance,
-    &::siqi::auth::_ListAuditLogsResponse_AuditLog_default_instance_._instance,
-    &::siqi::auth::_ListAuditLogsResponse_default_instance_._instance,
-    &::siqi::auth::_AdminResponse_default_instance_._instance,
-    &::siqi::auth::_LoginRequest_default_instance_._instance,
-    &::siqi::auth::_LoginResponse_default_instance_._instance,
-    &::siqi::auth::_ListUserRolesRequest_default_instance_._instance,
-    &::siqi::auth::_ListUserRolesResponse_UserRoleInfo_default_instance_._instance,
-    &::siqi::auth::_ListUserRolesResponse_default_instance_._instance,
-};
-const char descriptor_table_protodef_auth_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-    protodesc_cold) = {
-    "\n\nauth.proto\022\tsiqi.auth\"X\n\014CheckRequest\022"
-    "\020\n\010app_code\030\001 \001(\t\022\017\n\007user_id\030\002 \001(\t\022\020\n\010pe"
-    "rm_key\030\003 \001(\t\022\023\n\013resource_id\030\004 \001(\t\"o\n\rChe"
-    "ckResponse\022\024\n\007allowed\030\001 \001(\010H\000\210\001\001\022\016\n\006reas"
-    "on\030\002 \001(\t\022\025\n\rcurrent_roles\030\003 \001(\t\022\025\n\rsugge"
-    "st_roles\030\004 \001(\tB\n\n\010_allowed\"\241\001\n\021BatchChec"
-    "kRequest\022\020\n\010app_code\030\001 \001(\t\0225\n\005items\030\002 \003("
-    "\0132&.siqi.auth.BatchCheckRequest.CheckIte"
-    "m\032C\n\tCheckItem\022\017\n\007user_id\030\001 \001(\t\022\020\n\010perm_"
-    "key\030\002 \001(\t\022\023\n\013resource_id\030\003 \001(\t\"\262\001\n\022Batch"
-    "CheckResponse\0229\n\007results\030\001 \003(\0132(.siqi.au"
-    "th.BatchCheckResponse.ResultItem\032a\n\nResu"
-    "ltItem\022\017\n\007user_id\030\001 \001(\t\022\020\n\010perm_key\030\002 \001("
-    "\t\022\024\n\007allowed\030\003 \001(\010H\000\210\001\001\022\016\n\006reason\030\004 \001(\tB"
-    "\n\n\010_allowed\">\n\031GetUserPermissionsRequest"
-    "\022\020\n\010app_code\030\001 \001(\t\022\017\n\007user_id\030\002 \001(\t\"/\n\032G"
-    "etUserPermissionsResponse\022\021\n\tperm_keys\030\001"
-    " \003(\t\"8\n\023GetUserRolesRequest\022\020\n\010app_code\030"
-    "\001 \001(\t\022\017\n\007user_id\030\002 \001(\t\")\n\024GetUserRolesRe"
-    "sponse\022\021\n\trole_keys\030\001 \003(\t\"K\n\020CreateAppRe"
-    "quest\022\020\n\010app_name\030\002 \001(\t\022\020\n\010app_code\030\003 \001("
-    "\t\022\023\n\013description\030\004 \001(\t\"\222\001\n\020UpdateAppRequ"
-    "est\022\020\n\010app_code\030\002 \001(\t\022\025\n\010app_name\030\003 \001(\tH"
-    "\000\210\001\001\022\030\n\013description\030\004 \001(\tH\001\210\001\001\022\023\n\006status"
-    "\030\005 \001(\005H\002\210\001\001B\013\n\t_app_nameB\016\n\014_description"
-    "B\t\n\007_status\"$\n\020DeleteAppRequest\022\020\n\010app_c"
-    "ode\030\002 \001(\t\"!\n\rGetAppRequest\022\020\n\010app_code\030\001"
-    " \001(\t\"\241\001\n\016GetAppResponse\022\n\n\002id\030\001 \001(\003\022\020\n\010a"
-    "pp_name\030\002 \001(\t\022\020\n\010app_code\030\003 \001(\t\022\022\n\napp_s"
-    "ecret\030\004 \001(\t\022\023\n\013description\030\005 \001(\t\022\016\n\006stat"
-    "us\030\006 \001(\005\022\022\n\ncreated_at\030\007 \001(\t\022\022\n\nupdated_"
-    "at\030\010 \001(\t\"v\n\017ListAppsRequest\022\014\n\004page\030\001 \001("
-    "\005\022\021\n\tpage_size\030\002 \001(\005\022\025\n\010app_name\030\003 \001(\tH\000"
-    "\210\001\001\022\023\n\006status\030\004 \001(\005H\001\210\001\001B\013\n\t_app_nameB\t\n"
-    "\007_status\"k\n\020ListAppsResponse\022\'\n\004apps\030\001 \003"
-    "(\0132\031.siqi.auth.GetAppResponse\022\r\n\005total\030\002"
-    " \001(\003\022\014\n\004page\030\003 \001(\005\022\021\n\tpage_size\030\004 \001(\005\"e\n"
-    "\027CreatePermissionRequest\022\020\n\010app_code\030\002 \001"
-    "(\t\022\021\n\tperm_name\030\003 \001(\t\022\020\n\010perm_key\030\004 \001(\t\022"
-    "\023\n\013description\030\005 \001(\t\"\215\001\n\027UpdatePermissio"
-    "nRequest\022\020\n\010app_code\030\002 \001(\t\022\020\n\010perm_key\030\003"
-    " \001(\t\022\026\n\tperm_name\030\004 \001(\tH\000\210\001\001\022\030\n\013descript"
-    "ion\030\005 \001(\tH\001\210\001\001B\014\n\n_perm_nameB\016\n\014_descrip"
-    "tion\"=\n\027DeletePermissionRequest\022\020\n\010app_c"
-    "ode\030\002 \001(\t\022\020\n\010perm_key\030\003 \001(\t\"\225\001\n\026ListPerm"
-    "issionsRequest\022\020\n\010app_code\030\001 \001(\t\022\014\n\004page"
-    "\030\002 \001(\005\022\021\n\tpage_size\030\003 \001(\005\022\026\n\tperm_name\030\004"
-    " \001(\tH\000\210\001\001\022\025\n\010perm_key\030\005 \001(\tH\001\210\001\001B\014\n\n_per"
-    "m_nameB\013\n\t_perm_key\"\211\002\n\027ListPermissionsR"
-    "esponse\022B\n\013permissions\030\001 \003(\0132-.siqi.auth"
-    ".ListPermissionsResponse.Permission\022\r\n\005t"
-    "otal\030\002 \001(\003\022\014\n\004page\030\003 \001(\005\022\021\n\tpage_size\030\004 "
-    "\001(\005\032z\n\nPermission\022\n\n\002id\030\001 \001(\003\022\021\n\tperm_na"
-    "me\030\002 \001(\t\022\020\n\010perm_key\030\003 \001(\t\022\023\n\013descriptio"
-    "n\030\004 \001(\t\022\022\n\ncreated_at\030\005 \001(\t\022\022\n\nupdated_a"
-    "t\030\006 \001(\t\"s\n\021CreateRoleRequest\022\020\n\010app_code"
-    "\030\002 \001(\t\022\021\n\trole_name\030\003 \001(\t\022\020\n\010role_key\030\004 "
-    "\001(\t\022\023\n\013description\030\005 \001(\t\022\022\n\nis_default\030\006"
-    " \001(\010\"\257\001\n\021UpdateRoleRequest\022\020\n\010app_code\030\002"
-    " \001(\t\022\020\n\010role_key\030\003 \001(\t\022\026\n\trole_name\030\004 \001("
-    "\tH\000\210\001\001\022\030\n\013description\030\005 \001(\tH\001\210\001\001\022\027\n\nis_d"
-    "efault\030\006 \001(\010H\002\210\001\001B\014\n\n_role_nameB\016\n\014_desc"
-    "riptionB\r\n\013_is_default\"7\n\021DeleteRoleRequ"
-    "est\022\020\n\010app_code\030\002 \001(\t\022\020\n\010role_key\030\003 \001(\t\""
-    "\267\001\n\020ListRolesRequest\022\020\n\010app_code\030\001 \001(\t\022\014"
-    "\n\004page\030\002 \001(\005\022\021\n\tpage_size\030\003 \001(\005\022\026\n\trole_"
-    "name\030\004 \001(\tH\000\210\001\001\022\025\n\010role_key\030\005 \001(\tH\001\210\001\001\022\027"
-    "\n\nis_default\030\006 \001(\010H\002\210\001\001B\014\n\n_role_nameB\013\n"
-    "\t_role_keyB\r\n\013_is_default\"\223\002\n\021ListRolesR"
-    "esponse\0220\n\005roles\030\001 \003(\0132!.siqi.auth.ListR"
-    "olesResponse.Role\022\r\n\005total\030\002 \001(\003\022\014\n\004page"
-    "\030\003 \001(\005\022\021\n\tpage_size\030\004 \001(\005\032\233\001\n\004Role\022\n\n\002id"
-    "\030\001 \001(\003\022\021\n\trole_name\030\002 \001(\t\022\020\n\010role_key\030\003 "
-    "\001(\t\022\023\n\013description\030\004 \001(\t\022\022\n\nis_default\030\005"
-    " \001(\010\022\022\n\ncreated_at\030\006 \001(\t\022\022\n\nupdated_at\030\007"
-    " \001(\t\022\021\n\tperm_keys\030\010 \003(\t\"R\n\032AddPermission"
-    "ToRoleRequest\022\020\n\010app_code\030\002 \001(\t\022\020\n\010role_"
-    "key\030\003 \001(\t\022\020\n\010perm_key\030\004 \001(\t\"W\n\037RemovePer"
-    "missionFromRoleRequest\022\020\n\010app_code\030\002 \001(\t"
-    "\022\020\n\010role_key\030\003 \001(\t\022\020\n\010perm_key\030\004 \001(\t\"\?\n\031"
-    "GetRolePermissionsRequest\022\020\n\010app_code\030\001 "
-    "\001(\t\022\020\n\010role_key\030\002 \001(\t\"/\n\032GetRolePermissi"
-    "onsResponse\022\021\n\tperm_keys\030\001 \003(\t\"M\n\026GrantR"
-    "oleToUserRequest\022\020\n\010app_code\030\002 \001(\t\022\017\n\007us"
-    "er_id\030\003 \001(\t\022\020\n\010role_key\030\004 \001(\t\"P\n\031RevokeR"
-    "oleFromUserRequest\022\020\n\010app_code\030\002 \001(\t\022\017\n\007"
-    "user_id\030\003 \001(\t\022\020\n\010role_key\030\004 \001(\t\"Z\n\023GetRo"
-    "leUsersRequest\022\020\n\010app_code\030\001 \001(\t\022\020\n\010role"
-    "_key\030\002 \001(\t\022\014\n\004page\030\003 \001(\005\022\021\n\tpage_size\030\004 "
-    "\001(\005\"\250\001\n\024GetRoleUsersResponse\0223\n\005users\030\001 "
-    "\003(\0132$.siqi.auth.GetRoleUsersResponse.Use"
-    "r\022\r\n\005total\030\002 \001(\003\022\014\n\004page\030\003 \001(\005\022\021\n\tpage_s"
-    "ize\030\004 \001(\005\032+\n\004User\022\017\n\007user_id\030\001 \001(\t\022\022\n\ncr"
-    "eated_at\030\002 \001(\t\"\227\002\n\024ListAuditLogsRequest\022"
-    "\014\n\004page\030\001 \001(\005\022\021\n\tpage_size\030\002 \001(\005\022\030\n\013oper"
-    "ator_id\030\003 \001(\tH\000\210\001\001\022\025\n\010app_code\030\004 \001(\tH\001\210\001"
-    "\001\022\023\n\006action\030\005 \001(\tH\002\210\001\001\022\026\n\ttarget_id\030\006 \001("
-    "\tH\003\210\001\001\022\027\n\nstart_time\030\007 \001(\003H\004\210\001\001\022\025\n\010end_t"
-    "ime\030\010 \001(\003H\005\210\001\001B\016\n\014_operator_idB\013\n\t_app_c"
-    "odeB\t\n\007_actionB\014\n\n_target_idB\r\n\013_start_t"
-    "imeB\013\n\t_end_time\"\365\002\n\025ListAuditLogsRespon"
-    "se\0227\n\004logs\030\001 \003(\0132).siqi.auth.ListAuditLo"
-    "gsResponse.AuditLog\022\r\n\005total\030\002 \001(\003\022\014\n\004pa"
-    "ge\030\003 \001(\005\022\021\n\tpage_size\030\004 \001(\005\032\362\001\n\010AuditLog"
-    "\022\n\n\002id\030\001 \001(\003\022\023\n\013operator_id\030\002 \001(\003\022\025\n\rope"
-    "rator_name\030\003 \001(\t\022\020\n\010app_code\030\004 \001(\t\022\016\n\006ac"
-    "tion\030\005 \001(\t\022\023\n\013target_type\030\006 \001(\t\022\021\n\ttarge"
-    "t_id\030\007 \001(\t\022\023\n\013target_name\030\010 \001(\t\022\023\n\013objec"
-    "t_type\030\t \001(\t\022\021\n\tobject_id\030\n \001(\t\022\023\n\013objec"
-    "t_name\030\013 \001(\t\022\022\n\ncreated_at\030\014 \001(\t\"g\n\rAdmi"
-    "nResponse\022\017\n\007success\030\001 \001(\010\022\014\n\004code\030\002 \001(\005"
-    "\022\017\n\007message\030\003 \001(\t\022\027\n\napp_secret\030\004 \001(\tH\000\210"
-    "\001\001B\r\n\013_app_secret\"2\n\014LoginRequest\022\020\n\010use"
-    "rname\030\001 \001(\t\022\020\n\010password\030\002 \001(\t\"@\n\rLoginRe"
-    "sponse\022\017\n\007success\030\001 \001(\010\022\017\n\007message\030\002 \001(\t"
-    "\022\r\n\005token\030\003 \001(\t\"k\n\024ListUserRolesRequest\022"
-    "\020\n\010app_code\030\001 \001(\t\022\014\n\004page\030\002 \001(\005\022\021\n\tpage_"
-    "size\030\003 \001(\005\022\024\n\007user_id\030\004 \001(\tH\000\210\001\001B\n\n\010_use"
-    "r_id\"\340\001\n\025ListUserRolesResponse\022<\n\005users\030"
-    "\001 \003(\0132-.siqi.auth.ListUserRolesResponse."
-    "UserRoleInfo\022\r\n\005total\030\002 \001(\003\022\014\n\004page\030\003 \001("
-    "\005\022\021\n\tpage_size\030\004 \001(\005\032Y\n\014UserRoleInfo\022\017\n\007"
-    "user_id\030\001 \001(\t\022\021\n\trole_keys\030\002 \003(\t\022\022\n\ncrea"
-    "ted_at\030\003 \001(\t\022\021\n\tperm_keys\030\004 \003(\t2\310\002\n\013Auth"
-    "Service\022:\n\005Check\022\027.siqi.auth.CheckReques"
-    "t\032\030.siqi.auth.CheckResponse\022I\n\nBatchChec"
-    "k\022\034.siqi.auth.BatchCheckRequest\032\035.siqi.a"
-    "uth.BatchCheckResponse\022a\n\022GetUserPermiss"
-    "ions\022$.siqi.auth.GetUserPermissionsReque"
-    "st\032%.siqi.auth.GetUserPermissionsRespons"
-    "e\022O\n\014GetUserRoles\022\036.siqi.auth.GetUserRol"
-    "esRequest\032\037.siqi.auth.GetUserRolesRespon"
-    "se2\300\r\n\014AdminService\022B\n\tCreateApp\022\033.siqi."
-    "auth.CreateAppRequest\032\030.siqi.auth.AdminR"
-    "esponse\022B\n\tUpdateApp\022\033.siqi.auth.UpdateA"
-    "ppRequest\032\030.siqi.auth.AdminResponse\022B\n\tD"
-    "eleteApp\022\033.siqi.auth.DeleteAppRequest\032\030."
-    "siqi.auth.AdminResponse\022=\n\006GetApp\022\030.siqi"
-    ".auth.GetAppRequest\032\031.siqi.auth.GetAppRe"
-    "sponse\022C\n\010ListApps\022\032.siqi.auth.ListAppsR"
-    "equest\032\033.siqi.auth.ListAppsResponse\022:\n\005L"
-    "ogin\022\027.siqi.auth.LoginRequest\032\030.siqi.aut"
-    "h.LoginResponse\022P\n\020CreatePermission\022\".si"
-    "qi.auth.CreatePermissionRequest\032\030.siqi.a"
-    "uth.AdminResponse\022P\n\020UpdatePermission\022\"."
-    "siqi.auth.UpdatePermissionRequest\032\030.siqi"
-    ".auth.AdminResponse\022P\n\020DeletePermission\022"
-    "\".siqi.auth.DeletePermissionRequest\032\030.si"
-    "qi.auth.AdminResponse\022X\n\017ListPermissions"
-    "\022!.siqi.auth.ListPermissionsRequest\032\".si"
-    "qi.auth.ListPermissionsResponse\022D\n\nCreat"
-    "eRole\022\034.siqi.auth.CreateRoleRequest\032\030.si"
-    "qi.auth.AdminResponse\022D\n\nUpdateRole\022\034.si"
-    "qi.auth.UpdateRoleRequest\032\030.siqi.auth.Ad"
-    "minResponse\022D\n\nDeleteRole\022\034.siqi.auth.De"
-    "leteRoleRequest\032\030.siqi.auth.AdminRespons"
-    "e\022F\n\tListRoles\022\033.siqi.auth.ListRolesRequ"
-    "est\032\034.siqi.auth.ListRolesResponse\022V\n\023Add"
-    "PermissionToRole\022%.siqi.auth.AddPermissi"
-    "onToRoleRequest\032\030.siqi.auth.AdminRespons"
-    "e\022`\n\030RemovePermissionFromRole\022*.siqi.aut"
-    "h.RemovePermissionFromRoleRequest\032\030.siqi"
-    ".auth.AdminResponse\022a\n\022GetRolePermission"
-    "s\022$.siqi.auth.GetRolePermissionsRequest\032"
-    "%.siqi.auth.GetRolePermissionsResponse\022N"
-    "\n\017GrantRoleToUser\022!.siqi.auth.GrantRoleT"
-    "oUserRequest\032\030.siqi.auth.AdminResponse\022T"
-    "\n\022RevokeRoleFromUser\022$.siqi.auth.RevokeR"
-    "oleFromUserRequest\032\030.siqi.auth.AdminResp"
-    "onse\022O\n\014GetRoleUsers\022\036.siqi.auth.GetRole"
-    "UsersRequest\032\037.siqi.auth.GetRoleUsersRes"
-    "ponse\022R\n\rListUserRoles\022\037.siqi.auth.ListU"
-    "serRolesRequest\032 .siqi.auth.ListUserRole"
-    "sResponse\022R\n\rListAuditLogs\022\037.siqi.auth.L"
-    "istAuditLogsRequest\032 .siqi.auth.ListAudi"
-    "tLogsResponseB\003\200\001\001b\006proto3"
-};
-static ::absl::once_flag descriptor_table_auth_2eproto_once;
-PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_auth_2eproto = {
-    false,
-    false,
-    7026,
-    descriptor_table_protodef_auth_2eproto,
-    "auth.proto",
-    &descriptor_table_auth_2eproto_once,
-    nullptr,
-    0,
-    47,
-    schemas,
-    file_default_instances,
-    TableStruct_auth_2eproto::offsets,
-    file_level_enum_descriptors_auth_2eproto,
-    file_level_service_descriptors_auth_2eproto,
-};
-namespace siqi {
-namespace auth {
-// ===================================================================
-
-class CheckRequest::_Internal {
- public:
-};
-
-CheckRequest::CheckRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.CheckRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE CheckRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::CheckRequest& from_msg)
-      : app_code_(arena, from.app_code_),
-        user_id_(arena, from.user_id_),
-        perm_key_(arena, from.perm_key_),
-        resource_id_(arena, from.resource_id_),
-        _cached_size_{0} {}
-
-CheckRequest::CheckRequest(
-    ::google::protobuf::Arena* arena,
-    const CheckRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  CheckRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.CheckRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE CheckRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : app_code_(arena),
-        user_id_(arena),
-        perm_key_(arena),
-        resource_id_(arena),
-        _cached_size_{0} {}
-
-inline void CheckRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-CheckRequest::~CheckRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.CheckRequest)
-  SharedDtor(*this);
-}
-inline void CheckRequest::SharedDtor(MessageLite& self) {
-  CheckRequest& this_ = static_cast<CheckRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.user_id_.Destroy();
-  this_._impl_.perm_key_.Destroy();
-  this_._impl_.resource_id_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* CheckRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) CheckRequest(arena);
-}
-constexpr auto CheckRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(CheckRequest),
-                                            alignof(CheckRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull CheckRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_CheckRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &CheckRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<CheckRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &CheckRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<CheckRequest>(), &CheckRequest::ByteSizeLong,
-            &CheckRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(CheckRequest, _impl_._cached_size_),
-        false,
-    },
-    &CheckRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* CheckRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 0, 65, 2> CheckRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::CheckRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string resource_id = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(CheckRequest, _impl_.resource_id_)}},
-    // string app_code = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(CheckRequest, _impl_.app_code_)}},
-    // string user_id = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(CheckRequest, _impl_.user_id_)}},
-    // string perm_key = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(CheckRequest, _impl_.perm_key_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string app_code = 1;
-    {PROTOBUF_FIELD_OFFSET(CheckRequest, _impl_.app_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string user_id = 2;
-    {PROTOBUF_FIELD_OFFSET(CheckRequest, _impl_.user_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string perm_key = 3;
-    {PROTOBUF_FIELD_OFFSET(CheckRequest, _impl_.perm_key_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string resource_id = 4;
-    {PROTOBUF_FIELD_OFFSET(CheckRequest, _impl_.resource_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\26\10\7\10\13\0\0\0"
-    "siqi.auth.CheckRequest"
-    "app_code"
-    "user_id"
-    "perm_key"
-    "resource_id"
-  }},
-};
-
-PROTOBUF_NOINLINE void CheckRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.CheckRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.app_code_.ClearToEmpty();
-  _impl_.user_id_.ClearToEmpty();
-  _impl_.perm_key_.ClearToEmpty();
-  _impl_.resource_id_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* CheckRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const CheckRequest& this_ = static_cast<const CheckRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* CheckRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const CheckRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.CheckRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string app_code = 1;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.CheckRequest.app_code");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // string user_id = 2;
-          if (!this_._internal_user_id().empty()) {
-            const std::string& _s = this_._internal_user_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.CheckRequest.user_id");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string perm_key = 3;
-          if (!this_._internal_perm_key().empty()) {
-            const std::string& _s = this_._internal_perm_key();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.CheckRequest.perm_key");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // string resource_id = 4;
-          if (!this_._internal_resource_id().empty()) {
-            const std::string& _s = this_._internal_resource_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.CheckRequest.resource_id");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.CheckRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t CheckRequest::ByteSizeLong(const MessageLite& base) {
-          const CheckRequest& this_ = static_cast<const CheckRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t CheckRequest::ByteSizeLong() const {
-          const CheckRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.CheckRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string app_code = 1;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-            // string user_id = 2;
-            if (!this_._internal_user_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_user_id());
-            }
-            // string perm_key = 3;
-            if (!this_._internal_perm_key().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_perm_key());
-            }
-            // string resource_id = 4;
-            if (!this_._internal_resource_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_resource_id());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void CheckRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<CheckRequest*>(&to_msg);
-  auto& from = static_cast<const CheckRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.CheckRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  if (!from._internal_user_id().empty()) {
-    _this->_internal_set_user_id(from._internal_user_id());
-  }
-  if (!from._internal_perm_key().empty()) {
-    _this->_internal_set_perm_key(from._internal_perm_key());
-  }
-  if (!from._internal_resource_id().empty()) {
-    _this->_internal_set_resource_id(from._internal_resource_id());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void CheckRequest::CopyFrom(const CheckRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.CheckRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void CheckRequest::InternalSwap(CheckRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.user_id_, &other->_impl_.user_id_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.perm_key_, &other->_impl_.perm_key_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.resource_id_, &other->_impl_.resource_id_, arena);
-}
-
-::google::protobuf::Metadata CheckRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class CheckResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<CheckResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(CheckResponse, _impl_._has_bits_);
-};
-
-CheckResponse::CheckResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.CheckResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE CheckResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::CheckResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        reason_(arena, from.reason_),
-        current_roles_(arena, from.current_roles_),
-        suggest_roles_(arena, from.suggest_roles_) {}
-
-CheckResponse::CheckResponse(
-    ::google::protobuf::Arena* arena,
-    const CheckResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  CheckResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.allowed_ = from._impl_.allowed_;
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.CheckResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE CheckResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        reason_(arena),
-        current_roles_(arena),
-        suggest_roles_(arena) {}
-
-inline void CheckResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.allowed_ = {};
-}
-CheckResponse::~CheckResponse() {
-  // @@protoc_insertion_point(destructor:siqi.auth.CheckResponse)
-  SharedDtor(*this);
-}
-inline void CheckResponse::SharedDtor(MessageLite& self) {
-  CheckResponse& this_ = static_cast<CheckResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.reason_.Destroy();
-  this_._impl_.current_roles_.Destroy();
-  this_._impl_.suggest_roles_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* CheckResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) CheckResponse(arena);
-}
-constexpr auto CheckResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(CheckResponse),
-                                            alignof(CheckResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull CheckResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_CheckResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &CheckResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<CheckResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &CheckResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<CheckResponse>(), &CheckResponse::ByteSizeLong,
-            &CheckResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(CheckResponse, _impl_._cached_size_),
-        false,
-    },
-    &CheckResponse::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* CheckResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 0, 64, 2> CheckResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(CheckResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::CheckResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string suggest_roles = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(CheckResponse, _impl_.suggest_roles_)}},
-    // optional bool allowed = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(CheckResponse, _impl_.allowed_), 0>(),
-     {8, 0, 0, PROTOBUF_FIELD_OFFSET(CheckResponse, _impl_.allowed_)}},
-    // string reason = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(CheckResponse, _impl_.reason_)}},
-    // string current_roles = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(CheckResponse, _impl_.current_roles_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // optional bool allowed = 1;
-    {PROTOBUF_FIELD_OFFSET(CheckResponse, _impl_.allowed_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kBool)},
-    // string reason = 2;
-    {PROTOBUF_FIELD_OFFSET(CheckResponse, _impl_.reason_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string current_roles = 3;
-    {PROTOBUF_FIELD_OFFSET(CheckResponse, _impl_.current_roles_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string suggest_roles = 4;
-    {PROTOBUF_FIELD_OFFSET(CheckResponse, _impl_.suggest_roles_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\27\0\6\15\15\0\0\0"
-    "siqi.auth.CheckResponse"
-    "reason"
-    "current_roles"
-    "suggest_roles"
-  }},
-};
-
-PROTOBUF_NOINLINE void CheckResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.CheckResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.reason_.ClearToEmpty();
-  _impl_.current_roles_.ClearToEmpty();
-  _impl_.suggest_roles_.ClearToEmpty();
-  _impl_.allowed_ = false;
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* CheckResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const CheckResponse& this_ = static_cast<const CheckResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* CheckResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const CheckResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.CheckResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // optional bool allowed = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteBoolToArray(
-                1, this_._internal_allowed(), target);
-          }
-
-          // string reason = 2;
-          if (!this_._internal_reason().empty()) {
-            const std::string& _s = this_._internal_reason();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.CheckResponse.reason");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string current_roles = 3;
-          if (!this_._internal_current_roles().empty()) {
-            const std::string& _s = this_._internal_current_roles();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.CheckResponse.current_roles");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // string suggest_roles = 4;
-          if (!this_._internal_suggest_roles().empty()) {
-            const std::string& _s = this_._internal_suggest_roles();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.CheckResponse.suggest_roles");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.CheckResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t CheckResponse::ByteSizeLong(const MessageLite& base) {
-          const CheckResponse& this_ = static_cast<const CheckResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t CheckResponse::ByteSizeLong() const {
-          const CheckResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.CheckResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string reason = 2;
-            if (!this_._internal_reason().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_reason());
-            }
-            // string current_roles = 3;
-            if (!this_._internal_current_roles().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_current_roles());
-            }
-            // string suggest_roles = 4;
-            if (!this_._internal_suggest_roles().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_suggest_roles());
-            }
-          }
-           {
-            // optional bool allowed = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 2;
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void CheckResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<CheckResponse*>(&to_msg);
-  auto& from = static_cast<const CheckResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.CheckResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_reason().empty()) {
-    _this->_internal_set_reason(from._internal_reason());
-  }
-  if (!from._internal_current_roles().empty()) {
-    _this->_internal_set_current_roles(from._internal_current_roles());
-  }
-  if (!from._internal_suggest_roles().empty()) {
-    _this->_internal_set_suggest_roles(from._internal_suggest_roles());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _this->_impl_.allowed_ = from._impl_.allowed_;
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void CheckResponse::CopyFrom(const CheckResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.CheckResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void CheckResponse::InternalSwap(CheckResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.reason_, &other->_impl_.reason_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.current_roles_, &other->_impl_.current_roles_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.suggest_roles_, &other->_impl_.suggest_roles_, arena);
-        swap(_impl_.allowed_, other->_impl_.allowed_);
-}
-
-::google::protobuf::Metadata CheckResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class BatchCheckRequest_CheckItem::_Internal {
- public:
-};
-
-BatchCheckRequest_CheckItem::BatchCheckRequest_CheckItem(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.BatchCheckRequest.CheckItem)
-}
-inline PROTOBUF_NDEBUG_INLINE BatchCheckRequest_CheckItem::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::BatchCheckRequest_CheckItem& from_msg)
-      : user_id_(arena, from.user_id_),
-        perm_key_(arena, from.perm_key_),
-        resource_id_(arena, from.resource_id_),
-        _cached_size_{0} {}
-
-BatchCheckRequest_CheckItem::BatchCheckRequest_CheckItem(
-    ::google::protobuf::Arena* arena,
-    const BatchCheckRequest_CheckItem& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  BatchCheckRequest_CheckItem* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.BatchCheckRequest.CheckItem)
-}
-inline PROTOBUF_NDEBUG_INLINE BatchCheckRequest_CheckItem::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : user_id_(arena),
-        perm_key_(arena),
-        resource_id_(arena),
-        _cached_size_{0} {}
-
-inline void BatchCheckRequest_CheckItem::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-BatchCheckRequest_CheckItem::~BatchCheckRequest_CheckItem() {
-  // @@protoc_insertion_point(destructor:siqi.auth.BatchCheckRequest.CheckItem)
-  SharedDtor(*this);
-}
-inline void BatchCheckRequest_CheckItem::SharedDtor(MessageLite& self) {
-  BatchCheckRequest_CheckItem& this_ = static_cast<BatchCheckRequest_CheckItem&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.user_id_.Destroy();
-  this_._impl_.perm_key_.Destroy();
-  this_._impl_.resource_id_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* BatchCheckRequest_CheckItem::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) BatchCheckRequest_CheckItem(arena);
-}
-constexpr auto BatchCheckRequest_CheckItem::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(BatchCheckRequest_CheckItem),
-                                            alignof(BatchCheckRequest_CheckItem));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull BatchCheckRequest_CheckItem::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_BatchCheckRequest_CheckItem_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &BatchCheckRequest_CheckItem::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<BatchCheckRequest_CheckItem>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &BatchCheckRequest_CheckItem::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<BatchCheckRequest_CheckItem>(), &BatchCheckRequest_CheckItem::ByteSizeLong,
-            &BatchCheckRequest_CheckItem::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(BatchCheckRequest_CheckItem, _impl_._cached_size_),
-        false,
-    },
-    &BatchCheckRequest_CheckItem::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* BatchCheckRequest_CheckItem::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 72, 2> BatchCheckRequest_CheckItem::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::BatchCheckRequest_CheckItem>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // string user_id = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(BatchCheckRequest_CheckItem, _impl_.user_id_)}},
-    // string perm_key = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(BatchCheckRequest_CheckItem, _impl_.perm_key_)}},
-    // string resource_id = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(BatchCheckRequest_CheckItem, _impl_.resource_id_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string user_id = 1;
-    {PROTOBUF_FIELD_OFFSET(BatchCheckRequest_CheckItem, _impl_.user_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string perm_key = 2;
-    {PROTOBUF_FIELD_OFFSET(BatchCheckRequest_CheckItem, _impl_.perm_key_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string resource_id = 3;
-    {PROTOBUF_FIELD_OFFSET(BatchCheckRequest_CheckItem, _impl_.resource_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\45\7\10\13\0\0\0\0"
-    "siqi.auth.BatchCheckRequest.CheckItem"
-    "user_id"
-    "perm_key"
-    "resource_id"
-  }},
-};
-
-PROTOBUF_NOINLINE void BatchCheckRequest_CheckItem::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.BatchCheckRequest.CheckItem)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.user_id_.ClearToEmpty();
-  _impl_.perm_key_.ClearToEmpty();
-  _impl_.resource_id_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* BatchCheckRequest_CheckItem::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const BatchCheckRequest_CheckItem& this_ = static_cast<const BatchCheckRequest_CheckItem&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* BatchCheckRequest_CheckItem::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const BatchCheckRequest_CheckItem& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.BatchCheckRequest.CheckItem)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string user_id = 1;
-          if (!this_._internal_user_id().empty()) {
-            const std::string& _s = this_._internal_user_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.BatchCheckRequest.CheckItem.user_id");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // string perm_key = 2;
-          if (!this_._internal_perm_key().empty()) {
-            const std::string& _s = this_._internal_perm_key();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.BatchCheckRequest.CheckItem.perm_key");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string resource_id = 3;
-          if (!this_._internal_resource_id().empty()) {
-            const std::string& _s = this_._internal_resource_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.BatchCheckRequest.CheckItem.resource_id");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.BatchCheckRequest.CheckItem)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t BatchCheckRequest_CheckItem::ByteSizeLong(const MessageLite& base) {
-          const BatchCheckRequest_CheckItem& this_ = static_cast<const BatchCheckRequest_CheckItem&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t BatchCheckRequest_CheckItem::ByteSizeLong() const {
-          const BatchCheckRequest_CheckItem& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.BatchCheckRequest.CheckItem)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string user_id = 1;
-            if (!this_._internal_user_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_user_id());
-            }
-            // string perm_key = 2;
-            if (!this_._internal_perm_key().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_perm_key());
-            }
-            // string resource_id = 3;
-            if (!this_._internal_resource_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_resource_id());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void BatchCheckRequest_CheckItem::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<BatchCheckRequest_CheckItem*>(&to_msg);
-  auto& from = static_cast<const BatchCheckRequest_CheckItem&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.BatchCheckRequest.CheckItem)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_user_id().empty()) {
-    _this->_internal_set_user_id(from._internal_user_id());
-  }
-  if (!from._internal_perm_key().empty()) {
-    _this->_internal_set_perm_key(from._internal_perm_key());
-  }
-  if (!from._internal_resource_id().empty()) {
-    _this->_internal_set_resource_id(from._internal_resource_id());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void BatchCheckRequest_CheckItem::CopyFrom(const BatchCheckRequest_CheckItem& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.BatchCheckRequest.CheckItem)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void BatchCheckRequest_CheckItem::InternalSwap(BatchCheckRequest_CheckItem* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.user_id_, &other->_impl_.user_id_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.perm_key_, &other->_impl_.perm_key_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.resource_id_, &other->_impl_.resource_id_, arena);
-}
-
-::google::protobuf::Metadata BatchCheckRequest_CheckItem::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class BatchCheckRequest::_Internal {
- public:
-};
-
-BatchCheckRequest::BatchCheckRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.BatchCheckRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE BatchCheckRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::BatchCheckRequest& from_msg)
-      : items_{visibility, arena, from.items_},
-        app_code_(arena, from.app_code_),
-        _cached_size_{0} {}
-
-BatchCheckRequest::BatchCheckRequest(
-    ::google::protobuf::Arena* arena,
-    const BatchCheckRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  BatchCheckRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.BatchCheckRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE BatchCheckRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : items_{visibility, arena},
-        app_code_(arena),
-        _cached_size_{0} {}
-
-inline void BatchCheckRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-BatchCheckRequest::~BatchCheckRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.BatchCheckRequest)
-  SharedDtor(*this);
-}
-inline void BatchCheckRequest::SharedDtor(MessageLite& self) {
-  BatchCheckRequest& this_ = static_cast<BatchCheckRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* BatchCheckRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) BatchCheckRequest(arena);
-}
-constexpr auto BatchCheckRequest::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(BatchCheckRequest, _impl_.items_) +
-          decltype(BatchCheckRequest::_impl_.items_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::CopyInit(
-        sizeof(BatchCheckRequest), alignof(BatchCheckRequest), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&BatchCheckRequest::PlacementNew_,
-                                 sizeof(BatchCheckRequest),
-                                 alignof(BatchCheckRequest));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull BatchCheckRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_BatchCheckRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &BatchCheckRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<BatchCheckRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &BatchCheckRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<BatchCheckRequest>(), &BatchCheckRequest::ByteSizeLong,
-            &BatchCheckRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(BatchCheckRequest, _impl_._cached_size_),
-        false,
-    },
-    &BatchCheckRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* BatchCheckRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 1, 44, 2> BatchCheckRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::BatchCheckRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // repeated .siqi.auth.BatchCheckRequest.CheckItem items = 2;
-    {::_pbi::TcParser::FastMtR1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(BatchCheckRequest, _impl_.items_)}},
-    // string app_code = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(BatchCheckRequest, _impl_.app_code_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string app_code = 1;
-    {PROTOBUF_FIELD_OFFSET(BatchCheckRequest, _impl_.app_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // repeated .siqi.auth.BatchCheckRequest.CheckItem items = 2;
-    {PROTOBUF_FIELD_OFFSET(BatchCheckRequest, _impl_.items_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::siqi::auth::BatchCheckRequest_CheckItem>()},
-  }}, {{
-    "\33\10\0\0\0\0\0\0"
-    "siqi.auth.BatchCheckRequest"
-    "app_code"
-  }},
-};
-
-PROTOBUF_NOINLINE void BatchCheckRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.BatchCheckRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.items_.Clear();
-  _impl_.app_code_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* BatchCheckRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const BatchCheckRequest& this_ = static_cast<const BatchCheckRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* BatchCheckRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const BatchCheckRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.BatchCheckRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string app_code = 1;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.BatchCheckRequest.app_code");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // repeated .siqi.auth.BatchCheckRequest.CheckItem items = 2;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_items_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_items().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    2, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.BatchCheckRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t BatchCheckRequest::ByteSizeLong(const MessageLite& base) {
-          const BatchCheckRequest& this_ = static_cast<const BatchCheckRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t BatchCheckRequest::ByteSizeLong() const {
-          const BatchCheckRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.BatchCheckRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .siqi.auth.BatchCheckRequest.CheckItem items = 2;
-            {
-              total_size += 1UL * this_._internal_items_size();
-              for (const auto& msg : this_._internal_items()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-           {
-            // string app_code = 1;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void BatchCheckRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<BatchCheckRequest*>(&to_msg);
-  auto& from = static_cast<const BatchCheckRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.BatchCheckRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_items()->MergeFrom(
-      from._internal_items());
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void BatchCheckRequest::CopyFrom(const BatchCheckRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.BatchCheckRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void BatchCheckRequest::InternalSwap(BatchCheckRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.items_.InternalSwap(&other->_impl_.items_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-}
-
-::google::protobuf::Metadata BatchCheckRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class BatchCheckResponse_ResultItem::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<BatchCheckResponse_ResultItem>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(BatchCheckResponse_ResultItem, _impl_._has_bits_);
-};
-
-BatchCheckResponse_ResultItem::BatchCheckResponse_ResultItem(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.BatchCheckResponse.ResultItem)
-}
-inline PROTOBUF_NDEBUG_INLINE BatchCheckResponse_ResultItem::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::BatchCheckResponse_ResultItem& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        user_id_(arena, from.user_id_),
-        perm_key_(arena, from.perm_key_),
-        reason_(arena, from.reason_) {}
-
-BatchCheckResponse_ResultItem::BatchCheckResponse_ResultItem(
-    ::google::protobuf::Arena* arena,
-    const BatchCheckResponse_ResultItem& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  BatchCheckResponse_ResultItem* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.allowed_ = from._impl_.allowed_;
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.BatchCheckResponse.ResultItem)
-}
-inline PROTOBUF_NDEBUG_INLINE BatchCheckResponse_ResultItem::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        user_id_(arena),
-        perm_key_(arena),
-        reason_(arena) {}
-
-inline void BatchCheckResponse_ResultItem::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.allowed_ = {};
-}
-BatchCheckResponse_ResultItem::~BatchCheckResponse_ResultItem() {
-  // @@protoc_insertion_point(destructor:siqi.auth.BatchCheckResponse.ResultItem)
-  SharedDtor(*this);
-}
-inline void BatchCheckResponse_ResultItem::SharedDtor(MessageLite& self) {
-  BatchCheckResponse_ResultItem& this_ = static_cast<BatchCheckResponse_ResultItem&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.user_id_.Destroy();
-  this_._impl_.perm_key_.Destroy();
-  this_._impl_.reason_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* BatchCheckResponse_ResultItem::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) BatchCheckResponse_ResultItem(arena);
-}
-constexpr auto BatchCheckResponse_ResultItem::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(BatchCheckResponse_ResultItem),
-                                            alignof(BatchCheckResponse_ResultItem));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull BatchCheckResponse_ResultItem::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_BatchCheckResponse_ResultItem_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &BatchCheckResponse_ResultItem::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<BatchCheckResponse_ResultItem>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &BatchCheckResponse_ResultItem::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<BatchCheckResponse_ResultItem>(), &BatchCheckResponse_ResultItem::ByteSizeLong,
-            &BatchCheckResponse_ResultItem::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(BatchCheckResponse_ResultItem, _impl_._cached_size_),
-        false,
-    },
-    &BatchCheckResponse_ResultItem::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* BatchCheckResponse_ResultItem::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 0, 69, 2> BatchCheckResponse_ResultItem::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(BatchCheckResponse_ResultItem, _impl_._has_bits_),
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::BatchCheckResponse_ResultItem>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string reason = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(BatchCheckResponse_ResultItem, _impl_.reason_)}},
-    // string user_id = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(BatchCheckResponse_ResultItem, _impl_.user_id_)}},
-    // string perm_key = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(BatchCheckResponse_ResultItem, _impl_.perm_key_)}},
-    // optional bool allowed = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(BatchCheckResponse_ResultItem, _impl_.allowed_), 0>(),
-     {24, 0, 0, PROTOBUF_FIELD_OFFSET(BatchCheckResponse_ResultItem, _impl_.allowed_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string user_id = 1;
-    {PROTOBUF_FIELD_OFFSET(BatchCheckResponse_ResultItem, _impl_.user_id_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string perm_key = 2;
-    {PROTOBUF_FIELD_OFFSET(BatchCheckResponse_ResultItem, _impl_.perm_key_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // optional bool allowed = 3;
-    {PROTOBUF_FIELD_OFFSET(BatchCheckResponse_ResultItem, _impl_.allowed_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kBool)},
-    // string reason = 4;
-    {PROTOBUF_FIELD_OFFSET(BatchCheckResponse_ResultItem, _impl_.reason_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\47\7\10\0\6\0\0\0"
-    "siqi.auth.BatchCheckResponse.ResultItem"
-    "user_id"
-    "perm_key"
-    "reason"
-  }},
-};
-
-PROTOBUF_NOINLINE void BatchCheckResponse_ResultItem::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.BatchCheckResponse.ResultItem)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.user_id_.ClearToEmpty();
-  _impl_.perm_key_.ClearToEmpty();
-  _impl_.reason_.ClearToEmpty();
-  _impl_.allowed_ = false;
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* BatchCheckResponse_ResultItem::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const BatchCheckResponse_ResultItem& this_ = static_cast<const BatchCheckResponse_ResultItem&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* BatchCheckResponse_ResultItem::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const BatchCheckResponse_ResultItem& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.BatchCheckResponse.ResultItem)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string user_id = 1;
-          if (!this_._internal_user_id().empty()) {
-            const std::string& _s = this_._internal_user_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.BatchCheckResponse.ResultItem.user_id");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // string perm_key = 2;
-          if (!this_._internal_perm_key().empty()) {
-            const std::string& _s = this_._internal_perm_key();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.BatchCheckResponse.ResultItem.perm_key");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // optional bool allowed = 3;
-          if (cached_has_bits & 0x00000001u) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteBoolToArray(
-                3, this_._internal_allowed(), target);
-          }
-
-          // string reason = 4;
-          if (!this_._internal_reason().empty()) {
-            const std::string& _s = this_._internal_reason();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.BatchCheckResponse.ResultItem.reason");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.BatchCheckResponse.ResultItem)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t BatchCheckResponse_ResultItem::ByteSizeLong(const MessageLite& base) {
-          const BatchCheckResponse_ResultItem& this_ = static_cast<const BatchCheckResponse_ResultItem&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t BatchCheckResponse_ResultItem::ByteSizeLong() const {
-          const BatchCheckResponse_ResultItem& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.BatchCheckResponse.ResultItem)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string user_id = 1;
-            if (!this_._internal_user_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_user_id());
-            }
-            // string perm_key = 2;
-            if (!this_._internal_perm_key().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_perm_key());
-            }
-            // string reason = 4;
-            if (!this_._internal_reason().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_reason());
-            }
-          }
-           {
-            // optional bool allowed = 3;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 2;
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void BatchCheckResponse_ResultItem::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<BatchCheckResponse_ResultItem*>(&to_msg);
-  auto& from = static_cast<const BatchCheckResponse_ResultItem&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.BatchCheckResponse.ResultItem)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_user_id().empty()) {
-    _this->_internal_set_user_id(from._internal_user_id());
-  }
-  if (!from._internal_perm_key().empty()) {
-    _this->_internal_set_perm_key(from._internal_perm_key());
-  }
-  if (!from._internal_reason().empty()) {
-    _this->_internal_set_reason(from._internal_reason());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _this->_impl_.allowed_ = from._impl_.allowed_;
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void BatchCheckResponse_ResultItem::CopyFrom(const BatchCheckResponse_ResultItem& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.BatchCheckResponse.ResultItem)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void BatchCheckResponse_ResultItem::InternalSwap(BatchCheckResponse_ResultItem* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.user_id_, &other->_impl_.user_id_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.perm_key_, &other->_impl_.perm_key_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.reason_, &other->_impl_.reason_, arena);
-        swap(_impl_.allowed_, other->_impl_.allowed_);
-}
-
-::google::protobuf::Metadata BatchCheckResponse_ResultItem::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class BatchCheckResponse::_Internal {
- public:
-};
-
-BatchCheckResponse::BatchCheckResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.BatchCheckResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE BatchCheckResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::BatchCheckResponse& from_msg)
-      : results_{visibility, arena, from.results_},
-        _cached_size_{0} {}
-
-BatchCheckResponse::BatchCheckResponse(
-    ::google::protobuf::Arena* arena,
-    const BatchCheckResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  BatchCheckResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.BatchCheckResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE BatchCheckResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : results_{visibility, arena},
-        _cached_size_{0} {}
-
-inline void BatchCheckResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-BatchCheckResponse::~BatchCheckResponse() {
-  // @@protoc_insertion_point(destructor:siqi.auth.BatchCheckResponse)
-  SharedDtor(*this);
-}
-inline void BatchCheckResponse::SharedDtor(MessageLite& self) {
-  BatchCheckResponse& this_ = static_cast<BatchCheckResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* BatchCheckResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) BatchCheckResponse(arena);
-}
-constexpr auto BatchCheckResponse::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(BatchCheckResponse, _impl_.results_) +
-          decltype(BatchCheckResponse::_impl_.results_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::ZeroInit(
-        sizeof(BatchCheckResponse), alignof(BatchCheckResponse), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&BatchCheckResponse::PlacementNew_,
-                                 sizeof(BatchCheckResponse),
-                                 alignof(BatchCheckResponse));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull BatchCheckResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_BatchCheckResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &BatchCheckResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<BatchCheckResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &BatchCheckResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<BatchCheckResponse>(), &BatchCheckResponse::ByteSizeLong,
-            &BatchCheckResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(BatchCheckResponse, _impl_._cached_size_),
-        false,
-    },
-    &BatchCheckResponse::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* BatchCheckResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> BatchCheckResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::BatchCheckResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // repeated .siqi.auth.BatchCheckResponse.ResultItem results = 1;
-    {::_pbi::TcParser::FastMtR1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(BatchCheckResponse, _impl_.results_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // repeated .siqi.auth.BatchCheckResponse.ResultItem results = 1;
-    {PROTOBUF_FIELD_OFFSET(BatchCheckResponse, _impl_.results_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::siqi::auth::BatchCheckResponse_ResultItem>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void BatchCheckResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.BatchCheckResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.results_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* BatchCheckResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const BatchCheckResponse& this_ = static_cast<const BatchCheckResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* BatchCheckResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const BatchCheckResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.BatchCheckResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // repeated .siqi.auth.BatchCheckResponse.ResultItem results = 1;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_results_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_results().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    1, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.BatchCheckResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t BatchCheckResponse::ByteSizeLong(const MessageLite& base) {
-          const BatchCheckResponse& this_ = static_cast<const BatchCheckResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t BatchCheckResponse::ByteSizeLong() const {
-          const BatchCheckResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.BatchCheckResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .siqi.auth.BatchCheckResponse.ResultItem results = 1;
-            {
-              total_size += 1UL * this_._internal_results_size();
-              for (const auto& msg : this_._internal_results()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void BatchCheckResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<BatchCheckResponse*>(&to_msg);
-  auto& from = static_cast<const BatchCheckResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.BatchCheckResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_results()->MergeFrom(
-      from._internal_results());
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void BatchCheckResponse::CopyFrom(const BatchCheckResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.BatchCheckResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void BatchCheckResponse::InternalSwap(BatchCheckResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.results_.InternalSwap(&other->_impl_.results_);
-}
-
-::google::protobuf::Metadata BatchCheckResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetUserPermissionsRequest::_Internal {
- public:
-};
-
-GetUserPermissionsRequest::GetUserPermissionsRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.GetUserPermissionsRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GetUserPermissionsRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::GetUserPermissionsRequest& from_msg)
-      : app_code_(arena, from.app_code_),
-        user_id_(arena, from.user_id_),
-        _cached_size_{0} {}
-
-GetUserPermissionsRequest::GetUserPermissionsRequest(
-    ::google::protobuf::Arena* arena,
-    const GetUserPermissionsRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetUserPermissionsRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.GetUserPermissionsRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GetUserPermissionsRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : app_code_(arena),
-        user_id_(arena),
-        _cached_size_{0} {}
-
-inline void GetUserPermissionsRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-GetUserPermissionsRequest::~GetUserPermissionsRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.GetUserPermissionsRequest)
-  SharedDtor(*this);
-}
-inline void GetUserPermissionsRequest::SharedDtor(MessageLite& self) {
-  GetUserPermissionsRequest& this_ = static_cast<GetUserPermissionsRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.user_id_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* GetUserPermissionsRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetUserPermissionsRequest(arena);
-}
-constexpr auto GetUserPermissionsRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(GetUserPermissionsRequest),
-                                            alignof(GetUserPermissionsRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetUserPermissionsRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetUserPermissionsRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetUserPermissionsRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetUserPermissionsRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetUserPermissionsRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetUserPermissionsRequest>(), &GetUserPermissionsRequest::ByteSizeLong,
-            &GetUserPermissionsRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetUserPermissionsRequest, _impl_._cached_size_),
-        false,
-    },
-    &GetUserPermissionsRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetUserPermissionsRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 59, 2> GetUserPermissionsRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::GetUserPermissionsRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string user_id = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(GetUserPermissionsRequest, _impl_.user_id_)}},
-    // string app_code = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(GetUserPermissionsRequest, _impl_.app_code_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string app_code = 1;
-    {PROTOBUF_FIELD_OFFSET(GetUserPermissionsRequest, _impl_.app_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string user_id = 2;
-    {PROTOBUF_FIELD_OFFSET(GetUserPermissionsRequest, _impl_.user_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\43\10\7\0\0\0\0\0"
-    "siqi.auth.GetUserPermissionsRequest"
-    "app_code"
-    "user_id"
-  }},
-};
-
-PROTOBUF_NOINLINE void GetUserPermissionsRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.GetUserPermissionsRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.app_code_.ClearToEmpty();
-  _impl_.user_id_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetUserPermissionsRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetUserPermissionsRequest& this_ = static_cast<const GetUserPermissionsRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetUserPermissionsRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetUserPermissionsRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.GetUserPermissionsRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string app_code = 1;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.GetUserPermissionsRequest.app_code");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // string user_id = 2;
-          if (!this_._internal_user_id().empty()) {
-            const std::string& _s = this_._internal_user_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.GetUserPermissionsRequest.user_id");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.GetUserPermissionsRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetUserPermissionsRequest::ByteSizeLong(const MessageLite& base) {
-          const GetUserPermissionsRequest& this_ = static_cast<const GetUserPermissionsRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetUserPermissionsRequest::ByteSizeLong() const {
-          const GetUserPermissionsRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.GetUserPermissionsRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string app_code = 1;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-            // string user_id = 2;
-            if (!this_._internal_user_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_user_id());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetUserPermissionsRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetUserPermissionsRequest*>(&to_msg);
-  auto& from = static_cast<const GetUserPermissionsRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.GetUserPermissionsRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  if (!from._internal_user_id().empty()) {
-    _this->_internal_set_user_id(from._internal_user_id());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetUserPermissionsRequest::CopyFrom(const GetUserPermissionsRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.GetUserPermissionsRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetUserPermissionsRequest::InternalSwap(GetUserPermissionsRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.user_id_, &other->_impl_.user_id_, arena);
-}
-
-::google::protobuf::Metadata GetUserPermissionsRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetUserPermissionsResponse::_Internal {
- public:
-};
-
-GetUserPermissionsResponse::GetUserPermissionsResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.GetUserPermissionsResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetUserPermissionsResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::GetUserPermissionsResponse& from_msg)
-      : perm_keys_{visibility, arena, from.perm_keys_},
-        _cached_size_{0} {}
-
-GetUserPermissionsResponse::GetUserPermissionsResponse(
-    ::google::protobuf::Arena* arena,
-    const GetUserPermissionsResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetUserPermissionsResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.GetUserPermissionsResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetUserPermissionsResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : perm_keys_{visibility, arena},
-        _cached_size_{0} {}
-
-inline void GetUserPermissionsResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-GetUserPermissionsResponse::~GetUserPermissionsResponse() {
-  // @@protoc_insertion_point(destructor:siqi.auth.GetUserPermissionsResponse)
-  SharedDtor(*this);
-}
-inline void GetUserPermissionsResponse::SharedDtor(MessageLite& self) {
-  GetUserPermissionsResponse& this_ = static_cast<GetUserPermissionsResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* GetUserPermissionsResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetUserPermissionsResponse(arena);
-}
-constexpr auto GetUserPermissionsResponse::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(GetUserPermissionsResponse, _impl_.perm_keys_) +
-          decltype(GetUserPermissionsResponse::_impl_.perm_keys_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::ZeroInit(
-        sizeof(GetUserPermissionsResponse), alignof(GetUserPermissionsResponse), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&GetUserPermissionsResponse::PlacementNew_,
-                                 sizeof(GetUserPermissionsResponse),
-                                 alignof(GetUserPermissionsResponse));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetUserPermissionsResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetUserPermissionsResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetUserPermissionsResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetUserPermissionsResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetUserPermissionsResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetUserPermissionsResponse>(), &GetUserPermissionsResponse::ByteSizeLong,
-            &GetUserPermissionsResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetUserPermissionsResponse, _impl_._cached_size_),
-        false,
-    },
-    &GetUserPermissionsResponse::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetUserPermissionsResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 54, 2> GetUserPermissionsResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::GetUserPermissionsResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // repeated string perm_keys = 1;
-    {::_pbi::TcParser::FastUR1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(GetUserPermissionsResponse, _impl_.perm_keys_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // repeated string perm_keys = 1;
-    {PROTOBUF_FIELD_OFFSET(GetUserPermissionsResponse, _impl_.perm_keys_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kUtf8String | ::_fl::kRepSString)},
-  }},
-  // no aux_entries
-  {{
-    "\44\11\0\0\0\0\0\0"
-    "siqi.auth.GetUserPermissionsResponse"
-    "perm_keys"
-  }},
-};
-
-PROTOBUF_NOINLINE void GetUserPermissionsResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.GetUserPermissionsResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.perm_keys_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetUserPermissionsResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetUserPermissionsResponse& this_ = static_cast<const GetUserPermissionsResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetUserPermissionsResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetUserPermissionsResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.GetUserPermissionsResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // repeated string perm_keys = 1;
-          for (int i = 0, n = this_._internal_perm_keys_size(); i < n; ++i) {
-            const auto& s = this_._internal_perm_keys().Get(i);
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                s.data(), static_cast<int>(s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.GetUserPermissionsResponse.perm_keys");
-            target = stream->WriteString(1, s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.GetUserPermissionsResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetUserPermissionsResponse::ByteSizeLong(const MessageLite& base) {
-          const GetUserPermissionsResponse& this_ = static_cast<const GetUserPermissionsResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetUserPermissionsResponse::ByteSizeLong() const {
-          const GetUserPermissionsResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.GetUserPermissionsResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated string perm_keys = 1;
-            {
-              total_size +=
-                  1 * ::google::protobuf::internal::FromIntSize(this_._internal_perm_keys().size());
-              for (int i = 0, n = this_._internal_perm_keys().size(); i < n; ++i) {
-                total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-                    this_._internal_perm_keys().Get(i));
-              }
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetUserPermissionsResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetUserPermissionsResponse*>(&to_msg);
-  auto& from = static_cast<const GetUserPermissionsResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.GetUserPermissionsResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_perm_keys()->MergeFrom(from._internal_perm_keys());
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetUserPermissionsResponse::CopyFrom(const GetUserPermissionsResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.GetUserPermissionsResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetUserPermissionsResponse::InternalSwap(GetUserPermissionsResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.perm_keys_.InternalSwap(&other->_impl_.perm_keys_);
-}
-
-::google::protobuf::Metadata GetUserPermissionsResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetUserRolesRequest::_Internal {
- public:
-};
-
-GetUserRolesRequest::GetUserRolesRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.GetUserRolesRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GetUserRolesRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::GetUserRolesRequest& from_msg)
-      : app_code_(arena, from.app_code_),
-        user_id_(arena, from.user_id_),
-        _cached_size_{0} {}
-
-GetUserRolesRequest::GetUserRolesRequest(
-    ::google::protobuf::Arena* arena,
-    const GetUserRolesRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetUserRolesRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.GetUserRolesRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GetUserRolesRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : app_code_(arena),
-        user_id_(arena),
-        _cached_size_{0} {}
-
-inline void GetUserRolesRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-GetUserRolesRequest::~GetUserRolesRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.GetUserRolesRequest)
-  SharedDtor(*this);
-}
-inline void GetUserRolesRequest::SharedDtor(MessageLite& self) {
-  GetUserRolesRequest& this_ = static_cast<GetUserRolesRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.user_id_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* GetUserRolesRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetUserRolesRequest(arena);
-}
-constexpr auto GetUserRolesRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(GetUserRolesRequest),
-                                            alignof(GetUserRolesRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetUserRolesRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetUserRolesRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetUserRolesRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetUserRolesRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetUserRolesRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetUserRolesRequest>(), &GetUserRolesRequest::ByteSizeLong,
-            &GetUserRolesRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetUserRolesRequest, _impl_._cached_size_),
-        false,
-    },
-    &GetUserRolesRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetUserRolesRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 53, 2> GetUserRolesRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::GetUserRolesRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string user_id = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(GetUserRolesRequest, _impl_.user_id_)}},
-    // string app_code = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(GetUserRolesRequest, _impl_.app_code_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string app_code = 1;
-    {PROTOBUF_FIELD_OFFSET(GetUserRolesRequest, _impl_.app_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string user_id = 2;
-    {PROTOBUF_FIELD_OFFSET(GetUserRolesRequest, _impl_.user_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\35\10\7\0\0\0\0\0"
-    "siqi.auth.GetUserRolesRequest"
-    "app_code"
-    "user_id"
-  }},
-};
-
-PROTOBUF_NOINLINE void GetUserRolesRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.GetUserRolesRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.app_code_.ClearToEmpty();
-  _impl_.user_id_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetUserRolesRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetUserRolesRequest& this_ = static_cast<const GetUserRolesRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetUserRolesRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetUserRolesRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.GetUserRolesRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string app_code = 1;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.GetUserRolesRequest.app_code");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // string user_id = 2;
-          if (!this_._internal_user_id().empty()) {
-            const std::string& _s = this_._internal_user_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.GetUserRolesRequest.user_id");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.GetUserRolesRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetUserRolesRequest::ByteSizeLong(const MessageLite& base) {
-          const GetUserRolesRequest& this_ = static_cast<const GetUserRolesRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetUserRolesRequest::ByteSizeLong() const {
-          const GetUserRolesRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.GetUserRolesRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string app_code = 1;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-            // string user_id = 2;
-            if (!this_._internal_user_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_user_id());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetUserRolesRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetUserRolesRequest*>(&to_msg);
-  auto& from = static_cast<const GetUserRolesRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.GetUserRolesRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  if (!from._internal_user_id().empty()) {
-    _this->_internal_set_user_id(from._internal_user_id());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetUserRolesRequest::CopyFrom(const GetUserRolesRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.GetUserRolesRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetUserRolesRequest::InternalSwap(GetUserRolesRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.user_id_, &other->_impl_.user_id_, arena);
-}
-
-::google::protobuf::Metadata GetUserRolesRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetUserRolesResponse::_Internal {
- public:
-};
-
-GetUserRolesResponse::GetUserRolesResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.GetUserRolesResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetUserRolesResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::GetUserRolesResponse& from_msg)
-      : role_keys_{visibility, arena, from.role_keys_},
-        _cached_size_{0} {}
-
-GetUserRolesResponse::GetUserRolesResponse(
-    ::google::protobuf::Arena* arena,
-    const GetUserRolesResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetUserRolesResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.GetUserRolesResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetUserRolesResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : role_keys_{visibility, arena},
-        _cached_size_{0} {}
-
-inline void GetUserRolesResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-GetUserRolesResponse::~GetUserRolesResponse() {
-  // @@protoc_insertion_point(destructor:siqi.auth.GetUserRolesResponse)
-  SharedDtor(*this);
-}
-inline void GetUserRolesResponse::SharedDtor(MessageLite& self) {
-  GetUserRolesResponse& this_ = static_cast<GetUserRolesResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* GetUserRolesResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetUserRolesResponse(arena);
-}
-constexpr auto GetUserRolesResponse::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(GetUserRolesResponse, _impl_.role_keys_) +
-          decltype(GetUserRolesResponse::_impl_.role_keys_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::ZeroInit(
-        sizeof(GetUserRolesResponse), alignof(GetUserRolesResponse), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&GetUserRolesResponse::PlacementNew_,
-                                 sizeof(GetUserRolesResponse),
-                                 alignof(GetUserRolesResponse));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetUserRolesResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetUserRolesResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetUserRolesResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetUserRolesResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetUserRolesResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetUserRolesResponse>(), &GetUserRolesResponse::ByteSizeLong,
-            &GetUserRolesResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetUserRolesResponse, _impl_._cached_size_),
-        false,
-    },
-    &GetUserRolesResponse::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetUserRolesResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 48, 2> GetUserRolesResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::GetUserRolesResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // repeated string role_keys = 1;
-    {::_pbi::TcParser::FastUR1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(GetUserRolesResponse, _impl_.role_keys_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // repeated string role_keys = 1;
-    {PROTOBUF_FIELD_OFFSET(GetUserRolesResponse, _impl_.role_keys_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kUtf8String | ::_fl::kRepSString)},
-  }},
-  // no aux_entries
-  {{
-    "\36\11\0\0\0\0\0\0"
-    "siqi.auth.GetUserRolesResponse"
-    "role_keys"
-  }},
-};
-
-PROTOBUF_NOINLINE void GetUserRolesResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.GetUserRolesResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.role_keys_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetUserRolesResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetUserRolesResponse& this_ = static_cast<const GetUserRolesResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetUserRolesResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetUserRolesResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.GetUserRolesResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // repeated string role_keys = 1;
-          for (int i = 0, n = this_._internal_role_keys_size(); i < n; ++i) {
-            const auto& s = this_._internal_role_keys().Get(i);
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                s.data(), static_cast<int>(s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.GetUserRolesResponse.role_keys");
-            target = stream->WriteString(1, s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.GetUserRolesResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetUserRolesResponse::ByteSizeLong(const MessageLite& base) {
-          const GetUserRolesResponse& this_ = static_cast<const GetUserRolesResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetUserRolesResponse::ByteSizeLong() const {
-          const GetUserRolesResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.GetUserRolesResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated string role_keys = 1;
-            {
-              total_size +=
-                  1 * ::google::protobuf::internal::FromIntSize(this_._internal_role_keys().size());
-              for (int i = 0, n = this_._internal_role_keys().size(); i < n; ++i) {
-                total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-                    this_._internal_role_keys().Get(i));
-              }
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetUserRolesResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetUserRolesResponse*>(&to_msg);
-  auto& from = static_cast<const GetUserRolesResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.GetUserRolesResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_role_keys()->MergeFrom(from._internal_role_keys());
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetUserRolesResponse::CopyFrom(const GetUserRolesResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.GetUserRolesResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetUserRolesResponse::InternalSwap(GetUserRolesResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.role_keys_.InternalSwap(&other->_impl_.role_keys_);
-}
-
-::google::protobuf::Metadata GetUserRolesResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class CreateAppRequest::_Internal {
- public:
-};
-
-CreateAppRequest::CreateAppRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.CreateAppRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE CreateAppRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::CreateAppRequest& from_msg)
-      : app_name_(arena, from.app_name_),
-        app_code_(arena, from.app_code_),
-        description_(arena, from.description_),
-        _cached_size_{0} {}
-
-CreateAppRequest::CreateAppRequest(
-    ::google::protobuf::Arena* arena,
-    const CreateAppRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  CreateAppRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.CreateAppRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE CreateAppRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : app_name_(arena),
-        app_code_(arena),
-        description_(arena),
-        _cached_size_{0} {}
-
-inline void CreateAppRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-CreateAppRequest::~CreateAppRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.CreateAppRequest)
-  SharedDtor(*this);
-}
-inline void CreateAppRequest::SharedDtor(MessageLite& self) {
-  CreateAppRequest& this_ = static_cast<CreateAppRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_name_.Destroy();
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.description_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* CreateAppRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) CreateAppRequest(arena);
-}
-constexpr auto CreateAppRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(CreateAppRequest),
-                                            alignof(CreateAppRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull CreateAppRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_CreateAppRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &CreateAppRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<CreateAppRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &CreateAppRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<CreateAppRequest>(), &CreateAppRequest::ByteSizeLong,
-            &CreateAppRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(CreateAppRequest, _impl_._cached_size_),
-        false,
-    },
-    &CreateAppRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* CreateAppRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 62, 2> CreateAppRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967281,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::CreateAppRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string description = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(CreateAppRequest, _impl_.description_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-    // string app_name = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(CreateAppRequest, _impl_.app_name_)}},
-    // string app_code = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(CreateAppRequest, _impl_.app_code_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string app_name = 2;
-    {PROTOBUF_FIELD_OFFSET(CreateAppRequest, _impl_.app_name_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string app_code = 3;
-    {PROTOBUF_FIELD_OFFSET(CreateAppRequest, _impl_.app_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string description = 4;
-    {PROTOBUF_FIELD_OFFSET(CreateAppRequest, _impl_.description_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\32\10\10\13\0\0\0\0"
-    "siqi.auth.CreateAppRequest"
-    "app_name"
-    "app_code"
-    "description"
-  }},
-};
-
-PROTOBUF_NOINLINE void CreateAppRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.CreateAppRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.app_name_.ClearToEmpty();
-  _impl_.app_code_.ClearToEmpty();
-  _impl_.description_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* CreateAppRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const CreateAppRequest& this_ = static_cast<const CreateAppRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* CreateAppRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const CreateAppRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.CreateAppRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string app_name = 2;
-          if (!this_._internal_app_name().empty()) {
-            const std::string& _s = this_._internal_app_name();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.CreateAppRequest.app_name");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string app_code = 3;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.CreateAppRequest.app_code");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // string description = 4;
-          if (!this_._internal_description().empty()) {
-            const std::string& _s = this_._internal_description();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.CreateAppRequest.description");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.CreateAppRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t CreateAppRequest::ByteSizeLong(const MessageLite& base) {
-          const CreateAppRequest& this_ = static_cast<const CreateAppRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t CreateAppRequest::ByteSizeLong() const {
-          const CreateAppRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.CreateAppRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string app_name = 2;
-            if (!this_._internal_app_name().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_name());
-            }
-            // string app_code = 3;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-            // string description = 4;
-            if (!this_._internal_description().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_description());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void CreateAppRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<CreateAppRequest*>(&to_msg);
-  auto& from = static_cast<const CreateAppRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.CreateAppRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_app_name().empty()) {
-    _this->_internal_set_app_name(from._internal_app_name());
-  }
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  if (!from._internal_description().empty()) {
-    _this->_internal_set_description(from._internal_description());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void CreateAppRequest::CopyFrom(const CreateAppRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.CreateAppRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void CreateAppRequest::InternalSwap(CreateAppRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_name_, &other->_impl_.app_name_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.description_, &other->_impl_.description_, arena);
-}
-
-::google::protobuf::Metadata CreateAppRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class UpdateAppRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<UpdateAppRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(UpdateAppRequest, _impl_._has_bits_);
-};
-
-UpdateAppRequest::UpdateAppRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.UpdateAppRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE UpdateAppRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::UpdateAppRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        app_code_(arena, from.app_code_),
-        app_name_(arena, from.app_name_),
-        description_(arena, from.description_) {}
-
-UpdateAppRequest::UpdateAppRequest(
-    ::google::protobuf::Arena* arena,
-    const UpdateAppRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  UpdateAppRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.status_ = from._impl_.status_;
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.UpdateAppRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE UpdateAppRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        app_code_(arena),
-        app_name_(arena),
-        description_(arena) {}
-
-inline void UpdateAppRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.status_ = {};
-}
-UpdateAppRequest::~UpdateAppRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.UpdateAppRequest)
-  SharedDtor(*this);
-}
-inline void UpdateAppRequest::SharedDtor(MessageLite& self) {
-  UpdateAppRequest& this_ = static_cast<UpdateAppRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.app_name_.Destroy();
-  this_._impl_.description_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* UpdateAppRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) UpdateAppRequest(arena);
-}
-constexpr auto UpdateAppRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(UpdateAppRequest),
-                                            alignof(UpdateAppRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull UpdateAppRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_UpdateAppRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &UpdateAppRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<UpdateAppRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &UpdateAppRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<UpdateAppRequest>(), &UpdateAppRequest::ByteSizeLong,
-            &UpdateAppRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(UpdateAppRequest, _impl_._cached_size_),
-        false,
-    },
-    &UpdateAppRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* UpdateAppRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 0, 62, 2> UpdateAppRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(UpdateAppRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    5, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967265,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::UpdateAppRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // optional string description = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 1, 0, PROTOBUF_FIELD_OFFSET(UpdateAppRequest, _impl_.description_)}},
-    // optional int32 status = 5;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(UpdateAppRequest, _impl_.status_), 2>(),
-     {40, 2, 0, PROTOBUF_FIELD_OFFSET(UpdateAppRequest, _impl_.status_)}},
-    // string app_code = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(UpdateAppRequest, _impl_.app_code_)}},
-    // optional string app_name = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 0, 0, PROTOBUF_FIELD_OFFSET(UpdateAppRequest, _impl_.app_name_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string app_code = 2;
-    {PROTOBUF_FIELD_OFFSET(UpdateAppRequest, _impl_.app_code_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // optional string app_name = 3;
-    {PROTOBUF_FIELD_OFFSET(UpdateAppRequest, _impl_.app_name_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // optional string description = 4;
-    {PROTOBUF_FIELD_OFFSET(UpdateAppRequest, _impl_.description_), _Internal::kHasBitsOffset + 1, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // optional int32 status = 5;
-    {PROTOBUF_FIELD_OFFSET(UpdateAppRequest, _impl_.status_), _Internal::kHasBitsOffset + 2, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
-    "\32\10\10\13\0\0\0\0"
-    "siqi.auth.UpdateAppRequest"
-    "app_code"
-    "app_name"
-    "description"
-  }},
-};
-
-PROTOBUF_NOINLINE void UpdateAppRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.UpdateAppRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.app_code_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      _impl_.app_name_.ClearNonDefaultToEmpty();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _impl_.description_.ClearNonDefaultToEmpty();
-    }
-  }
-  _impl_.status_ = 0;
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* UpdateAppRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const UpdateAppRequest& this_ = static_cast<const UpdateAppRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* UpdateAppRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const UpdateAppRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.UpdateAppRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string app_code = 2;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.UpdateAppRequest.app_code");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // optional string app_name = 3;
-          if (cached_has_bits & 0x00000001u) {
-            const std::string& _s = this_._internal_app_name();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.UpdateAppRequest.app_name");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // optional string description = 4;
-          if (cached_has_bits & 0x00000002u) {
-            const std::string& _s = this_._internal_description();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.UpdateAppRequest.description");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          // optional int32 status = 5;
-          if (cached_has_bits & 0x00000004u) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<5>(
-                    stream, this_._internal_status(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.UpdateAppRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t UpdateAppRequest::ByteSizeLong(const MessageLite& base) {
-          const UpdateAppRequest& this_ = static_cast<const UpdateAppRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t UpdateAppRequest::ByteSizeLong() const {
-          const UpdateAppRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.UpdateAppRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string app_code = 2;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-          }
-          cached_has_bits = this_._impl_._has_bits_[0];
-          if (cached_has_bits & 0x00000007u) {
-            // optional string app_name = 3;
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_name());
-            }
-            // optional string description = 4;
-            if (cached_has_bits & 0x00000002u) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_description());
-            }
-            // optional int32 status = 5;
-            if (cached_has_bits & 0x00000004u) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_status());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void UpdateAppRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<UpdateAppRequest*>(&to_msg);
-  auto& from = static_cast<const UpdateAppRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.UpdateAppRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000007u) {
-    if (cached_has_bits & 0x00000001u) {
-      _this->_internal_set_app_name(from._internal_app_name());
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _this->_internal_set_description(from._internal_description());
-    }
-    if (cached_has_bits & 0x00000004u) {
-      _this->_impl_.status_ = from._impl_.status_;
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void UpdateAppRequest::CopyFrom(const UpdateAppRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.UpdateAppRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void UpdateAppRequest::InternalSwap(UpdateAppRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_name_, &other->_impl_.app_name_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.description_, &other->_impl_.description_, arena);
-        swap(_impl_.status_, other->_impl_.status_);
-}
-
-::google::protobuf::Metadata UpdateAppRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class DeleteAppRequest::_Internal {
- public:
-};
-
-DeleteAppRequest::DeleteAppRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.DeleteAppRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE DeleteAppRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::DeleteAppRequest& from_msg)
-      : app_code_(arena, from.app_code_),
-        _cached_size_{0} {}
-
-DeleteAppRequest::DeleteAppRequest(
-    ::google::protobuf::Arena* arena,
-    const DeleteAppRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  DeleteAppRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.DeleteAppRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE DeleteAppRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : app_code_(arena),
-        _cached_size_{0} {}
-
-inline void DeleteAppRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-DeleteAppRequest::~DeleteAppRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.DeleteAppRequest)
-  SharedDtor(*this);
-}
-inline void DeleteAppRequest::SharedDtor(MessageLite& self) {
-  DeleteAppRequest& this_ = static_cast<DeleteAppRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* DeleteAppRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) DeleteAppRequest(arena);
-}
-constexpr auto DeleteAppRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(DeleteAppRequest),
-                                            alignof(DeleteAppRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull DeleteAppRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_DeleteAppRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &DeleteAppRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<DeleteAppRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &DeleteAppRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<DeleteAppRequest>(), &DeleteAppRequest::ByteSizeLong,
-            &DeleteAppRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(DeleteAppRequest, _impl_._cached_size_),
-        false,
-    },
-    &DeleteAppRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* DeleteAppRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 43, 2> DeleteAppRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967293,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::DeleteAppRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string app_code = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(DeleteAppRequest, _impl_.app_code_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string app_code = 2;
-    {PROTOBUF_FIELD_OFFSET(DeleteAppRequest, _impl_.app_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\32\10\0\0\0\0\0\0"
-    "siqi.auth.DeleteAppRequest"
-    "app_code"
-  }},
-};
-
-PROTOBUF_NOINLINE void DeleteAppRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.DeleteAppRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.app_code_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* DeleteAppRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const DeleteAppRequest& this_ = static_cast<const DeleteAppRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* DeleteAppRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const DeleteAppRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.DeleteAppRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string app_code = 2;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.DeleteAppRequest.app_code");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.DeleteAppRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t DeleteAppRequest::ByteSizeLong(const MessageLite& base) {
-          const DeleteAppRequest& this_ = static_cast<const DeleteAppRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t DeleteAppRequest::ByteSizeLong() const {
-          const DeleteAppRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.DeleteAppRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-           {
-            // string app_code = 2;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void DeleteAppRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<DeleteAppRequest*>(&to_msg);
-  auto& from = static_cast<const DeleteAppRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.DeleteAppRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void DeleteAppRequest::CopyFrom(const DeleteAppRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.DeleteAppRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void DeleteAppRequest::InternalSwap(DeleteAppRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-}
-
-::google::protobuf::Metadata DeleteAppRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetAppRequest::_Internal {
- public:
-};
-
-GetAppRequest::GetAppRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.GetAppRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GetAppRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::GetAppRequest& from_msg)
-      : app_code_(arena, from.app_code_),
-        _cached_size_{0} {}
-
-GetAppRequest::GetAppRequest(
-    ::google::protobuf::Arena* arena,
-    const GetAppRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetAppRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.GetAppRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GetAppRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : app_code_(arena),
-        _cached_size_{0} {}
-
-inline void GetAppRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-GetAppRequest::~GetAppRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.GetAppRequest)
-  SharedDtor(*this);
-}
-inline void GetAppRequest::SharedDtor(MessageLite& self) {
-  GetAppRequest& this_ = static_cast<GetAppRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* GetAppRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetAppRequest(arena);
-}
-constexpr auto GetAppRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(GetAppRequest),
-                                            alignof(GetAppRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetAppRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetAppRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetAppRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetAppRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetAppRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetAppRequest>(), &GetAppRequest::ByteSizeLong,
-            &GetAppRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetAppRequest, _impl_._cached_size_),
-        false,
-    },
-    &GetAppRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetAppRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 40, 2> GetAppRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::GetAppRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string app_code = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(GetAppRequest, _impl_.app_code_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string app_code = 1;
-    {PROTOBUF_FIELD_OFFSET(GetAppRequest, _impl_.app_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\27\10\0\0\0\0\0\0"
-    "siqi.auth.GetAppRequest"
-    "app_code"
-  }},
-};
-
-PROTOBUF_NOINLINE void GetAppRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.GetAppRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.app_code_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetAppRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetAppRequest& this_ = static_cast<const GetAppRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetAppRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetAppRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.GetAppRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string app_code = 1;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.GetAppRequest.app_code");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.GetAppRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetAppRequest::ByteSizeLong(const MessageLite& base) {
-          const GetAppRequest& this_ = static_cast<const GetAppRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetAppRequest::ByteSizeLong() const {
-          const GetAppRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.GetAppRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-           {
-            // string app_code = 1;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetAppRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetAppRequest*>(&to_msg);
-  auto& from = static_cast<const GetAppRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.GetAppRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetAppRequest::CopyFrom(const GetAppRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.GetAppRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetAppRequest::InternalSwap(GetAppRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-}
-
-::google::protobuf::Metadata GetAppRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetAppResponse::_Internal {
- public:
-};
-
-GetAppResponse::GetAppResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.GetAppResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetAppResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::GetAppResponse& from_msg)
-      : app_name_(arena, from.app_name_),
-        app_code_(arena, from.app_code_),
-        app_secret_(arena, from.app_secret_),
-        description_(arena, from.description_),
-        created_at_(arena, from.created_at_),
-        updated_at_(arena, from.updated_at_),
-        _cached_size_{0} {}
-
-GetAppResponse::GetAppResponse(
-    ::google::protobuf::Arena* arena,
-    const GetAppResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetAppResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, id_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, id_),
-           offsetof(Impl_, status_) -
-               offsetof(Impl_, id_) +
-               sizeof(Impl_::status_));
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.GetAppResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetAppResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : app_name_(arena),
-        app_code_(arena),
-        app_secret_(arena),
-        description_(arena),
-        created_at_(arena),
-        updated_at_(arena),
-        _cached_size_{0} {}
-
-inline void GetAppResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, id_),
-           0,
-           offsetof(Impl_, status_) -
-               offsetof(Impl_, id_) +
-               sizeof(Impl_::status_));
-}
-GetAppResponse::~GetAppResponse() {
-  // @@protoc_insertion_point(destructor:siqi.auth.GetAppResponse)
-  SharedDtor(*this);
-}
-inline void GetAppResponse::SharedDtor(MessageLite& self) {
-  GetAppResponse& this_ = static_cast<GetAppResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_name_.Destroy();
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.app_secret_.Destroy();
-  this_._impl_.description_.Destroy();
-  this_._impl_.created_at_.Destroy();
-  this_._impl_.updated_at_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* GetAppResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetAppResponse(arena);
-}
-constexpr auto GetAppResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(GetAppResponse),
-                                            alignof(GetAppResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetAppResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetAppResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetAppResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetAppResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetAppResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetAppResponse>(), &GetAppResponse::ByteSizeLong,
-            &GetAppResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetAppResponse, _impl_._cached_size_),
-        false,
-    },
-    &GetAppResponse::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetAppResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 8, 0, 98, 2> GetAppResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    8, 56,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967040,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    8,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::GetAppResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string updated_at = 8;
-    {::_pbi::TcParser::FastUS1,
-     {66, 63, 0, PROTOBUF_FIELD_OFFSET(GetAppResponse, _impl_.updated_at_)}},
-    // int64 id = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(GetAppResponse, _impl_.id_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(GetAppResponse, _impl_.id_)}},
-    // string app_name = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(GetAppResponse, _impl_.app_name_)}},
-    // string app_code = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(GetAppResponse, _impl_.app_code_)}},
-    // string app_secret = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(GetAppResponse, _impl_.app_secret_)}},
-    // string description = 5;
-    {::_pbi::TcParser::FastUS1,
-     {42, 63, 0, PROTOBUF_FIELD_OFFSET(GetAppResponse, _impl_.description_)}},
-    // int32 status = 6;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(GetAppResponse, _impl_.status_), 63>(),
-     {48, 63, 0, PROTOBUF_FIELD_OFFSET(GetAppResponse, _impl_.status_)}},
-    // string created_at = 7;
-    {::_pbi::TcParser::FastUS1,
-     {58, 63, 0, PROTOBUF_FIELD_OFFSET(GetAppResponse, _impl_.created_at_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int64 id = 1;
-    {PROTOBUF_FIELD_OFFSET(GetAppResponse, _impl_.id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
-    // string app_name = 2;
-    {PROTOBUF_FIELD_OFFSET(GetAppResponse, _impl_.app_name_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string app_code = 3;
-    {PROTOBUF_FIELD_OFFSET(GetAppResponse, _impl_.app_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string app_secret = 4;
-    {PROTOBUF_FIELD_OFFSET(GetAppResponse, _impl_.app_secret_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string description = 5;
-    {PROTOBUF_FIELD_OFFSET(GetAppResponse, _impl_.description_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int32 status = 6;
-    {PROTOBUF_FIELD_OFFSET(GetAppResponse, _impl_.status_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // string created_at = 7;
-    {PROTOBUF_FIELD_OFFSET(GetAppResponse, _impl_.created_at_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string updated_at = 8;
-    {PROTOBUF_FIELD_OFFSET(GetAppResponse, _impl_.updated_at_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\30\0\10\10\12\13\0\12\12\0\0\0\0\0\0\0"
-    "siqi.auth.GetAppResponse"
-    "app_name"
-    "app_code"
-    "app_secret"
-    "description"
-    "created_at"
-    "updated_at"
-  }},
-};
-
-PROTOBUF_NOINLINE void GetAppResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.GetAppResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.app_name_.ClearToEmpty();
-  _impl_.app_code_.ClearToEmpty();
-  _impl_.app_secret_.ClearToEmpty();
-  _impl_.description_.ClearToEmpty();
-  _impl_.created_at_.ClearToEmpty();
-  _impl_.updated_at_.ClearToEmpty();
-  ::memset(&_impl_.id_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.status_) -
-      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.status_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetAppResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetAppResponse& this_ = static_cast<const GetAppResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetAppResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetAppResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.GetAppResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int64 id = 1;
-          if (this_._internal_id() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt64ToArrayWithField<1>(
-                    stream, this_._internal_id(), target);
-          }
-
-          // string app_name = 2;
-          if (!this_._internal_app_name().empty()) {
-            const std::string& _s = this_._internal_app_name();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.GetAppResponse.app_name");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string app_code = 3;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.GetAppResponse.app_code");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // string app_secret = 4;
-          if (!this_._internal_app_secret().empty()) {
-            const std::string& _s = this_._internal_app_secret();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.GetAppResponse.app_secret");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          // string description = 5;
-          if (!this_._internal_description().empty()) {
-            const std::string& _s = this_._internal_description();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.GetAppResponse.description");
-            target = stream->WriteStringMaybeAliased(5, _s, target);
-          }
-
-          // int32 status = 6;
-          if (this_._internal_status() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<6>(
-                    stream, this_._internal_status(), target);
-          }
-
-          // string created_at = 7;
-          if (!this_._internal_created_at().empty()) {
-            const std::string& _s = this_._internal_created_at();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.GetAppResponse.created_at");
-            target = stream->WriteStringMaybeAliased(7, _s, target);
-          }
-
-          // string updated_at = 8;
-          if (!this_._internal_updated_at().empty()) {
-            const std::string& _s = this_._internal_updated_at();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.GetAppResponse.updated_at");
-            target = stream->WriteStringMaybeAliased(8, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.GetAppResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetAppResponse::ByteSizeLong(const MessageLite& base) {
-          const GetAppResponse& this_ = static_cast<const GetAppResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetAppResponse::ByteSizeLong() const {
-          const GetAppResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.GetAppResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string app_name = 2;
-            if (!this_._internal_app_name().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_name());
-            }
-            // string app_code = 3;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-            // string app_secret = 4;
-            if (!this_._internal_app_secret().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_secret());
-            }
-            // string description = 5;
-            if (!this_._internal_description().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_description());
-            }
-            // string created_at = 7;
-            if (!this_._internal_created_at().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_created_at());
-            }
-            // string updated_at = 8;
-            if (!this_._internal_updated_at().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_updated_at());
-            }
-            // int64 id = 1;
-            if (this_._internal_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
-                  this_._internal_id());
-            }
-            // int32 status = 6;
-            if (this_._internal_status() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_status());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetAppResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetAppResponse*>(&to_msg);
-  auto& from = static_cast<const GetAppResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.GetAppResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_app_name().empty()) {
-    _this->_internal_set_app_name(from._internal_app_name());
-  }
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  if (!from._internal_app_secret().empty()) {
-    _this->_internal_set_app_secret(from._internal_app_secret());
-  }
-  if (!from._internal_description().empty()) {
-    _this->_internal_set_description(from._internal_description());
-  }
-  if (!from._internal_created_at().empty()) {
-    _this->_internal_set_created_at(from._internal_created_at());
-  }
-  if (!from._internal_updated_at().empty()) {
-    _this->_internal_set_updated_at(from._internal_updated_at());
-  }
-  if (from._internal_id() != 0) {
-    _this->_impl_.id_ = from._impl_.id_;
-  }
-  if (from._internal_status() != 0) {
-    _this->_impl_.status_ = from._impl_.status_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetAppResponse::CopyFrom(const GetAppResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.GetAppResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetAppResponse::InternalSwap(GetAppResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_name_, &other->_impl_.app_name_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_secret_, &other->_impl_.app_secret_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.description_, &other->_impl_.description_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.created_at_, &other->_impl_.created_at_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.updated_at_, &other->_impl_.updated_at_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GetAppResponse, _impl_.status_)
-      + sizeof(GetAppResponse::_impl_.status_)
-      - PROTOBUF_FIELD_OFFSET(GetAppResponse, _impl_.id_)>(
-          reinterpret_cast<char*>(&_impl_.id_),
-          reinterpret_cast<char*>(&other->_impl_.id_));
-}
-
-::google::protobuf::Metadata GetAppResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class ListAppsRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<ListAppsRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(ListAppsRequest, _impl_._has_bits_);
-};
-
-ListAppsRequest::ListAppsRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.ListAppsRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE ListAppsRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::ListAppsRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        app_name_(arena, from.app_name_) {}
-
-ListAppsRequest::ListAppsRequest(
-    ::google::protobuf::Arena* arena,
-    const ListAppsRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  ListAppsRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, page_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, page_),
-           offsetof(Impl_, status_) -
-               offsetof(Impl_, page_) +
-               sizeof(Impl_::status_));
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.ListAppsRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE ListAppsRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        app_name_(arena) {}
-
-inline void ListAppsRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, page_),
-           0,
-           offsetof(Impl_, status_) -
-               offsetof(Impl_, page_) +
-               sizeof(Impl_::status_));
-}
-ListAppsRequest::~ListAppsRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.ListAppsRequest)
-  SharedDtor(*this);
-}
-inline void ListAppsRequest::SharedDtor(MessageLite& self) {
-  ListAppsRequest& this_ = static_cast<ListAppsRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_name_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* ListAppsRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) ListAppsRequest(arena);
-}
-constexpr auto ListAppsRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(ListAppsRequest),
-                                            alignof(ListAppsRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull ListAppsRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_ListAppsRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &ListAppsRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<ListAppsRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &ListAppsRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<ListAppsRequest>(), &ListAppsRequest::ByteSizeLong,
-            &ListAppsRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(ListAppsRequest, _impl_._cached_size_),
-        false,
-    },
-    &ListAppsRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* ListAppsRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 0, 42, 2> ListAppsRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(ListAppsRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::ListAppsRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // optional int32 status = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListAppsRequest, _impl_.status_), 1>(),
-     {32, 1, 0, PROTOBUF_FIELD_OFFSET(ListAppsRequest, _impl_.status_)}},
-    // int32 page = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListAppsRequest, _impl_.page_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(ListAppsRequest, _impl_.page_)}},
-    // int32 page_size = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListAppsRequest, _impl_.page_size_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(ListAppsRequest, _impl_.page_size_)}},
-    // optional string app_name = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 0, 0, PROTOBUF_FIELD_OFFSET(ListAppsRequest, _impl_.app_name_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 page = 1;
-    {PROTOBUF_FIELD_OFFSET(ListAppsRequest, _impl_.page_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 page_size = 2;
-    {PROTOBUF_FIELD_OFFSET(ListAppsRequest, _impl_.page_size_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // optional string app_name = 3;
-    {PROTOBUF_FIELD_OFFSET(ListAppsRequest, _impl_.app_name_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // optional int32 status = 4;
-    {PROTOBUF_FIELD_OFFSET(ListAppsRequest, _impl_.status_), _Internal::kHasBitsOffset + 1, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
-    "\31\0\0\10\0\0\0\0"
-    "siqi.auth.ListAppsRequest"
-    "app_name"
-  }},
-};
-
-PROTOBUF_NOINLINE void ListAppsRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.ListAppsRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.app_name_.ClearNonDefaultToEmpty();
-  }
-  ::memset(&_impl_.page_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.page_size_) -
-      reinterpret_cast<char*>(&_impl_.page_)) + sizeof(_impl_.page_size_));
-  _impl_.status_ = 0;
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* ListAppsRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const ListAppsRequest& this_ = static_cast<const ListAppsRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* ListAppsRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const ListAppsRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.ListAppsRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 page = 1;
-          if (this_._internal_page() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_page(), target);
-          }
-
-          // int32 page_size = 2;
-          if (this_._internal_page_size() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<2>(
-                    stream, this_._internal_page_size(), target);
-          }
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // optional string app_name = 3;
-          if (cached_has_bits & 0x00000001u) {
-            const std::string& _s = this_._internal_app_name();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListAppsRequest.app_name");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // optional int32 status = 4;
-          if (cached_has_bits & 0x00000002u) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<4>(
-                    stream, this_._internal_status(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.ListAppsRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t ListAppsRequest::ByteSizeLong(const MessageLite& base) {
-          const ListAppsRequest& this_ = static_cast<const ListAppsRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t ListAppsRequest::ByteSizeLong() const {
-          const ListAppsRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.ListAppsRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // optional string app_name = 3;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_name());
-            }
-          }
-           {
-            // int32 page = 1;
-            if (this_._internal_page() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page());
-            }
-            // int32 page_size = 2;
-            if (this_._internal_page_size() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page_size());
-            }
-          }
-           {
-            // optional int32 status = 4;
-            if (cached_has_bits & 0x00000002u) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_status());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void ListAppsRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<ListAppsRequest*>(&to_msg);
-  auto& from = static_cast<const ListAppsRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.ListAppsRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _this->_internal_set_app_name(from._internal_app_name());
-  }
-  if (from._internal_page() != 0) {
-    _this->_impl_.page_ = from._impl_.page_;
-  }
-  if (from._internal_page_size() != 0) {
-    _this->_impl_.page_size_ = from._impl_.page_size_;
-  }
-  if (cached_has_bits & 0x00000002u) {
-    _this->_impl_.status_ = from._impl_.status_;
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void ListAppsRequest::CopyFrom(const ListAppsRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.ListAppsRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void ListAppsRequest::InternalSwap(ListAppsRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_name_, &other->_impl_.app_name_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ListAppsRequest, _impl_.status_)
-      + sizeof(ListAppsRequest::_impl_.status_)
-      - PROTOBUF_FIELD_OFFSET(ListAppsRequest, _impl_.page_)>(
-          reinterpret_cast<char*>(&_impl_.page_),
-          reinterpret_cast<char*>(&other->_impl_.page_));
-}
-
-::google::protobuf::Metadata ListAppsRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class ListAppsResponse::_Internal {
- public:
-};
-
-ListAppsResponse::ListAppsResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.ListAppsResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE ListAppsResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::ListAppsResponse& from_msg)
-      : apps_{visibility, arena, from.apps_},
-        _cached_size_{0} {}
-
-ListAppsResponse::ListAppsResponse(
-    ::google::protobuf::Arena* arena,
-    const ListAppsResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  ListAppsResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, total_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, total_),
-           offsetof(Impl_, page_size_) -
-               offsetof(Impl_, total_) +
-               sizeof(Impl_::page_size_));
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.ListAppsResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE ListAppsResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : apps_{visibility, arena},
-        _cached_size_{0} {}
-
-inline void ListAppsResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, total_),
-           0,
-           offsetof(Impl_, page_size_) -
-               offsetof(Impl_, total_) +
-               sizeof(Impl_::page_size_));
-}
-ListAppsResponse::~ListAppsResponse() {
-  // @@protoc_insertion_point(destructor:siqi.auth.ListAppsResponse)
-  SharedDtor(*this);
-}
-inline void ListAppsResponse::SharedDtor(MessageLite& self) {
-  ListAppsResponse& this_ = static_cast<ListAppsResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* ListAppsResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) ListAppsResponse(arena);
-}
-constexpr auto ListAppsResponse::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(ListAppsResponse, _impl_.apps_) +
-          decltype(ListAppsResponse::_impl_.apps_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::ZeroInit(
-        sizeof(ListAppsResponse), alignof(ListAppsResponse), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&ListAppsResponse::PlacementNew_,
-                                 sizeof(ListAppsResponse),
-                                 alignof(ListAppsResponse));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull ListAppsResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_ListAppsResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &ListAppsResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<ListAppsResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &ListAppsResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<ListAppsResponse>(), &ListAppsResponse::ByteSizeLong,
-            &ListAppsResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(ListAppsResponse, _impl_._cached_size_),
-        false,
-    },
-    &ListAppsResponse::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* ListAppsResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 1, 0, 2> ListAppsResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::ListAppsResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // int32 page_size = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListAppsResponse, _impl_.page_size_), 63>(),
-     {32, 63, 0, PROTOBUF_FIELD_OFFSET(ListAppsResponse, _impl_.page_size_)}},
-    // repeated .siqi.auth.GetAppResponse apps = 1;
-    {::_pbi::TcParser::FastMtR1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(ListAppsResponse, _impl_.apps_)}},
-    // int64 total = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(ListAppsResponse, _impl_.total_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(ListAppsResponse, _impl_.total_)}},
-    // int32 page = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListAppsResponse, _impl_.page_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(ListAppsResponse, _impl_.page_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // repeated .siqi.auth.GetAppResponse apps = 1;
-    {PROTOBUF_FIELD_OFFSET(ListAppsResponse, _impl_.apps_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-    // int64 total = 2;
-    {PROTOBUF_FIELD_OFFSET(ListAppsResponse, _impl_.total_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
-    // int32 page = 3;
-    {PROTOBUF_FIELD_OFFSET(ListAppsResponse, _impl_.page_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 page_size = 4;
-    {PROTOBUF_FIELD_OFFSET(ListAppsResponse, _impl_.page_size_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::siqi::auth::GetAppResponse>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void ListAppsResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.ListAppsResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.apps_.Clear();
-  ::memset(&_impl_.total_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.page_size_) -
-      reinterpret_cast<char*>(&_impl_.total_)) + sizeof(_impl_.page_size_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* ListAppsResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const ListAppsResponse& this_ = static_cast<const ListAppsResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* ListAppsResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const ListAppsResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.ListAppsResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // repeated .siqi.auth.GetAppResponse apps = 1;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_apps_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_apps().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    1, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          // int64 total = 2;
-          if (this_._internal_total() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt64ToArrayWithField<2>(
-                    stream, this_._internal_total(), target);
-          }
-
-          // int32 page = 3;
-          if (this_._internal_page() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_page(), target);
-          }
-
-          // int32 page_size = 4;
-          if (this_._internal_page_size() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<4>(
-                    stream, this_._internal_page_size(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.ListAppsResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t ListAppsResponse::ByteSizeLong(const MessageLite& base) {
-          const ListAppsResponse& this_ = static_cast<const ListAppsResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t ListAppsResponse::ByteSizeLong() const {
-          const ListAppsResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.ListAppsResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .siqi.auth.GetAppResponse apps = 1;
-            {
-              total_size += 1UL * this_._internal_apps_size();
-              for (const auto& msg : this_._internal_apps()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-           {
-            // int64 total = 2;
-            if (this_._internal_total() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
-                  this_._internal_total());
-            }
-            // int32 page = 3;
-            if (this_._internal_page() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page());
-            }
-            // int32 page_size = 4;
-            if (this_._internal_page_size() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page_size());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void ListAppsResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<ListAppsResponse*>(&to_msg);
-  auto& from = static_cast<const ListAppsResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.ListAppsResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_apps()->MergeFrom(
-      from._internal_apps());
-  if (from._internal_total() != 0) {
-    _this->_impl_.total_ = from._impl_.total_;
-  }
-  if (from._internal_page() != 0) {
-    _this->_impl_.page_ = from._impl_.page_;
-  }
-  if (from._internal_page_size() != 0) {
-    _this->_impl_.page_size_ = from._impl_.page_size_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void ListAppsResponse::CopyFrom(const ListAppsResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.ListAppsResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void ListAppsResponse::InternalSwap(ListAppsResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.apps_.InternalSwap(&other->_impl_.apps_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ListAppsResponse, _impl_.page_size_)
-      + sizeof(ListAppsResponse::_impl_.page_size_)
-      - PROTOBUF_FIELD_OFFSET(ListAppsResponse, _impl_.total_)>(
-          reinterpret_cast<char*>(&_impl_.total_),
-          reinterpret_cast<char*>(&other->_impl_.total_));
-}
-
-::google::protobuf::Metadata ListAppsResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class CreatePermissionRequest::_Internal {
- public:
-};
-
-CreatePermissionRequest::CreatePermissionRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.CreatePermissionRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE CreatePermissionRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::CreatePermissionRequest& from_msg)
-      : app_code_(arena, from.app_code_),
-        perm_name_(arena, from.perm_name_),
-        perm_key_(arena, from.perm_key_),
-        description_(arena, from.description_),
-        _cached_size_{0} {}
-
-CreatePermissionRequest::CreatePermissionRequest(
-    ::google::protobuf::Arena* arena,
-    const CreatePermissionRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  CreatePermissionRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.CreatePermissionRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE CreatePermissionRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : app_code_(arena),
-        perm_name_(arena),
-        perm_key_(arena),
-        description_(arena),
-        _cached_size_{0} {}
-
-inline void CreatePermissionRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-CreatePermissionRequest::~CreatePermissionRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.CreatePermissionRequest)
-  SharedDtor(*this);
-}
-inline void CreatePermissionRequest::SharedDtor(MessageLite& self) {
-  CreatePermissionRequest& this_ = static_cast<CreatePermissionRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.perm_name_.Destroy();
-  this_._impl_.perm_key_.Destroy();
-  this_._impl_.description_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* CreatePermissionRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) CreatePermissionRequest(arena);
-}
-constexpr auto CreatePermissionRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(CreatePermissionRequest),
-                                            alignof(CreatePermissionRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull CreatePermissionRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_CreatePermissionRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &CreatePermissionRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<CreatePermissionRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &CreatePermissionRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<CreatePermissionRequest>(), &CreatePermissionRequest::ByteSizeLong,
-            &CreatePermissionRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(CreatePermissionRequest, _impl_._cached_size_),
-        false,
-    },
-    &CreatePermissionRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* CreatePermissionRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 0, 78, 2> CreatePermissionRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    5, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967265,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::CreatePermissionRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string perm_key = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(CreatePermissionRequest, _impl_.perm_key_)}},
-    // string description = 5;
-    {::_pbi::TcParser::FastUS1,
-     {42, 63, 0, PROTOBUF_FIELD_OFFSET(CreatePermissionRequest, _impl_.description_)}},
-    // string app_code = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(CreatePermissionRequest, _impl_.app_code_)}},
-    // string perm_name = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(CreatePermissionRequest, _impl_.perm_name_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string app_code = 2;
-    {PROTOBUF_FIELD_OFFSET(CreatePermissionRequest, _impl_.app_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string perm_name = 3;
-    {PROTOBUF_FIELD_OFFSET(CreatePermissionRequest, _impl_.perm_name_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string perm_key = 4;
-    {PROTOBUF_FIELD_OFFSET(CreatePermissionRequest, _impl_.perm_key_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string description = 5;
-    {PROTOBUF_FIELD_OFFSET(CreatePermissionRequest, _impl_.description_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\41\10\11\10\13\0\0\0"
-    "siqi.auth.CreatePermissionRequest"
-    "app_code"
-    "perm_name"
-    "perm_key"
-    "description"
-  }},
-};
-
-PROTOBUF_NOINLINE void CreatePermissionRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.CreatePermissionRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.app_code_.ClearToEmpty();
-  _impl_.perm_name_.ClearToEmpty();
-  _impl_.perm_key_.ClearToEmpty();
-  _impl_.description_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* CreatePermissionRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const CreatePermissionRequest& this_ = static_cast<const CreatePermissionRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* CreatePermissionRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const CreatePermissionRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.CreatePermissionRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string app_code = 2;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.CreatePermissionRequest.app_code");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string perm_name = 3;
-          if (!this_._internal_perm_name().empty()) {
-            const std::string& _s = this_._internal_perm_name();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.CreatePermissionRequest.perm_name");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // string perm_key = 4;
-          if (!this_._internal_perm_key().empty()) {
-            const std::string& _s = this_._internal_perm_key();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.CreatePermissionRequest.perm_key");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          // string description = 5;
-          if (!this_._internal_description().empty()) {
-            const std::string& _s = this_._internal_description();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.CreatePermissionRequest.description");
-            target = stream->WriteStringMaybeAliased(5, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.CreatePermissionRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t CreatePermissionRequest::ByteSizeLong(const MessageLite& base) {
-          const CreatePermissionRequest& this_ = static_cast<const CreatePermissionRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t CreatePermissionRequest::ByteSizeLong() const {
-          const CreatePermissionRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.CreatePermissionRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string app_code = 2;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-            // string perm_name = 3;
-            if (!this_._internal_perm_name().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_perm_name());
-            }
-            // string perm_key = 4;
-            if (!this_._internal_perm_key().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_perm_key());
-            }
-            // string description = 5;
-            if (!this_._internal_description().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_description());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void CreatePermissionRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<CreatePermissionRequest*>(&to_msg);
-  auto& from = static_cast<const CreatePermissionRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.CreatePermissionRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  if (!from._internal_perm_name().empty()) {
-    _this->_internal_set_perm_name(from._internal_perm_name());
-  }
-  if (!from._internal_perm_key().empty()) {
-    _this->_internal_set_perm_key(from._internal_perm_key());
-  }
-  if (!from._internal_description().empty()) {
-    _this->_internal_set_description(from._internal_description());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void CreatePermissionRequest::CopyFrom(const CreatePermissionRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.CreatePermissionRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void CreatePermissionRequest::InternalSwap(CreatePermissionRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.perm_name_, &other->_impl_.perm_name_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.perm_key_, &other->_impl_.perm_key_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.description_, &other->_impl_.description_, arena);
-}
-
-::google::protobuf::Metadata CreatePermissionRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class UpdatePermissionRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<UpdatePermissionRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(UpdatePermissionRequest, _impl_._has_bits_);
-};
-
-UpdatePermissionRequest::UpdatePermissionRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.UpdatePermissionRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE UpdatePermissionRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::UpdatePermissionRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        app_code_(arena, from.app_code_),
-        perm_key_(arena, from.perm_key_),
-        perm_name_(arena, from.perm_name_),
-        description_(arena, from.description_) {}
-
-UpdatePermissionRequest::UpdatePermissionRequest(
-    ::google::protobuf::Arena* arena,
-    const UpdatePermissionRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  UpdatePermissionRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.UpdatePermissionRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE UpdatePermissionRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        app_code_(arena),
-        perm_key_(arena),
-        perm_name_(arena),
-        description_(arena) {}
-
-inline void UpdatePermissionRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-UpdatePermissionRequest::~UpdatePermissionRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.UpdatePermissionRequest)
-  SharedDtor(*this);
-}
-inline void UpdatePermissionRequest::SharedDtor(MessageLite& self) {
-  UpdatePermissionRequest& this_ = static_cast<UpdatePermissionRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.perm_key_.Destroy();
-  this_._impl_.perm_name_.Destroy();
-  this_._impl_.description_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* UpdatePermissionRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) UpdatePermissionRequest(arena);
-}
-constexpr auto UpdatePermissionRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(UpdatePermissionRequest),
-                                            alignof(UpdatePermissionRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull UpdatePermissionRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_UpdatePermissionRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &UpdatePermissionRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<UpdatePermissionRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &UpdatePermissionRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<UpdatePermissionRequest>(), &UpdatePermissionRequest::ByteSizeLong,
-            &UpdatePermissionRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(UpdatePermissionRequest, _impl_._cached_size_),
-        false,
-    },
-    &UpdatePermissionRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* UpdatePermissionRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 0, 78, 2> UpdatePermissionRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(UpdatePermissionRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    5, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967265,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::UpdatePermissionRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // optional string perm_name = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 0, 0, PROTOBUF_FIELD_OFFSET(UpdatePermissionRequest, _impl_.perm_name_)}},
-    // optional string description = 5;
-    {::_pbi::TcParser::FastUS1,
-     {42, 1, 0, PROTOBUF_FIELD_OFFSET(UpdatePermissionRequest, _impl_.description_)}},
-    // string app_code = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(UpdatePermissionRequest, _impl_.app_code_)}},
-    // string perm_key = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(UpdatePermissionRequest, _impl_.perm_key_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string app_code = 2;
-    {PROTOBUF_FIELD_OFFSET(UpdatePermissionRequest, _impl_.app_code_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string perm_key = 3;
-    {PROTOBUF_FIELD_OFFSET(UpdatePermissionRequest, _impl_.perm_key_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // optional string perm_name = 4;
-    {PROTOBUF_FIELD_OFFSET(UpdatePermissionRequest, _impl_.perm_name_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // optional string description = 5;
-    {PROTOBUF_FIELD_OFFSET(UpdatePermissionRequest, _impl_.description_), _Internal::kHasBitsOffset + 1, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\41\10\10\11\13\0\0\0"
-    "siqi.auth.UpdatePermissionRequest"
-    "app_code"
-    "perm_key"
-    "perm_name"
-    "description"
-  }},
-};
-
-PROTOBUF_NOINLINE void UpdatePermissionRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.UpdatePermissionRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.app_code_.ClearToEmpty();
-  _impl_.perm_key_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      _impl_.perm_name_.ClearNonDefaultToEmpty();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _impl_.description_.ClearNonDefaultToEmpty();
-    }
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* UpdatePermissionRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const UpdatePermissionRequest& this_ = static_cast<const UpdatePermissionRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* UpdatePermissionRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const UpdatePermissionRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.UpdatePermissionRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string app_code = 2;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.UpdatePermissionRequest.app_code");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string perm_key = 3;
-          if (!this_._internal_perm_key().empty()) {
-            const std::string& _s = this_._internal_perm_key();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.UpdatePermissionRequest.perm_key");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // optional string perm_name = 4;
-          if (cached_has_bits & 0x00000001u) {
-            const std::string& _s = this_._internal_perm_name();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.UpdatePermissionRequest.perm_name");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          // optional string description = 5;
-          if (cached_has_bits & 0x00000002u) {
-            const std::string& _s = this_._internal_description();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.UpdatePermissionRequest.description");
-            target = stream->WriteStringMaybeAliased(5, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.UpdatePermissionRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t UpdatePermissionRequest::ByteSizeLong(const MessageLite& base) {
-          const UpdatePermissionRequest& this_ = static_cast<const UpdatePermissionRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t UpdatePermissionRequest::ByteSizeLong() const {
-          const UpdatePermissionRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.UpdatePermissionRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string app_code = 2;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-            // string perm_key = 3;
-            if (!this_._internal_perm_key().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_perm_key());
-            }
-          }
-          cached_has_bits = this_._impl_._has_bits_[0];
-          if (cached_has_bits & 0x00000003u) {
-            // optional string perm_name = 4;
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_perm_name());
-            }
-            // optional string description = 5;
-            if (cached_has_bits & 0x00000002u) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_description());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void UpdatePermissionRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<UpdatePermissionRequest*>(&to_msg);
-  auto& from = static_cast<const UpdatePermissionRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.UpdatePermissionRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  if (!from._internal_perm_key().empty()) {
-    _this->_internal_set_perm_key(from._internal_perm_key());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      _this->_internal_set_perm_name(from._internal_perm_name());
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _this->_internal_set_description(from._internal_description());
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void UpdatePermissionRequest::CopyFrom(const UpdatePermissionRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.UpdatePermissionRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void UpdatePermissionRequest::InternalSwap(UpdatePermissionRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.perm_key_, &other->_impl_.perm_key_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.perm_name_, &other->_impl_.perm_name_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.description_, &other->_impl_.description_, arena);
-}
-
-::google::protobuf::Metadata UpdatePermissionRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class DeletePermissionRequest::_Internal {
- public:
-};
-
-DeletePermissionRequest::DeletePermissionRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.DeletePermissionRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE DeletePermissionRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::DeletePermissionRequest& from_msg)
-      : app_code_(arena, from.app_code_),
-        perm_key_(arena, from.perm_key_),
-        _cached_size_{0} {}
-
-DeletePermissionRequest::DeletePermissionRequest(
-    ::google::protobuf::Arena* arena,
-    const DeletePermissionRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  DeletePermissionRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.DeletePermissionRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE DeletePermissionRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : app_code_(arena),
-        perm_key_(arena),
-        _cached_size_{0} {}
-
-inline void DeletePermissionRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-DeletePermissionRequest::~DeletePermissionRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.DeletePermissionRequest)
-  SharedDtor(*this);
-}
-inline void DeletePermissionRequest::SharedDtor(MessageLite& self) {
-  DeletePermissionRequest& this_ = static_cast<DeletePermissionRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.perm_key_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* DeletePermissionRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) DeletePermissionRequest(arena);
-}
-constexpr auto DeletePermissionRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(DeletePermissionRequest),
-                                            alignof(DeletePermissionRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull DeletePermissionRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_DeletePermissionRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &DeletePermissionRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<DeletePermissionRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &DeletePermissionRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<DeletePermissionRequest>(), &DeletePermissionRequest::ByteSizeLong,
-            &DeletePermissionRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(DeletePermissionRequest, _impl_._cached_size_),
-        false,
-    },
-    &DeletePermissionRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* DeletePermissionRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 58, 2> DeletePermissionRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967289,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::DeletePermissionRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string app_code = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(DeletePermissionRequest, _impl_.app_code_)}},
-    // string perm_key = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(DeletePermissionRequest, _impl_.perm_key_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string app_code = 2;
-    {PROTOBUF_FIELD_OFFSET(DeletePermissionRequest, _impl_.app_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string perm_key = 3;
-    {PROTOBUF_FIELD_OFFSET(DeletePermissionRequest, _impl_.perm_key_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\41\10\10\0\0\0\0\0"
-    "siqi.auth.DeletePermissionRequest"
-    "app_code"
-    "perm_key"
-  }},
-};
-
-PROTOBUF_NOINLINE void DeletePermissionRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.DeletePermissionRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.app_code_.ClearToEmpty();
-  _impl_.perm_key_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* DeletePermissionRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const DeletePermissionRequest& this_ = static_cast<const DeletePermissionRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* DeletePermissionRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const DeletePermissionRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.DeletePermissionRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string app_code = 2;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.DeletePermissionRequest.app_code");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string perm_key = 3;
-          if (!this_._internal_perm_key().empty()) {
-            const std::string& _s = this_._internal_perm_key();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.DeletePermissionRequest.perm_key");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.DeletePermissionRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t DeletePermissionRequest::ByteSizeLong(const MessageLite& base) {
-          const DeletePermissionRequest& this_ = static_cast<const DeletePermissionRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t DeletePermissionRequest::ByteSizeLong() const {
-          const DeletePermissionRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.DeletePermissionRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string app_code = 2;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-            // string perm_key = 3;
-            if (!this_._internal_perm_key().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_perm_key());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void DeletePermissionRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<DeletePermissionRequest*>(&to_msg);
-  auto& from = static_cast<const DeletePermissionRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.DeletePermissionRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  if (!from._internal_perm_key().empty()) {
-    _this->_internal_set_perm_key(from._internal_perm_key());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void DeletePermissionRequest::CopyFrom(const DeletePermissionRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.DeletePermissionRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void DeletePermissionRequest::InternalSwap(DeletePermissionRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.perm_key_, &other->_impl_.perm_key_, arena);
-}
-
-::google::protobuf::Metadata DeletePermissionRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class ListPermissionsRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<ListPermissionsRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(ListPermissionsRequest, _impl_._has_bits_);
-};
-
-ListPermissionsRequest::ListPermissionsRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.ListPermissionsRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE ListPermissionsRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::ListPermissionsRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        app_code_(arena, from.app_code_),
-        perm_name_(arena, from.perm_name_),
-        perm_key_(arena, from.perm_key_) {}
-
-ListPermissionsRequest::ListPermissionsRequest(
-    ::google::protobuf::Arena* arena,
-    const ListPermissionsRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  ListPermissionsRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, page_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, page_),
-           offsetof(Impl_, page_size_) -
-               offsetof(Impl_, page_) +
-               sizeof(Impl_::page_size_));
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.ListPermissionsRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE ListPermissionsRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        app_code_(arena),
-        perm_name_(arena),
-        perm_key_(arena) {}
-
-inline void ListPermissionsRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, page_),
-           0,
-           offsetof(Impl_, page_size_) -
-               offsetof(Impl_, page_) +
-               sizeof(Impl_::page_size_));
-}
-ListPermissionsRequest::~ListPermissionsRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.ListPermissionsRequest)
-  SharedDtor(*this);
-}
-inline void ListPermissionsRequest::SharedDtor(MessageLite& self) {
-  ListPermissionsRequest& this_ = static_cast<ListPermissionsRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.perm_name_.Destroy();
-  this_._impl_.perm_key_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* ListPermissionsRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) ListPermissionsRequest(arena);
-}
-constexpr auto ListPermissionsRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(ListPermissionsRequest),
-                                            alignof(ListPermissionsRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull ListPermissionsRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_ListPermissionsRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &ListPermissionsRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<ListPermissionsRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &ListPermissionsRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<ListPermissionsRequest>(), &ListPermissionsRequest::ByteSizeLong,
-            &ListPermissionsRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(ListPermissionsRequest, _impl_._cached_size_),
-        false,
-    },
-    &ListPermissionsRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* ListPermissionsRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 5, 0, 66, 2> ListPermissionsRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(ListPermissionsRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    5, 56,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967264,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    5,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::ListPermissionsRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // string app_code = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(ListPermissionsRequest, _impl_.app_code_)}},
-    // int32 page = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListPermissionsRequest, _impl_.page_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(ListPermissionsRequest, _impl_.page_)}},
-    // int32 page_size = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListPermissionsRequest, _impl_.page_size_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(ListPermissionsRequest, _impl_.page_size_)}},
-    // optional string perm_name = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 0, 0, PROTOBUF_FIELD_OFFSET(ListPermissionsRequest, _impl_.perm_name_)}},
-    // optional string perm_key = 5;
-    {::_pbi::TcParser::FastUS1,
-     {42, 1, 0, PROTOBUF_FIELD_OFFSET(ListPermissionsRequest, _impl_.perm_key_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string app_code = 1;
-    {PROTOBUF_FIELD_OFFSET(ListPermissionsRequest, _impl_.app_code_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int32 page = 2;
-    {PROTOBUF_FIELD_OFFSET(ListPermissionsRequest, _impl_.page_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 page_size = 3;
-    {PROTOBUF_FIELD_OFFSET(ListPermissionsRequest, _impl_.page_size_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // optional string perm_name = 4;
-    {PROTOBUF_FIELD_OFFSET(ListPermissionsRequest, _impl_.perm_name_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // optional string perm_key = 5;
-    {PROTOBUF_FIELD_OFFSET(ListPermissionsRequest, _impl_.perm_key_), _Internal::kHasBitsOffset + 1, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\40\10\0\0\11\10\0\0"
-    "siqi.auth.ListPermissionsRequest"
-    "app_code"
-    "perm_name"
-    "perm_key"
-  }},
-};
-
-PROTOBUF_NOINLINE void ListPermissionsRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.ListPermissionsRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.app_code_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      _impl_.perm_name_.ClearNonDefaultToEmpty();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _impl_.perm_key_.ClearNonDefaultToEmpty();
-    }
-  }
-  ::memset(&_impl_.page_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.page_size_) -
-      reinterpret_cast<char*>(&_impl_.page_)) + sizeof(_impl_.page_size_));
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* ListPermissionsRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const ListPermissionsRequest& this_ = static_cast<const ListPermissionsRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* ListPermissionsRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const ListPermissionsRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.ListPermissionsRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string app_code = 1;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListPermissionsRequest.app_code");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // int32 page = 2;
-          if (this_._internal_page() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<2>(
-                    stream, this_._internal_page(), target);
-          }
-
-          // int32 page_size = 3;
-          if (this_._internal_page_size() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_page_size(), target);
-          }
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // optional string perm_name = 4;
-          if (cached_has_bits & 0x00000001u) {
-            const std::string& _s = this_._internal_perm_name();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListPermissionsRequest.perm_name");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          // optional string perm_key = 5;
-          if (cached_has_bits & 0x00000002u) {
-            const std::string& _s = this_._internal_perm_key();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListPermissionsRequest.perm_key");
-            target = stream->WriteStringMaybeAliased(5, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.ListPermissionsRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t ListPermissionsRequest::ByteSizeLong(const MessageLite& base) {
-          const ListPermissionsRequest& this_ = static_cast<const ListPermissionsRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t ListPermissionsRequest::ByteSizeLong() const {
-          const ListPermissionsRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.ListPermissionsRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string app_code = 1;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-          }
-          cached_has_bits = this_._impl_._has_bits_[0];
-          if (cached_has_bits & 0x00000003u) {
-            // optional string perm_name = 4;
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_perm_name());
-            }
-            // optional string perm_key = 5;
-            if (cached_has_bits & 0x00000002u) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_perm_key());
-            }
-          }
-           {
-            // int32 page = 2;
-            if (this_._internal_page() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page());
-            }
-            // int32 page_size = 3;
-            if (this_._internal_page_size() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page_size());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void ListPermissionsRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<ListPermissionsRequest*>(&to_msg);
-  auto& from = static_cast<const ListPermissionsRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.ListPermissionsRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      _this->_internal_set_perm_name(from._internal_perm_name());
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _this->_internal_set_perm_key(from._internal_perm_key());
-    }
-  }
-  if (from._internal_page() != 0) {
-    _this->_impl_.page_ = from._impl_.page_;
-  }
-  if (from._internal_page_size() != 0) {
-    _this->_impl_.page_size_ = from._impl_.page_size_;
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void ListPermissionsRequest::CopyFrom(const ListPermissionsRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.ListPermissionsRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void ListPermissionsRequest::InternalSwap(ListPermissionsRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.perm_name_, &other->_impl_.perm_name_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.perm_key_, &other->_impl_.perm_key_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ListPermissionsRequest, _impl_.page_size_)
-      + sizeof(ListPermissionsRequest::_impl_.page_size_)
-      - PROTOBUF_FIELD_OFFSET(ListPermissionsRequest, _impl_.page_)>(
-          reinterpret_cast<char*>(&_impl_.page_),
-          reinterpret_cast<char*>(&other->_impl_.page_));
-}
-
-::google::protobuf::Metadata ListPermissionsRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class ListPermissionsResponse_Permission::_Internal {
- public:
-};
-
-ListPermissionsResponse_Permission::ListPermissionsResponse_Permission(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.ListPermissionsResponse.Permission)
-}
-inline PROTOBUF_NDEBUG_INLINE ListPermissionsResponse_Permission::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::ListPermissionsResponse_Permission& from_msg)
-      : perm_name_(arena, from.perm_name_),
-        perm_key_(arena, from.perm_key_),
-        description_(arena, from.description_),
-        created_at_(arena, from.created_at_),
-        updated_at_(arena, from.updated_at_),
-        _cached_size_{0} {}
-
-ListPermissionsResponse_Permission::ListPermissionsResponse_Permission(
-    ::google::protobuf::Arena* arena,
-    const ListPermissionsResponse_Permission& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  ListPermissionsResponse_Permission* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.id_ = from._impl_.id_;
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.ListPermissionsResponse.Permission)
-}
-inline PROTOBUF_NDEBUG_INLINE ListPermissionsResponse_Permission::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : perm_name_(arena),
-        perm_key_(arena),
-        description_(arena),
-        created_at_(arena),
-        updated_at_(arena),
-        _cached_size_{0} {}
-
-inline void ListPermissionsResponse_Permission::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.id_ = {};
-}
-ListPermissionsResponse_Permission::~ListPermissionsResponse_Permission() {
-  // @@protoc_insertion_point(destructor:siqi.auth.ListPermissionsResponse.Permission)
-  SharedDtor(*this);
-}
-inline void ListPermissionsResponse_Permission::SharedDtor(MessageLite& self) {
-  ListPermissionsResponse_Permission& this_ = static_cast<ListPermissionsResponse_Permission&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.perm_name_.Destroy();
-  this_._impl_.perm_key_.Destroy();
-  this_._impl_.description_.Destroy();
-  this_._impl_.created_at_.Destroy();
-  this_._impl_.updated_at_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* ListPermissionsResponse_Permission::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) ListPermissionsResponse_Permission(arena);
-}
-constexpr auto ListPermissionsResponse_Permission::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(ListPermissionsResponse_Permission),
-                                            alignof(ListPermissionsResponse_Permission));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull ListPermissionsResponse_Permission::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_ListPermissionsResponse_Permission_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &ListPermissionsResponse_Permission::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<ListPermissionsResponse_Permission>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &ListPermissionsResponse_Permission::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<ListPermissionsResponse_Permission>(), &ListPermissionsResponse_Permission::ByteSizeLong,
-            &ListPermissionsResponse_Permission::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(ListPermissionsResponse_Permission, _impl_._cached_size_),
-        false,
-    },
-    &ListPermissionsResponse_Permission::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* ListPermissionsResponse_Permission::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 6, 0, 101, 2> ListPermissionsResponse_Permission::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    6, 56,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967232,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    6,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::ListPermissionsResponse_Permission>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // int64 id = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(ListPermissionsResponse_Permission, _impl_.id_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(ListPermissionsResponse_Permission, _impl_.id_)}},
-    // string perm_name = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(ListPermissionsResponse_Permission, _impl_.perm_name_)}},
-    // string perm_key = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(ListPermissionsResponse_Permission, _impl_.perm_key_)}},
-    // string description = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(ListPermissionsResponse_Permission, _impl_.description_)}},
-    // string created_at = 5;
-    {::_pbi::TcParser::FastUS1,
-     {42, 63, 0, PROTOBUF_FIELD_OFFSET(ListPermissionsResponse_Permission, _impl_.created_at_)}},
-    // string updated_at = 6;
-    {::_pbi::TcParser::FastUS1,
-     {50, 63, 0, PROTOBUF_FIELD_OFFSET(ListPermissionsResponse_Permission, _impl_.updated_at_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int64 id = 1;
-    {PROTOBUF_FIELD_OFFSET(ListPermissionsResponse_Permission, _impl_.id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
-    // string perm_name = 2;
-    {PROTOBUF_FIELD_OFFSET(ListPermissionsResponse_Permission, _impl_.perm_name_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string perm_key = 3;
-    {PROTOBUF_FIELD_OFFSET(ListPermissionsResponse_Permission, _impl_.perm_key_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string description = 4;
-    {PROTOBUF_FIELD_OFFSET(ListPermissionsResponse_Permission, _impl_.description_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string created_at = 5;
-    {PROTOBUF_FIELD_OFFSET(ListPermissionsResponse_Permission, _impl_.created_at_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string updated_at = 6;
-    {PROTOBUF_FIELD_OFFSET(ListPermissionsResponse_Permission, _impl_.updated_at_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\54\0\11\10\13\12\12\0"
-    "siqi.auth.ListPermissionsResponse.Permission"
-    "perm_name"
-    "perm_key"
-    "description"
-    "created_at"
-    "updated_at"
-  }},
-};
-
-PROTOBUF_NOINLINE void ListPermissionsResponse_Permission::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.ListPermissionsResponse.Permission)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.perm_name_.ClearToEmpty();
-  _impl_.perm_key_.ClearToEmpty();
-  _impl_.description_.ClearToEmpty();
-  _impl_.created_at_.ClearToEmpty();
-  _impl_.updated_at_.ClearToEmpty();
-  _impl_.id_ = ::int64_t{0};
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* ListPermissionsResponse_Permission::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const ListPermissionsResponse_Permission& this_ = static_cast<const ListPermissionsResponse_Permission&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* ListPermissionsResponse_Permission::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const ListPermissionsResponse_Permission& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.ListPermissionsResponse.Permission)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int64 id = 1;
-          if (this_._internal_id() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt64ToArrayWithField<1>(
-                    stream, this_._internal_id(), target);
-          }
-
-          // string perm_name = 2;
-          if (!this_._internal_perm_name().empty()) {
-            const std::string& _s = this_._internal_perm_name();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListPermissionsResponse.Permission.perm_name");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string perm_key = 3;
-          if (!this_._internal_perm_key().empty()) {
-            const std::string& _s = this_._internal_perm_key();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListPermissionsResponse.Permission.perm_key");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // string description = 4;
-          if (!this_._internal_description().empty()) {
-            const std::string& _s = this_._internal_description();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListPermissionsResponse.Permission.description");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          // string created_at = 5;
-          if (!this_._internal_created_at().empty()) {
-            const std::string& _s = this_._internal_created_at();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListPermissionsResponse.Permission.created_at");
-            target = stream->WriteStringMaybeAliased(5, _s, target);
-          }
-
-          // string updated_at = 6;
-          if (!this_._internal_updated_at().empty()) {
-            const std::string& _s = this_._internal_updated_at();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListPermissionsResponse.Permission.updated_at");
-            target = stream->WriteStringMaybeAliased(6, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.ListPermissionsResponse.Permission)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t ListPermissionsResponse_Permission::ByteSizeLong(const MessageLite& base) {
-          const ListPermissionsResponse_Permission& this_ = static_cast<const ListPermissionsResponse_Permission&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t ListPermissionsResponse_Permission::ByteSizeLong() const {
-          const ListPermissionsResponse_Permission& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.ListPermissionsResponse.Permission)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string perm_name = 2;
-            if (!this_._internal_perm_name().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_perm_name());
-            }
-            // string perm_key = 3;
-            if (!this_._internal_perm_key().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_perm_key());
-            }
-            // string description = 4;
-            if (!this_._internal_description().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_description());
-            }
-            // string created_at = 5;
-            if (!this_._internal_created_at().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_created_at());
-            }
-            // string updated_at = 6;
-            if (!this_._internal_updated_at().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_updated_at());
-            }
-            // int64 id = 1;
-            if (this_._internal_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
-                  this_._internal_id());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void ListPermissionsResponse_Permission::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<ListPermissionsResponse_Permission*>(&to_msg);
-  auto& from = static_cast<const ListPermissionsResponse_Permission&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.ListPermissionsResponse.Permission)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_perm_name().empty()) {
-    _this->_internal_set_perm_name(from._internal_perm_name());
-  }
-  if (!from._internal_perm_key().empty()) {
-    _this->_internal_set_perm_key(from._internal_perm_key());
-  }
-  if (!from._internal_description().empty()) {
-    _this->_internal_set_description(from._internal_description());
-  }
-  if (!from._internal_created_at().empty()) {
-    _this->_internal_set_created_at(from._internal_created_at());
-  }
-  if (!from._internal_updated_at().empty()) {
-    _this->_internal_set_updated_at(from._internal_updated_at());
-  }
-  if (from._internal_id() != 0) {
-    _this->_impl_.id_ = from._impl_.id_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void ListPermissionsResponse_Permission::CopyFrom(const ListPermissionsResponse_Permission& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.ListPermissionsResponse.Permission)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void ListPermissionsResponse_Permission::InternalSwap(ListPermissionsResponse_Permission* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.perm_name_, &other->_impl_.perm_name_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.perm_key_, &other->_impl_.perm_key_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.description_, &other->_impl_.description_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.created_at_, &other->_impl_.created_at_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.updated_at_, &other->_impl_.updated_at_, arena);
-        swap(_impl_.id_, other->_impl_.id_);
-}
-
-::google::protobuf::Metadata ListPermissionsResponse_Permission::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class ListPermissionsResponse::_Internal {
- public:
-};
-
-ListPermissionsResponse::ListPermissionsResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.ListPermissionsResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE ListPermissionsResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::ListPermissionsResponse& from_msg)
-      : permissions_{visibility, arena, from.permissions_},
-        _cached_size_{0} {}
-
-ListPermissionsResponse::ListPermissionsResponse(
-    ::google::protobuf::Arena* arena,
-    const ListPermissionsResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  ListPermissionsResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, total_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, total_),
-           offsetof(Impl_, page_size_) -
-               offsetof(Impl_, total_) +
-               sizeof(Impl_::page_size_));
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.ListPermissionsResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE ListPermissionsResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : permissions_{visibility, arena},
-        _cached_size_{0} {}
-
-inline void ListPermissionsResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, total_),
-           0,
-           offsetof(Impl_, page_size_) -
-               offsetof(Impl_, total_) +
-               sizeof(Impl_::page_size_));
-}
-ListPermissionsResponse::~ListPermissionsResponse() {
-  // @@protoc_insertion_point(destructor:siqi.auth.ListPermissionsResponse)
-  SharedDtor(*this);
-}
-inline void ListPermissionsResponse::SharedDtor(MessageLite& self) {
-  ListPermissionsResponse& this_ = static_cast<ListPermissionsResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* ListPermissionsResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) ListPermissionsResponse(arena);
-}
-constexpr auto ListPermissionsResponse::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(ListPermissionsResponse, _impl_.permissions_) +
-          decltype(ListPermissionsResponse::_impl_.permissions_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::ZeroInit(
-        sizeof(ListPermissionsResponse), alignof(ListPermissionsResponse), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&ListPermissionsResponse::PlacementNew_,
-                                 sizeof(ListPermissionsResponse),
-                                 alignof(ListPermissionsResponse));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull ListPermissionsResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_ListPermissionsResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &ListPermissionsResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<ListPermissionsResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &ListPermissionsResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<ListPermissionsResponse>(), &ListPermissionsResponse::ByteSizeLong,
-            &ListPermissionsResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(ListPermissionsResponse, _impl_._cached_size_),
-        false,
-    },
-    &ListPermissionsResponse::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* ListPermissionsResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 1, 0, 2> ListPermissionsResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::ListPermissionsResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // int32 page_size = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListPermissionsResponse, _impl_.page_size_), 63>(),
-     {32, 63, 0, PROTOBUF_FIELD_OFFSET(ListPermissionsResponse, _impl_.page_size_)}},
-    // repeated .siqi.auth.ListPermissionsResponse.Permission permissions = 1;
-    {::_pbi::TcParser::FastMtR1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(ListPermissionsResponse, _impl_.permissions_)}},
-    // int64 total = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(ListPermissionsResponse, _impl_.total_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(ListPermissionsResponse, _impl_.total_)}},
-    // int32 page = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListPermissionsResponse, _impl_.page_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(ListPermissionsResponse, _impl_.page_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // repeated .siqi.auth.ListPermissionsResponse.Permission permissions = 1;
-    {PROTOBUF_FIELD_OFFSET(ListPermissionsResponse, _impl_.permissions_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-    // int64 total = 2;
-    {PROTOBUF_FIELD_OFFSET(ListPermissionsResponse, _impl_.total_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
-    // int32 page = 3;
-    {PROTOBUF_FIELD_OFFSET(ListPermissionsResponse, _impl_.page_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 page_size = 4;
-    {PROTOBUF_FIELD_OFFSET(ListPermissionsResponse, _impl_.page_size_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::siqi::auth::ListPermissionsResponse_Permission>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void ListPermissionsResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.ListPermissionsResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.permissions_.Clear();
-  ::memset(&_impl_.total_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.page_size_) -
-      reinterpret_cast<char*>(&_impl_.total_)) + sizeof(_impl_.page_size_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* ListPermissionsResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const ListPermissionsResponse& this_ = static_cast<const ListPermissionsResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* ListPermissionsResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const ListPermissionsResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.ListPermissionsResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // repeated .siqi.auth.ListPermissionsResponse.Permission permissions = 1;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_permissions_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_permissions().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    1, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          // int64 total = 2;
-          if (this_._internal_total() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt64ToArrayWithField<2>(
-                    stream, this_._internal_total(), target);
-          }
-
-          // int32 page = 3;
-          if (this_._internal_page() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_page(), target);
-          }
-
-          // int32 page_size = 4;
-          if (this_._internal_page_size() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<4>(
-                    stream, this_._internal_page_size(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.ListPermissionsResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t ListPermissionsResponse::ByteSizeLong(const MessageLite& base) {
-          const ListPermissionsResponse& this_ = static_cast<const ListPermissionsResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t ListPermissionsResponse::ByteSizeLong() const {
-          const ListPermissionsResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.ListPermissionsResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .siqi.auth.ListPermissionsResponse.Permission permissions = 1;
-            {
-              total_size += 1UL * this_._internal_permissions_size();
-              for (const auto& msg : this_._internal_permissions()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-           {
-            // int64 total = 2;
-            if (this_._internal_total() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
-                  this_._internal_total());
-            }
-            // int32 page = 3;
-            if (this_._internal_page() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page());
-            }
-            // int32 page_size = 4;
-            if (this_._internal_page_size() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page_size());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void ListPermissionsResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<ListPermissionsResponse*>(&to_msg);
-  auto& from = static_cast<const ListPermissionsResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.ListPermissionsResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_permissions()->MergeFrom(
-      from._internal_permissions());
-  if (from._internal_total() != 0) {
-    _this->_impl_.total_ = from._impl_.total_;
-  }
-  if (from._internal_page() != 0) {
-    _this->_impl_.page_ = from._impl_.page_;
-  }
-  if (from._internal_page_size() != 0) {
-    _this->_impl_.page_size_ = from._impl_.page_size_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void ListPermissionsResponse::CopyFrom(const ListPermissionsResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.ListPermissionsResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void ListPermissionsResponse::InternalSwap(ListPermissionsResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.permissions_.InternalSwap(&other->_impl_.permissions_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ListPermissionsResponse, _impl_.page_size_)
-      + sizeof(ListPermissionsResponse::_impl_.page_size_)
-      - PROTOBUF_FIELD_OFFSET(ListPermissionsResponse, _impl_.total_)>(
-          reinterpret_cast<char*>(&_impl_.total_),
-          reinterpret_cast<char*>(&other->_impl_.total_));
-}
-
-::google::protobuf::Metadata ListPermissionsResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class CreateRoleRequest::_Internal {
- public:
-};
-
-CreateRoleRequest::CreateRoleRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.CreateRoleRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE CreateRoleRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::CreateRoleRequest& from_msg)
-      : app_code_(arena, from.app_code_),
-        role_name_(arena, from.role_name_),
-        role_key_(arena, from.role_key_),
-        description_(arena, from.description_),
-        _cached_size_{0} {}
-
-CreateRoleRequest::CreateRoleRequest(
-    ::google::protobuf::Arena* arena,
-    const CreateRoleRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  CreateRoleRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.is_default_ = from._impl_.is_default_;
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.CreateRoleRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE CreateRoleRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : app_code_(arena),
-        role_name_(arena),
-        role_key_(arena),
-        description_(arena),
-        _cached_size_{0} {}
-
-inline void CreateRoleRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.is_default_ = {};
-}
-CreateRoleRequest::~CreateRoleRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.CreateRoleRequest)
-  SharedDtor(*this);
-}
-inline void CreateRoleRequest::SharedDtor(MessageLite& self) {
-  CreateRoleRequest& this_ = static_cast<CreateRoleRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.role_name_.Destroy();
-  this_._impl_.role_key_.Destroy();
-  this_._impl_.description_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* CreateRoleRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) CreateRoleRequest(arena);
-}
-constexpr auto CreateRoleRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(CreateRoleRequest),
-                                            alignof(CreateRoleRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull CreateRoleRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_CreateRoleRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &CreateRoleRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<CreateRoleRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &CreateRoleRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<CreateRoleRequest>(), &CreateRoleRequest::ByteSizeLong,
-            &CreateRoleRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(CreateRoleRequest, _impl_._cached_size_),
-        false,
-    },
-    &CreateRoleRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* CreateRoleRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 5, 0, 72, 2> CreateRoleRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    6, 56,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967233,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    5,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::CreateRoleRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    // string app_code = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(CreateRoleRequest, _impl_.app_code_)}},
-    // string role_name = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(CreateRoleRequest, _impl_.role_name_)}},
-    // string role_key = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(CreateRoleRequest, _impl_.role_key_)}},
-    // string description = 5;
-    {::_pbi::TcParser::FastUS1,
-     {42, 63, 0, PROTOBUF_FIELD_OFFSET(CreateRoleRequest, _impl_.description_)}},
-    // bool is_default = 6;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(CreateRoleRequest, _impl_.is_default_), 63>(),
-     {48, 63, 0, PROTOBUF_FIELD_OFFSET(CreateRoleRequest, _impl_.is_default_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string app_code = 2;
-    {PROTOBUF_FIELD_OFFSET(CreateRoleRequest, _impl_.app_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string role_name = 3;
-    {PROTOBUF_FIELD_OFFSET(CreateRoleRequest, _impl_.role_name_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string role_key = 4;
-    {PROTOBUF_FIELD_OFFSET(CreateRoleRequest, _impl_.role_key_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string description = 5;
-    {PROTOBUF_FIELD_OFFSET(CreateRoleRequest, _impl_.description_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // bool is_default = 6;
-    {PROTOBUF_FIELD_OFFSET(CreateRoleRequest, _impl_.is_default_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
-  }},
-  // no aux_entries
-  {{
-    "\33\10\11\10\13\0\0\0"
-    "siqi.auth.CreateRoleRequest"
-    "app_code"
-    "role_name"
-    "role_key"
-    "description"
-  }},
-};
-
-PROTOBUF_NOINLINE void CreateRoleRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.CreateRoleRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.app_code_.ClearToEmpty();
-  _impl_.role_name_.ClearToEmpty();
-  _impl_.role_key_.ClearToEmpty();
-  _impl_.description_.ClearToEmpty();
-  _impl_.is_default_ = false;
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* CreateRoleRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const CreateRoleRequest& this_ = static_cast<const CreateRoleRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* CreateRoleRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const CreateRoleRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.CreateRoleRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string app_code = 2;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.CreateRoleRequest.app_code");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string role_name = 3;
-          if (!this_._internal_role_name().empty()) {
-            const std::string& _s = this_._internal_role_name();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.CreateRoleRequest.role_name");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // string role_key = 4;
-          if (!this_._internal_role_key().empty()) {
-            const std::string& _s = this_._internal_role_key();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.CreateRoleRequest.role_key");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          // string description = 5;
-          if (!this_._internal_description().empty()) {
-            const std::string& _s = this_._internal_description();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.CreateRoleRequest.description");
-            target = stream->WriteStringMaybeAliased(5, _s, target);
-          }
-
-          // bool is_default = 6;
-          if (this_._internal_is_default() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteBoolToArray(
-                6, this_._internal_is_default(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.CreateRoleRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t CreateRoleRequest::ByteSizeLong(const MessageLite& base) {
-          const CreateRoleRequest& this_ = static_cast<const CreateRoleRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t CreateRoleRequest::ByteSizeLong() const {
-          const CreateRoleRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.CreateRoleRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string app_code = 2;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-            // string role_name = 3;
-            if (!this_._internal_role_name().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_role_name());
-            }
-            // string role_key = 4;
-            if (!this_._internal_role_key().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_role_key());
-            }
-            // string description = 5;
-            if (!this_._internal_description().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_description());
-            }
-            // bool is_default = 6;
-            if (this_._internal_is_default() != 0) {
-              total_size += 2;
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void CreateRoleRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<CreateRoleRequest*>(&to_msg);
-  auto& from = static_cast<const CreateRoleRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.CreateRoleRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  if (!from._internal_role_name().empty()) {
-    _this->_internal_set_role_name(from._internal_role_name());
-  }
-  if (!from._internal_role_key().empty()) {
-    _this->_internal_set_role_key(from._internal_role_key());
-  }
-  if (!from._internal_description().empty()) {
-    _this->_internal_set_description(from._internal_description());
-  }
-  if (from._internal_is_default() != 0) {
-    _this->_impl_.is_default_ = from._impl_.is_default_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void CreateRoleRequest::CopyFrom(const CreateRoleRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.CreateRoleRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void CreateRoleRequest::InternalSwap(CreateRoleRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.role_name_, &other->_impl_.role_name_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.role_key_, &other->_impl_.role_key_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.description_, &other->_impl_.description_, arena);
-        swap(_impl_.is_default_, other->_impl_.is_default_);
-}
-
-::google::protobuf::Metadata CreateRoleRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class UpdateRoleRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<UpdateRoleRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(UpdateRoleRequest, _impl_._has_bits_);
-};
-
-UpdateRoleRequest::UpdateRoleRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.UpdateRoleRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE UpdateRoleRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::UpdateRoleRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        app_code_(arena, from.app_code_),
-        role_key_(arena, from.role_key_),
-        role_name_(arena, from.role_name_),
-        description_(arena, from.description_) {}
-
-UpdateRoleRequest::UpdateRoleRequest(
-    ::google::protobuf::Arena* arena,
-    const UpdateRoleRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  UpdateRoleRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.is_default_ = from._impl_.is_default_;
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.UpdateRoleRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE UpdateRoleRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        app_code_(arena),
-        role_key_(arena),
-        role_name_(arena),
-        description_(arena) {}
-
-inline void UpdateRoleRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.is_default_ = {};
-}
-UpdateRoleRequest::~UpdateRoleRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.UpdateRoleRequest)
-  SharedDtor(*this);
-}
-inline void UpdateRoleRequest::SharedDtor(MessageLite& self) {
-  UpdateRoleRequest& this_ = static_cast<UpdateRoleRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.role_key_.Destroy();
-  this_._impl_.role_name_.Destroy();
-  this_._impl_.description_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* UpdateRoleRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) UpdateRoleRequest(arena);
-}
-constexpr auto UpdateRoleRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(UpdateRoleRequest),
-                                            alignof(UpdateRoleRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull UpdateRoleRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_UpdateRoleRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &UpdateRoleRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<UpdateRoleRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &UpdateRoleRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<UpdateRoleRequest>(), &UpdateRoleRequest::ByteSizeLong,
-            &UpdateRoleRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(UpdateRoleRequest, _impl_._cached_size_),
-        false,
-    },
-    &UpdateRoleRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* UpdateRoleRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 5, 0, 72, 2> UpdateRoleRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(UpdateRoleRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    6, 56,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967233,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    5,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::UpdateRoleRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    // string app_code = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(UpdateRoleRequest, _impl_.app_code_)}},
-    // string role_key = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(UpdateRoleRequest, _impl_.role_key_)}},
-    // optional string role_name = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 0, 0, PROTOBUF_FIELD_OFFSET(UpdateRoleRequest, _impl_.role_name_)}},
-    // optional string description = 5;
-    {::_pbi::TcParser::FastUS1,
-     {42, 1, 0, PROTOBUF_FIELD_OFFSET(UpdateRoleRequest, _impl_.description_)}},
-    // optional bool is_default = 6;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(UpdateRoleRequest, _impl_.is_default_), 2>(),
-     {48, 2, 0, PROTOBUF_FIELD_OFFSET(UpdateRoleRequest, _impl_.is_default_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string app_code = 2;
-    {PROTOBUF_FIELD_OFFSET(UpdateRoleRequest, _impl_.app_code_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string role_key = 3;
-    {PROTOBUF_FIELD_OFFSET(UpdateRoleRequest, _impl_.role_key_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // optional string role_name = 4;
-    {PROTOBUF_FIELD_OFFSET(UpdateRoleRequest, _impl_.role_name_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // optional string description = 5;
-    {PROTOBUF_FIELD_OFFSET(UpdateRoleRequest, _impl_.description_), _Internal::kHasBitsOffset + 1, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // optional bool is_default = 6;
-    {PROTOBUF_FIELD_OFFSET(UpdateRoleRequest, _impl_.is_default_), _Internal::kHasBitsOffset + 2, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kBool)},
-  }},
-  // no aux_entries
-  {{
-    "\33\10\10\11\13\0\0\0"
-    "siqi.auth.UpdateRoleRequest"
-    "app_code"
-    "role_key"
-    "role_name"
-    "description"
-  }},
-};
-
-PROTOBUF_NOINLINE void UpdateRoleRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.UpdateRoleRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.app_code_.ClearToEmpty();
-  _impl_.role_key_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      _impl_.role_name_.ClearNonDefaultToEmpty();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _impl_.description_.ClearNonDefaultToEmpty();
-    }
-  }
-  _impl_.is_default_ = false;
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* UpdateRoleRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const UpdateRoleRequest& this_ = static_cast<const UpdateRoleRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* UpdateRoleRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const UpdateRoleRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.UpdateRoleRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string app_code = 2;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.UpdateRoleRequest.app_code");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string role_key = 3;
-          if (!this_._internal_role_key().empty()) {
-            const std::string& _s = this_._internal_role_key();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.UpdateRoleRequest.role_key");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // optional string role_name = 4;
-          if (cached_has_bits & 0x00000001u) {
-            const std::string& _s = this_._internal_role_name();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.UpdateRoleRequest.role_name");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          // optional string description = 5;
-          if (cached_has_bits & 0x00000002u) {
-            const std::string& _s = this_._internal_description();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.UpdateRoleRequest.description");
-            target = stream->WriteStringMaybeAliased(5, _s, target);
-          }
-
-          // optional bool is_default = 6;
-          if (cached_has_bits & 0x00000004u) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteBoolToArray(
-                6, this_._internal_is_default(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.UpdateRoleRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t UpdateRoleRequest::ByteSizeLong(const MessageLite& base) {
-          const UpdateRoleRequest& this_ = static_cast<const UpdateRoleRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t UpdateRoleRequest::ByteSizeLong() const {
-          const UpdateRoleRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.UpdateRoleRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string app_code = 2;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-            // string role_key = 3;
-            if (!this_._internal_role_key().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_role_key());
-            }
-          }
-          cached_has_bits = this_._impl_._has_bits_[0];
-          if (cached_has_bits & 0x00000007u) {
-            // optional string role_name = 4;
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_role_name());
-            }
-            // optional string description = 5;
-            if (cached_has_bits & 0x00000002u) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_description());
-            }
-            // optional bool is_default = 6;
-            if (cached_has_bits & 0x00000004u) {
-              total_size += 2;
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void UpdateRoleRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<UpdateRoleRequest*>(&to_msg);
-  auto& from = static_cast<const UpdateRoleRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.UpdateRoleRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  if (!from._internal_role_key().empty()) {
-    _this->_internal_set_role_key(from._internal_role_key());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000007u) {
-    if (cached_has_bits & 0x00000001u) {
-      _this->_internal_set_role_name(from._internal_role_name());
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _this->_internal_set_description(from._internal_description());
-    }
-    if (cached_has_bits & 0x00000004u) {
-      _this->_impl_.is_default_ = from._impl_.is_default_;
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void UpdateRoleRequest::CopyFrom(const UpdateRoleRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.UpdateRoleRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void UpdateRoleRequest::InternalSwap(UpdateRoleRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.role_key_, &other->_impl_.role_key_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.role_name_, &other->_impl_.role_name_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.description_, &other->_impl_.description_, arena);
-        swap(_impl_.is_default_, other->_impl_.is_default_);
-}
-
-::google::protobuf::Metadata UpdateRoleRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class DeleteRoleRequest::_Internal {
- public:
-};
-
-DeleteRoleRequest::DeleteRoleRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.DeleteRoleRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE DeleteRoleRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::DeleteRoleRequest& from_msg)
-      : app_code_(arena, from.app_code_),
-        role_key_(arena, from.role_key_),
-        _cached_size_{0} {}
-
-DeleteRoleRequest::DeleteRoleRequest(
-    ::google::protobuf::Arena* arena,
-    const DeleteRoleRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  DeleteRoleRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.DeleteRoleRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE DeleteRoleRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : app_code_(arena),
-        role_key_(arena),
-        _cached_size_{0} {}
-
-inline void DeleteRoleRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-DeleteRoleRequest::~DeleteRoleRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.DeleteRoleRequest)
-  SharedDtor(*this);
-}
-inline void DeleteRoleRequest::SharedDtor(MessageLite& self) {
-  DeleteRoleRequest& this_ = static_cast<DeleteRoleRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.role_key_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* DeleteRoleRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) DeleteRoleRequest(arena);
-}
-constexpr auto DeleteRoleRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(DeleteRoleRequest),
-                                            alignof(DeleteRoleRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull DeleteRoleRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_DeleteRoleRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &DeleteRoleRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<DeleteRoleRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &DeleteRoleRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<DeleteRoleRequest>(), &DeleteRoleRequest::ByteSizeLong,
-            &DeleteRoleRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(DeleteRoleRequest, _impl_._cached_size_),
-        false,
-    },
-    &DeleteRoleRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* DeleteRoleRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 52, 2> DeleteRoleRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967289,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::DeleteRoleRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string app_code = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(DeleteRoleRequest, _impl_.app_code_)}},
-    // string role_key = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(DeleteRoleRequest, _impl_.role_key_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string app_code = 2;
-    {PROTOBUF_FIELD_OFFSET(DeleteRoleRequest, _impl_.app_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string role_key = 3;
-    {PROTOBUF_FIELD_OFFSET(DeleteRoleRequest, _impl_.role_key_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\33\10\10\0\0\0\0\0"
-    "siqi.auth.DeleteRoleRequest"
-    "app_code"
-    "role_key"
-  }},
-};
-
-PROTOBUF_NOINLINE void DeleteRoleRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.DeleteRoleRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.app_code_.ClearToEmpty();
-  _impl_.role_key_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* DeleteRoleRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const DeleteRoleRequest& this_ = static_cast<const DeleteRoleRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* DeleteRoleRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const DeleteRoleRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.DeleteRoleRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string app_code = 2;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.DeleteRoleRequest.app_code");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string role_key = 3;
-          if (!this_._internal_role_key().empty()) {
-            const std::string& _s = this_._internal_role_key();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.DeleteRoleRequest.role_key");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.DeleteRoleRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t DeleteRoleRequest::ByteSizeLong(const MessageLite& base) {
-          const DeleteRoleRequest& this_ = static_cast<const DeleteRoleRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t DeleteRoleRequest::ByteSizeLong() const {
-          const DeleteRoleRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.DeleteRoleRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string app_code = 2;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-            // string role_key = 3;
-            if (!this_._internal_role_key().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_role_key());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void DeleteRoleRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<DeleteRoleRequest*>(&to_msg);
-  auto& from = static_cast<const DeleteRoleRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.DeleteRoleRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  if (!from._internal_role_key().empty()) {
-    _this->_internal_set_role_key(from._internal_role_key());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void DeleteRoleRequest::CopyFrom(const DeleteRoleRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.DeleteRoleRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void DeleteRoleRequest::InternalSwap(DeleteRoleRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.role_key_, &other->_impl_.role_key_, arena);
-}
-
-::google::protobuf::Metadata DeleteRoleRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class ListRolesRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<ListRolesRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(ListRolesRequest, _impl_._has_bits_);
-};
-
-ListRolesRequest::ListRolesRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.ListRolesRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE ListRolesRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::ListRolesRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        app_code_(arena, from.app_code_),
-        role_name_(arena, from.role_name_),
-        role_key_(arena, from.role_key_) {}
-
-ListRolesRequest::ListRolesRequest(
-    ::google::protobuf::Arena* arena,
-    const ListRolesRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  ListRolesRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, page_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, page_),
-           offsetof(Impl_, is_default_) -
-               offsetof(Impl_, page_) +
-               sizeof(Impl_::is_default_));
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.ListRolesRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE ListRolesRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        app_code_(arena),
-        role_name_(arena),
-        role_key_(arena) {}
-
-inline void ListRolesRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, page_),
-           0,
-           offsetof(Impl_, is_default_) -
-               offsetof(Impl_, page_) +
-               sizeof(Impl_::is_default_));
-}
-ListRolesRequest::~ListRolesRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.ListRolesRequest)
-  SharedDtor(*this);
-}
-inline void ListRolesRequest::SharedDtor(MessageLite& self) {
-  ListRolesRequest& this_ = static_cast<ListRolesRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.role_name_.Destroy();
-  this_._impl_.role_key_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* ListRolesRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) ListRolesRequest(arena);
-}
-constexpr auto ListRolesRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(ListRolesRequest),
-                                            alignof(ListRolesRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull ListRolesRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_ListRolesRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &ListRolesRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<ListRolesRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &ListRolesRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<ListRolesRequest>(), &ListRolesRequest::ByteSizeLong,
-            &ListRolesRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(ListRolesRequest, _impl_._cached_size_),
-        false,
-    },
-    &ListRolesRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* ListRolesRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 6, 0, 60, 2> ListRolesRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(ListRolesRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    6, 56,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967232,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    6,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::ListRolesRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // string app_code = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(ListRolesRequest, _impl_.app_code_)}},
-    // int32 page = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListRolesRequest, _impl_.page_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(ListRolesRequest, _impl_.page_)}},
-    // int32 page_size = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListRolesRequest, _impl_.page_size_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(ListRolesRequest, _impl_.page_size_)}},
-    // optional string role_name = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 0, 0, PROTOBUF_FIELD_OFFSET(ListRolesRequest, _impl_.role_name_)}},
-    // optional string role_key = 5;
-    {::_pbi::TcParser::FastUS1,
-     {42, 1, 0, PROTOBUF_FIELD_OFFSET(ListRolesRequest, _impl_.role_key_)}},
-    // optional bool is_default = 6;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(ListRolesRequest, _impl_.is_default_), 2>(),
-     {48, 2, 0, PROTOBUF_FIELD_OFFSET(ListRolesRequest, _impl_.is_default_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string app_code = 1;
-    {PROTOBUF_FIELD_OFFSET(ListRolesRequest, _impl_.app_code_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int32 page = 2;
-    {PROTOBUF_FIELD_OFFSET(ListRolesRequest, _impl_.page_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 page_size = 3;
-    {PROTOBUF_FIELD_OFFSET(ListRolesRequest, _impl_.page_size_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // optional string role_name = 4;
-    {PROTOBUF_FIELD_OFFSET(ListRolesRequest, _impl_.role_name_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // optional string role_key = 5;
-    {PROTOBUF_FIELD_OFFSET(ListRolesRequest, _impl_.role_key_), _Internal::kHasBitsOffset + 1, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // optional bool is_default = 6;
-    {PROTOBUF_FIELD_OFFSET(ListRolesRequest, _impl_.is_default_), _Internal::kHasBitsOffset + 2, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kBool)},
-  }},
-  // no aux_entries
-  {{
-    "\32\10\0\0\11\10\0\0"
-    "siqi.auth.ListRolesRequest"
-    "app_code"
-    "role_name"
-    "role_key"
-  }},
-};
-
-PROTOBUF_NOINLINE void ListRolesRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.ListRolesRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.app_code_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      _impl_.role_name_.ClearNonDefaultToEmpty();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _impl_.role_key_.ClearNonDefaultToEmpty();
-    }
-  }
-  ::memset(&_impl_.page_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.page_size_) -
-      reinterpret_cast<char*>(&_impl_.page_)) + sizeof(_impl_.page_size_));
-  _impl_.is_default_ = false;
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* ListRolesRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const ListRolesRequest& this_ = static_cast<const ListRolesRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* ListRolesRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const ListRolesRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.ListRolesRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string app_code = 1;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListRolesRequest.app_code");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // int32 page = 2;
-          if (this_._internal_page() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<2>(
-                    stream, this_._internal_page(), target);
-          }
-
-          // int32 page_size = 3;
-          if (this_._internal_page_size() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_page_size(), target);
-          }
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // optional string role_name = 4;
-          if (cached_has_bits & 0x00000001u) {
-            const std::string& _s = this_._internal_role_name();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListRolesRequest.role_name");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          // optional string role_key = 5;
-          if (cached_has_bits & 0x00000002u) {
-            const std::string& _s = this_._internal_role_key();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListRolesRequest.role_key");
-            target = stream->WriteStringMaybeAliased(5, _s, target);
-          }
-
-          // optional bool is_default = 6;
-          if (cached_has_bits & 0x00000004u) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteBoolToArray(
-                6, this_._internal_is_default(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.ListRolesRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t ListRolesRequest::ByteSizeLong(const MessageLite& base) {
-          const ListRolesRequest& this_ = static_cast<const ListRolesRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t ListRolesRequest::ByteSizeLong() const {
-          const ListRolesRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.ListRolesRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string app_code = 1;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-          }
-          cached_has_bits = this_._impl_._has_bits_[0];
-          if (cached_has_bits & 0x00000003u) {
-            // optional string role_name = 4;
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_role_name());
-            }
-            // optional string role_key = 5;
-            if (cached_has_bits & 0x00000002u) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_role_key());
-            }
-          }
-           {
-            // int32 page = 2;
-            if (this_._internal_page() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page());
-            }
-            // int32 page_size = 3;
-            if (this_._internal_page_size() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page_size());
-            }
-          }
-           {
-            // optional bool is_default = 6;
-            if (cached_has_bits & 0x00000004u) {
-              total_size += 2;
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void ListRolesRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<ListRolesRequest*>(&to_msg);
-  auto& from = static_cast<const ListRolesRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.ListRolesRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      _this->_internal_set_role_name(from._internal_role_name());
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _this->_internal_set_role_key(from._internal_role_key());
-    }
-  }
-  if (from._internal_page() != 0) {
-    _this->_impl_.page_ = from._impl_.page_;
-  }
-  if (from._internal_page_size() != 0) {
-    _this->_impl_.page_size_ = from._impl_.page_size_;
-  }
-  if (cached_has_bits & 0x00000004u) {
-    _this->_impl_.is_default_ = from._impl_.is_default_;
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void ListRolesRequest::CopyFrom(const ListRolesRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.ListRolesRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void ListRolesRequest::InternalSwap(ListRolesRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.role_name_, &other->_impl_.role_name_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.role_key_, &other->_impl_.role_key_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ListRolesRequest, _impl_.is_default_)
-      + sizeof(ListRolesRequest::_impl_.is_default_)
-      - PROTOBUF_FIELD_OFFSET(ListRolesRequest, _impl_.page_)>(
-          reinterpret_cast<char*>(&_impl_.page_),
-          reinterpret_cast<char*>(&other->_impl_.page_));
-}
-
-::google::protobuf::Metadata ListRolesRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class ListRolesResponse_Role::_Internal {
- public:
-};
-
-ListRolesResponse_Role::ListRolesResponse_Role(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.ListRolesResponse.Role)
-}
-inline PROTOBUF_NDEBUG_INLINE ListRolesResponse_Role::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::ListRolesResponse_Role& from_msg)
-      : perm_keys_{visibility, arena, from.perm_keys_},
-        role_name_(arena, from.role_name_),
-        role_key_(arena, from.role_key_),
-        description_(arena, from.description_),
-        created_at_(arena, from.created_at_),
-        updated_at_(arena, from.updated_at_),
-        _cached_size_{0} {}
-
-ListRolesResponse_Role::ListRolesResponse_Role(
-    ::google::protobuf::Arena* arena,
-    const ListRolesResponse_Role& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  ListRolesResponse_Role* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, id_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, id_),
-           offsetof(Impl_, is_default_) -
-               offsetof(Impl_, id_) +
-               sizeof(Impl_::is_default_));
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.ListRolesResponse.Role)
-}
-inline PROTOBUF_NDEBUG_INLINE ListRolesResponse_Role::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : perm_keys_{visibility, arena},
-        role_name_(arena),
-        role_key_(arena),
-        description_(arena),
-        created_at_(arena),
-        updated_at_(arena),
-        _cached_size_{0} {}
-
-inline void ListRolesResponse_Role::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, id_),
-           0,
-           offsetof(Impl_, is_default_) -
-               offsetof(Impl_, id_) +
-               sizeof(Impl_::is_default_));
-}
-ListRolesResponse_Role::~ListRolesResponse_Role() {
-  // @@protoc_insertion_point(destructor:siqi.auth.ListRolesResponse.Role)
-  SharedDtor(*this);
-}
-inline void ListRolesResponse_Role::SharedDtor(MessageLite& self) {
-  ListRolesResponse_Role& this_ = static_cast<ListRolesResponse_Role&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.role_name_.Destroy();
-  this_._impl_.role_key_.Destroy();
-  this_._impl_.description_.Destroy();
-  this_._impl_.created_at_.Destroy();
-  this_._impl_.updated_at_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* ListRolesResponse_Role::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) ListRolesResponse_Role(arena);
-}
-constexpr auto ListRolesResponse_Role::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(ListRolesResponse_Role, _impl_.perm_keys_) +
-          decltype(ListRolesResponse_Role::_impl_.perm_keys_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::CopyInit(
-        sizeof(ListRolesResponse_Role), alignof(ListRolesResponse_Role), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&ListRolesResponse_Role::PlacementNew_,
-                                 sizeof(ListRolesResponse_Role),
-                                 alignof(ListRolesResponse_Role));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull ListRolesResponse_Role::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_ListRolesResponse_Role_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &ListRolesResponse_Role::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<ListRolesResponse_Role>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &ListRolesResponse_Role::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<ListRolesResponse_Role>(), &ListRolesResponse_Role::ByteSizeLong,
-            &ListRolesResponse_Role::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(ListRolesResponse_Role, _impl_._cached_size_),
-        false,
-    },
-    &ListRolesResponse_Role::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* ListRolesResponse_Role::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 8, 0, 106, 2> ListRolesResponse_Role::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    8, 56,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967040,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    8,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::ListRolesResponse_Role>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // repeated string perm_keys = 8;
-    {::_pbi::TcParser::FastUR1,
-     {66, 63, 0, PROTOBUF_FIELD_OFFSET(ListRolesResponse_Role, _impl_.perm_keys_)}},
-    // int64 id = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(ListRolesResponse_Role, _impl_.id_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(ListRolesResponse_Role, _impl_.id_)}},
-    // string role_name = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(ListRolesResponse_Role, _impl_.role_name_)}},
-    // string role_key = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(ListRolesResponse_Role, _impl_.role_key_)}},
-    // string description = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(ListRolesResponse_Role, _impl_.description_)}},
-    // bool is_default = 5;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(ListRolesResponse_Role, _impl_.is_default_), 63>(),
-     {40, 63, 0, PROTOBUF_FIELD_OFFSET(ListRolesResponse_Role, _impl_.is_default_)}},
-    // string created_at = 6;
-    {::_pbi::TcParser::FastUS1,
-     {50, 63, 0, PROTOBUF_FIELD_OFFSET(ListRolesResponse_Role, _impl_.created_at_)}},
-    // string updated_at = 7;
-    {::_pbi::TcParser::FastUS1,
-     {58, 63, 0, PROTOBUF_FIELD_OFFSET(ListRolesResponse_Role, _impl_.updated_at_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int64 id = 1;
-    {PROTOBUF_FIELD_OFFSET(ListRolesResponse_Role, _impl_.id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
-    // string role_name = 2;
-    {PROTOBUF_FIELD_OFFSET(ListRolesResponse_Role, _impl_.role_name_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string role_key = 3;
-    {PROTOBUF_FIELD_OFFSET(ListRolesResponse_Role, _impl_.role_key_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string description = 4;
-    {PROTOBUF_FIELD_OFFSET(ListRolesResponse_Role, _impl_.description_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // bool is_default = 5;
-    {PROTOBUF_FIELD_OFFSET(ListRolesResponse_Role, _impl_.is_default_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
-    // string created_at = 6;
-    {PROTOBUF_FIELD_OFFSET(ListRolesResponse_Role, _impl_.created_at_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string updated_at = 7;
-    {PROTOBUF_FIELD_OFFSET(ListRolesResponse_Role, _impl_.updated_at_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // repeated string perm_keys = 8;
-    {PROTOBUF_FIELD_OFFSET(ListRolesResponse_Role, _impl_.perm_keys_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kUtf8String | ::_fl::kRepSString)},
-  }},
-  // no aux_entries
-  {{
-    "\40\0\11\10\13\0\12\12\11\0\0\0\0\0\0\0"
-    "siqi.auth.ListRolesResponse.Role"
-    "role_name"
-    "role_key"
-    "description"
-    "created_at"
-    "updated_at"
-    "perm_keys"
-  }},
-};
-
-PROTOBUF_NOINLINE void ListRolesResponse_Role::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.ListRolesResponse.Role)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.perm_keys_.Clear();
-  _impl_.role_name_.ClearToEmpty();
-  _impl_.role_key_.ClearToEmpty();
-  _impl_.description_.ClearToEmpty();
-  _impl_.created_at_.ClearToEmpty();
-  _impl_.updated_at_.ClearToEmpty();
-  ::memset(&_impl_.id_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.is_default_) -
-      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.is_default_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* ListRolesResponse_Role::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const ListRolesResponse_Role& this_ = static_cast<const ListRolesResponse_Role&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* ListRolesResponse_Role::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const ListRolesResponse_Role& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.ListRolesResponse.Role)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int64 id = 1;
-          if (this_._internal_id() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt64ToArrayWithField<1>(
-                    stream, this_._internal_id(), target);
-          }
-
-          // string role_name = 2;
-          if (!this_._internal_role_name().empty()) {
-            const std::string& _s = this_._internal_role_name();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListRolesResponse.Role.role_name");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string role_key = 3;
-          if (!this_._internal_role_key().empty()) {
-            const std::string& _s = this_._internal_role_key();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListRolesResponse.Role.role_key");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // string description = 4;
-          if (!this_._internal_description().empty()) {
-            const std::string& _s = this_._internal_description();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListRolesResponse.Role.description");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          // bool is_default = 5;
-          if (this_._internal_is_default() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteBoolToArray(
-                5, this_._internal_is_default(), target);
-          }
-
-          // string created_at = 6;
-          if (!this_._internal_created_at().empty()) {
-            const std::string& _s = this_._internal_created_at();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListRolesResponse.Role.created_at");
-            target = stream->WriteStringMaybeAliased(6, _s, target);
-          }
-
-          // string updated_at = 7;
-          if (!this_._internal_updated_at().empty()) {
-            const std::string& _s = this_._internal_updated_at();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListRolesResponse.Role.updated_at");
-            target = stream->WriteStringMaybeAliased(7, _s, target);
-          }
-
-          // repeated string perm_keys = 8;
-          for (int i = 0, n = this_._internal_perm_keys_size(); i < n; ++i) {
-            const auto& s = this_._internal_perm_keys().Get(i);
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                s.data(), static_cast<int>(s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListRolesResponse.Role.perm_keys");
-            target = stream->WriteString(8, s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.ListRolesResponse.Role)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t ListRolesResponse_Role::ByteSizeLong(const MessageLite& base) {
-          const ListRolesResponse_Role& this_ = static_cast<const ListRolesResponse_Role&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t ListRolesResponse_Role::ByteSizeLong() const {
-          const ListRolesResponse_Role& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.ListRolesResponse.Role)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated string perm_keys = 8;
-            {
-              total_size +=
-                  1 * ::google::protobuf::internal::FromIntSize(this_._internal_perm_keys().size());
-              for (int i = 0, n = this_._internal_perm_keys().size(); i < n; ++i) {
-                total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-                    this_._internal_perm_keys().Get(i));
-              }
-            }
-          }
-           {
-            // string role_name = 2;
-            if (!this_._internal_role_name().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_role_name());
-            }
-            // string role_key = 3;
-            if (!this_._internal_role_key().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_role_key());
-            }
-            // string description = 4;
-            if (!this_._internal_description().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_description());
-            }
-            // string created_at = 6;
-            if (!this_._internal_created_at().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_created_at());
-            }
-            // string updated_at = 7;
-            if (!this_._internal_updated_at().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_updated_at());
-            }
-            // int64 id = 1;
-            if (this_._internal_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
-                  this_._internal_id());
-            }
-            // bool is_default = 5;
-            if (this_._internal_is_default() != 0) {
-              total_size += 2;
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void ListRolesResponse_Role::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<ListRolesResponse_Role*>(&to_msg);
-  auto& from = static_cast<const ListRolesResponse_Role&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.ListRolesResponse.Role)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_perm_keys()->MergeFrom(from._internal_perm_keys());
-  if (!from._internal_role_name().empty()) {
-    _this->_internal_set_role_name(from._internal_role_name());
-  }
-  if (!from._internal_role_key().empty()) {
-    _this->_internal_set_role_key(from._internal_role_key());
-  }
-  if (!from._internal_description().empty()) {
-    _this->_internal_set_description(from._internal_description());
-  }
-  if (!from._internal_created_at().empty()) {
-    _this->_internal_set_created_at(from._internal_created_at());
-  }
-  if (!from._internal_updated_at().empty()) {
-    _this->_internal_set_updated_at(from._internal_updated_at());
-  }
-  if (from._internal_id() != 0) {
-    _this->_impl_.id_ = from._impl_.id_;
-  }
-  if (from._internal_is_default() != 0) {
-    _this->_impl_.is_default_ = from._impl_.is_default_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void ListRolesResponse_Role::CopyFrom(const ListRolesResponse_Role& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.ListRolesResponse.Role)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void ListRolesResponse_Role::InternalSwap(ListRolesResponse_Role* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.perm_keys_.InternalSwap(&other->_impl_.perm_keys_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.role_name_, &other->_impl_.role_name_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.role_key_, &other->_impl_.role_key_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.description_, &other->_impl_.description_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.created_at_, &other->_impl_.created_at_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.updated_at_, &other->_impl_.updated_at_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ListRolesResponse_Role, _impl_.is_default_)
-      + sizeof(ListRolesResponse_Role::_impl_.is_default_)
-      - PROTOBUF_FIELD_OFFSET(ListRolesResponse_Role, _impl_.id_)>(
-          reinterpret_cast<char*>(&_impl_.id_),
-          reinterpret_cast<char*>(&other->_impl_.id_));
-}
-
-::google::protobuf::Metadata ListRolesResponse_Role::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class ListRolesResponse::_Internal {
- public:
-};
-
-ListRolesResponse::ListRolesResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.ListRolesResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE ListRolesResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::ListRolesResponse& from_msg)
-      : roles_{visibility, arena, from.roles_},
-        _cached_size_{0} {}
-
-ListRolesResponse::ListRolesResponse(
-    ::google::protobuf::Arena* arena,
-    const ListRolesResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  ListRolesResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, total_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, total_),
-           offsetof(Impl_, page_size_) -
-               offsetof(Impl_, total_) +
-               sizeof(Impl_::page_size_));
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.ListRolesResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE ListRolesResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : roles_{visibility, arena},
-        _cached_size_{0} {}
-
-inline void ListRolesResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, total_),
-           0,
-           offsetof(Impl_, page_size_) -
-               offsetof(Impl_, total_) +
-               sizeof(Impl_::page_size_));
-}
-ListRolesResponse::~ListRolesResponse() {
-  // @@protoc_insertion_point(destructor:siqi.auth.ListRolesResponse)
-  SharedDtor(*this);
-}
-inline void ListRolesResponse::SharedDtor(MessageLite& self) {
-  ListRolesResponse& this_ = static_cast<ListRolesResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* ListRolesResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) ListRolesResponse(arena);
-}
-constexpr auto ListRolesResponse::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(ListRolesResponse, _impl_.roles_) +
-          decltype(ListRolesResponse::_impl_.roles_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::ZeroInit(
-        sizeof(ListRolesResponse), alignof(ListRolesResponse), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&ListRolesResponse::PlacementNew_,
-                                 sizeof(ListRolesResponse),
-                                 alignof(ListRolesResponse));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull ListRolesResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_ListRolesResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &ListRolesResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<ListRolesResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &ListRolesResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<ListRolesResponse>(), &ListRolesResponse::ByteSizeLong,
-            &ListRolesResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(ListRolesResponse, _impl_._cached_size_),
-        false,
-    },
-    &ListRolesResponse::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* ListRolesResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 1, 0, 2> ListRolesResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::ListRolesResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // int32 page_size = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListRolesResponse, _impl_.page_size_), 63>(),
-     {32, 63, 0, PROTOBUF_FIELD_OFFSET(ListRolesResponse, _impl_.page_size_)}},
-    // repeated .siqi.auth.ListRolesResponse.Role roles = 1;
-    {::_pbi::TcParser::FastMtR1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(ListRolesResponse, _impl_.roles_)}},
-    // int64 total = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(ListRolesResponse, _impl_.total_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(ListRolesResponse, _impl_.total_)}},
-    // int32 page = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListRolesResponse, _impl_.page_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(ListRolesResponse, _impl_.page_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // repeated .siqi.auth.ListRolesResponse.Role roles = 1;
-    {PROTOBUF_FIELD_OFFSET(ListRolesResponse, _impl_.roles_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-    // int64 total = 2;
-    {PROTOBUF_FIELD_OFFSET(ListRolesResponse, _impl_.total_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
-    // int32 page = 3;
-    {PROTOBUF_FIELD_OFFSET(ListRolesResponse, _impl_.page_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 page_size = 4;
-    {PROTOBUF_FIELD_OFFSET(ListRolesResponse, _impl_.page_size_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::siqi::auth::ListRolesResponse_Role>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void ListRolesResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.ListRolesResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.roles_.Clear();
-  ::memset(&_impl_.total_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.page_size_) -
-      reinterpret_cast<char*>(&_impl_.total_)) + sizeof(_impl_.page_size_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* ListRolesResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const ListRolesResponse& this_ = static_cast<const ListRolesResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* ListRolesResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const ListRolesResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.ListRolesResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // repeated .siqi.auth.ListRolesResponse.Role roles = 1;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_roles_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_roles().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    1, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          // int64 total = 2;
-          if (this_._internal_total() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt64ToArrayWithField<2>(
-                    stream, this_._internal_total(), target);
-          }
-
-          // int32 page = 3;
-          if (this_._internal_page() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_page(), target);
-          }
-
-          // int32 page_size = 4;
-          if (this_._internal_page_size() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<4>(
-                    stream, this_._internal_page_size(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.ListRolesResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t ListRolesResponse::ByteSizeLong(const MessageLite& base) {
-          const ListRolesResponse& this_ = static_cast<const ListRolesResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t ListRolesResponse::ByteSizeLong() const {
-          const ListRolesResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.ListRolesResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .siqi.auth.ListRolesResponse.Role roles = 1;
-            {
-              total_size += 1UL * this_._internal_roles_size();
-              for (const auto& msg : this_._internal_roles()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-           {
-            // int64 total = 2;
-            if (this_._internal_total() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
-                  this_._internal_total());
-            }
-            // int32 page = 3;
-            if (this_._internal_page() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page());
-            }
-            // int32 page_size = 4;
-            if (this_._internal_page_size() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page_size());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void ListRolesResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<ListRolesResponse*>(&to_msg);
-  auto& from = static_cast<const ListRolesResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.ListRolesResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_roles()->MergeFrom(
-      from._internal_roles());
-  if (from._internal_total() != 0) {
-    _this->_impl_.total_ = from._impl_.total_;
-  }
-  if (from._internal_page() != 0) {
-    _this->_impl_.page_ = from._impl_.page_;
-  }
-  if (from._internal_page_size() != 0) {
-    _this->_impl_.page_size_ = from._impl_.page_size_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void ListRolesResponse::CopyFrom(const ListRolesResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.ListRolesResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void ListRolesResponse::InternalSwap(ListRolesResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.roles_.InternalSwap(&other->_impl_.roles_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ListRolesResponse, _impl_.page_size_)
-      + sizeof(ListRolesResponse::_impl_.page_size_)
-      - PROTOBUF_FIELD_OFFSET(ListRolesResponse, _impl_.total_)>(
-          reinterpret_cast<char*>(&_impl_.total_),
-          reinterpret_cast<char*>(&other->_impl_.total_));
-}
-
-::google::protobuf::Metadata ListRolesResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class AddPermissionToRoleRequest::_Internal {
- public:
-};
-
-AddPermissionToRoleRequest::AddPermissionToRoleRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.AddPermissionToRoleRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE AddPermissionToRoleRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::AddPermissionToRoleRequest& from_msg)
-      : app_code_(arena, from.app_code_),
-        role_key_(arena, from.role_key_),
-        perm_key_(arena, from.perm_key_),
-        _cached_size_{0} {}
-
-AddPermissionToRoleRequest::AddPermissionToRoleRequest(
-    ::google::protobuf::Arena* arena,
-    const AddPermissionToRoleRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  AddPermissionToRoleRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.AddPermissionToRoleRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE AddPermissionToRoleRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : app_code_(arena),
-        role_key_(arena),
-        perm_key_(arena),
-        _cached_size_{0} {}
-
-inline void AddPermissionToRoleRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-AddPermissionToRoleRequest::~AddPermissionToRoleRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.AddPermissionToRoleRequest)
-  SharedDtor(*this);
-}
-inline void AddPermissionToRoleRequest::SharedDtor(MessageLite& self) {
-  AddPermissionToRoleRequest& this_ = static_cast<AddPermissionToRoleRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.role_key_.Destroy();
-  this_._impl_.perm_key_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* AddPermissionToRoleRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) AddPermissionToRoleRequest(arena);
-}
-constexpr auto AddPermissionToRoleRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(AddPermissionToRoleRequest),
-                                            alignof(AddPermissionToRoleRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull AddPermissionToRoleRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_AddPermissionToRoleRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &AddPermissionToRoleRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<AddPermissionToRoleRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &AddPermissionToRoleRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<AddPermissionToRoleRequest>(), &AddPermissionToRoleRequest::ByteSizeLong,
-            &AddPermissionToRoleRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(AddPermissionToRoleRequest, _impl_._cached_size_),
-        false,
-    },
-    &AddPermissionToRoleRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* AddPermissionToRoleRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 69, 2> AddPermissionToRoleRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967281,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::AddPermissionToRoleRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string perm_key = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(AddPermissionToRoleRequest, _impl_.perm_key_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-    // string app_code = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(AddPermissionToRoleRequest, _impl_.app_code_)}},
-    // string role_key = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(AddPermissionToRoleRequest, _impl_.role_key_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string app_code = 2;
-    {PROTOBUF_FIELD_OFFSET(AddPermissionToRoleRequest, _impl_.app_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string role_key = 3;
-    {PROTOBUF_FIELD_OFFSET(AddPermissionToRoleRequest, _impl_.role_key_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string perm_key = 4;
-    {PROTOBUF_FIELD_OFFSET(AddPermissionToRoleRequest, _impl_.perm_key_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\44\10\10\10\0\0\0\0"
-    "siqi.auth.AddPermissionToRoleRequest"
-    "app_code"
-    "role_key"
-    "perm_key"
-  }},
-};
-
-PROTOBUF_NOINLINE void AddPermissionToRoleRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.AddPermissionToRoleRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.app_code_.ClearToEmpty();
-  _impl_.role_key_.ClearToEmpty();
-  _impl_.perm_key_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* AddPermissionToRoleRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const AddPermissionToRoleRequest& this_ = static_cast<const AddPermissionToRoleRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* AddPermissionToRoleRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const AddPermissionToRoleRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.AddPermissionToRoleRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string app_code = 2;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.AddPermissionToRoleRequest.app_code");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string role_key = 3;
-          if (!this_._internal_role_key().empty()) {
-            const std::string& _s = this_._internal_role_key();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.AddPermissionToRoleRequest.role_key");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // string perm_key = 4;
-          if (!this_._internal_perm_key().empty()) {
-            const std::string& _s = this_._internal_perm_key();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.AddPermissionToRoleRequest.perm_key");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.AddPermissionToRoleRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t AddPermissionToRoleRequest::ByteSizeLong(const MessageLite& base) {
-          const AddPermissionToRoleRequest& this_ = static_cast<const AddPermissionToRoleRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t AddPermissionToRoleRequest::ByteSizeLong() const {
-          const AddPermissionToRoleRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.AddPermissionToRoleRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string app_code = 2;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-            // string role_key = 3;
-            if (!this_._internal_role_key().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_role_key());
-            }
-            // string perm_key = 4;
-            if (!this_._internal_perm_key().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_perm_key());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void AddPermissionToRoleRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<AddPermissionToRoleRequest*>(&to_msg);
-  auto& from = static_cast<const AddPermissionToRoleRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.AddPermissionToRoleRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  if (!from._internal_role_key().empty()) {
-    _this->_internal_set_role_key(from._internal_role_key());
-  }
-  if (!from._internal_perm_key().empty()) {
-    _this->_internal_set_perm_key(from._internal_perm_key());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void AddPermissionToRoleRequest::CopyFrom(const AddPermissionToRoleRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.AddPermissionToRoleRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void AddPermissionToRoleRequest::InternalSwap(AddPermissionToRoleRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.role_key_, &other->_impl_.role_key_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.perm_key_, &other->_impl_.perm_key_, arena);
-}
-
-::google::protobuf::Metadata AddPermissionToRoleRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class RemovePermissionFromRoleRequest::_Internal {
- public:
-};
-
-RemovePermissionFromRoleRequest::RemovePermissionFromRoleRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.RemovePermissionFromRoleRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE RemovePermissionFromRoleRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::RemovePermissionFromRoleRequest& from_msg)
-      : app_code_(arena, from.app_code_),
-        role_key_(arena, from.role_key_),
-        perm_key_(arena, from.perm_key_),
-        _cached_size_{0} {}
-
-RemovePermissionFromRoleRequest::RemovePermissionFromRoleRequest(
-    ::google::protobuf::Arena* arena,
-    const RemovePermissionFromRoleRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  RemovePermissionFromRoleRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.RemovePermissionFromRoleRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE RemovePermissionFromRoleRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : app_code_(arena),
-        role_key_(arena),
-        perm_key_(arena),
-        _cached_size_{0} {}
-
-inline void RemovePermissionFromRoleRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-RemovePermissionFromRoleRequest::~RemovePermissionFromRoleRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.RemovePermissionFromRoleRequest)
-  SharedDtor(*this);
-}
-inline void RemovePermissionFromRoleRequest::SharedDtor(MessageLite& self) {
-  RemovePermissionFromRoleRequest& this_ = static_cast<RemovePermissionFromRoleRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.role_key_.Destroy();
-  this_._impl_.perm_key_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* RemovePermissionFromRoleRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) RemovePermissionFromRoleRequest(arena);
-}
-constexpr auto RemovePermissionFromRoleRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(RemovePermissionFromRoleRequest),
-                                            alignof(RemovePermissionFromRoleRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull RemovePermissionFromRoleRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_RemovePermissionFromRoleRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &RemovePermissionFromRoleRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<RemovePermissionFromRoleRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &RemovePermissionFromRoleRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<RemovePermissionFromRoleRequest>(), &RemovePermissionFromRoleRequest::ByteSizeLong,
-            &RemovePermissionFromRoleRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(RemovePermissionFromRoleRequest, _impl_._cached_size_),
-        false,
-    },
-    &RemovePermissionFromRoleRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* RemovePermissionFromRoleRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 74, 2> RemovePermissionFromRoleRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967281,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::RemovePermissionFromRoleRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string perm_key = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(RemovePermissionFromRoleRequest, _impl_.perm_key_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-    // string app_code = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(RemovePermissionFromRoleRequest, _impl_.app_code_)}},
-    // string role_key = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(RemovePermissionFromRoleRequest, _impl_.role_key_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string app_code = 2;
-    {PROTOBUF_FIELD_OFFSET(RemovePermissionFromRoleRequest, _impl_.app_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string role_key = 3;
-    {PROTOBUF_FIELD_OFFSET(RemovePermissionFromRoleRequest, _impl_.role_key_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string perm_key = 4;
-    {PROTOBUF_FIELD_OFFSET(RemovePermissionFromRoleRequest, _impl_.perm_key_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\51\10\10\10\0\0\0\0"
-    "siqi.auth.RemovePermissionFromRoleRequest"
-    "app_code"
-    "role_key"
-    "perm_key"
-  }},
-};
-
-PROTOBUF_NOINLINE void RemovePermissionFromRoleRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.RemovePermissionFromRoleRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.app_code_.ClearToEmpty();
-  _impl_.role_key_.ClearToEmpty();
-  _impl_.perm_key_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* RemovePermissionFromRoleRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const RemovePermissionFromRoleRequest& this_ = static_cast<const RemovePermissionFromRoleRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* RemovePermissionFromRoleRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const RemovePermissionFromRoleRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.RemovePermissionFromRoleRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string app_code = 2;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.RemovePermissionFromRoleRequest.app_code");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string role_key = 3;
-          if (!this_._internal_role_key().empty()) {
-            const std::string& _s = this_._internal_role_key();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.RemovePermissionFromRoleRequest.role_key");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // string perm_key = 4;
-          if (!this_._internal_perm_key().empty()) {
-            const std::string& _s = this_._internal_perm_key();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.RemovePermissionFromRoleRequest.perm_key");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.RemovePermissionFromRoleRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t RemovePermissionFromRoleRequest::ByteSizeLong(const MessageLite& base) {
-          const RemovePermissionFromRoleRequest& this_ = static_cast<const RemovePermissionFromRoleRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t RemovePermissionFromRoleRequest::ByteSizeLong() const {
-          const RemovePermissionFromRoleRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.RemovePermissionFromRoleRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string app_code = 2;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-            // string role_key = 3;
-            if (!this_._internal_role_key().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_role_key());
-            }
-            // string perm_key = 4;
-            if (!this_._internal_perm_key().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_perm_key());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void RemovePermissionFromRoleRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<RemovePermissionFromRoleRequest*>(&to_msg);
-  auto& from = static_cast<const RemovePermissionFromRoleRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.RemovePermissionFromRoleRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  if (!from._internal_role_key().empty()) {
-    _this->_internal_set_role_key(from._internal_role_key());
-  }
-  if (!from._internal_perm_key().empty()) {
-    _this->_internal_set_perm_key(from._internal_perm_key());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void RemovePermissionFromRoleRequest::CopyFrom(const RemovePermissionFromRoleRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.RemovePermissionFromRoleRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void RemovePermissionFromRoleRequest::InternalSwap(RemovePermissionFromRoleRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.role_key_, &other->_impl_.role_key_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.perm_key_, &other->_impl_.perm_key_, arena);
-}
-
-::google::protobuf::Metadata RemovePermissionFromRoleRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetRolePermissionsRequest::_Internal {
- public:
-};
-
-GetRolePermissionsRequest::GetRolePermissionsRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.GetRolePermissionsRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GetRolePermissionsRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::GetRolePermissionsRequest& from_msg)
-      : app_code_(arena, from.app_code_),
-        role_key_(arena, from.role_key_),
-        _cached_size_{0} {}
-
-GetRolePermissionsRequest::GetRolePermissionsRequest(
-    ::google::protobuf::Arena* arena,
-    const GetRolePermissionsRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetRolePermissionsRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.GetRolePermissionsRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GetRolePermissionsRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : app_code_(arena),
-        role_key_(arena),
-        _cached_size_{0} {}
-
-inline void GetRolePermissionsRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-GetRolePermissionsRequest::~GetRolePermissionsRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.GetRolePermissionsRequest)
-  SharedDtor(*this);
-}
-inline void GetRolePermissionsRequest::SharedDtor(MessageLite& self) {
-  GetRolePermissionsRequest& this_ = static_cast<GetRolePermissionsRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.role_key_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* GetRolePermissionsRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetRolePermissionsRequest(arena);
-}
-constexpr auto GetRolePermissionsRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(GetRolePermissionsRequest),
-                                            alignof(GetRolePermissionsRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetRolePermissionsRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetRolePermissionsRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetRolePermissionsRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetRolePermissionsRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetRolePermissionsRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetRolePermissionsRequest>(), &GetRolePermissionsRequest::ByteSizeLong,
-            &GetRolePermissionsRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetRolePermissionsRequest, _impl_._cached_size_),
-        false,
-    },
-    &GetRolePermissionsRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetRolePermissionsRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 60, 2> GetRolePermissionsRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::GetRolePermissionsRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string role_key = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(GetRolePermissionsRequest, _impl_.role_key_)}},
-    // string app_code = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(GetRolePermissionsRequest, _impl_.app_code_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string app_code = 1;
-    {PROTOBUF_FIELD_OFFSET(GetRolePermissionsRequest, _impl_.app_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string role_key = 2;
-    {PROTOBUF_FIELD_OFFSET(GetRolePermissionsRequest, _impl_.role_key_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\43\10\10\0\0\0\0\0"
-    "siqi.auth.GetRolePermissionsRequest"
-    "app_code"
-    "role_key"
-  }},
-};
-
-PROTOBUF_NOINLINE void GetRolePermissionsRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.GetRolePermissionsRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.app_code_.ClearToEmpty();
-  _impl_.role_key_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetRolePermissionsRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetRolePermissionsRequest& this_ = static_cast<const GetRolePermissionsRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetRolePermissionsRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetRolePermissionsRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.GetRolePermissionsRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string app_code = 1;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.GetRolePermissionsRequest.app_code");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // string role_key = 2;
-          if (!this_._internal_role_key().empty()) {
-            const std::string& _s = this_._internal_role_key();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.GetRolePermissionsRequest.role_key");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.GetRolePermissionsRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetRolePermissionsRequest::ByteSizeLong(const MessageLite& base) {
-          const GetRolePermissionsRequest& this_ = static_cast<const GetRolePermissionsRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetRolePermissionsRequest::ByteSizeLong() const {
-          const GetRolePermissionsRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.GetRolePermissionsRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string app_code = 1;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-            // string role_key = 2;
-            if (!this_._internal_role_key().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_role_key());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetRolePermissionsRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetRolePermissionsRequest*>(&to_msg);
-  auto& from = static_cast<const GetRolePermissionsRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.GetRolePermissionsRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  if (!from._internal_role_key().empty()) {
-    _this->_internal_set_role_key(from._internal_role_key());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetRolePermissionsRequest::CopyFrom(const GetRolePermissionsRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.GetRolePermissionsRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetRolePermissionsRequest::InternalSwap(GetRolePermissionsRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.role_key_, &other->_impl_.role_key_, arena);
-}
-
-::google::protobuf::Metadata GetRolePermissionsRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetRolePermissionsResponse::_Internal {
- public:
-};
-
-GetRolePermissionsResponse::GetRolePermissionsResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.GetRolePermissionsResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetRolePermissionsResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::GetRolePermissionsResponse& from_msg)
-      : perm_keys_{visibility, arena, from.perm_keys_},
-        _cached_size_{0} {}
-
-GetRolePermissionsResponse::GetRolePermissionsResponse(
-    ::google::protobuf::Arena* arena,
-    const GetRolePermissionsResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetRolePermissionsResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.GetRolePermissionsResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetRolePermissionsResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : perm_keys_{visibility, arena},
-        _cached_size_{0} {}
-
-inline void GetRolePermissionsResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-GetRolePermissionsResponse::~GetRolePermissionsResponse() {
-  // @@protoc_insertion_point(destructor:siqi.auth.GetRolePermissionsResponse)
-  SharedDtor(*this);
-}
-inline void GetRolePermissionsResponse::SharedDtor(MessageLite& self) {
-  GetRolePermissionsResponse& this_ = static_cast<GetRolePermissionsResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* GetRolePermissionsResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetRolePermissionsResponse(arena);
-}
-constexpr auto GetRolePermissionsResponse::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(GetRolePermissionsResponse, _impl_.perm_keys_) +
-          decltype(GetRolePermissionsResponse::_impl_.perm_keys_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::ZeroInit(
-        sizeof(GetRolePermissionsResponse), alignof(GetRolePermissionsResponse), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&GetRolePermissionsResponse::PlacementNew_,
-                                 sizeof(GetRolePermissionsResponse),
-                                 alignof(GetRolePermissionsResponse));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetRolePermissionsResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetRolePermissionsResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetRolePermissionsResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetRolePermissionsResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetRolePermissionsResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetRolePermissionsResponse>(), &GetRolePermissionsResponse::ByteSizeLong,
-            &GetRolePermissionsResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetRolePermissionsResponse, _impl_._cached_size_),
-        false,
-    },
-    &GetRolePermissionsResponse::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetRolePermissionsResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 54, 2> GetRolePermissionsResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::GetRolePermissionsResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // repeated string perm_keys = 1;
-    {::_pbi::TcParser::FastUR1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(GetRolePermissionsResponse, _impl_.perm_keys_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // repeated string perm_keys = 1;
-    {PROTOBUF_FIELD_OFFSET(GetRolePermissionsResponse, _impl_.perm_keys_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kUtf8String | ::_fl::kRepSString)},
-  }},
-  // no aux_entries
-  {{
-    "\44\11\0\0\0\0\0\0"
-    "siqi.auth.GetRolePermissionsResponse"
-    "perm_keys"
-  }},
-};
-
-PROTOBUF_NOINLINE void GetRolePermissionsResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.GetRolePermissionsResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.perm_keys_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetRolePermissionsResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetRolePermissionsResponse& this_ = static_cast<const GetRolePermissionsResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetRolePermissionsResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetRolePermissionsResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.GetRolePermissionsResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // repeated string perm_keys = 1;
-          for (int i = 0, n = this_._internal_perm_keys_size(); i < n; ++i) {
-            const auto& s = this_._internal_perm_keys().Get(i);
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                s.data(), static_cast<int>(s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.GetRolePermissionsResponse.perm_keys");
-            target = stream->WriteString(1, s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.GetRolePermissionsResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetRolePermissionsResponse::ByteSizeLong(const MessageLite& base) {
-          const GetRolePermissionsResponse& this_ = static_cast<const GetRolePermissionsResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetRolePermissionsResponse::ByteSizeLong() const {
-          const GetRolePermissionsResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.GetRolePermissionsResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated string perm_keys = 1;
-            {
-              total_size +=
-                  1 * ::google::protobuf::internal::FromIntSize(this_._internal_perm_keys().size());
-              for (int i = 0, n = this_._internal_perm_keys().size(); i < n; ++i) {
-                total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-                    this_._internal_perm_keys().Get(i));
-              }
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetRolePermissionsResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetRolePermissionsResponse*>(&to_msg);
-  auto& from = static_cast<const GetRolePermissionsResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.GetRolePermissionsResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_perm_keys()->MergeFrom(from._internal_perm_keys());
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetRolePermissionsResponse::CopyFrom(const GetRolePermissionsResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.GetRolePermissionsResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetRolePermissionsResponse::InternalSwap(GetRolePermissionsResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.perm_keys_.InternalSwap(&other->_impl_.perm_keys_);
-}
-
-::google::protobuf::Metadata GetRolePermissionsResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GrantRoleToUserRequest::_Internal {
- public:
-};
-
-GrantRoleToUserRequest::GrantRoleToUserRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.GrantRoleToUserRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GrantRoleToUserRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::GrantRoleToUserRequest& from_msg)
-      : app_code_(arena, from.app_code_),
-        user_id_(arena, from.user_id_),
-        role_key_(arena, from.role_key_),
-        _cached_size_{0} {}
-
-GrantRoleToUserRequest::GrantRoleToUserRequest(
-    ::google::protobuf::Arena* arena,
-    const GrantRoleToUserRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GrantRoleToUserRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.GrantRoleToUserRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GrantRoleToUserRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : app_code_(arena),
-        user_id_(arena),
-        role_key_(arena),
-        _cached_size_{0} {}
-
-inline void GrantRoleToUserRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-GrantRoleToUserRequest::~GrantRoleToUserRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.GrantRoleToUserRequest)
-  SharedDtor(*this);
-}
-inline void GrantRoleToUserRequest::SharedDtor(MessageLite& self) {
-  GrantRoleToUserRequest& this_ = static_cast<GrantRoleToUserRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.user_id_.Destroy();
-  this_._impl_.role_key_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* GrantRoleToUserRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GrantRoleToUserRequest(arena);
-}
-constexpr auto GrantRoleToUserRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(GrantRoleToUserRequest),
-                                            alignof(GrantRoleToUserRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GrantRoleToUserRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GrantRoleToUserRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GrantRoleToUserRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GrantRoleToUserRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GrantRoleToUserRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GrantRoleToUserRequest>(), &GrantRoleToUserRequest::ByteSizeLong,
-            &GrantRoleToUserRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GrantRoleToUserRequest, _impl_._cached_size_),
-        false,
-    },
-    &GrantRoleToUserRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GrantRoleToUserRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 64, 2> GrantRoleToUserRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967281,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::GrantRoleToUserRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string role_key = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(GrantRoleToUserRequest, _impl_.role_key_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-    // string app_code = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(GrantRoleToUserRequest, _impl_.app_code_)}},
-    // string user_id = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(GrantRoleToUserRequest, _impl_.user_id_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string app_code = 2;
-    {PROTOBUF_FIELD_OFFSET(GrantRoleToUserRequest, _impl_.app_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string user_id = 3;
-    {PROTOBUF_FIELD_OFFSET(GrantRoleToUserRequest, _impl_.user_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string role_key = 4;
-    {PROTOBUF_FIELD_OFFSET(GrantRoleToUserRequest, _impl_.role_key_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\40\10\7\10\0\0\0\0"
-    "siqi.auth.GrantRoleToUserRequest"
-    "app_code"
-    "user_id"
-    "role_key"
-  }},
-};
-
-PROTOBUF_NOINLINE void GrantRoleToUserRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.GrantRoleToUserRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.app_code_.ClearToEmpty();
-  _impl_.user_id_.ClearToEmpty();
-  _impl_.role_key_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GrantRoleToUserRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GrantRoleToUserRequest& this_ = static_cast<const GrantRoleToUserRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GrantRoleToUserRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GrantRoleToUserRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.GrantRoleToUserRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string app_code = 2;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.GrantRoleToUserRequest.app_code");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string user_id = 3;
-          if (!this_._internal_user_id().empty()) {
-            const std::string& _s = this_._internal_user_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.GrantRoleToUserRequest.user_id");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // string role_key = 4;
-          if (!this_._internal_role_key().empty()) {
-            const std::string& _s = this_._internal_role_key();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.GrantRoleToUserRequest.role_key");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.GrantRoleToUserRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GrantRoleToUserRequest::ByteSizeLong(const MessageLite& base) {
-          const GrantRoleToUserRequest& this_ = static_cast<const GrantRoleToUserRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GrantRoleToUserRequest::ByteSizeLong() const {
-          const GrantRoleToUserRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.GrantRoleToUserRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string app_code = 2;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-            // string user_id = 3;
-            if (!this_._internal_user_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_user_id());
-            }
-            // string role_key = 4;
-            if (!this_._internal_role_key().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_role_key());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GrantRoleToUserRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GrantRoleToUserRequest*>(&to_msg);
-  auto& from = static_cast<const GrantRoleToUserRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.GrantRoleToUserRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  if (!from._internal_user_id().empty()) {
-    _this->_internal_set_user_id(from._internal_user_id());
-  }
-  if (!from._internal_role_key().empty()) {
-    _this->_internal_set_role_key(from._internal_role_key());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GrantRoleToUserRequest::CopyFrom(const GrantRoleToUserRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.GrantRoleToUserRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GrantRoleToUserRequest::InternalSwap(GrantRoleToUserRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.user_id_, &other->_impl_.user_id_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.role_key_, &other->_impl_.role_key_, arena);
-}
-
-::google::protobuf::Metadata GrantRoleToUserRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class RevokeRoleFromUserRequest::_Internal {
- public:
-};
-
-RevokeRoleFromUserRequest::RevokeRoleFromUserRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.RevokeRoleFromUserRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE RevokeRoleFromUserRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::RevokeRoleFromUserRequest& from_msg)
-      : app_code_(arena, from.app_code_),
-        user_id_(arena, from.user_id_),
-        role_key_(arena, from.role_key_),
-        _cached_size_{0} {}
-
-RevokeRoleFromUserRequest::RevokeRoleFromUserRequest(
-    ::google::protobuf::Arena* arena,
-    const RevokeRoleFromUserRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  RevokeRoleFromUserRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.RevokeRoleFromUserRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE RevokeRoleFromUserRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : app_code_(arena),
-        user_id_(arena),
-        role_key_(arena),
-        _cached_size_{0} {}
-
-inline void RevokeRoleFromUserRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-RevokeRoleFromUserRequest::~RevokeRoleFromUserRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.RevokeRoleFromUserRequest)
-  SharedDtor(*this);
-}
-inline void RevokeRoleFromUserRequest::SharedDtor(MessageLite& self) {
-  RevokeRoleFromUserRequest& this_ = static_cast<RevokeRoleFromUserRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.user_id_.Destroy();
-  this_._impl_.role_key_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* RevokeRoleFromUserRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) RevokeRoleFromUserRequest(arena);
-}
-constexpr auto RevokeRoleFromUserRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(RevokeRoleFromUserRequest),
-                                            alignof(RevokeRoleFromUserRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull RevokeRoleFromUserRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_RevokeRoleFromUserRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &RevokeRoleFromUserRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<RevokeRoleFromUserRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &RevokeRoleFromUserRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<RevokeRoleFromUserRequest>(), &RevokeRoleFromUserRequest::ByteSizeLong,
-            &RevokeRoleFromUserRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(RevokeRoleFromUserRequest, _impl_._cached_size_),
-        false,
-    },
-    &RevokeRoleFromUserRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* RevokeRoleFromUserRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 67, 2> RevokeRoleFromUserRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967281,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::RevokeRoleFromUserRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string role_key = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(RevokeRoleFromUserRequest, _impl_.role_key_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-    // string app_code = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(RevokeRoleFromUserRequest, _impl_.app_code_)}},
-    // string user_id = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(RevokeRoleFromUserRequest, _impl_.user_id_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string app_code = 2;
-    {PROTOBUF_FIELD_OFFSET(RevokeRoleFromUserRequest, _impl_.app_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string user_id = 3;
-    {PROTOBUF_FIELD_OFFSET(RevokeRoleFromUserRequest, _impl_.user_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string role_key = 4;
-    {PROTOBUF_FIELD_OFFSET(RevokeRoleFromUserRequest, _impl_.role_key_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\43\10\7\10\0\0\0\0"
-    "siqi.auth.RevokeRoleFromUserRequest"
-    "app_code"
-    "user_id"
-    "role_key"
-  }},
-};
-
-PROTOBUF_NOINLINE void RevokeRoleFromUserRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.RevokeRoleFromUserRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.app_code_.ClearToEmpty();
-  _impl_.user_id_.ClearToEmpty();
-  _impl_.role_key_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* RevokeRoleFromUserRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const RevokeRoleFromUserRequest& this_ = static_cast<const RevokeRoleFromUserRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* RevokeRoleFromUserRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const RevokeRoleFromUserRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.RevokeRoleFromUserRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string app_code = 2;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.RevokeRoleFromUserRequest.app_code");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string user_id = 3;
-          if (!this_._internal_user_id().empty()) {
-            const std::string& _s = this_._internal_user_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.RevokeRoleFromUserRequest.user_id");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // string role_key = 4;
-          if (!this_._internal_role_key().empty()) {
-            const std::string& _s = this_._internal_role_key();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.RevokeRoleFromUserRequest.role_key");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.RevokeRoleFromUserRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t RevokeRoleFromUserRequest::ByteSizeLong(const MessageLite& base) {
-          const RevokeRoleFromUserRequest& this_ = static_cast<const RevokeRoleFromUserRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t RevokeRoleFromUserRequest::ByteSizeLong() const {
-          const RevokeRoleFromUserRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.RevokeRoleFromUserRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string app_code = 2;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-            // string user_id = 3;
-            if (!this_._internal_user_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_user_id());
-            }
-            // string role_key = 4;
-            if (!this_._internal_role_key().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_role_key());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void RevokeRoleFromUserRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<RevokeRoleFromUserRequest*>(&to_msg);
-  auto& from = static_cast<const RevokeRoleFromUserRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.RevokeRoleFromUserRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  if (!from._internal_user_id().empty()) {
-    _this->_internal_set_user_id(from._internal_user_id());
-  }
-  if (!from._internal_role_key().empty()) {
-    _this->_internal_set_role_key(from._internal_role_key());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void RevokeRoleFromUserRequest::CopyFrom(const RevokeRoleFromUserRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.RevokeRoleFromUserRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void RevokeRoleFromUserRequest::InternalSwap(RevokeRoleFromUserRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.user_id_, &other->_impl_.user_id_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.role_key_, &other->_impl_.role_key_, arena);
-}
-
-::google::protobuf::Metadata RevokeRoleFromUserRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetRoleUsersRequest::_Internal {
- public:
-};
-
-GetRoleUsersRequest::GetRoleUsersRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.GetRoleUsersRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GetRoleUsersRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::GetRoleUsersRequest& from_msg)
-      : app_code_(arena, from.app_code_),
-        role_key_(arena, from.role_key_),
-        _cached_size_{0} {}
-
-GetRoleUsersRequest::GetRoleUsersRequest(
-    ::google::protobuf::Arena* arena,
-    const GetRoleUsersRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetRoleUsersRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, page_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, page_),
-           offsetof(Impl_, page_size_) -
-               offsetof(Impl_, page_) +
-               sizeof(Impl_::page_size_));
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.GetRoleUsersRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GetRoleUsersRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : app_code_(arena),
-        role_key_(arena),
-        _cached_size_{0} {}
-
-inline void GetRoleUsersRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, page_),
-           0,
-           offsetof(Impl_, page_size_) -
-               offsetof(Impl_, page_) +
-               sizeof(Impl_::page_size_));
-}
-GetRoleUsersRequest::~GetRoleUsersRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.GetRoleUsersRequest)
-  SharedDtor(*this);
-}
-inline void GetRoleUsersRequest::SharedDtor(MessageLite& self) {
-  GetRoleUsersRequest& this_ = static_cast<GetRoleUsersRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.role_key_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* GetRoleUsersRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetRoleUsersRequest(arena);
-}
-constexpr auto GetRoleUsersRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(GetRoleUsersRequest),
-                                            alignof(GetRoleUsersRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetRoleUsersRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetRoleUsersRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetRoleUsersRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetRoleUsersRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetRoleUsersRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetRoleUsersRequest>(), &GetRoleUsersRequest::ByteSizeLong,
-            &GetRoleUsersRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetRoleUsersRequest, _impl_._cached_size_),
-        false,
-    },
-    &GetRoleUsersRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetRoleUsersRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 0, 54, 2> GetRoleUsersRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::GetRoleUsersRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // int32 page_size = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(GetRoleUsersRequest, _impl_.page_size_), 63>(),
-     {32, 63, 0, PROTOBUF_FIELD_OFFSET(GetRoleUsersRequest, _impl_.page_size_)}},
-    // string app_code = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(GetRoleUsersRequest, _impl_.app_code_)}},
-    // string role_key = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(GetRoleUsersRequest, _impl_.role_key_)}},
-    // int32 page = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(GetRoleUsersRequest, _impl_.page_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(GetRoleUsersRequest, _impl_.page_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string app_code = 1;
-    {PROTOBUF_FIELD_OFFSET(GetRoleUsersRequest, _impl_.app_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string role_key = 2;
-    {PROTOBUF_FIELD_OFFSET(GetRoleUsersRequest, _impl_.role_key_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int32 page = 3;
-    {PROTOBUF_FIELD_OFFSET(GetRoleUsersRequest, _impl_.page_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 page_size = 4;
-    {PROTOBUF_FIELD_OFFSET(GetRoleUsersRequest, _impl_.page_size_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
-    "\35\10\10\0\0\0\0\0"
-    "siqi.auth.GetRoleUsersRequest"
-    "app_code"
-    "role_key"
-  }},
-};
-
-PROTOBUF_NOINLINE void GetRoleUsersRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.GetRoleUsersRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.app_code_.ClearToEmpty();
-  _impl_.role_key_.ClearToEmpty();
-  ::memset(&_impl_.page_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.page_size_) -
-      reinterpret_cast<char*>(&_impl_.page_)) + sizeof(_impl_.page_size_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetRoleUsersRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetRoleUsersRequest& this_ = static_cast<const GetRoleUsersRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetRoleUsersRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetRoleUsersRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.GetRoleUsersRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string app_code = 1;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.GetRoleUsersRequest.app_code");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // string role_key = 2;
-          if (!this_._internal_role_key().empty()) {
-            const std::string& _s = this_._internal_role_key();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.GetRoleUsersRequest.role_key");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // int32 page = 3;
-          if (this_._internal_page() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_page(), target);
-          }
-
-          // int32 page_size = 4;
-          if (this_._internal_page_size() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<4>(
-                    stream, this_._internal_page_size(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.GetRoleUsersRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetRoleUsersRequest::ByteSizeLong(const MessageLite& base) {
-          const GetRoleUsersRequest& this_ = static_cast<const GetRoleUsersRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetRoleUsersRequest::ByteSizeLong() const {
-          const GetRoleUsersRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.GetRoleUsersRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string app_code = 1;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-            // string role_key = 2;
-            if (!this_._internal_role_key().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_role_key());
-            }
-            // int32 page = 3;
-            if (this_._internal_page() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page());
-            }
-            // int32 page_size = 4;
-            if (this_._internal_page_size() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page_size());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetRoleUsersRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetRoleUsersRequest*>(&to_msg);
-  auto& from = static_cast<const GetRoleUsersRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.GetRoleUsersRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  if (!from._internal_role_key().empty()) {
-    _this->_internal_set_role_key(from._internal_role_key());
-  }
-  if (from._internal_page() != 0) {
-    _this->_impl_.page_ = from._impl_.page_;
-  }
-  if (from._internal_page_size() != 0) {
-    _this->_impl_.page_size_ = from._impl_.page_size_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetRoleUsersRequest::CopyFrom(const GetRoleUsersRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.GetRoleUsersRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetRoleUsersRequest::InternalSwap(GetRoleUsersRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.role_key_, &other->_impl_.role_key_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GetRoleUsersRequest, _impl_.page_size_)
-      + sizeof(GetRoleUsersRequest::_impl_.page_size_)
-      - PROTOBUF_FIELD_OFFSET(GetRoleUsersRequest, _impl_.page_)>(
-          reinterpret_cast<char*>(&_impl_.page_),
-          reinterpret_cast<char*>(&other->_impl_.page_));
-}
-
-::google::protobuf::Metadata GetRoleUsersRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetRoleUsersResponse_User::_Internal {
- public:
-};
-
-GetRoleUsersResponse_User::GetRoleUsersResponse_User(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.GetRoleUsersResponse.User)
-}
-inline PROTOBUF_NDEBUG_INLINE GetRoleUsersResponse_User::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::GetRoleUsersResponse_User& from_msg)
-      : user_id_(arena, from.user_id_),
-        created_at_(arena, from.created_at_),
-        _cached_size_{0} {}
-
-GetRoleUsersResponse_User::GetRoleUsersResponse_User(
-    ::google::protobuf::Arena* arena,
-    const GetRoleUsersResponse_User& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetRoleUsersResponse_User* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.GetRoleUsersResponse.User)
-}
-inline PROTOBUF_NDEBUG_INLINE GetRoleUsersResponse_User::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : user_id_(arena),
-        created_at_(arena),
-        _cached_size_{0} {}
-
-inline void GetRoleUsersResponse_User::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-GetRoleUsersResponse_User::~GetRoleUsersResponse_User() {
-  // @@protoc_insertion_point(destructor:siqi.auth.GetRoleUsersResponse.User)
-  SharedDtor(*this);
-}
-inline void GetRoleUsersResponse_User::SharedDtor(MessageLite& self) {
-  GetRoleUsersResponse_User& this_ = static_cast<GetRoleUsersResponse_User&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.user_id_.Destroy();
-  this_._impl_.created_at_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* GetRoleUsersResponse_User::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetRoleUsersResponse_User(arena);
-}
-constexpr auto GetRoleUsersResponse_User::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(GetRoleUsersResponse_User),
-                                            alignof(GetRoleUsersResponse_User));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetRoleUsersResponse_User::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetRoleUsersResponse_User_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetRoleUsersResponse_User::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetRoleUsersResponse_User>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetRoleUsersResponse_User::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetRoleUsersResponse_User>(), &GetRoleUsersResponse_User::ByteSizeLong,
-            &GetRoleUsersResponse_User::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetRoleUsersResponse_User, _impl_._cached_size_),
-        false,
-    },
-    &GetRoleUsersResponse_User::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetRoleUsersResponse_User::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 61, 2> GetRoleUsersResponse_User::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::GetRoleUsersResponse_User>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string created_at = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(GetRoleUsersResponse_User, _impl_.created_at_)}},
-    // string user_id = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(GetRoleUsersResponse_User, _impl_.user_id_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string user_id = 1;
-    {PROTOBUF_FIELD_OFFSET(GetRoleUsersResponse_User, _impl_.user_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string created_at = 2;
-    {PROTOBUF_FIELD_OFFSET(GetRoleUsersResponse_User, _impl_.created_at_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\43\7\12\0\0\0\0\0"
-    "siqi.auth.GetRoleUsersResponse.User"
-    "user_id"
-    "created_at"
-  }},
-};
-
-PROTOBUF_NOINLINE void GetRoleUsersResponse_User::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.GetRoleUsersResponse.User)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.user_id_.ClearToEmpty();
-  _impl_.created_at_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetRoleUsersResponse_User::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetRoleUsersResponse_User& this_ = static_cast<const GetRoleUsersResponse_User&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetRoleUsersResponse_User::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetRoleUsersResponse_User& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.GetRoleUsersResponse.User)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string user_id = 1;
-          if (!this_._internal_user_id().empty()) {
-            const std::string& _s = this_._internal_user_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.GetRoleUsersResponse.User.user_id");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // string created_at = 2;
-          if (!this_._internal_created_at().empty()) {
-            const std::string& _s = this_._internal_created_at();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.GetRoleUsersResponse.User.created_at");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.GetRoleUsersResponse.User)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetRoleUsersResponse_User::ByteSizeLong(const MessageLite& base) {
-          const GetRoleUsersResponse_User& this_ = static_cast<const GetRoleUsersResponse_User&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetRoleUsersResponse_User::ByteSizeLong() const {
-          const GetRoleUsersResponse_User& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.GetRoleUsersResponse.User)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string user_id = 1;
-            if (!this_._internal_user_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_user_id());
-            }
-            // string created_at = 2;
-            if (!this_._internal_created_at().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_created_at());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetRoleUsersResponse_User::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetRoleUsersResponse_User*>(&to_msg);
-  auto& from = static_cast<const GetRoleUsersResponse_User&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.GetRoleUsersResponse.User)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_user_id().empty()) {
-    _this->_internal_set_user_id(from._internal_user_id());
-  }
-  if (!from._internal_created_at().empty()) {
-    _this->_internal_set_created_at(from._internal_created_at());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetRoleUsersResponse_User::CopyFrom(const GetRoleUsersResponse_User& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.GetRoleUsersResponse.User)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetRoleUsersResponse_User::InternalSwap(GetRoleUsersResponse_User* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.user_id_, &other->_impl_.user_id_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.created_at_, &other->_impl_.created_at_, arena);
-}
-
-::google::protobuf::Metadata GetRoleUsersResponse_User::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetRoleUsersResponse::_Internal {
- public:
-};
-
-GetRoleUsersResponse::GetRoleUsersResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.GetRoleUsersResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetRoleUsersResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::GetRoleUsersResponse& from_msg)
-      : users_{visibility, arena, from.users_},
-        _cached_size_{0} {}
-
-GetRoleUsersResponse::GetRoleUsersResponse(
-    ::google::protobuf::Arena* arena,
-    const GetRoleUsersResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetRoleUsersResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, total_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, total_),
-           offsetof(Impl_, page_size_) -
-               offsetof(Impl_, total_) +
-               sizeof(Impl_::page_size_));
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.GetRoleUsersResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetRoleUsersResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : users_{visibility, arena},
-        _cached_size_{0} {}
-
-inline void GetRoleUsersResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, total_),
-           0,
-           offsetof(Impl_, page_size_) -
-               offsetof(Impl_, total_) +
-               sizeof(Impl_::page_size_));
-}
-GetRoleUsersResponse::~GetRoleUsersResponse() {
-  // @@protoc_insertion_point(destructor:siqi.auth.GetRoleUsersResponse)
-  SharedDtor(*this);
-}
-inline void GetRoleUsersResponse::SharedDtor(MessageLite& self) {
-  GetRoleUsersResponse& this_ = static_cast<GetRoleUsersResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* GetRoleUsersResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetRoleUsersResponse(arena);
-}
-constexpr auto GetRoleUsersResponse::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(GetRoleUsersResponse, _impl_.users_) +
-          decltype(GetRoleUsersResponse::_impl_.users_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::ZeroInit(
-        sizeof(GetRoleUsersResponse), alignof(GetRoleUsersResponse), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&GetRoleUsersResponse::PlacementNew_,
-                                 sizeof(GetRoleUsersResponse),
-                                 alignof(GetRoleUsersResponse));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetRoleUsersResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetRoleUsersResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetRoleUsersResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetRoleUsersResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetRoleUsersResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetRoleUsersResponse>(), &GetRoleUsersResponse::ByteSizeLong,
-            &GetRoleUsersResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetRoleUsersResponse, _impl_._cached_size_),
-        false,
-    },
-    &GetRoleUsersResponse::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetRoleUsersResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 1, 0, 2> GetRoleUsersResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::GetRoleUsersResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // int32 page_size = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(GetRoleUsersResponse, _impl_.page_size_), 63>(),
-     {32, 63, 0, PROTOBUF_FIELD_OFFSET(GetRoleUsersResponse, _impl_.page_size_)}},
-    // repeated .siqi.auth.GetRoleUsersResponse.User users = 1;
-    {::_pbi::TcParser::FastMtR1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(GetRoleUsersResponse, _impl_.users_)}},
-    // int64 total = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(GetRoleUsersResponse, _impl_.total_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(GetRoleUsersResponse, _impl_.total_)}},
-    // int32 page = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(GetRoleUsersResponse, _impl_.page_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(GetRoleUsersResponse, _impl_.page_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // repeated .siqi.auth.GetRoleUsersResponse.User users = 1;
-    {PROTOBUF_FIELD_OFFSET(GetRoleUsersResponse, _impl_.users_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-    // int64 total = 2;
-    {PROTOBUF_FIELD_OFFSET(GetRoleUsersResponse, _impl_.total_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
-    // int32 page = 3;
-    {PROTOBUF_FIELD_OFFSET(GetRoleUsersResponse, _impl_.page_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 page_size = 4;
-    {PROTOBUF_FIELD_OFFSET(GetRoleUsersResponse, _impl_.page_size_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::siqi::auth::GetRoleUsersResponse_User>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void GetRoleUsersResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.GetRoleUsersResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.users_.Clear();
-  ::memset(&_impl_.total_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.page_size_) -
-      reinterpret_cast<char*>(&_impl_.total_)) + sizeof(_impl_.page_size_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetRoleUsersResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetRoleUsersResponse& this_ = static_cast<const GetRoleUsersResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetRoleUsersResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetRoleUsersResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.GetRoleUsersResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // repeated .siqi.auth.GetRoleUsersResponse.User users = 1;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_users_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_users().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    1, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          // int64 total = 2;
-          if (this_._internal_total() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt64ToArrayWithField<2>(
-                    stream, this_._internal_total(), target);
-          }
-
-          // int32 page = 3;
-          if (this_._internal_page() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_page(), target);
-          }
-
-          // int32 page_size = 4;
-          if (this_._internal_page_size() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<4>(
-                    stream, this_._internal_page_size(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.GetRoleUsersResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetRoleUsersResponse::ByteSizeLong(const MessageLite& base) {
-          const GetRoleUsersResponse& this_ = static_cast<const GetRoleUsersResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetRoleUsersResponse::ByteSizeLong() const {
-          const GetRoleUsersResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.GetRoleUsersResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .siqi.auth.GetRoleUsersResponse.User users = 1;
-            {
-              total_size += 1UL * this_._internal_users_size();
-              for (const auto& msg : this_._internal_users()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-           {
-            // int64 total = 2;
-            if (this_._internal_total() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
-                  this_._internal_total());
-            }
-            // int32 page = 3;
-            if (this_._internal_page() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page());
-            }
-            // int32 page_size = 4;
-            if (this_._internal_page_size() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page_size());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetRoleUsersResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetRoleUsersResponse*>(&to_msg);
-  auto& from = static_cast<const GetRoleUsersResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.GetRoleUsersResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_users()->MergeFrom(
-      from._internal_users());
-  if (from._internal_total() != 0) {
-    _this->_impl_.total_ = from._impl_.total_;
-  }
-  if (from._internal_page() != 0) {
-    _this->_impl_.page_ = from._impl_.page_;
-  }
-  if (from._internal_page_size() != 0) {
-    _this->_impl_.page_size_ = from._impl_.page_size_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetRoleUsersResponse::CopyFrom(const GetRoleUsersResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.GetRoleUsersResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetRoleUsersResponse::InternalSwap(GetRoleUsersResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.users_.InternalSwap(&other->_impl_.users_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GetRoleUsersResponse, _impl_.page_size_)
-      + sizeof(GetRoleUsersResponse::_impl_.page_size_)
-      - PROTOBUF_FIELD_OFFSET(GetRoleUsersResponse, _impl_.total_)>(
-          reinterpret_cast<char*>(&_impl_.total_),
-          reinterpret_cast<char*>(&other->_impl_.total_));
-}
-
-::google::protobuf::Metadata GetRoleUsersResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class ListAuditLogsRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<ListAuditLogsRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(ListAuditLogsRequest, _impl_._has_bits_);
-};
-
-ListAuditLogsRequest::ListAuditLogsRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.ListAuditLogsRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE ListAuditLogsRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::ListAuditLogsRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        operator_id_(arena, from.operator_id_),
-        app_code_(arena, from.app_code_),
-        action_(arena, from.action_),
-        target_id_(arena, from.target_id_) {}
-
-ListAuditLogsRequest::ListAuditLogsRequest(
-    ::google::protobuf::Arena* arena,
-    const ListAuditLogsRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  ListAuditLogsRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, page_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, page_),
-           offsetof(Impl_, end_time_) -
-               offsetof(Impl_, page_) +
-               sizeof(Impl_::end_time_));
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.ListAuditLogsRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE ListAuditLogsRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        operator_id_(arena),
-        app_code_(arena),
-        action_(arena),
-        target_id_(arena) {}
-
-inline void ListAuditLogsRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, page_),
-           0,
-           offsetof(Impl_, end_time_) -
-               offsetof(Impl_, page_) +
-               sizeof(Impl_::end_time_));
-}
-ListAuditLogsRequest::~ListAuditLogsRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.ListAuditLogsRequest)
-  SharedDtor(*this);
-}
-inline void ListAuditLogsRequest::SharedDtor(MessageLite& self) {
-  ListAuditLogsRequest& this_ = static_cast<ListAuditLogsRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.operator_id_.Destroy();
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.action_.Destroy();
-  this_._impl_.target_id_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* ListAuditLogsRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) ListAuditLogsRequest(arena);
-}
-constexpr auto ListAuditLogsRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(ListAuditLogsRequest),
-                                            alignof(ListAuditLogsRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull ListAuditLogsRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_ListAuditLogsRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &ListAuditLogsRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<ListAuditLogsRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &ListAuditLogsRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<ListAuditLogsRequest>(), &ListAuditLogsRequest::ByteSizeLong,
-            &ListAuditLogsRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(ListAuditLogsRequest, _impl_._cached_size_),
-        false,
-    },
-    &ListAuditLogsRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* ListAuditLogsRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 8, 0, 81, 2> ListAuditLogsRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(ListAuditLogsRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    8, 56,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967040,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    8,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::ListAuditLogsRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // optional int64 end_time = 8;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(ListAuditLogsRequest, _impl_.end_time_), 5>(),
-     {64, 5, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsRequest, _impl_.end_time_)}},
-    // int32 page = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListAuditLogsRequest, _impl_.page_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsRequest, _impl_.page_)}},
-    // int32 page_size = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListAuditLogsRequest, _impl_.page_size_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsRequest, _impl_.page_size_)}},
-    // optional string operator_id = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 0, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsRequest, _impl_.operator_id_)}},
-    // optional string app_code = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 1, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsRequest, _impl_.app_code_)}},
-    // optional string action = 5;
-    {::_pbi::TcParser::FastUS1,
-     {42, 2, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsRequest, _impl_.action_)}},
-    // optional string target_id = 6;
-    {::_pbi::TcParser::FastUS1,
-     {50, 3, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsRequest, _impl_.target_id_)}},
-    // optional int64 start_time = 7;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(ListAuditLogsRequest, _impl_.start_time_), 4>(),
-     {56, 4, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsRequest, _impl_.start_time_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 page = 1;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsRequest, _impl_.page_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 page_size = 2;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsRequest, _impl_.page_size_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // optional string operator_id = 3;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsRequest, _impl_.operator_id_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // optional string app_code = 4;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsRequest, _impl_.app_code_), _Internal::kHasBitsOffset + 1, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // optional string action = 5;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsRequest, _impl_.action_), _Internal::kHasBitsOffset + 2, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // optional string target_id = 6;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsRequest, _impl_.target_id_), _Internal::kHasBitsOffset + 3, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // optional int64 start_time = 7;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsRequest, _impl_.start_time_), _Internal::kHasBitsOffset + 4, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kInt64)},
-    // optional int64 end_time = 8;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsRequest, _impl_.end_time_), _Internal::kHasBitsOffset + 5, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kInt64)},
-  }},
-  // no aux_entries
-  {{
-    "\36\0\0\13\10\6\11\0\0\0\0\0\0\0\0\0"
-    "siqi.auth.ListAuditLogsRequest"
-    "operator_id"
-    "app_code"
-    "action"
-    "target_id"
-  }},
-};
-
-PROTOBUF_NOINLINE void ListAuditLogsRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.ListAuditLogsRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x0000000fu) {
-    if (cached_has_bits & 0x00000001u) {
-      _impl_.operator_id_.ClearNonDefaultToEmpty();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _impl_.app_code_.ClearNonDefaultToEmpty();
-    }
-    if (cached_has_bits & 0x00000004u) {
-      _impl_.action_.ClearNonDefaultToEmpty();
-    }
-    if (cached_has_bits & 0x00000008u) {
-      _impl_.target_id_.ClearNonDefaultToEmpty();
-    }
-  }
-  ::memset(&_impl_.page_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.page_size_) -
-      reinterpret_cast<char*>(&_impl_.page_)) + sizeof(_impl_.page_size_));
-  if (cached_has_bits & 0x00000030u) {
-    ::memset(&_impl_.start_time_, 0, static_cast<::size_t>(
-        reinterpret_cast<char*>(&_impl_.end_time_) -
-        reinterpret_cast<char*>(&_impl_.start_time_)) + sizeof(_impl_.end_time_));
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* ListAuditLogsRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const ListAuditLogsRequest& this_ = static_cast<const ListAuditLogsRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* ListAuditLogsRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const ListAuditLogsRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.ListAuditLogsRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 page = 1;
-          if (this_._internal_page() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_page(), target);
-          }
-
-          // int32 page_size = 2;
-          if (this_._internal_page_size() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<2>(
-                    stream, this_._internal_page_size(), target);
-          }
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // optional string operator_id = 3;
-          if (cached_has_bits & 0x00000001u) {
-            const std::string& _s = this_._internal_operator_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListAuditLogsRequest.operator_id");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // optional string app_code = 4;
-          if (cached_has_bits & 0x00000002u) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListAuditLogsRequest.app_code");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          // optional string action = 5;
-          if (cached_has_bits & 0x00000004u) {
-            const std::string& _s = this_._internal_action();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListAuditLogsRequest.action");
-            target = stream->WriteStringMaybeAliased(5, _s, target);
-          }
-
-          // optional string target_id = 6;
-          if (cached_has_bits & 0x00000008u) {
-            const std::string& _s = this_._internal_target_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListAuditLogsRequest.target_id");
-            target = stream->WriteStringMaybeAliased(6, _s, target);
-          }
-
-          // optional int64 start_time = 7;
-          if (cached_has_bits & 0x00000010u) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt64ToArrayWithField<7>(
-                    stream, this_._internal_start_time(), target);
-          }
-
-          // optional int64 end_time = 8;
-          if (cached_has_bits & 0x00000020u) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt64ToArrayWithField<8>(
-                    stream, this_._internal_end_time(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.ListAuditLogsRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t ListAuditLogsRequest::ByteSizeLong(const MessageLite& base) {
-          const ListAuditLogsRequest& this_ = static_cast<const ListAuditLogsRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t ListAuditLogsRequest::ByteSizeLong() const {
-          const ListAuditLogsRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.ListAuditLogsRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-          cached_has_bits = this_._impl_._has_bits_[0];
-          if (cached_has_bits & 0x0000000fu) {
-            // optional string operator_id = 3;
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_operator_id());
-            }
-            // optional string app_code = 4;
-            if (cached_has_bits & 0x00000002u) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-            // optional string action = 5;
-            if (cached_has_bits & 0x00000004u) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_action());
-            }
-            // optional string target_id = 6;
-            if (cached_has_bits & 0x00000008u) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_target_id());
-            }
-          }
-           {
-            // int32 page = 1;
-            if (this_._internal_page() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page());
-            }
-            // int32 page_size = 2;
-            if (this_._internal_page_size() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page_size());
-            }
-          }
-          if (cached_has_bits & 0x00000030u) {
-            // optional int64 start_time = 7;
-            if (cached_has_bits & 0x00000010u) {
-              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
-                  this_._internal_start_time());
-            }
-            // optional int64 end_time = 8;
-            if (cached_has_bits & 0x00000020u) {
-              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
-                  this_._internal_end_time());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void ListAuditLogsRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<ListAuditLogsRequest*>(&to_msg);
-  auto& from = static_cast<const ListAuditLogsRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.ListAuditLogsRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x0000000fu) {
-    if (cached_has_bits & 0x00000001u) {
-      _this->_internal_set_operator_id(from._internal_operator_id());
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _this->_internal_set_app_code(from._internal_app_code());
-    }
-    if (cached_has_bits & 0x00000004u) {
-      _this->_internal_set_action(from._internal_action());
-    }
-    if (cached_has_bits & 0x00000008u) {
-      _this->_internal_set_target_id(from._internal_target_id());
-    }
-  }
-  if (from._internal_page() != 0) {
-    _this->_impl_.page_ = from._impl_.page_;
-  }
-  if (from._internal_page_size() != 0) {
-    _this->_impl_.page_size_ = from._impl_.page_size_;
-  }
-  if (cached_has_bits & 0x00000030u) {
-    if (cached_has_bits & 0x00000010u) {
-      _this->_impl_.start_time_ = from._impl_.start_time_;
-    }
-    if (cached_has_bits & 0x00000020u) {
-      _this->_impl_.end_time_ = from._impl_.end_time_;
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void ListAuditLogsRequest::CopyFrom(const ListAuditLogsRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.ListAuditLogsRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void ListAuditLogsRequest::InternalSwap(ListAuditLogsRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.operator_id_, &other->_impl_.operator_id_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.action_, &other->_impl_.action_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.target_id_, &other->_impl_.target_id_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ListAuditLogsRequest, _impl_.end_time_)
-      + sizeof(ListAuditLogsRequest::_impl_.end_time_)
-      - PROTOBUF_FIELD_OFFSET(ListAuditLogsRequest, _impl_.page_)>(
-          reinterpret_cast<char*>(&_impl_.page_),
-          reinterpret_cast<char*>(&other->_impl_.page_));
-}
-
-::google::protobuf::Metadata ListAuditLogsRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class ListAuditLogsResponse_AuditLog::_Internal {
- public:
-};
-
-ListAuditLogsResponse_AuditLog::ListAuditLogsResponse_AuditLog(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.ListAuditLogsResponse.AuditLog)
-}
-inline PROTOBUF_NDEBUG_INLINE ListAuditLogsResponse_AuditLog::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::ListAuditLogsResponse_AuditLog& from_msg)
-      : operator_name_(arena, from.operator_name_),
-        app_code_(arena, from.app_code_),
-        action_(arena, from.action_),
-        target_type_(arena, from.target_type_),
-        target_id_(arena, from.target_id_),
-        target_name_(arena, from.target_name_),
-        object_type_(arena, from.object_type_),
-        object_id_(arena, from.object_id_),
-        object_name_(arena, from.object_name_),
-        created_at_(arena, from.created_at_),
-        _cached_size_{0} {}
-
-ListAuditLogsResponse_AuditLog::ListAuditLogsResponse_AuditLog(
-    ::google::protobuf::Arena* arena,
-    const ListAuditLogsResponse_AuditLog& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  ListAuditLogsResponse_AuditLog* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, id_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, id_),
-           offsetof(Impl_, operator_id_) -
-               offsetof(Impl_, id_) +
-               sizeof(Impl_::operator_id_));
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.ListAuditLogsResponse.AuditLog)
-}
-inline PROTOBUF_NDEBUG_INLINE ListAuditLogsResponse_AuditLog::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : operator_name_(arena),
-        app_code_(arena),
-        action_(arena),
-        target_type_(arena),
-        target_id_(arena),
-        target_name_(arena),
-        object_type_(arena),
-        object_id_(arena),
-        object_name_(arena),
-        created_at_(arena),
-        _cached_size_{0} {}
-
-inline void ListAuditLogsResponse_AuditLog::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, id_),
-           0,
-           offsetof(Impl_, operator_id_) -
-               offsetof(Impl_, id_) +
-               sizeof(Impl_::operator_id_));
-}
-ListAuditLogsResponse_AuditLog::~ListAuditLogsResponse_AuditLog() {
-  // @@protoc_insertion_point(destructor:siqi.auth.ListAuditLogsResponse.AuditLog)
-  SharedDtor(*this);
-}
-inline void ListAuditLogsResponse_AuditLog::SharedDtor(MessageLite& self) {
-  ListAuditLogsResponse_AuditLog& this_ = static_cast<ListAuditLogsResponse_AuditLog&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.operator_name_.Destroy();
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.action_.Destroy();
-  this_._impl_.target_type_.Destroy();
-  this_._impl_.target_id_.Destroy();
-  this_._impl_.target_name_.Destroy();
-  this_._impl_.object_type_.Destroy();
-  this_._impl_.object_id_.Destroy();
-  this_._impl_.object_name_.Destroy();
-  this_._impl_.created_at_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* ListAuditLogsResponse_AuditLog::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) ListAuditLogsResponse_AuditLog(arena);
-}
-constexpr auto ListAuditLogsResponse_AuditLog::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(ListAuditLogsResponse_AuditLog),
-                                            alignof(ListAuditLogsResponse_AuditLog));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull ListAuditLogsResponse_AuditLog::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_ListAuditLogsResponse_AuditLog_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &ListAuditLogsResponse_AuditLog::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<ListAuditLogsResponse_AuditLog>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &ListAuditLogsResponse_AuditLog::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<ListAuditLogsResponse_AuditLog>(), &ListAuditLogsResponse_AuditLog::ByteSizeLong,
-            &ListAuditLogsResponse_AuditLog::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_._cached_size_),
-        false,
-    },
-    &ListAuditLogsResponse_AuditLog::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* ListAuditLogsResponse_AuditLog::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<4, 12, 0, 156, 2> ListAuditLogsResponse_AuditLog::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    12, 120,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294963200,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    12,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::ListAuditLogsResponse_AuditLog>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // int64 id = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(ListAuditLogsResponse_AuditLog, _impl_.id_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.id_)}},
-    // int64 operator_id = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(ListAuditLogsResponse_AuditLog, _impl_.operator_id_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.operator_id_)}},
-    // string operator_name = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.operator_name_)}},
-    // string app_code = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.app_code_)}},
-    // string action = 5;
-    {::_pbi::TcParser::FastUS1,
-     {42, 63, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.action_)}},
-    // string target_type = 6;
-    {::_pbi::TcParser::FastUS1,
-     {50, 63, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.target_type_)}},
-    // string target_id = 7;
-    {::_pbi::TcParser::FastUS1,
-     {58, 63, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.target_id_)}},
-    // string target_name = 8;
-    {::_pbi::TcParser::FastUS1,
-     {66, 63, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.target_name_)}},
-    // string object_type = 9;
-    {::_pbi::TcParser::FastUS1,
-     {74, 63, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.object_type_)}},
-    // string object_id = 10;
-    {::_pbi::TcParser::FastUS1,
-     {82, 63, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.object_id_)}},
-    // string object_name = 11;
-    {::_pbi::TcParser::FastUS1,
-     {90, 63, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.object_name_)}},
-    // string created_at = 12;
-    {::_pbi::TcParser::FastUS1,
-     {98, 63, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.created_at_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int64 id = 1;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
-    // int64 operator_id = 2;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.operator_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
-    // string operator_name = 3;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.operator_name_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string app_code = 4;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.app_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string action = 5;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.action_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string target_type = 6;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.target_type_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string target_id = 7;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.target_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string target_name = 8;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.target_name_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string object_type = 9;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.object_type_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string object_id = 10;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.object_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string object_name = 11;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.object_name_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string created_at = 12;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.created_at_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\50\0\0\15\10\6\13\11\13\13\11\13\12\0\0\0"
-    "siqi.auth.ListAuditLogsResponse.AuditLog"
-    "operator_name"
-    "app_code"
-    "action"
-    "target_type"
-    "target_id"
-    "target_name"
-    "object_type"
-    "object_id"
-    "object_name"
-    "created_at"
-  }},
-};
-
-PROTOBUF_NOINLINE void ListAuditLogsResponse_AuditLog::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.ListAuditLogsResponse.AuditLog)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.operator_name_.ClearToEmpty();
-  _impl_.app_code_.ClearToEmpty();
-  _impl_.action_.ClearToEmpty();
-  _impl_.target_type_.ClearToEmpty();
-  _impl_.target_id_.ClearToEmpty();
-  _impl_.target_name_.ClearToEmpty();
-  _impl_.object_type_.ClearToEmpty();
-  _impl_.object_id_.ClearToEmpty();
-  _impl_.object_name_.ClearToEmpty();
-  _impl_.created_at_.ClearToEmpty();
-  ::memset(&_impl_.id_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.operator_id_) -
-      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.operator_id_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* ListAuditLogsResponse_AuditLog::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const ListAuditLogsResponse_AuditLog& this_ = static_cast<const ListAuditLogsResponse_AuditLog&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* ListAuditLogsResponse_AuditLog::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const ListAuditLogsResponse_AuditLog& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.ListAuditLogsResponse.AuditLog)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int64 id = 1;
-          if (this_._internal_id() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt64ToArrayWithField<1>(
-                    stream, this_._internal_id(), target);
-          }
-
-          // int64 operator_id = 2;
-          if (this_._internal_operator_id() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt64ToArrayWithField<2>(
-                    stream, this_._internal_operator_id(), target);
-          }
-
-          // string operator_name = 3;
-          if (!this_._internal_operator_name().empty()) {
-            const std::string& _s = this_._internal_operator_name();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListAuditLogsResponse.AuditLog.operator_name");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // string app_code = 4;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListAuditLogsResponse.AuditLog.app_code");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          // string action = 5;
-          if (!this_._internal_action().empty()) {
-            const std::string& _s = this_._internal_action();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListAuditLogsResponse.AuditLog.action");
-            target = stream->WriteStringMaybeAliased(5, _s, target);
-          }
-
-          // string target_type = 6;
-          if (!this_._internal_target_type().empty()) {
-            const std::string& _s = this_._internal_target_type();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListAuditLogsResponse.AuditLog.target_type");
-            target = stream->WriteStringMaybeAliased(6, _s, target);
-          }
-
-          // string target_id = 7;
-          if (!this_._internal_target_id().empty()) {
-            const std::string& _s = this_._internal_target_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListAuditLogsResponse.AuditLog.target_id");
-            target = stream->WriteStringMaybeAliased(7, _s, target);
-          }
-
-          // string target_name = 8;
-          if (!this_._internal_target_name().empty()) {
-            const std::string& _s = this_._internal_target_name();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListAuditLogsResponse.AuditLog.target_name");
-            target = stream->WriteStringMaybeAliased(8, _s, target);
-          }
-
-          // string object_type = 9;
-          if (!this_._internal_object_type().empty()) {
-            const std::string& _s = this_._internal_object_type();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListAuditLogsResponse.AuditLog.object_type");
-            target = stream->WriteStringMaybeAliased(9, _s, target);
-          }
-
-          // string object_id = 10;
-          if (!this_._internal_object_id().empty()) {
-            const std::string& _s = this_._internal_object_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListAuditLogsResponse.AuditLog.object_id");
-            target = stream->WriteStringMaybeAliased(10, _s, target);
-          }
-
-          // string object_name = 11;
-          if (!this_._internal_object_name().empty()) {
-            const std::string& _s = this_._internal_object_name();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListAuditLogsResponse.AuditLog.object_name");
-            target = stream->WriteStringMaybeAliased(11, _s, target);
-          }
-
-          // string created_at = 12;
-          if (!this_._internal_created_at().empty()) {
-            const std::string& _s = this_._internal_created_at();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListAuditLogsResponse.AuditLog.created_at");
-            target = stream->WriteStringMaybeAliased(12, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.ListAuditLogsResponse.AuditLog)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t ListAuditLogsResponse_AuditLog::ByteSizeLong(const MessageLite& base) {
-          const ListAuditLogsResponse_AuditLog& this_ = static_cast<const ListAuditLogsResponse_AuditLog&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t ListAuditLogsResponse_AuditLog::ByteSizeLong() const {
-          const ListAuditLogsResponse_AuditLog& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.ListAuditLogsResponse.AuditLog)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string operator_name = 3;
-            if (!this_._internal_operator_name().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_operator_name());
-            }
-            // string app_code = 4;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-            // string action = 5;
-            if (!this_._internal_action().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_action());
-            }
-            // string target_type = 6;
-            if (!this_._internal_target_type().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_target_type());
-            }
-            // string target_id = 7;
-            if (!this_._internal_target_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_target_id());
-            }
-            // string target_name = 8;
-            if (!this_._internal_target_name().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_target_name());
-            }
-            // string object_type = 9;
-            if (!this_._internal_object_type().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_object_type());
-            }
-            // string object_id = 10;
-            if (!this_._internal_object_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_object_id());
-            }
-            // string object_name = 11;
-            if (!this_._internal_object_name().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_object_name());
-            }
-            // string created_at = 12;
-            if (!this_._internal_created_at().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_created_at());
-            }
-            // int64 id = 1;
-            if (this_._internal_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
-                  this_._internal_id());
-            }
-            // int64 operator_id = 2;
-            if (this_._internal_operator_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
-                  this_._internal_operator_id());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void ListAuditLogsResponse_AuditLog::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<ListAuditLogsResponse_AuditLog*>(&to_msg);
-  auto& from = static_cast<const ListAuditLogsResponse_AuditLog&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.ListAuditLogsResponse.AuditLog)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_operator_name().empty()) {
-    _this->_internal_set_operator_name(from._internal_operator_name());
-  }
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  if (!from._internal_action().empty()) {
-    _this->_internal_set_action(from._internal_action());
-  }
-  if (!from._internal_target_type().empty()) {
-    _this->_internal_set_target_type(from._internal_target_type());
-  }
-  if (!from._internal_target_id().empty()) {
-    _this->_internal_set_target_id(from._internal_target_id());
-  }
-  if (!from._internal_target_name().empty()) {
-    _this->_internal_set_target_name(from._internal_target_name());
-  }
-  if (!from._internal_object_type().empty()) {
-    _this->_internal_set_object_type(from._internal_object_type());
-  }
-  if (!from._internal_object_id().empty()) {
-    _this->_internal_set_object_id(from._internal_object_id());
-  }
-  if (!from._internal_object_name().empty()) {
-    _this->_internal_set_object_name(from._internal_object_name());
-  }
-  if (!from._internal_created_at().empty()) {
-    _this->_internal_set_created_at(from._internal_created_at());
-  }
-  if (from._internal_id() != 0) {
-    _this->_impl_.id_ = from._impl_.id_;
-  }
-  if (from._internal_operator_id() != 0) {
-    _this->_impl_.operator_id_ = from._impl_.operator_id_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void ListAuditLogsResponse_AuditLog::CopyFrom(const ListAuditLogsResponse_AuditLog& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.ListAuditLogsResponse.AuditLog)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void ListAuditLogsResponse_AuditLog::InternalSwap(ListAuditLogsResponse_AuditLog* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.operator_name_, &other->_impl_.operator_name_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.action_, &other->_impl_.action_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.target_type_, &other->_impl_.target_type_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.target_id_, &other->_impl_.target_id_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.target_name_, &other->_impl_.target_name_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.object_type_, &other->_impl_.object_type_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.object_id_, &other->_impl_.object_id_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.object_name_, &other->_impl_.object_name_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.created_at_, &other->_impl_.created_at_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.operator_id_)
-      + sizeof(ListAuditLogsResponse_AuditLog::_impl_.operator_id_)
-      - PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse_AuditLog, _impl_.id_)>(
-          reinterpret_cast<char*>(&_impl_.id_),
-          reinterpret_cast<char*>(&other->_impl_.id_));
-}
-
-::google::protobuf::Metadata ListAuditLogsResponse_AuditLog::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class ListAuditLogsResponse::_Internal {
- public:
-};
-
-ListAuditLogsResponse::ListAuditLogsResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.ListAuditLogsResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE ListAuditLogsResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::ListAuditLogsResponse& from_msg)
-      : logs_{visibility, arena, from.logs_},
-        _cached_size_{0} {}
-
-ListAuditLogsResponse::ListAuditLogsResponse(
-    ::google::protobuf::Arena* arena,
-    const ListAuditLogsResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  ListAuditLogsResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, total_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, total_),
-           offsetof(Impl_, page_size_) -
-               offsetof(Impl_, total_) +
-               sizeof(Impl_::page_size_));
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.ListAuditLogsResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE ListAuditLogsResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : logs_{visibility, arena},
-        _cached_size_{0} {}
-
-inline void ListAuditLogsResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, total_),
-           0,
-           offsetof(Impl_, page_size_) -
-               offsetof(Impl_, total_) +
-               sizeof(Impl_::page_size_));
-}
-ListAuditLogsResponse::~ListAuditLogsResponse() {
-  // @@protoc_insertion_point(destructor:siqi.auth.ListAuditLogsResponse)
-  SharedDtor(*this);
-}
-inline void ListAuditLogsResponse::SharedDtor(MessageLite& self) {
-  ListAuditLogsResponse& this_ = static_cast<ListAuditLogsResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* ListAuditLogsResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) ListAuditLogsResponse(arena);
-}
-constexpr auto ListAuditLogsResponse::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse, _impl_.logs_) +
-          decltype(ListAuditLogsResponse::_impl_.logs_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::ZeroInit(
-        sizeof(ListAuditLogsResponse), alignof(ListAuditLogsResponse), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&ListAuditLogsResponse::PlacementNew_,
-                                 sizeof(ListAuditLogsResponse),
-                                 alignof(ListAuditLogsResponse));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull ListAuditLogsResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_ListAuditLogsResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &ListAuditLogsResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<ListAuditLogsResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &ListAuditLogsResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<ListAuditLogsResponse>(), &ListAuditLogsResponse::ByteSizeLong,
-            &ListAuditLogsResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse, _impl_._cached_size_),
-        false,
-    },
-    &ListAuditLogsResponse::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* ListAuditLogsResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 1, 0, 2> ListAuditLogsResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::ListAuditLogsResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // int32 page_size = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListAuditLogsResponse, _impl_.page_size_), 63>(),
-     {32, 63, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse, _impl_.page_size_)}},
-    // repeated .siqi.auth.ListAuditLogsResponse.AuditLog logs = 1;
-    {::_pbi::TcParser::FastMtR1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse, _impl_.logs_)}},
-    // int64 total = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(ListAuditLogsResponse, _impl_.total_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse, _impl_.total_)}},
-    // int32 page = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListAuditLogsResponse, _impl_.page_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse, _impl_.page_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // repeated .siqi.auth.ListAuditLogsResponse.AuditLog logs = 1;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse, _impl_.logs_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-    // int64 total = 2;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse, _impl_.total_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
-    // int32 page = 3;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse, _impl_.page_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 page_size = 4;
-    {PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse, _impl_.page_size_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::siqi::auth::ListAuditLogsResponse_AuditLog>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void ListAuditLogsResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.ListAuditLogsResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.logs_.Clear();
-  ::memset(&_impl_.total_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.page_size_) -
-      reinterpret_cast<char*>(&_impl_.total_)) + sizeof(_impl_.page_size_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* ListAuditLogsResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const ListAuditLogsResponse& this_ = static_cast<const ListAuditLogsResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* ListAuditLogsResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const ListAuditLogsResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.ListAuditLogsResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // repeated .siqi.auth.ListAuditLogsResponse.AuditLog logs = 1;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_logs_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_logs().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    1, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          // int64 total = 2;
-          if (this_._internal_total() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt64ToArrayWithField<2>(
-                    stream, this_._internal_total(), target);
-          }
-
-          // int32 page = 3;
-          if (this_._internal_page() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_page(), target);
-          }
-
-          // int32 page_size = 4;
-          if (this_._internal_page_size() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<4>(
-                    stream, this_._internal_page_size(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.ListAuditLogsResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t ListAuditLogsResponse::ByteSizeLong(const MessageLite& base) {
-          const ListAuditLogsResponse& this_ = static_cast<const ListAuditLogsResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t ListAuditLogsResponse::ByteSizeLong() const {
-          const ListAuditLogsResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.ListAuditLogsResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .siqi.auth.ListAuditLogsResponse.AuditLog logs = 1;
-            {
-              total_size += 1UL * this_._internal_logs_size();
-              for (const auto& msg : this_._internal_logs()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-           {
-            // int64 total = 2;
-            if (this_._internal_total() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
-                  this_._internal_total());
-            }
-            // int32 page = 3;
-            if (this_._internal_page() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page());
-            }
-            // int32 page_size = 4;
-            if (this_._internal_page_size() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page_size());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void ListAuditLogsResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<ListAuditLogsResponse*>(&to_msg);
-  auto& from = static_cast<const ListAuditLogsResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.ListAuditLogsResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_logs()->MergeFrom(
-      from._internal_logs());
-  if (from._internal_total() != 0) {
-    _this->_impl_.total_ = from._impl_.total_;
-  }
-  if (from._internal_page() != 0) {
-    _this->_impl_.page_ = from._impl_.page_;
-  }
-  if (from._internal_page_size() != 0) {
-    _this->_impl_.page_size_ = from._impl_.page_size_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void ListAuditLogsResponse::CopyFrom(const ListAuditLogsResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.ListAuditLogsResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void ListAuditLogsResponse::InternalSwap(ListAuditLogsResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.logs_.InternalSwap(&other->_impl_.logs_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse, _impl_.page_size_)
-      + sizeof(ListAuditLogsResponse::_impl_.page_size_)
-      - PROTOBUF_FIELD_OFFSET(ListAuditLogsResponse, _impl_.total_)>(
-          reinterpret_cast<char*>(&_impl_.total_),
-          reinterpret_cast<char*>(&other->_impl_.total_));
-}
-
-::google::protobuf::Metadata ListAuditLogsResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class AdminResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<AdminResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(AdminResponse, _impl_._has_bits_);
-};
-
-AdminResponse::AdminResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.AdminResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE AdminResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::AdminResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        message_(arena, from.message_),
-        app_secret_(arena, from.app_secret_) {}
-
-AdminResponse::AdminResponse(
-    ::google::protobuf::Arena* arena,
-    const AdminResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  AdminResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, success_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, success_),
-           offsetof(Impl_, code_) -
-               offsetof(Impl_, success_) +
-               sizeof(Impl_::code_));
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.AdminResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE AdminResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        message_(arena),
-        app_secret_(arena) {}
-
-inline void AdminResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, success_),
-           0,
-           offsetof(Impl_, code_) -
-               offsetof(Impl_, success_) +
-               sizeof(Impl_::code_));
-}
-AdminResponse::~AdminResponse() {
-  // @@protoc_insertion_point(destructor:siqi.auth.AdminResponse)
-  SharedDtor(*this);
-}
-inline void AdminResponse::SharedDtor(MessageLite& self) {
-  AdminResponse& this_ = static_cast<AdminResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.message_.Destroy();
-  this_._impl_.app_secret_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* AdminResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) AdminResponse(arena);
-}
-constexpr auto AdminResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(AdminResponse),
-                                            alignof(AdminResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull AdminResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_AdminResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &AdminResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<AdminResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &AdminResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<AdminResponse>(), &AdminResponse::ByteSizeLong,
-            &AdminResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(AdminResponse, _impl_._cached_size_),
-        false,
-    },
-    &AdminResponse::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* AdminResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 0, 49, 2> AdminResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(AdminResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::AdminResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // optional string app_secret = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 0, 0, PROTOBUF_FIELD_OFFSET(AdminResponse, _impl_.app_secret_)}},
-    // bool success = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(AdminResponse, _impl_.success_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(AdminResponse, _impl_.success_)}},
-    // int32 code = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(AdminResponse, _impl_.code_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(AdminResponse, _impl_.code_)}},
-    // string message = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(AdminResponse, _impl_.message_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // bool success = 1;
-    {PROTOBUF_FIELD_OFFSET(AdminResponse, _impl_.success_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
-    // int32 code = 2;
-    {PROTOBUF_FIELD_OFFSET(AdminResponse, _impl_.code_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // string message = 3;
-    {PROTOBUF_FIELD_OFFSET(AdminResponse, _impl_.message_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // optional string app_secret = 4;
-    {PROTOBUF_FIELD_OFFSET(AdminResponse, _impl_.app_secret_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\27\0\0\7\12\0\0\0"
-    "siqi.auth.AdminResponse"
-    "message"
-    "app_secret"
-  }},
-};
-
-PROTOBUF_NOINLINE void AdminResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.AdminResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.message_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.app_secret_.ClearNonDefaultToEmpty();
-  }
-  ::memset(&_impl_.success_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.code_) -
-      reinterpret_cast<char*>(&_impl_.success_)) + sizeof(_impl_.code_));
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* AdminResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const AdminResponse& this_ = static_cast<const AdminResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* AdminResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const AdminResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.AdminResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // bool success = 1;
-          if (this_._internal_success() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteBoolToArray(
-                1, this_._internal_success(), target);
-          }
-
-          // int32 code = 2;
-          if (this_._internal_code() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<2>(
-                    stream, this_._internal_code(), target);
-          }
-
-          // string message = 3;
-          if (!this_._internal_message().empty()) {
-            const std::string& _s = this_._internal_message();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.AdminResponse.message");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // optional string app_secret = 4;
-          if (cached_has_bits & 0x00000001u) {
-            const std::string& _s = this_._internal_app_secret();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.AdminResponse.app_secret");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.AdminResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t AdminResponse::ByteSizeLong(const MessageLite& base) {
-          const AdminResponse& this_ = static_cast<const AdminResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t AdminResponse::ByteSizeLong() const {
-          const AdminResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.AdminResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string message = 3;
-            if (!this_._internal_message().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_message());
-            }
-          }
-           {
-            // optional string app_secret = 4;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_secret());
-            }
-          }
-           {
-            // bool success = 1;
-            if (this_._internal_success() != 0) {
-              total_size += 2;
-            }
-            // int32 code = 2;
-            if (this_._internal_code() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_code());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void AdminResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<AdminResponse*>(&to_msg);
-  auto& from = static_cast<const AdminResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.AdminResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_message().empty()) {
-    _this->_internal_set_message(from._internal_message());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _this->_internal_set_app_secret(from._internal_app_secret());
-  }
-  if (from._internal_success() != 0) {
-    _this->_impl_.success_ = from._impl_.success_;
-  }
-  if (from._internal_code() != 0) {
-    _this->_impl_.code_ = from._impl_.code_;
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void AdminResponse::CopyFrom(const AdminResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.AdminResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void AdminResponse::InternalSwap(AdminResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.message_, &other->_impl_.message_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_secret_, &other->_impl_.app_secret_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(AdminResponse, _impl_.code_)
-      + sizeof(AdminResponse::_impl_.code_)
-      - PROTOBUF_FIELD_OFFSET(AdminResponse, _impl_.success_)>(
-          reinterpret_cast<char*>(&_impl_.success_),
-          reinterpret_cast<char*>(&other->_impl_.success_));
-}
-
-::google::protobuf::Metadata AdminResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class LoginRequest::_Internal {
- public:
-};
-
-LoginRequest::LoginRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.LoginRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE LoginRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::LoginRequest& from_msg)
-      : username_(arena, from.username_),
-        password_(arena, from.password_),
-        _cached_size_{0} {}
-
-LoginRequest::LoginRequest(
-    ::google::protobuf::Arena* arena,
-    const LoginRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  LoginRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.LoginRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE LoginRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : username_(arena),
-        password_(arena),
-        _cached_size_{0} {}
-
-inline void LoginRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-LoginRequest::~LoginRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.LoginRequest)
-  SharedDtor(*this);
-}
-inline void LoginRequest::SharedDtor(MessageLite& self) {
-  LoginRequest& this_ = static_cast<LoginRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.username_.Destroy();
-  this_._impl_.password_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* LoginRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) LoginRequest(arena);
-}
-constexpr auto LoginRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(LoginRequest),
-                                            alignof(LoginRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull LoginRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_LoginRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &LoginRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<LoginRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &LoginRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<LoginRequest>(), &LoginRequest::ByteSizeLong,
-            &LoginRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(LoginRequest, _impl_._cached_size_),
-        false,
-    },
-    &LoginRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* LoginRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 47, 2> LoginRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::LoginRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string password = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(LoginRequest, _impl_.password_)}},
-    // string username = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(LoginRequest, _impl_.username_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string username = 1;
-    {PROTOBUF_FIELD_OFFSET(LoginRequest, _impl_.username_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string password = 2;
-    {PROTOBUF_FIELD_OFFSET(LoginRequest, _impl_.password_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\26\10\10\0\0\0\0\0"
-    "siqi.auth.LoginRequest"
-    "username"
-    "password"
-  }},
-};
-
-PROTOBUF_NOINLINE void LoginRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.LoginRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.username_.ClearToEmpty();
-  _impl_.password_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* LoginRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const LoginRequest& this_ = static_cast<const LoginRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* LoginRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const LoginRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.LoginRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string username = 1;
-          if (!this_._internal_username().empty()) {
-            const std::string& _s = this_._internal_username();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.LoginRequest.username");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // string password = 2;
-          if (!this_._internal_password().empty()) {
-            const std::string& _s = this_._internal_password();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.LoginRequest.password");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.LoginRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t LoginRequest::ByteSizeLong(const MessageLite& base) {
-          const LoginRequest& this_ = static_cast<const LoginRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t LoginRequest::ByteSizeLong() const {
-          const LoginRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.LoginRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string username = 1;
-            if (!this_._internal_username().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_username());
-            }
-            // string password = 2;
-            if (!this_._internal_password().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_password());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void LoginRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<LoginRequest*>(&to_msg);
-  auto& from = static_cast<const LoginRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.LoginRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_username().empty()) {
-    _this->_internal_set_username(from._internal_username());
-  }
-  if (!from._internal_password().empty()) {
-    _this->_internal_set_password(from._internal_password());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void LoginRequest::CopyFrom(const LoginRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.LoginRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void LoginRequest::InternalSwap(LoginRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.username_, &other->_impl_.username_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.password_, &other->_impl_.password_, arena);
-}
-
-::google::protobuf::Metadata LoginRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class LoginResponse::_Internal {
- public:
-};
-
-LoginResponse::LoginResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.LoginResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE LoginResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::LoginResponse& from_msg)
-      : message_(arena, from.message_),
-        token_(arena, from.token_),
-        _cached_size_{0} {}
-
-LoginResponse::LoginResponse(
-    ::google::protobuf::Arena* arena,
-    const LoginResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  LoginResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.success_ = from._impl_.success_;
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.LoginResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE LoginResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : message_(arena),
-        token_(arena),
-        _cached_size_{0} {}
-
-inline void LoginResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.success_ = {};
-}
-LoginResponse::~LoginResponse() {
-  // @@protoc_insertion_point(destructor:siqi.auth.LoginResponse)
-  SharedDtor(*this);
-}
-inline void LoginResponse::SharedDtor(MessageLite& self) {
-  LoginResponse& this_ = static_cast<LoginResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.message_.Destroy();
-  this_._impl_.token_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* LoginResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) LoginResponse(arena);
-}
-constexpr auto LoginResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(LoginResponse),
-                                            alignof(LoginResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull LoginResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_LoginResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &LoginResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<LoginResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &LoginResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<LoginResponse>(), &LoginResponse::ByteSizeLong,
-            &LoginResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(LoginResponse, _impl_._cached_size_),
-        false,
-    },
-    &LoginResponse::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* LoginResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 44, 2> LoginResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::LoginResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // bool success = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(LoginResponse, _impl_.success_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(LoginResponse, _impl_.success_)}},
-    // string message = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(LoginResponse, _impl_.message_)}},
-    // string token = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(LoginResponse, _impl_.token_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // bool success = 1;
-    {PROTOBUF_FIELD_OFFSET(LoginResponse, _impl_.success_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
-    // string message = 2;
-    {PROTOBUF_FIELD_OFFSET(LoginResponse, _impl_.message_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string token = 3;
-    {PROTOBUF_FIELD_OFFSET(LoginResponse, _impl_.token_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\27\0\7\5\0\0\0\0"
-    "siqi.auth.LoginResponse"
-    "message"
-    "token"
-  }},
-};
-
-PROTOBUF_NOINLINE void LoginResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.LoginResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.message_.ClearToEmpty();
-  _impl_.token_.ClearToEmpty();
-  _impl_.success_ = false;
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* LoginResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const LoginResponse& this_ = static_cast<const LoginResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* LoginResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const LoginResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.LoginResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // bool success = 1;
-          if (this_._internal_success() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteBoolToArray(
-                1, this_._internal_success(), target);
-          }
-
-          // string message = 2;
-          if (!this_._internal_message().empty()) {
-            const std::string& _s = this_._internal_message();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.LoginResponse.message");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string token = 3;
-          if (!this_._internal_token().empty()) {
-            const std::string& _s = this_._internal_token();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.LoginResponse.token");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.LoginResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t LoginResponse::ByteSizeLong(const MessageLite& base) {
-          const LoginResponse& this_ = static_cast<const LoginResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t LoginResponse::ByteSizeLong() const {
-          const LoginResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.LoginResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string message = 2;
-            if (!this_._internal_message().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_message());
-            }
-            // string token = 3;
-            if (!this_._internal_token().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_token());
-            }
-            // bool success = 1;
-            if (this_._internal_success() != 0) {
-              total_size += 2;
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void LoginResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<LoginResponse*>(&to_msg);
-  auto& from = static_cast<const LoginResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.LoginResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_message().empty()) {
-    _this->_internal_set_message(from._internal_message());
-  }
-  if (!from._internal_token().empty()) {
-    _this->_internal_set_token(from._internal_token());
-  }
-  if (from._internal_success() != 0) {
-    _this->_impl_.success_ = from._impl_.success_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void LoginResponse::CopyFrom(const LoginResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.LoginResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void LoginResponse::InternalSwap(LoginResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.message_, &other->_impl_.message_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.token_, &other->_impl_.token_, arena);
-        swap(_impl_.success_, other->_impl_.success_);
-}
-
-::google::protobuf::Metadata LoginResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class ListUserRolesRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<ListUserRolesRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(ListUserRolesRequest, _impl_._has_bits_);
-};
-
-ListUserRolesRequest::ListUserRolesRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.ListUserRolesRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE ListUserRolesRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::ListUserRolesRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        app_code_(arena, from.app_code_),
-        user_id_(arena, from.user_id_) {}
-
-ListUserRolesRequest::ListUserRolesRequest(
-    ::google::protobuf::Arena* arena,
-    const ListUserRolesRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  ListUserRolesRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, page_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, page_),
-           offsetof(Impl_, page_size_) -
-               offsetof(Impl_, page_) +
-               sizeof(Impl_::page_size_));
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.ListUserRolesRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE ListUserRolesRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        app_code_(arena),
-        user_id_(arena) {}
-
-inline void ListUserRolesRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, page_),
-           0,
-           offsetof(Impl_, page_size_) -
-               offsetof(Impl_, page_) +
-               sizeof(Impl_::page_size_));
-}
-ListUserRolesRequest::~ListUserRolesRequest() {
-  // @@protoc_insertion_point(destructor:siqi.auth.ListUserRolesRequest)
-  SharedDtor(*this);
-}
-inline void ListUserRolesRequest::SharedDtor(MessageLite& self) {
-  ListUserRolesRequest& this_ = static_cast<ListUserRolesRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.app_code_.Destroy();
-  this_._impl_.user_id_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* ListUserRolesRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) ListUserRolesRequest(arena);
-}
-constexpr auto ListUserRolesRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(ListUserRolesRequest),
-                                            alignof(ListUserRolesRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull ListUserRolesRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_ListUserRolesRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &ListUserRolesRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<ListUserRolesRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &ListUserRolesRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<ListUserRolesRequest>(), &ListUserRolesRequest::ByteSizeLong,
-            &ListUserRolesRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(ListUserRolesRequest, _impl_._cached_size_),
-        false,
-    },
-    &ListUserRolesRequest::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* ListUserRolesRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 0, 54, 2> ListUserRolesRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(ListUserRolesRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::ListUserRolesRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // optional string user_id = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 0, 0, PROTOBUF_FIELD_OFFSET(ListUserRolesRequest, _impl_.user_id_)}},
-    // string app_code = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(ListUserRolesRequest, _impl_.app_code_)}},
-    // int32 page = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListUserRolesRequest, _impl_.page_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(ListUserRolesRequest, _impl_.page_)}},
-    // int32 page_size = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListUserRolesRequest, _impl_.page_size_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(ListUserRolesRequest, _impl_.page_size_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string app_code = 1;
-    {PROTOBUF_FIELD_OFFSET(ListUserRolesRequest, _impl_.app_code_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int32 page = 2;
-    {PROTOBUF_FIELD_OFFSET(ListUserRolesRequest, _impl_.page_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 page_size = 3;
-    {PROTOBUF_FIELD_OFFSET(ListUserRolesRequest, _impl_.page_size_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // optional string user_id = 4;
-    {PROTOBUF_FIELD_OFFSET(ListUserRolesRequest, _impl_.user_id_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\36\10\0\0\7\0\0\0"
-    "siqi.auth.ListUserRolesRequest"
-    "app_code"
-    "user_id"
-  }},
-};
-
-PROTOBUF_NOINLINE void ListUserRolesRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.ListUserRolesRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.app_code_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.user_id_.ClearNonDefaultToEmpty();
-  }
-  ::memset(&_impl_.page_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.page_size_) -
-      reinterpret_cast<char*>(&_impl_.page_)) + sizeof(_impl_.page_size_));
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* ListUserRolesRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const ListUserRolesRequest& this_ = static_cast<const ListUserRolesRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* ListUserRolesRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const ListUserRolesRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.ListUserRolesRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string app_code = 1;
-          if (!this_._internal_app_code().empty()) {
-            const std::string& _s = this_._internal_app_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListUserRolesRequest.app_code");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // int32 page = 2;
-          if (this_._internal_page() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<2>(
-                    stream, this_._internal_page(), target);
-          }
-
-          // int32 page_size = 3;
-          if (this_._internal_page_size() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_page_size(), target);
-          }
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // optional string user_id = 4;
-          if (cached_has_bits & 0x00000001u) {
-            const std::string& _s = this_._internal_user_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListUserRolesRequest.user_id");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.ListUserRolesRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t ListUserRolesRequest::ByteSizeLong(const MessageLite& base) {
-          const ListUserRolesRequest& this_ = static_cast<const ListUserRolesRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t ListUserRolesRequest::ByteSizeLong() const {
-          const ListUserRolesRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.ListUserRolesRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string app_code = 1;
-            if (!this_._internal_app_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_app_code());
-            }
-          }
-           {
-            // optional string user_id = 4;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_user_id());
-            }
-          }
-           {
-            // int32 page = 2;
-            if (this_._internal_page() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page());
-            }
-            // int32 page_size = 3;
-            if (this_._internal_page_size() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page_size());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void ListUserRolesRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<ListUserRolesRequest*>(&to_msg);
-  auto& from = static_cast<const ListUserRolesRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.ListUserRolesRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_app_code().empty()) {
-    _this->_internal_set_app_code(from._internal_app_code());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _this->_internal_set_user_id(from._internal_user_id());
-  }
-  if (from._internal_page() != 0) {
-    _this->_impl_.page_ = from._impl_.page_;
-  }
-  if (from._internal_page_size() != 0) {
-    _this->_impl_.page_size_ = from._impl_.page_size_;
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void ListUserRolesRequest::CopyFrom(const ListUserRolesRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.ListUserRolesRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void ListUserRolesRequest::InternalSwap(ListUserRolesRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.app_code_, &other->_impl_.app_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.user_id_, &other->_impl_.user_id_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ListUserRolesRequest, _impl_.page_size_)
-      + sizeof(ListUserRolesRequest::_impl_.page_size_)
-      - PROTOBUF_FIELD_OFFSET(ListUserRolesRequest, _impl_.page_)>(
-          reinterpret_cast<char*>(&_impl_.page_),
-          reinterpret_cast<char*>(&other->_impl_.page_));
-}
-
-::google::protobuf::Metadata ListUserRolesRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class ListUserRolesResponse_UserRoleInfo::_Internal {
- public:
-};
-
-ListUserRolesResponse_UserRoleInfo::ListUserRolesResponse_UserRoleInfo(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.ListUserRolesResponse.UserRoleInfo)
-}
-inline PROTOBUF_NDEBUG_INLINE ListUserRolesResponse_UserRoleInfo::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::ListUserRolesResponse_UserRoleInfo& from_msg)
-      : role_keys_{visibility, arena, from.role_keys_},
-        perm_keys_{visibility, arena, from.perm_keys_},
-        user_id_(arena, from.user_id_),
-        created_at_(arena, from.created_at_),
-        _cached_size_{0} {}
-
-ListUserRolesResponse_UserRoleInfo::ListUserRolesResponse_UserRoleInfo(
-    ::google::protobuf::Arena* arena,
-    const ListUserRolesResponse_UserRoleInfo& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  ListUserRolesResponse_UserRoleInfo* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.ListUserRolesResponse.UserRoleInfo)
-}
-inline PROTOBUF_NDEBUG_INLINE ListUserRolesResponse_UserRoleInfo::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : role_keys_{visibility, arena},
-        perm_keys_{visibility, arena},
-        user_id_(arena),
-        created_at_(arena),
-        _cached_size_{0} {}
-
-inline void ListUserRolesResponse_UserRoleInfo::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-ListUserRolesResponse_UserRoleInfo::~ListUserRolesResponse_UserRoleInfo() {
-  // @@protoc_insertion_point(destructor:siqi.auth.ListUserRolesResponse.UserRoleInfo)
-  SharedDtor(*this);
-}
-inline void ListUserRolesResponse_UserRoleInfo::SharedDtor(MessageLite& self) {
-  ListUserRolesResponse_UserRoleInfo& this_ = static_cast<ListUserRolesResponse_UserRoleInfo&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.user_id_.Destroy();
-  this_._impl_.created_at_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* ListUserRolesResponse_UserRoleInfo::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) ListUserRolesResponse_UserRoleInfo(arena);
-}
-constexpr auto ListUserRolesResponse_UserRoleInfo::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(ListUserRolesResponse_UserRoleInfo, _impl_.role_keys_) +
-          decltype(ListUserRolesResponse_UserRoleInfo::_impl_.role_keys_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-      PROTOBUF_FIELD_OFFSET(ListUserRolesResponse_UserRoleInfo, _impl_.perm_keys_) +
-          decltype(ListUserRolesResponse_UserRoleInfo::_impl_.perm_keys_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::CopyInit(
-        sizeof(ListUserRolesResponse_UserRoleInfo), alignof(ListUserRolesResponse_UserRoleInfo), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&ListUserRolesResponse_UserRoleInfo::PlacementNew_,
-                                 sizeof(ListUserRolesResponse_UserRoleInfo),
-                                 alignof(ListUserRolesResponse_UserRoleInfo));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull ListUserRolesResponse_UserRoleInfo::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_ListUserRolesResponse_UserRoleInfo_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &ListUserRolesResponse_UserRoleInfo::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<ListUserRolesResponse_UserRoleInfo>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &ListUserRolesResponse_UserRoleInfo::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<ListUserRolesResponse_UserRoleInfo>(), &ListUserRolesResponse_UserRoleInfo::ByteSizeLong,
-            &ListUserRolesResponse_UserRoleInfo::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(ListUserRolesResponse_UserRoleInfo, _impl_._cached_size_),
-        false,
-    },
-    &ListUserRolesResponse_UserRoleInfo::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* ListUserRolesResponse_UserRoleInfo::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 0, 88, 2> ListUserRolesResponse_UserRoleInfo::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::ListUserRolesResponse_UserRoleInfo>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // repeated string perm_keys = 4;
-    {::_pbi::TcParser::FastUR1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(ListUserRolesResponse_UserRoleInfo, _impl_.perm_keys_)}},
-    // string user_id = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(ListUserRolesResponse_UserRoleInfo, _impl_.user_id_)}},
-    // repeated string role_keys = 2;
-    {::_pbi::TcParser::FastUR1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(ListUserRolesResponse_UserRoleInfo, _impl_.role_keys_)}},
-    // string created_at = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(ListUserRolesResponse_UserRoleInfo, _impl_.created_at_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string user_id = 1;
-    {PROTOBUF_FIELD_OFFSET(ListUserRolesResponse_UserRoleInfo, _impl_.user_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // repeated string role_keys = 2;
-    {PROTOBUF_FIELD_OFFSET(ListUserRolesResponse_UserRoleInfo, _impl_.role_keys_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kUtf8String | ::_fl::kRepSString)},
-    // string created_at = 3;
-    {PROTOBUF_FIELD_OFFSET(ListUserRolesResponse_UserRoleInfo, _impl_.created_at_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // repeated string perm_keys = 4;
-    {PROTOBUF_FIELD_OFFSET(ListUserRolesResponse_UserRoleInfo, _impl_.perm_keys_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kUtf8String | ::_fl::kRepSString)},
-  }},
-  // no aux_entries
-  {{
-    "\54\7\11\12\11\0\0\0"
-    "siqi.auth.ListUserRolesResponse.UserRoleInfo"
-    "user_id"
-    "role_keys"
-    "created_at"
-    "perm_keys"
-  }},
-};
-
-PROTOBUF_NOINLINE void ListUserRolesResponse_UserRoleInfo::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.ListUserRolesResponse.UserRoleInfo)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.role_keys_.Clear();
-  _impl_.perm_keys_.Clear();
-  _impl_.user_id_.ClearToEmpty();
-  _impl_.created_at_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* ListUserRolesResponse_UserRoleInfo::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const ListUserRolesResponse_UserRoleInfo& this_ = static_cast<const ListUserRolesResponse_UserRoleInfo&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* ListUserRolesResponse_UserRoleInfo::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const ListUserRolesResponse_UserRoleInfo& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.ListUserRolesResponse.UserRoleInfo)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string user_id = 1;
-          if (!this_._internal_user_id().empty()) {
-            const std::string& _s = this_._internal_user_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListUserRolesResponse.UserRoleInfo.user_id");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // repeated string role_keys = 2;
-          for (int i = 0, n = this_._internal_role_keys_size(); i < n; ++i) {
-            const auto& s = this_._internal_role_keys().Get(i);
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                s.data(), static_cast<int>(s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListUserRolesResponse.UserRoleInfo.role_keys");
-            target = stream->WriteString(2, s, target);
-          }
-
-          // string created_at = 3;
-          if (!this_._internal_created_at().empty()) {
-            const std::string& _s = this_._internal_created_at();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListUserRolesResponse.UserRoleInfo.created_at");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // repeated string perm_keys = 4;
-          for (int i = 0, n = this_._internal_perm_keys_size(); i < n; ++i) {
-            const auto& s = this_._internal_perm_keys().Get(i);
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                s.data(), static_cast<int>(s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "siqi.auth.ListUserRolesResponse.UserRoleInfo.perm_keys");
-            target = stream->WriteString(4, s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.ListUserRolesResponse.UserRoleInfo)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t ListUserRolesResponse_UserRoleInfo::ByteSizeLong(const MessageLite& base) {
-          const ListUserRolesResponse_UserRoleInfo& this_ = static_cast<const ListUserRolesResponse_UserRoleInfo&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t ListUserRolesResponse_UserRoleInfo::ByteSizeLong() const {
-          const ListUserRolesResponse_UserRoleInfo& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.ListUserRolesResponse.UserRoleInfo)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated string role_keys = 2;
-            {
-              total_size +=
-                  1 * ::google::protobuf::internal::FromIntSize(this_._internal_role_keys().size());
-              for (int i = 0, n = this_._internal_role_keys().size(); i < n; ++i) {
-                total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-                    this_._internal_role_keys().Get(i));
-              }
-            }
-            // repeated string perm_keys = 4;
-            {
-              total_size +=
-                  1 * ::google::protobuf::internal::FromIntSize(this_._internal_perm_keys().size());
-              for (int i = 0, n = this_._internal_perm_keys().size(); i < n; ++i) {
-                total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-                    this_._internal_perm_keys().Get(i));
-              }
-            }
-          }
-           {
-            // string user_id = 1;
-            if (!this_._internal_user_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_user_id());
-            }
-            // string created_at = 3;
-            if (!this_._internal_created_at().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_created_at());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void ListUserRolesResponse_UserRoleInfo::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<ListUserRolesResponse_UserRoleInfo*>(&to_msg);
-  auto& from = static_cast<const ListUserRolesResponse_UserRoleInfo&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.ListUserRolesResponse.UserRoleInfo)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_role_keys()->MergeFrom(from._internal_role_keys());
-  _this->_internal_mutable_perm_keys()->MergeFrom(from._internal_perm_keys());
-  if (!from._internal_user_id().empty()) {
-    _this->_internal_set_user_id(from._internal_user_id());
-  }
-  if (!from._internal_created_at().empty()) {
-    _this->_internal_set_created_at(from._internal_created_at());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void ListUserRolesResponse_UserRoleInfo::CopyFrom(const ListUserRolesResponse_UserRoleInfo& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.ListUserRolesResponse.UserRoleInfo)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void ListUserRolesResponse_UserRoleInfo::InternalSwap(ListUserRolesResponse_UserRoleInfo* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.role_keys_.InternalSwap(&other->_impl_.role_keys_);
-  _impl_.perm_keys_.InternalSwap(&other->_impl_.perm_keys_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.user_id_, &other->_impl_.user_id_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.created_at_, &other->_impl_.created_at_, arena);
-}
-
-::google::protobuf::Metadata ListUserRolesResponse_UserRoleInfo::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class ListUserRolesResponse::_Internal {
- public:
-};
-
-ListUserRolesResponse::ListUserRolesResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:siqi.auth.ListUserRolesResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE ListUserRolesResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::siqi::auth::ListUserRolesResponse& from_msg)
-      : users_{visibility, arena, from.users_},
-        _cached_size_{0} {}
-
-ListUserRolesResponse::ListUserRolesResponse(
-    ::google::protobuf::Arena* arena,
-    const ListUserRolesResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  ListUserRolesResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, total_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, total_),
-           offsetof(Impl_, page_size_) -
-               offsetof(Impl_, total_) +
-               sizeof(Impl_::page_size_));
-
-  // @@protoc_insertion_point(copy_constructor:siqi.auth.ListUserRolesResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE ListUserRolesResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : users_{visibility, arena},
-        _cached_size_{0} {}
-
-inline void ListUserRolesResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, total_),
-           0,
-           offsetof(Impl_, page_size_) -
-               offsetof(Impl_, total_) +
-               sizeof(Impl_::page_size_));
-}
-ListUserRolesResponse::~ListUserRolesResponse() {
-  // @@protoc_insertion_point(destructor:siqi.auth.ListUserRolesResponse)
-  SharedDtor(*this);
-}
-inline void ListUserRolesResponse::SharedDtor(MessageLite& self) {
-  ListUserRolesResponse& this_ = static_cast<ListUserRolesResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* ListUserRolesResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) ListUserRolesResponse(arena);
-}
-constexpr auto ListUserRolesResponse::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(ListUserRolesResponse, _impl_.users_) +
-          decltype(ListUserRolesResponse::_impl_.users_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::ZeroInit(
-        sizeof(ListUserRolesResponse), alignof(ListUserRolesResponse), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&ListUserRolesResponse::PlacementNew_,
-                                 sizeof(ListUserRolesResponse),
-                                 alignof(ListUserRolesResponse));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull ListUserRolesResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_ListUserRolesResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &ListUserRolesResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<ListUserRolesResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &ListUserRolesResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<ListUserRolesResponse>(), &ListUserRolesResponse::ByteSizeLong,
-            &ListUserRolesResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(ListUserRolesResponse, _impl_._cached_size_),
-        false,
-    },
-    &ListUserRolesResponse::kDescriptorMethods,
-    &descriptor_table_auth_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* ListUserRolesResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 1, 0, 2> ListUserRolesResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::siqi::auth::ListUserRolesResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // int32 page_size = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListUserRolesResponse, _impl_.page_size_), 63>(),
-     {32, 63, 0, PROTOBUF_FIELD_OFFSET(ListUserRolesResponse, _impl_.page_size_)}},
-    // repeated .siqi.auth.ListUserRolesResponse.UserRoleInfo users = 1;
-    {::_pbi::TcParser::FastMtR1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(ListUserRolesResponse, _impl_.users_)}},
-    // int64 total = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(ListUserRolesResponse, _impl_.total_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(ListUserRolesResponse, _impl_.total_)}},
-    // int32 page = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListUserRolesResponse, _impl_.page_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(ListUserRolesResponse, _impl_.page_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // repeated .siqi.auth.ListUserRolesResponse.UserRoleInfo users = 1;
-    {PROTOBUF_FIELD_OFFSET(ListUserRolesResponse, _impl_.users_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-    // int64 total = 2;
-    {PROTOBUF_FIELD_OFFSET(ListUserRolesResponse, _impl_.total_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
-    // int32 page = 3;
-    {PROTOBUF_FIELD_OFFSET(ListUserRolesResponse, _impl_.page_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 page_size = 4;
-    {PROTOBUF_FIELD_OFFSET(ListUserRolesResponse, _impl_.page_size_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::siqi::auth::ListUserRolesResponse_UserRoleInfo>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void ListUserRolesResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:siqi.auth.ListUserRolesResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.users_.Clear();
-  ::memset(&_impl_.total_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.page_size_) -
-      reinterpret_cast<char*>(&_impl_.total_)) + sizeof(_impl_.page_size_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* ListUserRolesResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const ListUserRolesResponse& this_ = static_cast<const ListUserRolesResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* ListUserRolesResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const ListUserRolesResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:siqi.auth.ListUserRolesResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // repeated .siqi.auth.ListUserRolesResponse.UserRoleInfo users = 1;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_users_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_users().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    1, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          // int64 total = 2;
-          if (this_._internal_total() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt64ToArrayWithField<2>(
-                    stream, this_._internal_total(), target);
-          }
-
-          // int32 page = 3;
-          if (this_._internal_page() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_page(), target);
-          }
-
-          // int32 page_size = 4;
-          if (this_._internal_page_size() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<4>(
-                    stream, this_._internal_page_size(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:siqi.auth.ListUserRolesResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t ListUserRolesResponse::ByteSizeLong(const MessageLite& base) {
-          const ListUserRolesResponse& this_ = static_cast<const ListUserRolesResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t ListUserRolesResponse::ByteSizeLong() const {
-          const ListUserRolesResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:siqi.auth.ListUserRolesResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .siqi.auth.ListUserRolesResponse.UserRoleInfo users = 1;
-            {
-              total_size += 1UL * this_._internal_users_size();
-              for (const auto& msg : this_._internal_users()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-           {
-            // int64 total = 2;
-            if (this_._internal_total() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
-                  this_._internal_total());
-            }
-            // int32 page = 3;
-            if (this_._internal_page() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page());
-            }
-            // int32 page_size = 4;
-            if (this_._internal_page_size() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_page_size());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void ListUserRolesResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<ListUserRolesResponse*>(&to_msg);
-  auto& from = static_cast<const ListUserRolesResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:siqi.auth.ListUserRolesResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_users()->MergeFrom(
-      from._internal_users());
-  if (from._internal_total() != 0) {
-    _this->_impl_.total_ = from._impl_.total_;
-  }
-  if (from._internal_page() != 0) {
-    _this->_impl_.page_ = from._impl_.page_;
-  }
-  if (from._internal_page_size() != 0) {
-    _this->_impl_.page_size_ = from._impl_.page_size_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void ListUserRolesResponse::CopyFrom(const ListUserRolesResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:siqi.auth.ListUserRolesResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void ListUserRolesResponse::InternalSwap(ListUserRolesResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.users_.InternalSwap(&other->_impl_.users_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ListUserRolesResponse, _impl_.page_size_)
-      + sizeof(ListUserRolesResponse::_impl_.page_size_)
-      - PROTOBUF_FIELD_OFFSET(ListUserRolesResponse, _impl_.total_)>(
-          reinterpret_cast<char*>(&_impl_.total_),
-          reinterpret_cast<char*>(&other->_impl_.total_));
-}
-
-::google::protobuf::Metadata ListUserRolesResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-const ::google::protobuf::ServiceDescriptor* AuthService::descriptor() {
-  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_auth_2eproto);
-  return file_level_service_descriptors_auth_2eproto[0];
-}
-
-const ::google::protobuf::ServiceDescriptor* AuthService::GetDescriptor() {
-  return descriptor();
-}
-
-void AuthService::Check(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::CheckRequest*, ::siqi::auth::CheckResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method Check() not implemented.");
-  done->Run();
-}
-void AuthService::BatchCheck(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::BatchCheckRequest*, ::siqi::auth::BatchCheckResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method BatchCheck() not implemented.");
-  done->Run();
-}
-void AuthService::GetUserPermissions(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::GetUserPermissionsRequest*, ::siqi::auth::GetUserPermissionsResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method GetUserPermissions() not implemented.");
-  done->Run();
-}
-void AuthService::GetUserRoles(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::GetUserRolesRequest*, ::siqi::auth::GetUserRolesResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method GetUserRoles() not implemented.");
-  done->Run();
-}
-
-void AuthService::CallMethod(
-    const ::google::protobuf::MethodDescriptor* method,
-    ::google::protobuf::RpcController* controller,
-    const ::google::protobuf::Message* request,
-    ::google::protobuf::Message* response, ::google::protobuf::Closure* done) {
-  ABSL_DCHECK_EQ(method->service(), file_level_service_descriptors_auth_2eproto[0]);
-  switch (method->index()) {
-    case 0:
-      this->Check(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::CheckRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::CheckResponse>(response),
-                   done);
-      break;
-    case 1:
-      this->BatchCheck(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::BatchCheckRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::BatchCheckResponse>(response),
-                   done);
-      break;
-    case 2:
-      this->GetUserPermissions(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::GetUserPermissionsRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::GetUserPermissionsResponse>(response),
-                   done);
-      break;
-    case 3:
-      this->GetUserRoles(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::GetUserRolesRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::GetUserRolesResponse>(response),
-                   done);
-      break;
-
-    default:
-      ABSL_LOG(FATAL) << "Bad method index; this should never happen.";
-      break;
-  }
-}
-
-const ::google::protobuf::Message& AuthService::GetRequestPrototype(
-    const ::google::protobuf::MethodDescriptor* method) const {
-  ABSL_DCHECK_EQ(method->service(), descriptor());
-  switch (method->index()) {
-    case 0:
-      return ::siqi::auth::CheckRequest::default_instance();
-    case 1:
-      return ::siqi::auth::BatchCheckRequest::default_instance();
-    case 2:
-      return ::siqi::auth::GetUserPermissionsRequest::default_instance();
-    case 3:
-      return ::siqi::auth::GetUserRolesRequest::default_instance();
-
-    default:
-      ABSL_LOG(FATAL) << "Bad method index; this should never happen.";
-      return *::google::protobuf::MessageFactory::generated_factory()
-                  ->GetPrototype(method->input_type());
-  }
-}
-
-const ::google::protobuf::Message& AuthService::GetResponsePrototype(
-    const ::google::protobuf::MethodDescriptor* method) const {
-  ABSL_DCHECK_EQ(method->service(), descriptor());
-  switch (method->index()) {
-    case 0:
-      return ::siqi::auth::CheckResponse::default_instance();
-    case 1:
-      return ::siqi::auth::BatchCheckResponse::default_instance();
-    case 2:
-      return ::siqi::auth::GetUserPermissionsResponse::default_instance();
-    case 3:
-      return ::siqi::auth::GetUserRolesResponse::default_instance();
-
-    default:
-      ABSL_LOG(FATAL) << "Bad method index; this should never happen.";
-      return *::google::protobuf::MessageFactory::generated_factory()
-                  ->GetPrototype(method->output_type());
-  }
-}
-
-AuthService_Stub::AuthService_Stub(::google::protobuf::RpcChannel* channel)
-    : channel_(channel), owns_channel_(false) {}
-
-AuthService_Stub::AuthService_Stub(
-    ::google::protobuf::RpcChannel* channel,
-    ::google::protobuf::Service::ChannelOwnership ownership)
-    : channel_(channel),
-      owns_channel_(ownership ==
-                    ::google::protobuf::Service::STUB_OWNS_CHANNEL) {}
-
-AuthService_Stub::~AuthService_Stub() {
-  if (owns_channel_) delete channel_;
-}
-
-void AuthService_Stub::Check(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::CheckRequest* request,
-                              ::siqi::auth::CheckResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(0), controller,
-                       request, response, done);
-}
-void AuthService_Stub::BatchCheck(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::BatchCheckRequest* request,
-                              ::siqi::auth::BatchCheckResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(1), controller,
-                       request, response, done);
-}
-void AuthService_Stub::GetUserPermissions(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::GetUserPermissionsRequest* request,
-                              ::siqi::auth::GetUserPermissionsResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(2), controller,
-                       request, response, done);
-}
-void AuthService_Stub::GetUserRoles(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::GetUserRolesRequest* request,
-                              ::siqi::auth::GetUserRolesResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(3), controller,
-                       request, response, done);
-}
-// ===================================================================
-
-const ::google::protobuf::ServiceDescriptor* AdminService::descriptor() {
-  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_auth_2eproto);
-  return file_level_service_descriptors_auth_2eproto[1];
-}
-
-const ::google::protobuf::ServiceDescriptor* AdminService::GetDescriptor() {
-  return descriptor();
-}
-
-void AdminService::CreateApp(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::CreateAppRequest*, ::siqi::auth::AdminResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method CreateApp() not implemented.");
-  done->Run();
-}
-void AdminService::UpdateApp(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::UpdateAppRequest*, ::siqi::auth::AdminResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method UpdateApp() not implemented.");
-  done->Run();
-}
-void AdminService::DeleteApp(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::DeleteAppRequest*, ::siqi::auth::AdminResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method DeleteApp() not implemented.");
-  done->Run();
-}
-void AdminService::GetApp(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::GetAppRequest*, ::siqi::auth::GetAppResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method GetApp() not implemented.");
-  done->Run();
-}
-void AdminService::ListApps(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::ListAppsRequest*, ::siqi::auth::ListAppsResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method ListApps() not implemented.");
-  done->Run();
-}
-void AdminService::Login(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::LoginRequest*, ::siqi::auth::LoginResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method Login() not implemented.");
-  done->Run();
-}
-void AdminService::CreatePermission(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::CreatePermissionRequest*, ::siqi::auth::AdminResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method CreatePermission() not implemented.");
-  done->Run();
-}
-void AdminService::UpdatePermission(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::UpdatePermissionRequest*, ::siqi::auth::AdminResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method UpdatePermission() not implemented.");
-  done->Run();
-}
-void AdminService::DeletePermission(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::DeletePermissionRequest*, ::siqi::auth::AdminResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method DeletePermission() not implemented.");
-  done->Run();
-}
-void AdminService::ListPermissions(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::ListPermissionsRequest*, ::siqi::auth::ListPermissionsResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method ListPermissions() not implemented.");
-  done->Run();
-}
-void AdminService::CreateRole(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::CreateRoleRequest*, ::siqi::auth::AdminResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method CreateRole() not implemented.");
-  done->Run();
-}
-void AdminService::UpdateRole(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::UpdateRoleRequest*, ::siqi::auth::AdminResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method UpdateRole() not implemented.");
-  done->Run();
-}
-void AdminService::DeleteRole(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::DeleteRoleRequest*, ::siqi::auth::AdminResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method DeleteRole() not implemented.");
-  done->Run();
-}
-void AdminService::ListRoles(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::ListRolesRequest*, ::siqi::auth::ListRolesResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method ListRoles() not implemented.");
-  done->Run();
-}
-void AdminService::AddPermissionToRole(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::AddPermissionToRoleRequest*, ::siqi::auth::AdminResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method AddPermissionToRole() not implemented.");
-  done->Run();
-}
-void AdminService::RemovePermissionFromRole(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::RemovePermissionFromRoleRequest*, ::siqi::auth::AdminResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method RemovePermissionFromRole() not implemented.");
-  done->Run();
-}
-void AdminService::GetRolePermissions(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::GetRolePermissionsRequest*, ::siqi::auth::GetRolePermissionsResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method GetRolePermissions() not implemented.");
-  done->Run();
-}
-void AdminService::GrantRoleToUser(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::GrantRoleToUserRequest*, ::siqi::auth::AdminResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method GrantRoleToUser() not implemented.");
-  done->Run();
-}
-void AdminService::RevokeRoleFromUser(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::RevokeRoleFromUserRequest*, ::siqi::auth::AdminResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method RevokeRoleFromUser() not implemented.");
-  done->Run();
-}
-void AdminService::GetRoleUsers(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::GetRoleUsersRequest*, ::siqi::auth::GetRoleUsersResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method GetRoleUsers() not implemented.");
-  done->Run();
-}
-void AdminService::ListUserRoles(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::ListUserRolesRequest*, ::siqi::auth::ListUserRolesResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method ListUserRoles() not implemented.");
-  done->Run();
-}
-void AdminService::ListAuditLogs(::google::protobuf::RpcController* controller,
-                         const ::siqi::auth::ListAuditLogsRequest*, ::siqi::auth::ListAuditLogsResponse*, ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method ListAuditLogs() not implemented.");
-  done->Run();
-}
-
-void AdminService::CallMethod(
-    const ::google::protobuf::MethodDescriptor* method,
-    ::google::protobuf::RpcController* controller,
-    const ::google::protobuf::Message* request,
-    ::google::protobuf::Message* response, ::google::protobuf::Closure* done) {
-  ABSL_DCHECK_EQ(method->service(), file_level_service_descriptors_auth_2eproto[1]);
-  switch (method->index()) {
-    case 0:
-      this->CreateApp(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::CreateAppRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::AdminResponse>(response),
-                   done);
-      break;
-    case 1:
-      this->UpdateApp(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::UpdateAppRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::AdminResponse>(response),
-                   done);
-      break;
-    case 2:
-      this->DeleteApp(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::DeleteAppRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::AdminResponse>(response),
-                   done);
-      break;
-    case 3:
-      this->GetApp(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::GetAppRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::GetAppResponse>(response),
-                   done);
-      break;
-    case 4:
-      this->ListApps(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::ListAppsRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::ListAppsResponse>(response),
-                   done);
-      break;
-    case 5:
-      this->Login(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::LoginRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::LoginResponse>(response),
-                   done);
-      break;
-    case 6:
-      this->CreatePermission(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::CreatePermissionRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::AdminResponse>(response),
-                   done);
-      break;
-    case 7:
-      this->UpdatePermission(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::UpdatePermissionRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::AdminResponse>(response),
-                   done);
-      break;
-    case 8:
-      this->DeletePermission(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::DeletePermissionRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::AdminResponse>(response),
-                   done);
-      break;
-    case 9:
-      this->ListPermissions(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::ListPermissionsRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::ListPermissionsResponse>(response),
-                   done);
-      break;
-    case 10:
-      this->CreateRole(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::CreateRoleRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::AdminResponse>(response),
-                   done);
-      break;
-    case 11:
-      this->UpdateRole(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::UpdateRoleRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::AdminResponse>(response),
-                   done);
-      break;
-    case 12:
-      this->DeleteRole(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::DeleteRoleRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::AdminResponse>(response),
-                   done);
-      break;
-    case 13:
-      this->ListRoles(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::ListRolesRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::ListRolesResponse>(response),
-                   done);
-      break;
-    case 14:
-      this->AddPermissionToRole(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::AddPermissionToRoleRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::AdminResponse>(response),
-                   done);
-      break;
-    case 15:
-      this->RemovePermissionFromRole(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::RemovePermissionFromRoleRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::AdminResponse>(response),
-                   done);
-      break;
-    case 16:
-      this->GetRolePermissions(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::GetRolePermissionsRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::GetRolePermissionsResponse>(response),
-                   done);
-      break;
-    case 17:
-      this->GrantRoleToUser(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::GrantRoleToUserRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::AdminResponse>(response),
-                   done);
-      break;
-    case 18:
-      this->RevokeRoleFromUser(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::RevokeRoleFromUserRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::AdminResponse>(response),
-                   done);
-      break;
-    case 19:
-      this->GetRoleUsers(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::GetRoleUsersRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::GetRoleUsersResponse>(response),
-                   done);
-      break;
-    case 20:
-      this->ListUserRoles(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::ListUserRolesRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::ListUserRolesResponse>(response),
-                   done);
-      break;
-    case 21:
-      this->ListAuditLogs(controller,
-                   ::google::protobuf::DownCastMessage<::siqi::auth::ListAuditLogsRequest>(request),
-                   ::google::protobuf::DownCastMessage<::siqi::auth::ListAuditLogsResponse>(response),
-                   done);
-      break;
-
-    default:
-      ABSL_LOG(FATAL) << "Bad method index; this should never happen.";
-      break;
-  }
-}
-
-const ::google::protobuf::Message& AdminService::GetRequestPrototype(
-    const ::google::protobuf::MethodDescriptor* method) const {
-  ABSL_DCHECK_EQ(method->service(), descriptor());
-  switch (method->index()) {
-    case 0:
-      return ::siqi::auth::CreateAppRequest::default_instance();
-    case 1:
-      return ::siqi::auth::UpdateAppRequest::default_instance();
-    case 2:
-      return ::siqi::auth::DeleteAppRequest::default_instance();
-    case 3:
-      return ::siqi::auth::GetAppRequest::default_instance();
-    case 4:
-      return ::siqi::auth::ListAppsRequest::default_instance();
-    case 5:
-      return ::siqi::auth::LoginRequest::default_instance();
-    case 6:
-      return ::siqi::auth::CreatePermissionRequest::default_instance();
-    case 7:
-      return ::siqi::auth::UpdatePermissionRequest::default_instance();
-    case 8:
-      return ::siqi::auth::DeletePermissionRequest::default_instance();
-    case 9:
-      return ::siqi::auth::ListPermissionsRequest::default_instance();
-    case 10:
-      return ::siqi::auth::CreateRoleRequest::default_instance();
-    case 11:
-      return ::siqi::auth::UpdateRoleRequest::default_instance();
-    case 12:
-      return ::siqi::auth::DeleteRoleRequest::default_instance();
-    case 13:
-      return ::siqi::auth::ListRolesRequest::default_instance();
-    case 14:
-      return ::siqi::auth::AddPermissionToRoleRequest::default_instance();
-    case 15:
-      return ::siqi::auth::RemovePermissionFromRoleRequest::default_instance();
-    case 16:
-      return ::siqi::auth::GetRolePermissionsRequest::default_instance();
-    case 17:
-      return ::siqi::auth::GrantRoleToUserRequest::default_instance();
-    case 18:
-      return ::siqi::auth::RevokeRoleFromUserRequest::default_instance();
-    case 19:
-      return ::siqi::auth::GetRoleUsersRequest::default_instance();
-    case 20:
-      return ::siqi::auth::ListUserRolesRequest::default_instance();
-    case 21:
-      return ::siqi::auth::ListAuditLogsRequest::default_instance();
-
-    default:
-      ABSL_LOG(FATAL) << "Bad method index; this should never happen.";
-      return *::google::protobuf::MessageFactory::generated_factory()
-                  ->GetPrototype(method->input_type());
-  }
-}
-
-const ::google::protobuf::Message& AdminService::GetResponsePrototype(
-    const ::google::protobuf::MethodDescriptor* method) const {
-  ABSL_DCHECK_EQ(method->service(), descriptor());
-  switch (method->index()) {
-    case 0:
-      return ::siqi::auth::AdminResponse::default_instance();
-    case 1:
-      return ::siqi::auth::AdminResponse::default_instance();
-    case 2:
-      return ::siqi::auth::AdminResponse::default_instance();
-    case 3:
-      return ::siqi::auth::GetAppResponse::default_instance();
-    case 4:
-      return ::siqi::auth::ListAppsResponse::default_instance();
-    case 5:
-      return ::siqi::auth::LoginResponse::default_instance();
-    case 6:
-      return ::siqi::auth::AdminResponse::default_instance();
-    case 7:
-      return ::siqi::auth::AdminResponse::default_instance();
-    case 8:
-      return ::siqi::auth::AdminResponse::default_instance();
-    case 9:
-      return ::siqi::auth::ListPermissionsResponse::default_instance();
-    case 10:
-      return ::siqi::auth::AdminResponse::default_instance();
-    case 11:
-      return ::siqi::auth::AdminResponse::default_instance();
-    case 12:
-      return ::siqi::auth::AdminResponse::default_instance();
-    case 13:
-      return ::siqi::auth::ListRolesResponse::default_instance();
-    case 14:
-      return ::siqi::auth::AdminResponse::default_instance();
-    case 15:
-      return ::siqi::auth::AdminResponse::default_instance();
-    case 16:
-      return ::siqi::auth::GetRolePermissionsResponse::default_instance();
-    case 17:
-      return ::siqi::auth::AdminResponse::default_instance();
-    case 18:
-      return ::siqi::auth::AdminResponse::default_instance();
-    case 19:
-      return ::siqi::auth::GetRoleUsersResponse::default_instance();
-    case 20:
-      return ::siqi::auth::ListUserRolesResponse::default_instance();
-    case 21:
-      return ::siqi::auth::ListAuditLogsResponse::default_instance();
-
-    default:
-      ABSL_LOG(FATAL) << "Bad method index; this should never happen.";
-      return *::google::protobuf::MessageFactory::generated_factory()
-                  ->GetPrototype(method->output_type());
-  }
-}
-
-AdminService_Stub::AdminService_Stub(::google::protobuf::RpcChannel* channel)
-    : channel_(channel), owns_channel_(false) {}
-
-AdminService_Stub::AdminService_Stub(
-    ::google::protobuf::RpcChannel* channel,
-    ::google::protobuf::Service::ChannelOwnership ownership)
-    : channel_(channel),
-      owns_channel_(ownership ==
-                    ::google::protobuf::Service::STUB_OWNS_CHANNEL) {}
-
-AdminService_Stub::~AdminService_Stub() {
-  if (owns_channel_) delete channel_;
-}
-
-void AdminService_Stub::CreateApp(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::CreateAppRequest* request,
-                              ::siqi::auth::AdminResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(0), controller,
-                       request, response, done);
-}
-void AdminService_Stub::UpdateApp(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::UpdateAppRequest* request,
-                              ::siqi::auth::AdminResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(1), controller,
-                       request, response, done);
-}
-void AdminService_Stub::DeleteApp(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::DeleteAppRequest* request,
-                              ::siqi::auth::AdminResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(2), controller,
-                       request, response, done);
-}
-void AdminService_Stub::GetApp(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::GetAppRequest* request,
-                              ::siqi::auth::GetAppResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(3), controller,
-                       request, response, done);
-}
-void AdminService_Stub::ListApps(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::ListAppsRequest* request,
-                              ::siqi::auth::ListAppsResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(4), controller,
-                       request, response, done);
-}
-void AdminService_Stub::Login(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::LoginRequest* request,
-                              ::siqi::auth::LoginResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(5), controller,
-                       request, response, done);
-}
-void AdminService_Stub::CreatePermission(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::CreatePermissionRequest* request,
-                              ::siqi::auth::AdminResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(6), controller,
-                       request, response, done);
-}
-void AdminService_Stub::UpdatePermission(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::UpdatePermissionRequest* request,
-                              ::siqi::auth::AdminResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(7), controller,
-                       request, response, done);
-}
-void AdminService_Stub::DeletePermission(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::DeletePermissionRequest* request,
-                              ::siqi::auth::AdminResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(8), controller,
-                       request, response, done);
-}
-void AdminService_Stub::ListPermissions(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::ListPermissionsRequest* request,
-                              ::siqi::auth::ListPermissionsResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(9), controller,
-                       request, response, done);
-}
-void AdminService_Stub::CreateRole(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::CreateRoleRequest* request,
-                              ::siqi::auth::AdminResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(10), controller,
-                       request, response, done);
-}
-void AdminService_Stub::UpdateRole(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::UpdateRoleRequest* request,
-                              ::siqi::auth::AdminResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(11), controller,
-                       request, response, done);
-}
-void AdminService_Stub::DeleteRole(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::DeleteRoleRequest* request,
-                              ::siqi::auth::AdminResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(12), controller,
-                       request, response, done);
-}
-void AdminService_Stub::ListRoles(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::ListRolesRequest* request,
-                              ::siqi::auth::ListRolesResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(13), controller,
-                       request, response, done);
-}
-void AdminService_Stub::AddPermissionToRole(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::AddPermissionToRoleRequest* request,
-                              ::siqi::auth::AdminResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(14), controller,
-                       request, response, done);
-}
-void AdminService_Stub::RemovePermissionFromRole(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::RemovePermissionFromRoleRequest* request,
-                              ::siqi::auth::AdminResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(15), controller,
-                       request, response, done);
-}
-void AdminService_Stub::GetRolePermissions(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::GetRolePermissionsRequest* request,
-                              ::siqi::auth::GetRolePermissionsResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(16), controller,
-                       request, response, done);
-}
-void AdminService_Stub::GrantRoleToUser(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::GrantRoleToUserRequest* request,
-                              ::siqi::auth::AdminResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(17), controller,
-                       request, response, done);
-}
-void AdminService_Stub::RevokeRoleFromUser(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::RevokeRoleFromUserRequest* request,
-                              ::siqi::auth::AdminResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(18), controller,
-                       request, response, done);
-}
-void AdminService_Stub::GetRoleUsers(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::GetRoleUsersRequest* request,
-                              ::siqi::auth::GetRoleUsersResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(19), controller,
-                       request, response, done);
-}
-void AdminService_Stub::ListUserRoles(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::ListUserRolesRequest* request,
-                              ::siqi::auth::ListUserRolesResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(20), controller,
-                       request, response, done);
-}
-void AdminService_Stub::ListAuditLogs(::google::protobuf::RpcController* controller,
-                              const ::siqi::auth::ListAuditLogsRequest* request,
-                              ::siqi::auth::ListAuditLogsResponse* response, ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(21), controller,
-                       request, response, done);
-}
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace auth
-}  // namespace siqi
-namespace google {
-namespace protobuf {
-}  // namespace protobuf
-}  // namespace google
-// @@protoc_insertion_point(global_scope)
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::std::false_type
-    _static_init2_ PROTOBUF_UNUSED =
-        (::_pbi::AddDescriptors(&descriptor_table_auth_2eproto),
-         ::std::false_type{});
-#include "google/protobuf/port_undef.inc"
@@ -2,9 +2,22 @@
 #include <gflags/gflags.h>
 #include "auth_agent.h"
 #include "permission_dao.h"
+#include "dao_stats.h"
+#include "dao_stats_service.h"
+#include <butil/endpoint.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
 
 // Agent 监听端口
 DEFINE_int32(port, 8881, "Agent 监听端口 (提供给本机应用调用)");
+// 本机调用方优先走 Unix Domain Socket：省去 TCP/IP 协议栈与回环网卡，延迟更低；默认留空只监听 TCP（conf/agent.conf 中开启）
+// socket 放在 agent 自己的目录里（不存在时以 0750 创建）：/tmp 人人可写，其他用户可以抢先创建同名 socket 冒充 agent
+// UDS 任一步失败只记 WARNING，Agent 继续通过 TCP 提供服务
+DEFINE_string(uds_path, "", "Agent Unix Domain Socket 路径，留空关闭（如 /run/siqi_auth/agent.sock）；所在目录不能允许其他用户写入");
+DEFINE_string(uds_mode, "0660", "Unix Domain Socket 文件权限（八进制），决定本机哪些用户可以调用；默认只允许属主与同组用户");
 
 // 数据库配置 (默认为本地 Slave, 连接 127.0.0.1:3306)
 DEFINE_string(db_host, "127.0.0.1", "MySQL Slave Addr");
@@ -12,10 +25,65 @@ DEFINE_int32(db_port, 3306, "MySQL Slave Port");
 DEFINE_string(db_user, "root", "MySQL User");  // 假设使用 root 或专用读用户
 DEFINE_string(db_password, "siqi123", "MySQL Password");
 DEFINE_string(db_name, "siqi_auth", "MySQL DB Name");
+DEFINE_int32(dao_slow_query_ms, 200, "慢查询阈值 (毫秒)，超过的 SQL 连同参数写日志并列入 /dao_stats，<= 0 关闭");
+
+namespace {
+
+// 在 --uds_path 上启动第二个 Server 挂同一个 Agent 服务；任一步失败返回 false（已记 WARNING）
+bool StartUdsServer(brpc::Server* uds_server, AuthAgentImpl* agent_service, const brpc::ServerOptions& options) {
+    butil::EndPoint uds_ep;
+    if (butil::str2endpoint(("unix:" + FLAGS_uds_path).c_str(), &uds_ep) != 0) {
+        LOG(WARNING) << "无效的 Unix Domain Socket 路径: " << FLAGS_uds_path;
+        return false;
+    }
+    const mode_t uds_mode = static_cast<mode_t>(strtol(FLAGS_uds_mode.c_str(), NULL, 8)) & 0777;
+    if (uds_mode & S_IWOTH) {
+        LOG(WARNING) << "--uds_mode=" << FLAGS_uds_mode << " 允许本机任意用户调用 Agent";
+    }
+    // socket 所在目录：不存在时创建为只有 agent 用户可写；已存在且其他用户可写时不开启 UDS，C++ SDK 也不会连接
+    std::string uds_dir = FLAGS_uds_path.substr(0, FLAGS_uds_path.find_last_of('/') + 1);
+    if (uds_dir.empty()) uds_dir = ".";
+    if (mkdir(uds_dir.c_str(), 0750) != 0 && errno != EEXIST) {
+        LOG(WARNING) << "无法创建 socket 目录 " << uds_dir << ": " << strerror(errno);
+        return false;
+    }
+    struct stat dir_st;
+    if (stat(uds_dir.c_str(), &dir_st) != 0 || (dir_st.st_mode & S_IWOTH)) {
+        LOG(WARNING) << "socket 目录 " << uds_dir << " 不存在或允许其他用户写入，请改用 agent 专属目录 (如 /run/siqi_auth/)";
+        return false;
+    }
+    // 上次异常退出留下的 socket 文件会导致 bind 失败；同名的不是 socket 时不删除
+    struct stat old_st;
+    if (lstat(FLAGS_uds_path.c_str(), &old_st) == 0) {
+        if (!S_ISSOCK(old_st.st_mode)) {
+            LOG(WARNING) << FLAGS_uds_path << " 已存在且不是 socket 文件";
+            return false;
+        }
+        if (unlink(FLAGS_uds_path.c_str()) != 0) {
+            LOG(WARNING) << "无法删除旧的 socket 文件 " << FLAGS_uds_path << ": " << strerror(errno);
+            return false;
+        }
+    }
+    // 不修改进程级 umask（TCP Server 的 worker 已在运行）：bind 后再 chmod，
+    // 其间 0750 的目录已挡住其他用户，同组用户能否连接取决于默认 umask 下的文件权限
+    const bool uds_started = uds_server->AddService(agent_service, brpc::SERVER_DOESNT_OWN_SERVICE) == 0 &&
+                             uds_server->Start(uds_ep, &options) == 0;
+    if (!uds_started) {
+        LOG(WARNING) << "启动 Unix Domain Socket 监听失败: " << FLAGS_uds_path;
+        return false;
+    }
+    if (chmod(FLAGS_uds_path.c_str(), uds_mode) != 0) {
+        LOG(WARNING) << "设置 socket 文件权限失败: " << strerror(errno);
+    }
+    return true;
+}
+
+} // namespace
 
 int main(int argc, char* argv[]) {
     // 解析命令行参数
     gflags::ParseCommandLineFlags(&argc, &argv, true);
+    DaoStats::Global().SetSlowQueryThresholdUs(static_cast<int64_t>(FLAGS_dao_slow_query_ms) * 1000);
     
     // 1. 初始化本地数据库连接 (替代原来的 RPC Channel)
     // PermissionDAO 内部维护连接池，适合高并发读取
@@ -30,18 +98,41 @@ int main(int argc, char* argv[]) {
         LOG(ERROR) << "添加 AgentService 失败";
         return -1;
     }
+
+    // /dao_stats 只挂在 TCP 端口上
+    DaoStatsServiceImpl dao_stats_service;
+    if (server.AddService(&dao_stats_service, brpc::SERVER_DOESNT_OWN_SERVICE,
+                          "/dao_stats => default_method") != 0) {
+        LOG(ERROR) << "添加 /dao_stats 页面失败";
+        return -1;
+    }
     
     brpc::ServerOptions options;
     if (server.Start(FLAGS_port, &options) != 0) {
         LOG(ERROR) << "启动 Agent 失败";
         return -1;
     }
+
+    // 3. Unix Domain Socket 监听：一个 brpc::Server 只能监听一个地址，同一个服务对象再挂到第二个 Server 上
+    brpc::Server uds_server;
+    const bool uds_enabled = !FLAGS_uds_path.empty() && StartUdsServer(&uds_server, &agent_service, options);
+    if (!FLAGS_uds_path.empty() && !uds_enabled) {
+        LOG(WARNING) << "Unix Domain Socket 未启用，Agent 只通过 TCP 端口 " << FLAGS_port << " 提供服务";
+    }
     
     LOG(INFO) << "Siqi Auth Agent (Local DB Mode) 已启动!";
     LOG(INFO) << "  - 监听端口: " << FLAGS_port;
+    if (uds_enabled) {
+        LOG(INFO) << "  - Unix Socket: " << FLAGS_uds_path;
+    }
     LOG(INFO) << "  - 本地数据库: " << FLAGS_db_host << ":" << FLAGS_db_port;
     LOG(INFO) << "  - 模式: 直连数据库 (Master-Slave Replica)";
 
     server.RunUntilAskedToQuit();
+    if (uds_enabled) {
+        uds_server.Stop(0);
+        uds_server.Join();
+        unlink(FLAGS_uds_path.c_str());
+    }
     return 0;
 }
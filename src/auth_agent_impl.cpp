@@ -2,7 +2,7 @@
 #include <butil/logging.h>
 
 // 构造函数：注入 DAO 对象
-AuthAgentImpl::AuthAgentImpl(PermissionDAO* dao) 
+AuthAgentImpl::AuthAgentImpl(PermissionStore* dao) 
     : dao_(dao) {
 }
 
@@ -33,7 +33,7 @@ void AuthAgentImpl::Check(google::protobuf::RpcController* cntl_base,
 
     // 1. 参数校验
     if (app_code.empty() || user_id.empty() || perm_key.empty()) {
-        LOG(WARNING) << "Agent 收到非法请求: " 
+        LOG_EVERY_SECOND(WARNING) << "Agent 收到非法请求: " 
                      << " app_code=" << app_code
                      << " user_id=" << user_id
                      << " perm_key=" << perm_key
@@ -77,3 +77,45 @@ void AuthAgentImpl::Check(google::protobuf::RpcController* cntl_base,
     // 添加 Header 标识这是本地直连查询
     cntl->http_response().SetHeader("X-Strategy", "Local-DB-Slave");
 }
+
+void AuthAgentImpl::BatchCheck(google::protobuf::RpcController* cntl_base,
+                               const siqi::auth::BatchCheckRequest* request,
+                               siqi::auth::BatchCheckResponse* response,
+                               google::protobuf::Closure* done) {
+    brpc::ClosureGuard done_guard(done);
+    brpc::Controller* cntl = static_cast<brpc::Controller*>(cntl_base);
+
+    if (request->app_code().empty() || request->items_size() == 0) {
+        cntl->SetFailed(EINVAL, "参数不完整 (Agent)");
+        return;
+    }
+
+    std::vector<std::tuple<std::string, std::string>> queries;
+    queries.reserve(request->items_size());
+    for (const auto& item : request->items()) {
+        queries.emplace_back(item.user_id(), item.perm_key());
+    }
+
+    // 一条 SQL 完成整批检查；拒绝原因不逐项细分，需要时再单独调用 Check
+    std::vector<bool> results;
+    try {
+        results = dao_->batchCheckPermissions(request->app_code(), queries);
+    } catch (const std::exception& e) {
+        LOG(ERROR) << "Agent 批量权限检查异常: " << e.what();
+        cntl->SetFailed(brpc::EINTERNAL, "系统内部错误");
+        return;
+    }
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        auto* result_item = response->add_results();
+        const auto& request_item = request->items(i);
+        result_item->set_user_id(request_item.user_id());
+        result_item->set_perm_key(request_item.perm_key());
+        result_item->set_allowed(results[i]);
+        if (!results[i]) {
+            result_item->set_reason("用户没有该权限");
+        }
+    }
+
+    cntl->http_response().SetHeader("X-Strategy", "Local-DB-Slave");
+}
@@ -0,0 +1,524 @@
+#include "auth_client.h"
+#include <brpc/callback.h>
+#include <butil/iobuf.h>
+#include <butil/logging.h>
+#include <algorithm>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// 单条推送消息涉及的用户超过这个数时直接整体清空，避免逐个前缀遍历缓存
+const size_t kMaxInvalidatePrefixes = 64;
+// 析构时等待订阅流关闭的最长时间
+const int kStreamCloseWaitMs = 1000;
+// 本机 auth_agent 的 TCP 地址（auth_agent --port 默认值）
+const char* const kLocalAgentAddrs[] = {"127.0.0.1:8881", "localhost:8881"};
+
+// socket 文件是否可信：必须是 socket 本身（不跟随符号链接），所在目录不允许其他用户写入，
+// 且属主是 root、当前用户或目录属主——否则本机其他用户可能抢先创建同名 socket 冒充 agent
+bool TrustedAgentSocket(const std::string& path) {
+    struct stat st;
+    if (lstat(path.c_str(), &st) != 0 || !S_ISSOCK(st.st_mode)) {
+        return false;
+    }
+    std::string dir = path.substr(0, path.find_last_of('/') + 1);
+    struct stat dir_st;
+    if (stat(dir.empty() ? "." : dir.c_str(), &dir_st) != 0) {
+        return false;
+    }
+    if ((dir_st.st_mode & S_IWOTH) ||
+        (st.st_uid != 0 && st.st_uid != geteuid() && st.st_uid != dir_st.st_uid)) {
+        LOG(WARNING) << "忽略不可信的 agent socket " << path << "（所在目录其他用户可写或属主不符），改用 TCP";
+        return false;
+    }
+    return true;
+}
+
+// 本机调用 auth_agent 时优先走 Unix Domain Socket，省去回环 TCP 的协议栈开销；
+// socket 文件不存在（agent 未开启 --uds_path 或不在本机）或未通过 TrustedAgentSocket 检查时退回 TCP
+std::string ResolveServer(const AuthClient::Options& options) {
+    bool local_agent = options.server.empty();
+    for (const char* addr : kLocalAgentAddrs) {
+        local_agent = local_agent || options.server == addr;
+    }
+    if (!local_agent) {
+        return options.server;
+    }
+    if (!options.agent_socket.empty() && TrustedAgentSocket(options.agent_socket)) {
+        return "unix:" + options.agent_socket;
+    }
+    return options.server.empty() ? kLocalAgentAddrs[0] : options.server;
+}
+
+} // namespace
+
+struct AuthClient::CheckCall {
+    Item item;
+    uint64_t epoch;
+    siqi::auth::CheckRequest request;
+    siqi::auth::CheckResponse response;
+    brpc::Controller cntl;
+};
+
+struct AuthClient::BatchCall {
+    std::vector<Item> items;
+    uint64_t epoch;
+    siqi::auth::BatchCheckRequest request;
+    siqi::auth::BatchCheckResponse response;
+    brpc::Controller cntl;
+};
+
+AuthClient::AuthClient(const Options& options) : options_(options) {
+    options_.max_batch = std::max<size_t>(options_.max_batch, 1);
+    options_.server = ResolveServer(options_);
+
+    brpc::ChannelOptions channel_options;
+    channel_options.timeout_ms = options_.timeout_ms;
+    channel_options.connect_timeout_ms = options_.connect_timeout_ms;
+    channel_options.max_retry = options_.max_retry;
+    if (channel_.Init(options_.server.c_str(), &channel_options) != 0) {
+        throw std::runtime_error("连接权限系统失败: " + options_.server);
+    }
+    stub_.reset(new siqi::auth::AuthService_Stub(&channel_));
+
+    if (options_.batch_window_us > 0) {
+        flusher_ = std::thread(&AuthClient::FlushLoop, this);
+    }
+    if (options_.watch) {
+        watcher_ = std::thread(&AuthClient::WatchLoop, this);
+    }
+}
+
+AuthClient::~AuthClient() {
+    // 1. 停止订阅，等待流关闭，避免 on_closed 回调到已析构的对象
+    {
+        std::unique_lock<std::mutex> lock(watch_mutex_);
+        watch_stopped_ = true;
+    }
+    watch_cond_.notify_all();
+    if (watcher_.joinable()) {
+        watcher_.join();
+    }
+    {
+        std::unique_lock<std::mutex> lock(watch_mutex_);
+        if (stream_ != brpc::INVALID_STREAM_ID) {
+            brpc::StreamClose(stream_);
+        }
+        if (!watch_cond_.wait_for(lock, std::chrono::milliseconds(kStreamCloseWaitMs),
+                                  [this] { return open_streams_ == 0; })) {
+            LOG(WARNING) << "等待权限变更订阅流关闭超时";
+        }
+    }
+
+    // 2. 发出攒批中的检查，再等待所有 RPC 返回
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+    }
+    cond_.notify_all();
+    if (flusher_.joinable()) {
+        flusher_.join();
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_cond_.wait(lock, [this] { return outstanding_ == 0; });
+}
+
+AuthClient::Result AuthClient::Check(const std::string& app_code,
+                                     const std::string& user_id,
+                                     const std::string& perm_key) {
+    return CheckAsync(app_code, user_id, perm_key).get();
+}
+
+std::future<AuthClient::Result> AuthClient::CheckAsync(const std::string& app_code,
+                                                       const std::string& user_id,
+                                                       const std::string& perm_key) {
+    auto promise = std::make_shared<std::promise<Result>>();
+    std::future<Result> future = promise->get_future();
+    CheckAsync(app_code, user_id, perm_key, [promise](const Result& result) {
+        promise->set_value(result);
+    });
+    return future;
+}
+
+void AuthClient::CheckAsync(const std::string& app_code,
+                            const std::string& user_id,
+                            const std::string& perm_key,
+                            Callback done) {
+    checks_.fetch_add(1, std::memory_order_relaxed);
+
+    Item item;
+    item.key = Key(app_code, user_id, perm_key);
+    bool allowed = false;
+    if (options_.cache_ttl_s > 0 && cache_.Get(item.key, allowed)) {
+        cache_hits_.fetch_add(1, std::memory_order_relaxed);
+        Result result;
+        result.ok = true;
+        result.allowed = allowed;
+        done(result);
+        return;
+    }
+
+    item.app_code = app_code;
+    item.user_id = user_id;
+    item.perm_key = perm_key;
+    uint64_t epoch = 0;
+    bool send_now = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!stopped_) {
+            auto it = inflight_.find(item.key);
+            if (it != inflight_.end()) {
+                it->second.push_back(std::move(done));
+                coalesced_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            inflight_[item.key].push_back(std::move(done));
+
+            if (options_.batch_window_us > 0) {
+                if (queue_.empty()) {
+                    queue_since_ = std::chrono::steady_clock::now();
+                    cond_.notify_one();
+                }
+                queue_.push_back(std::move(item));
+                if (queue_.size() >= options_.max_batch) {
+                    cond_.notify_one();
+                }
+                return;
+            }
+            // 不攒批：立即单独发送
+            ++outstanding_;
+            epoch = epoch_;
+            send_now = true;
+        }
+    }
+    if (send_now) {
+        SendCheck(item, epoch);
+        return;
+    }
+    Result result;
+    result.error = "客户端已关闭";
+    done(result);
+}
+
+void AuthClient::FlushLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cond_.wait(lock, [this] { return stopped_ || !queue_.empty(); });
+        if (queue_.empty()) {
+            return;
+        }
+        if (!stopped_) {
+            // 攒满窗口或凑够一批
+            cond_.wait_until(lock, queue_since_ + std::chrono::microseconds(options_.batch_window_us),
+                             [this] { return stopped_ || queue_.size() >= options_.max_batch; });
+        }
+
+        // BatchCheck 只能携带一个应用，按应用分组后再按 max_batch 切分
+        std::map<std::string, std::vector<Item>> by_app;
+        for (auto& item : queue_) {
+            by_app[item.app_code].push_back(std::move(item));
+        }
+        queue_.clear();
+        std::vector<std::vector<Item>> batches;
+        for (auto& kv : by_app) {
+            std::vector<Item>& items = kv.second;
+            for (size_t begin = 0; begin < items.size(); begin += options_.max_batch) {
+                size_t end = std::min(items.size(), begin + options_.max_batch);
+                batches.emplace_back(std::make_move_iterator(items.begin() + begin),
+                                     std::make_move_iterator(items.begin() + end));
+            }
+        }
+        outstanding_ += batches.size();
+        const uint64_t epoch = epoch_;
+
+        lock.unlock();
+        for (auto& batch : batches) {
+            if (batch.size() == 1) {
+                // 单项仍走 Check：服务端 Check 有缓存，BatchCheck 每次都查库
+                SendCheck(batch[0], epoch);
+            } else {
+                SendBatch(std::move(batch), epoch);
+            }
+        }
+        lock.lock();
+    }
+}
+
+void AuthClient::SendCheck(const Item& item, uint64_t epoch) {
+    CheckCall* call = new CheckCall();
+    call->item = item;
+    call->epoch = epoch;
+    call->request.set_app_code(item.app_code);
+    call->request.set_user_id(item.user_id);
+    call->request.set_perm_key(item.perm_key);
+    rpcs_.fetch_add(1, std::memory_order_relaxed);
+    stub_->Check(&call->cntl, &call->request, &call->response,
+                 brpc::NewCallback(this, &AuthClient::OnCheckDone, call));
+}
+
+void AuthClient::SendBatch(std::vector<Item> items, uint64_t epoch) {
+    BatchCall* call = new BatchCall();
+    call->epoch = epoch;
+    call->request.set_app_code(items.front().app_code);
+    for (const auto& item : items) {
+        auto* req_item = call->request.add_items();
+        req_item->set_user_id(item.user_id);
+        req_item->set_perm_key(item.perm_key);
+    }
+    call->items = std::move(items);
+    rpcs_.fetch_add(1, std::memory_order_relaxed);
+    stub_->BatchCheck(&call->cntl, &call->request, &call->response,
+                      brpc::NewCallback(this, &AuthClient::OnBatchDone, call));
+}
+
+void AuthClient::OnCheckDone(CheckCall* call) {
+    std::unique_ptr<CheckCall> guard(call);
+    Result result;
+    // 只有 RPC 成功且服务端给出了结论才算 ok（Complete 只缓存 ok 的结果），服务端出错原样返回给调用方
+    if (call->cntl.Failed()) {
+        result.error = call->cntl.ErrorText();
+    } else if (call->response.error()) {
+        result.error = call->response.reason().empty() ? "服务端内部错误" : call->response.reason();
+    } else if (!call->response.has_allowed()) {
+        result.error = "Check 响应缺少结论";
+    } else {
+        result.ok = true;
+        result.allowed = call->response.allowed();
+    }
+    Complete(call->item.key, result, call->epoch);
+    FinishRpc();
+}
+
+void AuthClient::OnBatchDone(BatchCall* call) {
+    std::unique_ptr<BatchCall> guard(call);
+    const auto& results = call->response.results();
+    for (size_t i = 0; i < call->items.size(); ++i) {
+        Result result;
+        if (call->cntl.Failed()) {
+            result.error = call->cntl.ErrorText();
+        } else if (i >= static_cast<size_t>(results.size())) {
+            result.error = "BatchCheck 返回结果数量不足";
+        } else if (!results.Get(i).has_allowed()) {
+            result.error = "BatchCheck 结果缺少结论";
+        } else {
+            result.ok = true;
+            result.allowed = results.Get(i).allowed();
+        }
+        Complete(call->items[i].key, result, call->epoch);
+    }
+    FinishRpc();
+}
+
+void AuthClient::Complete(const std::string& key, const Result& result, uint64_t epoch) {
+    std::vector<Callback> waiters;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (result.ok && options_.cache_ttl_s > 0 && epoch == epoch_) {
+            if (cache_.Size() >= options_.cache_max_entries) {
+                cache_.Clear();
+            }
+            cache_.Put(key, result.allowed, options_.cache_ttl_s);
+        }
+        auto it = inflight_.find(key);
+        if (it != inflight_.end()) {
+            waiters.swap(it->second);
+            inflight_.erase(it);
+        }
+    }
+    for (auto& cb : waiters) {
+        cb(result);
+    }
+}
+
+void AuthClient::FinishRpc() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--outstanding_ == 0) {
+        idle_cond_.notify_all();
+    }
+}
+
+void AuthClient::InvalidateUser(const std::string& app_code, const std::string& user_id) {
+    Invalidate({app_code + ":" + user_id + ":"});
+}
+
+void AuthClient::InvalidateApp(const std::string& app_code) {
+    Invalidate({app_code + ":"});
+}
+
+void AuthClient::ClearCache() {
+    Invalidate({});
+}
+
+void AuthClient::Invalidate(const std::vector<std::string>& prefixes) {
+    // 与 Complete 共用一把锁：失效之后不会再有旧结论写回缓存
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++epoch_;
+    if (prefixes.empty()) {
+        cache_.Clear();
+        return;
+    }
+    for (const auto& prefix : prefixes) {
+        cache_.InvalidatePrefix(prefix);
+    }
+}
+
+AuthClient::Stats AuthClient::GetStats() const {
+    Stats stats;
+    stats.checks = checks_.load(std::memory_order_relaxed);
+    stats.cache_hits = cache_hits_.load(std::memory_order_relaxed);
+    stats.coalesced = coalesced_.load(std::memory_order_relaxed);
+    stats.rpcs = rpcs_.load(std::memory_order_relaxed);
+    stats.watch_events = watch_events_.load(std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(watch_mutex_);
+    stats.head_seq = head_seq_;
+    stats.watching = watching_;
+    return stats;
+}
+
+void AuthClient::WatchLoop() {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(watch_mutex_);
+            if (watch_stopped_) {
+                return;
+            }
+            if (watching_) {
+                // 订阅中：等流断开再重连
+                watch_cond_.wait(lock, [this] { return watch_stopped_ || !watching_; });
+                continue;
+            }
+        }
+        if (!Subscribe()) {
+            std::unique_lock<std::mutex> lock(watch_mutex_);
+            watch_cond_.wait_for(lock, std::chrono::milliseconds(options_.watch_retry_ms),
+                                 [this] { return watch_stopped_; });
+        }
+    }
+}
+
+bool AuthClient::Subscribe() {
+    brpc::Controller cntl;
+    brpc::StreamOptions stream_options;
+    stream_options.handler = this;
+    brpc::StreamId stream;
+    if (brpc::StreamCreate(&stream, cntl, &stream_options) != 0) {
+        LOG(WARNING) << "创建权限变更订阅流失败";
+        return false;
+    }
+
+    uint64_t from_seq = 0;
+    {
+        // 先登记再发起 RPC：流随时可能被关闭，on_closed 需要能认出它
+        std::lock_guard<std::mutex> lock(watch_mutex_);
+        stream_ = stream;
+        watching_ = true;
+        ++open_streams_;
+        from_seq = head_seq_;
+    }
+
+    siqi::auth::WatchRequest request;
+    request.set_app_code(options_.watch_app_code);
+    request.set_from_seq(from_seq);
+    siqi::auth::WatchResponse response;
+    stub_->Watch(&cntl, &request, &response, NULL);
+
+    if (cntl.Failed() || !response.success()) {
+        LOG(WARNING) << "订阅权限变更失败: " << (cntl.Failed() ? cntl.ErrorText() : response.message());
+        brpc::StreamClose(stream);
+        std::lock_guard<std::mutex> lock(watch_mutex_);
+        if (stream_ == stream) {
+            stream_ = brpc::INVALID_STREAM_ID;
+            watching_ = false;
+        }
+        return false;
+    }
+
+    if (from_seq == 0) {
+        // 没有断点可续传：订阅建立前缓存的结论可能已经过期
+        ClearCache();
+        std::lock_guard<std::mutex> lock(watch_mutex_);
+        if (head_seq_ == 0) {
+            head_seq_ = response.head_seq();
+        }
+    }
+    LOG(INFO) << "已订阅权限变更 app=" << (options_.watch_app_code.empty() ? "*" : options_.watch_app_code)
+              << " from_seq=" << from_seq << " head_seq=" << response.head_seq();
+    return true;
+}
+
+int AuthClient::on_received_messages(brpc::StreamId id, butil::IOBuf* const messages[], size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        siqi::auth::WatchEvents msg;
+        if (!msg.ParseFromString(messages[i]->to_string())) {
+            LOG(WARNING) << "无法解析权限变更推送，已忽略";
+            continue;
+        }
+
+        // 合并整条消息涉及的用户 / 应用再统一失效
+        bool clear_all = false;
+        std::set<std::string> apps;
+        std::set<std::string> users;
+        for (const auto& ev : msg.events()) {
+            switch (ev.type()) {
+            case siqi::auth::ChangeEvent::USER_GRANT_ROLE:
+            case siqi::auth::ChangeEvent::USER_REVOKE_ROLE:
+                users.insert(ev.app_code() + ":" + ev.user_id() + ":");
+                break;
+            case siqi::auth::ChangeEvent::SNAPSHOT:
+                // 断点已无法续传：清空订阅范围内的全部缓存
+                if (ev.app_code().empty()) {
+                    clear_all = true;
+                } else {
+                    apps.insert(ev.app_code() + ":");
+                }
+                break;
+            default:
+                // 角色 / 权限 / 应用变更影响的用户无法从事件中得知，失效整个应用
+                apps.insert(ev.app_code() + ":");
+                break;
+            }
+        }
+        watch_events_.fetch_add(msg.events_size(), std::memory_order_relaxed);
+
+        if (clear_all || apps.size() + users.size() > kMaxInvalidatePrefixes) {
+            Invalidate({});
+        } else if (!apps.empty() || !users.empty()) {
+            std::vector<std::string> prefixes(apps.begin(), apps.end());
+            for (const auto& user : users) {
+                // 所属应用已整体失效的跳过
+                if (apps.count(user.substr(0, user.find(':') + 1)) == 0) {
+                    prefixes.push_back(user);
+                }
+            }
+            Invalidate(prefixes);
+        }
+
+        std::lock_guard<std::mutex> lock(watch_mutex_);
+        head_seq_ = msg.head_seq();
+    }
+    return 0;
+}
+
+void AuthClient::on_idle_timeout(brpc::StreamId id) {
+}
+
+void AuthClient::on_closed(brpc::StreamId id) {
+    {
+        std::lock_guard<std::mutex> lock(watch_mutex_);
+        if (open_streams_ > 0) {
+            --open_streams_;
+        }
+        if (id == stream_) {
+            stream_ = brpc::INVALID_STREAM_ID;
+            watching_ = false;
+            if (!watch_stopped_) {
+                LOG(WARNING) << "权限变更订阅已断开，将从 seq=" << head_seq_ << " 续传";
+            }
+        }
+    }
+    watch_cond_.notify_all();
+}
@@ -0,0 +1,134 @@
+#include "auth_metrics.h"
+#include <butil/time.h>
+
+namespace {
+
+// 命中率统计窗口（秒）
+const int64_t kHitRatioWindowS = 10;
+// 不在应用目录中的 app_code 统一使用的标签
+const char* const kUnknownAppLabel = "_unknown";
+const char* const kMethodNames[] = {"Check", "BatchCheck"};
+// 估算内存占用时采样的条目数：采样在缓存锁内进行，不宜过大
+const size_t kBytesSampleEntries = 1000;
+
+const char* const kDenyReasonNames[AuthMetrics::kDenyReasonCount] = {
+    "invalid_params", "error", "app_not_found", "perm_not_found", "no_role", "no_permission",
+};
+
+} // namespace
+
+AuthMetrics::AuthMetrics(std::shared_ptr<PermCache> cache, std::shared_ptr<const AppCatalog> catalog)
+    : cache_(cache),
+      catalog_(catalog),
+      miss_load_("auth_check_miss_load"),
+      batch_items_("auth_batch_check_items"),
+      batch_denied_("auth_batch_check_denied_items"),
+      cache_hit_("auth_cache_hit"),
+      cache_miss_("auth_cache_miss"),
+      cache_hit_window_(&cache_hit_, kHitRatioWindowS),
+      cache_miss_window_(&cache_miss_, kHitRatioWindowS),
+      app_requests_("auth_app_requests", {"app", "method"}),
+      deny_counts_("auth_check_deny", {"reason"}),
+      cache_hit_ratio_("auth_cache_hit_ratio", GetHitRatio, this),
+      cache_entries_("auth_cache_entries", GetCacheEntries, this),
+      cache_bytes_("auth_cache_bytes", GetCacheBytes, this) {
+    check_latency_[1][1].expose("auth_check_hit_allow");
+    check_latency_[1][0].expose("auth_check_hit_deny");
+    check_latency_[0][1].expose("auth_check_miss_allow");
+    check_latency_[0][0].expose("auth_check_miss_deny");
+    batch_latency_[1].expose("auth_batch_check_allow");
+    batch_latency_[0].expose("auth_batch_check_deny");
+    // 拒绝原因是固定集合，预先创建，热路径上不再查 MultiDimension 的内部表
+    for (int i = 0; i < kDenyReasonCount; ++i) {
+        deny_[i] = deny_counts_.get_stats({kDenyReasonNames[i]});
+    }
+    for (int m = 0; m < kMethodCount; ++m) {
+        unknown_app_.by_method[m] = app_requests_.get_stats({kUnknownAppLabel, kMethodNames[m]});
+    }
+}
+
+void AuthMetrics::RecordCheck(const std::string& app_code, bool cache_hit, bool allowed, int64_t start_us) {
+    int64_t latency_us = butil::cpuwide_time_us() - start_us;
+    check_latency_[cache_hit ? 1 : 0][allowed ? 1 : 0] << latency_us;
+    bvar::LatencyRecorder* app = AppRecorder(app_code, kCheck);
+    if (app) {
+        *app << latency_us;
+    }
+}
+
+void AuthMetrics::RecordBatchCheck(const std::string& app_code, int items, int denied, int64_t start_us) {
+    int64_t latency_us = butil::cpuwide_time_us() - start_us;
+    batch_latency_[denied == 0 ? 1 : 0] << latency_us;
+    batch_items_ << items;
+    batch_denied_ << denied;
+    bvar::LatencyRecorder* app = AppRecorder(app_code, kBatchCheck);
+    if (app) {
+        *app << latency_us;
+    }
+}
+
+const char* AuthMetrics::DenyReasonName(DenyReason reason) {
+    if (reason < 0 || reason >= kDenyReasonCount) {
+        return nullptr;
+    }
+    return kDenyReasonNames[reason];
+}
+
+bvar::LatencyRecorder* AuthMetrics::AppRecorder(const std::string& app_code, Method method) {
+    {
+        butil::DoublyBufferedData<AppRecorderMap>::ScopedPtr recorders;
+        if (app_recorders_.Read(&recorders) == 0) {
+            auto it = recorders->find(app_code);
+            if (it != recorders->end()) {
+                return it->second.by_method[method];
+            }
+        }
+    }
+    if (!catalog_ || !catalog_->Contains(app_code)) {
+        return unknown_app_.by_method[method];
+    }
+
+    // 已注册但第一次出现的应用：建标签并加入表中，之后的请求只走上面的只读查找
+    std::lock_guard<std::mutex> lock(app_recorders_mutex_);
+    AppRecorders created;
+    for (int m = 0; m < kMethodCount; ++m) {
+        created.by_method[m] = app_requests_.get_stats({app_code, kMethodNames[m]});
+    }
+    auto insert = [&app_code, &created](AppRecorderMap& map) -> size_t {
+        return map.emplace(app_code, created).second ? 1 : 0;
+    };
+    app_recorders_.Modify(insert);
+    return created.by_method[method];
+}
+
+double AuthMetrics::GetHitRatio(void* arg) {
+    AuthMetrics* self = static_cast<AuthMetrics*>(arg);
+    int64_t hits = self->cache_hit_window_.get_value();
+    int64_t lookups = hits + self->cache_miss_window_.get_value();
+    // 窗口内没有缓存查询时记为 1（没有未命中），避免空闲实例触发命中率告警
+    return lookups > 0 ? static_cast<double>(hits) / lookups : 1.0;
+}
+
+int64_t AuthMetrics::GetCacheEntries(void* arg) {
+    AuthMetrics* self = static_cast<AuthMetrics*>(arg);
+    return self->cache_ ? static_cast<int64_t>(self->cache_->Size()) : 0;
+}
+
+int64_t AuthMetrics::GetCacheBytes(void* arg) {
+    AuthMetrics* self = static_cast<AuthMetrics*>(arg);
+    if (!self->cache_) {
+        return 0;
+    }
+    // 逐条累加需要长时间持锁，这里按前若干条目的平均大小乘以总条目数估算
+    size_t sampled = 0;
+    size_t sampled_bytes = 0;
+    size_t total = self->cache_->Sample(kBytesSampleEntries,
+        [&](const std::string& key, const CachedPerms& perms) {
+            ++sampled;
+            sampled_bytes += ApproxEntryBytes(key, perms);
+        });
+    if (sampled == 0) {
+        return 0;
+    }
+    return static_cast<int64_t>(static_cast<double>(sampled_bytes) / sampled * total);
+}
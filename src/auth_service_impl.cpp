@@ -1,17 +1,59 @@
 #include "auth_service_impl.h"
 #include <brpc/controller.h>
+#include <butil/time.h>
 #include <errno.h>
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
 
-AuthServiceImpl::AuthServiceImpl(std::shared_ptr<LocalCache<std::unordered_set<std::string>>> cache,
+namespace {
+
+// 句柄目录的定期刷新间隔：发现其他副本上的权限增删
+const std::chrono::milliseconds kHandleRefreshInterval(5000);
+// 客户端版本与本地不一致（客户端可能在更新的副本上解析过）或尚未加载成功时的重试间隔
+const std::chrono::milliseconds kHandleRetryInterval(1000);
+
+// 指标按应用打标签时用来识别已注册的应用；只有 MySQL 存储带应用目录
+std::shared_ptr<const AppCatalog> AppCatalogOf(const std::shared_ptr<PermissionStore>& store) {
+    const PermissionDAO* dao = dynamic_cast<const PermissionDAO*>(store.get());
+    return dao ? dao->appCatalog() : nullptr;
+}
+
+} // namespace
+
+AuthServiceImpl::AuthServiceImpl(std::shared_ptr<PermCache> cache,
                                  const std::string& host,
                                  int port,
                                  const std::string& user,
                                  const std::string& password,
                                  const std::string& database,
-                                 int cache_ttl)
-    : dao_(host, port, user, password, database), cache_(cache), cache_ttl_(cache_ttl) {
+                                 int cache_ttl,
+                                 std::shared_ptr<DBExecutor> db_executor,
+                                 const std::vector<PermissionDAO::Endpoint>& db_replicas,
+                                 int max_replica_lag_s,
+                                 std::shared_ptr<AppCatalog> app_catalog,
+                                 std::shared_ptr<ReadFence> read_fence,
+                                 const ChangeFeed::Options& watch_options,
+                                 std::shared_ptr<AccessLog> access_log)
+    : AuthServiceImpl(cache,
+                      std::make_shared<PermissionDAO>(host, port, user, password, database, app_catalog,
+                                                      db_replicas, max_replica_lag_s, 1000, read_fence),
+                      cache_ttl, db_executor, watch_options, access_log) {
+}
+
+AuthServiceImpl::AuthServiceImpl(std::shared_ptr<PermCache> cache,
+                                 std::shared_ptr<PermissionStore> store,
+                                 int cache_ttl,
+                                 std::shared_ptr<DBExecutor> db_executor,
+                                 const ChangeFeed::Options& watch_options,
+                                 std::shared_ptr<AccessLog> access_log)
+    : dao_(store), cache_(cache), cache_ttl_(cache_ttl),
+      db_executor_(db_executor),
+      change_feed_(new ChangeFeed(dao_.get(), watch_options)),
+      metrics_(cache, AppCatalogOf(store)),
+      access_log_(access_log) {
     
-    if (!dao_.isConnected()) {
+    if (!dao_->isConnected()) {
         LOG(ERROR) << "数据库连接失败，服务启动可能受影响";
     } else {
         LOG(INFO) << "数据库连接成功";
@@ -25,12 +67,14 @@ void AuthServiceImpl::Check(google::protobuf::RpcController* cntl,
     
     // 确保done会被调用（RAII方式）
     brpc::ClosureGuard done_guard(done);
-    brpc::Controller* bcntl = static_cast<brpc::Controller*>(cntl);
+    const int64_t start_us = butil::cpuwide_time_us();
 
     // 1. Params Validation
     if (request->app_code().empty() || request->user_id().empty() || request->perm_key().empty()) {
         response->set_allowed(false);
         response->set_reason("参数不完整");
+        metrics_.RecordDeny(AuthMetrics::kInvalidParams);
+        LogCheck(request, false, false, AuthMetrics::kInvalidParams, start_us);
         return;
     }
 
@@ -40,15 +84,45 @@ void AuthServiceImpl::Check(google::protobuf::RpcController* cntl,
     
     bool cache_hit = false;
     if (cache_) {
-        cache_hit = cache_->Get(cache_key, user_perms);
+        cache_hit = cache_->Visit(cache_key, [&user_perms](const CachedPerms& cached) {
+            user_perms = cached.keys;
+        });
+        metrics_.RecordCacheLookup(cache_hit);
     }
-    
+
+    // 缓存命中且允许时不需要访问数据库，直接在当前 worker 完成；
+    // 其余情况（未命中需要加载、拒绝需要诊断）在异步模式下交给 DB 执行器
+    bool need_db = !cache_hit || user_perms.count(request->perm_key()) == 0;
+    if (need_db && db_executor_) {
+        google::protobuf::Closure* async_done = done_guard.release();
+        bool submitted = db_executor_->Submit(
+            [this, request, response, async_done, cache_hit, user_perms, start_us]() mutable {
+                brpc::ClosureGuard async_guard(async_done);
+                ProcessCheck(request, response, cache_hit, user_perms, start_us);
+            });
+        if (submitted) {
+            return;
+        }
+        // 执行器队列已满：退化为同步执行，请求不丢弃
+        done_guard.reset(async_done);
+    }
+
+    ProcessCheck(request, response, cache_hit, user_perms, start_us);
+}
+
+void AuthServiceImpl::ProcessCheck(const siqi::auth::CheckRequest* request,
+                                   siqi::auth::CheckResponse* response,
+                                   bool cache_hit,
+                                   std::unordered_set<std::string>& user_perms,
+                                   int64_t start_us) {
     if (!cache_hit) {
         // 3. Cache Miss - Load from DB
         try {
             // Here we assume getUserPermissions gets all effective permissions for the user
             // This avoids complex SQL in AuthServiceImpl and leverages DAO
-            auto perms = dao_.getUserPermissions(request->app_code(), request->user_id());
+            const int64_t load_start_us = butil::cpuwide_time_us();
+            auto perms = dao_->getUserPermissions(request->app_code(), request->user_id());
+            metrics_.RecordMissLoad(butil::cpuwide_time_us() - load_start_us);
             user_perms.clear();
             for (const auto& p : perms) {
                 user_perms.insert(p.first); // Use perm_key (first), not perm_name (second)
@@ -57,33 +131,42 @@ void AuthServiceImpl::Check(google::protobuf::RpcController* cntl,
              LOG(ERROR) << "DB Error: " << e.what();
              response->set_allowed(false);
              response->set_reason("系统错误");
+             response->set_error(true);
+             metrics_.RecordDeny(AuthMetrics::kError);
+             metrics_.RecordCheck(request->app_code(), cache_hit, false, start_us);
+             LogCheck(request, cache_hit, false, AuthMetrics::kError, start_us);
              return;
         }
         
         // 4. Update Cache (TTL from config)
         if (cache_) {
-            cache_->Put(cache_key, user_perms, cache_ttl_);
+            CachedPerms cached;
+            cached.keys = user_perms;
+            cache_->Put(request->app_code() + ":" + request->user_id(), cached, cache_ttl_);
         }
     }
 
     // 5. Final Check
     bool allowed = (user_perms.count(request->perm_key()) > 0);
     response->set_allowed(allowed);
+    AuthMetrics::DenyReason deny_reason = AuthMetrics::kDenyReasonCount;
     
     if (!allowed) {
-        if (!dao_.appExists(request->app_code())) {
+        if (!dao_->appExists(request->app_code())) {
             response->set_reason("应用不存在" + std::string(cache_hit ? " (Cache)" : ""));
-        } else if (!dao_.permissionExists(request->app_code(), request->perm_key())) {
+            deny_reason = AuthMetrics::kAppNotFound;
+        } else if (!dao_->permissionExists(request->app_code(), request->perm_key())) {
             response->set_reason("权限不存在" + std::string(cache_hit ? " (Cache)" : ""));
+            deny_reason = AuthMetrics::kPermNotFound;
         } else {
-            auto current_roles = dao_.getUserRoles(request->app_code(), request->user_id());
+            auto current_roles = dao_->getUserRoles(request->app_code(), request->user_id());
             std::string reason_prefix = current_roles.empty() ? "用户不存在或未分配任何角色" : "用户没有该权限";
             
             std::string curr_roles_str = current_roles.empty() ? "无" : current_roles[0];
             for (size_t i = 1; i < current_roles.size(); ++i) curr_roles_str += "," + current_roles[i];
             response->set_current_roles(curr_roles_str);
             
-            auto required_roles = dao_.getRolesWithPermission(request->app_code(), request->perm_key());
+            auto required_roles = dao_->getRolesWithPermission(request->app_code(), request->perm_key());
             if (!required_roles.empty()) {
                 std::string suggest = required_roles[0];
                 for (size_t i = 1; i < required_roles.size(); ++i) suggest += "," + required_roles[i];
@@ -91,11 +174,23 @@ void AuthServiceImpl::Check(google::protobuf::RpcController* cntl,
             }
             
             response->set_reason(reason_prefix + (cache_hit ? " (Cache)" : ""));
+            deny_reason = current_roles.empty() ? AuthMetrics::kNoRole : AuthMetrics::kNoPermission;
         }
+        metrics_.RecordDeny(deny_reason);
     }
-    
-    LOG(INFO) << "Check " << request->user_id() << " -> " << request->perm_key() 
-              << (allowed ? " [ALLOW]" : " [DENY]") << (cache_hit ? " (Hit)" : " (Miss)");
+    metrics_.RecordCheck(request->app_code(), cache_hit, allowed, start_us);
+    LogCheck(request, cache_hit, allowed, deny_reason, start_us);
+}
+
+void AuthServiceImpl::LogCheck(const siqi::auth::CheckRequest* request, bool cache_hit, bool allowed,
+                               AuthMetrics::DenyReason reason, int64_t start_us) {
+    // 抽样在前：未被抽中的请求不做任何拷贝
+    if (!access_log_ || !access_log_->Sampled(allowed)) {
+        return;
+    }
+    access_log_->Append(AccessLog::kCheck, request->app_code(), request->user_id(), request->perm_key(),
+                        allowed, cache_hit, AuthMetrics::DenyReasonName(reason), 1, allowed ? 0 : 1,
+                        butil::cpuwide_time_us() - start_us);
 }
 
 void AuthServiceImpl::BatchCheck(google::protobuf::RpcController* cntl,
@@ -105,13 +200,34 @@ void AuthServiceImpl::BatchCheck(google::protobuf::RpcController* cntl,
     
     brpc::ClosureGuard done_guard(done);
     brpc::Controller* bcntl = static_cast<brpc::Controller*>(cntl);
+    const int64_t start_us = butil::cpuwide_time_us();
     
     // 1. 参数验证
     if (request->app_code().empty() || request->items_size() == 0) {
         bcntl->SetFailed(EINVAL, "参数不完整");
         return;
     }
-    
+
+    // 批量检查全部需要查库，异步模式下整体交给 DB 执行器
+    if (db_executor_) {
+        google::protobuf::Closure* async_done = done_guard.release();
+        bool submitted = db_executor_->Submit([this, bcntl, request, response, async_done, start_us]() {
+            brpc::ClosureGuard async_guard(async_done);
+            ProcessBatchCheck(bcntl, request, response, start_us);
+        });
+        if (submitted) {
+            return;
+        }
+        done_guard.reset(async_done);
+    }
+
+    ProcessBatchCheck(bcntl, request, response, start_us);
+}
+
+void AuthServiceImpl::ProcessBatchCheck(brpc::Controller* bcntl,
+                                        const siqi::auth::BatchCheckRequest* request,
+                                        siqi::auth::BatchCheckResponse* response,
+                                        int64_t start_us) {
     // 2. 准备批量查询数据
     std::vector<std::tuple<std::string, std::string>> queries;
     for (int i = 0; i < request->items_size(); i++) {
@@ -122,7 +238,7 @@ void AuthServiceImpl::BatchCheck(google::protobuf::RpcController* cntl,
     // 3. 执行批量检查
     std::vector<bool> results;
     try {
-        results = dao_.batchCheckPermissions(request->app_code(), queries);
+        results = dao_->batchCheckPermissions(request->app_code(), queries);
     } catch (const std::exception& e) {
         LOG(ERROR) << "批量权限检查异常: " << e.what();
         bcntl->SetFailed(brpc::EINTERNAL, "系统内部错误");
@@ -130,6 +246,7 @@ void AuthServiceImpl::BatchCheck(google::protobuf::RpcController* cntl,
     }
     
     // 4. 构建响应
+    int denied = 0;
     for (size_t i = 0; i < results.size(); i++) {
         auto* result_item = response->add_results();
         const auto& request_item = request->items(i);
@@ -140,14 +257,290 @@ void AuthServiceImpl::BatchCheck(google::protobuf::RpcController* cntl,
         
         if (!results[i]) {
             result_item->set_reason("用户没有该权限");
+            ++denied;
         }
     }
-    
-    LOG(INFO) << "[BatchCheck] app=" << request->app_code()
-              << " count=" << request->items_size()
-              << " latency=" << bcntl->latency_us() << "us";
+    metrics_.RecordBatchCheck(request->app_code(), static_cast<int>(results.size()), denied, start_us);
+
+    // 任一条目被拒绝即按拒绝的抽样率记录；单条目明细不落日志
+    if (access_log_ && access_log_->Sampled(denied == 0)) {
+        static const std::string kEmpty;
+        access_log_->Append(AccessLog::kBatchCheck, request->app_code(), kEmpty, kEmpty,
+                            denied == 0, false, nullptr, static_cast<int32_t>(results.size()), denied,
+                            butil::cpuwide_time_us() - start_us);
+    }
+}
+
+void AuthServiceImpl::Watch(google::protobuf::RpcController* cntl,
+                            const siqi::auth::WatchRequest* request,
+                            siqi::auth::WatchResponse* response,
+                            google::protobuf::Closure* done) {
+    brpc::ClosureGuard done_guard(done);
+    brpc::Controller* bcntl = static_cast<brpc::Controller*>(cntl);
+
+    // 流在 RPC 返回后建立，之后由 ChangeFeed 的后台线程按 seq 顺序推送
+    uint64_t head_seq = 0;
+    std::string error;
+    if (!change_feed_->Subscribe(bcntl, request->app_code(), request->from_seq(), &head_seq, &error)) {
+        response->set_success(false);
+        response->set_message(error);
+        return;
+    }
+    response->set_success(true);
+    response->set_head_seq(head_seq);
+
+    LOG(INFO) << "[Watch] app=" << (request->app_code().empty() ? "*" : request->app_code())
+              << " from_seq=" << request->from_seq() << " head_seq=" << head_seq
+              << " from=" << bcntl->remote_side();
+}
+
+std::shared_ptr<const HandleCatalog::Snapshot> AuthServiceImpl::Handles() {
+    // 第一次使用句柄接口时才启动后台刷新，未使用该功能的部署不会定期全量加载
+    std::call_once(handles_started_, [this] {
+        handles_.StartRefresh(dao_.get(), kHandleRefreshInterval, kHandleRetryInterval);
+    });
+    return handles_.Get();
+}
+
+const HandleCatalog::App* AuthServiceImpl::FindCurrentApp(const HandleCatalog::Snapshot& snapshot,
+                                                          uint64_t app_handle,
+                                                          uint64_t client_version) {
+    const HandleCatalog::App* app = snapshot.FindApp(app_handle);
+    if (!app || app->version != client_version) {
+        // 客户端可能在更新的副本上解析过，或本地目录尚未加载：不在 worker 上查库，通知后台线程尽快重新加载
+        handles_.RequestReload();
+        return nullptr;
+    }
+    return app;
+}
+
+int AuthServiceImpl::TestCachedBit(const HandleCatalog::App& app,
+                                   const std::string& user_id,
+                                   uint32_t bit) {
+    if (!cache_) {
+        return -1;
+    }
+    int result = -1;
+    cache_->Visit(app.app_code + ":" + user_id, [&](CachedPerms& cached) {
+        if (cached.bits_version != app.version) {
+            // 条目由 Check 写入或来自旧目录：用权限 key 重新生成位图，之后的 CheckById 只做位运算
+            cached.bits.assign((app.perm_count + 63) / 64, 0);
+            for (const auto& key : cached.keys) {
+                auto it = app.perm_handles.find(key);
+                if (it != app.perm_handles.end()) {
+                    HandleCatalog::SetBit(cached.bits, it->second - 1);
+                }
+            }
+            cached.bits_version = app.version;
+        }
+        result = HandleCatalog::TestBit(cached.bits, bit) ? 1 : 0;
+    });
+    metrics_.RecordCacheLookup(result >= 0);
+    return result;
+}
+
+CachedPerms AuthServiceImpl::LoadUserPerms(const HandleCatalog::App& app,
+                                           const std::string& user_id) {
+    CachedPerms cached;
+    cached.bits.assign((app.perm_count + 63) / 64, 0);
+    cached.bits_version = app.version;
+    const int64_t load_start_us = butil::cpuwide_time_us();
+    auto perms = dao_->getUserPermissions(app.app_code, user_id);
+    metrics_.RecordMissLoad(butil::cpuwide_time_us() - load_start_us);
+    for (const auto& p : perms) {
+        auto it = app.perm_handles.find(p.first);
+        if (it != app.perm_handles.end()) {
+            HandleCatalog::SetBit(cached.bits, it->second - 1);
+        }
+        cached.keys.insert(p.first);
+    }
+    if (cache_) {
+        cache_->Put(app.app_code + ":" + user_id, cached, cache_ttl_);
+    }
+    return cached;
+}
+
+void AuthServiceImpl::ResolveHandles(google::protobuf::RpcController* cntl,
+                                     const siqi::auth::ResolveHandlesRequest* request,
+                                     siqi::auth::ResolveHandlesResponse* response,
+                                     google::protobuf::Closure* done) {
+    brpc::ClosureGuard done_guard(done);
+
+    if (request->app_code().empty()) {
+        response->set_success(false);
+        response->set_message("缺少 app_code");
+        return;
+    }
+
+    std::shared_ptr<const HandleCatalog::Snapshot> snapshot = Handles();
+    auto resolvable = [&request](const HandleCatalog::Snapshot& snap) {
+        const HandleCatalog::App* app = snap.FindApp(request->app_code());
+        if (!app) {
+            return false;
+        }
+        for (const auto& key : request->perm_keys()) {
+            if (app->perm_handles.count(key) == 0) {
+                return false;
+            }
+        }
+        return true;
+    };
+    // 有未知的应用或权限：可能刚刚创建，重新加载一次再回答（每秒最多一次，只在解析时发生，不在 CheckById 路径上）
+    if (!resolvable(*snapshot)) {
+        handles_.MaybeReload(*dao_, kHandleRetryInterval, true);
+        snapshot = handles_.Get();
+    }
+    if (!snapshot->loaded) {
+        response->set_success(false);
+        response->set_message("句柄目录尚未加载: " + dao_->getLastError());
+        return;
+    }
+    auto app_it = snapshot->app_handles.find(request->app_code());
+    if (app_it == snapshot->app_handles.end()) {
+        response->set_success(false);
+        response->set_message("应用不存在");
+        return;
+    }
+    const HandleCatalog::App& app = snapshot->apps[app_it->second - 1];
+
+    response->set_success(true);
+    response->set_catalog_version(app.version);
+    response->set_app_id(app_it->second);
+    if (request->perm_keys_size() == 0) {
+        std::vector<std::pair<uint32_t, std::string>> all;
+        for (const auto& kv : app.perm_handles) {
+            all.emplace_back(kv.second, kv.first);
+        }
+        std::sort(all.begin(), all.end());
+        for (const auto& p : all) {
+            response->add_perm_keys(p.second);
+            response->add_perm_ids(p.first);
+        }
+        return;
+    }
+    for (const auto& key : request->perm_keys()) {
+        auto it = app.perm_handles.find(key);
+        response->add_perm_keys(key);
+        response->add_perm_ids(it == app.perm_handles.end() ? 0 : it->second);
+    }
+}
+
+void AuthServiceImpl::CheckById(google::protobuf::RpcController* cntl,
+                                const siqi::auth::CheckByIdRequest* request,
+                                siqi::auth::CheckByIdResponse* response,
+                                google::protobuf::Closure* done) {
+    brpc::ClosureGuard done_guard(done);
+
+    std::shared_ptr<const HandleCatalog::Snapshot> snapshot = Handles();
+    const HandleCatalog::App* app = FindCurrentApp(*snapshot, request->app_id(), request->catalog_version());
+    if (!app) {
+        const HandleCatalog::App* current = snapshot->FindApp(request->app_id());
+        response->set_catalog_version(current ? current->version : 0);
+        response->set_code(ESTALE);
+        return;
+    }
+    response->set_catalog_version(app->version);
+    uint32_t bit = 0;
+    if (!HandleCatalog::PermBit(*app, request->perm_id(), bit) || request->user_id().empty()) {
+        response->set_code(EINVAL);
+        return;
+    }
+
+    int cached = TestCachedBit(*app, request->user_id(), bit);
+    if (cached >= 0) {
+        response->set_allowed(cached == 1);
+        return;
+    }
+
+    // 未命中：与 Check 一样，异步模式下把查库交给 DB 执行器
+    if (db_executor_) {
+        google::protobuf::Closure* async_done = done_guard.release();
+        bool submitted = db_executor_->Submit([this, snapshot, app, bit, request, response, async_done]() {
+            brpc::ClosureGuard async_guard(async_done);
+            CachedPerms loaded = LoadUserPerms(*app, request->user_id());
+            response->set_allowed(HandleCatalog::TestBit(loaded.bits, bit));
+        });
+        if (submitted) {
+            return;
+        }
+        done_guard.reset(async_done);
+    }
+    CachedPerms loaded = LoadUserPerms(*app, request->user_id());
+    response->set_allowed(HandleCatalog::TestBit(loaded.bits, bit));
+}
+
+void AuthServiceImpl::BatchCheckById(google::protobuf::RpcController* cntl,
+                                     const siqi::auth::BatchCheckByIdRequest* request,
+                                     siqi::auth::BatchCheckByIdResponse* response,
+                                     google::protobuf::Closure* done) {
+    brpc::ClosureGuard done_guard(done);
+
+    std::shared_ptr<const HandleCatalog::Snapshot> snapshot = Handles();
+    const HandleCatalog::App* app = FindCurrentApp(*snapshot, request->app_id(), request->catalog_version());
+    if (!app) {
+        const HandleCatalog::App* current = snapshot->FindApp(request->app_id());
+        response->set_catalog_version(current ? current->version : 0);
+        response->set_code(ESTALE);
+        return;
+    }
+    response->set_catalog_version(app->version);
+    if (request->user_ids_size() == 0 || request->user_ids_size() != request->perm_ids_size()) {
+        response->set_code(EINVAL);
+        return;
+    }
+
+    // 先全部查缓存，只有未命中的用户需要查库；不属于该应用的权限句柄直接判定为拒绝
+    response->mutable_allowed()->Resize(request->user_ids_size(), false);
+    std::vector<int> missing;
+    for (int i = 0; i < request->user_ids_size(); ++i) {
+        uint32_t bit = 0;
+        if (!HandleCatalog::PermBit(*app, request->perm_ids(i), bit)) {
+            continue;
+        }
+        int cached = TestCachedBit(*app, request->user_ids(i), bit);
+        if (cached < 0) {
+            missing.push_back(i);
+        } else {
+            response->set_allowed(i, cached == 1);
+        }
+    }
+    if (missing.empty()) {
+        return;
+    }
+
+    if (db_executor_) {
+        google::protobuf::Closure* async_done = done_guard.release();
+        bool submitted = db_executor_->Submit([this, snapshot, app, request, response, missing, async_done]() {
+            brpc::ClosureGuard async_guard(async_done);
+            ProcessBatchCheckById(snapshot, app, request, response, missing);
+        });
+        if (submitted) {
+            return;
+        }
+        done_guard.reset(async_done);
+    }
+    ProcessBatchCheckById(snapshot, app, request, response, missing);
+}
+
+void AuthServiceImpl::ProcessBatchCheckById(std::shared_ptr<const HandleCatalog::Snapshot> snapshot,
+                                            const HandleCatalog::App* app,
+                                            const siqi::auth::BatchCheckByIdRequest* request,
+                                            siqi::auth::BatchCheckByIdResponse* response,
+                                            const std::vector<int>& missing) {
+    // 同一用户在一批中可能出现多次，只查一次库
+    std::unordered_map<std::string, std::vector<uint64_t>> loaded;
+    for (int i : missing) {
+        const std::string& user_id = request->user_ids(i);
+        auto it = loaded.find(user_id);
+        if (it == loaded.end()) {
+            it = loaded.emplace(user_id, LoadUserPerms(*app, user_id).bits).first;
+        }
+        uint32_t bit = 0;
+        HandleCatalog::PermBit(*app, request->perm_ids(i), bit);
+        response->set_allowed(i, HandleCatalog::TestBit(it->second, bit));
+    }
 }
 
 bool AuthServiceImpl::isReady() const {
-    return dao_.isConnected();
+    return dao_->isConnected();
 }
\ No newline at end of file
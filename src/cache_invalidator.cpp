@@ -0,0 +1,334 @@
+#include "cache_invalidator.h"
+#include <brpc/controller.h>
+#include <butil/logging.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+namespace {
+
+const int kMaxBackoffMs = 10000;
+
+// 签名覆盖的规范化内容：各字段按固定顺序拼接，字符串带长度前缀，避免拼接歧义
+std::string SigningPayload(const siqi::auth::InvalidateRequest& request) {
+    std::string out = "inv1";
+    auto append = [&out](const std::string& s) {
+        out.append(std::to_string(s.size())).append(1, ':').append(s);
+    };
+    auto append_all = [&out, &append](const google::protobuf::RepeatedPtrField<std::string>& items) {
+        out.append(std::to_string(items.size())).append(1, '#');
+        for (const auto& s : items) append(s);
+    };
+    append(request.origin());
+    append(std::to_string(request.seq()));
+    append(std::to_string(request.sent_at_ms()));
+    append(request.clear_all() ? "1" : "0");
+    append_all(request.keys());
+    append_all(request.prefixes());
+    append_all(request.app_codes());
+    return out;
+}
+
+int64_t NowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+CacheInvalidator::CacheInvalidator(std::shared_ptr<PermCache> cache,
+                                   std::shared_ptr<AppCatalog> catalog,
+                                   const Options& options,
+                                   std::shared_ptr<ReadFence> read_fence)
+    : cache_(cache), catalog_(catalog), read_fence_(read_fence), options_(options) {
+    options_.max_batch = std::max<size_t>(options_.max_batch, 1);
+    if (!options_.key.empty()) {
+        signer_.reset(new SessionTokenSigner(options_.key));
+    }
+    for (const auto& addr : options_.peers) {
+        if (addr.empty() || addr == options_.self) {
+            continue;
+        }
+        Peer peer;
+        peer.addr = addr;
+        peer.channel.reset(new brpc::Channel());
+        brpc::ChannelOptions channel_options;
+        channel_options.protocol = "baidu_std";
+        channel_options.timeout_ms = options_.rpc_timeout_ms;
+        channel_options.max_retry = 0;  // 由本类统一退避重试
+        if (peer.channel->Init(addr.c_str(), &channel_options) != 0) {
+            LOG(ERROR) << "缓存失效对端地址无效，已忽略: " << addr;
+            continue;
+        }
+        peers_.push_back(std::move(peer));
+    }
+    if (!peers_.empty()) {
+        worker_ = std::thread(&CacheInvalidator::Loop, this);
+        LOG(INFO) << "集群缓存失效已开启，对端数: " << peers_.size();
+    }
+}
+
+CacheInvalidator::~CacheInvalidator() {
+    Stop();
+}
+
+void CacheInvalidator::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopped_) return;
+        stopped_ = true;
+    }
+    cond_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+void CacheInvalidator::InvalidateKey(const std::string& key) {
+    Pending batch;
+    batch.keys.insert(key);
+    Apply(batch);
+    Broadcast(batch);
+}
+
+void CacheInvalidator::InvalidateKeys(const std::vector<std::string>& keys) {
+    Pending batch;
+    batch.keys.insert(keys.begin(), keys.end());
+    Apply(batch);
+    Broadcast(batch);
+}
+
+void CacheInvalidator::InvalidatePrefix(const std::string& prefix) {
+    Pending batch;
+    batch.prefixes.insert(prefix);
+    Apply(batch);
+    Broadcast(batch);
+}
+
+void CacheInvalidator::InvalidateApp(const std::string& app_code) {
+    Pending batch;
+    batch.apps.insert(app_code);
+    batch.prefixes.insert(app_code + ":");
+    Apply(batch);
+    Broadcast(batch);
+}
+
+size_t CacheInvalidator::PendingSize() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t total = 0;
+    for (const auto& peer : peers_) {
+        total += peer.pending.Size();
+    }
+    return total;
+}
+
+void CacheInvalidator::Invalidate(google::protobuf::RpcController* cntl_base,
+                                  const siqi::auth::InvalidateRequest* request,
+                                  siqi::auth::InvalidateResponse* response,
+                                  google::protobuf::Closure* done) {
+    brpc::ClosureGuard done_guard(done);
+    brpc::Controller* cntl = static_cast<brpc::Controller*>(cntl_base);
+
+    if (!signer_ || !signer_->VerifyMac(SigningPayload(*request), request->mac())) {
+        LOG_EVERY_SECOND(WARNING) << "拒绝未签名或签名错误的缓存失效推送，来源 " << cntl->remote_side()
+                                  << " origin=" << request->origin();
+        response->set_success(false);
+        response->set_message("invalid cluster signature");
+        return;
+    }
+    if (std::llabs(NowMs() - request->sent_at_ms()) > options_.max_clock_skew_ms) {
+        LOG_EVERY_SECOND(WARNING) << "拒绝过期的缓存失效推送 #" << request->seq() << "，origin=" << request->origin();
+        response->set_success(false);
+        response->set_message("stale cluster request");
+        return;
+    }
+
+    Pending batch;
+    batch.clear_all = request->clear_all();
+    batch.keys.insert(request->keys().begin(), request->keys().end());
+    batch.prefixes.insert(request->prefixes().begin(), request->prefixes().end());
+    batch.apps.insert(request->app_codes().begin(), request->app_codes().end());
+    Apply(batch);
+
+    VLOG(1) << "Applied invalidation #" << request->seq() << " from " << request->origin()
+            << ": keys=" << batch.keys.size() << " prefixes=" << batch.prefixes.size()
+            << " apps=" << batch.apps.size() << (batch.clear_all ? " clear_all" : "");
+    response->set_success(true);
+}
+
+void CacheInvalidator::Apply(const Pending& batch) {
+    // 先登记栅栏再清缓存：清掉之后的第一次未命中必须已经能看到栅栏
+    if (read_fence_) {
+        if (batch.clear_all) {
+            read_fence_->MarkAll();
+        }
+        for (const auto& key : batch.keys) {
+            read_fence_->MarkKey(key);
+        }
+        for (const auto& prefix : batch.prefixes) {
+            read_fence_->MarkPrefix(prefix);
+        }
+    }
+    if (batch.clear_all) {
+        if (cache_) cache_->Clear();
+        // 清空后按需回源加载（PermissionDAO::getAppId 未命中时会查库补齐）
+        if (catalog_) catalog_->Reset({});
+        return;
+    }
+    if (cache_) {
+        if (!batch.keys.empty()) {
+            cache_->InvalidateKeys(std::vector<std::string>(batch.keys.begin(), batch.keys.end()));
+        }
+        for (const auto& prefix : batch.prefixes) {
+            cache_->InvalidatePrefix(prefix);
+        }
+    }
+    if (catalog_) {
+        for (const auto& app_code : batch.apps) {
+            catalog_->Erase(app_code);
+        }
+    }
+}
+
+void CacheInvalidator::Broadcast(const Pending& batch) {
+    if (peers_.empty()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& peer : peers_) {
+            Merge(peer.pending, batch);
+        }
+    }
+    // 不唤醒后台线程：由它每隔 flush_interval_ms 统一推送，期间的失效项自然合并成一批
+}
+
+void CacheInvalidator::Merge(Pending& into, const Pending& from) const {
+    if (into.clear_all) {
+        return;
+    }
+    if (from.clear_all) {
+        into = Pending();
+        into.clear_all = true;
+        return;
+    }
+    into.keys.insert(from.keys.begin(), from.keys.end());
+    into.prefixes.insert(from.prefixes.begin(), from.prefixes.end());
+    into.apps.insert(from.apps.begin(), from.apps.end());
+    if (into.Size() > options_.max_pending) {
+        // 对端长时间不可达：不再逐项保留，恢复后让它整体清空一次
+        into = Pending();
+        into.clear_all = true;
+    }
+}
+
+void CacheInvalidator::Take(Pending& pending, siqi::auth::InvalidateRequest& request, Pending& taken) const {
+    if (pending.clear_all) {
+        request.set_clear_all(true);
+        taken.clear_all = true;
+        pending = Pending();
+        return;
+    }
+    // 应用与前缀优先：它们覆盖面大，尽早送达
+    size_t budget = options_.max_batch;
+    auto move = [&budget](std::unordered_set<std::string>& from,
+                          std::unordered_set<std::string>& to,
+                          google::protobuf::RepeatedPtrField<std::string>* field) {
+        for (auto it = from.begin(); it != from.end() && budget > 0; --budget) {
+            field->Add()->assign(*it);
+            to.insert(*it);
+            it = from.erase(it);
+        }
+    };
+    move(pending.apps, taken.apps, request.mutable_app_codes());
+    move(pending.prefixes, taken.prefixes, request.mutable_prefixes());
+    move(pending.keys, taken.keys, request.mutable_keys());
+}
+
+void CacheInvalidator::SendRound(bool force) {
+    struct Call {
+        size_t peer;
+        Pending taken;
+        siqi::auth::InvalidateRequest request;
+        siqi::auth::InvalidateResponse response;
+        brpc::Controller cntl;
+    };
+    std::vector<std::unique_ptr<Call>> calls;
+
+    auto now = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t i = 0; i < peers_.size(); ++i) {
+            Peer& peer = peers_[i];
+            if (peer.pending.Empty() || (!force && now < peer.next_attempt)) {
+                continue;
+            }
+            std::unique_ptr<Call> call(new Call());
+            call->peer = i;
+            call->request.set_origin(options_.self);
+            call->request.set_seq(++seq_);
+            Take(peer.pending, call->request, call->taken);
+            call->request.set_sent_at_ms(NowMs());
+            if (signer_) {
+                call->request.set_mac(signer_->Mac(SigningPayload(call->request)));
+            }
+            calls.push_back(std::move(call));
+        }
+    }
+    if (calls.empty()) {
+        return;
+    }
+
+    // 并发推送给所有对端，再统一等待
+    for (auto& call : calls) {
+        siqi::auth::ClusterService_Stub stub(peers_[call->peer].channel.get());
+        stub.Invalidate(&call->cntl, &call->request, &call->response, brpc::DoNothing());
+    }
+    for (auto& call : calls) {
+        brpc::Join(call->cntl.call_id());
+    }
+
+    now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& call : calls) {
+        Peer& peer = peers_[call->peer];
+        bool ok = !call->cntl.Failed() && call->response.success();
+        if (ok) {
+            if (peer.failures > 0) {
+                LOG(INFO) << "缓存失效对端已恢复: " << peer.addr << "，此前连续失败 " << peer.failures << " 次";
+            }
+            peer.failures = 0;
+            peer.next_attempt = now;
+            continue;
+        }
+        // 失败：放回待发送集合，指数退避
+        Merge(peer.pending, call->taken);
+        ++peer.failures;
+        int shift = std::min(peer.failures - 1, 16);
+        int backoff_ms = static_cast<int>(std::min<int64_t>(
+            static_cast<int64_t>(options_.retry_backoff_ms) << shift, kMaxBackoffMs));
+        peer.next_attempt = now + std::chrono::milliseconds(backoff_ms);
+        if (peer.failures == 1 || peer.failures % 10 == 0) {
+            LOG(WARNING) << "推送缓存失效到 " << peer.addr << " 失败 (第 " << peer.failures << " 次): "
+                         << (call->cntl.Failed() ? call->cntl.ErrorText() : call->response.message())
+                         << "，" << backoff_ms << "ms 后重试";
+        }
+    }
+}
+
+void CacheInvalidator::Loop() {
+    while (true) {
+        bool stopping;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cond_.wait_for(lock, std::chrono::milliseconds(options_.flush_interval_ms));
+            stopping = stopped_;
+        }
+        if (stopping) {
+            // 退出前忽略退避再推送一次，尽量不让其他副本留下旧缓存
+            SendRound(true);
+            return;
+        }
+        SendRound(false);
+    }
+}
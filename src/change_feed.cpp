@@ -0,0 +1,398 @@
+#include "change_feed.h"
+#include <butil/iobuf.h>
+#include <butil/logging.h>
+#include <algorithm>
+#include <cerrno>
+#include <ctime>
+
+namespace {
+
+// 单轮最多连续拉取的批数，避免批量授权产生的大量事件长时间占住后台线程
+const int kMaxFetchRounds = 20;
+const size_t kPurgeChunkRows = 10000;
+
+} // namespace
+
+ChangeFeed::ChangeFeed(PermissionStore* dao, const Options& options)
+    : dao_(dao), options_(options) {
+    options_.ring_capacity = std::max<size_t>(options_.ring_capacity, 1);
+    options_.fetch_batch = std::max<size_t>(options_.fetch_batch, 1);
+    options_.max_events_per_write = std::max<size_t>(options_.max_events_per_write, 1);
+    if (options_.enabled) {
+        worker_ = std::thread(&ChangeFeed::Loop, this);
+    }
+}
+
+ChangeFeed::~ChangeFeed() {
+    Stop();
+}
+
+void ChangeFeed::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(loop_mutex_);
+        if (stopped_) return;
+        stopped_ = true;
+    }
+    loop_cond_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& kv : watchers_) {
+        brpc::StreamClose(kv.first);
+    }
+    watchers_.clear();
+}
+
+bool ChangeFeed::Subscribe(brpc::Controller* cntl,
+                           const std::string& app_code,
+                           uint64_t from_seq,
+                           uint64_t* head_seq,
+                           std::string* error) {
+    if (!options_.enabled) {
+        *error = "服务端未开启变更推送 (--watch_enabled)";
+        return false;
+    }
+
+    uint64_t head = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!initialized_) {
+            *error = "变更日志尚未就绪，请稍后重试";
+            return false;
+        }
+        head = head_;
+    }
+    // 断点比本副本已知的还新：可能是从进度更快的副本切换过来（正常续传即可），
+    // 也可能是变更日志被重建过（断点已无意义，需要 SNAPSHOT）
+    bool reset = false;
+    if (from_seq > head) {
+        int64_t min_seq = 0;
+        int64_t max_seq = 0;
+        reset = dao_->getChangeSeqRange(min_seq, max_seq) && from_seq > static_cast<uint64_t>(max_seq);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (watchers_.size() >= options_.max_watchers) {
+        *error = "订阅数已达上限";
+        return false;
+    }
+
+    brpc::StreamOptions stream_options;
+    stream_options.handler = this;
+    stream_options.max_buf_size = options_.stream_buf_size;
+    brpc::StreamId stream;
+    if (brpc::StreamAccept(&stream, *cntl, &stream_options) != 0) {
+        *error = "请求未携带 Stream，请先调用 brpc::StreamCreate";
+        return false;
+    }
+
+    Watcher watcher;
+    watcher.app_code = app_code;
+    watcher.last_write = Clock::now();
+    if (from_seq == 0 || reset) {
+        watcher.sent_seq = head_;
+        watcher.need_snapshot = reset;
+    } else {
+        watcher.sent_seq = from_seq;
+    }
+    watchers_[stream] = watcher;
+    *head_seq = head_;
+    return true;
+}
+
+uint64_t ChangeFeed::HeadSeq() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return head_;
+}
+
+size_t ChangeFeed::WatcherCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return watchers_.size();
+}
+
+int ChangeFeed::on_received_messages(brpc::StreamId id, butil::IOBuf* const messages[], size_t size) {
+    return 0;
+}
+
+void ChangeFeed::on_idle_timeout(brpc::StreamId id) {
+}
+
+void ChangeFeed::on_closed(brpc::StreamId id) {
+    std::lock_guard<std::mutex> lock(closed_mutex_);
+    closed_.push_back(id);
+}
+
+void ChangeFeed::Loop() {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(loop_mutex_);
+            if (loop_cond_.wait_for(lock, std::chrono::milliseconds(options_.poll_interval_ms),
+                                    [this] { return stopped_; })) {
+                break;
+            }
+        }
+        if (!initialized_ && !Init()) {
+            continue;
+        }
+        Poll();
+        Dispatch();
+        Purge();
+    }
+}
+
+bool ChangeFeed::Init() {
+    // 从当前最新位置开始；更早的事件在订阅者续传时按需从变更日志读取
+    int64_t min_seq = 0;
+    int64_t max_seq = 0;
+    if (!dao_->getChangeSeqRange(min_seq, max_seq)) {
+        if (!fetch_failed_) {
+            LOG(ERROR) << "读取变更日志失败，Watch 暂不可用 (参见 scripts/init.sql 中的 sys_change_log): "
+                       << dao_->getLastError();
+            fetch_failed_ = true;
+        }
+        return false;
+    }
+    fetch_failed_ = false;
+    last_purge_ = Clock::now() - std::chrono::hours(1);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    head_ = floor_ = static_cast<uint64_t>(max_seq);
+    initialized_ = true;
+    LOG(INFO) << "变更推送已就绪，当前序号: " << head_;
+    return true;
+}
+
+void ChangeFeed::Poll() {
+    uint64_t head = HeadSeq();
+    for (int round = 0; round < kMaxFetchRounds; ++round) {
+        std::vector<PermissionStore::ChangeEvent> fetched;
+        if (!dao_->fetchChangeEvents(static_cast<int64_t>(head), options_.fetch_batch, fetched)) {
+            if (!fetch_failed_) {
+                LOG(WARNING) << "拉取变更日志失败: " << dao_->getLastError();
+                fetch_failed_ = true;
+            }
+            return;
+        }
+        if (fetch_failed_) {
+            LOG(INFO) << "变更日志拉取已恢复";
+            fetch_failed_ = false;
+        }
+
+        // 只接收连续的序号；遇到空洞时等待它被填上，超时后才跳过
+        auto now = Clock::now();
+        std::vector<PermissionStore::ChangeEvent> accepted;
+        for (auto& ev : fetched) {
+            uint64_t seq = static_cast<uint64_t>(ev.seq);
+            if (seq != head + 1) {
+                if (gap_head_ != head) {
+                    gap_head_ = head;
+                    gap_since_ = now;
+                }
+                if (now - gap_since_ < std::chrono::milliseconds(options_.gap_timeout_ms)) {
+                    break;
+                }
+            }
+            head = seq;
+            accepted.push_back(std::move(ev));
+        }
+        if (accepted.empty()) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto& ev : accepted) {
+                ring_.push_back(std::move(ev));
+            }
+            head_ = head;
+            while (ring_.size() > options_.ring_capacity) {
+                floor_ = static_cast<uint64_t>(ring_.front().seq);
+                ring_.pop_front();
+            }
+        }
+        if (fetched.size() < options_.fetch_batch || accepted.size() < fetched.size()) {
+            return;
+        }
+    }
+}
+
+void ChangeFeed::Dispatch() {
+    std::vector<brpc::StreamId> closed;
+    {
+        std::lock_guard<std::mutex> lock(closed_mutex_);
+        closed.swap(closed_);
+    }
+
+    std::vector<ReplayTask> replay;
+    auto now = Clock::now();
+    const auto heartbeat = std::chrono::milliseconds(options_.heartbeat_interval_ms);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (brpc::StreamId id : closed) {
+            watchers_.erase(id);
+        }
+
+        for (auto it = watchers_.begin(); it != watchers_.end();) {
+            Watcher& watcher = it->second;
+            siqi::auth::WatchEvents msg;
+            uint64_t covered = watcher.sent_seq;
+
+            if (watcher.need_snapshot) {
+                msg = SnapshotMessage(watcher.app_code, head_);
+                covered = head_;
+            } else if (watcher.sent_seq < floor_) {
+                // 已滑出内存环，交给 Replay 从变更日志补发（不持锁查库）
+                replay.push_back(ReplayTask{it->first, watcher.app_code, watcher.sent_seq});
+                ++it;
+                continue;
+            } else if (watcher.sent_seq < head_) {
+                auto pos = std::upper_bound(ring_.begin(), ring_.end(), watcher.sent_seq,
+                                            [](uint64_t seq, const PermissionStore::ChangeEvent& ev) {
+                                                return seq < static_cast<uint64_t>(ev.seq);
+                                            });
+                for (; pos != ring_.end() &&
+                       static_cast<size_t>(msg.events_size()) < options_.max_events_per_write; ++pos) {
+                    covered = static_cast<uint64_t>(pos->seq);
+                    if (Matches(watcher.app_code, *pos)) {
+                        ToProto(*pos, msg.add_events());
+                    }
+                }
+                if (pos == ring_.end()) {
+                    covered = head_;
+                }
+            }
+
+            if (msg.events_size() == 0 && now - watcher.last_write < heartbeat) {
+                // 只有其他应用的事件：直接前移断点，等下一次心跳再告知订阅方
+                watcher.sent_seq = covered;
+                ++it;
+                continue;
+            }
+
+            msg.set_head_seq(covered);
+            int rc = Write(it->first, msg);
+            if (rc == 0) {
+                watcher.sent_seq = covered;
+                watcher.need_snapshot = false;
+                watcher.last_write = now;
+            } else if (rc != EAGAIN) {
+                // 流已关闭或出错
+                brpc::StreamClose(it->first);
+                it = watchers_.erase(it);
+                continue;
+            }
+            // EAGAIN：订阅方消费太慢，断点不动，下一轮再补发
+            ++it;
+        }
+    }
+
+    if (!replay.empty()) {
+        Replay(replay);
+    }
+}
+
+void ChangeFeed::Replay(const std::vector<ReplayTask>& tasks) {
+    int64_t min_seq = 0;
+    int64_t max_seq = 0;
+    if (!dao_->getChangeSeqRange(min_seq, max_seq)) {
+        return;
+    }
+    const uint64_t head = HeadSeq();
+
+    for (const auto& task : tasks) {
+        siqi::auth::WatchEvents msg;
+        uint64_t covered = task.sent_seq;
+        // 断点之后的日志可能已被清理，或者落后太多，回放代价不如让订阅方重建
+        bool purged = min_seq > 0 && task.sent_seq + 1 < static_cast<uint64_t>(min_seq);
+        if (purged || head - task.sent_seq > options_.max_replay) {
+            msg = SnapshotMessage(task.app_code, head);
+            covered = head;
+        } else {
+            std::vector<PermissionStore::ChangeEvent> events;
+            if (!dao_->fetchChangeEvents(static_cast<int64_t>(task.sent_seq), options_.max_events_per_write, events)) {
+                return;
+            }
+            for (const auto& ev : events) {
+                covered = static_cast<uint64_t>(ev.seq);
+                if (Matches(task.app_code, ev)) {
+                    ToProto(ev, msg.add_events());
+                }
+            }
+            if (covered == task.sent_seq) {
+                continue;
+            }
+        }
+        msg.set_head_seq(covered);
+
+        int rc = Write(task.stream, msg);
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = watchers_.find(task.stream);
+        if (it == watchers_.end()) {
+            continue;
+        }
+        if (rc == 0) {
+            it->second.sent_seq = covered;
+            it->second.need_snapshot = false;
+            it->second.last_write = Clock::now();
+        } else if (rc != EAGAIN) {
+            brpc::StreamClose(task.stream);
+            watchers_.erase(it);
+        }
+    }
+}
+
+void ChangeFeed::Purge() {
+    if (options_.retention_hours <= 0) {
+        return;
+    }
+    auto now = Clock::now();
+    if (now - last_purge_ < std::chrono::hours(1)) {
+        return;
+    }
+    last_purge_ = now;
+
+    // 多个副本可能同时清理，DELETE 是幂等的
+    int64_t total = 0;
+    int64_t n = 0;
+    do {
+        n = dao_->purgeChangeEvents(options_.retention_hours, kPurgeChunkRows);
+        if (n > 0) total += n;
+    } while (n == static_cast<int64_t>(kPurgeChunkRows));
+    if (n < 0) {
+        LOG(WARNING) << "清理变更日志失败: " << dao_->getLastError();
+    } else if (total > 0) {
+        LOG(INFO) << "已清理 " << total << " 条超过 " << options_.retention_hours << " 小时的变更日志";
+    }
+}
+
+void ChangeFeed::ToProto(const PermissionStore::ChangeEvent& ev, siqi::auth::ChangeEvent* out) {
+    out->set_seq(static_cast<uint64_t>(ev.seq));
+    out->set_app_code(ev.app_code);
+    out->set_type(static_cast<siqi::auth::ChangeEvent::Type>(ev.type));
+    out->set_user_id(ev.user_id);
+    out->set_role_key(ev.role_key);
+    out->set_perm_key(ev.perm_key);
+    out->set_timestamp(ev.timestamp);
+}
+
+siqi::auth::WatchEvents ChangeFeed::SnapshotMessage(const std::string& app_code, uint64_t seq) {
+    siqi::auth::WatchEvents msg;
+    siqi::auth::ChangeEvent* ev = msg.add_events();
+    ev->set_seq(seq);
+    ev->set_app_code(app_code);
+    ev->set_type(siqi::auth::ChangeEvent::SNAPSHOT);
+    ev->set_timestamp(time(nullptr));
+    return msg;
+}
+
+int ChangeFeed::Write(brpc::StreamId stream, const siqi::auth::WatchEvents& msg) {
+    std::string data;
+    if (!msg.SerializeToString(&data)) {
+        return EINVAL;
+    }
+    butil::IOBuf buf;
+    buf.append(data);
+    return brpc::StreamWrite(stream, buf);
+}
@@ -1,75 +1,63 @@
-#include <brpc/channel.h>
 #include <gflags/gflags.h>
-#include "auth.pb.h"
-#include <memory>
+#include "auth_client.h"
+#include <algorithm>
 #include <iostream>
+#include <thread>
+#include <vector>
 
-DEFINE_string(server, "127.0.0.1:8888", "Server Address");
+DEFINE_string(server, "127.0.0.1:8888", "Server Address, empty = local auth_agent (Unix Domain Socket when available)");
 DEFINE_string(app, "qq_bot", "App code");
 DEFINE_string(user, "123456", "User ID");
 DEFINE_string(perm, "member:kick", "Permission Key");
-
-class AuthClient {
-private:
-    std::unique_ptr<brpc::Channel> channel_;
-    std::unique_ptr<siqi::auth::AuthService_Stub> stub_;
-    
-public:
-    AuthClient(const std::string& server_addr) {
-        brpc::ChannelOptions options;
-        options.timeout_ms = 1000;
-        options.connect_timeout_ms = 3000;
-        
-        channel_ = std::make_unique<brpc::Channel>();
-        if (channel_->Init(server_addr.c_str(), &options) != 0) {
-            throw std::runtime_error("连接权限系统失败");
-        }
-        
-        stub_ = std::make_unique<siqi::auth::AuthService_Stub>(channel_.get());
-    }
-    
-    bool Check(const std::string& app_code, 
-               const std::string& user_id, 
-               const std::string& perm_key) {
-        siqi::auth::CheckRequest request;
-        request.set_app_code(app_code);
-        request.set_user_id(user_id);
-        request.set_perm_key(perm_key);
-        
-        siqi::auth::CheckResponse response;
-        brpc::Controller cntl;
-        
-        stub_->Check(&cntl, &request, &response, NULL);
-        
-        if (cntl.Failed()) {
-            std::cerr << "RPC Failed: " << cntl.ErrorText() << std::endl;
-            return false;
-        }
-        
-        if (!response.reason().empty()) {
-            std::cout << "Reason: " << response.reason() << std::endl;
-        }
-
-        return response.allowed();
-    }
-};
+DEFINE_int32(concurrency, 1, "Concurrent checks issued at once, to show request coalescing and batching");
+DEFINE_bool(watch, false, "Subscribe to permission change pushes and keep re-checking until interrupted");
 
 int main(int argc, char* argv[]) {
     gflags::ParseCommandLineFlags(&argc, &argv, true);
-    
+
     try {
-        AuthClient client(FLAGS_server);
-        bool allowed = client.Check(FLAGS_app, FLAGS_user, FLAGS_perm);
-        
-        if (allowed) {
+        AuthClient::Options options;
+        options.server = FLAGS_server;
+        options.watch = FLAGS_watch;
+        options.watch_app_code = FLAGS_app;
+        AuthClient client(options);
+
+        // 同时发起多个相同的检查：只会产生一次 RPC，其余合并到进行中的请求上
+        std::vector<std::future<AuthClient::Result>> futures;
+        for (int i = 0; i < std::max(FLAGS_concurrency, 1); ++i) {
+            futures.push_back(client.CheckAsync(FLAGS_app, FLAGS_user, FLAGS_perm));
+        }
+        AuthClient::Result result;
+        for (auto& f : futures) {
+            result = f.get();
+        }
+
+        if (!result.ok) {
+            std::cerr << "RPC Failed: " << result.error << std::endl;
+        }
+        if (result.allowed) {
             std::cout << "✅ 允许访问 [ALLOWED]" << std::endl;
         } else {
             std::cout << "❌ 拒绝访问 [DENIED]" << std::endl;
         }
+
+        // 订阅模式：每秒复查一次，命中缓存时不产生 RPC；管理后台修改权限后结论随推送立即变化
+        while (FLAGS_watch) {
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+            AuthClient::Result r = client.Check(FLAGS_app, FLAGS_user, FLAGS_perm);
+            AuthClient::Stats stats = client.GetStats();
+            std::cout << (r.allowed ? "ALLOWED" : "DENIED ") << "  rpcs=" << stats.rpcs
+                      << " cache_hits=" << stats.cache_hits << " head_seq=" << stats.head_seq
+                      << (stats.watching ? "" : " (reconnecting)") << std::endl;
+        }
+
+        AuthClient::Stats stats = client.GetStats();
+        std::cout << "checks=" << stats.checks << " rpcs=" << stats.rpcs
+                  << " coalesced=" << stats.coalesced << " cache_hits=" << stats.cache_hits << std::endl;
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << std::endl;
         return 1;
     }
-    
+
     return 0;
-}
\ No newline at end of file
+}
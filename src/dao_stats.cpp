@@ -0,0 +1,120 @@
+#include "dao_stats.h"
+#include <butil/logging.h>
+#include <butil/time.h>
+#include <algorithm>
+#include <ctime>
+#include <iomanip>
+#include <vector>
+
+namespace {
+
+// /dao_stats 页面中保留的最近慢查询条数
+const size_t kMaxSlowQueries = 100;
+
+std::string FormatTime(int64_t time_us) {
+    time_t seconds = static_cast<time_t>(time_us / 1000000);
+    struct tm tm_buf;
+    localtime_r(&seconds, &tm_buf);
+    char buf[32];
+    strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &tm_buf);
+    return buf;
+}
+
+} // namespace
+
+DaoStats::Statement::Statement(const std::string& stmt_name)
+    : name(stmt_name),
+      latency("dao_" + stmt_name),
+      acquire("dao_" + stmt_name + "_acquire"),
+      rows("dao_" + stmt_name + "_rows"),
+      errors("dao_" + stmt_name + "_errors") {
+}
+
+DaoStats& DaoStats::Global() {
+    // 有意不析构：bvar 的采样线程与其他静态对象析构时仍可能访问
+    static DaoStats* stats = new DaoStats();
+    return *stats;
+}
+
+DaoStats::DaoStats()
+    : pool_acquire_("dao_pool_acquire"),
+      acquire_failures_("dao_pool_acquire_failures"),
+      slow_count_("dao_slow_queries") {
+}
+
+DaoStats::Statement* DaoStats::Get(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_ptr<Statement>& stmt = statements_[name];
+    if (!stmt) {
+        stmt.reset(new Statement(name));
+    }
+    return stmt.get();
+}
+
+void DaoStats::RecordSlow(Statement* stmt, int64_t latency_us, int64_t rows,
+                          const std::string& sql, const std::string& params) {
+    SlowQuery slow;
+    slow.time_us = butil::gettimeofday_us();
+    slow.name = stmt->name;
+    slow.latency_us = latency_us;
+    slow.rows = rows;
+    slow.sql = sql;
+    slow.params = params;
+    slow_count_ << 1;
+    LOG(WARNING) << "[SlowQuery] " << slow.name << " latency=" << latency_us << "us"
+                 << " rows=" << rows << " sql=" << slow.sql << " params=[" << slow.params << "]";
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    slow_queries_.push_back(std::move(slow));
+    if (slow_queries_.size() > kMaxSlowQueries) {
+        slow_queries_.pop_front();
+    }
+}
+
+void DaoStats::RecordAcquire(Statement* stmt, int64_t wait_us) {
+    if (stmt) {
+        stmt->acquire << wait_us;
+    } else {
+        pool_acquire_ << wait_us;
+    }
+}
+
+void DaoStats::Describe(std::ostream& os) {
+    std::vector<Statement*> stmts;
+    std::deque<SlowQuery> slow;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& kv : statements_) {
+            stmts.push_back(kv.second.get());
+        }
+        slow = slow_queries_;
+    }
+    // 最近一个窗口内占用数据库时间最多的语句排在前面
+    std::sort(stmts.begin(), stmts.end(), [](Statement* a, Statement* b) {
+        return a->latency.qps() * a->latency.latency() > b->latency.qps() * b->latency.latency();
+    });
+
+    os << std::left << std::setw(36) << "statement" << std::right
+       << std::setw(12) << "count" << std::setw(8) << "qps"
+       << std::setw(10) << "avg_us" << std::setw(10) << "p99_us" << std::setw(10) << "max_us"
+       << std::setw(12) << "acquire_us" << std::setw(10) << "rows/op" << std::setw(8) << "errors" << '\n';
+    for (Statement* s : stmts) {
+        int64_t count = s->latency.count();
+        int64_t errors = s->errors.get_value();
+        int64_t ok = count - errors;
+        os << std::left << std::setw(36) << s->name << std::right
+           << std::setw(12) << count << std::setw(8) << s->latency.qps()
+           << std::setw(10) << s->latency.latency()
+           << std::setw(10) << s->latency.latency_percentile(0.99)
+           << std::setw(10) << s->latency.max_latency()
+           << std::setw(12) << s->acquire.latency()
+           << std::setw(10) << (ok > 0 ? s->rows.get_value() / ok : 0)
+           << std::setw(8) << errors << '\n';
+    }
+
+    os << "\nslow queries (threshold=" << slow_threshold_us_.load() << "us, latest " << slow.size() << "):\n";
+    for (auto it = slow.rbegin(); it != slow.rend(); ++it) {
+        os << FormatTime(it->time_us) << ' ' << it->name << ' ' << it->latency_us << "us rows="
+           << it->rows << "\n    " << it->sql << "\n    params: [" << it->params << "]\n";
+    }
+}
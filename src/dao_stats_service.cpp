@@ -0,0 +1,16 @@
+#include "dao_stats_service.h"
+#include "dao_stats.h"
+#include <brpc/controller.h>
+#include <butil/iobuf.h>
+
+void DaoStatsServiceImpl::default_method(google::protobuf::RpcController* cntl,
+                                         const siqi::auth::DaoStatsRequest* request,
+                                         siqi::auth::DaoStatsResponse* response,
+                                         google::protobuf::Closure* done) {
+    brpc::ClosureGuard done_guard(done);
+    brpc::Controller* bcntl = static_cast<brpc::Controller*>(cntl);
+    bcntl->http_response().set_content_type("text/plain");
+    butil::IOBufBuilder os;
+    DaoStats::Global().Describe(os);
+    os.move_to(bcntl->response_attachment());
+}
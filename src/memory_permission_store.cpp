@@ -0,0 +1,1659 @@
+#include "memory_permission_store.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <unordered_set>
+
+namespace {
+
+std::string formatTime(time_t t) {
+    struct tm tm;
+    localtime_r(&t, &tm);
+    char buf[32];
+    strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &tm);
+    return buf;
+}
+
+std::string nowString() {
+    return formatTime(time(nullptr));
+}
+
+// 把脚本拆成单条语句：去掉 "--" / "#" / "/* */" 注释，按字符串外的分号切分
+std::vector<std::string> splitStatements(const std::string& sql) {
+    std::vector<std::string> stmts;
+    std::string cur;
+    size_t i = 0;
+    while (i < sql.size()) {
+        char c = sql[i];
+        if (c == '\'' || c == '"') {
+            // 字符串原样保留，支持 '' 与反斜杠转义
+            char quote = c;
+            cur += c;
+            ++i;
+            while (i < sql.size()) {
+                char d = sql[i];
+                cur += d;
+                ++i;
+                if (d == '\\' && i < sql.size()) {
+                    cur += sql[i++];
+                } else if (d == quote) {
+                    if (i < sql.size() && sql[i] == quote) {
+                        cur += sql[i++];
+                    } else {
+                        break;
+                    }
+                }
+            }
+        } else if ((c == '-' && i + 1 < sql.size() && sql[i + 1] == '-') || c == '#') {
+            while (i < sql.size() && sql[i] != '\n') ++i;
+        } else if (c == '/' && i + 1 < sql.size() && sql[i + 1] == '*') {
+            size_t end = sql.find("*/", i + 2);
+            i = (end == std::string::npos) ? sql.size() : end + 2;
+            cur += ' ';
+        } else if (c == ';') {
+            stmts.push_back(cur);
+            cur.clear();
+            ++i;
+        } else {
+            cur += c;
+            ++i;
+        }
+    }
+    stmts.push_back(cur);
+    return stmts;
+}
+
+// 单条语句的词法游标，只支持 init.sql 中出现的写法
+class SqlCursor {
+public:
+    explicit SqlCursor(const std::string& s) : s_(s), pos_(0) {}
+
+    void skipSpace() {
+        while (pos_ < s_.size() && std::isspace(static_cast<unsigned char>(s_[pos_]))) ++pos_;
+    }
+
+    bool eof() {
+        skipSpace();
+        return pos_ >= s_.size();
+    }
+
+    bool peek(char c) {
+        skipSpace();
+        return pos_ < s_.size() && s_[pos_] == c;
+    }
+
+    bool consume(char c) {
+        if (!peek(c)) return false;
+        ++pos_;
+        return true;
+    }
+
+    // 大小写不敏感地匹配关键字，关键字后必须是分隔符
+    bool consumeKeyword(const char* kw) {
+        skipSpace();
+        size_t n = strlen(kw);
+        if (pos_ + n > s_.size()) return false;
+        for (size_t i = 0; i < n; ++i) {
+            if (std::toupper(static_cast<unsigned char>(s_[pos_ + i])) != kw[i]) return false;
+        }
+        if (pos_ + n < s_.size() && isIdentChar(s_[pos_ + n])) return false;
+        pos_ += n;
+        return true;
+    }
+
+    // 标识符，可带反引号
+    bool readIdentifier(std::string& out) {
+        skipSpace();
+        out.clear();
+        if (pos_ < s_.size() && s_[pos_] == '`') {
+            size_t end = s_.find('`', pos_ + 1);
+            if (end == std::string::npos) return false;
+            out = s_.substr(pos_ + 1, end - pos_ - 1);
+            pos_ = end + 1;
+            return true;
+        }
+        while (pos_ < s_.size() && isIdentChar(s_[pos_])) out += s_[pos_++];
+        return !out.empty();
+    }
+
+    bool readString(std::string& out) {
+        skipSpace();
+        if (pos_ >= s_.size() || (s_[pos_] != '\'' && s_[pos_] != '"')) return false;
+        char quote = s_[pos_++];
+        out.clear();
+        while (pos_ < s_.size()) {
+            char c = s_[pos_++];
+            if (c == '\\' && pos_ < s_.size()) {
+                char e = s_[pos_++];
+                switch (e) {
+                    case 'n': out += '\n'; break;
+                    case 't': out += '\t'; break;
+                    case '0': out += '\0'; break;
+                    default: out += e; break;
+                }
+            } else if (c == quote) {
+                if (pos_ < s_.size() && s_[pos_] == quote) {
+                    out += quote;
+                    ++pos_;
+                } else {
+                    return true;
+                }
+            } else {
+                out += c;
+            }
+        }
+        return false;
+    }
+
+    bool readNumber(std::string& out) {
+        skipSpace();
+        out.clear();
+        if (pos_ < s_.size() && (s_[pos_] == '-' || s_[pos_] == '+')) out += s_[pos_++];
+        while (pos_ < s_.size() && (std::isdigit(static_cast<unsigned char>(s_[pos_])) || s_[pos_] == '.')) {
+            out += s_[pos_++];
+        }
+        return !out.empty() && out != "-" && out != "+";
+    }
+
+    char current() {
+        skipSpace();
+        return pos_ < s_.size() ? s_[pos_] : '\0';
+    }
+
+private:
+    static bool isIdentChar(char c) {
+        return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+    }
+
+    const std::string& s_;
+    size_t pos_;
+};
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// 模拟连接与延迟
+// ---------------------------------------------------------------------------
+
+MemoryPermissionStore::ConnectionGuard::ConnectionGuard(MemoryPermissionStore* store, Access access)
+    : store_(store), acquired_(store->acquireConnection()) {
+    if (acquired_) {
+        store_->injectLatency(access);
+    }
+}
+
+MemoryPermissionStore::ConnectionGuard::~ConnectionGuard() {
+    if (acquired_) {
+        store_->releaseConnection();
+    }
+}
+
+MemoryPermissionStore::MemoryPermissionStore(const Options& options) : options_(options) {}
+
+bool MemoryPermissionStore::acquireConnection() {
+    if (options_.max_connections <= 0) {
+        return true;
+    }
+    std::unique_lock<std::mutex> lock(pool_mutex_);
+    if (!pool_cond_.wait_for(lock, std::chrono::milliseconds(options_.connection_wait_ms),
+                             [this] { return connections_in_use_ < options_.max_connections; })) {
+        setError("等待数据库连接超时");
+        std::cerr << "等待数据库连接超时" << std::endl;
+        return false;
+    }
+    ++connections_in_use_;
+    return true;
+}
+
+void MemoryPermissionStore::releaseConnection() {
+    if (options_.max_connections <= 0) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        --connections_in_use_;
+    }
+    pool_cond_.notify_one();
+}
+
+void MemoryPermissionStore::injectLatency(Access access) {
+    int64_t us = access == Access::kRead ? options_.read_latency_us : options_.write_latency_us;
+    if (options_.latency_jitter_us > 0) {
+        thread_local std::mt19937 rng(std::random_device{}());
+        us += std::uniform_int_distribution<int>(0, options_.latency_jitter_us - 1)(rng);
+    }
+    if (us > 0) {
+        // 与 MySQL Connector 一样阻塞当前线程
+        std::this_thread::sleep_for(std::chrono::microseconds(us));
+    }
+}
+
+void MemoryPermissionStore::setError(const std::string& error) {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    last_error_ = error;
+}
+
+bool MemoryPermissionStore::isConnected() const {
+    return true;
+}
+
+std::string MemoryPermissionStore::getLastError() const {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    return last_error_;
+}
+
+// ---------------------------------------------------------------------------
+// 内部查询与写入（调用方持锁）
+// ---------------------------------------------------------------------------
+
+int64_t MemoryPermissionStore::appIdLocked(const std::string& app_code, bool active_only) const {
+    auto it = app_ids_.find(app_code);
+    if (it == app_ids_.end()) return -1;
+    if (active_only && apps_.at(it->second).status != 1) return -1;
+    return it->second;
+}
+
+const MemoryPermissionStore::RoleRow* MemoryPermissionStore::roleLocked(int64_t app_id,
+                                                                        const std::string& role_key) const {
+    auto it = role_ids_.find(std::make_pair(app_id, role_key));
+    return it == role_ids_.end() ? nullptr : &roles_.at(it->second);
+}
+
+const MemoryPermissionStore::PermRow* MemoryPermissionStore::permLocked(int64_t app_id,
+                                                                        const std::string& perm_key) const {
+    auto it = perm_ids_.find(std::make_pair(app_id, perm_key));
+    return it == perm_ids_.end() ? nullptr : &perms_.at(it->second);
+}
+
+std::vector<const MemoryPermissionStore::UserRoleRow*>
+MemoryPermissionStore::userRolesLocked(int64_t app_id, const std::string& user_id) const {
+    std::vector<const UserRoleRow*> rows;
+    for (auto it = user_role_index_.lower_bound(std::make_tuple(app_id, user_id, INT64_MIN));
+         it != user_role_index_.end() && std::get<0>(it->first) == app_id && std::get<1>(it->first) == user_id;
+         ++it) {
+        rows.push_back(&user_roles_.at(it->second));
+    }
+    return rows;
+}
+
+std::vector<const MemoryPermissionStore::PermRow*> MemoryPermissionStore::rolePermsLocked(int64_t role_id) const {
+    std::vector<const PermRow*> rows;
+    for (auto it = role_perms_.lower_bound(std::make_pair(role_id, INT64_MIN));
+         it != role_perms_.end() && it->first == role_id; ++it) {
+        auto perm = perms_.find(it->second);
+        if (perm != perms_.end()) {
+            rows.push_back(&perm->second);
+        }
+    }
+    return rows;
+}
+
+bool MemoryPermissionStore::insertAppLocked(AppRow row, bool ignore_duplicate, std::string& error) {
+    if (app_ids_.count(row.app_code) || (row.id > 0 && apps_.count(row.id))) {
+        if (ignore_duplicate) return true;
+        error = "Duplicate entry '" + row.app_code + "' for key 'app_code'";
+        return false;
+    }
+    if (row.id <= 0) row.id = next_app_id_;
+    next_app_id_ = std::max(next_app_id_, row.id + 1);
+    if (row.created_at.empty()) row.created_at = nowString();
+    if (row.updated_at.empty()) row.updated_at = row.created_at;
+    app_ids_[row.app_code] = row.id;
+    apps_[row.id] = std::move(row);
+    return true;
+}
+
+bool MemoryPermissionStore::insertRoleLocked(RoleRow row, bool ignore_duplicate, std::string& error) {
+    auto key = std::make_pair(row.app_id, row.role_key);
+    if (role_ids_.count(key) || (row.id > 0 && roles_.count(row.id))) {
+        if (ignore_duplicate) return true;
+        error = "Duplicate entry '" + std::to_string(row.app_id) + "-" + row.role_key + "' for key 'uk_app_role'";
+        return false;
+    }
+    if (row.id <= 0) row.id = next_role_id_;
+    next_role_id_ = std::max(next_role_id_, row.id + 1);
+    role_ids_[key] = row.id;
+    roles_[row.id] = std::move(row);
+    return true;
+}
+
+bool MemoryPermissionStore::insertPermLocked(PermRow row, bool ignore_duplicate, std::string& error) {
+    auto key = std::make_pair(row.app_id, row.perm_key);
+    if (perm_ids_.count(key) || (row.id > 0 && perms_.count(row.id))) {
+        if (ignore_duplicate) return true;
+        error = "Duplicate entry '" + std::to_string(row.app_id) + "-" + row.perm_key + "' for key 'uk_app_perm'";
+        return false;
+    }
+    if (row.id <= 0) row.id = next_perm_id_;
+    next_perm_id_ = std::max(next_perm_id_, row.id + 1);
+    perm_ids_[key] = row.id;
+    perms_[row.id] = std::move(row);
+    return true;
+}
+
+bool MemoryPermissionStore::insertRolePermLocked(int64_t role_id, int64_t perm_id, bool ignore_duplicate,
+                                                 std::string& error) {
+    if (!role_perms_.insert(std::make_pair(role_id, perm_id)).second) {
+        if (ignore_duplicate) return true;
+        error = "Duplicate entry '" + std::to_string(role_id) + "-" + std::to_string(perm_id) + "' for key 'PRIMARY'";
+        return false;
+    }
+    perm_roles_.insert(std::make_pair(perm_id, role_id));
+    return true;
+}
+
+bool MemoryPermissionStore::insertUserRoleLocked(int64_t app_id, const std::string& user_id, int64_t role_id,
+                                                 const std::string& created_at, bool ignore_duplicate,
+                                                 bool& inserted, std::string& error) {
+    inserted = false;
+    auto key = std::make_tuple(app_id, user_id, role_id);
+    if (user_role_index_.count(key)) {
+        if (ignore_duplicate) return true;
+        error = "Duplicate entry '" + std::to_string(app_id) + "-" + user_id + "-" + std::to_string(role_id) +
+                "' for key 'uk_app_user_role'";
+        return false;
+    }
+    UserRoleRow row;
+    row.id = next_user_role_id_++;
+    row.app_id = app_id;
+    row.user_id = user_id;
+    row.role_id = role_id;
+    row.created_at = created_at.empty() ? nowString() : created_at;
+    user_role_index_[key] = row.id;
+    user_roles_[row.id] = std::move(row);
+    inserted = true;
+    return true;
+}
+
+void MemoryPermissionStore::appendAuditLogLocked(AuditLogInfo log) {
+    log.id = next_audit_id_++;
+    if (log.created_at.empty()) log.created_at = nowString();
+    audit_logs_[log.id] = std::move(log);
+}
+
+// ---------------------------------------------------------------------------
+// SQL 种子数据
+// ---------------------------------------------------------------------------
+
+bool MemoryPermissionStore::LoadSqlFile(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) {
+        setError("无法打开 SQL 文件: " + path);
+        return false;
+    }
+    std::stringstream ss;
+    ss << in.rdbuf();
+    return LoadSql(ss.str());
+}
+
+bool MemoryPermissionStore::LoadSql(const std::string& sql) {
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    std::map<std::string, std::string> vars;
+    std::vector<std::string> stmts = splitStatements(sql);
+    for (size_t i = 0; i < stmts.size(); ++i) {
+        std::string error;
+        if (!executeStatementLocked(stmts[i], vars, error)) {
+            std::string head = stmts[i];
+            head.erase(0, head.find_first_not_of(" \t\r\n"));
+            if (head.size() > 80) head = head.substr(0, 80) + "...";
+            setError("执行 SQL 失败 (" + error + "): " + head);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool MemoryPermissionStore::lookupIdLocked(const std::string& table,
+                                           const std::map<std::string, std::string>& where,
+                                           int64_t& out_id) const {
+    auto get = [&where](const char* col) -> const std::string* {
+        auto it = where.find(col);
+        return it == where.end() ? nullptr : &it->second;
+    };
+    if (table == "sys_apps" && where.size() == 1 && get("app_code")) {
+        out_id = appIdLocked(*get("app_code"), false);
+        return out_id != -1;
+    }
+    if ((table == "sys_roles" || table == "sys_permissions") && where.size() == 2 && get("app_id")) {
+        int64_t app_id = atoll(get("app_id")->c_str());
+        if (table == "sys_roles" && get("role_key")) {
+            const RoleRow* role = roleLocked(app_id, *get("role_key"));
+            if (role) out_id = role->id;
+            return role != nullptr;
+        }
+        if (table == "sys_permissions" && get("perm_key")) {
+            const PermRow* perm = permLocked(app_id, *get("perm_key"));
+            if (perm) out_id = perm->id;
+            return perm != nullptr;
+        }
+    }
+    return false;
+}
+
+bool MemoryPermissionStore::executeStatementLocked(const std::string& stmt,
+                                                   std::map<std::string, std::string>& vars,
+                                                   std::string& error) {
+    SqlCursor c(stmt);
+    if (c.eof()) return true;
+
+    // 值表达式：字符串、数字、NULL、@变量，或 (SELECT id FROM t WHERE a = v [AND b = v])
+    std::function<bool(std::string&, bool&)> parse_value = [&](std::string& out, bool& is_null) -> bool {
+        is_null = false;
+        char ch = c.current();
+        if (ch == '\'' || ch == '"') {
+            return c.readString(out);
+        }
+        if (ch == '@') {
+            c.consume('@');
+            std::string name;
+            if (!c.readIdentifier(name)) return false;
+            auto it = vars.find(name);
+            if (it == vars.end()) {
+                error = "未定义的变量 @" + name;
+                return false;
+            }
+            out = it->second;
+            return true;
+        }
+        if (ch == '(') {
+            c.consume('(');
+            std::string table;
+            if (!c.consumeKeyword("SELECT") || !c.consumeKeyword("ID") || !c.consumeKeyword("FROM") ||
+                !c.readIdentifier(table) || !c.consumeKeyword("WHERE")) {
+                error = "只支持 (SELECT id FROM t WHERE ...) 形式的子查询";
+                return false;
+            }
+            std::map<std::string, std::string> where;
+            do {
+                std::string col, val;
+                bool val_null = false;
+                if (!c.readIdentifier(col) || !c.consume('=') || !parse_value(val, val_null)) return false;
+                where[col] = val;
+            } while (c.consumeKeyword("AND"));
+            if (!c.consume(')')) return false;
+            int64_t id = 0;
+            if (!lookupIdLocked(table, where, id)) {
+                // 与 MySQL 一致，子查询无结果时为 NULL
+                is_null = true;
+                out.clear();
+                return true;
+            }
+            out = std::to_string(id);
+            return true;
+        }
+        if (c.consumeKeyword("NULL")) {
+            is_null = true;
+            out.clear();
+            return true;
+        }
+        if (c.consumeKeyword("NOW")) {
+            // NOW() / CURRENT_TIMESTAMP 按列默认值处理
+            c.consume('(');
+            c.consume(')');
+            is_null = true;
+            return true;
+        }
+        if (c.consumeKeyword("CURRENT_TIMESTAMP")) {
+            is_null = true;
+            return true;
+        }
+        return c.readNumber(out);
+    };
+
+    if (c.consumeKeyword("SET")) {
+        // SET NAMES / SET FOREIGN_KEY_CHECKS 等会话变量忽略
+        if (!c.consume('@')) return true;
+        std::string name, value;
+        bool is_null = false;
+        if (!c.readIdentifier(name) || !c.consume('=') || !parse_value(value, is_null)) {
+            if (error.empty()) error = "无法解析 SET 语句";
+            return false;
+        }
+        if (is_null) {
+            error = "变量 @" + name + " 的值为 NULL";
+            return false;
+        }
+        vars[name] = value;
+        return true;
+    }
+
+    if (!c.consumeKeyword("INSERT")) {
+        return true;  // 建库、建表、授权、TRUNCATE 等语句忽略
+    }
+    bool ignore = c.consumeKeyword("IGNORE");
+    std::string table;
+    if (!c.consumeKeyword("INTO") || !c.readIdentifier(table)) {
+        error = "无法解析 INSERT 语句";
+        return false;
+    }
+    std::vector<std::string> columns;
+    if (!c.consume('(')) {
+        error = "INSERT 必须带列名";
+        return false;
+    }
+    do {
+        std::string col;
+        if (!c.readIdentifier(col)) {
+            error = "无法解析列名";
+            return false;
+        }
+        columns.push_back(col);
+    } while (c.consume(','));
+    if (!c.consume(')') || !c.consumeKeyword("VALUES")) {
+        error = "无法解析 INSERT 语句";
+        return false;
+    }
+    do {
+        if (!c.consume('(')) {
+            error = "无法解析 VALUES";
+            return false;
+        }
+        std::map<std::string, std::string> row;
+        std::set<std::string> nulls;
+        for (size_t i = 0; i < columns.size(); ++i) {
+            if (i > 0 && !c.consume(',')) {
+                error = "列数与值的个数不一致";
+                return false;
+            }
+            std::string value;
+            bool is_null = false;
+            if (!parse_value(value, is_null)) {
+                if (error.empty()) error = "无法解析第 " + std::to_string(i + 1) + " 个值";
+                return false;
+            }
+            if (is_null) {
+                nulls.insert(columns[i]);
+            } else {
+                row[columns[i]] = value;
+            }
+        }
+        if (!c.consume(')')) {
+            error = "列数与值的个数不一致";
+            return false;
+        }
+        if (!insertSeedRowLocked(table, row, nulls, ignore, error)) {
+            return false;
+        }
+    } while (c.consume(','));
+    return true;
+}
+
+bool MemoryPermissionStore::insertSeedRowLocked(const std::string& table,
+                                                const std::map<std::string, std::string>& row,
+                                                const std::set<std::string>& nulls,
+                                                bool ignore_duplicate,
+                                                std::string& error) {
+    auto str = [&row](const char* col, const std::string& def = "") {
+        auto it = row.find(col);
+        return it == row.end() ? def : it->second;
+    };
+    auto num = [&row](const char* col, int64_t def = 0) {
+        auto it = row.find(col);
+        return it == row.end() ? def : static_cast<int64_t>(atoll(it->second.c_str()));
+    };
+    // 外键列为 NULL（子查询没有命中）时整行报错，避免静默丢数据
+    auto require = [&](std::initializer_list<const char*> cols) {
+        for (const char* col : cols) {
+            if (nulls.count(col) || !row.count(col)) {
+                error = table + "." + col + " 不能为空";
+                return false;
+            }
+        }
+        return true;
+    };
+
+    if (table == "sys_apps") {
+        if (!require({"app_code"})) return false;
+        AppRow app;
+        app.id = num("id");
+        app.app_name = str("app_name");
+        app.app_code = str("app_code");
+        app.app_secret = str("app_secret");
+        app.description = str("description");
+        app.status = static_cast<int32_t>(num("status", 1));
+        app.created_at = str("created_at");
+        app.updated_at = str("updated_at");
+        return insertAppLocked(std::move(app), ignore_duplicate, error);
+    }
+    if (table == "sys_console_users") {
+        if (!require({"username"})) return false;
+        ConsoleUser user;
+        user.username = str("username");
+        if (console_users_.count(user.username)) {
+            if (ignore_duplicate) return true;
+            error = "Duplicate entry '" + user.username + "' for key 'username'";
+            return false;
+        }
+        user.id = num("id", static_cast<int64_t>(console_users_.size()) + 1);
+        user.password_hash = str("password_hash");
+        user.real_name = str("real_name");
+        console_users_[user.username] = user;
+        return true;
+    }
+    if (table == "sys_permissions") {
+        if (!require({"app_id", "perm_key"})) return false;
+        PermRow perm;
+        perm.id = num("id");
+        perm.app_id = num("app_id");
+        perm.perm_name = str("perm_name");
+        perm.perm_key = str("perm_key");
+        perm.description = str("description");
+        return insertPermLocked(std::move(perm), ignore_duplicate, error);
+    }
+    if (table == "sys_roles") {
+        if (!require({"app_id", "role_key"})) return false;
+        RoleRow role;
+        role.id = num("id");
+        role.app_id = num("app_id");
+        role.role_name = str("role_name");
+        role.role_key = str("role_key");
+        role.description = str("description");
+        role.is_default = num("is_default") != 0;
+        return insertRoleLocked(std::move(role), ignore_duplicate, error);
+    }
+    if (table == "sys_role_permissions") {
+        if (!require({"role_id", "perm_id"})) return false;
+        return insertRolePermLocked(num("role_id"), num("perm_id"), ignore_duplicate, error);
+    }
+    if (table == "sys_user_roles") {
+        if (!require({"app_id", "app_user_id", "role_id"})) return false;
+        bool inserted = false;
+        return insertUserRoleLocked(num("app_id"), str("app_user_id"), num("role_id"), str("created_at"),
+                                    ignore_duplicate, inserted, error);
+    }
+    if (table == "sys_audit_logs") {
+        AuditLogInfo log;
+        log.operator_id = num("operator_id");
+        log.operator_name = str("operator_name");
+        log.app_code = str("app_code");
+        log.action = str("action");
+        log.target_type = str("target_type");
+        log.target_id = str("target_id");
+        log.target_name = str("target_name");
+        log.object_type = str("object_type");
+        log.object_id = str("object_id");
+        log.object_name = str("object_name");
+        log.created_at = str("created_at");
+        appendAuditLogLocked(std::move(log));
+        return true;
+    }
+    if (table == "sys_change_log") {
+        ChangeEvent ev;
+        ev.seq = next_change_seq_++;
+        ev.app_code = str("app_code");
+        ev.type = static_cast<int32_t>(num("event_type"));
+        ev.user_id = str("user_id");
+        ev.role_key = str("role_key");
+        ev.perm_key = str("perm_key");
+        ev.timestamp = time(nullptr);
+        change_log_.push_back(std::move(ev));
+        return true;
+    }
+    // 其他表与服务无关，忽略
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// 鉴权
+// ---------------------------------------------------------------------------
+
+bool MemoryPermissionStore::checkPermission(const std::string& app_code,
+                                            const std::string& user_id,
+                                            const std::string& perm_key,
+                                            const std::string& resource_id) {
+    {
+        // 应用不存在或已禁用直接拒绝，不占用连接
+        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        if (appIdLocked(app_code, true) == -1) return false;
+    }
+
+    ConnectionGuard conn(this, Access::kRead);
+    if (!conn.isValid()) return false;
+
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, true);
+    if (app_id == -1) return false;
+    const PermRow* perm = permLocked(app_id, perm_key);
+    if (!perm) return false;
+    for (const UserRoleRow* ur : userRolesLocked(app_id, user_id)) {
+        if (role_perms_.count(std::make_pair(ur->role_id, perm->id))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<bool> MemoryPermissionStore::batchCheckPermissions(
+        const std::string& app_code,
+        const std::vector<std::tuple<std::string, std::string>>& requests) {
+    std::vector<bool> results;
+    results.reserve(requests.size());
+    for (const auto& req : requests) {
+        results.push_back(checkPermission(app_code, std::get<0>(req), std::get<1>(req)));
+    }
+    return results;
+}
+
+std::vector<std::string> MemoryPermissionStore::getUserRoles(const std::string& app_code,
+                                                             const std::string& user_id) {
+    std::vector<std::string> roles;
+    {
+        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        if (appIdLocked(app_code, true) == -1) return roles;
+    }
+
+    ConnectionGuard conn(this, Access::kRead);
+    if (!conn.isValid()) return roles;
+
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, true);
+    if (app_id == -1) return roles;
+    for (const UserRoleRow* ur : userRolesLocked(app_id, user_id)) {
+        auto role = roles_.find(ur->role_id);
+        if (role != roles_.end()) {
+            roles.push_back(role->second.role_key);
+        }
+    }
+    return roles;
+}
+
+std::vector<std::pair<std::string, std::string>>
+MemoryPermissionStore::getUserPermissions(const std::string& app_code,
+                                          const std::string& user_id) {
+    std::vector<std::pair<std::string, std::string>> perms;
+    {
+        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        if (appIdLocked(app_code, false) == -1) return perms;
+    }
+
+    ConnectionGuard conn(this, Access::kRead);
+    if (!conn.isValid()) return perms;
+
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, false);
+    if (app_id == -1) return perms;
+    for (const UserRoleRow* ur : userRolesLocked(app_id, user_id)) {
+        for (const PermRow* perm : rolePermsLocked(ur->role_id)) {
+            perms.emplace_back(perm->perm_key, perm->perm_name);
+        }
+    }
+    return perms;
+}
+
+// ---------------------------------------------------------------------------
+// 应用管理
+// ---------------------------------------------------------------------------
+
+bool MemoryPermissionStore::createApp(const std::string& app_name,
+                                      const std::string& app_code,
+                                      const std::string& description,
+                                      std::string& out_app_secret) {
+    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+
+    AppRow app;
+    app.app_name = app_name;
+    app.app_code = app_code;
+    app.app_secret = "secret_" + app_code + "_" +
+                     std::to_string(std::chrono::system_clock::now().time_since_epoch().count());
+    app.description = description;
+    app.status = 1;
+
+    std::string error;
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    std::string secret = app.app_secret;
+    if (!insertAppLocked(std::move(app), false, error)) {
+        setError("创建应用失败: " + error);
+        return false;
+    }
+    out_app_secret = secret;
+    return true;
+}
+
+bool MemoryPermissionStore::updateApp(const std::string& app_code,
+                                      const std::string* app_name,
+                                      const std::string* description,
+                                      const int32_t* status) {
+    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+    if (!app_name && !description && !status) return true;
+
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, false);
+    if (app_id == -1) return false;
+    AppRow& app = apps_[app_id];
+    if (app_name) app.app_name = *app_name;
+    if (description) app.description = *description;
+    if (status) app.status = *status;
+    app.updated_at = nowString();
+    appendChangeLocked(ChangeEvent::Make(ChangeEvent::kAppUpdate, app_code));
+    return true;
+}
+
+bool MemoryPermissionStore::deleteApp(const std::string& app_code) {
+    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+
+    // 与 MySQL 实现一致，只删除应用本身，不级联删除其角色、权限与授权
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, false);
+    if (app_id == -1) return false;
+    apps_.erase(app_id);
+    app_ids_.erase(app_code);
+    appendChangeLocked(ChangeEvent::Make(ChangeEvent::kAppUpdate, app_code));
+    return true;
+}
+
+bool MemoryPermissionStore::getApp(const std::string& app_code, AppInfo& out_app) {
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return false;
+
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, false);
+    if (app_id == -1) return false;
+    const AppRow& app = apps_.at(app_id);
+    out_app.id = app.id;
+    out_app.app_name = app.app_name;
+    out_app.app_code = app.app_code;
+    out_app.app_secret = app.app_secret;
+    out_app.description = app.description;
+    out_app.status = app.status;
+    out_app.created_at = app.created_at;
+    out_app.updated_at = app.updated_at;
+    return true;
+}
+
+std::vector<PermissionStore::AppInfo> MemoryPermissionStore::listApps(int32_t page, int32_t page_size,
+                                                                     const std::string* app_name,
+                                                                     const int32_t* status,
+                                                                     int64_t& out_total) {
+    std::vector<AppInfo> apps;
+    out_total = 0;
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return apps;
+
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t skip = static_cast<int64_t>(page - 1) * page_size;
+    // ORDER BY id DESC
+    for (auto it = apps_.rbegin(); it != apps_.rend(); ++it) {
+        const AppRow& app = it->second;
+        if (app_name && app.app_name.find(*app_name) == std::string::npos) continue;
+        if (status && app.status != *status) continue;
+        ++out_total;
+        if (skip > 0) {
+            --skip;
+            continue;
+        }
+        if (static_cast<int32_t>(apps.size()) >= page_size) continue;
+        AppInfo info;
+        info.id = app.id;
+        info.app_name = app.app_name;
+        info.app_code = app.app_code;
+        info.app_secret = app.app_secret;
+        info.description = app.description;
+        info.status = app.status;
+        info.created_at = app.created_at;
+        info.updated_at = app.updated_at;
+        apps.push_back(info);
+    }
+    return apps;
+}
+
+bool MemoryPermissionStore::appExists(const std::string& app_code) {
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    return appIdLocked(app_code, false) != -1;
+}
+
+// ---------------------------------------------------------------------------
+// 角色 / 权限定义
+// ---------------------------------------------------------------------------
+
+bool MemoryPermissionStore::createRole(const std::string& app_code,
+                                       const std::string& role_name,
+                                       const std::string& role_key,
+                                       const std::string& description,
+                                       bool is_default) {
+    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, false);
+    if (app_id == -1) {
+        setError("应用不存在: " + app_code);
+        return false;
+    }
+    RoleRow role;
+    role.app_id = app_id;
+    role.role_name = role_name;
+    role.role_key = role_key;
+    role.description = description;
+    role.is_default = is_default;
+    std::string error;
+    if (!insertRoleLocked(std::move(role), false, error)) {
+        setError("创建角色失败: " + error);
+        return false;
+    }
+    return true;
+}
+
+bool MemoryPermissionStore::createPermission(const std::string& app_code,
+                                             const std::string& perm_name,
+                                             const std::string& perm_key,
+                                             const std::string& description) {
+    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, false);
+    if (app_id == -1) {
+        setError("应用不存在: " + app_code);
+        return false;
+    }
+    PermRow perm;
+    perm.app_id = app_id;
+    perm.perm_name = perm_name;
+    perm.perm_key = perm_key;
+    perm.description = description;
+    std::string error;
+    if (!insertPermLocked(std::move(perm), false, error)) {
+        setError("创建权限失败: " + error);
+        return false;
+    }
+    return true;
+}
+
+bool MemoryPermissionStore::updateRole(const std::string& app_code,
+                                       const std::string& role_key,
+                                       const std::string* role_name,
+                                       const std::string* description,
+                                       const bool* is_default) {
+    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, false);
+    if (app_id == -1) {
+        setError("应用不存在: " + app_code);
+        return false;
+    }
+    // 与 MySQL 实现一致：角色不存在时 UPDATE 影响 0 行，仍返回成功
+    auto it = role_ids_.find(std::make_pair(app_id, role_key));
+    if (it != role_ids_.end()) {
+        RoleRow& role = roles_[it->second];
+        if (role_name) role.role_name = *role_name;
+        if (description) role.description = *description;
+        if (is_default) role.is_default = *is_default;
+    }
+    return true;
+}
+
+bool MemoryPermissionStore::updatePermission(const std::string& app_code,
+                                             const std::string& perm_key,
+                                             const std::string* perm_name,
+                                             const std::string* description) {
+    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, false);
+    if (app_id == -1) {
+        setError("应用不存在: " + app_code);
+        return false;
+    }
+    auto it = perm_ids_.find(std::make_pair(app_id, perm_key));
+    if (it != perm_ids_.end()) {
+        PermRow& perm = perms_[it->second];
+        if (perm_name) perm.perm_name = *perm_name;
+        if (description) perm.description = *description;
+    }
+    return true;
+}
+
+bool MemoryPermissionStore::deleteRole(const std::string& app_code, const std::string& role_key) {
+    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, false);
+    if (app_id == -1) {
+        setError("应用不存在: " + app_code);
+        return false;
+    }
+    auto it = role_ids_.find(std::make_pair(app_id, role_key));
+    if (it == role_ids_.end()) {
+        setError("角色不存在或已删除");
+        return false;
+    }
+    // 授权与权限绑定不级联删除，查询时按 JOIN 语义自然过滤
+    roles_.erase(it->second);
+    role_ids_.erase(it);
+    appendChangeLocked(ChangeEvent::Make(ChangeEvent::kRoleDelete, app_code, "", role_key));
+    return true;
+}
+
+bool MemoryPermissionStore::deletePermission(const std::string& app_code, const std::string& perm_key) {
+    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, false);
+    if (app_id == -1) {
+        setError("应用不存在: " + app_code);
+        return false;
+    }
+    auto it = perm_ids_.find(std::make_pair(app_id, perm_key));
+    if (it == perm_ids_.end()) {
+        setError("权限不存在或已删除");
+        return false;
+    }
+    perms_.erase(it->second);
+    perm_ids_.erase(it);
+    appendChangeLocked(ChangeEvent::Make(ChangeEvent::kPermDelete, app_code, "", "", perm_key));
+    return true;
+}
+
+std::vector<PermissionStore::RoleInfo> MemoryPermissionStore::listRoles(const std::string& app_code) {
+    std::vector<RoleInfo> roles;
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return roles;
+
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, false);
+    if (app_id == -1) return roles;
+    for (const auto& kv : roles_) {
+        const RoleRow& row = kv.second;
+        if (row.app_id != app_id) continue;
+        RoleInfo role;
+        role.id = row.id;
+        role.role_name = row.role_name;
+        role.role_key = row.role_key;
+        role.description = row.description;
+        role.is_default = row.is_default;
+        for (const PermRow* perm : rolePermsLocked(row.id)) {
+            role.perm_keys.push_back(perm->perm_key);
+        }
+        roles.push_back(role);
+    }
+    return roles;
+}
+
+std::vector<PermissionStore::PermInfo> MemoryPermissionStore::listPermissions(const std::string& app_code) {
+    std::vector<PermInfo> perms;
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return perms;
+
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, false);
+    if (app_id == -1) return perms;
+    for (const auto& kv : perms_) {
+        const PermRow& row = kv.second;
+        if (row.app_id != app_id) continue;
+        PermInfo perm;
+        perm.id = row.id;
+        perm.perm_name = row.perm_name;
+        perm.perm_key = row.perm_key;
+        perm.description = row.description;
+        perms.push_back(perm);
+    }
+    return perms;
+}
+
+bool MemoryPermissionStore::permissionExists(const std::string& app_code, const std::string& perm_key) {
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return false;
+
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, false);
+    return app_id != -1 && permLocked(app_id, perm_key) != nullptr;
+}
+
+// ---------------------------------------------------------------------------
+// 用户-角色授权
+// ---------------------------------------------------------------------------
+
+bool MemoryPermissionStore::assignRoleToUser(const std::string& app_code,
+                                             const std::string& user_id,
+                                             const std::string& role_key) {
+    {
+        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        if (appIdLocked(app_code, false) == -1) {
+            setError("应用不存在: " + app_code);
+            return false;
+        }
+    }
+
+    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, false);
+    const RoleRow* role = app_id == -1 ? nullptr : roleLocked(app_id, role_key);
+    if (!role) {
+        setError("角色不存在");
+        return false;
+    }
+    bool inserted = false;
+    std::string error;
+    if (!insertUserRoleLocked(app_id, user_id, role->id, "", false, inserted, error)) {
+        setError("授权失败: " + error);
+        return false;
+    }
+    appendChangeLocked(ChangeEvent::Make(ChangeEvent::kUserGrantRole, app_code, user_id, role_key));
+    return true;
+}
+
+bool MemoryPermissionStore::removeRoleFromUser(const std::string& app_code,
+                                               const std::string& user_id,
+                                               const std::string& role_key) {
+    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, false);
+    if (app_id == -1) return false;
+    const RoleRow* role = roleLocked(app_id, role_key);
+    if (!role) return false;
+    auto it = user_role_index_.find(std::make_tuple(app_id, user_id, role->id));
+    if (it == user_role_index_.end()) return false;
+    user_roles_.erase(it->second);
+    user_role_index_.erase(it);
+    appendChangeLocked(ChangeEvent::Make(ChangeEvent::kUserRevokeRole, app_code, user_id, role_key));
+    return true;
+}
+
+int64_t MemoryPermissionStore::batchAssignRoles(const std::string& app_code,
+                                                const std::vector<std::string>& user_ids,
+                                                const std::vector<std::string>& role_keys) {
+    if (user_ids.empty() || role_keys.empty()) return 0;
+    ConnectionGuard conn(this); if (!conn.isValid()) return -1;
+
+    // 独占锁内先解析全部角色再写入，等价于 MySQL 实现的单事务
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, false);
+    if (app_id == -1) {
+        setError("应用不存在: " + app_code);
+        return -1;
+    }
+    std::vector<int64_t> role_ids;
+    for (const auto& key : role_keys) {
+        const RoleRow* role = roleLocked(app_id, key);
+        if (!role) {
+            setError("角色不存在: " + key);
+            return -1;
+        }
+        role_ids.push_back(role->id);
+    }
+    int64_t affected = 0;
+    std::string error;
+    for (const auto& uid : user_ids) {
+        for (int64_t rid : role_ids) {
+            bool inserted = false;
+            insertUserRoleLocked(app_id, uid, rid, "", true, inserted, error);
+            if (inserted) ++affected;
+        }
+        for (const auto& key : role_keys) {
+            appendChangeLocked(ChangeEvent::Make(ChangeEvent::kUserGrantRole, app_code, uid, key));
+        }
+    }
+    return affected;
+}
+
+int64_t MemoryPermissionStore::batchRemoveRoles(const std::string& app_code,
+                                                const std::vector<std::string>& user_ids,
+                                                const std::vector<std::string>& role_keys) {
+    if (user_ids.empty() || role_keys.empty()) return 0;
+    ConnectionGuard conn(this); if (!conn.isValid()) return -1;
+
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, false);
+    if (app_id == -1) {
+        setError("应用不存在: " + app_code);
+        return -1;
+    }
+    std::vector<int64_t> role_ids;
+    for (const auto& key : role_keys) {
+        const RoleRow* role = roleLocked(app_id, key);
+        if (!role) {
+            setError("角色不存在: " + key);
+            return -1;
+        }
+        role_ids.push_back(role->id);
+    }
+    int64_t affected = 0;
+    for (const auto& uid : user_ids) {
+        for (int64_t rid : role_ids) {
+            auto it = user_role_index_.find(std::make_tuple(app_id, uid, rid));
+            if (it != user_role_index_.end()) {
+                user_roles_.erase(it->second);
+                user_role_index_.erase(it);
+                ++affected;
+            }
+        }
+        for (const auto& key : role_keys) {
+            appendChangeLocked(ChangeEvent::Make(ChangeEvent::kUserRevokeRole, app_code, uid, key));
+        }
+    }
+    return affected;
+}
+
+// ---------------------------------------------------------------------------
+// 角色-权限绑定
+// ---------------------------------------------------------------------------
+
+bool MemoryPermissionStore::addPermissionToRole(const std::string& app_code,
+                                                const std::string& role_key,
+                                                const std::string& perm_key) {
+    {
+        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        if (appIdLocked(app_code, false) == -1) {
+            setError("应用不存在: " + app_code);
+            return false;
+        }
+    }
+
+    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, false);
+    const RoleRow* role = app_id == -1 ? nullptr : roleLocked(app_id, role_key);
+    if (!role) {
+        setError("角色不存在");
+        return false;
+    }
+    const PermRow* perm = permLocked(app_id, perm_key);
+    if (!perm) {
+        setError("权限不存在");
+        return false;
+    }
+    std::string error;
+    if (!insertRolePermLocked(role->id, perm->id, false, error)) {
+        setError("添加角色权限失败: " + error);
+        return false;
+    }
+    appendChangeLocked(ChangeEvent::Make(ChangeEvent::kRoleAddPerm, app_code, "", role_key, perm_key));
+    return true;
+}
+
+bool MemoryPermissionStore::removePermissionFromRole(const std::string& app_code,
+                                                     const std::string& role_key,
+                                                     const std::string& perm_key) {
+    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, false);
+    if (app_id == -1) return false;
+    const RoleRow* role = roleLocked(app_id, role_key);
+    const PermRow* perm = permLocked(app_id, perm_key);
+    if (!role || !perm) return false;
+    if (role_perms_.erase(std::make_pair(role->id, perm->id)) == 0) return false;
+    perm_roles_.erase(std::make_pair(perm->id, role->id));
+    appendChangeLocked(ChangeEvent::Make(ChangeEvent::kRoleRemovePerm, app_code, "", role_key, perm_key));
+    return true;
+}
+
+std::vector<std::string> MemoryPermissionStore::getRolePermissions(const std::string& app_code,
+                                                                   const std::string& role_key) {
+    std::vector<std::string> perms;
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return perms;
+
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, false);
+    if (app_id == -1) return perms;
+    const RoleRow* role = roleLocked(app_id, role_key);
+    if (!role) return perms;
+    for (const PermRow* perm : rolePermsLocked(role->id)) {
+        perms.push_back(perm->perm_key);
+    }
+    return perms;
+}
+
+std::vector<std::string> MemoryPermissionStore::getRolesWithPermission(const std::string& app_code,
+                                                                       const std::string& perm_key) {
+    std::vector<std::string> roles;
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return roles;
+
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, false);
+    if (app_id == -1) return roles;
+    const PermRow* perm = permLocked(app_id, perm_key);
+    if (!perm) return roles;
+    for (auto it = perm_roles_.lower_bound(std::make_pair(perm->id, INT64_MIN));
+         it != perm_roles_.end() && it->first == perm->id; ++it) {
+        auto role = roles_.find(it->second);
+        if (role != roles_.end() && role->second.app_id == app_id) {
+            roles.push_back(role->second.role_key);
+        }
+    }
+    return roles;
+}
+
+// ---------------------------------------------------------------------------
+// 分页查询
+// ---------------------------------------------------------------------------
+
+std::vector<PermissionStore::UserInfo> MemoryPermissionStore::getRoleUsers(const std::string& app_code,
+                                                                          const std::string& role_key,
+                                                                          int32_t page, int32_t page_size,
+                                                                          int64_t& out_total,
+                                                                          const PageCursor* after,
+                                                                          TotalMode total_mode,
+                                                                          PageCursor* out_next) {
+    std::vector<UserInfo> users;
+    out_total = 0;
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return users;
+
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, false);
+    if (app_id == -1) return users;
+    const RoleRow* role = roleLocked(app_id, role_key);
+    if (!role) {
+        out_total = total_mode == TotalMode::kNone ? -1 : 0;
+        return users;
+    }
+
+    // 按 (created_at, id) 倒序；没有 (role_id, created_at) 索引，这里整表扫描
+    std::vector<const UserRoleRow*> rows;
+    for (const auto& kv : user_roles_) {
+        if (kv.second.role_id == role->id) rows.push_back(&kv.second);
+    }
+    std::sort(rows.begin(), rows.end(), [](const UserRoleRow* a, const UserRoleRow* b) {
+        return a->created_at != b->created_at ? a->created_at > b->created_at : a->id > b->id;
+    });
+    out_total = total_mode == TotalMode::kNone ? -1 : static_cast<int64_t>(rows.size());
+
+    size_t begin = 0;
+    if (after) {
+        while (begin < rows.size() &&
+               !(rows[begin]->created_at < after->created_at ||
+                 (rows[begin]->created_at == after->created_at && rows[begin]->id < after->id))) {
+            ++begin;
+        }
+    } else {
+        begin = static_cast<size_t>(std::max<int64_t>(0, static_cast<int64_t>(page - 1) * page_size));
+    }
+    int64_t last_id = 0;
+    for (size_t i = begin; i < rows.size() && users.size() < static_cast<size_t>(page_size); ++i) {
+        UserInfo user;
+        user.user_id = rows[i]->user_id;
+        user.created_at = rows[i]->created_at;
+        last_id = rows[i]->id;
+        users.push_back(user);
+    }
+
+    if (out_next && !users.empty() && users.size() == static_cast<size_t>(page_size)) {
+        out_next->created_at = users.back().created_at;
+        out_next->id = last_id;
+        out_next->key.clear();
+    }
+    return users;
+}
+
+std::vector<PermissionStore::UserRoleData> MemoryPermissionStore::listUserRoles(const std::string& app_code,
+                                                                               int32_t page, int32_t page_size,
+                                                                               const std::string* user_id,
+                                                                               int64_t& out_total,
+                                                                               const PageCursor* after,
+                                                                               TotalMode total_mode,
+                                                                               PageCursor* out_next) {
+    std::vector<UserRoleData> users;
+    out_total = 0;
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return users;
+
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t app_id = appIdLocked(app_code, false);
+    if (app_id == -1) return users;
+    bool has_user = user_id && !user_id->empty();
+
+    // 按 app_user_id 升序遍历 (app_id, user_id, role_id) 索引，逐个用户聚合
+    std::vector<UserRoleData> all;
+    int64_t distinct_users = 0;
+    auto it = user_role_index_.lower_bound(std::make_tuple(app_id, has_user ? *user_id : std::string(), INT64_MIN));
+    while (it != user_role_index_.end() && std::get<0>(it->first) == app_id) {
+        const std::string uid = std::get<1>(it->first);
+        if (has_user && uid != *user_id) break;
+        ++distinct_users;
+
+        UserRoleData data;
+        data.user_id = uid;
+        std::unordered_set<std::string> seen_roles, seen_perms;
+        for (; it != user_role_index_.end() && std::get<0>(it->first) == app_id && std::get<1>(it->first) == uid; ++it) {
+            const UserRoleRow& ur = user_roles_.at(it->second);
+            auto role = roles_.find(ur.role_id);
+            if (role == roles_.end()) continue;  // JOIN sys_roles
+            if (data.created_at.empty() || ur.created_at < data.created_at) data.created_at = ur.created_at;
+            if (seen_roles.insert(role->second.role_key).second) data.role_keys.push_back(role->second.role_key);
+            for (const PermRow* perm : rolePermsLocked(ur.role_id)) {
+                if (seen_perms.insert(perm->perm_key).second) data.perm_keys.push_back(perm->perm_key);
+            }
+        }
+        if (!data.role_keys.empty()) {
+            all.push_back(std::move(data));
+        }
+    }
+    out_total = total_mode == TotalMode::kNone ? -1 : distinct_users;
+
+    if (!after) {
+        // 偏移分页按首次授权时间倒序
+        std::stable_sort(all.begin(), all.end(), [](const UserRoleData& a, const UserRoleData& b) {
+            return a.created_at > b.created_at;
+        });
+        size_t begin = static_cast<size_t>(std::max<int64_t>(0, static_cast<int64_t>(page - 1) * page_size));
+        for (size_t i = begin; i < all.size() && users.size() < static_cast<size_t>(page_size); ++i) {
+            users.push_back(std::move(all[i]));
+        }
+    } else {
+        for (auto& data : all) {
+            if (users.size() >= static_cast<size_t>(page_size)) break;
+            if (data.user_id > after->key) users.push_back(std::move(data));
+        }
+    }
+
+    if (out_next && !users.empty() && users.size() == static_cast<size_t>(page_size)) {
+        out_next->created_at.clear();
+        out_next->id = 0;
+        out_next->key = users.back().user_id;
+    }
+    return users;
+}
+
+// ---------------------------------------------------------------------------
+// 审计日志
+// ---------------------------------------------------------------------------
+
+bool MemoryPermissionStore::createAuditLog(int64_t operator_id,
+                                           const std::string& operator_name,
+                                           const std::string& app_code,
+                                           const std::string& action,
+                                           const std::string& target_type,
+                                           const std::string& target_id,
+                                           const std::string& target_name,
+                                           const std::string& object_type,
+                                           const std::string& object_id,
+                                           const std::string& object_name) {
+    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+
+    AuditLogInfo log;
+    log.operator_id = operator_id;
+    log.operator_name = operator_name;
+    log.app_code = app_code;
+    log.action = action;
+    log.target_type = target_type;
+    log.target_id = target_id;
+    log.target_name = target_name;
+    log.object_type = object_type;
+    log.object_id = object_id;
+    log.object_name = object_name;
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    appendAuditLogLocked(std::move(log));
+    return true;
+}
+
+bool MemoryPermissionStore::createAuditLogs(const std::vector<AuditLogInfo>& logs) {
+    if (logs.empty()) return true;
+    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    for (const auto& log : logs) {
+        appendAuditLogLocked(log);
+    }
+    return true;
+}
+
+std::vector<PermissionStore::AuditLogInfo> MemoryPermissionStore::listAuditLogs(int32_t page, int32_t page_size,
+                                                                               const std::string* app_code,
+                                                                               const std::string* action,
+                                                                               const std::string* operator_id,
+                                                                               const std::string* target_id,
+                                                                               const int64_t* start_time,
+                                                                               const int64_t* end_time,
+                                                                               int64_t& out_total,
+                                                                               const PageCursor* after,
+                                                                               TotalMode total_mode,
+                                                                               PageCursor* out_next) {
+    std::vector<AuditLogInfo> logs;
+    out_total = 0;
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return logs;
+
+    const std::string start = start_time ? formatTime(static_cast<time_t>(*start_time)) : "";
+    const std::string end = end_time ? formatTime(static_cast<time_t>(*end_time)) : "";
+
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    std::vector<const AuditLogInfo*> rows;
+    for (const auto& kv : audit_logs_) {
+        const AuditLogInfo& log = kv.second;
+        if (app_code && !app_code->empty() && log.app_code != *app_code) continue;
+        if (action && !action->empty() && log.action != *action) continue;
+        if (operator_id && !operator_id->empty() && std::to_string(log.operator_id) != *operator_id) continue;
+        if (target_id && !target_id->empty() && log.target_id != *target_id) continue;
+        if (start_time && log.created_at < start) continue;
+        if (end_time && log.created_at > end) continue;
+        rows.push_back(&log);
+    }
+    std::sort(rows.begin(), rows.end(), [](const AuditLogInfo* a, const AuditLogInfo* b) {
+        return a->created_at != b->created_at ? a->created_at > b->created_at : a->id > b->id;
+    });
+    out_total = total_mode == TotalMode::kNone ? -1 : static_cast<int64_t>(rows.size());
+
+    size_t begin = 0;
+    if (after) {
+        while (begin < rows.size() &&
+               !(rows[begin]->created_at < after->created_at ||
+                 (rows[begin]->created_at == after->created_at && rows[begin]->id < after->id))) {
+            ++begin;
+        }
+    } else {
+        begin = static_cast<size_t>(std::max<int64_t>(0, static_cast<int64_t>(page - 1) * page_size));
+    }
+    for (size_t i = begin; i < rows.size() && logs.size() < static_cast<size_t>(page_size); ++i) {
+        logs.push_back(*rows[i]);
+    }
+
+    if (out_next && !logs.empty() && logs.size() == static_cast<size_t>(page_size)) {
+        out_next->created_at = logs.back().created_at;
+        out_next->id = logs.back().id;
+        out_next->key.clear();
+    }
+    return logs;
+}
+
+std::vector<PermissionStore::AuditPartition> MemoryPermissionStore::listAuditPartitions() {
+    return {};
+}
+
+bool MemoryPermissionStore::addAuditPartitions(const std::vector<AuditPartition>& parts) {
+    if (parts.empty()) return true;
+    setError("内存存储的审计日志不分区");
+    return false;
+}
+
+bool MemoryPermissionStore::exportAuditPartition(const std::string& partition,
+                                                 const std::function<bool(const AuditLogInfo&)>& fn,
+                                                 int64_t& out_rows) {
+    out_rows = 0;
+    setError("内存存储的审计日志不分区: " + partition);
+    return false;
+}
+
+bool MemoryPermissionStore::dropAuditPartition(const std::string& partition) {
+    setError("内存存储的审计日志不分区: " + partition);
+    return false;
+}
+
+// ---------------------------------------------------------------------------
+// 权限变更日志
+// ---------------------------------------------------------------------------
+
+void MemoryPermissionStore::appendChangeLocked(ChangeEvent ev) {
+    ev.seq = next_change_seq_++;
+    ev.timestamp = time(nullptr);
+    change_log_.push_back(std::move(ev));
+}
+
+bool MemoryPermissionStore::fetchChangeEvents(int64_t after_seq, size_t limit, std::vector<ChangeEvent>& out) {
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return false;
+
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    auto it = std::upper_bound(change_log_.begin(), change_log_.end(), after_seq,
+                               [](int64_t seq, const ChangeEvent& ev) { return seq < ev.seq; });
+    for (; it != change_log_.end() && limit > 0; ++it, --limit) {
+        out.push_back(*it);
+    }
+    return true;
+}
+
+bool MemoryPermissionStore::getChangeSeqRange(int64_t& min_seq, int64_t& max_seq) {
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return false;
+
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    min_seq = change_log_.empty() ? 0 : change_log_.front().seq;
+    max_seq = change_log_.empty() ? 0 : change_log_.back().seq;
+    return true;
+}
+
+int64_t MemoryPermissionStore::purgeChangeEvents(int retention_hours, size_t limit) {
+    ConnectionGuard conn(this); if (!conn.isValid()) return -1;
+
+    int64_t cutoff = static_cast<int64_t>(time(nullptr)) - static_cast<int64_t>(retention_hours) * 3600;
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    int64_t removed = 0;
+    while (!change_log_.empty() && static_cast<size_t>(removed) < limit && change_log_.front().timestamp < cutoff) {
+        change_log_.pop_front();
+        ++removed;
+    }
+    return removed;
+}
+
+// ---------------------------------------------------------------------------
+// 整数句柄目录 / 控制台用户
+// ---------------------------------------------------------------------------
+
+bool MemoryPermissionStore::loadPermissionHandles(std::vector<PermHandle>& out) {
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return false;
+
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    std::map<int64_t, std::vector<const PermRow*>> by_app;
+    for (const auto& kv : perms_) {
+        by_app[kv.second.app_id].push_back(&kv.second);
+    }
+    out.clear();
+    for (const auto& kv : apps_) {
+        const AppRow& app = kv.second;
+        auto perms = by_app.find(app.id);
+        if (perms == by_app.end()) {
+            PermHandle row;
+            row.app_id = app.id;
+            row.app_code = app.app_code;
+            out.push_back(std::move(row));
+            continue;
+        }
+        for (const PermRow* perm : perms->second) {
+            PermHandle row;
+            row.app_id = app.id;
+            row.app_code = app.app_code;
+            row.perm_id = perm->id;
+            row.perm_key = perm->perm_key;
+            out.push_back(std::move(row));
+        }
+    }
+    return true;
+}
+
+PermissionStore::ConsoleUser MemoryPermissionStore::getConsoleUser(const std::string& username) {
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return ConsoleUser();
+
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    auto it = console_users_.find(username);
+    return it == console_users_.end() ? ConsoleUser() : it->second;
+}
@@ -1,16 +1,283 @@
 #include "permission_dao.h"
+#include "dao_stats.h"
+#include <butil/time.h>
 #include <cppconn/prepared_statement.h>
 #include <cppconn/exception.h>
 #include <cppconn/resultset.h>
+#include <cppconn/statement.h>
 #include <iostream>
+#include <cctype>
 #include <chrono>
 #include <sstream>
+#include <algorithm>
+#include <unordered_set>
+#include <functional>
+
+namespace {
+
+// 审计日志分区每次导出的行数
+const int kExportChunkRows = 5000;
+
+// 分区名直接拼入 DDL，只允许字母、数字和下划线
+bool isValidPartitionName(const std::string& name) {
+    if (name.empty() || name.size() > 64) return false;
+    for (char c : name) {
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_') return false;
+    }
+    return true;
+}
+
+// 批量写入时每条 SQL 携带的最大行数，避免单条语句过大或占位符超限 (65535)
+const size_t kBatchChunkRows = 500;
+
+// 把单行的 VALUES 模板重复 rows 次，以逗号连接
+std::string repeatRow(const std::string& row, size_t rows) {
+    std::string out;
+    out.reserve(rows * (row.size() + 1));
+    for (size_t r = 0; r < rows; ++r) {
+        if (r > 0) out += ",";
+        out += row;
+    }
+    return out;
+}
+
+// 生成 "(?,?,?),(?,?,?)" 形式的占位符串：rows 行，每行 cols 列
+std::string makePlaceholders(size_t rows, size_t cols) {
+    std::string row = "(";
+    for (size_t c = 0; c < cols; ++c) {
+        row += (c == 0 ? "?" : ",?");
+    }
+    row += ")";
+    return repeatRow(row, rows);
+}
+
+// 慢查询日志中每条语句最多记录的参数个数与单个字符串参数的长度
+const size_t kMaxLoggedParams = 32;
+const size_t kMaxLoggedParamLength = 64;
+
+// PreparedStatement 的包装：执行结束时把延迟（含 prepare）、行数与失败计入调用点对应的 DaoStats::Statement，
+// 超过慢查询阈值时连同绑定参数写日志。operator-> 返回自身，调用处沿用 pstmt->setString(...) 的写法。
+// 统计项由调用处用 DAO_STATEMENT("name") 传入（每个调用点只查一次表）；绑定参数只保留原始值，
+// 只有语句真的成为慢查询时才格式化，慢查询日志关闭时完全不记录
+class TracedStatement {
+public:
+    // 从 ConnectionGuard 取得连接后的第一条语句，同时计入等待连接池的耗时
+    template <typename Guard>
+    TracedStatement(Guard& conn, DaoStats::Statement* stats, std::string sql)
+        : TracedStatement(conn.get(), stats, std::move(sql)) {
+        int64_t wait_us = conn.takeAcquireWaitUs();
+        if (wait_us >= 0) {
+            DaoStats::Global().RecordAcquire(stats_, wait_us);
+        }
+    }
+
+    TracedStatement(sql::Connection* conn, DaoStats::Statement* stats, std::string sql)
+        : stats_(stats), sql_(std::move(sql)),
+          keep_params_(DaoStats::Global().slow_query_threshold_us() > 0) {
+        int64_t start_us = butil::cpuwide_time_us();
+        try {
+            stmt_.reset(conn->prepareStatement(sql_));
+        } catch (const sql::SQLException&) {
+            finish(start_us, -1);
+            throw;
+        }
+        prepare_us_ = butil::cpuwide_time_us() - start_us;
+    }
+
+    TracedStatement* operator->() { return this; }
+
+    void setString(unsigned int index, const std::string& value) {
+        stmt_->setString(index, value);
+        if (Param* param = bind(index, Param::kString)) {
+            param->truncated = value.size() > kMaxLoggedParamLength;
+            param->text.assign(value, 0, kMaxLoggedParamLength);
+        }
+    }
+    // 不应出现在日志中的值（例如应用密钥）
+    void setSecretString(unsigned int index, const std::string& value) {
+        stmt_->setString(index, value);
+        bind(index, Param::kSecret);
+    }
+    void setInt(unsigned int index, int32_t value) {
+        stmt_->setInt(index, value);
+        if (Param* param = bind(index, Param::kNumber)) {
+            param->number = value;
+        }
+    }
+    void setInt64(unsigned int index, int64_t value) {
+        stmt_->setInt64(index, value);
+        if (Param* param = bind(index, Param::kNumber)) {
+            param->number = value;
+        }
+    }
+
+    sql::ResultSet* executeQuery() {
+        int64_t start_us = butil::cpuwide_time_us();
+        sql::ResultSet* res = nullptr;
+        try {
+            res = stmt_->executeQuery();
+        } catch (const sql::SQLException&) {
+            finish(start_us, -1);
+            throw;
+        }
+        // 结果集默认整体缓存在客户端，rowsCount 不需要再访问服务端
+        int64_t rows = 0;
+        try {
+            rows = static_cast<int64_t>(res->rowsCount());
+        } catch (const sql::SQLException&) {}
+        finish(start_us, rows);
+        return res;
+    }
+
+    int executeUpdate() {
+        int64_t start_us = butil::cpuwide_time_us();
+        int rows = 0;
+        try {
+            rows = stmt_->executeUpdate();
+        } catch (const sql::SQLException&) {
+            finish(start_us, -1);
+            throw;
+        }
+        finish(start_us, rows);
+        return rows;
+    }
+
+    // DDL 等不关心结果的语句
+    void execute() {
+        int64_t start_us = butil::cpuwide_time_us();
+        try {
+            stmt_->execute();
+        } catch (const sql::SQLException&) {
+            finish(start_us, -1);
+            throw;
+        }
+        finish(start_us, 0);
+    }
+
+private:
+    // 绑定参数的原始值，字符串只保留前 kMaxLoggedParamLength 个字符
+    struct Param {
+        enum Kind { kUnset = 0, kString, kSecret, kNumber };
+        Kind kind = kUnset;
+        int64_t number = 0;
+        std::string text;
+        bool truncated = false;
+    };
+
+    // 返回需要填写的参数槽位；慢查询日志关闭或超出记录个数时返回 nullptr
+    Param* bind(unsigned int index, Param::Kind kind) {
+        if (!keep_params_) {
+            return nullptr;
+        }
+        if (index > kMaxLoggedParams) {
+            ++omitted_params_;
+            return nullptr;
+        }
+        if (params_.size() < index) {
+            params_.resize(index);
+        }
+        Param& param = params_[index - 1];
+        param.kind = kind;
+        return &param;
+    }
+
+    std::string formatParams() const {
+        std::string out;
+        for (size_t i = 0; i < params_.size(); ++i) {
+            const Param& param = params_[i];
+            if (i > 0) out += ", ";
+            switch (param.kind) {
+            case Param::kString:
+                out += "'" + param.text + (param.truncated ? "...'" : "'");
+                break;
+            case Param::kSecret:
+                out += "'***'";
+                break;
+            case Param::kNumber:
+                out += std::to_string(param.number);
+                break;
+            case Param::kUnset:
+                break;
+            }
+        }
+        if (omitted_params_ > 0) {
+            out += ", ... (" + std::to_string(omitted_params_) + " more)";
+        }
+        return out;
+    }
+
+    void finish(int64_t start_us, int64_t rows) {
+        int64_t latency_us = prepare_us_ + butil::cpuwide_time_us() - start_us;
+        prepare_us_ = 0;  // 同一语句重复执行时只有第一次包含 prepare
+        DaoStats& stats = DaoStats::Global();
+        stats.Record(stats_, latency_us, rows);
+        if (stats.IsSlow(latency_us)) {
+            stats.RecordSlow(stats_, latency_us, rows, sql_, formatParams());
+        }
+    }
+
+    DaoStats::Statement* stats_;
+    std::string sql_;
+    const bool keep_params_;
+    std::unique_ptr<sql::PreparedStatement> stmt_;
+    std::vector<Param> params_;
+    size_t omitted_params_ = 0;
+    int64_t prepare_us_ = 0;
+};
+
+// 按 mode 计算分页总数，count_stats / estimate_stats 分别为 "<name>_count" / "<name>_estimate" 的统计项。bind 负责从下标 1 开始绑定过滤条件的参数
+//  - kExact:    执行 count_sql
+//  - kEstimate: EXPLAIN select_sql，取各行 rows 的最大值（JOIN 时即驱动表的估算扫描行数）
+//  - kNone:     返回 -1
+int64_t countTotal(sql::Connection* conn, DaoStats::Statement* count_stats, DaoStats::Statement* estimate_stats,
+                   PermissionDAO::TotalMode mode,
+                   const std::string& count_sql, const std::string& select_sql,
+                   const std::function<void(TracedStatement*)>& bind) {
+    if (mode == PermissionDAO::TotalMode::kNone) {
+        return -1;
+    }
+    bool exact = (mode == PermissionDAO::TotalMode::kExact);
+    TracedStatement stmt(conn, exact ? count_stats : estimate_stats,
+                         exact ? count_sql : "EXPLAIN " + select_sql);
+    bind(&stmt);
+    std::unique_ptr<sql::ResultSet> res(stmt->executeQuery());
+    int64_t total = 0;
+    while (res->next()) {
+        if (exact) {
+            return res->getInt64(1);
+        }
+        total = std::max<int64_t>(total, res->getInt64("rows"));
+    }
+    return total;
+}
+
+std::vector<std::string> splitCsv(const std::string& str) {
+    std::vector<std::string> items;
+    if (str.empty()) return items;
+    std::stringstream ss(str);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        items.push_back(item);
+    }
+    return items;
+}
+
+} // namespace
 
 PermissionDAO::PermissionDAO(const std::string& host,
                              int port,
                              const std::string& user,
                              const std::string& password,
-                             const std::string& database) {
+                             const std::string& database,
+                             std::shared_ptr<AppCatalog> app_catalog,
+                             const std::vector<Endpoint>& replicas,
+                             int max_replica_lag_s,
+                             int health_check_interval_ms,
+                             std::shared_ptr<ReadFence> read_fence)
+    : max_replica_lag_s_(max_replica_lag_s),
+      health_check_interval_ms_(health_check_interval_ms),
+      app_catalog_(app_catalog ? app_catalog : std::make_shared<AppCatalog>()),
+      read_fence_(read_fence) {
     config_.host = host;
     config_.port = port;
     config_.user = user;
@@ -18,30 +285,65 @@ PermissionDAO::PermissionDAO(const std::string& host,
     config_.database = database;
 
     // 初始化连接池
-    for (size_t i = 0; i < initial_pool_size_; ++i) {
-        sql::Connection* conn = createConnection();
-        if (conn) {
-            connection_pool_.push(conn);
-            current_pool_size_++;
-        }
+    initPool(primary_pool_, host, port);
+    for (const auto& ep : replicas) {
+        std::unique_ptr<ConnectionPool> pool(new ConnectionPool());
+        initPool(*pool, ep.host, ep.port);
+        pool->healthy = pool->current_size > 0;
+        replica_pools_.push_back(std::move(pool));
     }
+
+    // 共享目录已由其他 DAO 加载过时不再重复加载
+    if (app_catalog_->IsStale(std::chrono::milliseconds(app_catalog_refresh_ms_))) {
+        refreshAppCatalog();
+    }
+
+    // 后台线程：从库健康检查 + 应用目录定时刷新
+    maintenance_thread_ = std::thread(&PermissionDAO::maintenanceLoop, this);
 }
 
 PermissionDAO::~PermissionDAO() {
-    std::lock_guard<std::mutex> lock(pool_mutex_);
-    while (!connection_pool_.empty()) {
-        sql::Connection* conn = connection_pool_.front();
-        connection_pool_.pop();
-        delete conn;
+    {
+        std::lock_guard<std::mutex> lock(maintenance_mutex_);
+        stopping_ = true;
+    }
+    maintenance_cond_.notify_all();
+    if (maintenance_thread_.joinable()) {
+        maintenance_thread_.join();
+    }
+
+    auto drain = [](ConnectionPool& pool) {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        while (!pool.connections.empty()) {
+            sql::Connection* conn = pool.connections.front();
+            pool.connections.pop();
+            delete conn;
+        }
+    };
+    drain(primary_pool_);
+    for (auto& pool : replica_pools_) {
+        drain(*pool);
     }
 }
 
-sql::Connection* PermissionDAO::createConnection() {
+void PermissionDAO::initPool(ConnectionPool& pool, const std::string& host, int port) {
+    pool.host = host;
+    pool.port = port;
+    for (size_t i = 0; i < initial_pool_size_; ++i) {
+        sql::Connection* conn = createConnection(pool);
+        if (conn) {
+            pool.connections.push(conn);
+            pool.current_size++;
+        }
+    }
+}
+
+sql::Connection* PermissionDAO::createConnection(const ConnectionPool& pool) {
     try {
         sql::mysql::MySQL_Driver* driver = sql::mysql::get_mysql_driver_instance();
         sql::ConnectOptionsMap connection_properties;
-        connection_properties["hostName"] = config_.host;
-        connection_properties["port"] = config_.port;
+        connection_properties["hostName"] = pool.host;
+        connection_properties["port"] = pool.port;
         connection_properties["userName"] = config_.user;
         connection_properties["password"] = config_.password;
         connection_properties["schema"] = config_.database;
@@ -53,43 +355,45 @@ sql::Connection* PermissionDAO::createConnection() {
         return conn;
     } catch (const sql::SQLException& e) {
         std::lock_guard<std::mutex> lock(error_mutex_);
-        last_error_ = "创建连接失败: " + std::string(e.what());
+        last_error_ = "创建连接失败(" + pool.host + ":" + std::to_string(pool.port) + "): " + std::string(e.what());
         std::cerr << last_error_ << std::endl;
         return nullptr;
     }
 }
 
-sql::Connection* PermissionDAO::getConnection() {
-    std::unique_lock<std::mutex> lock(pool_mutex_);
+sql::Connection* PermissionDAO::getConnection(ConnectionPool& pool, std::chrono::milliseconds wait,
+                                              AcquireError* error) {
+    std::unique_lock<std::mutex> lock(pool.mutex);
     
     // 如果没有可用连接，且未达最大上限，创建新连接
-    if (connection_pool_.empty() && current_pool_size_ < max_pool_size_) {
+    if (pool.connections.empty() && pool.current_size < max_pool_size_) {
         // 创建连接比较耗时，先释放锁
-        current_pool_size_++; // 先占位
+        pool.current_size++; // 先占位
         lock.unlock();
         
-        sql::Connection* new_conn = createConnection();
+        sql::Connection* new_conn = createConnection(pool);
         if (new_conn) {
              return new_conn;
         } else {
              // 创建失败，回退计数
              lock.lock();
-             current_pool_size_--;
+             pool.current_size--;
+             if (error) *error = AcquireError::kConnectFailed;
              return nullptr;
         }
     }
 
     // 等待可用连接
-    while (connection_pool_.empty()) {
-        // 等待 1 秒
-        if (pool_cond_.wait_for(lock, std::chrono::seconds(1)) == std::cv_status::timeout) {
-            std::cerr << "等待数据库连接超时" << std::endl;
+    while (pool.connections.empty()) {
+        if (pool.cond.wait_for(lock, wait) == std::cv_status::timeout) {
+            std::cerr << "等待数据库连接超时 (" << pool.host << ":" << pool.port << ")" << std::endl;
+            if (error) *error = AcquireError::kTimeout;
             return nullptr;
         }
     }
 
-    sql::Connection* conn = connection_pool_.front();
-    connection_pool_.pop();
+    sql::Connection* conn = pool.connections.front();
+    pool.connections.pop();
     
     // 检查连接有效性 (isClosed 只能检测客户端关闭，isValid 会检测服务端断开情况)
     bool is_valid = false;
@@ -104,10 +408,11 @@ sql::Connection* PermissionDAO::getConnection() {
         conn = nullptr;
         // 尝试重连一次
         lock.unlock();
-        conn = createConnection();
+        conn = createConnection(pool);
         if (!conn) {
             lock.lock();
-            current_pool_size_--; // 彻底失败
+            pool.current_size--; // 彻底失败
+            if (error) *error = AcquireError::kConnectFailed;
         }
         return conn;
     }
@@ -115,11 +420,134 @@ sql::Connection* PermissionDAO::getConnection() {
     return conn;
 }
 
-void PermissionDAO::releaseConnection(sql::Connection* conn) {
+void PermissionDAO::releaseConnection(ConnectionPool& pool, sql::Connection* conn) {
     if (!conn) return;
-    std::lock_guard<std::mutex> lock(pool_mutex_);
-    connection_pool_.push(conn);
-    pool_cond_.notify_one();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.connections.push(conn);
+    pool.cond.notify_one();
+}
+
+PermissionDAO::ConnectionPool* PermissionDAO::pickReadPool() {
+    size_t n = replica_pools_.size();
+    for (size_t i = 0; i < n; ++i) {
+        ConnectionPool* pool = replica_pools_[replica_cursor_++ % n].get();
+        if (pool->healthy.load(std::memory_order_relaxed)) {
+            return pool;
+        }
+    }
+    return nullptr;
+}
+
+PermissionDAO::Access PermissionDAO::userReadAccess(const std::string& app_code,
+                                                    const std::string& user_id) const {
+    if (read_fence_ && !replica_pools_.empty() && read_fence_->Pinned(app_code + ":" + user_id)) {
+        return Access::kWrite;
+    }
+    return Access::kRead;
+}
+
+void PermissionDAO::maintenanceLoop() {
+    std::unique_lock<std::mutex> lock(maintenance_mutex_);
+    while (!stopping_) {
+        maintenance_cond_.wait_for(lock, std::chrono::milliseconds(health_check_interval_ms_));
+        if (stopping_) break;
+
+        lock.unlock();
+        for (auto& pool : replica_pools_) {
+            checkReplicaHealth(*pool);
+        }
+        if (app_catalog_->IsStale(std::chrono::milliseconds(app_catalog_refresh_ms_))) {
+            refreshAppCatalog();
+        }
+        if (read_fence_) {
+            read_fence_->Purge();
+        }
+        lock.lock();
+    }
+}
+
+void PermissionDAO::checkReplicaHealth(ConnectionPool& pool) {
+    std::string name = pool.host + ":" + std::to_string(pool.port);
+    bool healthy = false;
+
+    AcquireError error = AcquireError::kNone;
+    sql::Connection* conn = getConnection(pool, std::chrono::milliseconds(1000), &error);
+    if (!conn && error == AcquireError::kTimeout) {
+        // 连接池被请求占满：节点可达，本轮不改变健康状态
+        return;
+    }
+    if (conn) {
+        healthy = true;
+        try {
+            std::unique_ptr<sql::Statement> stmt(conn->createStatement());
+            std::unique_ptr<sql::ResultSet> res(stmt->executeQuery("SHOW SLAVE STATUS"));
+            if (res->next()) {
+                if (res->isNull("Seconds_Behind_Master")) {
+                    // 复制线程已停止，数据不再更新
+                    healthy = false;
+                } else {
+                    pool.lag_seconds = res->getInt64("Seconds_Behind_Master");
+                    healthy = pool.lag_seconds <= max_replica_lag_s_;
+                }
+            }
+        } catch (const sql::SQLException& e) {
+            // 1227: 账号缺少 REPLICATION CLIENT 权限，无法读取延迟，只按连通性判断
+            if (e.getErrorCode() != 1227) {
+                healthy = false;
+            }
+        }
+        releaseConnection(pool, conn);
+    }
+
+    bool was_healthy = pool.healthy.exchange(healthy);
+    if (was_healthy && !healthy) {
+        std::cerr << "从库 " << name << " 不可用或延迟过高 (lag=" << pool.lag_seconds
+                  << "s)，读请求切换到其他节点" << std::endl;
+    } else if (!was_healthy && healthy) {
+        std::cerr << "从库 " << name << " 已恢复，重新加入读负载均衡" << std::endl;
+    }
+}
+
+bool PermissionDAO::refreshAppCatalog() {
+    ConnectionGuard conn(this, Access::kRead);
+    if (!conn.isValid()) return false;
+    try {
+        TracedStatement stmt(conn, DAO_STATEMENT("refresh_app_catalog"), "SELECT id, app_code, app_secret, status FROM sys_apps");
+        std::unique_ptr<sql::ResultSet> res(stmt->executeQuery());
+
+        std::unordered_map<std::string, AppCatalog::Entry> apps;
+        while (res->next()) {
+            AppCatalog::Entry entry;
+            entry.id = res->getInt64("id");
+            entry.status = res->getInt("status");
+            entry.app_secret = res->getString("app_secret");
+            apps[res->getString("app_code")] = entry;
+        }
+        app_catalog_->Reset(std::move(apps));
+        return true;
+    } catch (const sql::SQLException& e) {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        last_error_ = "加载应用目录失败: " + std::string(e.what());
+        std::cerr << last_error_ << std::endl;
+        return false;
+    }
+}
+
+bool PermissionDAO::loadAppEntry(sql::Connection* conn, const std::string& app_code,
+                                 AppCatalog::Entry& out) {
+    TracedStatement pstmt(conn, DAO_STATEMENT("load_app_entry"),
+        "SELECT id, app_secret, status FROM sys_apps WHERE app_code = ?");
+    pstmt->setString(1, app_code);
+    std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
+    if (!res->next()) {
+        app_catalog_->Erase(app_code);
+        return false;
+    }
+    out.id = res->getInt64("id");
+    out.status = res->getInt("status");
+    out.app_secret = res->getString("app_secret");
+    app_catalog_->Put(app_code, out);
+    return true;
 }
 
 bool PermissionDAO::isConnected() const {
@@ -136,25 +564,24 @@ bool PermissionDAO::checkPermission(const std::string& app_code,
                                    const std::string& user_id,
                                    const std::string& perm_key,
                                    const std::string& resource_id) {
-    ConnectionGuard conn(this);
+    // 应用不存在或已禁用直接拒绝，不必查库
+    int64_t app_id = getActiveAppId(app_code);
+    if (app_id == -1) return false;
+
+    ConnectionGuard conn(this, userReadAccess(app_code, user_id));
     if (!conn.isValid()) return false;
     
     try {
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement(
-                "SELECT COUNT(*) as cnt "
-                "FROM sys_user_roles ur "
-                "JOIN sys_apps a ON ur.app_id = a.id "
-                "JOIN sys_role_permissions rp ON ur.role_id = rp.role_id "
-                "JOIN sys_permissions p ON rp.perm_id = p.id "
-                "WHERE a.app_code = ? "
-                "  AND ur.app_user_id = ? "
-                "  AND p.perm_key = ? "
-                "  AND a.status = 1"
-            )
-        );
+        TracedStatement pstmt(conn, DAO_STATEMENT("check_permission"),
+            "SELECT COUNT(*) as cnt "
+            "FROM sys_user_roles ur "
+            "JOIN sys_role_permissions rp ON ur.role_id = rp.role_id "
+            "JOIN sys_permissions p ON rp.perm_id = p.id "
+            "WHERE ur.app_id = ? "
+            "  AND ur.app_user_id = ? "
+            "  AND p.perm_key = ?");
         
-        pstmt->setString(1, app_code);
+        pstmt->setInt64(1, app_id);
         pstmt->setString(2, user_id);
         pstmt->setString(3, perm_key);
         
@@ -188,23 +615,21 @@ std::vector<bool> PermissionDAO::batchCheckPermissions(
 std::vector<std::string> PermissionDAO::getUserRoles(const std::string& app_code,
                                           const std::string& user_id) {
     std::vector<std::string> roles;
-    ConnectionGuard conn(this);
+    int64_t app_id = getActiveAppId(app_code);
+    if (app_id == -1) return roles;
+
+    ConnectionGuard conn(this, userReadAccess(app_code, user_id));
     if (!conn.isValid()) return roles;
 
     try {
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement(
-                "SELECT r.role_key "
-                "FROM sys_user_roles ur "
-                "JOIN sys_apps a ON ur.app_id = a.id "
-                "JOIN sys_roles r ON ur.role_id = r.id "
-                "WHERE a.app_code = ? "
-                "  AND ur.app_user_id = ? "
-                "  AND a.status = 1"
-            )
-        );
+        TracedStatement pstmt(conn, DAO_STATEMENT("get_user_roles"),
+            "SELECT r.role_key "
+            "FROM sys_user_roles ur "
+            "JOIN sys_roles r ON ur.role_id = r.id "
+            "WHERE ur.app_id = ? "
+            "  AND ur.app_user_id = ?");
         
-        pstmt->setString(1, app_code);
+        pstmt->setInt64(1, app_id);
         pstmt->setString(2, user_id);
         
         std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
@@ -224,20 +649,19 @@ std::vector<std::pair<std::string, std::string>>
 PermissionDAO::getUserPermissions(const std::string& app_code,
                        const std::string& user_id) {
     std::vector<std::pair<std::string, std::string>> perms;
-    ConnectionGuard conn(this); if (!conn.isValid()) return perms;
+    int64_t app_id = getAppId(app_code);
+    if (app_id == -1) return perms;
+
+    ConnectionGuard conn(this, userReadAccess(app_code, user_id)); if (!conn.isValid()) return perms;
 
     try {
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement(
-                "SELECT p.perm_key, p.perm_name "
-                "FROM sys_user_roles ur "
-                "JOIN sys_apps a ON ur.app_id = a.id "
-                "JOIN sys_role_permissions rp ON ur.role_id = rp.role_id "
-                "JOIN sys_permissions p ON rp.perm_id = p.id "
-                "WHERE a.app_code = ? AND ur.app_user_id = ?"
-            )
-        );
-        pstmt->setString(1, app_code);
+        TracedStatement pstmt(conn, DAO_STATEMENT("get_user_permissions"),
+            "SELECT p.perm_key, p.perm_name "
+            "FROM sys_user_roles ur "
+            "JOIN sys_role_permissions rp ON ur.role_id = rp.role_id "
+            "JOIN sys_permissions p ON rp.perm_id = p.id "
+            "WHERE ur.app_id = ? AND ur.app_user_id = ?");
+        pstmt->setInt64(1, app_id);
         pstmt->setString(2, user_id);
         
         std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
@@ -260,18 +684,18 @@ bool PermissionDAO::createApp(const std::string& app_name,
         std::string secret = "secret_" + app_code + "_" + std::to_string(std::chrono::system_clock::now().time_since_epoch().count());
         out_app_secret = secret;
 
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement(
-                "INSERT INTO sys_apps (app_name, app_code, app_secret, description, status) "
-                "VALUES (?, ?, ?, ?, 1)"
-            )
-        );
+        TracedStatement pstmt(conn, DAO_STATEMENT("create_app"),
+            "INSERT INTO sys_apps (app_name, app_code, app_secret, description, status) "
+            "VALUES (?, ?, ?, ?, 1)");
         pstmt->setString(1, app_name);
         pstmt->setString(2, app_code);
-        pstmt->setString(3, secret);
+        pstmt->setSecretString(3, secret);
         pstmt->setString(4, description);
         
         pstmt->executeUpdate();
+
+        AppCatalog::Entry entry;
+        loadAppEntry(conn.get(), app_code, entry);
         return true;
     } catch (const sql::SQLException& e) {
         std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "创建应用失败: " + std::string(e.what());
@@ -311,7 +735,7 @@ bool PermissionDAO::updateApp(const std::string& app_code,
         query.pop_back(); query.pop_back(); // Remove last ", "
         query += " WHERE app_code = ?";
 
-        std::unique_ptr<sql::PreparedStatement> pstmt(conn->prepareStatement(query));
+        TracedStatement pstmt(conn, DAO_STATEMENT("update_app"), query);
         
         int param_idx = 1;
         int str_idx = 0;
@@ -325,9 +749,25 @@ bool PermissionDAO::updateApp(const std::string& app_code,
         }
         pstmt->setString(param_idx, app_code);
 
+        // 数据修改与变更日志在同一事务内提交，Watch 订阅方不会漏掉已生效的变更
+        conn->setAutoCommit(false);
         int rows = pstmt->executeUpdate();
+        if (rows > 0) {
+            insertChangeEvents(conn.get(), {ChangeEvent::Make(ChangeEvent::kAppUpdate, app_code)});
+        }
+        conn->commit();
+        conn->setAutoCommit(true);
+        if (rows > 0 && status) {
+            // 状态变化立即反映到目录，禁用的应用马上停止通过鉴权
+            AppCatalog::Entry entry;
+            loadAppEntry(conn.get(), app_code, entry);
+        }
         return rows > 0;
     } catch (const sql::SQLException& e) {
+        try {
+            conn->rollback();
+            conn->setAutoCommit(true);
+        } catch (...) {}
         std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "更新应用失败: " + std::string(e.what());
         return false;
     }
@@ -336,27 +776,33 @@ bool PermissionDAO::updateApp(const std::string& app_code,
 bool PermissionDAO::deleteApp(const std::string& app_code) {
     ConnectionGuard conn(this); if (!conn.isValid()) return false;
     try {
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement("DELETE FROM sys_apps WHERE app_code = ?")
-        );
+        TracedStatement pstmt(conn, DAO_STATEMENT("delete_app"), "DELETE FROM sys_apps WHERE app_code = ?");
         pstmt->setString(1, app_code);
+        conn->setAutoCommit(false);
         int rows = pstmt->executeUpdate();
+        if (rows > 0) {
+            insertChangeEvents(conn.get(), {ChangeEvent::Make(ChangeEvent::kAppUpdate, app_code)});
+        }
+        conn->commit();
+        conn->setAutoCommit(true);
+        app_catalog_->Erase(app_code);
         return rows > 0;
     } catch (const sql::SQLException& e) {
+        try {
+            conn->rollback();
+            conn->setAutoCommit(true);
+        } catch (...) {}
         std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "删除应用失败: " + std::string(e.what());
         return false;
     }
 }
 
 bool PermissionDAO::getApp(const std::string& app_code, AppInfo& out_app) {
-    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return false;
     try {
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement(
-                "SELECT id, app_name, app_code, app_secret, description, status, created_at, updated_at "
-                "FROM sys_apps WHERE app_code = ?"
-            )
-        );
+        TracedStatement pstmt(conn, DAO_STATEMENT("get_app"),
+            "SELECT id, app_name, app_code, app_secret, description, status, created_at, updated_at "
+            "FROM sys_apps WHERE app_code = ?");
         pstmt->setString(1, app_code);
         std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
         if (res->next()) {
@@ -383,7 +829,7 @@ std::vector<PermissionDAO::AppInfo> PermissionDAO::listApps(int32_t page, int32_
                                                             int64_t& out_total) {
     std::vector<AppInfo> apps;
     out_total = 0;
-    ConnectionGuard conn(this); if (!conn.isValid()) return apps;
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return apps;
 
     try {
         std::string count_query = "SELECT COUNT(*) as cnt FROM sys_apps WHERE 1=1";
@@ -402,7 +848,7 @@ std::vector<PermissionDAO::AppInfo> PermissionDAO::listApps(int32_t page, int32_
 
         // Count
         {
-            std::unique_ptr<sql::PreparedStatement> pstmt(conn->prepareStatement(count_query));
+            TracedStatement pstmt(conn, DAO_STATEMENT("list_apps_count"), count_query);
             int param_idx = 1;
             if (app_name) pstmt->setString(param_idx++, "%" + *app_name + "%");
             if (status) pstmt->setInt(param_idx++, *status);
@@ -415,7 +861,7 @@ std::vector<PermissionDAO::AppInfo> PermissionDAO::listApps(int32_t page, int32_
 
         // Data
         {
-            std::unique_ptr<sql::PreparedStatement> pstmt(conn->prepareStatement(data_query));
+            TracedStatement pstmt(conn, DAO_STATEMENT("list_apps"), data_query);
             int param_idx = 1;
             if (app_name) pstmt->setString(param_idx++, "%" + *app_name + "%");
             if (status) pstmt->setInt(param_idx++, *status);
@@ -444,20 +890,32 @@ std::vector<PermissionDAO::AppInfo> PermissionDAO::listApps(int32_t page, int32_
 }
 
 int64_t PermissionDAO::getAppId(const std::string& app_code) {
-    ConnectionGuard conn(this); if (!conn.isValid()) return -1;
+    AppCatalog::Entry entry;
+    if (app_catalog_->Get(app_code, entry)) {
+        return entry.id;
+    }
+
+    // 目录未命中（例如其他节点刚创建的应用），回源查一次并补进目录
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return -1;
     try {
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement("SELECT id FROM sys_apps WHERE app_code = ?")
-        );
-        pstmt->setString(1, app_code);
-        std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
-        if (res->next()) {
-            return res->getInt64("id");
+        if (loadAppEntry(conn.get(), app_code, entry)) {
+            return entry.id;
         }
     } catch (...) {}
     return -1;
 }
 
+int64_t PermissionDAO::getActiveAppId(const std::string& app_code) {
+    int64_t app_id = getAppId(app_code);
+    if (app_id == -1) return -1;
+
+    AppCatalog::Entry entry;
+    if (!app_catalog_->Get(app_code, entry) || entry.status != 1) {
+        return -1;
+    }
+    return app_id;
+}
+
 bool PermissionDAO::createRole(const std::string& app_code,
                                const std::string& role_name,
                                const std::string& role_key,
@@ -471,12 +929,9 @@ bool PermissionDAO::createRole(const std::string& app_code,
             return false;
         }
 
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement(
-                "INSERT INTO sys_roles (app_id, role_name, role_key, description, is_default) "
-                "VALUES (?, ?, ?, ?, ?)"
-            )
-        );
+        TracedStatement pstmt(conn, DAO_STATEMENT("create_role"),
+            "INSERT INTO sys_roles (app_id, role_name, role_key, description, is_default) "
+            "VALUES (?, ?, ?, ?, ?)");
         pstmt->setInt64(1, app_id);
         pstmt->setString(2, role_name);
         pstmt->setString(3, role_key);
@@ -503,12 +958,9 @@ bool PermissionDAO::createPermission(const std::string& app_code,
             return false;
         }
 
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement(
-                "INSERT INTO sys_permissions (app_id, perm_name, perm_key, description) "
-                "VALUES (?, ?, ?, ?)"
-            )
-        );
+        TracedStatement pstmt(conn, DAO_STATEMENT("create_permission"),
+            "INSERT INTO sys_permissions (app_id, perm_name, perm_key, description) "
+            "VALUES (?, ?, ?, ?)");
         pstmt->setInt64(1, app_id);
         pstmt->setString(2, perm_name);
         pstmt->setString(3, perm_key);
@@ -525,16 +977,18 @@ bool PermissionDAO::createPermission(const std::string& app_code,
 bool PermissionDAO::assignRoleToUser(const std::string& app_code,
                           const std::string& user_id,
                           const std::string& role_key) {
+    int64_t app_id = getAppId(app_code);
+    if (app_id == -1) {
+        std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "应用不存在: " + app_code;
+        return false;
+    }
+
     ConnectionGuard conn(this); if (!conn.isValid()) return false;
     try {
         // 1. Get role_id
-        std::unique_ptr<sql::PreparedStatement> pstmt_role(
-            conn->prepareStatement(
-                "SELECT r.id, r.app_id FROM sys_roles r JOIN sys_apps a ON r.app_id = a.id "
-                "WHERE a.app_code = ? AND r.role_key = ?"
-            )
-        );
-        pstmt_role->setString(1, app_code);
+        TracedStatement pstmt_role(conn, DAO_STATEMENT("assign_role_find_role"),
+            "SELECT id FROM sys_roles WHERE app_id = ? AND role_key = ?");
+        pstmt_role->setInt64(1, app_id);
         pstmt_role->setString(2, role_key);
         std::unique_ptr<sql::ResultSet> res(pstmt_role->executeQuery());
         
@@ -543,21 +997,25 @@ bool PermissionDAO::assignRoleToUser(const std::string& app_code,
             return false;
         }
         int64_t role_id = res->getInt64("id");
-        int64_t app_id = res->getInt64("app_id");
 
         // 2. Insert mapping
-        std::unique_ptr<sql::PreparedStatement> pstmt_insert(
-            conn->prepareStatement(
-                "INSERT INTO sys_user_roles (app_id, app_user_id, role_id) VALUES (?, ?, ?)"
-            )
-        );
+        TracedStatement pstmt_insert(conn, DAO_STATEMENT("assign_role_insert"),
+            "INSERT INTO sys_user_roles (app_id, app_user_id, role_id) VALUES (?, ?, ?)");
         pstmt_insert->setInt64(1, app_id);
         pstmt_insert->setString(2, user_id);
         pstmt_insert->setInt64(3, role_id);
-        
+
+        conn->setAutoCommit(false);
         pstmt_insert->executeUpdate();
+        insertChangeEvents(conn.get(), {ChangeEvent::Make(ChangeEvent::kUserGrantRole, app_code, user_id, role_key)});
+        conn->commit();
+        conn->setAutoCommit(true);
         return true;
     } catch (const sql::SQLException& e) {
+        try {
+            conn->rollback();
+            conn->setAutoCommit(true);
+        } catch (...) {}
         std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "授权失败: " + std::string(e.what());
         return false;
     }
@@ -566,31 +1024,163 @@ bool PermissionDAO::assignRoleToUser(const std::string& app_code,
 bool PermissionDAO::removeRoleFromUser(const std::string& app_code,
                           const std::string& user_id,
                           const std::string& role_key) {
+    int64_t app_id = getAppId(app_code);
+    if (app_id == -1) return false;
+
     ConnectionGuard conn(this); if (!conn.isValid()) return false;
     try {
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement(
-                "DELETE ur FROM sys_user_roles ur "
-                "JOIN sys_apps a ON ur.app_id = a.id "
-                "JOIN sys_roles r ON ur.role_id = r.id "
-                "WHERE a.app_code = ? AND ur.app_user_id = ? AND r.role_key = ?"
-            )
-        );
-        pstmt->setString(1, app_code);
+        TracedStatement pstmt(conn, DAO_STATEMENT("remove_role_from_user"),
+            "DELETE ur FROM sys_user_roles ur "
+            "JOIN sys_roles r ON ur.role_id = r.id "
+            "WHERE ur.app_id = ? AND ur.app_user_id = ? AND r.role_key = ?");
+        pstmt->setInt64(1, app_id);
         pstmt->setString(2, user_id);
         pstmt->setString(3, role_key);
-        
+
+        conn->setAutoCommit(false);
         int rows = pstmt->executeUpdate();
+        if (rows > 0) {
+            insertChangeEvents(conn.get(),
+                               {ChangeEvent::Make(ChangeEvent::kUserRevokeRole, app_code, user_id, role_key)});
+        }
+        conn->commit();
+        conn->setAutoCommit(true);
         return rows > 0;
     } catch (const sql::SQLException& e) {
+        try {
+            conn->rollback();
+            conn->setAutoCommit(true);
+        } catch (...) {}
         std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "移除权限失败: " + std::string(e.what());
         return false;
     }
 }
 
+int64_t PermissionDAO::batchAssignRoles(const std::string& app_code,
+                                        const std::vector<std::string>& user_ids,
+                                        const std::vector<std::string>& role_keys) {
+    return batchUpdateUserRoles(app_code, user_ids, role_keys, true);
+}
+
+int64_t PermissionDAO::batchRemoveRoles(const std::string& app_code,
+                                        const std::vector<std::string>& user_ids,
+                                        const std::vector<std::string>& role_keys) {
+    return batchUpdateUserRoles(app_code, user_ids, role_keys, false);
+}
+
+// 在单个事务内执行批量写，rollback 保证部分失败时不会留下半批数据
+int64_t PermissionDAO::batchUpdateUserRoles(const std::string& app_code,
+                                            const std::vector<std::string>& user_ids,
+                                            const std::vector<std::string>& role_keys,
+                                            bool grant) {
+    if (user_ids.empty() || role_keys.empty()) return 0;
+
+    int64_t app_id = getAppId(app_code);
+    if (app_id == -1) {
+        std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "应用不存在: " + app_code;
+        return -1;
+    }
+
+    ConnectionGuard conn(this); if (!conn.isValid()) return -1;
+    int64_t affected = 0;
+    try {
+        // 1. 一次性解析所有角色 ID
+        std::vector<int64_t> role_ids;
+        {
+            TracedStatement pstmt(conn, DAO_STATEMENT("batch_roles_find_roles"),
+                "SELECT id, role_key FROM sys_roles WHERE app_id = ? AND role_key IN " +
+                makePlaceholders(1, role_keys.size()));
+            int idx = 1;
+            pstmt->setInt64(idx++, app_id);
+            for (const auto& key : role_keys) pstmt->setString(idx++, key);
+
+            std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
+            std::unordered_set<std::string> found;
+            while (res->next()) {
+                role_ids.push_back(res->getInt64("id"));
+                found.insert(res->getString("role_key"));
+            }
+            for (const auto& key : role_keys) {
+                if (!found.count(key)) {
+                    std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "角色不存在: " + key;
+                    return -1;
+                }
+            }
+        }
+
+        // 2. 同一事务内分块写入
+        conn->setAutoCommit(false);
+        if (grant) {
+            // 展开为 (user, role) 对，每块最多 kBatchChunkRows 行；已有的授权由唯一键去重
+            std::vector<std::pair<const std::string*, int64_t>> rows;
+            rows.reserve(user_ids.size() * role_ids.size());
+            for (const auto& uid : user_ids) {
+                for (int64_t rid : role_ids) rows.emplace_back(&uid, rid);
+            }
+            for (size_t begin = 0; begin < rows.size(); begin += kBatchChunkRows) {
+                size_t n = std::min(kBatchChunkRows, rows.size() - begin);
+                TracedStatement pstmt(conn, DAO_STATEMENT("batch_assign_roles_insert"),
+                    "INSERT INTO sys_user_roles (app_id, app_user_id, role_id) VALUES " +
+                    makePlaceholders(n, 3) +
+                    " ON DUPLICATE KEY UPDATE role_id = role_id");
+                int idx = 1;
+                for (size_t i = begin; i < begin + n; ++i) {
+                    pstmt->setInt64(idx++, app_id);
+                    pstmt->setString(idx++, *rows[i].first);
+                    pstmt->setInt64(idx++, rows[i].second);
+                }
+                affected += pstmt->executeUpdate();
+            }
+        } else {
+            // 按用户分块：DELETE ... WHERE role_id IN (...) AND app_user_id IN (...)
+            size_t users_per_chunk = std::max<size_t>(1, kBatchChunkRows / role_ids.size());
+            for (size_t begin = 0; begin < user_ids.size(); begin += users_per_chunk) {
+                size_t n = std::min(users_per_chunk, user_ids.size() - begin);
+                TracedStatement pstmt(conn, DAO_STATEMENT("batch_remove_roles_delete"),
+                    "DELETE FROM sys_user_roles WHERE app_id = ? AND role_id IN " +
+                    makePlaceholders(1, role_ids.size()) +
+                    " AND app_user_id IN " + makePlaceholders(1, n));
+                int idx = 1;
+                pstmt->setInt64(idx++, app_id);
+                for (int64_t rid : role_ids) pstmt->setInt64(idx++, rid);
+                for (size_t i = begin; i < begin + n; ++i) pstmt->setString(idx++, user_ids[i]);
+                affected += pstmt->executeUpdate();
+            }
+        }
+        // 变更事件：每个 (用户, 角色) 一条，与授权数据一起提交
+        std::vector<ChangeEvent> changes;
+        changes.reserve(user_ids.size() * role_keys.size());
+        for (const auto& uid : user_ids) {
+            for (const auto& key : role_keys) {
+                changes.push_back(ChangeEvent::Make(grant ? ChangeEvent::kUserGrantRole : ChangeEvent::kUserRevokeRole,
+                                                    app_code, uid, key));
+            }
+        }
+        insertChangeEvents(conn.get(), changes);
+        conn->commit();
+        conn->setAutoCommit(true);
+        return affected;
+    } catch (const sql::SQLException& e) {
+        try {
+            conn->rollback();
+            conn->setAutoCommit(true);
+        } catch (...) {}
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        last_error_ = std::string(grant ? "批量授权失败: " : "批量撤销失败: ") + e.what();
+        std::cerr << last_error_ << std::endl;
+        return -1;
+    }
+}
+
 bool PermissionDAO::addPermissionToRole(const std::string& app_code,
                                         const std::string& role_key,
                                         const std::string& perm_key) {
+    int64_t app_id = getAppId(app_code);
+    if (app_id == -1) {
+        std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "应用不存在: " + app_code;
+        return false;
+    }
+
     ConnectionGuard conn(this); if (!conn.isValid()) return false;
     try {
         // SQL lookups for IDs might be complex, simplified by subqueries or separate lookups.
@@ -599,10 +1189,9 @@ bool PermissionDAO::addPermissionToRole(const std::string& app_code,
         // 1. Get Role ID
         int64_t role_id = -1;
         {
-            std::unique_ptr<sql::PreparedStatement> estmt(conn->prepareStatement(
-                "SELECT r.id FROM sys_roles r JOIN sys_apps a ON r.app_id = a.id WHERE a.app_code = ? AND r.role_key = ?"
-            ));
-            estmt->setString(1, app_code);
+            TracedStatement estmt(conn, DAO_STATEMENT("add_role_perm_find_role"),
+                "SELECT id FROM sys_roles WHERE app_id = ? AND role_key = ?");
+            estmt->setInt64(1, app_id);
             estmt->setString(2, role_key);
             std::unique_ptr<sql::ResultSet> res(estmt->executeQuery());
             if (res->next()) role_id = res->getInt64("id");
@@ -612,10 +1201,9 @@ bool PermissionDAO::addPermissionToRole(const std::string& app_code,
         // 2. Get Permission ID
         int64_t perm_id = -1;
         {
-            std::unique_ptr<sql::PreparedStatement> estmt(conn->prepareStatement(
-                "SELECT p.id FROM sys_permissions p JOIN sys_apps a ON p.app_id = a.id WHERE a.app_code = ? AND p.perm_key = ?"
-            ));
-            estmt->setString(1, app_code);
+            TracedStatement estmt(conn, DAO_STATEMENT("add_role_perm_find_perm"),
+                "SELECT id FROM sys_permissions WHERE app_id = ? AND perm_key = ?");
+            estmt->setInt64(1, app_id);
             estmt->setString(2, perm_key);
             std::unique_ptr<sql::ResultSet> res(estmt->executeQuery());
             if (res->next()) perm_id = res->getInt64("id");
@@ -623,14 +1211,21 @@ bool PermissionDAO::addPermissionToRole(const std::string& app_code,
         }
 
         // 3. Insert
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement("INSERT INTO sys_role_permissions (role_id, perm_id) VALUES (?, ?)")
-        );
+        TracedStatement pstmt(conn, DAO_STATEMENT("add_role_perm_insert"),
+            "INSERT INTO sys_role_permissions (role_id, perm_id) VALUES (?, ?)");
         pstmt->setInt64(1, role_id);
         pstmt->setInt64(2, perm_id);
+        conn->setAutoCommit(false);
         pstmt->executeUpdate();
+        insertChangeEvents(conn.get(), {ChangeEvent::Make(ChangeEvent::kRoleAddPerm, app_code, "", role_key, perm_key)});
+        conn->commit();
+        conn->setAutoCommit(true);
         return true;
     } catch (const sql::SQLException& e) {
+        try {
+            conn->rollback();
+            conn->setAutoCommit(true);
+        } catch (...) {}
         std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "添加角色权限失败: " + std::string(e.what());
         return false;
     }
@@ -639,24 +1234,34 @@ bool PermissionDAO::addPermissionToRole(const std::string& app_code,
 bool PermissionDAO::removePermissionFromRole(const std::string& app_code,
                                              const std::string& role_key,
                                              const std::string& perm_key) {
+    int64_t app_id = getAppId(app_code);
+    if (app_id == -1) return false;
+
     ConnectionGuard conn(this); if (!conn.isValid()) return false;
     try {
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement(
-                "DELETE rp FROM sys_role_permissions rp "
-                "JOIN sys_roles r ON rp.role_id = r.id "
-                "JOIN sys_permissions p ON rp.perm_id = p.id "
-                "JOIN sys_apps a ON r.app_id = a.id "
-                "WHERE a.app_code = ? AND r.role_key = ? AND p.perm_key = ?"
-            )
-        );
-        pstmt->setString(1, app_code);
+        TracedStatement pstmt(conn, DAO_STATEMENT("remove_role_perm"),
+            "DELETE rp FROM sys_role_permissions rp "
+            "JOIN sys_roles r ON rp.role_id = r.id "
+            "JOIN sys_permissions p ON rp.perm_id = p.id "
+            "WHERE r.app_id = ? AND r.role_key = ? AND p.perm_key = ?");
+        pstmt->setInt64(1, app_id);
         pstmt->setString(2, role_key);
         pstmt->setString(3, perm_key);
-        
+
+        conn->setAutoCommit(false);
         int rows = pstmt->executeUpdate();
+        if (rows > 0) {
+            insertChangeEvents(conn.get(),
+                               {ChangeEvent::Make(ChangeEvent::kRoleRemovePerm, app_code, "", role_key, perm_key)});
+        }
+        conn->commit();
+        conn->setAutoCommit(true);
         return rows > 0;
     } catch (const sql::SQLException& e) {
+        try {
+            conn->rollback();
+            conn->setAutoCommit(true);
+        } catch (...) {}
         std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "移除角色权限失败: " + std::string(e.what());
         return false;
     }
@@ -674,13 +1279,10 @@ bool PermissionDAO::createAuditLog(int64_t operator_id,
                                    const std::string& object_name) {
     ConnectionGuard conn(this); if (!conn.isValid()) return false;
     try {
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement(
-                "INSERT INTO sys_audit_logs "
-                "(operator_id, operator_name, app_code, action, target_type, target_id, target_name, object_type, object_id, object_name) "
-                "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?)"
-            )
-        );
+        TracedStatement pstmt(conn, DAO_STATEMENT("create_audit_log"),
+            "INSERT INTO sys_audit_logs "
+            "(operator_id, operator_name, app_code, action, target_type, target_id, target_name, object_type, object_id, object_name) "
+            "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
         pstmt->setInt64(1, operator_id);
         pstmt->setString(2, operator_name);
         pstmt->setString(3, app_code);
@@ -701,6 +1303,48 @@ bool PermissionDAO::createAuditLog(int64_t operator_id,
     }
 }
 
+bool PermissionDAO::createAuditLogs(const std::vector<AuditLogInfo>& logs) {
+    if (logs.empty()) return true;
+    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+    try {
+        // 所有分块在同一事务内：失败时整体回滚，AuditWriter 落盘整批重放也不会产生重复记录
+        conn->setAutoCommit(false);
+        for (size_t begin = 0; begin < logs.size(); begin += kBatchChunkRows) {
+            size_t n = std::min(kBatchChunkRows, logs.size() - begin);
+            TracedStatement pstmt(conn, DAO_STATEMENT("create_audit_logs"),
+                "INSERT INTO sys_audit_logs "
+                "(operator_id, operator_name, app_code, action, target_type, target_id, target_name, object_type, object_id, object_name, created_at) "
+                "VALUES " + repeatRow("(?,?,?,?,?,?,?,?,?,?,COALESCE(NULLIF(?, ''), NOW()))", n));
+            int idx = 1;
+            for (size_t i = begin; i < begin + n; ++i) {
+                const AuditLogInfo& log = logs[i];
+                pstmt->setInt64(idx++, log.operator_id);
+                pstmt->setString(idx++, log.operator_name);
+                pstmt->setString(idx++, log.app_code);
+                pstmt->setString(idx++, log.action);
+                pstmt->setString(idx++, log.target_type);
+                pstmt->setString(idx++, log.target_id);
+                pstmt->setString(idx++, log.target_name);
+                pstmt->setString(idx++, log.object_type);
+                pstmt->setString(idx++, log.object_id);
+                pstmt->setString(idx++, log.object_name);
+                pstmt->setString(idx++, log.created_at);
+            }
+            pstmt->executeUpdate();
+        }
+        conn->commit();
+        conn->setAutoCommit(true);
+        return true;
+    } catch (const sql::SQLException& e) {
+        try {
+            conn->rollback();
+            conn->setAutoCommit(true);
+        } catch (...) {}
+        std::cerr << "批量审计日志记录失败 (" << logs.size() << " 条): " << e.what() << std::endl;
+        return false;
+    }
+}
+
 bool PermissionDAO::deleteRole(const std::string& app_code, const std::string& role_key) {
     ConnectionGuard conn(this); if (!conn.isValid()) return false;
     try {
@@ -710,21 +1354,27 @@ bool PermissionDAO::deleteRole(const std::string& app_code, const std::string& r
             return false;
         }
 
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement(
-                "DELETE FROM sys_roles WHERE app_id = ? AND role_key = ?"
-            )
-        );
+        TracedStatement pstmt(conn, DAO_STATEMENT("delete_role"), "DELETE FROM sys_roles WHERE app_id = ? AND role_key = ?");
         pstmt->setInt64(1, app_id);
         pstmt->setString(2, role_key);
-        
+
+        conn->setAutoCommit(false);
         int rows = pstmt->executeUpdate();
+        if (rows > 0) {
+            insertChangeEvents(conn.get(), {ChangeEvent::Make(ChangeEvent::kRoleDelete, app_code, "", role_key)});
+        }
+        conn->commit();
+        conn->setAutoCommit(true);
         if (rows == 0) {
             std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "角色不存在或已删除";
             return false;
         }
         return true;
     } catch (const sql::SQLException& e) {
+        try {
+            conn->rollback();
+            conn->setAutoCommit(true);
+        } catch (...) {}
         std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "删除角色失败: " + std::string(e.what());
         return false;
     }
@@ -739,21 +1389,28 @@ bool PermissionDAO::deletePermission(const std::string& app_code, const std::str
             return false;
         }
 
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement(
-                "DELETE FROM sys_permissions WHERE app_id = ? AND perm_key = ?"
-            )
-        );
+        TracedStatement pstmt(conn, DAO_STATEMENT("delete_permission"),
+            "DELETE FROM sys_permissions WHERE app_id = ? AND perm_key = ?");
         pstmt->setInt64(1, app_id);
         pstmt->setString(2, perm_key);
-        
+
+        conn->setAutoCommit(false);
         int rows = pstmt->executeUpdate();
+        if (rows > 0) {
+            insertChangeEvents(conn.get(), {ChangeEvent::Make(ChangeEvent::kPermDelete, app_code, "", "", perm_key)});
+        }
+        conn->commit();
+        conn->setAutoCommit(true);
         if (rows == 0) {
             std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "权限不存在或已删除";
             return false;
         }
         return true;
     } catch (const sql::SQLException& e) {
+        try {
+            conn->rollback();
+            conn->setAutoCommit(true);
+        } catch (...) {}
         std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "删除权限失败: " + std::string(e.what());
         return false;
     }
@@ -761,23 +1418,20 @@ bool PermissionDAO::deletePermission(const std::string& app_code, const std::str
 
 std::vector<PermissionDAO::RoleInfo> PermissionDAO::listRoles(const std::string& app_code) {
     std::vector<RoleInfo> roles;
-    ConnectionGuard conn(this); if (!conn.isValid()) return roles;
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return roles;
     try {
         int64_t app_id = getAppId(app_code);
         if (app_id == -1) return roles;
 
         // 使用 LEFT JOIN 和 GROUP_CONCAT 一次性查出角色及其权限列表，避免 N+1 查询
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement(
-                "SELECT r.id, r.role_name, r.role_key, r.description, r.is_default, "
-                "GROUP_CONCAT(p.perm_key) as perm_keys "
-                "FROM sys_roles r "
-                "LEFT JOIN sys_role_permissions rp ON r.id = rp.role_id "
-                "LEFT JOIN sys_permissions p ON rp.perm_id = p.id "
-                "WHERE r.app_id = ? "
-                "GROUP BY r.id"
-            )
-        );
+        TracedStatement pstmt(conn, DAO_STATEMENT("list_roles"),
+            "SELECT r.id, r.role_name, r.role_key, r.description, r.is_default, "
+            "GROUP_CONCAT(p.perm_key) as perm_keys "
+            "FROM sys_roles r "
+            "LEFT JOIN sys_role_permissions rp ON r.id = rp.role_id "
+            "LEFT JOIN sys_permissions p ON rp.perm_id = p.id "
+            "WHERE r.app_id = ? "
+            "GROUP BY r.id");
         pstmt->setInt64(1, app_id);
         std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
         
@@ -808,16 +1462,13 @@ std::vector<PermissionDAO::RoleInfo> PermissionDAO::listRoles(const std::string&
 
 std::vector<PermissionDAO::PermInfo> PermissionDAO::listPermissions(const std::string& app_code) {
     std::vector<PermInfo> perms;
-    ConnectionGuard conn(this); if (!conn.isValid()) return perms;
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return perms;
     try {
         int64_t app_id = getAppId(app_code);
         if (app_id == -1) return perms;
 
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement(
-                "SELECT id, perm_name, perm_key, description FROM sys_permissions WHERE app_id = ?"
-            )
-        );
+        TracedStatement pstmt(conn, DAO_STATEMENT("list_permissions"),
+            "SELECT id, perm_name, perm_key, description FROM sys_permissions WHERE app_id = ?");
         pstmt->setInt64(1, app_id);
         std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
         
@@ -854,7 +1505,7 @@ bool PermissionDAO::updateRole(const std::string& app_code,
         if (is_default) sql += ", is_default=?";
         sql += " WHERE app_id=? AND role_key=?";
 
-        std::unique_ptr<sql::PreparedStatement> pstmt(conn->prepareStatement(sql));
+        TracedStatement pstmt(conn, DAO_STATEMENT("update_role"), sql);
 
         int idx = 1;
         if (role_name) pstmt->setString(idx++, *role_name);
@@ -892,7 +1543,7 @@ bool PermissionDAO::updatePermission(const std::string& app_code,
         if (description) sql += ", description=?";
         sql += " WHERE app_id=? AND perm_key=?";
 
-        std::unique_ptr<sql::PreparedStatement> pstmt(conn->prepareStatement(sql));
+        TracedStatement pstmt(conn, DAO_STATEMENT("update_permission"), sql);
 
         int idx = 1;
         if (perm_name) pstmt->setString(idx++, *perm_name);
@@ -910,11 +1561,10 @@ bool PermissionDAO::updatePermission(const std::string& app_code,
 
 PermissionDAO::ConsoleUser PermissionDAO::getConsoleUser(const std::string& username) {
     ConsoleUser user;
-    ConnectionGuard conn(this); if (!conn.isValid()) return user;
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return user;
     try {
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement("SELECT id, username, password_hash, real_name FROM sys_console_users WHERE username = ?")
-        );
+        TracedStatement pstmt(conn, DAO_STATEMENT("get_console_user"),
+            "SELECT id, username, password_hash, real_name FROM sys_console_users WHERE username = ?");
         pstmt->setString(1, username);
         std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
         if (res->next()) {
@@ -937,19 +1587,16 @@ std::string PermissionDAO::getConsoleUserHash(const std::string& username) {
 std::vector<std::string> PermissionDAO::getRolePermissions(const std::string& app_code,
                                                            const std::string& role_key) {
     std::vector<std::string> perms;
-    ConnectionGuard conn(this); if (!conn.isValid()) return perms;
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return perms;
     try {
         int64_t app_id = getAppId(app_code);
         if (app_id == -1) return perms;
 
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement(
-                "SELECT p.perm_key FROM sys_role_permissions rp "
-                "JOIN sys_roles r ON rp.role_id = r.id "
-                "JOIN sys_permissions p ON rp.perm_id = p.id "
-                "WHERE r.app_id = ? AND r.role_key = ?"
-            )
-        );
+        TracedStatement pstmt(conn, DAO_STATEMENT("get_role_permissions"),
+            "SELECT p.perm_key FROM sys_role_permissions rp "
+            "JOIN sys_roles r ON rp.role_id = r.id "
+            "JOIN sys_permissions p ON rp.perm_id = p.id "
+            "WHERE r.app_id = ? AND r.role_key = ?");
         pstmt->setInt64(1, app_id);
         pstmt->setString(2, role_key);
         std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
@@ -966,19 +1613,16 @@ std::vector<std::string> PermissionDAO::getRolePermissions(const std::string& ap
 std::vector<std::string> PermissionDAO::getRolesWithPermission(const std::string& app_code,
                                                                const std::string& perm_key) {
     std::vector<std::string> roles;
-    ConnectionGuard conn(this); if (!conn.isValid()) return roles;
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return roles;
     try {
         int64_t app_id = getAppId(app_code);
         if (app_id == -1) return roles;
 
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement(
-                "SELECT r.role_key FROM sys_roles r "
-                "JOIN sys_role_permissions rp ON r.id = rp.role_id "
-                "JOIN sys_permissions p ON rp.perm_id = p.id "
-                "WHERE r.app_id = ? AND p.perm_key = ?"
-            )
-        );
+        TracedStatement pstmt(conn, DAO_STATEMENT("get_roles_with_permission"),
+            "SELECT r.role_key FROM sys_roles r "
+            "JOIN sys_role_permissions rp ON r.id = rp.role_id "
+            "JOIN sys_permissions p ON rp.perm_id = p.id "
+            "WHERE r.app_id = ? AND p.perm_key = ?");
         pstmt->setInt64(1, app_id);
         pstmt->setString(2, perm_key);
         std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
@@ -997,14 +1641,13 @@ bool PermissionDAO::appExists(const std::string& app_code) {
 }
 
 bool PermissionDAO::permissionExists(const std::string& app_code, const std::string& perm_key) {
-    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return false;
     try {
         int64_t app_id = getAppId(app_code);
         if (app_id == -1) return false;
 
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement("SELECT id FROM sys_permissions WHERE app_id = ? AND perm_key = ?")
-        );
+        TracedStatement pstmt(conn, DAO_STATEMENT("permission_exists"),
+            "SELECT id FROM sys_permissions WHERE app_id = ? AND perm_key = ?");
         pstmt->setInt64(1, app_id);
         pstmt->setString(2, perm_key);
         std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
@@ -1017,51 +1660,70 @@ bool PermissionDAO::permissionExists(const std::string& app_code, const std::str
 std::vector<PermissionDAO::UserInfo> PermissionDAO::getRoleUsers(const std::string& app_code,
                                                                  const std::string& role_key,
                                                                  int32_t page, int32_t page_size,
-                                                                 int64_t& out_total) {
+                                                                 int64_t& out_total,
+                                                                 const PageCursor* after,
+                                                                 TotalMode total_mode,
+                                                                 PageCursor* out_next) {
     std::vector<UserInfo> users;
     out_total = 0;
-    ConnectionGuard conn(this); if (!conn.isValid()) return users;
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return users;
     try {
         int64_t app_id = getAppId(app_code);
         if (app_id == -1) return users;
 
-        // Get total count
-        std::unique_ptr<sql::PreparedStatement> count_stmt(
-            conn->prepareStatement(
-                "SELECT COUNT(*) as total FROM sys_user_roles ur "
-                "JOIN sys_roles r ON ur.role_id = r.id "
-                "WHERE r.app_id = ? AND r.role_key = ?"
-            )
-        );
-        count_stmt->setInt64(1, app_id);
-        count_stmt->setString(2, role_key);
-        std::unique_ptr<sql::ResultSet> count_res(count_stmt->executeQuery());
-        if (count_res->next()) {
-            out_total = count_res->getInt64("total");
-        }
+        // sys_roles 按唯一键 (app_id, role_key) 命中单行，sys_user_roles 走 idx_role_query (role_id, created_at)
+        const std::string base_sql =
+            "FROM sys_user_roles ur "
+            "JOIN sys_roles r ON ur.role_id = r.id "
+            "WHERE r.app_id = ? AND r.role_key = ?";
+        const std::string select_sql = "SELECT ur.id, ur.app_user_id, ur.created_at " + base_sql;
+
+        out_total = countTotal(conn.get(), DAO_STATEMENT("get_role_users_count"),
+                               DAO_STATEMENT("get_role_users_estimate"), total_mode,
+                               "SELECT COUNT(*) as total " + base_sql, select_sql,
+                               [&](TracedStatement* stmt) {
+                                   stmt->setInt64(1, app_id);
+                                   stmt->setString(2, role_key);
+                               });
 
         // Get paginated data
-        int32_t offset = (page - 1) * page_size;
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement(
-                "SELECT ur.app_user_id, ur.created_at FROM sys_user_roles ur "
-                "JOIN sys_roles r ON ur.role_id = r.id "
-                "WHERE r.app_id = ? AND r.role_key = ? "
-                "ORDER BY ur.created_at DESC LIMIT ? OFFSET ?"
-            )
-        );
-        pstmt->setInt64(1, app_id);
-        pstmt->setString(2, role_key);
-        pstmt->setInt(3, page_size);
-        pstmt->setInt(4, offset);
+        std::string data_sql = select_sql;
+        if (after) {
+            data_sql += " AND (ur.created_at < ? OR (ur.created_at = ? AND ur.id < ?))";
+        }
+        data_sql += " ORDER BY ur.created_at DESC, ur.id DESC LIMIT ?";
+        if (!after) {
+            data_sql += " OFFSET ?";
+        }
+        TracedStatement pstmt(conn, DAO_STATEMENT("get_role_users"), data_sql);
+        int idx = 1;
+        pstmt->setInt64(idx++, app_id);
+        pstmt->setString(idx++, role_key);
+        if (after) {
+            pstmt->setString(idx++, after->created_at);
+            pstmt->setString(idx++, after->created_at);
+            pstmt->setInt64(idx++, after->id);
+        }
+        pstmt->setInt(idx++, page_size);
+        if (!after) {
+            pstmt->setInt(idx++, (page - 1) * page_size);
+        }
         std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
-        
+
+        int64_t last_id = 0;
         while (res->next()) {
             UserInfo user;
             user.user_id = res->getString("app_user_id");
             user.created_at = res->getString("created_at");
+            last_id = res->getInt64("id");
             users.push_back(user);
         }
+
+        if (out_next && !users.empty() && users.size() == static_cast<size_t>(page_size)) {
+            out_next->created_at = users.back().created_at;
+            out_next->id = last_id;
+            out_next->key.clear();
+        }
     } catch (const sql::SQLException& e) {
         std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "查询角色用户失败: " + std::string(e.what());
     }
@@ -1071,85 +1733,103 @@ std::vector<PermissionDAO::UserInfo> PermissionDAO::getRoleUsers(const std::stri
 std::vector<PermissionDAO::UserRoleData> PermissionDAO::listUserRoles(const std::string& app_code,
                                                                       int32_t page, int32_t page_size,
                                                                       const std::string* user_id,
-                                                                      int64_t& out_total) {
+                                                                      int64_t& out_total,
+                                                                      const PageCursor* after,
+                                                                      TotalMode total_mode,
+                                                                      PageCursor* out_next) {
     std::vector<UserRoleData> users;
     out_total = 0;
-    ConnectionGuard conn(this); if (!conn.isValid()) return users;
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return users;
     try {
         int64_t app_id = getAppId(app_code);
         if (app_id == -1) return users;
 
+        bool has_user = user_id && !user_id->empty();
         std::string base_sql = "FROM sys_user_roles WHERE app_id = ?";
-        if (user_id && !user_id->empty()) {
+        if (has_user) {
             base_sql += " AND app_user_id = ?";
         }
+        auto bind_filters = [&](TracedStatement* stmt) {
+            stmt->setInt64(1, app_id);
+            if (has_user) {
+                stmt->setString(2, *user_id);
+            }
+        };
 
         // Get total count (distinct users)
-        std::unique_ptr<sql::PreparedStatement> count_stmt(
-            conn->prepareStatement("SELECT COUNT(DISTINCT app_user_id) as total " + base_sql)
-        );
-        count_stmt->setInt64(1, app_id);
-        if (user_id && !user_id->empty()) {
-            count_stmt->setString(2, *user_id);
-        }
-        std::unique_ptr<sql::ResultSet> count_res(count_stmt->executeQuery());
-        if (count_res->next()) {
-            out_total = count_res->getInt64("total");
-        }
-
-        // Get paginated data
-        int32_t offset = (page - 1) * page_size;
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement(
-                "SELECT ur.app_user_id, "
-                "GROUP_CONCAT(DISTINCT r.role_key) as role_keys, "
-                "GROUP_CONCAT(DISTINCT p.perm_key) as perm_keys, "
-                "MIN(ur.created_at) as created_at "
-                "FROM sys_user_roles ur "
-                "JOIN sys_roles r ON ur.role_id = r.id "
-                "LEFT JOIN sys_role_permissions rp ON r.id = rp.role_id "
-                "LEFT JOIN sys_permissions p ON rp.perm_id = p.id "
-                "WHERE ur.app_id = ? " + 
-                (user_id && !user_id->empty() ? std::string("AND ur.app_user_id = ? ") : std::string("")) +
+        out_total = countTotal(conn.get(), DAO_STATEMENT("list_user_roles_count"),
+                               DAO_STATEMENT("list_user_roles_estimate"), total_mode,
+                               "SELECT COUNT(DISTINCT app_user_id) as total " + base_sql,
+                               "SELECT DISTINCT app_user_id " + base_sql, bind_filters);
+
+        const std::string select_sql =
+            "SELECT ur.app_user_id, "
+            "GROUP_CONCAT(DISTINCT r.role_key) as role_keys, "
+            "GROUP_CONCAT(DISTINCT p.perm_key) as perm_keys, "
+            "MIN(ur.created_at) as created_at "
+            "FROM sys_user_roles ur "
+            "JOIN sys_roles r ON ur.role_id = r.id "
+            "LEFT JOIN sys_role_permissions rp ON r.id = rp.role_id "
+            "LEFT JOIN sys_permissions p ON rp.perm_id = p.id "
+            "WHERE ur.app_id = ? ";
+
+        std::unique_ptr<TracedStatement> pstmt;
+        if (!after) {
+            // Get paginated data
+            pstmt.reset(new TracedStatement(conn, DAO_STATEMENT("list_user_roles"),
+                select_sql +
+                (has_user ? std::string("AND ur.app_user_id = ? ") : std::string("")) +
                 "GROUP BY ur.app_user_id "
-                "ORDER BY created_at DESC LIMIT ? OFFSET ?"
-            )
-        );
-        
-        int idx = 1;
-        pstmt->setInt64(idx++, app_id);
-        if (user_id && !user_id->empty()) {
-            pstmt->setString(idx++, *user_id);
+                "ORDER BY created_at DESC LIMIT ? OFFSET ?"));
+            int idx = 1;
+            pstmt->setInt64(idx++, app_id);
+            if (has_user) {
+                pstmt->setString(idx++, *user_id);
+            }
+            pstmt->setInt(idx++, page_size);
+            pstmt->setInt(idx++, (page - 1) * page_size);
+        } else {
+            // 游标分页：先沿 idx_user_query (app_id, app_user_id) seek 出本页的用户，
+            // 再只对这些用户做聚合，避免对全表分组后再截取
+            TracedStatement id_stmt(conn, DAO_STATEMENT("list_user_roles_seek_users"),
+                "SELECT DISTINCT app_user_id " + base_sql +
+                " AND app_user_id > ? ORDER BY app_user_id LIMIT ?");
+            bind_filters(&id_stmt);
+            int idx = has_user ? 3 : 2;
+            id_stmt->setString(idx++, after->key);
+            id_stmt->setInt(idx++, page_size);
+            std::unique_ptr<sql::ResultSet> id_res(id_stmt->executeQuery());
+            std::vector<std::string> page_users;
+            while (id_res->next()) {
+                page_users.push_back(id_res->getString("app_user_id"));
+            }
+            if (page_users.empty()) return users;
+
+            pstmt.reset(new TracedStatement(conn, DAO_STATEMENT("list_user_roles_by_users"),
+                select_sql + "AND ur.app_user_id IN " + makePlaceholders(1, page_users.size()) +
+                " GROUP BY ur.app_user_id ORDER BY ur.app_user_id"));
+            idx = 1;
+            pstmt->setInt64(idx++, app_id);
+            for (const auto& uid : page_users) {
+                pstmt->setString(idx++, uid);
+            }
         }
-        pstmt->setInt(idx++, page_size);
-        pstmt->setInt(idx++, offset);
-        
+
         std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
-        
         while (res->next()) {
             UserRoleData data;
             data.user_id = res->getString("app_user_id");
             data.created_at = res->getString("created_at");
-            
-            std::string roles_str = res->getString("role_keys");
-            if (!roles_str.empty()) {
-                std::stringstream ss(roles_str);
-                std::string item;
-                while (std::getline(ss, item, ',')) {
-                    data.role_keys.push_back(item);
-                }
-            }
-            
-            std::string perms_str = res->getString("perm_keys");
-            if (!perms_str.empty()) {
-                std::stringstream ss(perms_str);
-                std::string item;
-                while (std::getline(ss, item, ',')) {
-                    data.perm_keys.push_back(item);
-                }
-            }
+            data.role_keys = splitCsv(res->getString("role_keys"));
+            data.perm_keys = splitCsv(res->getString("perm_keys"));
             users.push_back(data);
         }
+
+        if (out_next && !users.empty() && users.size() == static_cast<size_t>(page_size)) {
+            out_next->created_at.clear();
+            out_next->id = 0;
+            out_next->key = users.back().user_id;
+        }
     } catch (const sql::SQLException& e) {
         std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "查询用户角色列表失败: " + std::string(e.what());
     }
@@ -1163,10 +1843,13 @@ std::vector<PermissionDAO::AuditLogInfo> PermissionDAO::listAuditLogs(int32_t pa
                                                                       const std::string* target_id,
                                                                       const int64_t* start_time,
                                                                       const int64_t* end_time,
-                                                                      int64_t& out_total) {
+                                                                      int64_t& out_total,
+                                                                      const PageCursor* after,
+                                                                      TotalMode total_mode,
+                                                                      PageCursor* out_next) {
     std::vector<AuditLogInfo> logs;
     out_total = 0;
-    ConnectionGuard conn(this); if (!conn.isValid()) return logs;
+    ConnectionGuard conn(this, Access::kRead); if (!conn.isValid()) return logs;
     try {
         std::string base_sql = "FROM sys_audit_logs WHERE 1=1";
         if (app_code && !app_code->empty()) base_sql += " AND app_code = ?";
@@ -1176,43 +1859,51 @@ std::vector<PermissionDAO::AuditLogInfo> PermissionDAO::listAuditLogs(int32_t pa
         if (start_time) base_sql += " AND created_at >= FROM_UNIXTIME(?)";
         if (end_time) base_sql += " AND created_at <= FROM_UNIXTIME(?)";
 
-        // Get total count
-        std::unique_ptr<sql::PreparedStatement> count_stmt(
-            conn->prepareStatement("SELECT COUNT(*) as total " + base_sql)
-        );
-        
-        int idx = 1;
-        if (app_code && !app_code->empty()) count_stmt->setString(idx++, *app_code);
-        if (action && !action->empty()) count_stmt->setString(idx++, *action);
-        if (operator_id && !operator_id->empty()) count_stmt->setString(idx++, *operator_id);
-        if (target_id && !target_id->empty()) count_stmt->setString(idx++, *target_id);
-        if (start_time) count_stmt->setInt64(idx++, *start_time);
-        if (end_time) count_stmt->setInt64(idx++, *end_time);
-        
-        std::unique_ptr<sql::ResultSet> count_res(count_stmt->executeQuery());
-        if (count_res->next()) {
-            out_total = count_res->getInt64("total");
-        }
+        // 绑定过滤条件，返回下一个参数下标
+        auto bind_filters = [&](TracedStatement* stmt) {
+            int idx = 1;
+            if (app_code && !app_code->empty()) stmt->setString(idx++, *app_code);
+            if (action && !action->empty()) stmt->setString(idx++, *action);
+            if (operator_id && !operator_id->empty()) stmt->setString(idx++, *operator_id);
+            if (target_id && !target_id->empty()) stmt->setString(idx++, *target_id);
+            if (start_time) stmt->setInt64(idx++, *start_time);
+            if (end_time) stmt->setInt64(idx++, *end_time);
+            return idx;
+        };
+
+        const std::string select_sql =
+            "SELECT id, operator_id, operator_name, app_code, action, "
+            "target_type, target_id, target_name, object_type, object_id, object_name, created_at "
+            + base_sql;
+
+        out_total = countTotal(conn.get(), DAO_STATEMENT("list_audit_logs_count"),
+                               DAO_STATEMENT("list_audit_logs_estimate"), total_mode,
+                               "SELECT COUNT(*) as total " + base_sql, select_sql,
+                               [&](TracedStatement* stmt) { bind_filters(stmt); });
 
         // Get paginated data
-        int32_t offset = (page - 1) * page_size;
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            conn->prepareStatement(
-                "SELECT id, operator_id, operator_name, app_code, action, "
-                "target_type, target_id, target_name, object_type, object_id, object_name, created_at "
-                + base_sql + " ORDER BY created_at DESC LIMIT ? OFFSET ?"
-            )
-        );
-        
-        idx = 1;
-        if (app_code && !app_code->empty()) pstmt->setString(idx++, *app_code);
-        if (action && !action->empty()) pstmt->setString(idx++, *action);
-        if (operator_id && !operator_id->empty()) pstmt->setString(idx++, *operator_id);
-        if (target_id && !target_id->empty()) pstmt->setString(idx++, *target_id);
-        if (start_time) pstmt->setInt64(idx++, *start_time);
-        if (end_time) pstmt->setInt64(idx++, *end_time);
+        std::string data_sql = select_sql;
+        if (after) {
+            // 单独的 created_at <= ? 让优化器可以据此裁剪掉更新的月分区
+            data_sql += " AND created_at <= ? AND (created_at < ? OR (created_at = ? AND id < ?))";
+        }
+        data_sql += " ORDER BY created_at DESC, id DESC LIMIT ?";
+        if (!after) {
+            data_sql += " OFFSET ?";
+        }
+        TracedStatement pstmt(conn, DAO_STATEMENT("list_audit_logs"), data_sql);
+
+        int idx = bind_filters(&pstmt);
+        if (after) {
+            pstmt->setString(idx++, after->created_at);
+            pstmt->setString(idx++, after->created_at);
+            pstmt->setString(idx++, after->created_at);
+            pstmt->setInt64(idx++, after->id);
+        }
         pstmt->setInt(idx++, page_size);
-        pstmt->setInt(idx++, offset);
+        if (!after) {
+            pstmt->setInt(idx++, (page - 1) * page_size);
+        }
         
         std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
         
@@ -1232,8 +1923,253 @@ std::vector<PermissionDAO::AuditLogInfo> PermissionDAO::listAuditLogs(int32_t pa
             log.created_at = res->getString("created_at");
             logs.push_back(log);
         }
+
+        if (out_next && !logs.empty() && logs.size() == static_cast<size_t>(page_size)) {
+            out_next->created_at = logs.back().created_at;
+            out_next->id = logs.back().id;
+            out_next->key.clear();
+        }
     } catch (const sql::SQLException& e) {
         std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "查询审计日志失败: " + std::string(e.what());
     }
     return logs;
 }
+
+std::vector<PermissionDAO::AuditPartition> PermissionDAO::listAuditPartitions() {
+    std::vector<AuditPartition> parts;
+    ConnectionGuard conn(this); if (!conn.isValid()) return parts;
+    try {
+        TracedStatement stmt(conn, DAO_STATEMENT("list_audit_partitions"),
+            "SELECT PARTITION_NAME, PARTITION_DESCRIPTION, TABLE_ROWS "
+            "FROM information_schema.PARTITIONS "
+            "WHERE TABLE_SCHEMA = DATABASE() AND TABLE_NAME = 'sys_audit_logs' "
+            "AND PARTITION_NAME IS NOT NULL "
+            "ORDER BY PARTITION_ORDINAL_POSITION");
+        std::unique_ptr<sql::ResultSet> res(stmt->executeQuery());
+        while (res->next()) {
+            AuditPartition part;
+            part.name = res->getString("PARTITION_NAME");
+            // RANGE COLUMNS 的上界形如 '2026-11-01 00:00:00'（带引号）
+            std::string desc = res->getString("PARTITION_DESCRIPTION");
+            if (desc != "MAXVALUE") {
+                desc.erase(std::remove(desc.begin(), desc.end(), '\''), desc.end());
+                part.less_than = desc;
+            }
+            part.rows = res->getInt64("TABLE_ROWS");
+            parts.push_back(part);
+        }
+    } catch (const sql::SQLException& e) {
+        std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "查询审计日志分区失败: " + std::string(e.what());
+    }
+    return parts;
+}
+
+bool PermissionDAO::addAuditPartitions(const std::vector<AuditPartition>& parts) {
+    if (parts.empty()) return true;
+    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+    try {
+        std::string sql = "ALTER TABLE sys_audit_logs REORGANIZE PARTITION pmax INTO (";
+        for (const auto& part : parts) {
+            if (!isValidPartitionName(part.name) || part.less_than.empty()) {
+                std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "非法的分区定义: " + part.name;
+                return false;
+            }
+            sql += "PARTITION " + part.name + " VALUES LESS THAN ('" + part.less_than + "'), ";
+        }
+        sql += "PARTITION pmax VALUES LESS THAN (MAXVALUE))";
+
+        TracedStatement stmt(conn, DAO_STATEMENT("add_audit_partitions"), sql);
+        stmt->execute();
+        return true;
+    } catch (const sql::SQLException& e) {
+        std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "创建审计日志分区失败: " + std::string(e.what());
+        return false;
+    }
+}
+
+bool PermissionDAO::exportAuditPartition(const std::string& partition,
+                                         const std::function<bool(const AuditLogInfo&)>& fn,
+                                         int64_t& out_rows) {
+    out_rows = 0;
+    if (!isValidPartitionName(partition)) {
+        std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "非法的分区名: " + partition;
+        return false;
+    }
+    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+    try {
+        const std::string columns =
+            "SELECT id, operator_id, operator_name, app_code, action, "
+            "target_type, target_id, target_name, object_type, object_id, object_name, created_at "
+            "FROM sys_audit_logs PARTITION (" + partition + ")";
+        TracedStatement first_stmt(conn, DAO_STATEMENT("export_audit_partition_first"),
+            columns + " ORDER BY created_at DESC, id DESC LIMIT ?");
+        TracedStatement next_stmt(conn, DAO_STATEMENT("export_audit_partition_next"),
+            columns + " WHERE created_at <= ? AND (created_at < ? OR (created_at = ? AND id < ?)) "
+            "ORDER BY created_at DESC, id DESC LIMIT ?");
+
+        // 结果集会整体缓存在客户端，按 (created_at, id) 分块 seek，避免一次读入整个分区
+        std::string last_created_at;
+        int64_t last_id = 0;
+        bool first = true;
+        while (true) {
+            TracedStatement* stmt = first ? &first_stmt : &next_stmt;
+            int idx = 1;
+            if (!first) {
+                stmt->setString(idx++, last_created_at);
+                stmt->setString(idx++, last_created_at);
+                stmt->setString(idx++, last_created_at);
+                stmt->setInt64(idx++, last_id);
+            }
+            stmt->setInt(idx++, kExportChunkRows);
+            std::unique_ptr<sql::ResultSet> res(stmt->executeQuery());
+
+            int rows = 0;
+            while (res->next()) {
+                AuditLogInfo log;
+                log.id = res->getInt64("id");
+                log.operator_id = res->getInt64("operator_id");
+                log.operator_name = res->getString("operator_name");
+                log.app_code = res->getString("app_code");
+                log.action = res->getString("action");
+                log.target_type = res->getString("target_type");
+                log.target_id = res->getString("target_id");
+                log.target_name = res->getString("target_name");
+                log.object_type = res->getString("object_type");
+                log.object_id = res->getString("object_id");
+                log.object_name = res->getString("object_name");
+                log.created_at = res->getString("created_at");
+                if (!fn(log)) {
+                    return false;
+                }
+                last_created_at = log.created_at;
+                last_id = log.id;
+                ++rows;
+                ++out_rows;
+            }
+            if (rows < kExportChunkRows) break;
+            first = false;
+        }
+        return true;
+    } catch (const sql::SQLException& e) {
+        std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "导出审计日志分区失败: " + std::string(e.what());
+        return false;
+    }
+}
+
+bool PermissionDAO::dropAuditPartition(const std::string& partition) {
+    if (!isValidPartitionName(partition) || partition == "pmax") {
+        std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "非法的分区名: " + partition;
+        return false;
+    }
+    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+    try {
+        TracedStatement stmt(conn, DAO_STATEMENT("drop_audit_partition"), "ALTER TABLE sys_audit_logs DROP PARTITION " + partition);
+        stmt->execute();
+        return true;
+    } catch (const sql::SQLException& e) {
+        std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "删除审计日志分区失败: " + std::string(e.what());
+        return false;
+    }
+}
+
+void PermissionDAO::insertChangeEvents(sql::Connection* conn, const std::vector<ChangeEvent>& events) {
+    for (size_t begin = 0; begin < events.size(); begin += kBatchChunkRows) {
+        size_t n = std::min(kBatchChunkRows, events.size() - begin);
+        TracedStatement pstmt(conn, DAO_STATEMENT("append_change_events"),
+            "INSERT INTO sys_change_log (app_code, event_type, user_id, role_key, perm_key) "
+            "VALUES " + repeatRow("(?,?,?,?,?)", n));
+        int idx = 1;
+        for (size_t i = begin; i < begin + n; ++i) {
+            const ChangeEvent& ev = events[i];
+            pstmt->setString(idx++, ev.app_code);
+            pstmt->setInt(idx++, ev.type);
+            pstmt->setString(idx++, ev.user_id);
+            pstmt->setString(idx++, ev.role_key);
+            pstmt->setString(idx++, ev.perm_key);
+        }
+        pstmt->executeUpdate();
+    }
+}
+
+bool PermissionDAO::fetchChangeEvents(int64_t after_seq, size_t limit, std::vector<ChangeEvent>& out) {
+    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+    try {
+        TracedStatement pstmt(conn, DAO_STATEMENT("fetch_change_events"),
+            "SELECT seq, app_code, event_type, user_id, role_key, perm_key, UNIX_TIMESTAMP(created_at) AS ts "
+            "FROM sys_change_log WHERE seq > ? ORDER BY seq LIMIT ?");
+        pstmt->setInt64(1, after_seq);
+        pstmt->setInt64(2, static_cast<int64_t>(limit));
+        std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
+        while (res->next()) {
+            ChangeEvent ev;
+            ev.seq = res->getInt64("seq");
+            ev.app_code = res->getString("app_code");
+            ev.type = res->getInt("event_type");
+            ev.user_id = res->getString("user_id");
+            ev.role_key = res->getString("role_key");
+            ev.perm_key = res->getString("perm_key");
+            ev.timestamp = res->getInt64("ts");
+            out.push_back(std::move(ev));
+        }
+        return true;
+    } catch (const sql::SQLException& e) {
+        std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "读取变更日志失败: " + std::string(e.what());
+        return false;
+    }
+}
+
+bool PermissionDAO::getChangeSeqRange(int64_t& min_seq, int64_t& max_seq) {
+    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+    try {
+        TracedStatement stmt(conn, DAO_STATEMENT("get_change_seq_range"),
+            "SELECT COALESCE(MIN(seq), 0) AS min_seq, COALESCE(MAX(seq), 0) AS max_seq FROM sys_change_log");
+        std::unique_ptr<sql::ResultSet> res(stmt->executeQuery());
+        min_seq = max_seq = 0;
+        if (res->next()) {
+            min_seq = res->getInt64("min_seq");
+            max_seq = res->getInt64("max_seq");
+        }
+        return true;
+    } catch (const sql::SQLException& e) {
+        std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "读取变更日志失败: " + std::string(e.what());
+        return false;
+    }
+}
+
+int64_t PermissionDAO::purgeChangeEvents(int retention_hours, size_t limit) {
+    ConnectionGuard conn(this); if (!conn.isValid()) return -1;
+    try {
+        TracedStatement pstmt(conn, DAO_STATEMENT("purge_change_events"),
+            "DELETE FROM sys_change_log WHERE created_at < NOW() - INTERVAL ? HOUR ORDER BY seq LIMIT ?");
+        pstmt->setInt(1, retention_hours);
+        pstmt->setInt64(2, static_cast<int64_t>(limit));
+        return pstmt->executeUpdate();
+    } catch (const sql::SQLException& e) {
+        std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "清理变更日志失败: " + std::string(e.what());
+        return -1;
+    }
+}
+
+bool PermissionDAO::loadPermissionHandles(std::vector<PermHandle>& out) {
+    ConnectionGuard conn(this); if (!conn.isValid()) return false;
+    try {
+        TracedStatement stmt(conn, DAO_STATEMENT("load_permission_handles"),
+            "SELECT a.id AS app_id, a.app_code, COALESCE(p.id, 0) AS perm_id, COALESCE(p.perm_key, '') AS perm_key "
+            "FROM sys_apps a LEFT JOIN sys_permissions p ON p.app_id = a.id "
+            "ORDER BY a.id, p.id");
+        std::unique_ptr<sql::ResultSet> res(stmt->executeQuery());
+        out.clear();
+        while (res->next()) {
+            PermHandle row;
+            row.app_id = res->getInt64("app_id");
+            row.app_code = res->getString("app_code");
+            row.perm_id = res->getInt64("perm_id");
+            row.perm_key = res->getString("perm_key");
+            out.push_back(std::move(row));
+        }
+        return true;
+    } catch (const sql::SQLException& e) {
+        std::lock_guard<std::mutex> lock(error_mutex_); last_error_ = "加载权限句柄失败: " + std::string(e.what());
+        return false;
+    }
+}
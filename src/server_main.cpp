@@ -2,8 +2,17 @@
 #include <gflags/gflags.h>
 #include "auth_service_impl.h"
 #include "admin_service_impl.h"
-#include "local_cache.h"
+#include "perm_cache.h"
+#include "db_executor.h"
+#include "app_catalog.h"
+#include "cache_invalidator.h"
+#include "memory_permission_store.h"
+#include "dao_stats.h"
+#include "dao_stats_service.h"
+#include "access_log.h"
 #include <unordered_set>
+#include <sstream>
+#include <algorithm>
 
 DEFINE_int32(port, 8888, "TCP Port of this server");
 DEFINE_string(db_host, "localhost", "MySQL host");
@@ -13,34 +22,245 @@ DEFINE_string(db_password, "siqi123", "MySQL password");
 DEFINE_string(db_name, "siqi_auth", "MySQL database name");
 DEFINE_int32(cache_ttl, 60, "Cache TTL in seconds");
 DEFINE_int32(session_ttl, 3600, "Admin session TTL in seconds");
+DEFINE_string(admin_token_key, "", "HMAC-SHA256 key (>= 32 bytes) for stateless admin tokens shared by all server instances; empty keeps in-process sessions");
+DEFINE_int32(login_threads, 4, "Threads verifying admin login passwords (crypt), 0 runs it on bRPC workers");
+DEFINE_int32(login_queue, 64, "Max queued logins waiting for a password thread, overflow is rejected with 503; values below 1 are clamped to 1");
+DEFINE_int32(login_user_per_min, 10, "Max login attempts per username per minute, <= 0 disables");
+DEFINE_int32(login_ip_per_min, 60, "Max login attempts per client IP per minute, <= 0 disables");
+DEFINE_string(cluster_peers, "", "Other auth_server replicas (host:port, comma separated) that receive cache invalidations");
+DEFINE_string(cluster_self, "", "This replica's host:port as listed in cluster_peers, skipped when fanning out");
+DEFINE_string(cluster_key, "", "HMAC-SHA256 key (>= 32 bytes) shared by all replicas; signs pushed invalidations, unsigned ones are rejected");
+DEFINE_int32(cluster_flush_interval_ms, 20, "How long invalidations are batched before being pushed to peers");
+DEFINE_bool(watch_enabled, true, "Serve AuthService.Watch, pushing permission changes recorded in sys_change_log");
+DEFINE_int32(watch_ring_size, 100000, "Recent change events kept in memory for Watch resumption");
+DEFINE_int32(watch_poll_interval_ms, 100, "Interval between polls of sys_change_log for new events");
+DEFINE_int32(watch_gap_timeout_ms, 2000, "Max time to wait for a missing seq (uncommitted transaction) before skipping it");
+DEFINE_int32(watch_max_replay, 100000, "Max events replayed from sys_change_log for a lagging watcher before sending a SNAPSHOT");
+DEFINE_int32(watch_retention_hours, 72, "Hours of sys_change_log kept for resumption, <= 0 disables purging");
+DEFINE_int32(num_threads, -1, "bRPC worker threads (-1 means bRPC default)");
+DEFINE_bool(async_check, false, "Run Check/BatchCheck DB work on a dedicated executor instead of bRPC workers");
+DEFINE_int32(db_executor_threads, 32, "Threads of the DB executor used by async_check");
+DEFINE_int32(db_executor_queue, 10000, "Max queued tasks of the DB executor, overflow falls back to sync");
+DEFINE_string(db_replicas, "", "Read-only MySQL replicas for AuthService, comma separated host:port list");
+DEFINE_int32(db_max_replica_lag, 5, "Replicas lagging more than this many seconds are taken out of rotation");
+DEFINE_int32(dao_slow_query_ms, 200, "SQL statements slower than this are logged with their parameters and listed in /dao_stats, <= 0 disables");
+DEFINE_string(access_log_path, "", "Access log of Check/BatchCheck written by a background thread (e.g. ./access.log), empty disables; the file is not pruned, rotate it externally");
+DEFINE_string(access_log_format, "ndjson", "Access log format: ndjson (one JSON object per line) or binary (fixed-size records)");
+DEFINE_double(access_log_allow_sample, 0.01, "Fraction of allowed requests written to the access log");
+DEFINE_double(access_log_deny_sample, 1.0, "Fraction of denied requests written to the access log");
+DEFINE_int32(access_log_buffer_records, 1024, "Per-thread access log buffer size, records beyond it are dropped until the next flush");
+DEFINE_int32(access_log_flush_ms, 100, "Interval between access log flushes");
+DEFINE_bool(audit_async, true, "Write admin audit logs through the async batched writer");
+DEFINE_int32(audit_queue_size, 10000, "Max audit rows buffered in memory before admin RPCs are throttled");
+DEFINE_int32(audit_batch_size, 500, "Max audit rows per multi-row INSERT");
+DEFINE_int32(audit_flush_interval_ms, 200, "How long the audit writer waits to group rows into one INSERT");
+DEFINE_int32(audit_enqueue_timeout_ms, 100, "How long an admin RPC may block on a full audit queue before spilling");
+DEFINE_string(audit_spill_file, "", "Append-only local file for audit rows the DB could not take, replayed on recovery");
+DEFINE_string(audit_archive_dir, "", "Directory for archived audit partitions (gzip NDJSON); empty disables archiving");
+DEFINE_int32(audit_hot_months, 3, "Months of audit logs kept in MySQL (including the current month), min 2");
+DEFINE_int32(audit_future_partitions, 2, "Monthly audit partitions created ahead of time");
+DEFINE_int32(audit_archive_interval_s, 3600, "Interval between audit partition maintenance runs");
+DEFINE_bool(audit_archive_leader, false, "Run audit partition maintenance and archiving on this instance; enable on exactly one instance");
+DEFINE_string(storage, "mysql", "Permission storage: mysql, or memory (in-process store seeded from memory_seed_sql, for benchmarks)");
+DEFINE_string(memory_seed_sql, "scripts/init.sql", "SQL script whose INSERT statements seed the memory storage");
+DEFINE_int32(memory_read_latency_us, 0, "Latency injected into every read of the memory storage");
+DEFINE_int32(memory_write_latency_us, 0, "Latency injected into every write of the memory storage");
+DEFINE_int32(memory_latency_jitter_us, 0, "Uniform random latency in [0, jitter) added on top of the injected latency");
+DEFINE_int32(memory_max_connections, 0, "Simulated connection pool size of the memory storage, <= 0 means unlimited");
+DEFINE_int32(memory_connection_wait_ms, 1000, "How long the memory storage waits for a free simulated connection before failing");
+
+// 解析 "host1:3306,host2:3306" 形式的从库列表，省略端口时沿用 db_port
+static std::vector<PermissionDAO::Endpoint> ParseReplicas(const std::string& spec) {
+    std::vector<PermissionDAO::Endpoint> replicas;
+    std::stringstream ss(spec);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (item.empty()) continue;
+        PermissionDAO::Endpoint ep;
+        size_t pos = item.rfind(':');
+        if (pos == std::string::npos) {
+            ep.host = item;
+            ep.port = FLAGS_db_port;
+        } else {
+            ep.host = item.substr(0, pos);
+            ep.port = std::atoi(item.substr(pos + 1).c_str());
+        }
+        replicas.push_back(ep);
+    }
+    return replicas;
+}
 
 int main(int argc, char* argv[]) {
     // 解析命令行参数
     gflags::ParseCommandLineFlags(&argc, &argv, true);
 
+    // 签名密钥过短容易被暴力破解，直接拒绝启动
+    if (!FLAGS_admin_token_key.empty() && FLAGS_admin_token_key.size() < 32) {
+        LOG(ERROR) << "--admin_token_key 至少需要 32 字节";
+        return -1;
+    }
+    // ClusterService 与 AuthService 同端口开放，推送必须签名，否则任何人都能伪造失效冲刷缓存
+    if (!FLAGS_cluster_peers.empty() && FLAGS_cluster_key.size() < 32) {
+        LOG(ERROR) << "配置 --cluster_peers 时 --cluster_key 至少需要 32 字节";
+        return -1;
+    }
+
+    // 按语句统计的 DAO 指标 (/vars/dao_*)；超过阈值的语句记入慢查询日志
+    DaoStats::Global().SetSlowQueryThresholdUs(static_cast<int64_t>(FLAGS_dao_slow_query_ms) * 1000);
+
     // 0. 创建共享缓存 (Key: app:user, Value: Set<Perm>)
-    auto cache = std::make_shared<LocalCache<std::unordered_set<std::string>>>();
+    auto cache = std::make_shared<PermCache>();
+
+    // 异步模式：缓存未命中时在独立线程池中查库，不占用 bRPC worker
+    std::shared_ptr<DBExecutor> db_executor;
+    if (FLAGS_async_check) {
+        db_executor = std::make_shared<DBExecutor>(FLAGS_db_executor_threads, FLAGS_db_executor_queue);
+        LOG(INFO) << "异步鉴权模式已开启，DB 执行器线程数: " << FLAGS_db_executor_threads;
+    }
+
+    // 读写分离：鉴权读请求分摊到从库；管理后台需要读己之写，始终只连主库
+    std::vector<PermissionDAO::Endpoint> db_replicas = ParseReplicas(FLAGS_db_replicas);
+    if (!db_replicas.empty()) {
+        LOG(INFO) << "鉴权读请求将分摊到 " << db_replicas.size() << " 个从库: " << FLAGS_db_replicas;
+    }
+
+    // 共享应用目录：管理后台增删改应用后，鉴权服务立即可见
+    auto app_catalog = std::make_shared<AppCatalog>();
+
+    // 审计日志异步批量写入
+    AuditWriter::Options audit_options;
+    audit_options.async = FLAGS_audit_async;
+    audit_options.queue_capacity = FLAGS_audit_queue_size;
+    audit_options.max_batch = FLAGS_audit_batch_size;
+    audit_options.flush_interval_ms = FLAGS_audit_flush_interval_ms;
+    audit_options.enqueue_timeout_ms = FLAGS_audit_enqueue_timeout_ms;
+    audit_options.spill_path = FLAGS_audit_spill_file;
+
+    // 审计日志按月分区，过期分区归档到本地文件
+    AuditArchive::Options archive_options;
+    archive_options.dir = FLAGS_audit_archive_dir;
+    archive_options.hot_months = FLAGS_audit_hot_months;
+    archive_options.future_months = FLAGS_audit_future_partitions;
+    archive_options.check_interval_s = FLAGS_audit_archive_interval_s;
+    archive_options.leader = FLAGS_audit_archive_leader;
+
+    // 登录密码校验放到独立的有界线程池，并按用户名/IP 限流
+    AdminLoginOptions login_options;
+    login_options.threads = FLAGS_login_threads > 0 ? FLAGS_login_threads : 0;
+    login_options.queue_size = std::max(FLAGS_login_queue, 1);
+    login_options.user_per_min = FLAGS_login_user_per_min;
+    login_options.ip_per_min = FLAGS_login_ip_per_min;
+
+    // 多副本部署：管理操作的缓存失效推送给其他副本，各副本可以放心使用较长的 cache_ttl
+    CacheInvalidator::Options invalidator_options;
+    std::stringstream peers_ss(FLAGS_cluster_peers);
+    std::string peer;
+    while (std::getline(peers_ss, peer, ',')) {
+        if (!peer.empty()) invalidator_options.peers.push_back(peer);
+    }
+    invalidator_options.self = FLAGS_cluster_self;
+    invalidator_options.flush_interval_ms = FLAGS_cluster_flush_interval_ms;
+    invalidator_options.key = FLAGS_cluster_key;
+    // 读己之写：失效过的用户在从库可能落后的窗口内（最大复制延迟 + 一个健康检查周期）回填时改读主库，
+    // 避免从库上的旧权限被重新缓存整个 cache_ttl
+    auto read_fence = std::make_shared<ReadFence>(
+        std::chrono::milliseconds((std::max(FLAGS_db_max_replica_lag, 0) + 2) * 1000));
+    auto invalidator = std::make_shared<CacheInvalidator>(cache, app_catalog, invalidator_options, read_fence);
+
+    // 鉴权访问日志：抽样后写入每线程缓冲区，后台线程批量落盘
+    if (FLAGS_access_log_format != "ndjson" && FLAGS_access_log_format != "binary") {
+        LOG(ERROR) << "未知的 --access_log_format: " << FLAGS_access_log_format << "（可选 ndjson / binary）";
+        return -1;
+    }
+    AccessLog::Options access_log_options;
+    access_log_options.path = FLAGS_access_log_path;
+    access_log_options.format = FLAGS_access_log_format;
+    access_log_options.allow_sample_rate = FLAGS_access_log_allow_sample;
+    access_log_options.deny_sample_rate = FLAGS_access_log_deny_sample;
+    access_log_options.buffer_records = static_cast<size_t>(std::max(FLAGS_access_log_buffer_records, 2));
+    access_log_options.flush_interval_ms = std::max(FLAGS_access_log_flush_ms, 1);
+    auto access_log = std::make_shared<AccessLog>(access_log_options);
+    if (access_log->enabled()) {
+        LOG(INFO) << "鉴权访问日志: " << FLAGS_access_log_path << " (" << FLAGS_access_log_format
+                  << ")，允许抽样 " << FLAGS_access_log_allow_sample << "，拒绝抽样 " << FLAGS_access_log_deny_sample;
+    }
 
     // 1. 创建服务实例
-    AuthServiceImpl auth_service(cache, FLAGS_db_host, FLAGS_db_port, FLAGS_db_user, FLAGS_db_password, FLAGS_db_name, FLAGS_cache_ttl);
-    AdminServiceImpl admin_service(cache, FLAGS_db_host, FLAGS_db_port, FLAGS_db_user, FLAGS_db_password, FLAGS_db_name, FLAGS_session_ttl);
+    ChangeFeed::Options watch_options;
+    watch_options.enabled = FLAGS_watch_enabled;
+    watch_options.ring_capacity = std::max(FLAGS_watch_ring_size, 1);
+    watch_options.poll_interval_ms = std::max(FLAGS_watch_poll_interval_ms, 1);
+    watch_options.gap_timeout_ms = std::max(FLAGS_watch_gap_timeout_ms, 0);
+    watch_options.max_replay = std::max(FLAGS_watch_max_replay, 0);
+    watch_options.retention_hours = FLAGS_watch_retention_hours;
+
+    std::unique_ptr<AuthServiceImpl> auth_service;
+    std::unique_ptr<AdminServiceImpl> admin_service;
+    if (FLAGS_storage == "memory") {
+        // 进程内存储：不连 MySQL，两个服务共享同一份数据，用于基准测试与慢库/连接池耗尽复现
+        MemoryPermissionStore::Options store_options;
+        store_options.read_latency_us = std::max(FLAGS_memory_read_latency_us, 0);
+        store_options.write_latency_us = std::max(FLAGS_memory_write_latency_us, 0);
+        store_options.latency_jitter_us = std::max(FLAGS_memory_latency_jitter_us, 0);
+        store_options.max_connections = FLAGS_memory_max_connections;
+        store_options.connection_wait_ms = std::max(FLAGS_memory_connection_wait_ms, 0);
+        auto store = std::make_shared<MemoryPermissionStore>(store_options);
+        if (!FLAGS_memory_seed_sql.empty() && !store->LoadSqlFile(FLAGS_memory_seed_sql)) {
+            LOG(ERROR) << "加载内存存储种子数据失败: " << store->getLastError();
+            return -1;
+        }
+        LOG(INFO) << "使用内存存储，种子数据: " << FLAGS_memory_seed_sql
+                  << "，读延迟 " << store_options.read_latency_us << "us，写延迟 " << store_options.write_latency_us
+                  << "us，连接数上限 " << store_options.max_connections;
+        auth_service.reset(new AuthServiceImpl(cache, store, FLAGS_cache_ttl, db_executor, watch_options,
+                                               access_log));
+        admin_service.reset(new AdminServiceImpl(cache, store, FLAGS_session_ttl, audit_options, archive_options,
+                                                 FLAGS_admin_token_key, login_options, invalidator));
+    } else if (FLAGS_storage == "mysql") {
+        auth_service.reset(new AuthServiceImpl(cache, FLAGS_db_host, FLAGS_db_port, FLAGS_db_user, FLAGS_db_password, FLAGS_db_name,
+                                               FLAGS_cache_ttl, db_executor, db_replicas, FLAGS_db_max_replica_lag, app_catalog,
+                                               read_fence, watch_options, access_log));
+        admin_service.reset(new AdminServiceImpl(cache, FLAGS_db_host, FLAGS_db_port, FLAGS_db_user, FLAGS_db_password, FLAGS_db_name,
+                                                 FLAGS_session_ttl, app_catalog, audit_options, archive_options,
+                                                 FLAGS_admin_token_key, login_options, invalidator));
+    } else {
+        LOG(ERROR) << "未知的 --storage: " << FLAGS_storage << "（可选 mysql / memory）";
+        return -1;
+    }
     
+    // /dao_stats 页面，需比 server 活得久
+    DaoStatsServiceImpl dao_stats_service;
+
     // 2. 创建brpc服务器
     brpc::Server server;
     
     // 3. 添加服务
-    if (server.AddService(&auth_service, brpc::SERVER_DOESNT_OWN_SERVICE) != 0) {
+    if (server.AddService(auth_service.get(), brpc::SERVER_DOESNT_OWN_SERVICE) != 0) {
         LOG(ERROR) << "添加 AuthService 失败";
         return -1;
     }
 
-    if (server.AddService(&admin_service, brpc::SERVER_DOESNT_OWN_SERVICE) != 0) {
+    if (server.AddService(admin_service.get(), brpc::SERVER_DOESNT_OWN_SERVICE) != 0) {
         LOG(ERROR) << "添加 AdminService 失败";
         return -1;
     }
+
+    if (server.AddService(invalidator.get(), brpc::SERVER_DOESNT_OWN_SERVICE) != 0) {
+        LOG(ERROR) << "添加 ClusterService 失败";
+        return -1;
+    }
+
+    if (server.AddService(&dao_stats_service, brpc::SERVER_DOESNT_OWN_SERVICE,
+                          "/dao_stats => default_method") != 0) {
+        LOG(ERROR) << "添加 /dao_stats 页面失败";
+        return -1;
+    }
     
     // 4. 启动服务器
     brpc::ServerOptions options;
+    if (FLAGS_num_threads > 0) {
+        options.num_threads = FLAGS_num_threads;
+    }
     if (server.Start(FLAGS_port, &options) != 0) {
         LOG(ERROR) << "启动服务器失败";
         return -1;
@@ -51,6 +271,13 @@ int main(int argc, char* argv[]) {
     
     // 5. 运行直到收到停止信号
     server.RunUntilAskedToQuit();
+
+    // Server 退出时已等待所有 RPC 完成，这里再回收执行器线程
+    if (db_executor) {
+        db_executor->Stop();
+    }
+    // 把尚未送达其他副本的缓存失效最后推送一次
+    invalidator->Stop();
     
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,184 @@
+#include "access_log.h"
+#include <gflags/gflags.h>
+#include <butil/fast_rand.h>
+#include <butil/logging.h>
+#include <butil/time.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 鉴权访问日志的 CPU 开销对比，不需要 MySQL 与服务进程：
+// 多个线程模拟 Check 请求（只做拼 key 与允许/拒绝判定），每个请求按模式记录日志：
+//   none        不记录，作为基线
+//   log_info    原来的逐请求 LOG(INFO)（写到 --log_dir 下的文件）
+//   access_log  AccessLog：按抽样率写入每线程缓冲区，后台线程批量落盘
+// 每种模式输出整个进程（含后台刷盘线程）每请求消耗的 CPU 纳秒数，以及相对基线的增量。
+// 用法:
+//   ./build/access_log_bench --threads=8 --requests=2000000 --deny_ratio=0.05
+//   ./build/access_log_bench --modes=access_log --access_log_format=binary --allow_sample=1
+
+DEFINE_int32(threads, 8, "Threads issuing simulated Check requests");
+DEFINE_int32(requests, 1000000, "Simulated requests per thread in each mode");
+DEFINE_double(deny_ratio, 0.05, "Fraction of simulated requests that are denied");
+DEFINE_string(modes, "none,log_info,access_log", "Comma separated modes to run: none, log_info, access_log");
+DEFINE_string(log_dir, "/tmp", "Directory receiving the log files of log_info and access_log");
+DEFINE_string(access_log_format, "ndjson", "Access log format: ndjson or binary");
+DEFINE_double(allow_sample, 0.01, "Fraction of allowed requests written by access_log");
+DEFINE_double(deny_sample, 1.0, "Fraction of denied requests written by access_log");
+DEFINE_int32(buffer_records, 1024, "Per-thread buffer size of access_log");
+DEFINE_int32(flush_ms, 100, "Flush interval of access_log");
+
+namespace {
+
+const int kUsers = 4096;
+const char* const kApps[] = {"qq_bot", "admin_panel", "course_bot"};
+const char* const kPerms[] = {"member:kick", "message:delete", "data:view", "user:create", "homework:assign"};
+
+enum Mode { kNone, kLogInfo, kAccessLog };
+
+struct Result {
+    int64_t requests = 0;
+    int64_t cpu_us = 0;
+    int64_t wall_us = 0;
+};
+
+int64_t ProcessCpuUs() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000LL
+           + usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+}
+
+void Worker(Mode mode, AccessLog* access_log, const std::vector<std::string>* users,
+            std::atomic<int64_t>* sink) {
+    const uint64_t deny_threshold = static_cast<uint64_t>(FLAGS_deny_ratio * 1000000);
+    int64_t allowed_count = 0;
+    for (int i = 0; i < FLAGS_requests; ++i) {
+        const int64_t start_us = butil::cpuwide_time_us();
+        const std::string& user_id = (*users)[butil::fast_rand_less_than(kUsers)];
+        const std::string app_code = kApps[butil::fast_rand_less_than(3)];
+        const std::string perm_key = kPerms[butil::fast_rand_less_than(5)];
+        // 与服务端相同的缓存 key 拼接，代表请求本身的最小工作量
+        std::string cache_key = app_code + ":" + user_id;
+        bool allowed = butil::fast_rand_less_than(1000000) >= deny_threshold;
+        bool cache_hit = !cache_key.empty();
+        allowed_count += allowed;
+
+        if (mode == kLogInfo) {
+            LOG(INFO) << "Check " << user_id << " -> " << perm_key
+                      << (allowed ? " [ALLOW]" : " [DENY]") << (cache_hit ? " (Hit)" : " (Miss)");
+        } else if (mode == kAccessLog && access_log->Sampled(allowed)) {
+            access_log->Append(AccessLog::kCheck, app_code, user_id, perm_key, allowed, cache_hit,
+                               allowed ? nullptr : "no_permission", 1, allowed ? 0 : 1,
+                               butil::cpuwide_time_us() - start_us);
+        }
+    }
+    // 防止编译器把整个循环优化掉
+    *sink += allowed_count;
+}
+
+Result Run(Mode mode, const std::vector<std::string>& users) {
+    std::unique_ptr<AccessLog> access_log;
+    if (mode == kAccessLog) {
+        AccessLog::Options options;
+        options.path = FLAGS_log_dir + "/access_log_bench." + (FLAGS_access_log_format == "binary" ? "bin" : "log");
+        options.format = FLAGS_access_log_format;
+        options.allow_sample_rate = FLAGS_allow_sample;
+        options.deny_sample_rate = FLAGS_deny_sample;
+        options.buffer_records = static_cast<size_t>(std::max(FLAGS_buffer_records, 2));
+        options.flush_interval_ms = std::max(FLAGS_flush_ms, 1);
+        unlink(options.path.c_str());
+        access_log.reset(new AccessLog(options));
+        if (!access_log->enabled()) {
+            std::cerr << "无法打开 " << options.path << std::endl;
+            exit(1);
+        }
+    }
+
+    std::atomic<int64_t> sink(0);
+    Result result;
+    const int64_t cpu_start = ProcessCpuUs();
+    const int64_t wall_start = butil::monotonic_time_us();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < FLAGS_threads; ++t) {
+        workers.emplace_back(Worker, mode, access_log.get(), &users, &sink);
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    // 析构时会刷出剩余记录，计入本模式的开销
+    access_log.reset();
+    result.wall_us = butil::monotonic_time_us() - wall_start;
+    result.cpu_us = ProcessCpuUs() - cpu_start;
+    result.requests = static_cast<int64_t>(FLAGS_threads) * FLAGS_requests;
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+    // log_info 模式写文件而不是终端，与线上部署一致
+    std::string info_log = FLAGS_log_dir + "/access_log_bench.info.log";
+    unlink(info_log.c_str());
+    logging::LoggingSettings settings;
+    settings.logging_dest = logging::LOG_TO_FILE;
+    settings.log_file = info_log.c_str();
+    logging::InitLogging(settings);
+
+    std::vector<std::string> users;
+    for (int i = 0; i < kUsers; ++i) {
+        users.push_back(std::to_string(100000 + i));
+    }
+
+    std::cout << "threads=" << FLAGS_threads << " requests/thread=" << FLAGS_requests
+              << " deny_ratio=" << FLAGS_deny_ratio << " allow_sample=" << FLAGS_allow_sample
+              << " deny_sample=" << FLAGS_deny_sample << " format=" << FLAGS_access_log_format << "\n\n";
+    std::cout << std::left << std::setw(12) << "mode" << std::right
+              << std::setw(14) << "cpu_ns/req" << std::setw(14) << "vs_none" << std::setw(14) << "wall_ms"
+              << std::setw(14) << "Mreq/s" << "\n";
+
+    double baseline_ns = -1;
+    std::stringstream modes_ss(FLAGS_modes);
+    std::string name;
+    while (std::getline(modes_ss, name, ',')) {
+        Mode mode;
+        if (name == "none") {
+            mode = kNone;
+        } else if (name == "log_info") {
+            mode = kLogInfo;
+        } else if (name == "access_log") {
+            mode = kAccessLog;
+        } else {
+            std::cerr << "未知模式: " << name << std::endl;
+            return 1;
+        }
+        Result r = Run(mode, users);
+        double cpu_ns = r.requests > 0 ? r.cpu_us * 1000.0 / r.requests : 0;
+        if (mode == kNone) {
+            baseline_ns = cpu_ns;
+        }
+        std::cout << std::left << std::setw(12) << name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(14) << cpu_ns;
+        if (baseline_ns >= 0 && mode != kNone) {
+            std::cout << std::setw(14) << cpu_ns - baseline_ns;
+        } else {
+            std::cout << std::setw(14) << "-";
+        }
+        std::cout << std::setw(14) << r.wall_us / 1000.0
+                  << std::setw(14) << std::setprecision(2) << (r.wall_us > 0 ? static_cast<double>(r.requests) / r.wall_us : 0)
+                  << "\n";
+    }
+    std::cout << "\n日志文件位于 " << FLAGS_log_dir << "/access_log_bench.*" << std::endl;
+    return 0;
+}
@@ -0,0 +1,227 @@
+#include <benchmark/benchmark.h>
+#include "perm_cache.h"
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// LocalCache 与 Check 命中路径的微基准，不需要 auth_server / MySQL。
+// 每项输出 ns/op（google benchmark 的 Time 列）与 allocs/op（每次操作的堆分配次数），
+// 缓存或 Check 路径引入额外拷贝、分配时在这里就能看到。
+// 用法:
+//   ./build/cache_bench
+//   ./build/cache_bench --benchmark_filter=Get --benchmark_format=json > cache_bench.json
+
+// ---------------------------------------------------------------------------
+// 分配计数：替换全局 operator new，按线程计数，结果汇总后除以总迭代次数
+// ---------------------------------------------------------------------------
+namespace {
+thread_local uint64_t t_allocs = 0;
+}
+
+void* operator new(size_t size) {
+    ++t_allocs;
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+namespace {
+
+// 在计时循环结束后调用，把本线程的分配次数折算成 allocs/op
+class AllocCounter {
+public:
+    explicit AllocCounter(benchmark::State& state) : state_(state), start_(t_allocs) {}
+    ~AllocCounter() {
+        state_.counters["allocs/op"] = benchmark::Counter(static_cast<double>(t_allocs - start_),
+                                                          benchmark::Counter::kAvgIterations);
+    }
+
+private:
+    benchmark::State& state_;
+    uint64_t start_;
+};
+
+// 与 scripts/init.sql 的权限 key 形态一致 ("module:action")，数量取真实角色的量级
+CachedPerms MakePerms(int count) {
+    CachedPerms perms;
+    for (int i = 0; i < count; ++i) {
+        perms.keys.insert("module" + std::to_string(i / 4) + ":action" + std::to_string(i % 4));
+    }
+    return perms;
+}
+
+const int kApps = 3;
+
+// 多线程基准共享同一个缓存，由 0 号线程在计时开始前准备
+std::shared_ptr<PermCache> g_cache;
+std::vector<std::string> g_keys;
+std::vector<std::string> g_app_codes;  // 与 g_keys 一一对应，Check 路径基准用来现场拼 key
+std::vector<std::string> g_user_ids;
+
+void PrepareCache(benchmark::State& state, int entries, int perms_per_user) {
+    if (state.thread_index() != 0) {
+        return;
+    }
+    g_cache = std::make_shared<PermCache>();
+    g_keys.clear();
+    g_app_codes.clear();
+    g_user_ids.clear();
+    CachedPerms perms = MakePerms(perms_per_user);
+    for (int i = 0; i < entries; ++i) {
+        g_app_codes.push_back("app" + std::to_string(i % kApps));
+        g_user_ids.push_back(std::to_string(100000 + i / kApps));
+        g_keys.push_back(g_app_codes.back() + ":" + g_user_ids.back());
+        g_cache->Put(g_keys.back(), perms, 3600);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// LocalCache
+// ---------------------------------------------------------------------------
+
+// Get 拷贝整个值：权限集合越大，拷贝与分配越多
+void BM_CacheGet(benchmark::State& state) {
+    PrepareCache(state, 10000, static_cast<int>(state.range(0)));
+    std::mt19937 rng(state.thread_index());
+    std::uniform_int_distribution<size_t> pick(0, 9999);
+    AllocCounter allocs(state);
+    for (auto _ : state) {
+        // 与调用方一致，每次读到一个新对象里（复用同一对象时 unordered_set 会复用节点，分配数偏低）
+        CachedPerms value;
+        bool hit = g_cache->Get(g_keys[pick(rng)], value);
+        benchmark::DoNotOptimize(hit);
+    }
+}
+BENCHMARK(BM_CacheGet)->Arg(4)->Arg(16)->Arg(64)->ThreadRange(1, 16)->UseRealTime();
+
+// Visit 在锁内只读不拷贝
+void BM_CacheVisit(benchmark::State& state) {
+    PrepareCache(state, 10000, static_cast<int>(state.range(0)));
+    std::mt19937 rng(state.thread_index());
+    std::uniform_int_distribution<size_t> pick(0, 9999);
+    const std::string perm_key = "module0:action1";
+    AllocCounter allocs(state);
+    for (auto _ : state) {
+        bool allowed = false;
+        g_cache->Visit(g_keys[pick(rng)], [&](const CachedPerms& cached) {
+            allowed = cached.keys.count(perm_key) > 0;
+        });
+        benchmark::DoNotOptimize(allowed);
+    }
+}
+BENCHMARK(BM_CacheVisit)->Arg(4)->Arg(16)->Arg(64)->ThreadRange(1, 16)->UseRealTime();
+
+// Put 覆盖已有条目（缓存未命中后的回填）
+void BM_CachePut(benchmark::State& state) {
+    PrepareCache(state, 10000, static_cast<int>(state.range(0)));
+    std::mt19937 rng(state.thread_index());
+    std::uniform_int_distribution<size_t> pick(0, 9999);
+    CachedPerms perms = MakePerms(static_cast<int>(state.range(0)));
+    AllocCounter allocs(state);
+    for (auto _ : state) {
+        g_cache->Put(g_keys[pick(rng)], perms, 3600);
+    }
+}
+BENCHMARK(BM_CachePut)->Arg(4)->Arg(16)->Arg(64)->ThreadRange(1, 16)->UseRealTime();
+
+// InvalidatePrefix 需要遍历全部条目：用不匹配的前缀测纯扫描开销（条目数为参数），
+// 这段时间内所有 Get / Visit 都在等同一把锁
+void BM_CacheInvalidatePrefixScan(benchmark::State& state) {
+    PrepareCache(state, static_cast<int>(state.range(0)), 16);
+    AllocCounter allocs(state);
+    for (auto _ : state) {
+        g_cache->InvalidatePrefix("app_none:");
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CacheInvalidatePrefixScan)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+// 读线程 Visit 的同时 0 号线程不断做前缀失效，观察失效对读延迟的影响
+void BM_CacheVisitDuringInvalidate(benchmark::State& state) {
+    PrepareCache(state, 10000, 16);
+    std::mt19937 rng(state.thread_index());
+    std::uniform_int_distribution<size_t> pick(0, 9999);
+    const std::string perm_key = "module0:action1";
+    AllocCounter allocs(state);
+    for (auto _ : state) {
+        if (state.thread_index() == 0) {
+            g_cache->InvalidatePrefix("app_none:");
+            continue;
+        }
+        bool allowed = false;
+        g_cache->Visit(g_keys[pick(rng)], [&](const CachedPerms& cached) {
+            allowed = cached.keys.count(perm_key) > 0;
+        });
+        benchmark::DoNotOptimize(allowed);
+    }
+}
+BENCHMARK(BM_CacheVisitDuringInvalidate)->ThreadRange(2, 16)->UseRealTime();
+
+// ---------------------------------------------------------------------------
+// Check 命中路径的组成部分（与 AuthServiceImpl::Check 相同的写法）
+// ---------------------------------------------------------------------------
+
+// 缓存 key 拼接 "app_code:user_id"
+void BM_CheckKeyBuild(benchmark::State& state) {
+    const std::string app_code = "qq_bot";
+    const std::string user_id = "1234567890";
+    AllocCounter allocs(state);
+    for (auto _ : state) {
+        std::string cache_key = app_code + ":" + user_id;
+        benchmark::DoNotOptimize(cache_key.data());
+    }
+}
+BENCHMARK(BM_CheckKeyBuild);
+
+// 权限集合中查找 perm_key
+void BM_CheckSetLookup(benchmark::State& state) {
+    CachedPerms perms = MakePerms(static_cast<int>(state.range(0)));
+    const std::string hit_key = "module0:action1";
+    const std::string miss_key = "member:kick";
+    bool use_hit = true;
+    AllocCounter allocs(state);
+    for (auto _ : state) {
+        size_t found = perms.keys.count(use_hit ? hit_key : miss_key);
+        benchmark::DoNotOptimize(found);
+        use_hit = !use_hit;
+    }
+}
+BENCHMARK(BM_CheckSetLookup)->Arg(4)->Arg(16)->Arg(64);
+
+// 完整命中路径：拼 key、Visit 中拷出权限集合、查找
+void BM_CheckHitPath(benchmark::State& state) {
+    PrepareCache(state, 10000, static_cast<int>(state.range(0)));
+    std::mt19937 rng(state.thread_index());
+    std::uniform_int_distribution<size_t> pick(0, 9999);
+    const std::string perm_key = "module0:action1";
+    AllocCounter allocs(state);
+    for (auto _ : state) {
+        size_t i = pick(rng);
+        std::string cache_key = g_app_codes[i] + ":" + g_user_ids[i];
+        std::unordered_set<std::string> user_perms;
+        bool cache_hit = g_cache->Visit(cache_key, [&user_perms](const CachedPerms& cached) {
+            user_perms = cached.keys;
+        });
+        bool allowed = cache_hit && user_perms.count(perm_key) > 0;
+        benchmark::DoNotOptimize(allowed);
+    }
+}
+BENCHMARK(BM_CheckHitPath)->Arg(4)->Arg(16)->Arg(64)->ThreadRange(1, 16)->UseRealTime();
+
+} // namespace
+
+BENCHMARK_MAIN();
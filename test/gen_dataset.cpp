@@ -0,0 +1,333 @@
+#include <gflags/gflags.h>
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+
+// 大规模 RBAC 数据集生成器：按参数生成应用、角色、权限、角色-权限绑定与用户授权，
+// 输出可直接导入 MySQL 的文件，以及与之匹配的 perf_test 负载文件 (--workload_file)。
+// 用法:
+//   ./build/gen_dataset --apps=10 --users=500000 --roles_per_user=2 --out_dir=dataset   # 1000 万条授权
+//   mysql -h127.0.0.1 -usiqi_dev -p siqi_auth < dataset/dataset.sql
+//   # 或者 --format=tsv，用 LOAD DATA 导入（更快，需要服务端开启 local_infile）
+//   cd dataset && mysql --local-infile=1 -h127.0.0.1 -usiqi_dev -p siqi_auth < load.sql
+//   ./build/perf_test --workload_file=dataset/workload.txt --workload=zipf --threads=32
+// 主键显式指定且从 --id_base 开始，不与 init.sql 的种子数据冲突；重新生成前先执行 cleanup.sql
+
+DEFINE_string(out_dir, "dataset", "输出目录");
+DEFINE_string(format, "sql", "sql: 多行 INSERT (dataset.sql)；tsv: 每张表一个 TSV 文件 + LOAD DATA 脚本 (load.sql)");
+DEFINE_int32(apps, 10, "应用数");
+DEFINE_int32(roles_per_app, 20, "每个应用的角色数");
+DEFINE_int32(perms_per_app, 50, "每个应用的权限数");
+DEFINE_int32(perms_per_role, 10, "每个角色绑定的权限数");
+DEFINE_int64(users, 100000, "每个应用的用户数");
+DEFINE_int32(roles_per_user, 2, "每个用户被授予的角色数");
+DEFINE_double(skew, 0.99, "角色与权限热度的 Zipf 指数：排名靠前的角色被更多用户持有、排名靠前的权限被更多角色绑定，0 为均匀");
+DEFINE_int32(time_span_days, 365, "授权时间 (created_at) 均匀分布在最近多少天内");
+DEFINE_int32(batch_rows, 1000, "sql 格式下每条 INSERT 携带的行数");
+DEFINE_int64(id_base, 1000000, "应用、角色、权限主键的起始值");
+DEFINE_string(app_prefix, "gen", "应用代号前缀，应用代号为 <prefix>_<序号>");
+DEFINE_int32(seed, 42, "随机数种子，相同参数与种子生成相同的数据");
+
+namespace {
+
+// 各应用用户 ID 的间隔：应用 i 的用户为 (i + 1) * kUserIdStep + [0, users)，
+// 与 perf_test 的探测用户 (900000000+) 及 init.sql 中的用户不重叠
+const int64_t kUserIdStep = 10000000000LL;
+
+// Zipf 分布：第 k 名（从 0 开始）的概率正比于 1 / (k + 1)^s
+class ZipfDistribution {
+public:
+    ZipfDistribution(size_t n, double s) : cdf_(std::max<size_t>(n, 1)) {
+        double sum = 0;
+        for (size_t k = 0; k < cdf_.size(); ++k) {
+            sum += 1.0 / std::pow(static_cast<double>(k + 1), s);
+            cdf_[k] = sum;
+        }
+        for (double& c : cdf_) {
+            c /= sum;
+        }
+    }
+
+    size_t operator()(std::mt19937_64& rng) const {
+        double u = std::uniform_real_distribution<double>(0.0, 1.0)(rng);
+        size_t k = std::lower_bound(cdf_.begin(), cdf_.end(), u) - cdf_.begin();
+        return std::min(k, cdf_.size() - 1);
+    }
+
+    size_t size() const { return cdf_.size(); }
+
+private:
+    std::vector<double> cdf_;
+};
+
+// 按分布抽取 count 个互不相同的排名；偏斜很大时拒绝采样可能迟迟凑不齐，超过次数后按顺序补足
+std::vector<int> PickDistinct(const ZipfDistribution& dist, int count, std::mt19937_64& rng) {
+    std::vector<int> picked;
+    std::vector<bool> used(dist.size(), false);
+    for (int tries = 0; static_cast<int>(picked.size()) < count && tries < count * 64; ++tries) {
+        size_t k = dist(rng);
+        if (!used[k]) {
+            used[k] = true;
+            picked.push_back(static_cast<int>(k));
+        }
+    }
+    for (size_t k = 0; static_cast<int>(picked.size()) < count && k < used.size(); ++k) {
+        if (!used[k]) {
+            used[k] = true;
+            picked.push_back(static_cast<int>(k));
+        }
+    }
+    return picked;
+}
+
+struct Field {
+    std::string text;
+    bool quoted;
+};
+
+Field Str(const std::string& s) { return Field{s, true}; }
+Field Num(int64_t v) { return Field{std::to_string(v), false}; }
+
+// 一张表的输出：sql 格式攒成多行 INSERT，tsv 格式逐行写入独立文件、由 load.sql 中的 LOAD DATA 导入
+// 生成的值只含字母、数字、空格与 ":_-"，不需要转义
+class TableWriter {
+public:
+    TableWriter(const std::string& table, const std::vector<std::string>& columns, std::ostream* script)
+        : table_(table), columns_(columns), script_(script) {
+        if (FLAGS_format == "tsv") {
+            std::string file = table_ + ".tsv";
+            tsv_.reset(new std::ofstream(FLAGS_out_dir + "/" + file));
+            *script_ << "LOAD DATA LOCAL INFILE '" << file << "' INTO TABLE `" << table_ << "`\n"
+                     << "    FIELDS TERMINATED BY '\\t' LINES TERMINATED BY '\\n' (" << ColumnList() << ");\n";
+        }
+    }
+
+    ~TableWriter() { Flush(); }
+
+    void Add(const std::vector<Field>& row) {
+        ++rows_;
+        if (tsv_) {
+            for (size_t i = 0; i < row.size(); ++i) {
+                *tsv_ << (i ? "\t" : "") << row[i].text;
+            }
+            *tsv_ << '\n';
+            return;
+        }
+        pending_ += pending_rows_ ? ",\n(" : "(";
+        for (size_t i = 0; i < row.size(); ++i) {
+            if (i) pending_ += ", ";
+            if (row[i].quoted) {
+                pending_ += '\'' + row[i].text + '\'';
+            } else {
+                pending_ += row[i].text;
+            }
+        }
+        pending_ += ')';
+        if (++pending_rows_ >= FLAGS_batch_rows) {
+            Flush();
+        }
+    }
+
+    int64_t rows() const { return rows_; }
+
+    bool ok() const { return !tsv_ || static_cast<bool>(*tsv_); }
+
+private:
+    std::string ColumnList() const {
+        std::string list;
+        for (size_t i = 0; i < columns_.size(); ++i) {
+            list += (i ? ", `" : "`") + columns_[i] + "`";
+        }
+        return list;
+    }
+
+    void Flush() {
+        if (pending_rows_ == 0) return;
+        *script_ << "INSERT INTO `" << table_ << "` (" << ColumnList() << ") VALUES\n" << pending_ << ";\n";
+        pending_.clear();
+        pending_rows_ = 0;
+    }
+
+    std::string table_;
+    std::vector<std::string> columns_;
+    std::ostream* script_;
+    std::unique_ptr<std::ofstream> tsv_;
+    std::string pending_;
+    int pending_rows_ = 0;
+    int64_t rows_ = 0;
+};
+
+std::string FormatTime(time_t t) {
+    struct tm tm;
+    localtime_r(&t, &tm);
+    char buf[32];
+    strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &tm);
+    return buf;
+}
+
+std::string AppCode(int app) {
+    return FLAGS_app_prefix + "_" + std::to_string(app);
+}
+
+int64_t AppId(int app) { return FLAGS_id_base + app; }
+int64_t RoleId(int app, int role) { return FLAGS_id_base + static_cast<int64_t>(app) * FLAGS_roles_per_app + role; }
+int64_t PermId(int app, int perm) { return FLAGS_id_base + static_cast<int64_t>(app) * FLAGS_perms_per_app + perm; }
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+    if (FLAGS_format != "sql" && FLAGS_format != "tsv") {
+        std::cerr << "未知的 --format: " << FLAGS_format << std::endl;
+        return -1;
+    }
+    if (FLAGS_apps <= 0 || FLAGS_roles_per_app <= 0 || FLAGS_perms_per_app <= 0 || FLAGS_users <= 0 ||
+        FLAGS_batch_rows <= 0 || FLAGS_id_base <= 0) {
+        std::cerr << "--apps / --roles_per_app / --perms_per_app / --users / --batch_rows / --id_base 必须大于 0" << std::endl;
+        return -1;
+    }
+    if (FLAGS_users >= kUserIdStep) {
+        std::cerr << "--users 不能超过 " << kUserIdStep - 1 << std::endl;
+        return -1;
+    }
+    int perms_per_role = std::min(std::max(FLAGS_perms_per_role, 0), FLAGS_perms_per_app);
+    int roles_per_user = std::min(std::max(FLAGS_roles_per_user, 0), FLAGS_roles_per_app);
+
+    mkdir(FLAGS_out_dir.c_str(), 0755);
+    const std::string script_name = FLAGS_format == "sql" ? "dataset.sql" : "load.sql";
+    std::ofstream script(FLAGS_out_dir + "/" + script_name);
+    std::ofstream workload(FLAGS_out_dir + "/workload.txt");
+    std::ofstream cleanup(FLAGS_out_dir + "/cleanup.sql");
+    if (!script || !workload || !cleanup) {
+        std::cerr << "无法写入输出目录: " << FLAGS_out_dir << std::endl;
+        return -1;
+    }
+
+    std::ostringstream params_ss;
+    params_ss << "--apps=" << FLAGS_apps << " --roles_per_app=" << FLAGS_roles_per_app
+              << " --perms_per_app=" << FLAGS_perms_per_app << " --perms_per_role=" << perms_per_role
+              << " --users=" << FLAGS_users << " --roles_per_user=" << roles_per_user
+              << " --skew=" << FLAGS_skew << " --seed=" << FLAGS_seed;
+    const std::string params = params_ss.str();
+
+    // 批量导入期间关闭唯一性与外键检查，由生成器保证数据不重复
+    script << "-- gen_dataset " << params << "\n"
+           << "SET NAMES utf8mb4;\n"
+           << "SET unique_checks = 0;\n"
+           << "SET foreign_key_checks = 0;\n";
+
+    // 清理脚本：按主键范围与应用删除本数据集的全部数据
+    int64_t app_last = AppId(FLAGS_apps - 1);
+    cleanup << "-- 删除 gen_dataset 生成的数据 (" << params << ")\n"
+            << "DELETE FROM `sys_user_roles` WHERE `app_id` BETWEEN " << FLAGS_id_base << " AND " << app_last << ";\n"
+            << "DELETE FROM `sys_role_permissions` WHERE `role_id` BETWEEN " << RoleId(0, 0) << " AND "
+            << RoleId(FLAGS_apps - 1, FLAGS_roles_per_app - 1) << ";\n"
+            << "DELETE FROM `sys_roles` WHERE `app_id` BETWEEN " << FLAGS_id_base << " AND " << app_last << ";\n"
+            << "DELETE FROM `sys_permissions` WHERE `app_id` BETWEEN " << FLAGS_id_base << " AND " << app_last << ";\n"
+            << "DELETE FROM `sys_apps` WHERE `id` BETWEEN " << FLAGS_id_base << " AND " << app_last << ";\n";
+
+    std::mt19937_64 rng(FLAGS_seed);
+    ZipfDistribution role_dist(FLAGS_roles_per_app, FLAGS_skew);
+    ZipfDistribution perm_dist(FLAGS_perms_per_app, FLAGS_skew);
+
+    int64_t apps_rows, perm_rows, role_rows, binding_rows, grant_rows;
+    {
+        TableWriter apps("sys_apps", {"id", "app_name", "app_code", "app_secret", "description", "status"}, &script);
+        for (int a = 0; a < FLAGS_apps; ++a) {
+            apps.Add({Num(AppId(a)), Str("gen app " + std::to_string(a)), Str(AppCode(a)),
+                      Str("secret_" + AppCode(a)), Str("gen_dataset"), Num(1)});
+        }
+        apps_rows = apps.rows();
+    }
+    {
+        TableWriter perms("sys_permissions", {"id", "app_id", "perm_name", "perm_key", "description"}, &script);
+        for (int a = 0; a < FLAGS_apps; ++a) {
+            for (int p = 0; p < FLAGS_perms_per_app; ++p) {
+                perms.Add({Num(PermId(a, p)), Num(AppId(a)), Str("perm " + std::to_string(p)),
+                           Str("perm:" + std::to_string(p)), Str("gen_dataset")});
+            }
+        }
+        perm_rows = perms.rows();
+    }
+    {
+        TableWriter roles("sys_roles", {"id", "app_id", "role_name", "role_key", "description", "is_default"}, &script);
+        for (int a = 0; a < FLAGS_apps; ++a) {
+            for (int r = 0; r < FLAGS_roles_per_app; ++r) {
+                roles.Add({Num(RoleId(a, r)), Num(AppId(a)), Str("role " + std::to_string(r)),
+                           Str("role_" + std::to_string(r)), Str("gen_dataset"), Num(0)});
+            }
+        }
+        role_rows = roles.rows();
+    }
+    {
+        TableWriter bindings("sys_role_permissions", {"role_id", "perm_id"}, &script);
+        for (int a = 0; a < FLAGS_apps; ++a) {
+            for (int r = 0; r < FLAGS_roles_per_app; ++r) {
+                for (int p : PickDistinct(perm_dist, perms_per_role, rng)) {
+                    bindings.Add({Num(RoleId(a, r)), Num(PermId(a, p))});
+                }
+            }
+        }
+        binding_rows = bindings.rows();
+    }
+    {
+        TableWriter grants("sys_user_roles", {"app_id", "app_user_id", "role_id", "created_at"}, &script);
+        time_t now = time(nullptr);
+        std::uniform_int_distribution<int64_t> age_dist(0, static_cast<int64_t>(std::max(FLAGS_time_span_days, 0)) * 86400);
+        for (int a = 0; a < FLAGS_apps; ++a) {
+            int64_t user_base = (a + 1) * kUserIdStep;
+            for (int64_t u = 0; u < FLAGS_users; ++u) {
+                std::string user_id = std::to_string(user_base + u);
+                for (int r : PickDistinct(role_dist, roles_per_user, rng)) {
+                    grants.Add({Num(AppId(a)), Str(user_id), Num(RoleId(a, r)),
+                                Str(FormatTime(now - static_cast<time_t>(age_dist(rng))))});
+                }
+            }
+            std::cerr << "应用 " << AppCode(a) << " 完成，累计授权 " << grants.rows() << " 条" << std::endl;
+        }
+        grant_rows = grants.rows();
+        if (!grants.ok()) {
+            std::cerr << "写入 sys_user_roles 失败" << std::endl;
+            return -1;
+        }
+    }
+
+    // perf_test 负载：各应用的用户范围与全部权限，权限按热度排名排列（与 --workload=zipf 的排名一致）
+    workload << "# gen_dataset " << params << "\n"
+             << "# app <app_code> <首个用户 ID> <用户数>\n";
+    for (int a = 0; a < FLAGS_apps; ++a) {
+        workload << "app " << AppCode(a) << " " << (a + 1) * kUserIdStep << " " << FLAGS_users << "\n";
+    }
+    workload << "# perm <app_code> <perm_key>\n";
+    for (int p = 0; p < FLAGS_perms_per_app; ++p) {
+        for (int a = 0; a < FLAGS_apps; ++a) {
+            workload << "perm " << AppCode(a) << " perm:" << p << "\n";
+        }
+    }
+
+    script.flush();
+    workload.flush();
+    if (!script || !workload) {
+        std::cerr << "写入输出文件失败" << std::endl;
+        return -1;
+    }
+
+    std::cout << "应用        : " << apps_rows << std::endl;
+    std::cout << "权限        : " << perm_rows << std::endl;
+    std::cout << "角色        : " << role_rows << std::endl;
+    std::cout << "角色-权限   : " << binding_rows << std::endl;
+    std::cout << "用户授权    : " << grant_rows << " (" << FLAGS_apps * FLAGS_users << " 个用户)" << std::endl;
+    std::cout << "导入脚本    : " << FLAGS_out_dir << "/" << script_name << std::endl;
+    std::cout << "清理脚本    : " << FLAGS_out_dir << "/cleanup.sql" << std::endl;
+    std::cout << "压测负载    : " << FLAGS_out_dir << "/workload.txt" << std::endl;
+    return 0;
+}
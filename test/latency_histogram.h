@@ -0,0 +1,104 @@
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+// 固定内存、可合并的对数分桶延迟直方图（HDR 风格），单位微秒。
+// 小于 128 的值每个值一个桶；更大的值按 2 的幂分段，每段 64 个线性子桶，相对误差 < 1/64（约 1.6%）。
+// 覆盖 0 ~ 2^36 us（约 19 小时），超出的值计入最后一个桶；每个直方图约 16KB，与样本数无关。
+// 不加锁，多线程使用时每个线程各持一份，汇总时 Merge。
+class LatencyHistogram {
+public:
+    static const int kSubBucketBits = 7;                        // 128
+    static const int kSubBucketHalf = 1 << (kSubBucketBits - 1);  // 64
+    static const int kMaxMagnitude = 30;
+    static const int kBucketCount = (1 << kSubBucketBits) + kMaxMagnitude * kSubBucketHalf;
+
+    LatencyHistogram() { Reset(); }
+
+    void Record(int64_t value) {
+        if (value < 0) value = 0;
+        counts_[Index(value)]++;
+        count_++;
+        sum_ += value;
+        min_ = std::min(min_, value);
+        max_ = std::max(max_, value);
+    }
+
+    void Merge(const LatencyHistogram& other) {
+        if (other.count_ == 0) return;
+        for (int i = 0; i < kBucketCount; ++i) {
+            counts_[i] += other.counts_[i];
+        }
+        count_ += other.count_;
+        sum_ += other.sum_;
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+    }
+
+    void Reset() {
+        memset(counts_, 0, sizeof(counts_));
+        count_ = 0;
+        sum_ = 0;
+        min_ = std::numeric_limits<int64_t>::max();
+        max_ = 0;
+    }
+
+    int64_t Count() const { return count_; }
+    int64_t Min() const { return count_ == 0 ? 0 : min_; }
+    int64_t Max() const { return max_; }
+    double Mean() const { return count_ == 0 ? 0.0 : static_cast<double>(sum_) / count_; }
+
+    // p 取 [0, 1]；返回所在桶的上界（不超过实际最大值），即"至少有 p 比例的样本不大于该值"
+    int64_t Percentile(double p) const {
+        if (count_ == 0) return 0;
+        // 第 rank 个样本（从 1 计），rank = ceil(p * count)，至少为 1
+        int64_t rank = static_cast<int64_t>(std::ceil(p * count_));
+        if (rank < 1) rank = 1;
+        if (rank > count_) rank = count_;
+        int64_t seen = 0;
+        for (int i = 0; i < kBucketCount; ++i) {
+            seen += counts_[i];
+            if (seen >= rank) {
+                return std::min(UpperBound(i), max_);
+            }
+        }
+        return max_;
+    }
+
+private:
+    static int Index(int64_t value) {
+        if (value < (1 << kSubBucketBits)) {
+            return static_cast<int>(value);
+        }
+        // magnitude >= 1，value >> magnitude 落在 [64, 128)
+        int magnitude = (63 - __builtin_clzll(static_cast<uint64_t>(value))) - (kSubBucketBits - 1);
+        if (magnitude > kMaxMagnitude) {
+            return kBucketCount - 1;
+        }
+        int sub = static_cast<int>(value >> magnitude) - kSubBucketHalf;
+        return (1 << kSubBucketBits) + (magnitude - 1) * kSubBucketHalf + sub;
+    }
+
+    static int64_t UpperBound(int index) {
+        if (index < (1 << kSubBucketBits)) {
+            return index;
+        }
+        int offset = index - (1 << kSubBucketBits);
+        int magnitude = offset / kSubBucketHalf + 1;
+        int64_t sub = offset % kSubBucketHalf + kSubBucketHalf;
+        return ((sub + 1) << magnitude) - 1;
+    }
+
+    int64_t counts_[kBucketCount];
+    int64_t count_;
+    int64_t sum_;
+    int64_t min_;
+    int64_t max_;
+};
+
+#endif // LATENCY_HISTOGRAM_H
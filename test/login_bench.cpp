@@ -0,0 +1,224 @@
+#include <brpc/channel.h>
+#include <gflags/gflags.h>
+#include <butil/time.h>
+#include <butil/logging.h>
+#include "auth.pb.h"
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+// 登录风暴对鉴权延迟的影响：先只跑 Check，再在 Check 的同时用大量线程调用 Login，
+// 对比两个阶段 Check 的 QPS 与 P99，并统计 Login 的成功 / 限流 (429) / 过载 (503) 次数。
+// 用法:
+//   ./build/login_bench --server=127.0.0.1:8888 --login_user=admin --login_threads=32
+// 默认使用错误密码，每次登录都会完整执行一次 crypt；
+// 要压测密码校验线程池本身，服务端可用 --login_user_per_min=0 --login_ip_per_min=0 关闭限流
+
+DEFINE_string(server, "127.0.0.1:8888", "Server address to connect");
+DEFINE_int32(check_threads, 8, "Threads calling AuthService.Check");
+DEFINE_int32(login_threads, 16, "Threads calling AdminService.Login during the storm phase");
+DEFINE_int32(duration, 15, "Duration in seconds of each phase");
+DEFINE_string(login_user, "admin", "Console username used by the login storm");
+DEFINE_string(login_password, "wrong-password", "Password used by the login storm");
+
+namespace {
+
+struct CheckStats {
+    long count = 0;
+    long fail = 0;
+    std::vector<long> latencies;
+};
+
+struct LoginStats {
+    long count = 0;
+    long success = 0;
+    long denied = 0;        // 用户名或密码错误
+    long rate_limited = 0;  // 429
+    long overloaded = 0;    // 503
+    long fail = 0;
+    std::vector<long> latencies;
+};
+
+const std::vector<std::pair<std::string, std::string>> kCheckParams = {
+    {"qq_bot", "member:kick"},
+    {"qq_bot", "message:delete"},
+    {"admin_panel", "data:view"},
+    {"admin_panel", "user:create"},
+    {"course_bot", "homework:assign"}
+};
+
+void CheckWorker(brpc::Channel* channel, const std::atomic<bool>* stop, CheckStats* stats, int seed) {
+    siqi::auth::AuthService_Stub stub(channel);
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> param_dist(0, kCheckParams.size() - 1);
+    std::uniform_int_distribution<int> offset_dist(0, 500);
+
+    while (!stop->load(std::memory_order_relaxed)) {
+        const auto& param = kCheckParams[param_dist(rng)];
+        int base_id = 100000;
+        if (param.first == "admin_panel") base_id = 200000;
+        else if (param.first == "course_bot") base_id = 300000;
+
+        siqi::auth::CheckRequest request;
+        request.set_app_code(param.first);
+        request.set_user_id(std::to_string(base_id + offset_dist(rng)));
+        request.set_perm_key(param.second);
+        siqi::auth::CheckResponse response;
+        brpc::Controller cntl;
+        cntl.set_timeout_ms(1000);
+
+        long t1 = butil::gettimeofday_us();
+        stub.Check(&cntl, &request, &response, NULL);
+        long t2 = butil::gettimeofday_us();
+
+        stats->count++;
+        stats->latencies.push_back(t2 - t1);
+        if (cntl.Failed()) {
+            stats->fail++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+}
+
+void LoginWorker(brpc::Channel* channel, const std::atomic<bool>* stop, LoginStats* stats) {
+    siqi::auth::AdminService_Stub stub(channel);
+    while (!stop->load(std::memory_order_relaxed)) {
+        siqi::auth::LoginRequest request;
+        request.set_username(FLAGS_login_user);
+        request.set_password(FLAGS_login_password);
+        siqi::auth::LoginResponse response;
+        brpc::Controller cntl;
+        cntl.set_timeout_ms(5000);
+
+        long t1 = butil::gettimeofday_us();
+        stub.Login(&cntl, &request, &response, NULL);
+        long t2 = butil::gettimeofday_us();
+
+        stats->count++;
+        stats->latencies.push_back(t2 - t1);
+        int status = cntl.http_response().status_code();
+        if (status == 429) {
+            stats->rate_limited++;
+        } else if (status == 503) {
+            stats->overloaded++;
+        } else if (cntl.Failed()) {
+            stats->fail++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        } else if (response.success()) {
+            stats->success++;
+        } else {
+            stats->denied++;
+        }
+    }
+}
+
+long Percentile(const std::vector<long>& sorted, double p) {
+    return sorted.empty() ? 0 : sorted[static_cast<size_t>(sorted.size() * p)];
+}
+
+void PrintLatency(const std::string& name, long count, double seconds, std::vector<long>& latencies) {
+    std::sort(latencies.begin(), latencies.end());
+    std::cout << std::left << std::setw(18) << name << std::right << std::fixed << std::setprecision(2)
+              << "QPS " << std::setw(10) << count / seconds
+              << "  P50 " << std::setw(8) << Percentile(latencies, 0.50) / 1000.0 << " ms"
+              << "  P99 " << std::setw(8) << Percentile(latencies, 0.99) / 1000.0 << " ms"
+              << "  P999 " << std::setw(8) << Percentile(latencies, 0.999) / 1000.0 << " ms" << std::endl;
+}
+
+// 跑一个阶段：login_threads 为 0 时只有 Check
+void RunPhase(brpc::Channel* check_channel, brpc::Channel* login_channel, int login_threads,
+              CheckStats* check_total, LoginStats* login_total, double* seconds) {
+    std::atomic<bool> stop(false);
+    std::vector<CheckStats> check_stats(FLAGS_check_threads);
+    std::vector<LoginStats> login_stats(login_threads);
+    std::vector<std::thread> threads;
+
+    long start = butil::gettimeofday_ms();
+    for (int i = 0; i < FLAGS_check_threads; ++i) {
+        threads.emplace_back(CheckWorker, check_channel, &stop, &check_stats[i], i);
+    }
+    for (int i = 0; i < login_threads; ++i) {
+        threads.emplace_back(LoginWorker, login_channel, &stop, &login_stats[i]);
+    }
+    std::this_thread::sleep_for(std::chrono::seconds(FLAGS_duration));
+    stop = true;
+    for (auto& t : threads) {
+        t.join();
+    }
+    *seconds = (butil::gettimeofday_ms() - start) / 1000.0;
+
+    for (const auto& s : check_stats) {
+        check_total->count += s.count;
+        check_total->fail += s.fail;
+        check_total->latencies.insert(check_total->latencies.end(), s.latencies.begin(), s.latencies.end());
+    }
+    for (const auto& s : login_stats) {
+        login_total->count += s.count;
+        login_total->success += s.success;
+        login_total->denied += s.denied;
+        login_total->rate_limited += s.rate_limited;
+        login_total->overloaded += s.overloaded;
+        login_total->fail += s.fail;
+        login_total->latencies.insert(login_total->latencies.end(), s.latencies.begin(), s.latencies.end());
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+    brpc::Channel check_channel;
+    brpc::ChannelOptions check_options;
+    check_options.protocol = "baidu_std";
+    check_options.connection_type = "pooled";
+    if (check_channel.Init(FLAGS_server.c_str(), &check_options) != 0) {
+        LOG(ERROR) << "Fail to initialize check channel";
+        return -1;
+    }
+
+    brpc::Channel login_channel;
+    brpc::ChannelOptions login_options;
+    login_options.protocol = "http"; // 与管理后台一致，限流/过载通过 HTTP 状态码返回
+    login_options.max_retry = 0;
+    if (login_channel.Init(FLAGS_server.c_str(), &login_options) != 0) {
+        LOG(ERROR) << "Fail to initialize login channel";
+        return -1;
+    }
+
+    LOG(INFO) << "Phase 1: Check only, " << FLAGS_check_threads << " threads, " << FLAGS_duration << " s";
+    CheckStats baseline;
+    LoginStats unused;
+    double baseline_s = 0;
+    RunPhase(&check_channel, &login_channel, 0, &baseline, &unused, &baseline_s);
+
+    LOG(INFO) << "Phase 2: Check + " << FLAGS_login_threads << " login threads, " << FLAGS_duration << " s";
+    CheckStats mixed;
+    LoginStats logins;
+    double mixed_s = 0;
+    RunPhase(&check_channel, &login_channel, FLAGS_login_threads, &mixed, &logins, &mixed_s);
+
+    std::cout << "\n========================================================" << std::endl;
+    std::cout << "Login Storm Benchmark" << std::endl;
+    std::cout << "========================================================" << std::endl;
+    std::cout << "Server      : " << FLAGS_server << std::endl;
+    std::cout << "Check       : " << FLAGS_check_threads << " threads" << std::endl;
+    std::cout << "Login       : " << FLAGS_login_threads << " threads as '" << FLAGS_login_user << "'" << std::endl;
+    std::cout << "--------------------------------------------------------" << std::endl;
+    PrintLatency("Check (baseline)", baseline.count, baseline_s, baseline.latencies);
+    PrintLatency("Check (storm)", mixed.count, mixed_s, mixed.latencies);
+    PrintLatency("Login", logins.count, mixed_s, logins.latencies);
+    std::cout << "--------------------------------------------------------" << std::endl;
+    std::cout << "Check Failed: " << baseline.fail << " / " << mixed.fail << std::endl;
+    std::cout << "Login       : success " << logins.success << ", denied " << logins.denied
+              << ", rate limited " << logins.rate_limited << ", overloaded " << logins.overloaded
+              << ", failed " << logins.fail << std::endl;
+    std::cout << "========================================================" << std::endl;
+
+    return 0;
+}
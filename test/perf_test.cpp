@@ -1,8 +1,10 @@
 #include <brpc/channel.h>
+#include <brpc/callback.h>
 #include <gflags/gflags.h>
 #include <butil/time.h>
 #include <butil/logging.h>
 #include "auth.pb.h"
+#include "latency_histogram.h"
 #include <vector>
 #include <thread>
 #include <atomic>
@@ -11,27 +13,141 @@
 #include <iomanip>
 #include <iostream>
 #include <random>
+#include <memory>
+#include <mutex>
+#include <map>
+#include <fstream>
+#include <sstream>
+#include <cmath>
 
-DEFINE_string(server, "127.0.0.1:8888", "Server address to connect");
+DEFINE_string(server, "127.0.0.1:8888", "Server address to connect (defaults to 127.0.0.1:8881 with --target=agent)");
+DEFINE_string(target, "server", "server: auth_server; agent: auth_agent (Check / BatchCheck only)");
+DEFINE_string(protocol, "baidu_std", "baidu_std / http (keep-alive connection pool)");
+DEFINE_string(http_method, "", "With --protocol=http: get = query string (agent only), post = JSON body; empty = get for agent, post for server");
 DEFINE_int32(threads, 1, "Number of threads");
 DEFINE_int32(duration, 30, "Duration in seconds to run");
 DEFINE_bool(print_detail, false, "Print detailed latency for each thread");
+DEFINE_bool(by_id, false, "Use ResolveHandles once, then CheckById with numeric app/perm IDs instead of Check");
+DEFINE_int32(rate, 0, "Open-loop mode: total requests per second sent on a fixed schedule with async calls, 0 = closed-loop");
+DEFINE_string(output, "", "Write per-second snapshots and the summary to this file");
+DEFINE_string(output_format, "csv", "Format of --output: csv / json");
 
-// 简单的统计结构
+// 负载模型
+DEFINE_string(workload, "fixed", "fixed: uniform params, users from a 500-ID window per app; zipf: Zipf-distributed users and permissions");
+DEFINE_int32(zipf_users, 10000, "zipf workload: distinct users per app (rank 0 is the hottest)");
+DEFINE_double(zipf_s, 0.99, "zipf workload: skew exponent, 0 = uniform");
+DEFINE_string(workload_file, "", "Apps, user ID ranges and permissions to test (e.g. workload.txt written by gen_dataset), replacing the built-in init.sql ones");
+DEFINE_double(deny_ratio, 0, "Fraction of checks issued for users without any role, i.e. guaranteed denials (bots probing)");
+DEFINE_string(batch_sizes, "1", "Comma separated request sizes picked uniformly; 1 = Check, >1 = BatchCheck of that many items in one app");
+DEFINE_double(admin_write_rate, 0, "Background AdminService writes per second (GrantRoleToUser / AddPermissionToRole, each undone later)");
+DEFINE_string(admin_server, "", "auth_server address for background writes, empty = --server (required with --target=agent)");
+DEFINE_string(admin_user, "admin", "Console user for background writes");
+DEFINE_string(admin_password, "admin123", "Console password for background writes");
+DEFINE_string(admin_app, "qq_bot", "App touched by background writes");
+DEFINE_string(admin_role, "owner", "Role granted to hot users and given --admin_perm by background writes");
+DEFINE_string(admin_perm, "message:pin", "Permission toggled on --admin_role by background writes");
+
+// 一个统计区间（一秒）内的数据，延迟用固定内存的直方图记录，不保存逐条样本
+struct IntervalStats {
+    long count = 0;     // 请求数（一次 BatchCheck 算一次）
+    long success = 0;
+    long fail = 0;
+    long checks = 0;    // 成功请求中的检查项数
+    long denied = 0;    // 其中被拒绝的项数
+    LatencyHistogram latency;    // 从实际发出算起
+    LatencyHistogram corrected;  // 开环模式：从计划发送时间算起（包含排队）
+
+    void Merge(const IntervalStats& other) {
+        count += other.count;
+        success += other.success;
+        fail += other.fail;
+        checks += other.checks;
+        denied += other.denied;
+        latency.Merge(other.latency);
+        corrected.Merge(other.corrected);
+    }
+
+    void Reset() {
+        count = success = fail = checks = denied = 0;
+        latency.Reset();
+        corrected.Reset();
+    }
+};
+
+// 每个发送线程一份；工作线程（开环时为 RPC 回调）写入 current，主线程每秒取走
 struct ThreadStats {
+    std::mutex mutex;
+    IntervalStats current;
+    long failures = 0;  // 累计失败数，仅用于限制 --print_detail 的输出条数
+};
+
+// 后台管理写入的统计，写线程与主线程共享
+struct AdminStats {
+    std::mutex mutex;
+    long ok = 0;
+    long fail = 0;
+    long interval_ok = 0;  // 本秒完成数，主线程每秒清零
+    LatencyHistogram latency;
+};
+
+// 每秒的快照（只保留汇总值，长时间压测内存也不增长），用于进度输出与 --output；延迟单位微秒
+struct Snapshot {
+    std::string label;  // 秒序号，全程汇总为 "total"
+    double qps = 0;
     long count = 0;
     long success = 0;
     long fail = 0;
-    long latency_sum_us = 0;
-    std::vector<long> latencies; // 用于计算 P99等，注意内存使用
+    long checks = 0;
+    long denied = 0;
+    long admin_writes = 0;
+    double mean_us = 0;
+    int64_t p50 = 0, p90 = 0, p99 = 0, p999 = 0, max = 0;
+    int64_t corrected_p50 = 0, corrected_p99 = 0, corrected_p999 = 0, corrected_max = 0;
 };
 
+Snapshot Summarize(const std::string& label, const IntervalStats& st, double seconds, long admin_writes) {
+    Snapshot snap;
+    snap.label = label;
+    snap.qps = seconds > 0 ? st.count / seconds : 0.0;
+    snap.count = st.count;
+    snap.success = st.success;
+    snap.fail = st.fail;
+    snap.checks = st.checks;
+    snap.denied = st.denied;
+    snap.admin_writes = admin_writes;
+    snap.mean_us = st.latency.Mean();
+    snap.p50 = st.latency.Percentile(0.50);
+    snap.p90 = st.latency.Percentile(0.90);
+    snap.p99 = st.latency.Percentile(0.99);
+    snap.p999 = st.latency.Percentile(0.999);
+    snap.max = st.latency.Max();
+    snap.corrected_p50 = st.corrected.Percentile(0.50);
+    snap.corrected_p99 = st.corrected.Percentile(0.99);
+    snap.corrected_p999 = st.corrected.Percentile(0.999);
+    snap.corrected_max = st.corrected.Max();
+    return snap;
+}
+
+// 开环模式下尚未完成的异步请求数
+std::atomic<long> g_inflight(0);
+// 仍在发送的线程数
+std::atomic<int> g_running(0);
+
 struct TestParam {
     std::string app_code;
     std::string perm_key;
 };
 
-const std::vector<TestParam> kTestParams = {
+// --by_id 时由 ResolveHandles 预先解析，与 g_params 一一对应
+struct ResolvedParam {
+    uint64_t catalog_version = 0;   // 目录版本按应用区分
+    uint64_t app_id = 0;
+    uint64_t perm_id = 0;
+};
+std::vector<ResolvedParam> g_resolved;
+
+// zipf 负载中按顺序排名，越靠前越热；--workload_file 时替换为文件中的权限
+std::vector<TestParam> g_params = {
     {"qq_bot", "member:kick"},
     {"qq_bot", "member:mute"},
     {"qq_bot", "message:delete"},
@@ -44,88 +160,579 @@ const std::vector<TestParam> kTestParams = {
     {"course_bot", "homework:grade"}
 };
 
+// 智能生成符合该应用范围的用户ID，提高命中率
+// qq_bot: 100000+, admin_panel: 200000+, course_bot: 300000+
+// --workload_file 中各应用的用户范围：base ~ base + count - 1
+struct AppUsers {
+    long base = 0;
+    long count = 0;
+};
+std::map<std::string, AppUsers> g_app_users;
+
+long BaseUserId(const std::string& app_code) {
+    auto it = g_app_users.find(app_code);
+    if (it != g_app_users.end()) return it->second.base;
+    if (app_code == "admin_panel") return 200000;
+    if (app_code == "course_bot") return 300000;
+    return 100000;
+}
+
+// 读取负载文件，每行一条（# 开头为注释）:
+//   app <app_code> <首个用户 ID> <用户数>
+//   perm <app_code> <perm_key>     按热度排列，zipf 负载中越靠前越热
+bool LoadWorkloadFile(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) {
+        LOG(ERROR) << "Fail to open --workload_file: " << path;
+        return false;
+    }
+    std::vector<TestParam> params;
+    std::string line;
+    int line_no = 0;
+    while (std::getline(in, line)) {
+        ++line_no;
+        std::istringstream ss(line);
+        std::string kind;
+        if (!(ss >> kind) || kind[0] == '#') continue;
+        if (kind == "app") {
+            std::string app_code;
+            AppUsers users;
+            if (ss >> app_code >> users.base >> users.count && users.count > 0) {
+                g_app_users[app_code] = users;
+                continue;
+            }
+        } else if (kind == "perm") {
+            TestParam param;
+            if (ss >> param.app_code >> param.perm_key && g_app_users.count(param.app_code)) {
+                params.push_back(param);
+                continue;
+            }
+        }
+        LOG(ERROR) << path << ":" << line_no << ": invalid line (perm must follow its app): " << line;
+        return false;
+    }
+    if (params.empty()) {
+        LOG(ERROR) << "No perm lines in " << path;
+        return false;
+    }
+    g_params.swap(params);
+    return true;
+}
+
+// 没有任何角色的用户（--deny_ratio），与真实用户 ID 不重叠
+const long kProbeUserBase = 900000000;
+
+// Zipf 分布：第 k 名（从 0 开始）的概率正比于 1 / (k + 1)^s；预先算好累积分布，采样为一次二分查找
+class ZipfDistribution {
+public:
+    ZipfDistribution(size_t n, double s) : cdf_(std::max<size_t>(n, 1)) {
+        double sum = 0;
+        for (size_t k = 0; k < cdf_.size(); ++k) {
+            sum += 1.0 / std::pow(static_cast<double>(k + 1), s);
+            cdf_[k] = sum;
+        }
+        for (double& c : cdf_) {
+            c /= sum;
+        }
+    }
+
+    template <typename Rng>
+    size_t operator()(Rng& rng) const {
+        double u = std::uniform_real_distribution<double>(0.0, 1.0)(rng);
+        size_t k = std::lower_bound(cdf_.begin(), cdf_.end(), u) - cdf_.begin();
+        return std::min(k, cdf_.size() - 1);
+    }
+
+private:
+    std::vector<double> cdf_;
+};
+
+// 一次请求的内容：同一应用下的若干 (user_id, g_params 下标)
+struct Work {
+    std::string app_code;
+    std::vector<std::pair<std::string, size_t>> items;
+};
+
+std::vector<int> g_batch_sizes;
+std::unique_ptr<ZipfDistribution> g_user_zipf;
+std::unique_ptr<ZipfDistribution> g_param_zipf;
+
+// 每个发送线程一个，按 --workload 生成请求
+class WorkloadGenerator {
+public:
+    explicit WorkloadGenerator(int seed_offset)
+        : rng_(std::random_device{}() + seed_offset),
+          param_dist_(0, g_params.size() - 1),
+          window_dist_(0, 500),
+          size_dist_(0, g_batch_sizes.size() - 1) {}
+
+    Work Next() {
+        Work work;
+        size_t first = NextParam();
+        work.app_code = g_params[first].app_code;
+        int size = g_batch_sizes[size_dist_(rng_)];
+        for (int i = 0; i < size; ++i) {
+            size_t param = first;
+            if (i > 0) {
+                // BatchCheck 只能针对一个应用：按同样的分布抽取，抽到其他应用时重抽
+                for (int tries = 0; tries < 16; ++tries) {
+                    param = NextParam();
+                    if (g_params[param].app_code == work.app_code) break;
+                    param = first;
+                }
+            }
+            work.items.emplace_back(NextUser(work.app_code), param);
+        }
+        return work;
+    }
+
+    // 按负载的用户分布取一个排名
+    long NextUserRank() {
+        return g_user_zipf ? static_cast<long>((*g_user_zipf)(rng_)) : window_dist_(rng_);
+    }
+
+    // 负载文件给出了该应用的用户数时，排名落在其范围内：fixed 为全体用户均匀分布，zipf 按排名取模
+    long NextUserRank(const std::string& app_code) {
+        auto it = g_app_users.find(app_code);
+        if (it == g_app_users.end()) return NextUserRank();
+        if (g_user_zipf) return static_cast<long>((*g_user_zipf)(rng_)) % it->second.count;
+        return std::uniform_int_distribution<long>(0, it->second.count - 1)(rng_);
+    }
+
+private:
+    size_t NextParam() {
+        return g_param_zipf ? (*g_param_zipf)(rng_) : param_dist_(rng_);
+    }
+
+    std::string NextUser(const std::string& app_code) {
+        if (FLAGS_deny_ratio > 0 && std::uniform_real_distribution<double>(0.0, 1.0)(rng_) < FLAGS_deny_ratio) {
+            return std::to_string(kProbeUserBase + NextUserRank());
+        }
+        // fixed：base_id ~ base_id + 500 内，大概率命中真实存在的用户；zipf：按排名取用户
+        return std::to_string(BaseUserId(app_code) + NextUserRank(app_code));
+    }
+
+    std::mt19937 rng_;
+    std::uniform_int_distribution<int> param_dist_;
+    std::uniform_int_distribution<int> window_dist_;
+    std::uniform_int_distribution<int> size_dist_;
+};
+
+// 一次调用：单项走 Check / CheckById，多项走 BatchCheck / BatchCheckById
+struct Call {
+    brpc::Controller cntl;
+    siqi::auth::CheckRequest request;
+    siqi::auth::CheckResponse response;
+    siqi::auth::CheckByIdRequest id_request;
+    siqi::auth::CheckByIdResponse id_response;
+    siqi::auth::BatchCheckRequest batch_request;
+    siqi::auth::BatchCheckResponse batch_response;
+    siqi::auth::BatchCheckByIdRequest batch_id_request;
+    siqi::auth::BatchCheckByIdResponse batch_id_response;
+    bool http_get = false;  // 原始 HTTP GET，结论在响应 JSON 中
+    size_t items = 0;
+    long intended_us = 0;  // 开环模式：按固定节奏应当发出的时间
+    long sent_us = 0;      // 实际发出的时间
+    ThreadStats* stats = nullptr;
+};
+
+// 与业务方调用 Agent 的方式一致：GET /AuthService/Check?app_code=..&user_id=..&perm_key=..
+bool g_http_get = false;
+
+void Issue(brpc::Channel* channel, siqi::auth::AuthService_Stub& stub, const Work& work, Call* call,
+           google::protobuf::Closure* done) {
+    call->items = work.items.size();
+    // 只有 500ms 超时，快速失败
+    call->cntl.set_timeout_ms(500);
+    call->sent_us = butil::gettimeofday_us();
+    if (g_http_get && work.items.size() == 1) {
+        // 参数只含字母、数字与 ':'，无需转义
+        const auto& item = work.items[0];
+        call->http_get = true;
+        call->cntl.http_request().set_method(brpc::HTTP_METHOD_GET);
+        call->cntl.http_request().uri() = "/AuthService/Check?app_code=" + work.app_code + "&user_id=" + item.first +
+                                          "&perm_key=" + g_params[item.second].perm_key;
+        channel->CallMethod(NULL, &call->cntl, NULL, NULL, done);
+    } else if (work.items.size() == 1) {
+        const auto& item = work.items[0];
+        if (FLAGS_by_id) {
+            call->id_request.set_catalog_version(g_resolved[item.second].catalog_version);
+            call->id_request.set_app_id(g_resolved[item.second].app_id);
+            call->id_request.set_user_id(item.first);
+            call->id_request.set_perm_id(g_resolved[item.second].perm_id);
+            stub.CheckById(&call->cntl, &call->id_request, &call->id_response, done);
+        } else {
+            call->request.set_app_code(work.app_code);
+            call->request.set_user_id(item.first);
+            call->request.set_perm_key(g_params[item.second].perm_key);
+            stub.Check(&call->cntl, &call->request, &call->response, done);
+        }
+    } else if (FLAGS_by_id) {
+        call->batch_id_request.set_catalog_version(g_resolved[work.items[0].second].catalog_version);
+        call->batch_id_request.set_app_id(g_resolved[work.items[0].second].app_id);
+        for (const auto& item : work.items) {
+            call->batch_id_request.add_user_ids(item.first);
+            call->batch_id_request.add_perm_ids(g_resolved[item.second].perm_id);
+        }
+        stub.BatchCheckById(&call->cntl, &call->batch_id_request, &call->batch_id_response, done);
+    } else {
+        call->batch_request.set_app_code(work.app_code);
+        for (const auto& item : work.items) {
+            auto* check = call->batch_request.add_items();
+            check->set_user_id(item.first);
+            check->set_perm_key(g_params[item.second].perm_key);
+        }
+        stub.BatchCheck(&call->cntl, &call->batch_request, &call->batch_response, done);
+    }
+}
+
+// 记录一次调用的结果；返回是否需要打印失败详情
+bool Record(Call* call, long now_us) {
+    long denied = 0;
+    if (!call->cntl.Failed()) {
+        int code = 0;
+        if (call->http_get) {
+            // Agent 返回 pb 转成的 JSON；proto3 下 allowed 为 false 时不输出该字段
+            denied = call->cntl.response_attachment().to_string().find("\"allowed\":true") == std::string::npos;
+        } else if (call->items == 1 && FLAGS_by_id) {
+            code = call->id_response.code();
+            denied = !call->id_response.allowed();
+        } else if (call->items == 1) {
+            denied = !call->response.allowed();
+        } else if (FLAGS_by_id) {
+            code = call->batch_id_response.code();
+            for (bool allowed : call->batch_id_response.allowed()) denied += !allowed;
+        } else {
+            for (const auto& r : call->batch_response.results()) denied += !r.allowed();
+        }
+        if (code != 0) {
+            // 目录版本变化（压测期间有权限增删）等，按失败计
+            call->cntl.SetFailed(code, "CheckById code=%d", code);
+        }
+    }
+
+    // 锁只与每秒一次的汇总竞争，开销远小于一次 RPC
+    ThreadStats* stats = call->stats;
+    std::lock_guard<std::mutex> lock(stats->mutex);
+    stats->current.count++;
+    stats->current.latency.Record(now_us - call->sent_us);
+    if (call->intended_us > 0) {
+        stats->current.corrected.Record(now_us - call->intended_us);
+    }
+    if (call->cntl.Failed()) {
+        stats->current.fail++;
+        return FLAGS_print_detail && ++stats->failures <= 10;
+    }
+    stats->current.success++;
+    stats->current.checks += call->items;
+    stats->current.denied += denied;
+    return false;
+}
+
 void Worker(brpc::Channel* channel, int duration_s, ThreadStats* stats, int seed_offset) {
     siqi::auth::AuthService_Stub stub(channel);
-    
-    // 随机数生成器，用于随机 UserID，模拟一定的缓存穿透或随机访问
-    std::mt19937 rng(std::random_device{}() + seed_offset);
-    std::uniform_int_distribution<int> user_dist(100000, 310000); // 覆盖真实用户ID范围
-    std::uniform_int_distribution<int> param_dist(0, kTestParams.size() - 1);
+    WorkloadGenerator generator(seed_offset);
 
     long start_time_ms = butil::gettimeofday_ms();
     long end_time_ms = start_time_ms + duration_s * 1000;
-    
-    // 简单的 reporting
-    long last_report_time = start_time_ms;
-    long last_report_count = 0;
-
-    stats->latencies.reserve(duration_s * 1000); // 预估每秒1000qps per thread
 
     while (true) {
         long current_ms = butil::gettimeofday_ms();
         if (current_ms >= end_time_ms) break;
-        
-        // 每秒打印一次进度 (仅第一个线程)
-        if (seed_offset == 0 && (current_ms - last_report_time) >= 1000) {
-            double qps = (stats->count - last_report_count) * 1000.0 / (current_ms - last_report_time);
-            LOG(INFO) << "Progress: " << std::fixed << std::setprecision(1) 
-                      << 100.0 * (current_ms - start_time_ms) / (duration_s * 1000) << "% "
-                      << "Current QPS: " << qps;
-            last_report_time = current_ms;
-            last_report_count = stats->count;
-        }
-
-        const auto& param = kTestParams[param_dist(rng)];
-        
-        // 智能生成符合该应用范围的用户ID，提高命中率
-        // qq_bot: 100000+, admin_panel: 200000+, course_bot: 300000+
-        int base_id = 100000;
-        if (param.app_code == "admin_panel") base_id = 200000;
-        else if (param.app_code == "course_bot") base_id = 300000;
-        
-        // 生成范围在 base_id ~ base_id + 500 内，大概率命中真实存在的用户
-        std::uniform_int_distribution<int> smart_user_dist(base_id, base_id + 500);
-
-        siqi::auth::CheckRequest request;
-        request.set_app_code(param.app_code);
-        request.set_user_id(std::to_string(smart_user_dist(rng)));
-        request.set_perm_key(param.perm_key);
-
-        siqi::auth::CheckResponse response;
-        brpc::Controller cntl;
-        // 只有 100ms 超时，快速失败
-        cntl.set_timeout_ms(500);
 
+        Call call;
+        call.stats = stats;
+        Issue(channel, stub, generator.Next(), &call, NULL);
+        bool log_failure = Record(&call, butil::gettimeofday_us());
+
+        if (call.cntl.Failed()) {
+            // 失败时稍微sleep一下，避免疯狂报错
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            if (log_failure) {
+                 LOG(WARNING) << "RPC Failed: " << call.cntl.ErrorText();
+            }
+        }
+    }
+    g_running.fetch_sub(1);
+}
+
+void OnOpenLoopDone(Call* call) {
+    std::unique_ptr<Call> guard(call);
+    if (Record(call, butil::gettimeofday_us())) {
+        LOG(WARNING) << "RPC Failed: " << call->cntl.ErrorText();
+    }
+    g_inflight.fetch_sub(1, std::memory_order_relaxed);
+}
+
+// 开环发送：第 i 个请求的计划时间是 start + i * interval，不等待前一个请求返回。
+// 服务端变慢时请求照常按节奏发出并在服务端排队，延迟从计划时间算起，
+// 闭环压测因"慢了就少发"而漏掉的排队时间 (coordinated omission) 会如实计入。
+// 发送线程自身落后于计划时（sleep 精度、调度）也算进延迟，因此 threads 需足以支撑目标速率。
+void OpenLoopDispatcher(brpc::Channel* channel, int duration_s, double rate, ThreadStats* stats,
+                        int seed_offset, int num_threads) {
+    siqi::auth::AuthService_Stub stub(channel);
+    WorkloadGenerator generator(seed_offset);
+
+    const double interval_us = 1000000.0 / rate;
+    // 各发送线程错开相位，合起来是均匀的节奏
+    const long start_us = butil::gettimeofday_us() + static_cast<long>(interval_us * seed_offset / num_threads);
+    const long end_us = start_us + duration_s * 1000000L;
+
+    for (long i = 0;; ++i) {
+        long intended_us = start_us + static_cast<long>(i * interval_us);
+        if (intended_us >= end_us) break;
+        long now = butil::gettimeofday_us();
+        if (intended_us > now) {
+            std::this_thread::sleep_for(std::chrono::microseconds(intended_us - now));
+        }
+
+        Work work = generator.Next();
+        Call* call = new Call;
+        call->stats = stats;
+        call->intended_us = intended_us;
+        g_inflight.fetch_add(1, std::memory_order_relaxed);
+        Issue(channel, stub, work, call, brpc::NewCallback(OnOpenLoopDone, call));
+    }
+    g_running.fetch_sub(1);
+}
+
+// 后台管理写入：按固定速率循环执行 授予角色 -> 角色加权限 -> 撤销角色 -> 角色减权限，
+// 只撤销自己成功写入的部分，压测结束后数据与开始时一致。
+// 授予对象按 Check 的用户分布抽取，热点用户的缓存会被频繁失效；角色权限变更则失效整个应用。
+void AdminWriter(brpc::Channel* channel, const std::string& token, int duration_s, AdminStats* stats) {
+    siqi::auth::AdminService_Stub stub(channel);
+    WorkloadGenerator generator(-1);
+    const double interval_us = 1000000.0 / FLAGS_admin_write_rate;
+    const long start_us = butil::gettimeofday_us();
+    const long end_us = start_us + duration_s * 1000000L;
+    std::string granted_user;  // 已成功授予、待撤销的用户
+    bool perm_added = false;
+
+    // op: 0 授予角色，1 角色加权限，2 撤销角色，3 角色减权限
+    auto run = [&](int op, const std::string& user) {
+        siqi::auth::AdminResponse response;
+        brpc::Controller cntl;
+        cntl.set_timeout_ms(2000);
+        cntl.http_request().SetHeader("Authorization", "Bearer " + token);
         long t1 = butil::gettimeofday_us();
-        stub.Check(&cntl, &request, &response, NULL);
+        if (op == 0) {
+            siqi::auth::GrantRoleToUserRequest request;
+            request.set_app_code(FLAGS_admin_app);
+            request.set_user_id(user);
+            request.set_role_key(FLAGS_admin_role);
+            stub.GrantRoleToUser(&cntl, &request, &response, NULL);
+        } else if (op == 1) {
+            siqi::auth::AddPermissionToRoleRequest request;
+            request.set_app_code(FLAGS_admin_app);
+            request.set_role_key(FLAGS_admin_role);
+            request.set_perm_key(FLAGS_admin_perm);
+            stub.AddPermissionToRole(&cntl, &request, &response, NULL);
+        } else if (op == 2) {
+            siqi::auth::RevokeRoleFromUserRequest request;
+            request.set_app_code(FLAGS_admin_app);
+            request.set_user_id(user);
+            request.set_role_key(FLAGS_admin_role);
+            stub.RevokeRoleFromUser(&cntl, &request, &response, NULL);
+        } else {
+            siqi::auth::RemovePermissionFromRoleRequest request;
+            request.set_app_code(FLAGS_admin_app);
+            request.set_role_key(FLAGS_admin_role);
+            request.set_perm_key(FLAGS_admin_perm);
+            stub.RemovePermissionFromRole(&cntl, &request, &response, NULL);
+        }
         long t2 = butil::gettimeofday_us();
-        
-        long latency = t2 - t1;
-        stats->count++;
-        stats->latencies.push_back(latency);
-        stats->latency_sum_us += latency;
-        
-        if (!cntl.Failed()) {
-            stats->success++;
+        bool ok = !cntl.Failed() && response.success();
+        std::lock_guard<std::mutex> lock(stats->mutex);
+        stats->latency.Record(t2 - t1);
+        if (ok) {
+            stats->ok++;
+            stats->interval_ok++;
         } else {
-            // 失败时稍微sleep一下，避免疯狂报错
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
             stats->fail++;
-            if (FLAGS_print_detail && stats->fail <= 10) {
-                 LOG(WARNING) << "RPC Failed: " << cntl.ErrorText();
+        }
+        return ok;
+    };
+
+    for (long i = 0;; ++i) {
+        long intended_us = start_us + static_cast<long>(i * interval_us);
+        if (intended_us >= end_us) break;
+        long now = butil::gettimeofday_us();
+        if (intended_us > now) {
+            std::this_thread::sleep_for(std::chrono::microseconds(intended_us - now));
+        }
+        switch (i % 4) {
+        case 0: {
+            // 用户原本就有该角色时授予失败，也就不会在后面撤销
+            std::string user = std::to_string(BaseUserId(FLAGS_admin_app) + generator.NextUserRank(FLAGS_admin_app));
+            if (run(0, user)) granted_user = user;
+            break;
+        }
+        case 1:
+            perm_added = run(1, "");
+            break;
+        case 2:
+            if (!granted_user.empty()) run(2, granted_user);
+            granted_user.clear();
+            break;
+        default:
+            if (perm_added) run(3, "");
+            perm_added = false;
+            break;
+        }
+    }
+    if (!granted_user.empty()) run(2, granted_user);
+    if (perm_added) run(3, "");
+}
+
+// 取走各线程当前区间的数据
+void Drain(std::vector<ThreadStats>& all_stats, IntervalStats* out) {
+    for (auto& s : all_stats) {
+        std::lock_guard<std::mutex> lock(s.mutex);
+        out->Merge(s.current);
+        s.current.Reset();
+    }
+}
+
+std::vector<int> ParseSizes(const std::string& spec) {
+    std::vector<int> result;
+    std::stringstream ss(spec);
+    std::string part;
+    while (std::getline(ss, part, ',')) {
+        int n = atoi(part.c_str());
+        if (n > 0) result.push_back(n);
+    }
+    return result;
+}
+
+// 写 --output：每秒一行/一项，最后是全程汇总
+bool WriteOutput(const std::vector<Snapshot>& snapshots, const Snapshot& total) {
+    std::ofstream out(FLAGS_output.c_str());
+    if (!out) {
+        return false;
+    }
+    const bool open_loop = FLAGS_rate > 0;
+    out << std::fixed << std::setprecision(2);
+    if (FLAGS_output_format == "json") {
+        auto write_snapshot = [&](const Snapshot& snap) {
+            out << "\"qps\": " << snap.qps << ", \"count\": " << snap.count
+                << ", \"success\": " << snap.success << ", \"fail\": " << snap.fail
+                << ", \"checks\": " << snap.checks << ", \"denied\": " << snap.denied
+                << ", \"admin_writes\": " << snap.admin_writes
+                << ", \"mean_us\": " << snap.mean_us << ", \"p50_us\": " << snap.p50 << ", \"p90_us\": " << snap.p90
+                << ", \"p99_us\": " << snap.p99 << ", \"p999_us\": " << snap.p999 << ", \"max_us\": " << snap.max;
+            if (open_loop) {
+                out << ", \"corrected_p50_us\": " << snap.corrected_p50 << ", \"corrected_p99_us\": " << snap.corrected_p99
+                    << ", \"corrected_p999_us\": " << snap.corrected_p999 << ", \"corrected_max_us\": " << snap.corrected_max;
+            }
+        };
+        out << "{\n  \"config\": {\"server\": \"" << FLAGS_server << "\", \"target\": \"" << FLAGS_target
+            << "\", \"protocol\": \"" << FLAGS_protocol << "\", \"http_method\": \"" << FLAGS_http_method << "\", \"api\": \""
+            << (FLAGS_by_id ? "CheckById" : "Check") << "\", \"threads\": " << FLAGS_threads
+            << ", \"duration\": " << FLAGS_duration << ", \"rate\": " << FLAGS_rate
+            << ", \"workload\": \"" << FLAGS_workload << "\", \"workload_file\": \"" << FLAGS_workload_file
+            << "\", \"zipf_users\": " << FLAGS_zipf_users
+            << ", \"zipf_s\": " << FLAGS_zipf_s << ", \"deny_ratio\": " << FLAGS_deny_ratio
+            << ", \"batch_sizes\": \"" << FLAGS_batch_sizes << "\", \"admin_write_rate\": " << FLAGS_admin_write_rate << "},\n";
+        out << "  \"intervals\": [\n";
+        for (size_t i = 0; i < snapshots.size(); ++i) {
+            out << "    {\"second\": " << snapshots[i].label << ", ";
+            write_snapshot(snapshots[i]);
+            out << "}" << (i + 1 < snapshots.size() ? "," : "") << "\n";
+        }
+        out << "  ],\n  \"summary\": {";
+        write_snapshot(total);
+        out << "}\n}\n";
+    } else {
+        out << "second,qps,count,success,fail,checks,denied,admin_writes,mean_us,p50_us,p90_us,p99_us,p999_us,max_us";
+        if (open_loop) {
+            out << ",corrected_p50_us,corrected_p99_us,corrected_p999_us,corrected_max_us";
+        }
+        out << "\n";
+        auto write_row = [&](const Snapshot& snap) {
+            out << snap.label << "," << snap.qps << "," << snap.count << "," << snap.success << "," << snap.fail
+                << "," << snap.checks << "," << snap.denied << "," << snap.admin_writes
+                << "," << snap.mean_us << "," << snap.p50 << "," << snap.p90 << "," << snap.p99
+                << "," << snap.p999 << "," << snap.max;
+            if (open_loop) {
+                out << "," << snap.corrected_p50 << "," << snap.corrected_p99
+                    << "," << snap.corrected_p999 << "," << snap.corrected_max;
             }
+            out << "\n";
+        };
+        for (const auto& snap : snapshots) {
+            write_row(snap);
         }
+        write_row(total);
     }
+    return static_cast<bool>(out);
 }
 
 int main(int argc, char* argv[]) {
     gflags::ParseCommandLineFlags(&argc, &argv, true);
-    
+
+    if (!FLAGS_output.empty() && FLAGS_output_format != "csv" && FLAGS_output_format != "json") {
+        LOG(ERROR) << "Unknown --output_format: " << FLAGS_output_format;
+        return -1;
+    }
+    if (!FLAGS_workload_file.empty() && !LoadWorkloadFile(FLAGS_workload_file)) {
+        return -1;
+    }
+    if (FLAGS_workload == "zipf") {
+        g_user_zipf.reset(new ZipfDistribution(std::max(FLAGS_zipf_users, 1), FLAGS_zipf_s));
+        g_param_zipf.reset(new ZipfDistribution(g_params.size(), FLAGS_zipf_s));
+    } else if (FLAGS_workload != "fixed") {
+        LOG(ERROR) << "Unknown --workload: " << FLAGS_workload;
+        return -1;
+    }
+    if (FLAGS_target == "agent") {
+        if (gflags::GetCommandLineFlagInfoOrDie("server").is_default) {
+            FLAGS_server = "127.0.0.1:8881";
+        }
+        if (FLAGS_by_id) {
+            LOG(ERROR) << "auth_agent does not serve CheckById, drop --by_id";
+            return -1;
+        }
+        if (FLAGS_admin_write_rate > 0 && FLAGS_admin_server.empty()) {
+            LOG(ERROR) << "--admin_write_rate with --target=agent needs --admin_server (auth_server address)";
+            return -1;
+        }
+    } else if (FLAGS_target != "server") {
+        LOG(ERROR) << "Unknown --target: " << FLAGS_target;
+        return -1;
+    }
+    if (FLAGS_protocol != "baidu_std" && FLAGS_protocol != "http") {
+        LOG(ERROR) << "Unknown --protocol: " << FLAGS_protocol;
+        return -1;
+    }
+    if (FLAGS_protocol == "http") {
+        if (FLAGS_http_method.empty()) {
+            FLAGS_http_method = FLAGS_target == "agent" ? "get" : "post";
+        }
+        if (FLAGS_http_method != "get" && FLAGS_http_method != "post") {
+            LOG(ERROR) << "Unknown --http_method: " << FLAGS_http_method;
+            return -1;
+        }
+        if (FLAGS_http_method == "get" && (FLAGS_target != "agent" || FLAGS_by_id)) {
+            LOG(ERROR) << "Query-string GET is only served by auth_agent Check";
+            return -1;
+        }
+        // BatchCheck 没有 GET 形式，批量请求仍走 JSON POST
+        g_http_get = FLAGS_http_method == "get";
+    }
+    if (FLAGS_admin_server.empty()) {
+        FLAGS_admin_server = FLAGS_server;
+    }
+    g_batch_sizes = ParseSizes(FLAGS_batch_sizes);
+    if (g_batch_sizes.empty()) {
+        LOG(ERROR) << "Invalid --batch_sizes: " << FLAGS_batch_sizes;
+        return -1;
+    }
+
     // 初始化 Channel，所有线程共享一个 Channel 对象通常是最佳实践（bRPC内部有连接池）
     brpc::Channel channel;
     brpc::ChannelOptions options;
-    options.protocol = "baidu_std";
-    options.connection_type = "pooled"; // 使用连接池
+    options.protocol = FLAGS_protocol;
+    options.connection_type = "pooled"; // 使用连接池（HTTP 下即 keep-alive 长连接池）
     options.timeout_ms = 1000;
     options.max_retry = 3;
 
@@ -134,16 +741,116 @@ int main(int argc, char* argv[]) {
         return -1;
     }
 
-    LOG(INFO) << "Starting performance test on " << FLAGS_server 
-              << " with " << FLAGS_threads << " threads for " << FLAGS_duration << " seconds...";
+    if (FLAGS_by_id) {
+        // 每个应用解析一次，记下各参数对应的数字 ID
+        siqi::auth::AuthService_Stub stub(&channel);
+        g_resolved.resize(g_params.size());
+        for (size_t i = 0; i < g_params.size(); ++i) {
+            siqi::auth::ResolveHandlesRequest request;
+            request.set_app_code(g_params[i].app_code);
+            request.add_perm_keys(g_params[i].perm_key);
+            siqi::auth::ResolveHandlesResponse response;
+            brpc::Controller cntl;
+            stub.ResolveHandles(&cntl, &request, &response, NULL);
+            if (cntl.Failed() || !response.success()) {
+                LOG(ERROR) << "ResolveHandles failed for " << g_params[i].app_code << ": "
+                           << (cntl.Failed() ? cntl.ErrorText() : response.message());
+                return -1;
+            }
+            g_resolved[i].catalog_version = response.catalog_version();
+            g_resolved[i].app_id = response.app_id();
+            g_resolved[i].perm_id = response.perm_ids(0);
+        }
+        LOG(INFO) << "Resolved handles for " << g_resolved.size() << " params";
+    }
+
+    // 后台管理写入走 HTTP，与管理后台一致，Token 放在 Authorization 头
+    brpc::Channel admin_channel;
+    std::string admin_token;
+    if (FLAGS_admin_write_rate > 0) {
+        brpc::ChannelOptions admin_options;
+        admin_options.protocol = "http";
+        admin_options.max_retry = 0;
+        if (admin_channel.Init(FLAGS_admin_server.c_str(), &admin_options) != 0) {
+            LOG(ERROR) << "Fail to initialize admin channel";
+            return -1;
+        }
+        siqi::auth::AdminService_Stub admin_stub(&admin_channel);
+        siqi::auth::LoginRequest request;
+        request.set_username(FLAGS_admin_user);
+        request.set_password(FLAGS_admin_password);
+        siqi::auth::LoginResponse response;
+        brpc::Controller cntl;
+        cntl.set_timeout_ms(5000);
+        admin_stub.Login(&cntl, &request, &response, NULL);
+        if (cntl.Failed() || !response.success()) {
+            LOG(ERROR) << "Login as " << FLAGS_admin_user << " failed: "
+                       << (cntl.Failed() ? cntl.ErrorText() : response.message());
+            return -1;
+        }
+        admin_token = response.token();
+    }
+
+    LOG(INFO) << "Starting performance test on " << FLAGS_server
+              << " with " << FLAGS_threads << " threads for " << FLAGS_duration << " seconds"
+              << (FLAGS_rate > 0 ? ", open-loop at " + std::to_string(FLAGS_rate) + " req/s" : "") << "...";
 
     std::vector<std::thread> threads;
     std::vector<ThreadStats> all_stats(FLAGS_threads);
+    AdminStats admin_stats;
 
     long start_time = butil::gettimeofday_ms();
 
+    g_running = FLAGS_threads;
     for (int i = 0; i < FLAGS_threads; ++i) {
-        threads.emplace_back(Worker, &channel, FLAGS_duration, &all_stats[i], i);
+        if (FLAGS_rate > 0) {
+            threads.emplace_back(OpenLoopDispatcher, &channel, FLAGS_duration,
+                                 static_cast<double>(FLAGS_rate) / FLAGS_threads, &all_stats[i], i, FLAGS_threads);
+        } else {
+            threads.emplace_back(Worker, &channel, FLAGS_duration, &all_stats[i], i);
+        }
+    }
+    if (FLAGS_admin_write_rate > 0) {
+        threads.emplace_back(AdminWriter, &admin_channel, admin_token, FLAGS_duration, &admin_stats);
+    }
+
+    // 每秒汇总一次各线程的直方图；发送结束后开环模式还要等已发出的请求返回（最长为 RPC 超时）
+    std::vector<Snapshot> snapshots;
+    IntervalStats total;
+    long last_ms = start_time;
+    auto finished = [] {
+        return g_running.load() == 0 && g_inflight.load(std::memory_order_relaxed) == 0;
+    };
+    for (int second = 1;; ++second) {
+        long wake_ms = start_time + second * 1000L;
+        while (butil::gettimeofday_ms() < wake_ms && !finished()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        // 先判断再 Drain：请求在计数递减之前已写入统计，结束时最后一次 Drain 不会漏数据
+        bool done = finished();
+        long now_ms = butil::gettimeofday_ms();
+        IntervalStats interval;
+        Drain(all_stats, &interval);
+        long admin_writes = 0;
+        {
+            std::lock_guard<std::mutex> lock(admin_stats.mutex);
+            admin_writes = admin_stats.interval_ok;
+            admin_stats.interval_ok = 0;
+        }
+        if (interval.count > 0 || !done) {
+            Snapshot snap = Summarize(std::to_string(second), interval, (now_ms - last_ms) / 1000.0, admin_writes);
+            LOG(INFO) << "[" << second << "s] QPS: " << std::fixed << std::setprecision(1) << snap.qps
+                      << " P50: " << snap.p50 << "us P99: " << snap.p99 << "us P999: " << snap.p999 << "us"
+                      << (FLAGS_rate > 0 ? " Corrected P99: " + std::to_string(snap.corrected_p99) + "us" : "")
+                      << (FLAGS_admin_write_rate > 0 ? " Writes: " + std::to_string(admin_writes) : "")
+                      << " Fail: " << snap.fail;
+            total.Merge(interval);
+            snapshots.push_back(snap);
+        }
+        last_ms = now_ms;
+        if (done) {
+            break;
+        }
     }
 
     for (auto& t : threads) {
@@ -153,49 +860,79 @@ int main(int argc, char* argv[]) {
     long end_time = butil::gettimeofday_ms();
     double actual_duration_s = (end_time - start_time) / 1000.0;
 
-    // 汇总数据
-    long total_req = 0;
-    long total_success = 0;
-    long total_fail = 0;
-    long total_latency_us = 0;
-    std::vector<long> all_latencies;
-
-    for (const auto& s : all_stats) {
-        total_req += s.count;
-        total_success += s.success;
-        total_fail += s.fail;
-        total_latency_us += s.latency_sum_us;
-        all_latencies.insert(all_latencies.end(), s.latencies.begin(), s.latencies.end());
-    }
-
-    std::sort(all_latencies.begin(), all_latencies.end());
-    
-    long p50 = all_latencies.empty() ? 0 : all_latencies[all_latencies.size() * 0.50];
-    long p90 = all_latencies.empty() ? 0 : all_latencies[all_latencies.size() * 0.90];
-    long p99 = all_latencies.empty() ? 0 : all_latencies[all_latencies.size() * 0.99];
-    long p999 = all_latencies.empty() ? 0 : all_latencies[all_latencies.size() * 0.999];
-    double avg_latency = total_req == 0 ? 0.0 : (double)total_latency_us / total_req / 1000.0; // ms
+    long total_req = total.count;
+    long total_success = total.success;
+    long total_fail = total.fail;
+    long p50 = total.latency.Percentile(0.50);
+    long p90 = total.latency.Percentile(0.90);
+    long p99 = total.latency.Percentile(0.99);
+    long p999 = total.latency.Percentile(0.999);
+    double avg_latency = total.latency.Mean() / 1000.0; // ms
 
     double qps = total_req / actual_duration_s;
 
     std::cout << "\n========================================================" << std::endl;
     std::cout << "Performance Test Result" << std::endl;
     std::cout << "========================================================" << std::endl;
-    std::cout << "Server      : " << FLAGS_server << std::endl;
+    std::cout << "Server      : " << FLAGS_server << " (" << FLAGS_target << ", " << FLAGS_protocol
+              << (FLAGS_protocol == "http" ? " " + FLAGS_http_method : "") << ")" << std::endl;
     std::cout << "Threads     : " << FLAGS_threads << std::endl;
+    std::cout << "API         : " << (FLAGS_by_id ? "CheckById" : "Check")
+              << (FLAGS_batch_sizes != "1" ? ", batch sizes " + FLAGS_batch_sizes : "") << std::endl;
+    if (FLAGS_rate > 0) {
+        std::cout << "Mode        : open-loop, target " << FLAGS_rate << " Req/s" << std::endl;
+    } else {
+        std::cout << "Mode        : closed-loop" << std::endl;
+    }
+    std::cout << "Workload    : " << FLAGS_workload;
+    if (FLAGS_workload == "zipf") {
+        std::cout << " (users " << FLAGS_zipf_users << ", s " << FLAGS_zipf_s << ")";
+    }
+    if (!FLAGS_workload_file.empty()) {
+        std::cout << ", file " << FLAGS_workload_file << " (" << g_app_users.size() << " apps, "
+                  << g_params.size() << " perms)";
+    }
+    std::cout << ", deny ratio " << FLAGS_deny_ratio << std::endl;
     std::cout << "Duration    : " << actual_duration_s << " s" << std::endl;
     std::cout << "--------------------------------------------------------" << std::endl;
     std::cout << "QPS         : " << std::fixed << std::setprecision(2) << qps << " Req/s" << std::endl;
     std::cout << "Total Req   : " << total_req << std::endl;
     std::cout << "Success     : " << total_success << " (" << (total_req > 0 ? 100.0 * total_success / total_req : 0) << "%)" << std::endl;
     std::cout << "Failed      : " << total_fail << " (" << (total_req > 0 ? 100.0 * total_fail / total_req : 0) << "%)" << std::endl;
+    std::cout << "Checks      : " << total.checks << ", denied " << total.denied << " ("
+              << (total.checks > 0 ? 100.0 * total.denied / total.checks : 0) << "%)" << std::endl;
+    if (FLAGS_admin_write_rate > 0) {
+        std::cout << "Admin Writes: " << admin_stats.ok << " ok, " << admin_stats.fail << " failed, P99 "
+                  << admin_stats.latency.Percentile(0.99) / 1000.0 << " ms" << std::endl;
+    }
     std::cout << "--------------------------------------------------------" << std::endl;
+    if (FLAGS_rate > 0) {
+        std::cout << "Uncorrected (from actual send time)" << std::endl;
+    }
     std::cout << "Avg Latency : " << avg_latency << " ms" << std::endl;
     std::cout << "P50 Latency : " << p50 / 1000.0 << " ms" << std::endl;
     std::cout << "P90 Latency : " << p90 / 1000.0 << " ms" << std::endl;
     std::cout << "P99 Latency : " << p99 / 1000.0 << " ms" << std::endl;
     std::cout << "P999 Latency: " << p999 / 1000.0 << " ms" << std::endl;
+    if (FLAGS_rate > 0) {
+        // 上面是从实际发出算起的服务时间；下面从计划发送时间算起，包含排队，饱和时以此为准
+        std::cout << "--------------------------------------------------------" << std::endl;
+        std::cout << "Corrected (from intended send time)" << std::endl;
+        std::cout << "P50 Latency : " << total.corrected.Percentile(0.50) / 1000.0 << " ms" << std::endl;
+        std::cout << "P90 Latency : " << total.corrected.Percentile(0.90) / 1000.0 << " ms" << std::endl;
+        std::cout << "P99 Latency : " << total.corrected.Percentile(0.99) / 1000.0 << " ms" << std::endl;
+        std::cout << "P999 Latency: " << total.corrected.Percentile(0.999) / 1000.0 << " ms" << std::endl;
+        std::cout << "Max Latency : " << total.corrected.Max() / 1000.0 << " ms" << std::endl;
+    }
     std::cout << "========================================================" << std::endl;
 
+    if (!FLAGS_output.empty()) {
+        if (!WriteOutput(snapshots, Summarize("total", total, actual_duration_s, admin_stats.ok))) {
+            LOG(ERROR) << "Fail to write " << FLAGS_output;
+            return -1;
+        }
+        LOG(INFO) << "Wrote " << snapshots.size() << " snapshots to " << FLAGS_output;
+    }
+
     return 0;
 }
@@ -0,0 +1,193 @@
+#include <brpc/channel.h>
+#include <gflags/gflags.h>
+#include <butil/time.h>
+#include <butil/logging.h>
+#include "auth.pb.h"
+#include "latency_histogram.h"
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+// 本机 auth_agent 的传输层对比：同一个 Agent 分别通过回环 TCP 与 Unix Domain Socket 调用 Check，
+// 每种传输按 --threads 列表依次跑一轮闭环压测，输出各自的 QPS 与 P50/P99/P999。
+// --mode=transport（默认）固定检查一个不存在的应用：请求合法、不触发 Agent 的告警日志，Agent 只按 app_code 查两次
+// sys_apps 的唯一索引就返回"应用不存在"，测到的主要是传输与框架开销；
+// --mode=check 发送真实检查，用来看传输差异在端到端延迟中的占比。
+// 用法:
+//   ./build/auth_agent --uds_path=/run/siqi_auth/agent.sock
+//   ./build/transport_bench --tcp=127.0.0.1:8881 --uds=/run/siqi_auth/agent.sock --threads=1,8,32
+
+DEFINE_string(tcp, "127.0.0.1:8881", "auth_agent TCP address");
+DEFINE_string(uds, "/run/siqi_auth/agent.sock", "auth_agent Unix Domain Socket path (--uds_path of the agent)");
+DEFINE_string(threads, "1,8,32", "Comma separated thread counts, one round per transport for each");
+DEFINE_int32(duration, 10, "Duration in seconds of each round");
+DEFINE_string(mode, "transport", "transport: Check of a nonexistent app (cheapest well-formed request); check: real permission checks");
+DEFINE_string(connection_type, "single", "bRPC connection type: single / pooled");
+
+namespace {
+
+struct Stats {
+    long count = 0;
+    long fail = 0;
+    LatencyHistogram latency;  // 微秒，固定内存
+};
+
+const std::vector<std::pair<std::string, std::string>> kCheckParams = {
+    {"qq_bot", "member:kick"},
+    {"qq_bot", "message:delete"},
+    {"admin_panel", "data:view"},
+    {"admin_panel", "user:create"},
+    {"course_bot", "homework:assign"}
+};
+
+// --mode=transport 使用的应用不在 init.sql 中，Agent 回答"应用不存在"
+const char* const kProbeApp = "transport_bench_nonexistent";
+const char* const kProbeUser = "0";
+const char* const kProbePerm = "transport:probe";
+
+void Worker(brpc::Channel* channel, const std::atomic<bool>* stop, Stats* stats, int seed) {
+    siqi::auth::AuthService_Stub stub(channel);
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> param_dist(0, kCheckParams.size() - 1);
+    std::uniform_int_distribution<int> offset_dist(0, 500);
+    const bool real_check = FLAGS_mode == "check";
+
+    while (!stop->load(std::memory_order_relaxed)) {
+        siqi::auth::CheckRequest request;
+        if (real_check) {
+            const auto& param = kCheckParams[param_dist(rng)];
+            int base_id = 100000;
+            if (param.first == "admin_panel") base_id = 200000;
+            else if (param.first == "course_bot") base_id = 300000;
+            request.set_app_code(param.first);
+            request.set_user_id(std::to_string(base_id + offset_dist(rng)));
+            request.set_perm_key(param.second);
+        } else {
+            request.set_app_code(kProbeApp);
+            request.set_user_id(kProbeUser);
+            request.set_perm_key(kProbePerm);
+        }
+        siqi::auth::CheckResponse response;
+        brpc::Controller cntl;
+        cntl.set_timeout_ms(1000);
+
+        long t1 = butil::gettimeofday_us();
+        stub.Check(&cntl, &request, &response, NULL);
+        long t2 = butil::gettimeofday_us();
+
+        stats->count++;
+        stats->latency.Record(t2 - t1);
+        if (cntl.Failed()) {
+            stats->fail++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+}
+
+// 每个数值单位为微秒：传输层差异在几十微秒量级，毫秒精度看不出来
+void PrintLatency(const std::string& name, long count, long fail, double seconds, const LatencyHistogram& latency) {
+    std::cout << std::left << std::setw(14) << name << std::right << std::fixed << std::setprecision(0)
+              << "QPS " << std::setw(9) << count / seconds
+              << "  P50 " << std::setw(6) << latency.Percentile(0.50) << " us"
+              << "  P99 " << std::setw(6) << latency.Percentile(0.99) << " us"
+              << "  P999 " << std::setw(6) << latency.Percentile(0.999) << " us"
+              << "  failed " << fail << std::endl;
+}
+
+void RunRound(brpc::Channel* channel, int threads, Stats* total, double* seconds) {
+    std::atomic<bool> stop(false);
+    std::vector<Stats> stats(threads);
+    std::vector<std::thread> workers;
+
+    long start = butil::gettimeofday_ms();
+    for (int i = 0; i < threads; ++i) {
+        workers.emplace_back(Worker, channel, &stop, &stats[i], i);
+    }
+    std::this_thread::sleep_for(std::chrono::seconds(FLAGS_duration));
+    stop = true;
+    for (auto& t : workers) {
+        t.join();
+    }
+    *seconds = (butil::gettimeofday_ms() - start) / 1000.0;
+
+    for (const auto& s : stats) {
+        total->count += s.count;
+        total->fail += s.fail;
+        total->latency.Merge(s.latency);
+    }
+}
+
+std::vector<int> ParseThreads(const std::string& spec) {
+    std::vector<int> result;
+    size_t pos = 0;
+    while (pos <= spec.size()) {
+        size_t comma = spec.find(',', pos);
+        if (comma == std::string::npos) comma = spec.size();
+        int n = atoi(spec.substr(pos, comma - pos).c_str());
+        if (n > 0) result.push_back(n);
+        pos = comma + 1;
+    }
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+    brpc::ChannelOptions options;
+    options.protocol = "baidu_std";
+    options.connection_type = FLAGS_connection_type;
+    options.max_retry = 0;
+
+    brpc::Channel tcp_channel;
+    if (tcp_channel.Init(FLAGS_tcp.c_str(), &options) != 0) {
+        LOG(ERROR) << "Fail to initialize TCP channel to " << FLAGS_tcp;
+        return -1;
+    }
+    brpc::Channel uds_channel;
+    const std::string uds_addr = "unix:" + FLAGS_uds;
+    if (uds_channel.Init(uds_addr.c_str(), &options) != 0) {
+        LOG(ERROR) << "Fail to initialize UDS channel to " << uds_addr;
+        return -1;
+    }
+
+    std::vector<int> thread_counts = ParseThreads(FLAGS_threads);
+    if (thread_counts.empty()) {
+        LOG(ERROR) << "Invalid --threads: " << FLAGS_threads;
+        return -1;
+    }
+
+    std::cout << "\n========================================================" << std::endl;
+    std::cout << "Agent Transport Benchmark (TCP vs Unix Domain Socket)" << std::endl;
+    std::cout << "========================================================" << std::endl;
+    std::cout << "TCP         : " << FLAGS_tcp << std::endl;
+    std::cout << "UDS         : " << FLAGS_uds << std::endl;
+    std::cout << "Mode        : " << FLAGS_mode << ", connection " << FLAGS_connection_type
+              << ", " << FLAGS_duration << " s per round" << std::endl;
+
+    for (int threads : thread_counts) {
+        // 两种传输交替进行，尽量让两者面对相同的机器状态
+        LOG(INFO) << "Round: " << threads << " threads over TCP";
+        Stats tcp;
+        double tcp_s = 0;
+        RunRound(&tcp_channel, threads, &tcp, &tcp_s);
+
+        LOG(INFO) << "Round: " << threads << " threads over UDS";
+        Stats uds;
+        double uds_s = 0;
+        RunRound(&uds_channel, threads, &uds, &uds_s);
+
+        std::cout << "--------------------------------------------------------" << std::endl;
+        std::cout << "Threads     : " << threads << std::endl;
+        PrintLatency("TCP", tcp.count, tcp.fail, tcp_s, tcp.latency);
+        PrintLatency("UDS", uds.count, uds.fail, uds_s, uds.latency);
+    }
+    std::cout << "========================================================" << std::endl;
+
+    return 0;
+}